@@ -28,6 +28,8 @@
 #   DEAL_II_HAVE_AVX512                  (*)
 #   DEAL_II_HAVE_ALTIVEC                 (*)
 #   DEAL_II_HAVE_ARM_NEON                (*)
+#   DEAL_II_HAVE_ARM_SVE                 (*)
+#   DEAL_II_HAVE_ARM_SVE_512             (*)
 #   DEAL_II_HAVE_OPENMP_SIMD             (*)
 #   DEAL_II_VECTORIZATION_WIDTH_IN_BITS
 #   DEAL_II_OPENMP_SIMD_PRAGMA
@@ -73,6 +75,7 @@ if(DEAL_II_ALLOW_PLATFORM_INTROSPECTION)
   #
   unset_if_changed(CHECK_CPU_FEATURES_FLAGS_SAVED "${CMAKE_REQUIRED_FLAGS}"
     DEAL_II_HAVE_SSE2 DEAL_II_HAVE_AVX DEAL_II_HAVE_AVX512 DEAL_II_HAVE_ALTIVEC DEAL_II_HAVE_ARM_NEON
+    DEAL_II_HAVE_ARM_SVE DEAL_II_HAVE_ARM_SVE_512
     )
 
   CHECK_CXX_SOURCE_RUNS(
@@ -279,6 +282,60 @@ if(DEAL_II_ALLOW_PLATFORM_INTROSPECTION)
       "
       DEAL_II_HAVE_ARM_NEON)
 
+    #
+    # SVE is only used with a vector length that is fixed at compile time
+    # with -msve-vector-bits=256 or -msve-vector-bits=512, which also needs
+    # to agree with the vector length of the hardware.
+    #
+    CHECK_CXX_SOURCE_RUNS(
+      "
+      #if !defined(__ARM_FEATURE_SVE) || !defined(__ARM_FEATURE_SVE_BITS)
+      #error Preprocessor flag not found
+      #endif
+      #if __ARM_FEATURE_SVE_BITS != 256 && __ARM_FEATURE_SVE_BITS != 512
+      #error Unsupported vector length
+      #endif
+      #include <arm_sve.h>
+      typedef svfloat64_t vector_type
+        __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+      int main()
+      {
+      const int n_vectors = __ARM_FEATURE_SVE_BITS / 64;
+      if (svcntd() != n_vectors)
+        return 1;
+      double data[n_vectors];
+      data[0] = static_cast<volatile double>(1.0);
+      for (int i=1; i<n_vectors; ++i)
+        data[i] = 0.0;
+      const svbool_t pg = svptrue_b64();
+      vector_type a, b;
+      a = svld1_f64(pg, data);
+      b = svdup_n_f64(static_cast<volatile double>(2.25));
+      a = svadd_f64_x(pg, a, b);
+      a = svmul_f64_x(pg, b, a);
+      svst1_f64(pg, data, a);
+      int return_value = 0;
+      if (data[0] != 7.3125)
+        return_value = 1;
+      for (int i=1; i<n_vectors; ++i)
+        if (data[i] != 5.0625)
+          return_value = 1;
+      return return_value;
+      }
+      "
+      DEAL_II_HAVE_ARM_SVE)
+
+    if(DEAL_II_HAVE_ARM_SVE)
+      CHECK_CXX_SOURCE_COMPILES(
+        "
+        #if __ARM_FEATURE_SVE_BITS != 512
+        #error Vector length is not 512 bits
+        #endif
+        int main() { return 0; }
+        "
+        DEAL_II_HAVE_ARM_SVE_512)
+    endif()
+
   #
   # OpenMP 4.0 can be used for vectorization. Only the vectorization
   # instructions are allowed, the threading must be done through TBB.
@@ -327,6 +384,14 @@ if(DEAL_II_HAVE_ARM_NEON)
   set(DEAL_II_VECTORIZATION_WIDTH_IN_BITS 128)
 endif()
 
+if(DEAL_II_HAVE_ARM_SVE)
+  if(DEAL_II_HAVE_ARM_SVE_512)
+    set(DEAL_II_VECTORIZATION_WIDTH_IN_BITS 512)
+  else()
+    set(DEAL_II_VECTORIZATION_WIDTH_IN_BITS 256)
+  endif()
+endif()
+
 #
 # If we have OpenMP SIMD support (i.e. DEAL_II_HAVE_OPENMP_SIMD is true)
 # populate DEAL_II_OPENMP_SIMD_PRAGMA.
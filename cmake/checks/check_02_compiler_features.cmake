@@ -29,6 +29,8 @@
 #   DEAL_II_COMPILER_HAS_ATTRIBUTE_PRETTY_FUNCTION
 #   DEAL_II_COMPILER_HAS_ATTRIBUTE_ALWAYS_INLINE
 #   DEAL_II_ALWAYS_INLINE
+#   DEAL_II_COMPILER_HAS_ATTRIBUTE_TARGET_CLONES
+#   DEAL_II_TARGET_CLONES
 #   DEAL_II_RESTRICT
 #   DEAL_II_COMPILER_HAS_DIAGNOSTIC_PRAGMA
 #   DEAL_II_COMPILER_HAS_FUSE_LD_GOLD
@@ -289,6 +291,33 @@ else()
 endif()
 
 
+#
+# Check whether the compiler supports function multiversioning with the
+# target_clones attribute for the x86-64 instruction set extensions. The
+# attribute is used for the element-wise vector operations, which are
+# compiled for AVX2 and AVX-512 in addition to the instruction set selected
+# by the compiler flags and dispatched at load time according to the
+# capabilities of the CPU. This is only useful if the library is not
+# already compiled for AVX-512.
+#
+CHECK_CXX_SOURCE_COMPILES(
+  "
+          __attribute__((target_clones(\"default\", \"avx2\", \"arch=skylake-avx512\")))
+          int fn (int a) { return a; }
+          int main () { return fn(0); }
+  "
+  DEAL_II_COMPILER_HAS_ATTRIBUTE_TARGET_CLONES
+  )
+
+if(DEAL_II_COMPILER_HAS_ATTRIBUTE_TARGET_CLONES AND
+   DEAL_II_VECTORIZATION_WIDTH_IN_BITS LESS 512)
+  set(DEAL_II_TARGET_CLONES
+    "__attribute__((target_clones(\"default\", \"avx2\", \"arch=skylake-avx512\")))")
+else()
+  set(DEAL_II_TARGET_CLONES " ")
+endif()
+
+
 #
 # Check whether the compiler understands the __restrict keyword.
 #
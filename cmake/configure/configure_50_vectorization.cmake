@@ -26,7 +26,13 @@ if(${DEAL_II_VECTORIZATION_WIDTH_IN_BITS} GREATER 0)
    set(DEAL_II_EXPAND_FLOAT_VECTORIZED  "${DEAL_II_EXPAND_FLOAT_VECTORIZED}" "VectorizedArray<float,4>")
 endif()
 
-if((${DEAL_II_VECTORIZATION_WIDTH_IN_BITS} GREATER 128))
+#
+# With SVE, only the full vector length is available in addition to the
+# 128 bit NEON types, so skip the intermediate 256 bit types for a vector
+# length of 512 bits.
+#
+if((${DEAL_II_VECTORIZATION_WIDTH_IN_BITS} GREATER 128) AND
+   NOT (DEAL_II_HAVE_ARM_SVE AND ${DEAL_II_VECTORIZATION_WIDTH_IN_BITS} GREATER 256))
    set(DEAL_II_EXPAND_REAL_SCALARS_VECTORIZED
       "${DEAL_II_EXPAND_REAL_SCALARS_VECTORIZED}" "VectorizedArray<double,4>" "VectorizedArray<float,8>")
    set(DEAL_II_EXPAND_FLOAT_VECTORIZED  "${DEAL_II_EXPAND_FLOAT_VECTORIZED}" "VectorizedArray<float,8>")
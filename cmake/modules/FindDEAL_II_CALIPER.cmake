@@ -0,0 +1,45 @@
+## ------------------------------------------------------------------------
+##
+## SPDX-License-Identifier: LGPL-2.1-or-later
+## Copyright (C) 2026 by the deal.II authors
+##
+## This file is part of the deal.II library.
+##
+## Part of the source code is dual licensed under Apache-2.0 WITH
+## LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+## governing the source code and code contributions can be found in
+## LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+##
+## ------------------------------------------------------------------------
+
+#
+# Try to find the Caliper performance analysis library
+#
+# This module exports
+#
+#   CALIPER_FOUND
+#   CALIPER_LIBRARIES
+#   CALIPER_INCLUDE_DIRS
+#
+
+set(CALIPER_DIR "" CACHE PATH "An optional hint to a Caliper installation")
+set_if_empty(CALIPER_DIR "$ENV{CALIPER_DIR}")
+
+deal_ii_find_library(CALIPER_LIBRARY
+  NAMES caliper
+  HINTS ${CALIPER_DIR}
+  PATH_SUFFIXES lib${LIB_SUFFIX} lib64 lib
+  )
+
+deal_ii_find_path(CALIPER_INCLUDE_DIR caliper/cali.h
+  HINTS ${CALIPER_DIR}
+  PATH_SUFFIXES include
+  )
+
+process_feature(CALIPER
+  LIBRARIES
+    REQUIRED CALIPER_LIBRARY
+  INCLUDE_DIRS
+    REQUIRED CALIPER_INCLUDE_DIR
+  CLEAR CALIPER_LIBRARY CALIPER_INCLUDE_DIR
+  )
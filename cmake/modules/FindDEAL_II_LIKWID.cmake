@@ -0,0 +1,46 @@
+## ------------------------------------------------------------------------
+##
+## SPDX-License-Identifier: LGPL-2.1-or-later
+## Copyright (C) 2026 by the deal.II authors
+##
+## This file is part of the deal.II library.
+##
+## Part of the source code is dual licensed under Apache-2.0 WITH
+## LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+## governing the source code and code contributions can be found in
+## LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+##
+## ------------------------------------------------------------------------
+
+#
+# Try to find the LIKWID library, whose marker API is used to attach
+# hardware performance counters to instrumented regions
+#
+# This module exports
+#
+#   LIKWID_FOUND
+#   LIKWID_LIBRARIES
+#   LIKWID_INCLUDE_DIRS
+#
+
+set(LIKWID_DIR "" CACHE PATH "An optional hint to a LIKWID installation")
+set_if_empty(LIKWID_DIR "$ENV{LIKWID_DIR}")
+
+deal_ii_find_library(LIKWID_LIBRARY
+  NAMES likwid
+  HINTS ${LIKWID_DIR}
+  PATH_SUFFIXES lib${LIB_SUFFIX} lib64 lib
+  )
+
+deal_ii_find_path(LIKWID_INCLUDE_DIR likwid-marker.h
+  HINTS ${LIKWID_DIR}
+  PATH_SUFFIXES include
+  )
+
+process_feature(LIKWID
+  LIBRARIES
+    REQUIRED LIKWID_LIBRARY
+  INCLUDE_DIRS
+    REQUIRED LIKWID_INCLUDE_DIR
+  CLEAR LIKWID_LIBRARY LIKWID_INCLUDE_DIR
+  )
@@ -47,6 +47,8 @@
 #     DEAL_II_DEFINITIONS_DEBUG
 #     DEAL_II_DEFINITIONS_RELEASE
 #     DEAL_II_USE_VECTORIZATION_GATHER
+#     DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX
+#     DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS
 #
 # Components and miscellaneous options:
 #
@@ -197,6 +199,38 @@ option(DEAL_II_USE_VECTORIZATION_GATHER
   )
 mark_as_advanced(DEAL_II_USE_VECTORIZATION_GATHER)
 
+set(DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX "6" CACHE STRING
+  "The largest polynomial degree for which the kernels of FEEvaluation and FEFaceEvaluation with fe_degree = -1 are precompiled in the library. For each degree, the kernels are compiled for degree, degree+1, degree+2, and (3*degree)/2+1 quadrature points in 1d. Larger values increase the compilation time and the size of the library."
+  )
+mark_as_advanced(DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX)
+
+set(DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS "" CACHE STRING
+  "A semicolon separated list of additional pairs 'degree:n_q_points_1d' for which the kernels of FEEvaluation and FEFaceEvaluation with fe_degree = -1 are precompiled in the library, e.g., \"8:13;10:16\" for over-integration with the 3/2 rule at degrees beyond DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX."
+  )
+mark_as_advanced(DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS)
+
+if(NOT DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX MATCHES "^[1-9][0-9]*$")
+  message(FATAL_ERROR
+    "DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX must be a positive integer, but is set to '${DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX}'."
+    )
+endif()
+
+#
+# Translate the list of additional pairs into the initializer list of an
+# array in config.h, preceded by a comma so that an empty list is valid:
+#
+set(DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS_LIST "")
+foreach(_pair ${DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS})
+  if(NOT _pair MATCHES "^([1-9][0-9]*):([1-9][0-9]*)$")
+    message(FATAL_ERROR
+      "The entries of DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS must be of the form 'degree:n_q_points_1d', but '${_pair}' was found."
+      )
+  endif()
+  string(APPEND DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS_LIST
+    ", {${CMAKE_MATCH_1}, ${CMAKE_MATCH_2}}"
+    )
+endforeach()
+
 
 ########################################################################
 #                                                                      #
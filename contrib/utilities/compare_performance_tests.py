@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+
+## ------------------------------------------------------------------------
+##
+## SPDX-License-Identifier: LGPL-2.1-or-later
+## Copyright (C) 2024 by the deal.II authors
+##
+## This file is part of the deal.II library.
+##
+## Part of the source code is dual licensed under Apache-2.0 WITH
+## LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+## governing the source code and code contributions can be found in
+## LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+##
+## ------------------------------------------------------------------------
+
+#
+# Compare the results of two runs of the performance tests in
+# tests/performance, e.g., for two different versions of the library.
+# Every performance test writes a tab-separated summary with the
+# minimum, maximum, mean, and standard deviation of each recorded
+# quantity to its output file. This script collects these output files
+# from two build directories of the test suite, compares the minimum over
+# all measurements (as the least noisy value) of every quantity, and
+# reports quantities that changed by more than a given relative
+# threshold. The exit code is nonzero if any quantity got slower.
+#
+# Usage:
+#   compare_performance_tests.py [--threshold 0.1] <baseline> <current>
+#
+
+import argparse
+import os
+import sys
+
+
+def read_results(directory):
+    """Return a dictionary mapping (test, quantity) to the minimum value,
+    collected from all performance test output files below directory."""
+    results = {}
+    for root, _, files in os.walk(directory):
+        if "output" not in files:
+            continue
+        path = os.path.join(root, "output")
+        with open(path) as f:
+            lines = f.read().splitlines()
+        if not any(line.startswith("# metric:") for line in lines):
+            continue
+        test = os.path.relpath(root, directory)
+        for line in lines:
+            if line.startswith("#") or not line.strip():
+                continue
+            entries = line.split("\t")
+            if len(entries) != 5:
+                continue
+            results[(test, entries[0])] = float(entries[1])
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare two runs of the deal.II performance tests.")
+    parser.add_argument("baseline", help="build directory of the reference run")
+    parser.add_argument("current", help="build directory of the new run")
+    parser.add_argument("--threshold", type=float, default=0.1,
+                        help="relative change to report (default: 0.1)")
+    args = parser.parse_args()
+
+    baseline = read_results(args.baseline)
+    current = read_results(args.current)
+
+    n_regressions = 0
+    print("%-60s %12s %12s %8s" % ("test/quantity", "baseline", "current",
+                                   "change"))
+    for key in sorted(set(baseline) & set(current)):
+        old, new = baseline[key], current[key]
+        change = (new - old) / old if old > 0 else 0.
+        marker = ""
+        if change > args.threshold:
+            marker = "  <-- slower"
+            n_regressions += 1
+        elif change < -args.threshold:
+            marker = "  <-- faster"
+        print("%-60s %12.4e %12.4e %+7.1f%%%s" %
+              (key[0] + "/" + key[1], old, new, 100. * change, marker))
+
+    for key in sorted(set(baseline) ^ set(current)):
+        print("%-60s only present in %s" %
+              (key[0] + "/" + key[1],
+               "baseline" if key in baseline else "current"))
+
+    return 1 if n_regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
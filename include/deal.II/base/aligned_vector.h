@@ -36,6 +36,7 @@
 
 #include <cstring>
 #include <memory>
+#include <optional>
 #include <type_traits>
 
 
@@ -387,6 +388,25 @@ public:
   replicate_across_communicator(const MPI_Comm     communicator,
                                 const unsigned int root_process);
 
+  /**
+   * Set the policy for backing the memory of this vector by huge pages and
+   * for its placement on the NUMA domains of a node, see
+   * Utilities::System::MemoryAllocationPolicy. The policy is used for all
+   * subsequent allocations, i.e., the next time the vector grows beyond its
+   * current capacity; to apply it to the current elements, call this
+   * function before resize() or reserve(). Unless this function is called,
+   * the vector uses the policy returned by
+   * Utilities::System::get_default_memory_allocation_policy() at the time of
+   * the allocation.
+   *
+   * The policy is a property of the vector object rather than of its
+   * elements, so it is not transferred by copy or move operations or by
+   * swap().
+   */
+  void
+  set_allocation_policy(
+    const Utilities::System::MemoryAllocationPolicy &policy);
+
   /**
    * Swaps the given vector with the calling vector.
    */
@@ -746,6 +766,11 @@ private:
    * Flag indicating if replicate_across_communicator() has been called.
    */
   bool replicated_across_communicator;
+
+  /**
+   * The allocation policy set by set_allocation_policy(), if any.
+   */
+  std::optional<Utilities::System::MemoryAllocationPolicy> allocation_policy;
 };
 
 
@@ -1443,11 +1468,33 @@ AlignedVector<T>::allocate_and_move(const size_t old_size,
                                     const size_t new_allocated_size)
 {
   // allocate and align along 64-byte boundaries (this is enough for all
-  // levels of vectorization currently supported by deal.II)
+  // levels of vectorization currently supported by deal.II), unless the
+  // allocation policy asks for page boundaries; the policy needs to be
+  // applied before the elements are constructed, i.e., before the memory is
+  // first touched
+  const Utilities::System::MemoryAllocationPolicy &policy =
+    allocation_policy ?
+      *allocation_policy :
+      Utilities::System::get_default_memory_allocation_policy();
+  const std::size_t n_bytes = new_size * sizeof(T);
+
   T *new_data_ptr;
-  Utilities::System::posix_memalign(reinterpret_cast<void **>(&new_data_ptr),
-                                    64,
-                                    new_size * sizeof(T));
+  if (policy.is_default())
+    Utilities::System::posix_memalign(reinterpret_cast<void **>(&new_data_ptr),
+                                      64,
+                                      n_bytes);
+  else
+    {
+      Utilities::System::posix_memalign(
+        reinterpret_cast<void **>(&new_data_ptr),
+        Utilities::System::get_memory_allocation_alignment(policy,
+                                                           64,
+                                                           n_bytes),
+        n_bytes);
+      Utilities::System::apply_memory_allocation_policy(new_data_ptr,
+                                                        n_bytes,
+                                                        policy);
+    }
 
   // Now create a deleter that encodes what should happen when the object is
   // released: We need to destroy the objects that are currently alive (in
@@ -2046,6 +2093,16 @@ AlignedVector<T>::replicate_across_communicator(const MPI_Comm     communicator,
 
 
 
+template <class T>
+inline void
+AlignedVector<T>::set_allocation_policy(
+  const Utilities::System::MemoryAllocationPolicy &policy)
+{
+  allocation_policy = policy;
+}
+
+
+
 template <class T>
 inline void
 AlignedVector<T>::swap(AlignedVector<T> &vec) noexcept
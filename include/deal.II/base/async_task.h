@@ -0,0 +1,719 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_async_task_h
+#define dealii_async_task_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/thread_management.h>
+
+#if defined(DEAL_II_HAVE_CXX20) && defined(__cpp_impl_coroutine)
+#  include <coroutine>
+#  include <exception>
+#  include <functional>
+#  include <optional>
+#  include <thread>
+#  include <utility>
+#  include <vector>
+#endif
+
+DEAL_II_NAMESPACE_OPEN
+
+// The classes in this file need compiler support for C++20 coroutines.
+#if (defined(DEAL_II_HAVE_CXX20) && defined(__cpp_impl_coroutine)) || \
+  defined(DOXYGEN)
+
+namespace Threads
+{
+  template <typename RT>
+  class AsyncTask;
+
+  namespace internal
+  {
+    namespace AsyncTaskImplementation
+    {
+      /**
+       * An operation a suspended coroutine waits for, together with the
+       * handle of the coroutine to be resumed once the operation has
+       * completed.
+       */
+      struct PendingOperation
+      {
+        /**
+         * A function testing for completion of the operation without
+         * blocking. For MPI requests, the test also makes progress on the
+         * communication.
+         */
+        std::function<bool()> is_ready;
+
+        /**
+         * A function waiting for completion of the operation, or an empty
+         * function object if the operation can only be polled.
+         */
+        std::function<void()> wait;
+
+        /**
+         * The coroutine to be resumed.
+         */
+        std::coroutine_handle<> handle;
+      };
+
+
+
+      /**
+       * The progress engine that resumes suspended coroutines whose
+       * operations have completed. There is one engine per thread, which
+       * manages all coroutines suspended on that thread. All coroutines
+       * waiting on a thread make progress whenever any AsyncTask is joined
+       * on that thread, which lets communication and computation of
+       * different coroutines overlap.
+       */
+      class ProgressEngine
+      {
+      public:
+        /**
+         * Return the engine of the current thread.
+         */
+        static ProgressEngine &
+        get()
+        {
+          thread_local ProgressEngine engine;
+          return engine;
+        }
+
+        /**
+         * Register a suspended coroutine.
+         */
+        void
+        add(PendingOperation &&operation)
+        {
+          pending.push_back(std::move(operation));
+        }
+
+        /**
+         * Test all pending operations once and resume the coroutines whose
+         * operations have completed. If none has completed and none of the
+         * pending operations needs to be polled for progress, block on the
+         * first one instead of spinning, since a task scheduled by the TBB
+         * might otherwise never be run. Otherwise, yield the thread.
+         */
+        void
+        make_progress()
+        {
+          // Take out the ready operations before resuming any coroutine,
+          // because the resumed coroutines may register new operations.
+          std::vector<std::coroutine_handle<>> ready;
+          for (unsigned int i = 0; i < pending.size();)
+            if (pending[i].is_ready())
+              {
+                ready.push_back(pending[i].handle);
+                pending.erase(pending.begin() + i);
+              }
+            else
+              ++i;
+
+          if (ready.empty() && !pending.empty())
+            {
+              bool all_can_wait = true;
+              for (const PendingOperation &operation : pending)
+                if (!operation.wait)
+                  all_can_wait = false;
+              if (all_can_wait)
+                {
+                  pending.front().wait();
+                  ready.push_back(pending.front().handle);
+                  pending.erase(pending.begin());
+                }
+              else
+                std::this_thread::yield();
+            }
+
+          for (const std::coroutine_handle<> &handle : ready)
+            handle.resume();
+        }
+
+      private:
+        /**
+         * The list of suspended coroutines.
+         */
+        std::vector<PendingOperation> pending;
+      };
+
+
+
+      /**
+       * An awaitable object for a generic operation described by the
+       * functions of a PendingOperation.
+       */
+      struct OperationAwaiter
+      {
+        bool
+        await_ready() const
+        {
+          return is_ready();
+        }
+
+        void
+        await_suspend(const std::coroutine_handle<> handle) const
+        {
+          ProgressEngine::get().add(PendingOperation{is_ready, wait, handle});
+        }
+
+        void
+        await_resume() const noexcept
+        {}
+
+        std::function<bool()> is_ready;
+        std::function<void()> wait;
+      };
+
+
+
+      /**
+       * The awaitable object used at the end of a coroutine of type
+       * AsyncTask, which transfers control to the coroutine awaiting the
+       * finished one, if any.
+       */
+      struct FinalAwaiter
+      {
+        bool
+        await_ready() const noexcept
+        {
+          return false;
+        }
+
+        template <typename Promise>
+        std::coroutine_handle<>
+        await_suspend(
+          const std::coroutine_handle<Promise> handle) const noexcept
+        {
+          if (handle.promise().continuation)
+            return handle.promise().continuation;
+          else
+            return std::noop_coroutine();
+        }
+
+        void
+        await_resume() const noexcept
+        {}
+      };
+
+
+
+      /**
+       * The part of the promise type of AsyncTask that does not depend on
+       * the return type.
+       */
+      class PromiseBase
+      {
+      public:
+        /**
+         * The coroutine starts running right away on the calling thread,
+         * until it first needs to wait.
+         */
+        std::suspend_never
+        initial_suspend() const noexcept
+        {
+          return {};
+        }
+
+        /**
+         * Upon completion, keep the coroutine alive such that its result can
+         * be queried, and resume the coroutine that awaits it, if any.
+         */
+        FinalAwaiter
+        final_suspend() const noexcept
+        {
+          return {};
+        }
+
+        void
+        unhandled_exception()
+        {
+          exception = std::current_exception();
+        }
+
+        /**
+         * Rethrow an exception that escaped from the coroutine, if any.
+         */
+        void
+        rethrow_if_exception() const
+        {
+          if (exception)
+            std::rethrow_exception(exception);
+        }
+
+        /**
+         * The coroutine that awaits the current one.
+         */
+        std::coroutine_handle<> continuation;
+
+      private:
+        /**
+         * An exception thrown by the coroutine.
+         */
+        std::exception_ptr exception;
+      };
+
+
+
+      /**
+       * The promise type of AsyncTask.
+       */
+      template <typename RT>
+      class Promise : public PromiseBase
+      {
+      public:
+        AsyncTask<RT>
+        get_return_object();
+
+        template <typename T>
+        void
+        return_value(T &&value)
+        {
+          returned_object.emplace(std::forward<T>(value));
+        }
+
+        RT &
+        get()
+        {
+          rethrow_if_exception();
+          return *returned_object;
+        }
+
+      private:
+        std::optional<RT> returned_object;
+      };
+
+
+
+      /**
+       * Specialization of the promise type for coroutines that do not
+       * return a value.
+       */
+      template <>
+      class Promise<void> : public PromiseBase
+      {
+      public:
+        AsyncTask<void>
+        get_return_object();
+
+        void
+        return_void() const noexcept
+        {}
+
+        void
+        get() const
+        {
+          rethrow_if_exception();
+        }
+      };
+    } // namespace AsyncTaskImplementation
+  }   // namespace internal
+
+
+
+  /**
+   * A task implemented as a C++20 coroutine, which can wait for MPI
+   * communication, for tasks of type Threads::Task, and for other
+   * coroutines of this type without blocking the thread it runs on. This
+   * allows to write code that overlaps communication and computation as a
+   * sequence of statements, rather than polling for the completion of MPI
+   * requests by hand:
+   * @code
+   *   Threads::AsyncTask<double> update_and_compute(
+   *     const Utilities::MPI::Partitioner &partitioner, ...)
+   *   {
+   *     std::vector<MPI_Request> requests;
+   *     partitioner.export_to_ghosted_array_start(0, owned, temp, ghosts,
+   *                                               requests);
+   *
+   *     // start work that does not need the ghost values on a task
+   *     Threads::Task<double> interior = Threads::new_task(...);
+   *
+   *     co_await Utilities::MPI::async_wait(requests);
+   *     partitioner.export_to_ghosted_array_finish(ghosts, requests);
+   *
+   *     const double boundary = ...; // work on the ghost values
+   *     co_return boundary + co_await Threads::async_join(interior);
+   *   }
+   *
+   *   // start two pipelines that proceed independently
+   *   Threads::AsyncTask<double> a = update_and_compute(partitioner_1, ...);
+   *   Threads::AsyncTask<double> b = update_and_compute(partitioner_2, ...);
+   *   const double result = a.return_value() + b.return_value();
+   * @endcode
+   *
+   * A coroutine returning an object of this type starts to run immediately
+   * on the calling thread until it reaches the first `co_await` expression
+   * whose operation has not completed yet. It is then suspended and
+   * registered with a progress engine of the calling thread. The engine is
+   * driven by the join() and return_value() functions of this class: These
+   * functions repeatedly test the operations of all coroutines suspended on
+   * the current thread (which, for MPI requests, also makes progress on the
+   * communication) and resume those whose operations have completed, until
+   * the coroutine at hand has finished. Consequently, joining one AsyncTask
+   * also lets all other coroutines suspended on the same thread proceed.
+   * Work that should run concurrently to the communication is put on
+   * regular tasks of type Threads::Task, which the scheduler runs on the
+   * other threads.
+   *
+   * A coroutine can `co_await` the following objects:
+   * - The object returned by Utilities::MPI::async_wait() for one or several
+   *   MPI requests, e.g., the ones passed to the `_start()` functions of
+   *   Utilities::MPI::Partitioner.
+   * - The object returned by Threads::async_join() for a Threads::Task. The
+   *   result of the `co_await` expression is the return value of the task.
+   * - The object returned by Threads::async_wait_until() for an arbitrary
+   *   non-blocking predicate.
+   * - Another AsyncTask. The awaiting coroutine is resumed when the awaited
+   *   one has finished, and the result of the `co_await` expression is its
+   *   return value.
+   *
+   * Since the progress engine is per thread, an AsyncTask must be joined on
+   * the thread it has been created on. An exception that escapes from the
+   * coroutine is stored and rethrown by join() and return_value(), as for
+   * Threads::Task. The destructor waits for a coroutine that has not
+   * finished yet, since the operations it waits for may still write into
+   * its local variables.
+   *
+   * @note This class is only available if deal.II is compiled with a C++20
+   * compiler that supports coroutines.
+   *
+   * @ingroup threads
+   */
+  template <typename RT = void>
+  class AsyncTask
+  {
+  public:
+    /**
+     * The promise type through which the compiler connects a coroutine
+     * with its return object.
+     */
+    using promise_type = internal::AsyncTaskImplementation::Promise<RT>;
+
+    /**
+     * Default constructor, creating an object that does not refer to a
+     * coroutine.
+     */
+    AsyncTask() = default;
+
+    /**
+     * Constructor from the handle of a coroutine. The object takes over the
+     * ownership of the coroutine.
+     */
+    explicit AsyncTask(const std::coroutine_handle<promise_type> handle)
+      : handle(handle)
+    {}
+
+    /**
+     * Move constructor.
+     */
+    AsyncTask(AsyncTask &&other) noexcept
+      : handle(std::exchange(other.handle, nullptr))
+    {}
+
+    /**
+     * Move assignment.
+     */
+    AsyncTask &
+    operator=(AsyncTask &&other) noexcept
+    {
+      if (this != &other)
+        {
+          release();
+          handle = std::exchange(other.handle, nullptr);
+        }
+      return *this;
+    }
+
+    /**
+     * Destructor. Waits for the coroutine to finish, if necessary.
+     */
+    ~AsyncTask()
+    {
+      release();
+    }
+
+    /**
+     * Return whether the object refers to a coroutine.
+     */
+    bool
+    joinable() const
+    {
+      return static_cast<bool>(handle);
+    }
+
+    /**
+     * Return whether the coroutine has finished.
+     */
+    bool
+    is_ready() const
+    {
+      AssertThrow(joinable(), typename Threads::Task<RT>::ExcNoTask());
+      return handle.done();
+    }
+
+    /**
+     * Wait for the coroutine to finish, driving the progress engine of the
+     * current thread in the meantime, and rethrow an exception the
+     * coroutine might have thrown.
+     */
+    void
+    join() const
+    {
+      AssertThrow(joinable(), typename Threads::Task<RT>::ExcNoTask());
+      wait();
+      handle.promise().rethrow_if_exception();
+    }
+
+    /**
+     * Wait for the coroutine to finish, and return its return value.
+     */
+    decltype(auto)
+    return_value()
+    {
+      AssertThrow(joinable(), typename Threads::Task<RT>::ExcNoTask());
+      wait();
+      return handle.promise().get();
+    }
+
+    /**
+     * Make the object awaitable from within another coroutine.
+     */
+    auto
+    operator co_await() &
+    {
+      struct Awaiter
+      {
+        bool
+        await_ready() const noexcept
+        {
+          return handle.done();
+        }
+
+        void
+        await_suspend(const std::coroutine_handle<> awaiting) const noexcept
+        {
+          handle.promise().continuation = awaiting;
+        }
+
+        decltype(auto)
+        await_resume() const
+        {
+          return handle.promise().get();
+        }
+
+        std::coroutine_handle<promise_type> handle;
+      };
+
+      AssertThrow(joinable(), typename Threads::Task<RT>::ExcNoTask());
+      return Awaiter{handle};
+    }
+
+  private:
+    /**
+     * Drive the progress engine until the coroutine has finished.
+     */
+    void
+    wait() const
+    {
+      while (!handle.done())
+        internal::AsyncTaskImplementation::ProgressEngine::get()
+          .make_progress();
+    }
+
+    /**
+     * Wait for the coroutine to finish and destroy it.
+     */
+    void
+    release()
+    {
+      if (handle)
+        {
+          wait();
+          handle.destroy();
+          handle = nullptr;
+        }
+    }
+
+    /**
+     * The handle of the coroutine.
+     */
+    std::coroutine_handle<promise_type> handle;
+  };
+
+
+
+  /**
+   * Return an object that a coroutine of type AsyncTask can `co_await` in
+   * order to wait for the given task without blocking the thread. The
+   * result of the `co_await` expression is the return value of the task,
+   * and an exception thrown by the task is rethrown.
+   *
+   * @ingroup threads
+   */
+  template <typename RT>
+  auto
+  async_join(Task<RT> &task)
+  {
+    struct Awaiter
+    {
+      bool
+      await_ready() const
+      {
+        return task.is_ready();
+      }
+
+      void
+      await_suspend(const std::coroutine_handle<> handle) const
+      {
+        Task<RT> *t = &task;
+        internal::AsyncTaskImplementation::ProgressEngine::get().add(
+          {[t]() { return t->is_ready(); }, [t]() { t->join(); }, handle});
+      }
+
+      decltype(auto)
+      await_resume() const
+      {
+        return task.return_value();
+      }
+
+      Task<RT> &task;
+    };
+
+    AssertThrow(task.joinable(), typename Task<RT>::ExcNoTask());
+    return Awaiter{task};
+  }
+
+
+
+  /**
+   * Return an object that a coroutine of type AsyncTask can `co_await` in
+   * order to wait until the given function returns true. The function must
+   * not block; it is called repeatedly by the progress engine of the
+   * current thread.
+   *
+   * @ingroup threads
+   */
+  inline internal::AsyncTaskImplementation::OperationAwaiter
+  async_wait_until(const std::function<bool()> &predicate)
+  {
+    return {predicate, {}};
+  }
+
+
+
+#  ifndef DOXYGEN
+  namespace internal
+  {
+    namespace AsyncTaskImplementation
+    {
+      template <typename RT>
+      inline AsyncTask<RT>
+      Promise<RT>::get_return_object()
+      {
+        return AsyncTask<RT>(
+          std::coroutine_handle<Promise<RT>>::from_promise(*this));
+      }
+
+
+
+      inline AsyncTask<void>
+      Promise<void>::get_return_object()
+      {
+        return AsyncTask<void>(
+          std::coroutine_handle<Promise<void>>::from_promise(*this));
+      }
+    } // namespace AsyncTaskImplementation
+  }   // namespace internal
+#  endif
+} // namespace Threads
+
+
+
+namespace Utilities
+{
+  namespace MPI
+  {
+    /**
+     * Return an object that a coroutine of type Threads::AsyncTask can
+     * `co_await` in order to wait for the completion of the given MPI
+     * requests without blocking the thread. While the coroutine is
+     * suspended, the requests are tested with `MPI_Testall()` by the
+     * progress engine, which also makes progress on the communication. The
+     * completed requests are set to `MPI_REQUEST_NULL` (or to the inactive
+     * state for persistent requests), so that a subsequent `MPI_Waitall()`,
+     * e.g. in Utilities::MPI::Partitioner::export_to_ghosted_array_finish(),
+     * returns immediately.
+     *
+     * The vector of requests must stay alive and must not be resized until
+     * the `co_await` expression has completed. Without MPI, the operation
+     * completes immediately.
+     */
+    inline Threads::internal::AsyncTaskImplementation::OperationAwaiter
+    async_wait(std::vector<MPI_Request> &requests)
+    {
+#  ifdef DEAL_II_WITH_MPI
+      std::vector<MPI_Request> *r = &requests;
+      return {[r]() {
+                if (r->empty())
+                  return true;
+                int       flag = 0;
+                const int ierr =
+                  MPI_Testall(r->size(), r->data(), &flag, MPI_STATUSES_IGNORE);
+                AssertThrowMPI(ierr);
+                return flag != 0;
+              },
+              {}};
+#  else
+      (void)requests;
+      return {[]() { return true; }, {}};
+#  endif
+    }
+
+
+
+    /**
+     * Same as above, for a single MPI request.
+     */
+    inline Threads::internal::AsyncTaskImplementation::OperationAwaiter
+    async_wait(MPI_Request &request)
+    {
+#  ifdef DEAL_II_WITH_MPI
+      MPI_Request *r = &request;
+      return {[r]() {
+                int       flag = 0;
+                const int ierr = MPI_Test(r, &flag, MPI_STATUS_IGNORE);
+                AssertThrowMPI(ierr);
+                return flag != 0;
+              },
+              {}};
+#  else
+      (void)request;
+      return {[]() { return true; }, {}};
+#  endif
+    }
+  } // namespace MPI
+} // namespace Utilities
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
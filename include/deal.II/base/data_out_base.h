@@ -18,10 +18,12 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/bounding_box.h>
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/mpi_stub.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/table.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/grid/reference_cell.h>
 
@@ -30,6 +32,7 @@
 // To be able to serialize XDMFEntry
 #include <boost/serialization/map.hpp>
 
+#include <functional>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -229,6 +232,60 @@ namespace DataOutBase
   };
 
 
+  /**
+   * A tolerance for the error-bounded lossy compression of field data in
+   * output files, see VtkFlags::lossy_compression_tolerances. Before the
+   * data is written, every value is rounded to a value with fewer
+   * significant bits whose error with respect to the original value is
+   * bounded by the given tolerance. The resulting files are read by all
+   * programs as usual, but the reduced information content of the values
+   * allows the zlib compression of binary output to achieve much higher
+   * compression ratios.
+   *
+   * @ingroup output
+   */
+  struct LossyCompressionTolerance
+  {
+    /**
+     * The possible meanings of the tolerance.
+     */
+    enum class Type
+    {
+      /**
+       * The error of every value is bounded by the tolerance. Values are
+       * rounded to integer multiples of the largest power of two that is not
+       * larger than twice the tolerance, which is appropriate for fields whose
+       * values have a known scale.
+       */
+      absolute,
+
+      /**
+       * The error of every value is bounded by the tolerance times the
+       * magnitude of the value. This is done by rounding the mantissa of the
+       * floating-point numbers to the number of bits needed for the tolerance,
+       * which keeps the relative accuracy of small and large values alike.
+       */
+      relative
+    };
+
+    /**
+     * Constructor. A tolerance of zero disables the lossy compression.
+     */
+    LossyCompressionTolerance(const double tolerance = 0.,
+                              const Type   type      = Type::relative);
+
+    /**
+     * The tolerance.
+     */
+    double tolerance;
+
+    /**
+     * The meaning of the tolerance.
+     */
+    Type type;
+  };
+
+
   /**
    * Data structure describing a patch of data in <tt>dim</tt> space
    * dimensions.
@@ -1080,8 +1137,33 @@ namespace DataOutBase
      */
     DataOutBase::CompressionLevel compression_level;
 
+    /**
+     * The number of ranks per shared-memory node that perform the actual
+     * file system accesses in parallel output. With the default value of
+     * zero, the choice is left to the MPI-IO implementation. For a positive
+     * value, the MPI-IO layer is asked (via the ROMIO hints `cb_config_list`
+     * and `romio_cb_write`) to use collective buffering with this many
+     * aggregators on each node, so that the data of all other ranks is
+     * shipped to the aggregators before being written in large blocks.
+     *
+     * This flag is only used with a parallel HDF5 library and in
+     * DataOutInterface::write_hdf5_parallel() and related functions.
+     */
+    unsigned int n_aggregators_per_node;
+
+    /**
+     * Stripe size of the underlying parallel file system, in bytes. If
+     * nonzero, the value is passed to MPI-IO as the `striping_unit` hint and
+     * all HDF5 objects of at least this size are aligned to multiples of it,
+     * so that the writes of different aggregators do not share a stripe. The
+     * default is zero, i.e., no alignment.
+     */
+    std::size_t stripe_size;
+
     explicit Hdf5Flags(
-      const CompressionLevel compression_level = CompressionLevel::best_speed);
+      const CompressionLevel compression_level = CompressionLevel::best_speed,
+      const unsigned int     n_aggregators_per_node = 0,
+      const std::size_t      stripe_size            = 0);
   };
 
   /**
@@ -1205,6 +1287,51 @@ namespace DataOutBase
      */
     std::map<std::string, std::string> physical_units;
 
+    /**
+     * The number of aggregator ranks per shared-memory node used by
+     * DataOutInterface::write_vtu_in_parallel() and the functions calling it.
+     * The default value of zero lets every rank write its own piece of the
+     * file with MPI I/O. For a positive value, the ranks of each node are
+     * split into (at most) this many groups of consecutive ranks; the first
+     * rank of every group gathers the encoded pieces of the other members
+     * via MPI (which uses shared memory within a node) and only these
+     * aggregators open the file and write to it. This reduces the load on
+     * the metadata servers of parallel file systems and results in fewer,
+     * larger write operations.
+     *
+     * This flag is ignored for all other output functions.
+     */
+    unsigned int n_aggregators_per_node;
+
+    /**
+     * Stripe size of the underlying parallel file system, in bytes, used
+     * together with @p n_aggregators_per_node. If nonzero, every aggregator
+     * pads its block with whitespace (which is insignificant in the XML
+     * format) to a multiple of the stripe size, so that all writes start at
+     * a stripe boundary and no stripe is shared between two aggregators, and
+     * the value is passed to MPI-IO as the `striping_unit` hint. The default
+     * is zero, i.e., no padding.
+     */
+    std::size_t stripe_size;
+
+    /**
+     * A map that describes for (some or all) of the output quantities the
+     * tolerance of an error-bounded lossy compression, see
+     * LossyCompressionTolerance. Like for @p physical_units, the entries of
+     * vector and tensor fields are looked up via the name of the whole field
+     * or, if that is not listed, via the name of its first component. Fields
+     * not listed in the map are written without loss. This field is used for
+     * the VTU format and ignored for the VTK format. The default is an empty
+     * map.
+     *
+     * Visualization typically does not need more than three or four
+     * significant digits, so a relative tolerance of $10^{-3}$ together with
+     * a compression level other than CompressionLevel::plain_text often
+     * reduces the size of the field data by a large factor.
+     */
+    std::map<std::string, LossyCompressionTolerance>
+      lossy_compression_tolerances;
+
     /**
      * Constructor. Initializes the member variables with names corresponding
      * to the argument names of this function.
@@ -1215,7 +1342,9 @@ namespace DataOutBase
       const bool             print_date_and_time = true,
       const CompressionLevel compression_level   = CompressionLevel::best_speed,
       const bool             write_higher_order_cells          = false,
-      const std::map<std::string, std::string> &physical_units = {});
+      const std::map<std::string, std::string> &physical_units = {},
+      const unsigned int                        n_aggregators_per_node = 0,
+      const std::size_t                         stripe_size            = 0);
   };
 
 
@@ -2367,6 +2496,54 @@ namespace DataOutBase
     const MPI_Comm                   comm,
     const CompressionLevel           compression);
 
+  /**
+   * Like write_deal_II_intermediate(), but write the patches in a binary
+   * format that can be read back considerably faster. The file starts with a
+   * header of fixed size that records the dimensions, the number of patches
+   * and the positions of the remaining sections, followed by the names of
+   * the data sets, a table with one record of fixed size per patch, and
+   * finally the data values of all patches as one contiguous array of
+   * floats. All sections start at offsets that are multiples of eight
+   * bytes, so that the file can be memory-mapped and the patch table and the
+   * data accessed in place. The format carries its own version number that
+   * is checked when reading, and the numbers are stored in the byte order of
+   * the machine that wrote the file.
+   *
+   * Files in this format can be read by DataOutReader::read() and
+   * DataOutReader::read_binary(), and several of them can be combined into
+   * one without decoding the patches with
+   * merge_deal_II_intermediate_binary(). They typically have the extension
+   * <tt>.d2b</tt>.
+   */
+  template <int dim, int spacedim>
+  void
+  write_deal_II_intermediate_binary(
+    const std::vector<Patch<dim, spacedim>> &patches,
+    const std::vector<std::string>          &data_names,
+    const std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>
+                                    &nonscalar_data_ranges,
+    const Deal_II_IntermediateFlags &flags,
+    std::ostream                    &out);
+
+  /**
+   * Combine the files @p input_filenames, all written by
+   * write_deal_II_intermediate_binary() for the same data sets and
+   * dimensions, into the single file @p output_filename in the same format.
+   * The output is equivalent to reading all inputs with DataOutReader,
+   * merging them via DataOutReader::merge(), and writing the result, but the
+   * inputs are only memory-mapped and their data values are copied as a
+   * block; only the patch indices, neighbor indices and data offsets of the
+   * patch table are adjusted.
+   */
+  void
+  merge_deal_II_intermediate_binary(
+    const std::vector<std::string> &input_filenames,
+    const std::string              &output_filename);
+
   /**
    * Write the data in @p data_filter to a single HDF5 file containing both the
    * mesh and solution values.
@@ -2396,6 +2573,36 @@ namespace DataOutBase
                       const std::string &solution_filename,
                       const MPI_Comm     comm);
 
+  /**
+   * Write the data in @p data_filter as the step @p time_step of a time
+   * series to the single HDF5 file @p filename. Writing a new file for every
+   * output step, as done by write_hdf5_parallel(), creates a large number of
+   * files and metadata operations on parallel file systems for long
+   * simulations. Instead, this function creates @p filename for
+   * <tt>time_step == 0</tt>, overwriting an existing file, and opens it
+   * to append new datasets for all other steps.
+   *
+   * The solution datasets of the step are stored in the group
+   * <tt>step_N</tt> of the file, where <tt>N</tt> is @p time_step. If
+   * @p write_mesh is true, the nodes and cells are written to the group
+   * <tt>mesh_N</tt>. Otherwise, the mesh is not written again and the step
+   * refers to the mesh written for an earlier step, which requires the
+   * mesh and the data filtering to be unchanged since then. The first
+   * step must always write the mesh. Use
+   * DataOutInterface::create_xdmf_entry() together with
+   * DataOutInterface::append_xdmf_entry() to describe the steps in an XDMF
+   * file that is updated incrementally.
+   */
+  template <int dim, int spacedim>
+  void
+  write_hdf5_time_step(const std::vector<Patch<dim, spacedim>> &patches,
+                       const DataOutFilter                     &data_filter,
+                       const DataOutBase::Hdf5Flags            &flags,
+                       const std::string                       &filename,
+                       const unsigned int                       time_step,
+                       const bool                               write_mesh,
+                       const MPI_Comm                           comm);
+
   /**
    * DataOutFilter is an intermediate data format that reduces the amount of
    * data that will be written to files. The object filled by this function
@@ -2425,6 +2632,9 @@ namespace DataOutBase
    * of the stream, and therefore alters it. In order to read from it using,
    * for example, the DataOutReader class, you may wish to either reset the
    * stream to its previous position, or close and reopen it.
+   *
+   * The function recognizes both the text format and the binary format
+   * written by write_deal_II_intermediate_binary().
    */
   std::pair<unsigned int, unsigned int>
   determine_intermediate_format_dimensions(std::istream &input);
@@ -2473,6 +2683,151 @@ namespace DataOutBase
   std::string
   default_suffix(const OutputFormat output_format);
 
+  /**
+   * @name Reduction of the patch data
+   *
+   * The following functions modify a set of patches after it has been
+   * generated, for example by DataOut::build_patches(), and before it is
+   * written by one of the functions above. They are meant to reduce the
+   * amount of data that is written to disk when only parts of the output
+   * are of interest.
+   * @{
+   */
+
+  /**
+   * Remove all patches for which @p predicate returns false. The patch
+   * indices and the neighbor information of the remaining patches are
+   * renumbered accordingly, with references to removed patches replaced by
+   * Patch::no_neighbor.
+   *
+   * The function returns, for each of the remaining patches, its position in
+   * @p patches before the call.
+   */
+  template <int dim, int spacedim>
+  std::vector<unsigned int>
+  filter_patches(
+    std::vector<Patch<dim, spacedim>>                        &patches,
+    const std::function<bool(const Patch<dim, spacedim> &)> &predicate);
+
+  /**
+   * Remove all patches that lie entirely outside of @p bounding_box, using
+   * filter_patches(). A patch is kept if the bounding box of its vertices,
+   * or of its points if Patch::points_are_available is set, intersects
+   * @p bounding_box. The return value is the one of filter_patches().
+   */
+  template <int dim, int spacedim>
+  std::vector<unsigned int>
+  clip_patches(std::vector<Patch<dim, spacedim>> &patches,
+               const BoundingBox<spacedim>       &bounding_box);
+
+  /**
+   * Reduce the number of subdivisions of @p patch to @p n_subdivisions by
+   * dropping the data of the intermediate points. The new number of
+   * subdivisions needs to divide the current one, so that all remaining points
+   * are points of the original patch. Patches whose reference cell is not a
+   * hypercube, and patches with fewer subdivisions, are left unchanged.
+   */
+  template <int dim, int spacedim>
+  void
+  coarsen_patch(Patch<dim, spacedim> &patch, const unsigned int n_subdivisions);
+
+  /**
+   * Round the values of the data row @p component of all patches to
+   * @p n_mantissa_bits significant bits of the mantissa. The values are still
+   * written as single precision numbers, but the zeros in the lower bits of
+   * the mantissa make the compressed output, see
+   * DataOutBase::VtkFlags::compression_level, considerably smaller. A value of
+   * 10 corresponds to the precision of half precision numbers, a value of 23
+   * or larger leaves the data unchanged.
+   */
+  template <int dim, int spacedim>
+  void
+  reduce_precision(std::vector<Patch<dim, spacedim>> &patches,
+                   const unsigned int                 component,
+                   const unsigned int                 n_mantissa_bits);
+
+  /** @} */
+
+  /**
+   * A handle to an output operation that runs in the background, as started
+   * by DataOutInterface::write_vtu_in_parallel_async(). The operation
+   * consists of a part that runs on a separate task, such as encoding and
+   * compressing the data, and possibly a part that needs to run on the
+   * calling thread once the task has finished, such as the collective MPI
+   * I/O calls in programs that do not support MPI calls from several threads
+   * at once. The latter part is executed by wait().
+   *
+   * Objects of this class can only be moved, not copied. Both a move
+   * assignment and the destructor wait for the operation that the object
+   * currently refers to. If the operation involves collective MPI calls,
+   * all processes of the communicator need to call wait() (or destroy the
+   * object) at the same point of the program.
+   */
+  class AsynchronousWrite
+  {
+  public:
+    /**
+     * Constructor. Create an object that does not refer to any operation.
+     */
+    AsynchronousWrite() = default;
+
+    /**
+     * Constructor. Create an object that refers to the running @p task and
+     * runs @p finalize on the calling thread of wait() once the task has
+     * finished. @p finalize may be empty.
+     */
+    AsynchronousWrite(Threads::Task<void>  &&task,
+                      std::function<void()> &&finalize);
+
+    /**
+     * Move constructor.
+     */
+    AsynchronousWrite(AsynchronousWrite &&other) noexcept = default;
+
+    /**
+     * Move assignment. Waits for the operation of the current object before
+     * taking over the one of @p other.
+     */
+    AsynchronousWrite &
+    operator=(AsynchronousWrite &&other);
+
+    /**
+     * Destructor. Waits for the operation to finish. If the destructor is
+     * called during stack unwinding because of an exception, only the
+     * background task is joined and the finalization is skipped, since it
+     * might involve collective operations that the other processes would
+     * not take part in.
+     */
+    ~AsynchronousWrite();
+
+    /**
+     * Wait for the background task to finish and execute the finalization.
+     * Exceptions thrown by the task are passed on to the caller. After this
+     * call, the object no longer refers to an operation, so calling wait()
+     * again returns immediately.
+     */
+    void
+    wait();
+
+    /**
+     * Return whether the object refers to an operation that has not been
+     * waited for.
+     */
+    bool
+    is_pending() const;
+
+  private:
+    /**
+     * The background part of the operation.
+     */
+    Threads::Task<void> task;
+
+    /**
+     * The part of the operation to be run by wait().
+     */
+    std::function<void()> finalize;
+  };
+
   /**
    * @addtogroup Exceptions
    * @{
@@ -2728,6 +3083,40 @@ public:
   void
   write_vtu_in_parallel(const std::string &filename, const MPI_Comm comm) const;
 
+  /**
+   * Asynchronous variant of write_vtu_in_parallel(). The function copies the
+   * patches and all other data needed for the output, so the object can be
+   * modified (e.g., by calling DataOut::build_patches() again) as soon as the
+   * function returns. The encoding and compression of the data, which are
+   * typically the most expensive parts of writing, run on a separate task
+   * while the program continues.
+   *
+   * The returned object needs to be waited for, typically before the next
+   * output is written, in order to complete the operation:
+   * @code
+   *   DataOutBase::AsynchronousWrite pending_output;
+   *   for (unsigned int step = 0; ...; ++step)
+   *     {
+   *       ... solve ...
+   *       data_out.build_patches();
+   *       pending_output.wait();
+   *       pending_output = data_out.write_vtu_in_parallel_async(
+   *         "solution-" + std::to_string(step) + ".vtu", mpi_communicator);
+   *     }
+   *   pending_output.wait();
+   * @endcode
+   *
+   * The collective MPI I/O calls can only run on the separate task if the MPI
+   * library was initialized with support for MPI_THREAD_MULTIPLE, in which
+   * case the task uses a duplicate of @p comm. Otherwise, which is the
+   * default with Utilities::MPI::MPI_InitFinalize, the data is written in
+   * the call to AsynchronousWrite::wait(). This function itself is
+   * collective over @p comm.
+   */
+  DataOutBase::AsynchronousWrite
+  write_vtu_in_parallel_async(const std::string &filename,
+                              const MPI_Comm     comm) const;
+
   /**
    * Some visualization programs, such as ParaView and VisIt, can read several
    * separate VTU files that all form part of the same simulation, in order to
@@ -2855,6 +3244,14 @@ public:
   void
   write_deal_II_intermediate(std::ostream &out) const;
 
+  /**
+   * Obtain data through get_patches() and write it to <tt>out</tt> in the
+   * binary deal.II intermediate format. See
+   * DataOutBase::write_deal_II_intermediate_binary().
+   */
+  void
+  write_deal_II_intermediate_binary(std::ostream &out) const;
+
   /**
    * Obtain data through get_patches() and write it using MPI I/O in parallel
    * to the file @p filename in the parallel
@@ -2919,6 +3316,53 @@ public:
                   const std::string            &filename,
                   const MPI_Comm                comm) const;
 
+  /**
+   * Create an XDMFEntry for the step @p time_step of a time series written
+   * by write_hdf5_time_step() to the file @p h5_filename, whose mesh was
+   * written in the step @p mesh_time_step.
+   */
+  XDMFEntry
+  create_xdmf_entry(const DataOutBase::DataOutFilter &data_filter,
+                    const std::string                &h5_filename,
+                    const unsigned int                mesh_time_step,
+                    const unsigned int                time_step,
+                    const double                      cur_time,
+                    const MPI_Comm                    comm) const;
+
+  /**
+   * Append @p entry to the XDMF file @p filename. If the file does not
+   * exist yet, it is created as by write_xdmf_file() with @p entry as the
+   * only entry. Otherwise, only the closing tags at the end of the file are
+   * replaced by the new entry, so that the cost of updating the file does
+   * not grow with the number of steps already written. Below is an example
+   * of writing a time series to a single HDF5 file:
+   *
+   * @code
+   * DataOutBase::DataOutFilterFlags flags(true, true);
+   * DataOutBase::DataOutFilter data_filter(flags);
+   * data_out.write_filtered_data(data_filter);
+   * data_out.write_hdf5_time_step(data_filter,
+   *                               "solution.h5",
+   *                               step,
+   *                               mesh_changed,
+   *                               MPI_COMM_WORLD);
+   * if (mesh_changed)
+   *   mesh_step = step;
+   * data_out.append_xdmf_entry(data_out.create_xdmf_entry(data_filter,
+   *                                                       "solution.h5",
+   *                                                       mesh_step,
+   *                                                       step,
+   *                                                       simulation_time,
+   *                                                       MPI_COMM_WORLD),
+   *                            "solution.xdmf",
+   *                            MPI_COMM_WORLD);
+   * @endcode
+   */
+  void
+  append_xdmf_entry(const XDMFEntry   &entry,
+                    const std::string &filename,
+                    const MPI_Comm     comm) const;
+
   /**
    * Write the data in @p data_filter to a single HDF5 file containing both the
    * mesh and solution values. Below is an example of how to use this function
@@ -2952,6 +3396,18 @@ public:
                       const std::string                &solution_filename,
                       const MPI_Comm                    comm) const;
 
+  /**
+   * Write the data in @p data_filter as the step @p time_step of a time
+   * series to the single HDF5 file @p filename. See
+   * DataOutBase::write_hdf5_time_step() for details.
+   */
+  void
+  write_hdf5_time_step(const DataOutBase::DataOutFilter &data_filter,
+                       const std::string                &filename,
+                       const unsigned int                time_step,
+                       const bool                        write_mesh,
+                       const MPI_Comm                    comm) const;
+
   /**
    * DataOutFilter is an intermediate data format that reduces the amount of
    * data that will be written to files. The object filled by this function
@@ -3228,10 +3684,24 @@ public:
    * Read a sequence of patches as written previously by
    * <tt>DataOutBase::write_deal_II_intermediate</tt> and store them in the
    * present object. This overwrites any previous content.
+   *
+   * The function also accepts streams containing data written by
+   * DataOutBase::write_deal_II_intermediate_binary(). In that case, the
+   * remainder of the stream is read as a whole and then decoded.
    */
   void
   read(std::istream &in);
 
+  /**
+   * Read the file @p filename written by
+   * DataOutBase::write_deal_II_intermediate_binary() and store its patches in
+   * the present object. This overwrites any previous content. Where the
+   * operating system allows it, the file is mapped into memory instead of
+   * being read through a stream.
+   */
+  void
+  read_binary(const std::string &filename);
+
   /**
    * Read all data previously written using
    * DataOutBase::write_deal_II_intermediate_in_parallel() from all
@@ -3414,6 +3884,16 @@ public:
   void
   add_attribute(const std::string &attr_name, const unsigned int dimension);
 
+  /**
+   * Set the groups of the HDF5 files in which the datasets of the mesh and
+   * of the solution are stored. By default, the datasets are expected in the
+   * root group of the files. Time series written by
+   * DataOutBase::write_hdf5_time_step() store every step in its own group.
+   */
+  void
+  set_hdf5_groups(const std::string &mesh_group,
+                  const std::string &solution_group);
+
   /**
    * Read or write the data of this object for serialization using the
    * [BOOST serialization
@@ -3424,7 +3904,8 @@ public:
   serialize(Archive &ar, const unsigned int /*version*/)
   {
     ar &valid &h5_sol_filename &h5_mesh_filename &entry_time &num_nodes
-      &num_cells &dimension &space_dimension &cell_type &attribute_dims;
+      &num_cells &dimension &space_dimension &cell_type &attribute_dims
+      &h5_mesh_group &h5_sol_group;
   }
 
   /**
@@ -3486,6 +3967,18 @@ private:
    * The attributes associated with this entry and their dimension.
    */
   std::map<std::string, unsigned int> attribute_dims;
+
+  /**
+   * The group of the HDF5 mesh file that contains the mesh datasets. An
+   * empty string denotes the root group.
+   */
+  std::string h5_mesh_group;
+
+  /**
+   * The group of the HDF5 solution file that contains the solution
+   * datasets. An empty string denotes the root group.
+   */
+  std::string h5_sol_group;
 };
 
 
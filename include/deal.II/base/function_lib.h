@@ -1445,6 +1445,12 @@ namespace Functions
    *                                  std::move(data_table));
    * @endcode
    *
+   * The constructor that takes an MPI communicator as additional argument
+   * combines the last two steps: It calls
+   * TableBase::replicate_across_communicator() on the table and broadcasts
+   * the coordinate values, such that these also only need to be set up on
+   * the root process.
+   *
    *
    * @ingroup functions
    */
@@ -1493,6 +1499,26 @@ namespace Functions
       std::array<std::vector<double>, dim> &&coordinate_values,
       Table<dim, double>                   &&data_values);
 
+    /**
+     * Like the previous constructor, but only the process with rank
+     * @p root_process within @p communicator needs to provide the
+     * coordinate values and the data table, whereas the arguments are
+     * ignored on all other processes. The coordinate values are broadcast to
+     * all processes, and the data table is distributed by
+     * TableBase::replicate_across_communicator(), i.e., it is stored only
+     * once per machine in shared memory if MPI supports this. This avoids
+     * both reading a large data file on every process and storing one copy
+     * of the data per process.
+     *
+     * This is a collective operation that needs to be called on all
+     * processes of @p communicator.
+     */
+    InterpolatedTensorProductGridData(
+      std::array<std::vector<double>, dim> &&coordinate_values,
+      Table<dim, double>                   &&data_values,
+      const MPI_Comm                         communicator,
+      const unsigned int                     root_process = 0);
+
     /**
      * Compute the value of the function set by bilinear interpolation of the
      * given data set.
@@ -1506,6 +1532,19 @@ namespace Functions
     virtual double
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    /**
+     * Compute the values of the function at all points in @p points, with
+     * the same result as calling value() for each of them. Since
+     * consecutive points are typically close to each other, e.g., the
+     * quadrature points of a cell, the search for the interval that
+     * contains a point starts by checking the interval of the previous
+     * point, rather than by a binary search through all coordinate values.
+     */
+    virtual void
+    value_list(const std::vector<Point<dim>> &points,
+               std::vector<double>           &values,
+               const unsigned int             component = 0) const override;
+
     /**
      * Compute the gradient of the function defined by bilinear interpolation
      * of the given data set.
@@ -1639,6 +1678,25 @@ namespace Functions
       std::array<unsigned int, dim>              &&n_subintervals,
       Table<dim, double>                         &&data_values);
 
+    /**
+     * Like the previous constructor, but only the process with rank
+     * @p root_process within @p communicator needs to provide the arguments,
+     * which are ignored on all other processes. The interval end points and
+     * the number of subintervals are broadcast to all processes, and the
+     * data table is distributed by TableBase::replicate_across_communicator(),
+     * i.e., it is stored only once per machine in shared memory if MPI
+     * supports this.
+     *
+     * This is a collective operation that needs to be called on all
+     * processes of @p communicator.
+     */
+    InterpolatedUniformGridData(
+      std::array<std::pair<double, double>, dim> &&interval_endpoints,
+      std::array<unsigned int, dim>              &&n_subintervals,
+      Table<dim, double>                         &&data_values,
+      const MPI_Comm                               communicator,
+      const unsigned int                           root_process = 0);
+
     /**
      * Compute the value of the function set by bilinear interpolation of the
      * given data set.
@@ -1652,6 +1710,16 @@ namespace Functions
     virtual double
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    /**
+     * Compute the values of the function at all points in @p points, with
+     * the same result as calling value() for each of them, but with the
+     * quantities describing the grid computed only once for all points.
+     */
+    virtual void
+    value_list(const std::vector<Point<dim>> &points,
+               std::vector<double>           &values,
+               const unsigned int             component = 0) const override;
+
     /**
      * Compute the gradient of the function set by bilinear interpolation of the
      * given data set.
@@ -351,6 +351,25 @@ public:
   virtual double
   value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+  /**
+   * Return the values of the function at the given points. This function
+   * evaluates the expression for batches of points at once and is therefore
+   * considerably faster than calling value() for each point.
+   */
+  virtual void
+  value_list(const std::vector<Point<dim>> &points,
+             std::vector<double>           &values,
+             const unsigned int             component = 0) const override;
+
+  /**
+   * Return the values of all components of the function at the given
+   * points. Like value_list(), this function evaluates the expressions for
+   * batches of points at once.
+   */
+  virtual void
+  vector_value_list(const std::vector<Point<dim>> &points,
+                    std::vector<Vector<double>>   &values) const override;
+
   /**
    * Return an array of function expressions (one per component), used to
    * initialize this function.
@@ -19,6 +19,7 @@
 
 #  include <deal.II/base/config.h>
 
+#  include <deal.II/base/parallel.h>
 #  include <deal.II/base/thread_management.h>
 
 #  include <algorithm>
@@ -76,6 +77,88 @@ namespace GraphColoring
     }
 
 
+    /**
+     * A data structure that stores the conflict indices of a range of
+     * iterators, which are identified by their position within the range,
+     * together with the inverse relation, i.e., the iterators that share a
+     * given conflict index. It is set up once by make_graph_coloring() so
+     * that the user-provided function returning the conflict indices is
+     * only called once per iterator.
+     */
+    struct ConflictIndices
+    {
+      /**
+       * Call @p get_conflict_indices on all @p iterators, possibly in
+       * parallel, and set up the inverse relation.
+       */
+      template <typename Iterator>
+      ConflictIndices(
+        const std::vector<Iterator> &iterators,
+        const std::function<std::vector<types::global_dof_index>(
+          const Iterator &)>        &get_conflict_indices)
+        : indices_of_iterator(iterators.size())
+      {
+        const unsigned int n_iterators = iterators.size();
+        parallel::apply_to_subranges(
+          0U,
+          n_iterators,
+          [&](const unsigned int begin, const unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+              indices_of_iterator[i] = get_conflict_indices(iterators[i]);
+          },
+          64);
+
+        std::size_t n_entries = 0;
+        for (const auto &indices : indices_of_iterator)
+          n_entries += indices.size();
+        iterators_of_index.reserve(n_entries);
+        for (unsigned int i = 0; i < n_iterators; ++i)
+          for (const types::global_dof_index index : indices_of_iterator[i])
+            iterators_of_index.emplace_back(index, i);
+
+        // sorting the pairs also sorts the iterators sharing an index by
+        // their position in the range
+        std::sort(iterators_of_index.begin(), iterators_of_index.end());
+      }
+
+      /**
+       * Return the range of entries in @p iterators_of_index with the given
+       * conflict index.
+       */
+      std::pair<const std::pair<types::global_dof_index, unsigned int> *,
+                const std::pair<types::global_dof_index, unsigned int> *>
+      get_iterators(const types::global_dof_index index) const
+      {
+        const auto range = std::equal_range(
+          iterators_of_index.begin(),
+          iterators_of_index.end(),
+          std::make_pair(index, 0U),
+          [](const std::pair<types::global_dof_index, unsigned int> &a,
+             const std::pair<types::global_dof_index, unsigned int> &b) {
+            return a.first < b.first;
+          });
+        return {iterators_of_index.data() +
+                  (range.first - iterators_of_index.begin()),
+                iterators_of_index.data() +
+                  (range.second - iterators_of_index.begin())};
+      }
+
+      /**
+       * The conflict indices of each iterator, in the order returned by the
+       * user-provided function.
+       */
+      std::vector<std::vector<types::global_dof_index>> indices_of_iterator;
+
+      /**
+       * Pairs of a conflict index and the position of an iterator with that
+       * conflict index, sorted lexicographically.
+       */
+      std::vector<std::pair<types::global_dof_index, unsigned int>>
+        iterators_of_index;
+    };
+
+
+
     /**
      * Create a partitioning of the given range of iterators using a
      * simplified version of the Cuthill-McKee algorithm (Breadth First Search
@@ -93,85 +176,50 @@ namespace GraphColoring
      * user-provided function. The meaning of this function is discussed in the
      * documentation of the GraphColoring::make_graph_coloring() function.
      *
-     * @param[in] begin The first element of a range of iterators for which a
-     * partitioning is sought.
-     * @param[in] end The element past the end of the range of iterators.
-     * @param[in] get_conflict_indices A user defined function object
-     * returning a set of indicators that are descriptive of what represents a
-     * conflict. See above for a more thorough discussion.
-     * @return A set of sets of iterators (where sets are represented by
-     * std::vector for efficiency). Each element of the outermost set
-     * corresponds to the iterators pointing to objects that are in the same
-     * partition (i.e., the same zone).
+     * @param[in] conflicts The conflict indices of the iterators of the
+     * range.
+     * @return A partition of the positions of the iterators in the range
+     * into zones.
      */
-    template <typename Iterator>
-    std::vector<std::vector<Iterator>>
-    create_partitioning(
-      const Iterator                             &begin,
-      const std_cxx20::type_identity_t<Iterator> &end,
-      const std::function<std::vector<types::global_dof_index>(
-        const Iterator &)>                       &get_conflict_indices)
+    inline std::vector<std::vector<unsigned int>>
+    create_partitioning(const ConflictIndices &conflicts)
     {
-      // Number of iterators.
-      unsigned int n_iterators = 0;
-
-      // Create a map from conflict indices to iterators
-      std::unordered_map<types::global_dof_index, std::vector<Iterator>>
-        indices_to_iterators;
-      for (Iterator it = begin; it != end; ++it)
-        {
-          const std::vector<types::global_dof_index> conflict_indices =
-            get_conflict_indices(it);
-          const unsigned int n_conflict_indices = conflict_indices.size();
-          for (unsigned int i = 0; i < n_conflict_indices; ++i)
-            indices_to_iterators[conflict_indices[i]].push_back(it);
-          ++n_iterators;
-        }
+      const unsigned int n_iterators = conflicts.indices_of_iterator.size();
 
       // create the very first zone which contains only the first
       // iterator. then create the other zones. keep track of all the
       // iterators that have already been assigned to a zone
-      std::vector<std::vector<Iterator>> zones(1,
-                                               std::vector<Iterator>(1, begin));
-      std::set<Iterator>                 used_it;
-      used_it.insert(begin);
-      while (used_it.size() != n_iterators)
+      std::vector<std::vector<unsigned int>> zones(
+        1, std::vector<unsigned int>(1, 0U));
+      std::vector<bool> used_it(n_iterators, false);
+      used_it[0]                   = true;
+      unsigned int n_used          = 1;
+      unsigned int first_candidate = 1;
+      while (n_used != n_iterators)
         {
           // loop over the elements of the previous zone. for each element of
           // the previous zone, get the conflict indices and from there get
           // those iterators that are conflicting with the current element
-          typename std::vector<Iterator>::iterator previous_zone_it(
-            zones.back().begin());
-          typename std::vector<Iterator>::iterator previous_zone_end(
-            zones.back().end());
-          std::vector<Iterator> new_zone;
-          for (; previous_zone_it != previous_zone_end; ++previous_zone_it)
-            {
-              const std::vector<types::global_dof_index> conflict_indices =
-                get_conflict_indices(*previous_zone_it);
-
-              const unsigned int n_conflict_indices(conflict_indices.size());
-              for (unsigned int i = 0; i < n_conflict_indices; ++i)
-                {
-                  const std::vector<Iterator> &conflicting_elements =
-                    indices_to_iterators[conflict_indices[i]];
-                  for (unsigned int j = 0; j < conflicting_elements.size(); ++j)
+          std::vector<unsigned int> new_zone;
+          for (const unsigned int it : zones.back())
+            for (const types::global_dof_index index :
+                 conflicts.indices_of_iterator[it])
+              {
+                const auto conflicting_elements =
+                  conflicts.get_iterators(index);
+                for (auto p = conflicting_elements.first;
+                     p != conflicting_elements.second;
+                     ++p)
+                  // check that the iterator conflicting with the current one
+                  // is not associated to a zone yet and if so, assign it to
+                  // the current zone. mark it as used
+                  if (used_it[p->second] == false)
                     {
-                      // check that the iterator conflicting with the current
-                      // one is not associated to a zone yet and if so, assign
-                      // it to the current zone. mark it as used
-                      //
-                      // we can shortcut this test if the conflicting iterator
-                      // is the current iterator
-                      if ((conflicting_elements[j] != *previous_zone_it) &&
-                          (used_it.count(conflicting_elements[j]) == 0))
-                        {
-                          new_zone.push_back(conflicting_elements[j]);
-                          used_it.insert(conflicting_elements[j]);
-                        }
+                      new_zone.push_back(p->second);
+                      used_it[p->second] = true;
+                      ++n_used;
                     }
-                }
-            }
+              }
 
           // If there are iterators in the new zone, then the zone is added to
           // the partition. Otherwise, the graph is disconnected and we need to
@@ -179,15 +227,15 @@ namespace GraphColoring
           // process again with the first iterator that hasn't been assigned to
           // a zone yet
           if (new_zone.size() != 0)
-            zones.push_back(new_zone);
+            zones.push_back(std::move(new_zone));
           else
-            for (Iterator it = begin; it != end; ++it)
-              if (used_it.count(it) == 0)
-                {
-                  zones.push_back(std::vector<Iterator>(1, it));
-                  used_it.insert(it);
-                  break;
-                }
+            {
+              while (used_it[first_candidate] == true)
+                ++first_candidate;
+              zones.emplace_back(1, first_candidate);
+              used_it[first_candidate] = true;
+              ++n_used;
+            }
         }
 
       return zones;
@@ -207,10 +255,18 @@ namespace GraphColoring
      *    color.
      * -# If all the vertices are colored, stop. Otherwise, return to 3.
      *
-     * @param[in] partition The set of iterators that should be colored.
-     * @param[in] get_conflict_indices A user defined function object
-     * returning a set of indicators that are descriptive of what represents a
-     * conflict. See above for a more thorough discussion.
+     * The edges of the graph are found through the iterators sharing a
+     * conflict index, rather than by comparing the conflict indices of all
+     * pairs of iterators in the zone, which keeps the cost proportional to
+     * the size of the zone.
+     *
+     * @param[in] iterators The iterators of the whole range.
+     * @param[in] conflicts The conflict indices of the iterators of the
+     * range.
+     * @param[in] partition The positions of the iterators in the range that
+     * should be colored.
+     * @param[in] zone_of_iterator The zone each iterator of the range
+     * has been assigned to, and @p zone the one of @p partition.
      * @param[out] partition_coloring A set of sets of iterators (where sets
      * are represented by std::vector for efficiency). Each element of the
      * outermost set corresponds to the iterators pointing to objects that are
@@ -219,95 +275,83 @@ namespace GraphColoring
      */
     template <typename Iterator>
     void
-    make_dsatur_coloring(
-      std::vector<Iterator>              &partition,
-      const std::function<std::vector<types::global_dof_index>(
-        const Iterator &)>               &get_conflict_indices,
-      std::vector<std::vector<Iterator>> &partition_coloring)
+    make_dsatur_coloring(const std::vector<Iterator>        &iterators,
+                         const ConflictIndices              &conflicts,
+                         const std::vector<unsigned int>    &partition,
+                         const std::vector<unsigned int>    &zone_of_iterator,
+                         const unsigned int                  zone,
+                         std::vector<std::vector<Iterator>> &partition_coloring)
     {
       partition_coloring.clear();
 
-      // Number of zones composing the partitioning.
-      const unsigned int        partition_size(partition.size());
-      std::vector<unsigned int> sorted_vertices(partition_size);
-      std::vector<int>          degrees(partition_size);
-      std::vector<std::vector<types::global_dof_index>> conflict_indices(
-        partition_size);
-      std::vector<std::vector<unsigned int>> graph(partition_size);
+      const unsigned int partition_size(partition.size());
 
-      // Get the conflict indices associated to each iterator. The
-      // conflict_indices have to be sorted so we can more easily find conflicts
-      // later on
+      // map the position of an iterator in the range to the one in the
+      // partition
+      std::unordered_map<unsigned int, unsigned int> vertex_of_iterator;
       for (unsigned int i = 0; i < partition_size; ++i)
-        {
-          conflict_indices[i] = get_conflict_indices(partition[i]);
-          std::sort(conflict_indices[i].begin(), conflict_indices[i].end());
-        }
+        vertex_of_iterator[partition[i]] = i;
 
-      // Compute the degree of each vertex of the graph using the
-      // intersection of the conflict indices.
+      // If two iterators share indices then we create an ''edge'' in the
+      // graph.
+      std::vector<std::vector<unsigned int>> graph(partition_size);
       for (unsigned int i = 0; i < partition_size; ++i)
-        for (unsigned int j = i + 1; j < partition_size; ++j)
-          // If the two iterators share indices then we increase the degree of
-          // the vertices and create an ''edge'' in the graph.
-          if (have_nonempty_intersection(conflict_indices[i],
-                                         conflict_indices[j]))
+        {
+          std::vector<unsigned int> &neighbors = graph[i];
+          for (const types::global_dof_index index :
+               conflicts.indices_of_iterator[partition[i]])
             {
-              ++degrees[i];
-              ++degrees[j];
-              graph[i].push_back(j);
-              graph[j].push_back(i);
+              const auto conflicting_elements = conflicts.get_iterators(index);
+              for (auto p = conflicting_elements.first;
+                   p != conflicting_elements.second;
+                   ++p)
+                if (p->second != partition[i] &&
+                    zone_of_iterator[p->second] == zone)
+                  neighbors.push_back(vertex_of_iterator[p->second]);
             }
-
-      // Sort the vertices by decreasing degree.
-      std::vector<int>::iterator degrees_it;
-      for (unsigned int i = 0; i < partition_size; ++i)
-        {
-          // Find the largest element.
-          degrees_it         = std::max_element(degrees.begin(), degrees.end());
-          sorted_vertices[i] = degrees_it - degrees.begin();
-          // Put the largest element to -1 so it cannot be chosen again.
-          *degrees_it = -1;
+          std::sort(neighbors.begin(), neighbors.end());
+          neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                          neighbors.end());
         }
 
-      // Color the graph.
-      std::vector<std::unordered_set<unsigned int>> colors_used;
+      // Sort the vertices by decreasing degree, keeping the order of the
+      // partition for vertices of the same degree.
+      std::vector<unsigned int> sorted_vertices(partition_size);
+      for (unsigned int i = 0; i < partition_size; ++i)
+        sorted_vertices[i] = i;
+      std::stable_sort(sorted_vertices.begin(),
+                       sorted_vertices.end(),
+                       [&graph](const unsigned int a, const unsigned int b) {
+                         return graph[a].size() > graph[b].size();
+                       });
+
+      // Color the graph. Use the color with the lowest number that is not
+      // associated to one of the vertices linked to current_vertex, or add a
+      // new color if all are in use.
+      std::vector<unsigned int> color_of_vertex(partition_size,
+                                                numbers::invalid_unsigned_int);
+      std::vector<unsigned int> color_used_by(0);
       for (unsigned int i = 0; i < partition_size; ++i)
         {
           const unsigned int current_vertex(sorted_vertices[i]);
-          bool               new_color(true);
-          // Try to use an existing color, i.e., try to find a color which is
-          // not associated to one of the vertices linked to current_vertex.
-          // Loop over the color.
-          for (unsigned int j = 0; j < partition_coloring.size(); ++j)
-            {
-              // Loop on the vertices linked to current_vertex. If one vertex
-              // linked to current_vertex is already using the color j, this
-              // color cannot be used anymore.
-              bool unused_color(true);
-              for (const auto adjacent_vertex : graph[current_vertex])
-                if (colors_used[j].count(adjacent_vertex) == 1)
-                  {
-                    unused_color = false;
-                    break;
-                  }
-              if (unused_color)
-                {
-                  partition_coloring[j].push_back(partition[current_vertex]);
-                  colors_used[j].insert(current_vertex);
-                  new_color = false;
-                  break;
-                }
-            }
-          // Add a new color.
-          if (new_color)
+          for (const auto adjacent_vertex : graph[current_vertex])
+            if (color_of_vertex[adjacent_vertex] !=
+                numbers::invalid_unsigned_int)
+              color_used_by[color_of_vertex[adjacent_vertex]] = current_vertex;
+
+          unsigned int color = 0;
+          while (color < partition_coloring.size() &&
+                 color_used_by[color] == current_vertex)
+            ++color;
+
+          if (color == partition_coloring.size())
             {
-              partition_coloring.push_back(
-                std::vector<Iterator>(1, partition[current_vertex]));
-              std::unordered_set<unsigned int> tmp;
-              tmp.insert(current_vertex);
-              colors_used.push_back(tmp);
+              partition_coloring.emplace_back();
+              color_used_by.push_back(numbers::invalid_unsigned_int);
             }
+          partition_coloring[color].push_back(
+            iterators[partition[current_vertex]]);
+          color_of_vertex[current_vertex] = color;
         }
     }
 
@@ -547,22 +591,40 @@ namespace GraphColoring
            ExcMessage(
              "GraphColoring is not prepared to deal with empty ranges!"));
 
-    // Create the partitioning.
-    std::vector<std::vector<Iterator>> partitioning =
-      internal::create_partitioning(begin, end, get_conflict_indices);
+    std::vector<Iterator> iterators;
+    for (Iterator it = begin; it != end; ++it)
+      iterators.push_back(it);
+
+    // Get the conflict indices of all iterators, in parallel, and create the
+    // partitioning.
+    const internal::ConflictIndices conflicts(
+      iterators,
+      std::function<std::vector<types::global_dof_index>(const Iterator &)>(
+        get_conflict_indices));
+    const std::vector<std::vector<unsigned int>> partitioning =
+      internal::create_partitioning(conflicts);
+
+    const unsigned int        partitioning_size(partitioning.size());
+    std::vector<unsigned int> zone_of_iterator(iterators.size());
+    for (unsigned int i = 0; i < partitioning_size; ++i)
+      for (const unsigned int it : partitioning[i])
+        zone_of_iterator[it] = i;
 
     // Color the iterators within each partition.
     // Run the coloring algorithm on each zone in parallel
-    const unsigned int partitioning_size(partitioning.size());
     std::vector<std::vector<std::vector<Iterator>>> partition_coloring(
       partitioning_size);
 
     Threads::TaskGroup<> tasks;
     for (unsigned int i = 0; i < partitioning_size; ++i)
-      tasks += Threads::new_task(&internal::make_dsatur_coloring<Iterator>,
-                                 partitioning[i],
-                                 get_conflict_indices,
-                                 partition_coloring[i]);
+      tasks += Threads::new_task([&, i]() {
+        internal::make_dsatur_coloring(iterators,
+                                       conflicts,
+                                       partitioning[i],
+                                       zone_of_iterator,
+                                       i,
+                                       partition_coloring[i]);
+      });
     tasks.join_all();
 
     // Gather the colors together.
@@ -435,13 +435,16 @@ namespace HDF5
 
     /**
      * Create dataset. This is an internal constructor. The function
-     * Group::create_dataset() should be used to create a dataset.
+     * Group::create_dataset() should be used to create a dataset. If
+     * @p chunk_dimensions is empty, the dataset uses the contiguous storage
+     * layout, otherwise it is stored in chunks of the given dimensions.
      */
     DataSet(const std::string            &name,
             const hid_t                  &parent_group_id,
             const std::vector<hsize_t>   &dimensions,
             const std::shared_ptr<hid_t> &t_type,
-            const bool                    mpi);
+            const bool                    mpi,
+            const std::vector<hsize_t>   &chunk_dimensions = {});
 
   public:
     /**
@@ -1044,6 +1047,21 @@ namespace HDF5
     create_dataset(const std::string          &name,
                    const std::vector<hsize_t> &dimensions) const;
 
+    /**
+     * Creates a dataset that is stored in chunks of size
+     * @p chunk_dimensions rather than contiguously. Chunked storage lets
+     * the parallel HDF5 library align the collective I/O operations with the
+     * chunks and is a prerequisite for filters such as compression. The
+     * chunk dimensions are limited to the dataset dimensions; a dataset with
+     * a zero dimension is stored contiguously. @p number can be the same
+     * types as for the other create_dataset() function.
+     */
+    template <typename number>
+    DataSet
+    create_dataset(const std::string          &name,
+                   const std::vector<hsize_t> &dimensions,
+                   const std::vector<hsize_t> &chunk_dimensions) const;
+
     /**
      * Create and write data to a dataset. @p number can be `float`, `double`,
      * `std::complex<float>`, `std::complex<double>`, `int` or `unsigned int`.
@@ -2239,6 +2257,19 @@ namespace HDF5
 
 
 
+  template <typename number>
+  DataSet
+  Group::create_dataset(const std::string          &name,
+                        const std::vector<hsize_t> &dimensions,
+                        const std::vector<hsize_t> &chunk_dimensions) const
+  {
+    AssertDimension(chunk_dimensions.size(), dimensions.size());
+    std::shared_ptr<hid_t> t_type = internal::get_hdf5_datatype<number>();
+    return {name, *hdf5_reference, dimensions, t_type, mpi, chunk_dimensions};
+  }
+
+
+
   template <typename Container>
   void
   Group::write_dataset(const std::string &name, const Container &data) const
@@ -225,6 +225,22 @@ public:
   void
   add_indices(const ForwardIterator &begin, const ForwardIterator &end);
 
+  /**
+   * Add all indices stored in the vector @p indices, which may be unsorted
+   * and may contain duplicates. This is the preferred way to fill an index
+   * set from a large list of indices collected in arbitrary order, e.g., the
+   * indices of all degrees of freedom on some set of cells.
+   *
+   * The vector is sorted in place, for long vectors in chunks that are
+   * processed in parallel, and each sorted chunk is converted into ranges of
+   * consecutive indices while skipping duplicates. The ranges of all chunks
+   * are then merged into the index set in a single step. Since the vector's
+   * content is consumed, it needs to be passed as an rvalue, e.g., via
+   * `std::move()`.
+   */
+  void
+  add_unsorted_indices(std::vector<size_type> &&indices);
+
   /**
    * Add the given IndexSet @p other to the current one, constructing the
    * union of *this and @p other.
@@ -303,6 +319,21 @@ public:
   size_type
   index_within_set(const size_type global_index) const;
 
+  /**
+   * Return the result of index_within_set() for all elements of @p other,
+   * in ascending order of the elements of @p other. Both index sets need to
+   * be of the same size. Elements of @p other that are not members of the
+   * current set get the value numbers::invalid_dof_index.
+   *
+   * Since the elements of both sets are sorted, this function walks through
+   * the ranges of both index sets simultaneously rather than searching for
+   * every element separately. It is therefore considerably faster than
+   * calling index_within_set() for every element of @p other if the current
+   * set consists of many ranges.
+   */
+  std::vector<size_type>
+  index_within_set(const IndexSet &other) const;
+
   /**
    * Each index set can be represented as the union of a number of contiguous
    * intervals of indices, where if necessary intervals may only consist of
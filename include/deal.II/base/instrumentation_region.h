@@ -0,0 +1,148 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_instrumentation_region_h
+#define dealii_instrumentation_region_h
+
+#include <deal.II/base/config.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A class that marks a named region of code for external performance
+ * analysis tools, in order to measure hardware performance counters such
+ * as memory bandwidth and floating point rates for that region. The region
+ * starts with the construction of the object and ends with its
+ * destruction:
+ * @code
+ *   {
+ *     InstrumentationRegion region("assemble_rhs");
+ *     // code to be measured
+ *   }
+ * @endcode
+ *
+ * The regions are passed on to the tools deal.II has been configured with:
+ * <ul>
+ * <li> If deal.II was configured with <code>DEAL_II_WITH_LIKWID</code>, the
+ * regions are reported to the marker API of
+ * <a href="https://github.com/RRZE-HPC/likwid">LIKWID</a> and show up in the
+ * output of <code>likwid-perfctr -m</code>. The marker API is initialized and
+ * closed by Utilities::MPI::MPI_InitFinalize.
+ * <li> If deal.II was configured with <code>DEAL_II_WITH_CALIPER</code>, the
+ * regions are reported to
+ * <a href="https://github.com/LLNL/Caliper">Caliper</a> as annotation
+ * regions, which can be combined with its PAPI service for hardware
+ * counters.
+ * </ul>
+ * Without any of these libraries, objects of this class do nothing and
+ * are optimized away by the compiler.
+ *
+ * Some performance critical functions of the library are wrapped in regions
+ * of this kind, namely all loops of MatrixFree (region
+ * "MatrixFree::loop"), SolverCG::solve() ("SolverCG::solve"), and
+ * PreconditionChebyshev::vmult() and PreconditionChebyshev::step()
+ * ("PreconditionChebyshev::vmult" and "PreconditionChebyshev::step"). As these
+ * regions may be nested in each other and in user regions, tools that only
+ * support disjoint regions need to select the regions of interest.
+ *
+ * @note The name needs to be a string that lives at least as long as the
+ * region, typically a string literal.
+ *
+ * @ingroup utilities
+ */
+class InstrumentationRegion
+{
+public:
+  /**
+   * Start the region with the given name.
+   */
+  explicit InstrumentationRegion(const char *name);
+
+  /**
+   * End the region.
+   */
+  ~InstrumentationRegion();
+
+  /**
+   * The region is tied to its scope, so copying is not allowed.
+   */
+  InstrumentationRegion(const InstrumentationRegion &) = delete;
+
+  /**
+   * The region is tied to its scope, so copying is not allowed.
+   */
+  InstrumentationRegion &
+  operator=(const InstrumentationRegion &) = delete;
+
+  /**
+   * Start the region with the given name without creating an object, e.g.,
+   * for regions that do not correspond to a scope. Every call must be
+   * matched by a call to end() with the same name on the same thread.
+   */
+  static void
+  begin(const char *name);
+
+  /**
+   * End a region started with begin().
+   */
+  static void
+  end(const char *name);
+
+  /**
+   * Initialize the instrumentation libraries. This function is called by
+   * Utilities::MPI::MPI_InitFinalize and does not need to be called by
+   * user programs that use that class.
+   */
+  static void
+  initialize();
+
+  /**
+   * Finalize the instrumentation libraries and let them write their
+   * results. This function is called by Utilities::MPI::MPI_InitFinalize.
+   */
+  static void
+  finalize();
+
+private:
+  /**
+   * Name of the region.
+   */
+  const char *name;
+};
+
+
+
+/* ---------------- inline functions ----------------- */
+
+
+inline InstrumentationRegion::InstrumentationRegion(const char *name)
+  : name(name)
+{
+#if defined(DEAL_II_WITH_LIKWID) || defined(DEAL_II_WITH_CALIPER)
+  begin(name);
+#endif
+}
+
+
+
+inline InstrumentationRegion::~InstrumentationRegion()
+{
+#if defined(DEAL_II_WITH_LIKWID) || defined(DEAL_II_WITH_CALIPER)
+  end(name);
+#endif
+}
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,325 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_memory_registry_h
+#define dealii_memory_registry_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/mpi_stub.h>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * An opt-in global registry to track the memory consumption of a program
+ * over its run time, in order to find out which objects and which phases of
+ * a program are responsible for the memory use on the most loaded MPI
+ * process.
+ *
+ * The registry collects two kinds of information:
+ * - Objects such as a Triangulation, a DoFHandler, a MatrixFree object,
+ *   sparsity patterns, vectors, or the operators on the levels of a
+ *   multigrid hierarchy can be registered with add(). The registry then
+ *   queries their <code>memory_consumption()</code> function every time
+ *   update() or print_summary() is called and keeps track of both the
+ *   current and the peak value. Objects registered with the same name are
+ *   accumulated, which is useful for, e.g., the objects on all multigrid
+ *   levels.
+ * - Stages of the program, marked by MemoryRegistry::Stage objects, record
+ *   the peak increase of the resident set size of the process during the
+ *   stage, as compared to the size at the beginning of the stage. This
+ *   captures transient memory peaks of temporary data structures that are
+ *   not visible in the memory_consumption() functions of the objects
+ *   afterwards. The library marks a number of set-up functions as stages,
+ *   namely Triangulation::execute_coarsening_and_refinement() and its
+ *   variant in parallel::distributed::Triangulation,
+ *   DoFHandler::distribute_dofs(), DoFHandler::distribute_mg_dofs(),
+ *   DoFTools::make_sparsity_pattern(),
+ *   SparsityTools::distribute_sparsity_pattern(), and MatrixFree::reinit().
+ *   The user code can add further stages around its own functions.
+ *
+ * Both kinds of information are only collected after a call to enable(),
+ * otherwise the registry has no effect apart from checking a flag. A
+ * summary with the minimum, average, and maximum values over all MPI
+ * processes, as well as the rank of the process with the maximum, can be
+ * printed at any point of the program with print_summary().
+ *
+ * A typical use looks as follows:
+ * @code
+ *   MemoryRegistry::enable();
+ *
+ *   parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+ *   const auto tria_entry = MemoryRegistry::add("Triangulation", tria);
+ *   ...
+ *   DoFHandler<dim> dof_handler(tria);
+ *   dof_handler.distribute_dofs(fe);
+ *   const auto dof_entry = MemoryRegistry::add("DoFHandler", dof_handler);
+ *   ...
+ *   MemoryRegistry::print_summary(std::cout, MPI_COMM_WORLD);
+ * @endcode
+ *
+ * The peak resident set size of a stage is obtained from the high water
+ * mark of the process as reported by the operating system, see
+ * Utilities::System::get_memory_stats(), which is reset at the beginning of
+ * each stage. This information is only available on Linux; on other
+ * systems, only the information of the registered objects is collected.
+ * Stages are meant to be entered from the main thread only.
+ */
+class MemoryRegistry
+{
+public:
+  /**
+   * Constructor. This constructor is deleted because no instance of this
+   * class needs to be constructed (all members are static).
+   */
+  MemoryRegistry() = delete;
+
+  /**
+   * A handle to an object registered with add(). The object is removed from
+   * the registry when the handle is destroyed or reset, so the handle should
+   * not outlive the registered object.
+   */
+  class Handle
+  {
+  public:
+    /**
+     * Default constructor, creating a handle that does not refer to any
+     * object.
+     */
+    Handle() = default;
+
+    /**
+     * Move constructor.
+     */
+    Handle(Handle &&other) noexcept;
+
+    /**
+     * Move assignment.
+     */
+    Handle &
+    operator=(Handle &&other) noexcept;
+
+    /**
+     * Destructor. Removes the object from the registry.
+     */
+    ~Handle();
+
+    /**
+     * Remove the object from the registry and release the handle.
+     */
+    void
+    reset();
+
+  private:
+    /**
+     * Constructor for a given entry of the registry.
+     */
+    explicit Handle(const unsigned int index);
+
+    /**
+     * The index of the entry in the registry.
+     */
+    unsigned int index = static_cast<unsigned int>(-1);
+
+    friend class MemoryRegistry;
+  };
+
+  /**
+   * A scope object marking a stage of the program. The peak increase of the
+   * resident set size between the construction and the destruction of this
+   * object is recorded under the given name. Nested stages are supported,
+   * in which case the peak of the inner stage also counts for the enclosing
+   * stages.
+   */
+  class Stage
+  {
+  public:
+    /**
+     * Constructor. Starts the stage with the given name if the registry is
+     * enabled.
+     */
+    explicit Stage(const char *name);
+
+    /**
+     * Destructor. Ends the stage.
+     */
+    ~Stage();
+
+    /**
+     * Copying stages is not allowed.
+     */
+    Stage(const Stage &) = delete;
+
+    /**
+     * Copying stages is not allowed.
+     */
+    Stage &
+    operator=(const Stage &) = delete;
+
+  private:
+    /**
+     * Whether the stage was started, i.e., whether the registry was
+     * enabled at the time of construction.
+     */
+    bool is_active;
+  };
+
+  /**
+   * Enable the collection of information.
+   */
+  static void
+  enable();
+
+  /**
+   * Disable the collection of information. The data collected so far is
+   * kept.
+   */
+  static void
+  disable();
+
+  /**
+   * Return whether the collection of information is enabled.
+   */
+  static bool
+  is_enabled();
+
+  /**
+   * Register an object with the given name, whose memory consumption is
+   * queried by the function `object.memory_consumption()`. The returned
+   * handle removes the object from the registry upon destruction. If @p
+   * object is a function object returning the memory consumption in bytes,
+   * e.g., a lambda function, a copy of it is stored and called instead.
+   */
+  template <typename T>
+  static Handle
+  add(const std::string &name, const T &object);
+
+  /**
+   * Register an object with the given name, whose memory consumption in
+   * bytes is computed by the function @p memory_consumption.
+   */
+  static Handle
+  add(const std::string                  &name,
+      const std::function<std::size_t()> &memory_consumption);
+
+  /**
+   * Query the memory consumption of all registered objects and update
+   * their peak values. Call this function at points of the program where
+   * the objects are expected to have their largest size, e.g., after the
+   * set-up of the data structures.
+   */
+  static void
+  update();
+
+  /**
+   * Remove the information on the stages and the peak values of the
+   * objects collected so far.
+   */
+  static void
+  clear();
+
+  /**
+   * Print a summary of the memory consumption of the process, the
+   * registered objects, and the stages, with the minimum, average, and
+   * maximum over all MPI processes in @p mpi_comm and the rank of the
+   * process with the maximal value. All values are given in MB. This
+   * function updates the information of the registered objects. It is
+   * collective over @p mpi_comm, and only the root process writes to @p out.
+   *
+   * Objects and stages need not be present on all processes; missing
+   * entries count as zero in the statistics.
+   */
+  static void
+  print_summary(std::ostream &out, const MPI_Comm mpi_comm);
+
+private:
+  /**
+   * Whether the collection of information is enabled.
+   */
+  static std::atomic<bool> enabled;
+
+  /**
+   * Start a stage with the given name.
+   */
+  static void
+  enter_stage(const char *name);
+
+  /**
+   * End the most recently started stage.
+   */
+  static void
+  leave_stage();
+
+  /**
+   * Remove the entry with the given index.
+   */
+  static void
+  remove(const unsigned int index);
+};
+
+
+
+/* ---------------------- inline and template functions ------------------- */
+
+
+inline bool
+MemoryRegistry::is_enabled()
+{
+  return enabled.load(std::memory_order_relaxed);
+}
+
+
+
+template <typename T>
+inline MemoryRegistry::Handle
+MemoryRegistry::add(const std::string &name, const T &object)
+{
+  // function objects such as lambdas are stored as a copy, other objects are
+  // queried through their memory_consumption() functions
+  if constexpr (std::is_invocable_r_v<std::size_t, const T &>)
+    return add(name, std::function<std::size_t()>(object));
+  else
+    return add(name, [&object]() -> std::size_t {
+      return object.memory_consumption();
+    });
+}
+
+
+
+inline MemoryRegistry::Stage::Stage(const char *name)
+  : is_active(MemoryRegistry::is_enabled())
+{
+  if (is_active)
+    MemoryRegistry::enter_stage(name);
+}
+
+
+
+inline MemoryRegistry::Stage::~Stage()
+{
+  if (is_active)
+    MemoryRegistry::leave_stage();
+}
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
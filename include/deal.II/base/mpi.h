@@ -1311,6 +1311,150 @@ namespace Utilities
                const std::function<T(const T &, const T &)> &combiner);
 
 
+    /**
+     * Start the computation of the sum over all processors of the value
+     * @p t and return a Future object from which the result can be obtained
+     * once it is needed. This function is the "immediate" variant of sum()
+     * and corresponds to the <code>MPI_Iallreduce</code> function, i.e., it
+     * returns as soon as the reduction has been started, and the
+     * communication can overlap with other work until Future::wait() or
+     * Future::get() is called:
+     * @code
+     *   auto global_norm = Utilities::MPI::isum(local_norm_sqr, comm);
+     *   ... // other work not depending on the global norm
+     *   const double norm = std::sqrt(global_norm.get());
+     * @endcode
+     * The value of @p t is copied, so the argument may be a temporary. As for
+     * all collective operations, the reductions need to be started in the
+     * same order on all processes of the
+     * @ref GlossMPICommunicator "communicator".
+     *
+     * @note This function is only implemented for the scalar types for which
+     * sum() is implemented.
+     */
+    template <typename T>
+    Future<T>
+    isum(const T &t, const MPI_Comm mpi_communicator);
+
+    /**
+     * Like the previous function, but compute the sums over the elements of
+     * a vector, i.e., the i-th element of the result is the sum over the
+     * i-th entries of @p values from each processor.
+     */
+    template <typename T>
+    Future<std::vector<T>>
+    isum(const std::vector<T> &values, const MPI_Comm mpi_communicator);
+
+    /**
+     * Like the previous function, but take the sums over the elements of an
+     * array as specified by the ArrayView arguments. In contrast to the other
+     * variants, the result is written into @p sums, and neither @p values nor
+     * @p sums may be accessed or go out of scope before Future::wait() or
+     * Future::get() has been called on the returned object.
+     *
+     * Input and output arrays may be the same.
+     */
+    template <typename T>
+    Future<void>
+    isum(const ArrayView<const T> &values,
+         const MPI_Comm            mpi_communicator,
+         const ArrayView<T>       &sums);
+
+    /**
+     * Start an MPI sum of the entries of a symmetric tensor, see the scalar
+     * variant of this function.
+     *
+     * @relatesalso SymmetricTensor
+     */
+    template <int rank, int dim, typename Number>
+    Future<SymmetricTensor<rank, dim, Number>>
+    isum(const SymmetricTensor<rank, dim, Number> &local,
+         const MPI_Comm                            mpi_communicator);
+
+    /**
+     * Start an MPI sum of the entries of a tensor, see the scalar variant of
+     * this function.
+     *
+     * @relatesalso Tensor
+     */
+    template <int rank, int dim, typename Number>
+    Future<Tensor<rank, dim, Number>>
+    isum(const Tensor<rank, dim, Number> &local,
+         const MPI_Comm                   mpi_communicator);
+
+    /**
+     * Start the computation of the maximum over all processors of the value
+     * @p t. This is the "immediate" variant of max(), see isum() for the
+     * semantics of the returned Future object.
+     */
+    template <typename T>
+    Future<T>
+    imax(const T &t, const MPI_Comm mpi_communicator);
+
+    /**
+     * Like the previous function, but compute the maxima over the elements
+     * of a vector.
+     */
+    template <typename T>
+    Future<std::vector<T>>
+    imax(const std::vector<T> &values, const MPI_Comm mpi_communicator);
+
+    /**
+     * Like the previous function, but take the maxima over the elements of
+     * an array as specified by the ArrayView arguments. Neither @p values nor
+     * @p maxima may be accessed or go out of scope before Future::wait() or
+     * Future::get() has been called on the returned object.
+     *
+     * Input and output arrays may be the same.
+     */
+    template <typename T>
+    Future<void>
+    imax(const ArrayView<const T> &values,
+         const MPI_Comm            mpi_communicator,
+         const ArrayView<T>       &maxima);
+
+    /**
+     * Start the computation of the minimum over all processors of the value
+     * @p t. This is the "immediate" variant of min(), see isum() for the
+     * semantics of the returned Future object.
+     */
+    template <typename T>
+    Future<T>
+    imin(const T &t, const MPI_Comm mpi_communicator);
+
+    /**
+     * Like the previous function, but compute the minima over the elements
+     * of a vector.
+     */
+    template <typename T>
+    Future<std::vector<T>>
+    imin(const std::vector<T> &values, const MPI_Comm mpi_communicator);
+
+    /**
+     * Like the previous function, but take the minima over the elements of
+     * an array as specified by the ArrayView arguments. Neither @p values nor
+     * @p minima may be accessed or go out of scope before Future::wait() or
+     * Future::get() has been called on the returned object.
+     *
+     * Input and output arrays may be the same.
+     */
+    template <typename T>
+    Future<void>
+    imin(const ArrayView<const T> &values,
+         const MPI_Comm            mpi_communicator,
+         const ArrayView<T>       &minima);
+
+    /**
+     * Start the computation of the logical or over all processors of the
+     * value @p t. This is the "immediate" variant of logical_or(), see
+     * isum() for the semantics of the returned Future object. As for
+     * logical_or(), only integral types are allowed.
+     */
+    template <typename T>
+    Future<T>
+    ilogical_or(const T &t, const MPI_Comm mpi_communicator);
+
+
     /**
      * A function that takes a given argument `object` and, using MPI,
      * sends it to MPI process indicated by the given `target_rank`.
@@ -25,6 +25,8 @@
 #include <deal.II/lac/sparse_matrix.h>
 #include <deal.II/lac/vector.h>
 
+#include <array>
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -134,6 +136,94 @@ namespace Utilities
               std::copy(values.begin(), values.end(), output.begin());
           }
       }
+
+
+
+      /**
+       * Start a non-blocking reduction of @p values into @p output with
+       * <code>MPI_Iallreduce</code> and return a function that waits for
+       * the reduction to complete. Both arrays must stay alive until the
+       * returned function has been called.
+       */
+      template <typename T>
+      std::function<void()>
+      start_all_reduce(const MPI_Op             &mpi_op,
+                       const ArrayView<const T> &values,
+                       const MPI_Comm            mpi_communicator,
+                       const ArrayView<T>       &output)
+      {
+        AssertDimension(values.size(), output.size());
+#ifdef DEAL_II_WITH_MPI
+        if (job_supports_mpi())
+          {
+            MPI_Request request;
+            const int   ierr =
+              MPI_Iallreduce(values != output ? values.data() : MPI_IN_PLACE,
+                             static_cast<void *>(output.data()),
+                             static_cast<int>(values.size()),
+                             mpi_type_id_for_type<decltype(*values.data())>,
+                             mpi_op,
+                             mpi_communicator,
+                             &request);
+            AssertThrowMPI(ierr);
+
+            return [request]() mutable {
+              const int ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+              AssertThrowMPI(ierr);
+            };
+          }
+        else
+#endif
+          {
+            (void)mpi_op;
+            (void)mpi_communicator;
+            if (values != output)
+              std::copy(values.begin(), values.end(), output.begin());
+            return []() {};
+          }
+      }
+
+
+
+      /**
+       * Start a non-blocking reduction of the single value @p t and return a
+       * Future object that yields the result.
+       */
+      template <typename T>
+      Future<T>
+      start_all_reduce(const MPI_Op  &mpi_op,
+                       const T       &t,
+                       const MPI_Comm mpi_communicator)
+      {
+        const auto result = std::make_shared<T>(t);
+        const ArrayView<T> result_view(result.get(), 1);
+        return Future<T>(start_all_reduce(mpi_op,
+                                          ArrayView<const T>(result_view),
+                                          mpi_communicator,
+                                          result_view),
+                         [result]() { return *result; });
+      }
+
+
+
+      /**
+       * Like the previous function, but for the elements of a vector.
+       */
+      template <typename T>
+      Future<std::vector<T>>
+      start_all_reduce(const MPI_Op         &mpi_op,
+                       const std::vector<T> &values,
+                       const MPI_Comm        mpi_communicator)
+      {
+        const auto result      = std::make_shared<std::vector<T>>(values);
+        const auto result_view = make_array_view(*result);
+        return Future<std::vector<T>>(
+          start_all_reduce(mpi_op,
+                           ArrayView<const T>(result_view),
+                           mpi_communicator,
+                           result_view),
+          [result]() { return std::move(*result); });
+      }
     } // namespace internal
 
 
@@ -402,6 +492,172 @@ namespace Utilities
 
 
 
+    template <typename T>
+    Future<T>
+    isum(const T &t, const MPI_Comm mpi_communicator)
+    {
+      return internal::start_all_reduce(MPI_SUM, t, mpi_communicator);
+    }
+
+
+
+    template <typename T>
+    Future<std::vector<T>>
+    isum(const std::vector<T> &values, const MPI_Comm mpi_communicator)
+    {
+      return internal::start_all_reduce(MPI_SUM, values, mpi_communicator);
+    }
+
+
+
+    template <typename T>
+    Future<void>
+    isum(const ArrayView<const T> &values,
+         const MPI_Comm            mpi_communicator,
+         const ArrayView<T>       &sums)
+    {
+      return Future<void>(internal::start_all_reduce(MPI_SUM,
+                                                     values,
+                                                     mpi_communicator,
+                                                     sums),
+                          []() {});
+    }
+
+
+
+    template <int rank, int dim, typename Number>
+    Future<Tensor<rank, dim, Number>>
+    isum(const Tensor<rank, dim, Number> &local,
+         const MPI_Comm                   mpi_communicator)
+    {
+      // Copy the tensor into an array that lives as long as the reduction,
+      // and build the tensor from the array once the reduction is done.
+      constexpr unsigned int n_entries =
+        Tensor<rank, dim, Number>::n_independent_components;
+      const auto entries = std::make_shared<std::array<Number, n_entries>>();
+      for (unsigned int i = 0; i < n_entries; ++i)
+        (*entries)[i] =
+          local[Tensor<rank, dim, Number>::unrolled_to_component_indices(i)];
+
+      const ArrayView<Number> entries_view(entries->data(), n_entries);
+      return Future<Tensor<rank, dim, Number>>(
+        internal::start_all_reduce(MPI_SUM,
+                                   ArrayView<const Number>(entries_view),
+                                   mpi_communicator,
+                                   entries_view),
+        [entries]() {
+          return Tensor<rank, dim, Number>(
+            ArrayView<const Number>(entries->data(), n_entries));
+        });
+    }
+
+
+
+    template <int rank, int dim, typename Number>
+    Future<SymmetricTensor<rank, dim, Number>>
+    isum(const SymmetricTensor<rank, dim, Number> &local,
+         const MPI_Comm                            mpi_communicator)
+    {
+      constexpr unsigned int n_entries =
+        SymmetricTensor<rank, dim, Number>::n_independent_components;
+      const auto entries = std::make_shared<std::array<Number, n_entries>>();
+      for (unsigned int i = 0; i < n_entries; ++i)
+        (*entries)[i] = local[local.unrolled_to_component_indices(i)];
+
+      const ArrayView<Number> entries_view(entries->data(), n_entries);
+      return Future<SymmetricTensor<rank, dim, Number>>(
+        internal::start_all_reduce(MPI_SUM,
+                                   ArrayView<const Number>(entries_view),
+                                   mpi_communicator,
+                                   entries_view),
+        [entries]() {
+          SymmetricTensor<rank, dim, Number> global;
+          for (unsigned int i = 0; i < n_entries; ++i)
+            global[global.unrolled_to_component_indices(i)] = (*entries)[i];
+          return global;
+        });
+    }
+
+
+
+    template <typename T>
+    Future<T>
+    imax(const T &t, const MPI_Comm mpi_communicator)
+    {
+      return internal::start_all_reduce(MPI_MAX, t, mpi_communicator);
+    }
+
+
+
+    template <typename T>
+    Future<std::vector<T>>
+    imax(const std::vector<T> &values, const MPI_Comm mpi_communicator)
+    {
+      return internal::start_all_reduce(MPI_MAX, values, mpi_communicator);
+    }
+
+
+
+    template <typename T>
+    Future<void>
+    imax(const ArrayView<const T> &values,
+         const MPI_Comm            mpi_communicator,
+         const ArrayView<T>       &maxima)
+    {
+      return Future<void>(internal::start_all_reduce(MPI_MAX,
+                                                     values,
+                                                     mpi_communicator,
+                                                     maxima),
+                          []() {});
+    }
+
+
+
+    template <typename T>
+    Future<T>
+    imin(const T &t, const MPI_Comm mpi_communicator)
+    {
+      return internal::start_all_reduce(MPI_MIN, t, mpi_communicator);
+    }
+
+
+
+    template <typename T>
+    Future<std::vector<T>>
+    imin(const std::vector<T> &values, const MPI_Comm mpi_communicator)
+    {
+      return internal::start_all_reduce(MPI_MIN, values, mpi_communicator);
+    }
+
+
+
+    template <typename T>
+    Future<void>
+    imin(const ArrayView<const T> &values,
+         const MPI_Comm            mpi_communicator,
+         const ArrayView<T>       &minima)
+    {
+      return Future<void>(internal::start_all_reduce(MPI_MIN,
+                                                     values,
+                                                     mpi_communicator,
+                                                     minima),
+                          []() {});
+    }
+
+
+
+    template <typename T>
+    Future<T>
+    ilogical_or(const T &t, const MPI_Comm mpi_communicator)
+    {
+      static_assert(std::is_integral_v<T>,
+                    "The MPI_LOR operation only allows integral data types.");
+
+      return internal::start_all_reduce(MPI_LOR, t, mpi_communicator);
+    }
+
+
+
     template <typename T>
     T
     reduce(const T                                      &vec,
@@ -21,6 +21,11 @@
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_tags.h>
 
+#include <boost/serialization/utility.hpp>
+
+#include <algorithm>
+#include <map>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -1047,6 +1052,61 @@ namespace Utilities
 
 
 
+      /**
+       * This function implements a concrete algorithm for the
+       * consensus algorithms problem (see the documentation of the
+       * surrounding namespace) that takes into account that many processes
+       * typically share a compute node. Rather than sending one message
+       * between each pair of communicating processes, the messages of all
+       * processes of a node (as determined by
+       * <code>MPI_Comm_split_type</code> with
+       * <code>MPI_COMM_TYPE_SHARED</code>) are first collected on one
+       * process of the node, the node leader. The node leaders then
+       * exchange one aggregated message per pair of communicating nodes
+       * with the NBX algorithm and hand the received messages to the
+       * processes on their node. The answers are returned the same way.
+       *
+       * This reduces the number of messages between nodes from the number
+       * of communicating pairs of processes to the number of communicating
+       * pairs of nodes, which pays off on machines with many processes per
+       * node when each process communicates with many others. On the other
+       * hand, all messages are sent twice more within the node, and the
+       * function performs several collective operations on @p comm,
+       * including the creation of the node communicator and a gather of
+       * one integer per process. It is therefore not a replacement for
+       * the other algorithms in all situations.
+       *
+       * The arguments and the return value are the same as for nbx().
+       * RequestType and AnswerType need to be types that can be used with
+       * Utilities::pack() and Utilities::unpack().
+       */
+      template <typename RequestType, typename AnswerType>
+      std::vector<unsigned int>
+      hierarchical(
+        const std::vector<unsigned int>                      &targets,
+        const std::function<RequestType(const unsigned int)> &create_request,
+        const std::function<AnswerType(const unsigned int,
+                                       const RequestType &)> &answer_request,
+        const std::function<void(const unsigned int, const AnswerType &)>
+                      &process_answer,
+        const MPI_Comm comm);
+
+      /**
+       * This function provides a specialization of the one above for
+       * the case where a sending process does not require an answer, see
+       * the corresponding variant of nbx().
+       */
+      template <typename RequestType>
+      std::vector<unsigned int>
+      hierarchical(
+        const std::vector<unsigned int>                      &targets,
+        const std::function<RequestType(const unsigned int)> &create_request,
+        const std::function<void(const unsigned int, const RequestType &)>
+                      &process_request,
+        const MPI_Comm comm);
+
+
+
 #ifndef DOXYGEN
       // Implementation of the functions in this namespace.
 
@@ -2164,6 +2224,305 @@ namespace Utilities
       }
 
 
+
+      namespace internal
+      {
+        /**
+         * A message routed by the hierarchical() functions: The ranks of
+         * the sending and the receiving process within the original
+         * communicator, and the packed message.
+         */
+        using RoutedMessage =
+          std::pair<std::pair<unsigned int, unsigned int>, std::vector<char>>;
+
+
+
+        /**
+         * The information about the processes that share a node needed by
+         * the hierarchical() functions.
+         */
+        struct NodeLayout
+        {
+          /**
+           * Constructor. Split @p comm into the communicators of the
+           * individual nodes and collect the node leaders of all
+           * processes. This is a collective operation on @p comm.
+           */
+          explicit NodeLayout(const MPI_Comm comm)
+          {
+#  ifdef DEAL_II_WITH_MPI
+            const unsigned int my_rank = this_mpi_process(comm);
+            int ierr = MPI_Comm_split_type(comm,
+                                           MPI_COMM_TYPE_SHARED,
+                                           my_rank,
+                                           MPI_INFO_NULL,
+                                           &node_comm);
+            AssertThrowMPI(ierr);
+
+            // Since the processes are ordered by their rank in 'comm', the
+            // ranks of the processes of this node are sorted, and the first
+            // one is the node leader.
+            node_ranks.resize(n_mpi_processes(node_comm));
+            ierr = MPI_Allgather(&my_rank,
+                                 1,
+                                 MPI_UNSIGNED,
+                                 node_ranks.data(),
+                                 1,
+                                 MPI_UNSIGNED,
+                                 node_comm);
+            AssertThrowMPI(ierr);
+
+            leaders.resize(n_mpi_processes(comm));
+            ierr = MPI_Allgather(node_ranks.data(),
+                                 1,
+                                 MPI_UNSIGNED,
+                                 leaders.data(),
+                                 1,
+                                 MPI_UNSIGNED,
+                                 comm);
+            AssertThrowMPI(ierr);
+#  else
+            (void)comm;
+            node_comm = MPI_COMM_SELF;
+#  endif
+          }
+
+          /**
+           * Destructor. Free the node communicator.
+           */
+          ~NodeLayout()
+          {
+#  ifdef DEAL_II_WITH_MPI
+            Utilities::MPI::free_communicator(node_comm);
+#  endif
+          }
+
+          /**
+           * The communicator of the processes on the current node.
+           */
+          MPI_Comm node_comm;
+
+          /**
+           * The ranks within the original communicator of the processes on
+           * the current node, sorted by their rank within #node_comm.
+           */
+          std::vector<unsigned int> node_ranks;
+
+          /**
+           * For each process of the original communicator, the rank of the
+           * leader of its node.
+           */
+          std::vector<unsigned int> leaders;
+        };
+
+
+
+        /**
+         * Deliver the given messages to their receiving processes by
+         * collecting them on the node leaders, exchanging them between the
+         * node leaders, and scattering them to the processes on the node of
+         * the receivers. Return the messages received by the current
+         * process. This is a collective operation on @p comm.
+         */
+        inline std::vector<RoutedMessage>
+        route_through_node_leaders(const NodeLayout             &layout,
+                                   std::vector<RoutedMessage> &&messages,
+                                   const MPI_Comm                comm)
+        {
+          const unsigned int my_rank   = this_mpi_process(comm);
+          const bool         is_leader = (layout.node_ranks[0] == my_rank);
+
+          // 1) Collect the messages of all processes of the node on the
+          //    node leader, and sort them by the leader of the receiver.
+          //    Messages to processes on the same node do not leave it.
+          std::vector<std::vector<RoutedMessage>> messages_on_node =
+            gather(layout.node_comm, messages, 0);
+
+          std::map<unsigned int, std::vector<RoutedMessage>> outgoing;
+          for (auto &process_messages : messages_on_node)
+            for (auto &message : process_messages)
+              outgoing[layout.leaders[message.first.second]].emplace_back(
+                std::move(message));
+          messages_on_node.clear();
+
+          std::vector<RoutedMessage> arrived;
+          if (const auto local = outgoing.find(my_rank);
+              local != outgoing.end())
+            {
+              arrived = std::move(local->second);
+              outgoing.erase(local);
+            }
+
+          // 2) Exchange one message per pair of nodes between the node
+          //    leaders. All other processes participate without targets.
+          std::vector<unsigned int> targets;
+          targets.reserve(outgoing.size());
+          for (const auto &target_messages : outgoing)
+            targets.push_back(target_messages.first);
+
+          nbx<std::vector<RoutedMessage>>(
+            targets,
+            [&outgoing](const unsigned int target) {
+              return std::move(outgoing[target]);
+            },
+            [&arrived](const unsigned int,
+                       const std::vector<RoutedMessage> &node_messages) {
+              arrived.insert(arrived.end(),
+                             node_messages.begin(),
+                             node_messages.end());
+            },
+            comm);
+
+          // 3) Hand the messages to the receiving processes on the node.
+          std::vector<std::vector<RoutedMessage>> messages_for_processes;
+          if (is_leader)
+            {
+              messages_for_processes.resize(layout.node_ranks.size());
+              for (auto &message : arrived)
+                {
+                  const auto receiver =
+                    std::lower_bound(layout.node_ranks.begin(),
+                                     layout.node_ranks.end(),
+                                     message.first.second);
+                  Assert(receiver != layout.node_ranks.end() &&
+                           *receiver == message.first.second,
+                         ExcInternalError());
+                  messages_for_processes[receiver - layout.node_ranks.begin()]
+                    .emplace_back(std::move(message));
+                }
+            }
+
+          return scatter(layout.node_comm, messages_for_processes, 0);
+        }
+      } // namespace internal
+
+
+
+      template <typename RequestType, typename AnswerType>
+      std::vector<unsigned int>
+      hierarchical(
+        const std::vector<unsigned int>                      &targets,
+        const std::function<RequestType(const unsigned int)> &create_request,
+        const std::function<AnswerType(const unsigned int,
+                                       const RequestType &)> &answer_request,
+        const std::function<void(const unsigned int, const AnswerType &)>
+                      &process_answer,
+        const MPI_Comm comm)
+      {
+        if (job_supports_mpi() == false || n_mpi_processes(comm) == 1)
+          return selector<RequestType, AnswerType>(
+            targets, create_request, answer_request, process_answer, comm);
+
+        Assert(has_unique_elements(targets),
+               ExcMessage("The consensus algorithms expect that each process "
+                          "only sends a single message to another process, "
+                          "but the targets provided include duplicates."));
+
+        const unsigned int        my_rank = this_mpi_process(comm);
+        std::vector<unsigned int> requesting_processes;
+
+        try
+          {
+            const internal::NodeLayout layout(comm);
+
+            std::vector<internal::RoutedMessage> requests;
+            requests.reserve(targets.size());
+            for (const unsigned int target : targets)
+              requests.emplace_back(
+                std::make_pair(my_rank, target),
+                Utilities::pack(create_request(target), false));
+
+            std::vector<internal::RoutedMessage> answers;
+            for (const auto &request :
+                 internal::route_through_node_leaders(layout,
+                                                      std::move(requests),
+                                                      comm))
+              {
+                const unsigned int source = request.first.first;
+                requesting_processes.push_back(source);
+                answers.emplace_back(
+                  std::make_pair(my_rank, source),
+                  Utilities::pack(
+                    answer_request(source,
+                                   Utilities::unpack<RequestType>(
+                                     request.second, false)),
+                    false));
+              }
+
+            for (const auto &answer :
+                 internal::route_through_node_leaders(layout,
+                                                      std::move(answers),
+                                                      comm))
+              process_answer(answer.first.first,
+                             Utilities::unpack<AnswerType>(answer.second,
+                                                           false));
+          }
+        catch (...)
+          {
+            handle_exception(std::current_exception(), comm);
+          }
+
+        std::sort(requesting_processes.begin(), requesting_processes.end());
+        return requesting_processes;
+      }
+
+
+
+      template <typename RequestType>
+      std::vector<unsigned int>
+      hierarchical(
+        const std::vector<unsigned int>                      &targets,
+        const std::function<RequestType(const unsigned int)> &create_request,
+        const std::function<void(const unsigned int, const RequestType &)>
+                      &process_request,
+        const MPI_Comm comm)
+      {
+        if (job_supports_mpi() == false || n_mpi_processes(comm) == 1)
+          return selector<RequestType>(targets,
+                                       create_request,
+                                       process_request,
+                                       comm);
+
+        Assert(has_unique_elements(targets),
+               ExcMessage("The consensus algorithms expect that each process "
+                          "only sends a single message to another process, "
+                          "but the targets provided include duplicates."));
+
+        const unsigned int        my_rank = this_mpi_process(comm);
+        std::vector<unsigned int> requesting_processes;
+
+        try
+          {
+            const internal::NodeLayout layout(comm);
+
+            std::vector<internal::RoutedMessage> requests;
+            requests.reserve(targets.size());
+            for (const unsigned int target : targets)
+              requests.emplace_back(
+                std::make_pair(my_rank, target),
+                Utilities::pack(create_request(target), false));
+
+            for (const auto &request :
+                 internal::route_through_node_leaders(layout,
+                                                      std::move(requests),
+                                                      comm))
+              {
+                requesting_processes.push_back(request.first.first);
+                process_request(request.first.first,
+                                Utilities::unpack<RequestType>(request.second,
+                                                               false));
+              }
+          }
+        catch (...)
+          {
+            handle_exception(std::current_exception(), comm);
+          }
+
+        std::sort(requesting_processes.begin(), requesting_processes.end());
+        return requesting_processes;
+      }
+
+
     } // namespace ConsensusAlgorithms
   }   // end of namespace MPI
 } // end of namespace Utilities
@@ -69,7 +69,8 @@ namespace Utilities
           const double       tolerance                              = 1e-6,
           const bool         enforce_unique_mapping                 = false,
           const unsigned int rtree_level                            = 0,
-          const std::function<std::vector<bool>()> &marked_vertices = {});
+          const std::function<std::vector<bool>()> &marked_vertices = {},
+          const bool reuse_point_locations                          = false);
 
         /**
          * Tolerance in terms of unit cell coordinates for determining all cells
@@ -97,6 +98,36 @@ namespace Utilities
          * around point more efficient.
          */
         std::function<std::vector<bool>()> marked_vertices;
+
+        /**
+         * Keep the cells found for the points passed to reinit() and, in
+         * the next call to reinit() with the same number of points, only
+         * search the points again that are not inside any of their previous
+         * cells any more.
+         *
+         * For points that move only slowly, e.g., particles that are
+         * advected with a small time step, most points stay in their cells
+         * and the expensive collective search for the owning processes and
+         * cells, which is based on bounding boxes, can be skipped for them.
+         * Instead, the new positions are sent to the processes that own the
+         * previous cells of the points, which check if the points are still
+         * inside these cells (within the given @p tolerance) and update the
+         * reference positions of the points. Only the points that left all
+         * their previous cells, and the points that have not been found
+         * before, are searched as in a full reinit().
+         *
+         * This requires that the i-th point passed to subsequent calls to
+         * reinit() describes the same physical entity. The information is
+         * discarded when the triangulation changes.
+         *
+         * @note A point that is found in several cells, e.g., because it
+         *   is positioned on a vertex, is only kept in the cells it is
+         *   still inside of after it has moved, and no new cells are added
+         *   for it as long as it is inside at least one of them. Thus, the
+         *   set of cells found for a point might differ from the one found
+         *   by a full search.
+         */
+        bool reuse_point_locations;
       };
 
       /**
@@ -163,6 +194,10 @@ namespace Utilities
        *
        * @note If you want to be sure that all points have been found, call
        *   all_points_found() after calling this function.
+       *
+       * @note If AdditionalData::reuse_point_locations is set, only the
+       *   points that have left their cells since the last call to this
+       *   function are searched again.
        */
       void
       reinit(const GridTools::Cache<dim, spacedim> &cache,
@@ -418,11 +453,29 @@ namespace Utilities
 
 
     private:
+      /**
+       * Update the point locations stored in @p point_locations for the new
+       * positions @p points and search the points that have left their
+       * cells, see AdditionalData::reuse_point_locations.
+       */
+      void
+      update_point_locations(const GridTools::Cache<dim, spacedim> &cache,
+                             const std::vector<Point<spacedim>>    &points);
+
       /**
        * Additional data with basic settings.
        */
       const AdditionalData additional_data;
 
+      /**
+       * The result of the last search for the points passed to reinit(), if
+       * AdditionalData::reuse_point_locations is set.
+       */
+      std::unique_ptr<
+        GridTools::internal::DistributedComputePointLocationsInternal<dim,
+                                                                      spacedim>>
+        point_locations;
+
       /**
        * Storage for the status of the triangulation signal.
        */
@@ -117,6 +117,10 @@ namespace Utilities
           scalapack_copy_to2,
           /// ScaLAPACKMatrix<NumberType>::copy_from
           scalapack_copy_from,
+          /// ScaLAPACKMatrix<NumberType>::copy_from for distributed vectors
+          scalapack_copy_from_vectors,
+          /// ScaLAPACKMatrix<NumberType>::copy_to for distributed vectors
+          scalapack_copy_to_vectors,
 
           /// ProcessGrid::ProcessGrid
           process_grid_constructor,
@@ -146,6 +150,9 @@ namespace Utilities
 
           // GridTools::internal::distributed_compute_point_locations
           distributed_compute_point_locations,
+
+          // DataOutInterface::write_vtu_in_parallel() with aggregation
+          data_out_aggregate_vtu_pieces,
         };
       } // namespace Tags
     }   // namespace internal
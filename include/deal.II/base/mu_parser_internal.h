@@ -125,6 +125,12 @@ namespace internal
      */
     struct ParserData
     {
+      /**
+       * The number of points evaluated at once by
+       * ParserImplementation::do_value_list().
+       */
+      static constexpr unsigned int bulk_size = 64;
+
       /**
        * Default constructor. Threads::ThreadLocalStorage requires that objects
        * be either default- or copy-constructible: make sure we satisfy the
@@ -151,8 +157,38 @@ namespace internal
        * The actual muParser parser objects (hidden with PIMPL).
        */
       std::vector<std::unique_ptr<muParserBase>> parsers;
+
+      /**
+       * Scratch array used to set the independent variables of a batch of up
+       * to #bulk_size points in do_value_list(). The values of the variable
+       * with index @p i are stored contiguously, starting at
+       * <code>i*bulk_size</code>.
+       */
+      std::vector<double> bulk_vars;
+
+      /**
+       * Scratch array holding the operand stack of a CompiledExpression, with
+       * #bulk_size values per stack entry.
+       */
+      std::vector<double> bulk_stack;
     };
 
+    /**
+     * A mathematical expression translated into a program for a simple stack
+     * machine, each instruction of which operates on a whole batch of points
+     * at once. Compared to muParser, which interprets its bytecode one point
+     * at a time, this amortizes the dispatch of the instructions over many
+     * points and lets the compiler vectorize the arithmetic operations.
+     *
+     * Only the common subset of the syntax understood by muParser is
+     * supported, namely numbers, variables and constants, the arithmetic,
+     * comparison, and logical operators, the ternary operator, and the
+     * deterministic functions FunctionParser defines. Expressions using
+     * anything else, e.g. random numbers, are evaluated by muParser. The
+     * results agree with the ones of muParser up to round-off.
+     */
+    class CompiledExpression;
+
     template <int dim, typename Number>
     class ParserImplementation
     {
@@ -195,6 +231,25 @@ namespace internal
                     const double       time,
                     ArrayView<Number> &values) const;
 
+      /**
+       * Compute the values of the components
+       * <code>[first_component, first_component+n_components)</code> at all
+       * of the given points, and store the value of component
+       * <code>first_component+c</code> at point @p q in
+       * <code>values[c*points.size()+q]</code>.
+       *
+       * In contrast to calling do_value() for each point, this function
+       * evaluates the expressions, if possible, through a CompiledExpression
+       * for batches of ParserData::bulk_size points at once, which is
+       * considerably faster for the typical case of many quadrature points.
+       */
+      void
+      do_value_list(const ArrayView<const Point<dim>> &points,
+                    const double                       time,
+                    const unsigned int                 first_component,
+                    const unsigned int                 n_components,
+                    const ArrayView<Number>           &values) const;
+
       /**
        * An array of function expressions (one per component), required to
        * initialize tfp in each thread.
@@ -209,6 +264,15 @@ namespace internal
       mutable Threads::ThreadLocalStorage<internal::FunctionParser::ParserData>
         parser_data;
 
+      /**
+       * The expressions translated for evaluation in batches, one per
+       * component, or a null pointer for the expressions that use features
+       * not supported by CompiledExpression. Since the compiled expressions
+       * do not hold any mutable state, they are shared between all threads.
+       */
+      std::vector<std::shared_ptr<const CompiledExpression>>
+        compiled_expressions;
+
       /**
        * An array to keep track of all the constants, required to initialize fp
        * in each thread.
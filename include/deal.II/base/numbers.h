@@ -124,6 +124,10 @@ namespace internal
       8;
 #elif DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 128 && defined(__SSE2__)
       4;
+#elif DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 512 && defined(__ARM_FEATURE_SVE)
+      16;
+#elif DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 256 && defined(__ARM_FEATURE_SVE)
+      8;
 #elif DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 128 && defined(__ARM_NEON)
       4;
 #else
@@ -189,6 +193,10 @@ namespace std
   pow(const ::dealii::VectorizedArray<Number, width> &, const Number p);
   template <typename Number, size_t width>
   ::dealii::VectorizedArray<Number, width>
+  pow(const ::dealii::VectorizedArray<Number, width> &,
+      const ::dealii::VectorizedArray<Number, width> &);
+  template <typename Number, size_t width>
+  ::dealii::VectorizedArray<Number, width>
   sin(const ::dealii::VectorizedArray<Number, width> &);
   template <typename Number, size_t width>
   ::dealii::VectorizedArray<Number, width>
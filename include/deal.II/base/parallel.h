@@ -19,6 +19,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/mutex.h>
 #include <deal.II/base/synchronous_iterator.h>
 #include <deal.II/base/template_constraints.h>
@@ -37,6 +38,12 @@
 #  include <boost/range/iterator_range.hpp>
 #endif
 
+#if !defined(DEAL_II_WITH_TBB) && defined(DEAL_II_WITH_TASKFLOW)
+#  include <taskflow/taskflow.hpp>
+#endif
+
+#include <algorithm>
+
 #ifdef DEAL_II_HAVE_CXX20
 #  include <concepts>
 #endif
@@ -123,6 +130,52 @@ namespace parallel
       functor(boost::iterator_range<Iterator>(x_begin, x_end));
     }
 
+#  ifdef DEAL_II_WITH_TASKFLOW
+    /**
+     * Split the range <tt>[begin,end)</tt> into chunks of at least
+     * @p grainsize elements and call @p f on each of them, using the
+     * persistent thread pool of the taskflow executor returned by
+     * MultithreadInfo::get_taskflow_executor(). The number of chunks is
+     * bounded by a small multiple of the number of threads, so that the
+     * scheduling overhead stays small compared to the work done. If this
+     * function is called from within a task of the executor, the calling
+     * thread works on the chunks as well rather than blocking the worker.
+     */
+    template <typename Iterator, typename Function>
+    void
+    taskflow_apply_to_subranges(const Iterator    &begin,
+                                const Iterator    &end,
+                                const Function    &f,
+                                const unsigned int grainsize)
+    {
+      const std::size_t n_elements = end - begin;
+      const std::size_t n_threads  = MultithreadInfo::n_threads();
+      const std::size_t chunk_size =
+        std::max<std::size_t>(std::max(grainsize, 1U),
+                              (n_elements + 4 * n_threads - 1) /
+                                (4 * n_threads));
+      if (n_threads == 1 || n_elements <= chunk_size)
+        {
+          f(begin, end);
+          return;
+        }
+
+      tf::Executor &executor = MultithreadInfo::get_taskflow_executor();
+      tf::Taskflow  taskflow;
+      for (std::size_t chunk_begin = 0; chunk_begin < n_elements;
+           chunk_begin += chunk_size)
+        taskflow.emplace([&begin, &f, chunk_begin, chunk_size, n_elements]() {
+          f(begin + chunk_begin,
+            begin + std::min(chunk_begin + chunk_size, n_elements));
+        });
+
+      if (executor.this_worker_id() >= 0)
+        executor.corun(taskflow);
+      else
+        executor.run(taskflow).wait();
+    }
+#  endif
+
 #endif
   } // namespace internal
 
@@ -454,7 +507,9 @@ namespace parallel
                           const Function                             &f,
                           const unsigned int                          grainsize)
   {
-#ifndef DEAL_II_WITH_TBB
+#if !defined(DEAL_II_WITH_TBB) && defined(DEAL_II_WITH_TASKFLOW)
+    internal::taskflow_apply_to_subranges(begin, end, f, grainsize);
+#elif !defined(DEAL_II_WITH_TBB)
     // make sure we don't get compiler
     // warnings about unused arguments
     (void)grainsize;
@@ -745,7 +800,15 @@ namespace parallel
     const std::size_t end,
     const std::size_t minimum_parallel_grain_size) const
   {
-#ifndef DEAL_II_WITH_TBB
+#if !defined(DEAL_II_WITH_TBB) && defined(DEAL_II_WITH_TASKFLOW)
+    internal::taskflow_apply_to_subranges(
+      begin,
+      end,
+      [this](const std::size_t range_begin, const std::size_t range_end) {
+        apply_to_subrange(range_begin, range_end);
+      },
+      minimum_parallel_grain_size);
+#elif !defined(DEAL_II_WITH_TBB)
     // make sure we don't get compiler
     // warnings about unused arguments
     (void)minimum_parallel_grain_size;
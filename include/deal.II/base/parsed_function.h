@@ -199,6 +199,25 @@ namespace Functions
     virtual double
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    /**
+     * Return the values of the function at the given points. This calls
+     * FunctionParser::value_list(), which evaluates the expression for
+     * batches of points at once.
+     */
+    virtual void
+    value_list(const std::vector<Point<dim>> &points,
+               std::vector<double>           &values,
+               const unsigned int             component = 0) const override;
+
+    /**
+     * Return the values of all components of the function at the given
+     * points. This calls FunctionParser::vector_value_list(), which evaluates
+     * the expressions for batches of points at once.
+     */
+    virtual void
+    vector_value_list(const std::vector<Point<dim>> &points,
+                      std::vector<Vector<double>>   &values) const override;
+
     /**
      * Set the time to a specific value for time-dependent functions.
      *
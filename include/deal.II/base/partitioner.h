@@ -336,6 +336,20 @@ namespace Utilities
       unsigned int
       global_to_local(const types::global_dof_index global_index) const;
 
+      /**
+       * Compute the local indices of all the global indices in
+       * @p global_indices and write them into @p local_indices, which needs
+       * to be of the same length. The result is the same as the one of
+       * calling the function above for every index, but if the global
+       * indices are sorted in ascending order, the positions of the ghost
+       * indices are found by walking through the intervals of the ghost
+       * index set once rather than by a binary search for every index.
+       */
+      void
+      global_to_local(
+        const ArrayView<const types::global_dof_index> &global_indices,
+        const ArrayView<unsigned int>                  &local_indices) const;
+
       /**
        * Return the global index corresponding to the given local index.
        *
@@ -479,6 +493,38 @@ namespace Utilities
       bool
       ghost_indices_initialized() const;
 
+      /**
+       * Enable or disable the use of persistent MPI requests in
+       * export_to_ghosted_array_start() and
+       * import_from_ghosted_array_start(). When enabled, the send and receive
+       * requests for a given pair of temporary and ghost arrays are created
+       * with `MPI_Send_init()` and `MPI_Recv_init()` the first time the
+       * arrays are used, and are only restarted with `MPI_Start()` in
+       * subsequent exchanges. This saves the setup cost of the requests in
+       * the MPI library, which is noticeable for iterative solvers that
+       * exchange few ghost entries with many neighbors in every iteration.
+       * Since the vectors of type LinearAlgebra::distributed::Vector keep
+       * their buffers for their lifetime, the requests are typically created
+       * once per vector and direction. The number of cached buffer pairs is
+       * limited; exchanges for further buffers fall back to ordinary
+       * non-blocking communication.
+       *
+       * The requests stay attached to the addresses of the buffers, so this
+       * option should only be enabled if arrays are not deallocated and
+       * re-allocated at the same address with different content during the
+       * lifetime of the partitioner, which is the case for the buffers of
+       * LinearAlgebra::distributed::Vector. The cache is cleared whenever the
+       * index sets of this class change or when this option is disabled
+       * again, which must not happen while a data exchange is ongoing.
+       *
+       * The function is `const` because partitioners are usually shared
+       * among vectors through `std::shared_ptr<const Partitioner>`; the
+       * setting only affects how the communication is performed, not its
+       * result. Without MPI, this function has no effect.
+       */
+      void
+      set_use_persistent_requests(const bool use_persistent_requests) const;
+
 #ifdef DEAL_II_WITH_MPI
       /**
        * Start the exportation of the data in a locally owned array to the
@@ -674,6 +720,92 @@ namespace Utilities
       void
       initialize_import_indices_plain_dev() const;
 
+#ifdef DEAL_II_WITH_MPI
+      /**
+       * Return the persistent requests for an exchange between the given
+       * send and receive buffers with entries of size @p size_of_number and
+       * the MPI tag @p mpi_tag, creating them if they do not exist yet. The
+       * receive requests come first, followed by the send requests, in the
+       * order of ghost_targets_data and import_targets_data for an export
+       * (@p is_export equal to true), and vice versa for an import. Return a
+       * null pointer if persistent requests are disabled or the cache is
+       * full.
+       */
+      std::vector<MPI_Request> *
+      get_persistent_requests(const void        *send_buffer,
+                              const void        *receive_buffer,
+                              const std::size_t  size_of_number,
+                              const unsigned int mpi_tag,
+                              const bool         is_export) const;
+
+      /**
+       * A cache of persistent MPI requests, see
+       * set_use_persistent_requests(). Since the requests refer to the
+       * buffers of the object they were created for, copies of this class
+       * start with an empty cache. The requests are freed in the destructor.
+       */
+      class PersistentRequestCache
+      {
+      public:
+        /**
+         * The requests for one pair of buffers.
+         */
+        struct Entry
+        {
+          const void              *send_buffer;
+          const void              *receive_buffer;
+          std::size_t              size_of_number;
+          unsigned int             mpi_tag;
+          std::vector<MPI_Request> requests;
+        };
+
+        /**
+         * Default constructor.
+         */
+        PersistentRequestCache() = default;
+
+        /**
+         * Copy constructor, creating an empty cache.
+         */
+        PersistentRequestCache(const PersistentRequestCache &);
+
+        /**
+         * Copy assignment, clearing the cache.
+         */
+        PersistentRequestCache &
+        operator=(const PersistentRequestCache &);
+
+        /**
+         * Destructor.
+         */
+        ~PersistentRequestCache();
+
+        /**
+         * Free all requests and empty the cache.
+         */
+        void
+        clear();
+
+        /**
+         * The cached requests.
+         */
+        std::vector<Entry> entries;
+      };
+
+      /**
+       * The cache of persistent requests. The variable is mutable because
+       * the requests are created lazily in the const data exchange
+       * functions.
+       */
+      mutable PersistentRequestCache persistent_request_cache;
+#endif
+
+      /**
+       * A flag indicating whether persistent MPI requests should be used, see
+       * set_use_persistent_requests().
+       */
+      mutable bool use_persistent_requests = false;
+
       /**
        * The global size of the vector over all processors
        */
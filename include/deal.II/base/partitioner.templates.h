@@ -87,8 +87,26 @@ namespace Utilities
                            n_ghost_indices() :
                          ghost_array.data();
 
+      // in case persistent requests are enabled, look up (or create) the
+      // requests for the given pair of buffers, see
+      // set_use_persistent_requests()
+      std::vector<MPI_Request> *persistent_requests =
+        get_persistent_requests(temporary_storage.data(),
+                                ghost_array_ptr,
+                                sizeof(Number),
+                                mpi_tag,
+                                true);
+
       for (unsigned int i = 0; i < n_ghost_targets; ++i)
         {
+          if (persistent_requests != nullptr)
+            {
+              const int ierr = MPI_Start(&(*persistent_requests)[i]);
+              AssertThrowMPI(ierr);
+              requests[i] = (*persistent_requests)[i];
+              continue;
+            }
+
           // allow writing into ghost indices even though we are in a
           // const function
           const int ierr =
@@ -163,15 +181,26 @@ namespace Utilities
             }
 
           // start the send operations
-          const int ierr =
-            MPI_Isend(temp_array_ptr,
-                      import_targets_data[i].second * sizeof(Number),
-                      MPI_BYTE,
-                      import_targets_data[i].first,
-                      mpi_tag,
-                      communicator,
-                      &requests[n_ghost_targets + i]);
-          AssertThrowMPI(ierr);
+          if (persistent_requests != nullptr)
+            {
+              const int ierr =
+                MPI_Start(&(*persistent_requests)[n_ghost_targets + i]);
+              AssertThrowMPI(ierr);
+              requests[n_ghost_targets + i] =
+                (*persistent_requests)[n_ghost_targets + i];
+            }
+          else
+            {
+              const int ierr =
+                MPI_Isend(temp_array_ptr,
+                          import_targets_data[i].second * sizeof(Number),
+                          MPI_BYTE,
+                          import_targets_data[i].first,
+                          mpi_tag,
+                          communicator,
+                          &requests[n_ghost_targets + i]);
+              AssertThrowMPI(ierr);
+            }
           temp_array_ptr += import_targets_data[i].second;
         }
     }
@@ -339,6 +368,16 @@ namespace Utilities
              ExcInternalError());
       requests.resize(n_import_targets + n_ghost_targets);
 
+      // in case persistent requests are enabled, look up (or create) the
+      // requests for the given pair of buffers, see
+      // set_use_persistent_requests()
+      std::vector<MPI_Request> *persistent_requests =
+        get_persistent_requests(ghost_array.data(),
+                                temporary_storage.data(),
+                                sizeof(Number),
+                                mpi_tag,
+                                false);
+
       // initiate the receive operations
       Number *temp_array_ptr = temporary_storage.data();
       for (unsigned int i = 0; i < n_import_targets; ++i)
@@ -350,6 +389,14 @@ namespace Utilities
             ExcMessage("Index overflow: Maximum message size in MPI is 2GB. "
                        "The number of ghost entries times the size of 'Number' "
                        "exceeds this value. This is not supported."));
+          if (persistent_requests != nullptr)
+            {
+              const int ierr = MPI_Start(&(*persistent_requests)[i]);
+              AssertThrowMPI(ierr);
+              requests[i] = (*persistent_requests)[i];
+              continue;
+            }
+
           const int ierr =
             MPI_Irecv(temp_array_ptr,
                       import_targets_data[i].second * sizeof(Number),
@@ -449,15 +496,26 @@ namespace Utilities
                        "exceeds this value. This is not supported."));
           if (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
             Kokkos::fence();
-          const int ierr =
-            MPI_Isend(ghost_array_ptr,
-                      ghost_targets_data[i].second * sizeof(Number),
-                      MPI_BYTE,
-                      ghost_targets_data[i].first,
-                      mpi_tag,
-                      communicator,
-                      &requests[n_import_targets + i]);
-          AssertThrowMPI(ierr);
+          if (persistent_requests != nullptr)
+            {
+              const int ierr =
+                MPI_Start(&(*persistent_requests)[n_import_targets + i]);
+              AssertThrowMPI(ierr);
+              requests[n_import_targets + i] =
+                (*persistent_requests)[n_import_targets + i];
+            }
+          else
+            {
+              const int ierr =
+                MPI_Isend(ghost_array_ptr,
+                          ghost_targets_data[i].second * sizeof(Number),
+                          MPI_BYTE,
+                          ghost_targets_data[i].first,
+                          mpi_tag,
+                          communicator,
+                          &requests[n_import_targets + i]);
+              AssertThrowMPI(ierr);
+            }
 
           ghost_array_ptr += ghost_targets_data[i].second;
         }
@@ -184,6 +184,19 @@ public:
   Number
   value(const Point<dim> &point) const;
 
+  /**
+   * Evaluate the polynomial at a point given by the powers of its barycentric
+   * coordinates: <tt>powers(d, k)</tt> must hold the <tt>k</tt>th power of
+   * the <tt>d</tt>th barycentric coordinate, for all exponents up to the ones
+   * returned by degrees(). Since the powers need to be computed only once for
+   * all polynomials of a space, and since @p Number2 may be a VectorizedArray
+   * holding several points at once, this is considerably faster than the
+   * function above when evaluating many polynomials at many points.
+   */
+  template <typename Number2>
+  Number2
+  value(const Table<2, Number2> &powers) const;
+
   /**
    * Return an estimate, in bytes, of the memory usage of the object.
    */
@@ -275,6 +288,23 @@ public:
            std::vector<Tensor<3, dim>> &third_derivatives,
            std::vector<Tensor<4, dim>> &fourth_derivatives) const override;
 
+  /**
+   * @copydoc ScalarPolynomialsBase::evaluate_at_points()
+   *
+   * This function evaluates as many points at once as fit into a
+   * VectorizedArray<double>, and computes the powers of the barycentric
+   * coordinates of each point only once for all polynomials and their
+   * derivatives.
+   */
+  void
+  evaluate_at_points(
+    const ArrayView<const Point<dim>> &unit_points,
+    Table<2, double>                  &values,
+    Table<2, Tensor<1, dim>>          &grads,
+    Table<2, Tensor<2, dim>>          &grad_grads,
+    Table<2, Tensor<3, dim>>          &third_derivatives,
+    Table<2, Tensor<4, dim>>          &fourth_derivatives) const override;
+
   /**
    * @copydoc ScalarPolynomialsBase::compute_value()
    */
@@ -696,6 +726,35 @@ BarycentricPolynomial<dim, Number>::value(const Point<dim> &point) const
 
 
 
+template <int dim, typename Number>
+template <typename Number2>
+Number2
+BarycentricPolynomial<dim, Number>::value(const Table<2, Number2> &powers) const
+{
+  AssertDimension(powers.n_rows(), dim + 1);
+  Number2 result = Number2(0.);
+
+  for (std::size_t i = 0; i < coefficients.n_elements(); ++i)
+    {
+      const auto indices = index_to_indices(i, coefficients.size());
+      const auto coef    = coefficients(indices);
+      if (coef == Number())
+        continue;
+
+      Number2 temp = powers(0, indices[0]);
+      for (unsigned int d = 1; d < dim + 1; ++d)
+        {
+          AssertIndexRange(indices[d], powers.n_cols());
+          temp *= powers(d, indices[d]);
+        }
+      result += coef * temp;
+    }
+
+  return result;
+}
+
+
+
 template <int dim, typename Number>
 std::size_t
 BarycentricPolynomial<dim, Number>::memory_consumption() const
@@ -17,8 +17,11 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/aligned_vector.h>
 #include <deal.II/base/enable_observer_pointer.h>
 #include <deal.II/base/quadrature.h>
+#include <deal.II/base/symmetric_tensor.h>
+#include <deal.II/base/tensor.h>
 
 #include <deal.II/distributed/tria.h>
 
@@ -28,8 +31,10 @@
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_accessor.h>
 
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/vector.h>
 
+#include <functional>
 #include <map>
 #include <optional>
 #include <type_traits>
@@ -37,6 +42,12 @@
 
 DEAL_II_NAMESPACE_OPEN
 
+// Forward declaration
+#ifndef DOXYGEN
+template <int dim, typename Number, typename VectorizedArrayType>
+class MatrixFree;
+#endif
+
 /**
  * @addtogroup Quadrature
  * @{
@@ -254,6 +265,244 @@ private:
 };
 
 
+/**
+ * A class for storing data at the quadrature points of all cells of a
+ * MatrixFree object, to be used in matrix-free operator evaluation, e.g., for
+ * the history variables of a plasticity model.
+ *
+ * In contrast to CellDataStorage, which stores a vector of objects of a
+ * user-defined type for each cell and retrieves them by a lookup of a map,
+ * this class stores a fixed number of scalar components per quadrature point
+ * in one contiguous array of VectorizedArray objects. The data is organized
+ * by the cell batches of the MatrixFree object, i.e., the lanes of the
+ * VectorizedArray objects hold the data of the cells of a batch, such that
+ * the data can be read and written at the quadrature points of an
+ * FEEvaluation object without any indirection:
+ * @code
+ *   constexpr unsigned int n_strain_components =
+ *     SymmetricTensor<2, dim>::n_independent_components;
+ *
+ *   VectorizedCellDataStorage<VectorizedArray<double>> history;
+ *   history.reinit(matrix_free, n_strain_components + 1);
+ *   ...
+ *   for (unsigned int cell = range.first; cell < range.second; ++cell)
+ *     {
+ *       phi.reinit(cell);
+ *       ...
+ *       for (const unsigned int q : phi.quadrature_point_indices())
+ *         {
+ *           SymmetricTensor<2, dim, VectorizedArray<double>> plastic_strain =
+ *             history.get_symmetric_tensor<dim>(cell, q, 0);
+ *           VectorizedArray<double> &hardening =
+ *             history(cell, q, n_strain_components);
+ *           ...
+ *         }
+ *     }
+ * @endcode
+ * The components of a quadrature point are stored next to each other, and
+ * the quadrature points of a cell batch follow each other, so that the loop
+ * over the quadrature points of a cell batch accesses the memory linearly.
+ *
+ * The data of a single cell can be accessed via pack_cell_data() and
+ * unpack_cell_data(), which use the same format as the functions used by
+ * parallel::distributed::ContinuousQuadratureDataTransfer, which can also
+ * transfer the data of this class during adaptive mesh refinement.
+ *
+ * @tparam VectorizedArrayType The type of the stored data, which needs to
+ * match the VectorizedArrayType of the MatrixFree object.
+ */
+template <typename VectorizedArrayType>
+class VectorizedCellDataStorage : public EnableObserverPointer
+{
+public:
+  /**
+   * The scalar number type of the data.
+   */
+  using Number = typename VectorizedArrayType::value_type;
+
+  /**
+   * Default constructor.
+   */
+  VectorizedCellDataStorage() = default;
+
+  /**
+   * Set up the storage for @p n_components scalar values at each quadrature
+   * point of the quadrature formula with index @p quad_index of
+   * @p matrix_free, for all cell batches of @p matrix_free, and set all values
+   * to @p initial_value. The previous content of this object is discarded.
+   *
+   * @pre @p matrix_free needs to be set up for the active cells, and the
+   * number of quadrature points must be the same on all cells.
+   */
+  template <int dim, typename Number2>
+  void
+  reinit(const MatrixFree<dim, Number2, VectorizedArrayType> &matrix_free,
+         const unsigned int                                   n_components,
+         const unsigned int                                   quad_index = 0,
+         const Number initial_value = Number());
+
+  /**
+   * Release all memory.
+   */
+  void
+  clear();
+
+  /**
+   * Return the number of cell batches.
+   */
+  unsigned int
+  n_cell_batches() const;
+
+  /**
+   * Return the number of quadrature points per cell.
+   */
+  unsigned int
+  n_q_points() const;
+
+  /**
+   * Return the number of scalar components stored per quadrature point.
+   */
+  unsigned int
+  n_components() const;
+
+  /**
+   * Return a reference to the data of the given component at a quadrature
+   * point of a cell batch.
+   */
+  VectorizedArrayType &
+  operator()(const unsigned int cell_batch_index,
+             const unsigned int q_point,
+             const unsigned int component);
+
+  /**
+   * Return a read-only reference to the data of the given component at a
+   * quadrature point of a cell batch.
+   */
+  const VectorizedArrayType &
+  operator()(const unsigned int cell_batch_index,
+             const unsigned int q_point,
+             const unsigned int component) const;
+
+  /**
+   * Return a pointer to the data of all components at a quadrature point of
+   * a cell batch, which are stored contiguously.
+   */
+  VectorizedArrayType *
+  begin(const unsigned int cell_batch_index, const unsigned int q_point);
+
+  /**
+   * Return a read-only pointer to the data of all components at a quadrature
+   * point of a cell batch, which are stored contiguously.
+   */
+  const VectorizedArrayType *
+  begin(const unsigned int cell_batch_index, const unsigned int q_point) const;
+
+  /**
+   * Return the tensor formed by the components starting at
+   * @p first_component at a quadrature point of a cell batch, in the order
+   * given by Tensor::unrolled_to_component_indices().
+   */
+  template <int rank, int dim>
+  Tensor<rank, dim, VectorizedArrayType>
+  get_tensor(const unsigned int cell_batch_index,
+             const unsigned int q_point,
+             const unsigned int first_component) const;
+
+  /**
+   * Store the given tensor in the components starting at
+   * @p first_component at a quadrature point of a cell batch, in the order
+   * given by Tensor::unrolled_to_component_indices().
+   */
+  template <int rank, int dim>
+  void
+  set_tensor(const unsigned int                            cell_batch_index,
+             const unsigned int                            q_point,
+             const unsigned int                            first_component,
+             const Tensor<rank, dim, VectorizedArrayType> &value);
+
+  /**
+   * Return the symmetric tensor of rank two formed by the components
+   * starting at @p first_component at a quadrature point of a cell batch, in
+   * the order given by SymmetricTensor::unrolled_to_component_indices().
+   */
+  template <int dim>
+  SymmetricTensor<2, dim, VectorizedArrayType>
+  get_symmetric_tensor(const unsigned int cell_batch_index,
+                       const unsigned int q_point,
+                       const unsigned int first_component) const;
+
+  /**
+   * Store the given symmetric tensor of rank two in the components starting
+   * at @p first_component at a quadrature point of a cell batch, in the order
+   * given by SymmetricTensor::unrolled_to_component_indices().
+   */
+  template <int dim>
+  void
+  set_symmetric_tensor(
+    const unsigned int                                  cell_batch_index,
+    const unsigned int                                  q_point,
+    const unsigned int                                  first_component,
+    const SymmetricTensor<2, dim, VectorizedArrayType> &value);
+
+  /**
+   * Copy the data of the given active cell into @p matrix_data, whose rows
+   * correspond to the quadrature points and whose columns correspond to the
+   * components. If the cell is not part of the MatrixFree object this object
+   * was initialized with, @p matrix_data is set to an empty matrix.
+   */
+  template <typename CellIteratorType>
+  void
+  pack_cell_data(const CellIteratorType &cell,
+                 FullMatrix<double>     &matrix_data) const;
+
+  /**
+   * The opposite of pack_cell_data(): Set the data of the given active cell
+   * from @p matrix_data. Cells that are not part of the MatrixFree object this
+   * object was initialized with are ignored.
+   */
+  template <typename CellIteratorType>
+  void
+  unpack_cell_data(const CellIteratorType   &cell,
+                   const FullMatrix<double> &matrix_data);
+
+  /**
+   * Return an estimate of the memory consumption of this object in bytes.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Return the position of the data of a quadrature point of a cell batch
+   * in the array.
+   */
+  std::size_t
+  index(const unsigned int cell_batch_index, const unsigned int q_point) const;
+
+  /**
+   * The number of quadrature points per cell.
+   */
+  unsigned int n_q_points_per_cell = 0;
+
+  /**
+   * The number of components per quadrature point.
+   */
+  unsigned int n_components_per_point = 0;
+
+  /**
+   * The data of all cell batches.
+   */
+  AlignedVector<VectorizedArrayType> data;
+
+  /**
+   * The cell batch and the lane within the batch for each active cell,
+   * indexed by the active cell index, or numbers::invalid_unsigned_int for
+   * the cells not contained in the MatrixFree object.
+   */
+  std::vector<std::pair<unsigned int, unsigned int>> cell_to_batch_and_lane;
+};
+
+
 /**
  * An abstract class which specifies requirements for data on
  * a single quadrature point to be transferable during refinement or
@@ -478,6 +727,24 @@ namespace parallel
         parallel::distributed::Triangulation<dim>   &tria,
         CellDataStorage<CellIteratorType, DataType> &data_storage);
 
+      /**
+       * Same as above, but for the data stored in a VectorizedCellDataStorage
+       * object, which represents the values of DataType::number_of_values()
+       * components at each quadrature point. In this case, the @p DataType
+       * template argument of this class is not used and can be set to
+       * TransferableQuadraturePointData.
+       *
+       * @note Before calling interpolate(), the user is expected to call
+       * VectorizedCellDataStorage::reinit() on @p data_storage with a
+       * MatrixFree object set up for the new mesh, using the same quadrature
+       * formula and number of components.
+       */
+      template <typename VectorizedArrayType>
+      void
+      prepare_for_coarsening_and_refinement(
+        parallel::distributed::Triangulation<dim>       &tria,
+        VectorizedCellDataStorage<VectorizedArrayType> &data_storage);
+
       /**
        * Interpolate the data previously stored in this object before the mesh
        * was refined or coarsened onto the quadrature points of the currently
@@ -570,9 +837,19 @@ namespace parallel
       unsigned int handle;
 
       /**
-       * A pointer to the CellDataStorage class whose data will be transferred.
+       * A function that packs the data of a cell of the storage object whose
+       * data will be transferred into a matrix whose rows correspond to the
+       * quadrature points and whose columns correspond to the values stored
+       * at each quadrature point.
+       */
+      std::function<void(const CellIteratorType &, FullMatrix<double> &)>
+        pack_cell;
+
+      /**
+       * The opposite of @p pack_cell.
        */
-      CellDataStorage<CellIteratorType, DataType> *data_storage;
+      std::function<void(const CellIteratorType &, const FullMatrix<double> &)>
+        unpack_cell;
 
       /**
        * A pointer to the distributed triangulation to which cell data is
@@ -804,6 +1081,311 @@ CellDataStorage<CellIteratorType, DataType>::try_get_data(
     }
 }
 
+//--------------------------------------------------------------------
+//                    VectorizedCellDataStorage
+//--------------------------------------------------------------------
+
+template <typename VectorizedArrayType>
+template <int dim, typename Number2>
+inline void
+VectorizedCellDataStorage<VectorizedArrayType>::reinit(
+  const MatrixFree<dim, Number2, VectorizedArrayType> &matrix_free,
+  const unsigned int                                   n_components,
+  const unsigned int                                   quad_index,
+  const Number                                         initial_value)
+{
+  Assert(matrix_free.get_mg_level() == numbers::invalid_unsigned_int,
+         ExcMessage("VectorizedCellDataStorage can only be set up for "
+                    "MatrixFree objects on the active cells."));
+
+  n_q_points_per_cell    = matrix_free.get_n_q_points(quad_index);
+  n_components_per_point = n_components;
+
+  data.resize_fast(static_cast<std::size_t>(matrix_free.n_cell_batches()) *
+                   n_q_points_per_cell * n_components_per_point);
+  data.fill(VectorizedArrayType(initial_value));
+
+  cell_to_batch_and_lane.assign(
+    matrix_free.get_dof_handler().get_triangulation().n_active_cells(),
+    {numbers::invalid_unsigned_int, numbers::invalid_unsigned_int});
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      Assert(matrix_free.get_n_q_points(
+               quad_index,
+               matrix_free.get_cell_active_fe_index({cell, cell + 1})) ==
+               n_q_points_per_cell,
+             ExcMessage("The number of quadrature points must be the same "
+                        "on all cells."));
+      for (unsigned int lane = 0;
+           lane < matrix_free.n_active_entries_per_cell_batch(cell);
+           ++lane)
+        cell_to_batch_and_lane[matrix_free.get_cell_iterator(cell, lane)
+                                 ->active_cell_index()] = {cell, lane};
+    }
+}
+
+
+
+template <typename VectorizedArrayType>
+inline void
+VectorizedCellDataStorage<VectorizedArrayType>::clear()
+{
+  n_q_points_per_cell    = 0;
+  n_components_per_point = 0;
+  data.clear();
+  cell_to_batch_and_lane.clear();
+}
+
+
+
+template <typename VectorizedArrayType>
+inline unsigned int
+VectorizedCellDataStorage<VectorizedArrayType>::n_cell_batches() const
+{
+  return (n_q_points_per_cell * n_components_per_point > 0 ?
+            data.size() / (n_q_points_per_cell * n_components_per_point) :
+            0);
+}
+
+
+
+template <typename VectorizedArrayType>
+inline unsigned int
+VectorizedCellDataStorage<VectorizedArrayType>::n_q_points() const
+{
+  return n_q_points_per_cell;
+}
+
+
+
+template <typename VectorizedArrayType>
+inline unsigned int
+VectorizedCellDataStorage<VectorizedArrayType>::n_components() const
+{
+  return n_components_per_point;
+}
+
+
+
+template <typename VectorizedArrayType>
+inline std::size_t
+VectorizedCellDataStorage<VectorizedArrayType>::index(
+  const unsigned int cell_batch_index,
+  const unsigned int q_point) const
+{
+  AssertIndexRange(q_point, n_q_points_per_cell);
+  const std::size_t position =
+    (static_cast<std::size_t>(cell_batch_index) * n_q_points_per_cell +
+     q_point) *
+    n_components_per_point;
+  AssertIndexRange(position, data.size());
+  return position;
+}
+
+
+
+template <typename VectorizedArrayType>
+inline VectorizedArrayType &
+VectorizedCellDataStorage<VectorizedArrayType>::operator()(
+  const unsigned int cell_batch_index,
+  const unsigned int q_point,
+  const unsigned int component)
+{
+  AssertIndexRange(component, n_components_per_point);
+  return data[index(cell_batch_index, q_point) + component];
+}
+
+
+
+template <typename VectorizedArrayType>
+inline const VectorizedArrayType &
+VectorizedCellDataStorage<VectorizedArrayType>::operator()(
+  const unsigned int cell_batch_index,
+  const unsigned int q_point,
+  const unsigned int component) const
+{
+  AssertIndexRange(component, n_components_per_point);
+  return data[index(cell_batch_index, q_point) + component];
+}
+
+
+
+template <typename VectorizedArrayType>
+inline VectorizedArrayType *
+VectorizedCellDataStorage<VectorizedArrayType>::begin(
+  const unsigned int cell_batch_index,
+  const unsigned int q_point)
+{
+  return data.begin() + index(cell_batch_index, q_point);
+}
+
+
+
+template <typename VectorizedArrayType>
+inline const VectorizedArrayType *
+VectorizedCellDataStorage<VectorizedArrayType>::begin(
+  const unsigned int cell_batch_index,
+  const unsigned int q_point) const
+{
+  return data.begin() + index(cell_batch_index, q_point);
+}
+
+
+
+template <typename VectorizedArrayType>
+template <int rank, int dim>
+inline Tensor<rank, dim, VectorizedArrayType>
+VectorizedCellDataStorage<VectorizedArrayType>::get_tensor(
+  const unsigned int cell_batch_index,
+  const unsigned int q_point,
+  const unsigned int first_component) const
+{
+  constexpr unsigned int n_entries =
+    Tensor<rank, dim>::n_independent_components;
+  AssertIndexRange(first_component + n_entries, n_components_per_point + 1);
+
+  const VectorizedArrayType *values =
+    begin(cell_batch_index, q_point) + first_component;
+  Tensor<rank, dim, VectorizedArrayType> result;
+  for (unsigned int c = 0; c < n_entries; ++c)
+    result[Tensor<rank, dim>::unrolled_to_component_indices(c)] = values[c];
+  return result;
+}
+
+
+
+template <typename VectorizedArrayType>
+template <int rank, int dim>
+inline void
+VectorizedCellDataStorage<VectorizedArrayType>::set_tensor(
+  const unsigned int                            cell_batch_index,
+  const unsigned int                            q_point,
+  const unsigned int                            first_component,
+  const Tensor<rank, dim, VectorizedArrayType> &value)
+{
+  constexpr unsigned int n_entries =
+    Tensor<rank, dim>::n_independent_components;
+  AssertIndexRange(first_component + n_entries, n_components_per_point + 1);
+
+  VectorizedArrayType *values =
+    begin(cell_batch_index, q_point) + first_component;
+  for (unsigned int c = 0; c < n_entries; ++c)
+    values[c] = value[Tensor<rank, dim>::unrolled_to_component_indices(c)];
+}
+
+
+
+template <typename VectorizedArrayType>
+template <int dim>
+inline SymmetricTensor<2, dim, VectorizedArrayType>
+VectorizedCellDataStorage<VectorizedArrayType>::get_symmetric_tensor(
+  const unsigned int cell_batch_index,
+  const unsigned int q_point,
+  const unsigned int first_component) const
+{
+  constexpr unsigned int n_entries =
+    SymmetricTensor<2, dim>::n_independent_components;
+  AssertIndexRange(first_component + n_entries, n_components_per_point + 1);
+
+  const VectorizedArrayType *values =
+    begin(cell_batch_index, q_point) + first_component;
+  SymmetricTensor<2, dim, VectorizedArrayType> result;
+  for (unsigned int c = 0; c < n_entries; ++c)
+    result[SymmetricTensor<2, dim>::unrolled_to_component_indices(c)] =
+      values[c];
+  return result;
+}
+
+
+
+template <typename VectorizedArrayType>
+template <int dim>
+inline void
+VectorizedCellDataStorage<VectorizedArrayType>::set_symmetric_tensor(
+  const unsigned int                                  cell_batch_index,
+  const unsigned int                                  q_point,
+  const unsigned int                                  first_component,
+  const SymmetricTensor<2, dim, VectorizedArrayType> &value)
+{
+  constexpr unsigned int n_entries =
+    SymmetricTensor<2, dim>::n_independent_components;
+  AssertIndexRange(first_component + n_entries, n_components_per_point + 1);
+
+  VectorizedArrayType *values =
+    begin(cell_batch_index, q_point) + first_component;
+  for (unsigned int c = 0; c < n_entries; ++c)
+    values[c] =
+      value[SymmetricTensor<2, dim>::unrolled_to_component_indices(c)];
+}
+
+
+
+template <typename VectorizedArrayType>
+template <typename CellIteratorType>
+inline void
+VectorizedCellDataStorage<VectorizedArrayType>::pack_cell_data(
+  const CellIteratorType &cell,
+  FullMatrix<double>     &matrix_data) const
+{
+  const unsigned int active_cell_index = cell->active_cell_index();
+  if (active_cell_index >= cell_to_batch_and_lane.size() ||
+      cell_to_batch_and_lane[active_cell_index].first ==
+        numbers::invalid_unsigned_int)
+    {
+      matrix_data.reinit(0, 0);
+      return;
+    }
+
+  const auto [cell_batch_index, lane] =
+    cell_to_batch_and_lane[active_cell_index];
+  matrix_data.reinit(n_q_points_per_cell, n_components_per_point);
+  for (unsigned int q = 0; q < n_q_points_per_cell; ++q)
+    {
+      const VectorizedArrayType *values = begin(cell_batch_index, q);
+      for (unsigned int c = 0; c < n_components_per_point; ++c)
+        matrix_data(q, c) = values[c][lane];
+    }
+}
+
+
+
+template <typename VectorizedArrayType>
+template <typename CellIteratorType>
+inline void
+VectorizedCellDataStorage<VectorizedArrayType>::unpack_cell_data(
+  const CellIteratorType   &cell,
+  const FullMatrix<double> &matrix_data)
+{
+  const unsigned int active_cell_index = cell->active_cell_index();
+  if (active_cell_index >= cell_to_batch_and_lane.size() ||
+      cell_to_batch_and_lane[active_cell_index].first ==
+        numbers::invalid_unsigned_int)
+    return;
+
+  AssertDimension(matrix_data.m(), n_q_points_per_cell);
+  AssertDimension(matrix_data.n(), n_components_per_point);
+
+  const auto [cell_batch_index, lane] =
+    cell_to_batch_and_lane[active_cell_index];
+  for (unsigned int q = 0; q < n_q_points_per_cell; ++q)
+    {
+      VectorizedArrayType *values = begin(cell_batch_index, q);
+      for (unsigned int c = 0; c < n_components_per_point; ++c)
+        values[c][lane] = matrix_data(q, c);
+    }
+}
+
+
+
+template <typename VectorizedArrayType>
+inline std::size_t
+VectorizedCellDataStorage<VectorizedArrayType>::memory_consumption() const
+{
+  return sizeof(*this) + data.memory_consumption() +
+         MemoryConsumption::memory_consumption(cell_to_batch_and_lane);
+}
+
+
 //--------------------------------------------------------------------
 //                    ContinuousQuadratureDataTransfer
 //--------------------------------------------------------------------
@@ -898,7 +1480,6 @@ namespace parallel
       , project_to_fe_matrix(projection_fe->n_dofs_per_cell(), n_q_points)
       , project_to_qp_matrix(n_q_points, projection_fe->n_dofs_per_cell())
       , handle(numbers::invalid_unsigned_int)
-      , data_storage(nullptr)
       , triangulation(nullptr)
     {
       Assert(
@@ -925,10 +1506,50 @@ namespace parallel
         parallel::distributed::Triangulation<dim>   &tr_,
         CellDataStorage<CellIteratorType, DataType> &data_storage_)
     {
-      Assert(data_storage == nullptr,
-             ExcMessage("This function can be called only once"));
+      Assert(!pack_cell, ExcMessage("This function can be called only once"));
+      triangulation = &tr_;
+
+      pack_cell = [&data_storage_](const CellIteratorType &cell,
+                                   FullMatrix<double>     &matrix_data) {
+        pack_cell_data(cell, &data_storage_, matrix_data);
+      };
+
+      unpack_cell = [&data_storage_](const CellIteratorType   &cell,
+                                     const FullMatrix<double> &matrix_data) {
+        unpack_to_cell_data(cell, matrix_data, &data_storage_);
+      };
+
+      handle = triangulation->register_data_attach(
+        [this](const typename parallel::distributed::Triangulation<
+                 dim>::cell_iterator &cell,
+               const CellStatus       status) {
+          return this->pack_function(cell, status);
+        },
+        /*returns_variable_size_data=*/true);
+    }
+
+
+
+    template <int dim, typename DataType>
+    template <typename VectorizedArrayType>
+    inline void
+    ContinuousQuadratureDataTransfer<dim, DataType>::
+      prepare_for_coarsening_and_refinement(
+        parallel::distributed::Triangulation<dim>       &tr_,
+        VectorizedCellDataStorage<VectorizedArrayType> &data_storage_)
+    {
+      Assert(!pack_cell, ExcMessage("This function can be called only once"));
       triangulation = &tr_;
-      data_storage  = &data_storage_;
+
+      pack_cell = [&data_storage_](const CellIteratorType &cell,
+                                   FullMatrix<double>     &matrix_data) {
+        data_storage_.pack_cell_data(cell, matrix_data);
+      };
+
+      unpack_cell = [&data_storage_](const CellIteratorType   &cell,
+                                     const FullMatrix<double> &matrix_data) {
+        data_storage_.unpack_cell_data(cell, matrix_data);
+      };
 
       handle = triangulation->register_data_attach(
         [this](const typename parallel::distributed::Triangulation<
@@ -956,7 +1577,8 @@ namespace parallel
         });
 
       // invalidate the pointers
-      data_storage  = nullptr;
+      pack_cell     = nullptr;
+      unpack_cell   = nullptr;
       triangulation = nullptr;
     }
 
@@ -969,7 +1591,7 @@ namespace parallel
         &cell,
       const CellStatus /*status*/)
     {
-      pack_cell_data(cell, data_storage, matrix_quadrature);
+      pack_cell(cell, matrix_quadrature);
 
       // project to FE
       const unsigned int number_of_values = matrix_quadrature.n();
@@ -1023,10 +1645,8 @@ namespace parallel
                 project_to_qp_matrix.mmult(matrix_quadrature,
                                            matrix_dofs_child);
 
-                // finally, put back into the map:
-                unpack_to_cell_data(cell->child(child),
-                                    matrix_quadrature,
-                                    data_storage);
+                // finally, put back into the storage:
+                unpack_cell(cell->child(child), matrix_quadrature);
               }
         }
       else
@@ -1035,8 +1655,8 @@ namespace parallel
           // rhs_quadrature points.
           project_to_qp_matrix.mmult(matrix_quadrature, matrix_dofs);
 
-          // finally, put back into the map:
-          unpack_to_cell_data(cell, matrix_quadrature, data_storage);
+          // finally, put back into the storage:
+          unpack_cell(cell, matrix_quadrature);
         }
     }
 
@@ -18,8 +18,10 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/point.h>
+#include <deal.II/base/table.h>
 #include <deal.II/base/tensor.h>
 
 #include <memory>
@@ -105,6 +107,30 @@ public:
            std::vector<Tensor<3, dim>> &third_derivatives,
            std::vector<Tensor<4, dim>> &fourth_derivatives) const = 0;
 
+  /**
+   * Compute the values and the derivatives of all polynomials at all the
+   * given @p unit_points at once. The entry <tt>(i, q)</tt> of each of the
+   * output tables holds the respective quantity of the <tt>i</tt>th
+   * polynomial at the <tt>q</tt>th point.
+   *
+   * Each table must either be empty or of size <tt>n()</tt> times the number
+   * of points. In the first case, the function will not compute these
+   * values.
+   *
+   * The default implementation calls evaluate() once per point. Derived
+   * classes can override it to share work between points, e.g., by
+   * evaluating several points at once with vectorization, which is what
+   * FE_Poly::get_data() and MappingFE rely on when setting up their tables
+   * of shape functions.
+   */
+  virtual void
+  evaluate_at_points(const ArrayView<const Point<dim>> &unit_points,
+                     Table<2, double>                  &values,
+                     Table<2, Tensor<1, dim>>          &grads,
+                     Table<2, Tensor<2, dim>>          &grad_grads,
+                     Table<2, Tensor<3, dim>>          &third_derivatives,
+                     Table<2, Tensor<4, dim>> &fourth_derivatives) const;
+
   /**
    * Compute the value of the <tt>i</tt>th polynomial at unit point
    * <tt>p</tt>.
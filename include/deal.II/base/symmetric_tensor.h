@@ -3022,6 +3022,11 @@ enum struct SymmetricTensorEigenvectorMethod
  * The specialized algorithms utilized in computing the eigenvectors are
  * presented in @cite Kopp2008.
  *
+ * @note For tensors of VectorizedArray numbers, as used within
+ * FEEvaluation, a non-iterative version of this function that does not
+ * branch on the values of the individual lanes is declared in the file
+ * symmetric_tensor_vectorized.h.
+ *
  * @relatesalso SymmetricTensor
  */
 template <int dim, typename Number>
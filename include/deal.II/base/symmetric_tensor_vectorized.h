@@ -0,0 +1,464 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_symmetric_tensor_vectorized_h
+#define dealii_symmetric_tensor_vectorized_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/numbers.h>
+#include <deal.II/base/symmetric_tensor.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <array>
+#include <utility>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * Return the eigenvalues of a symmetric $1 \times 1$ tensor of vectorized
+ * numbers, i.e., the (single) entry of the tensor.
+ *
+ * @relatesalso SymmetricTensor
+ */
+template <typename Number, std::size_t width>
+inline std::array<VectorizedArray<Number, width>, 1>
+eigenvalues(const SymmetricTensor<2, 1, VectorizedArray<Number, width>> &T);
+
+
+
+/**
+ * Return the eigenvalues of a symmetric $2\times 2$ tensor of vectorized
+ * numbers, sorted in descending order in each lane. In contrast to the
+ * function for scalar numbers, the eigenvalues are computed without any
+ * branches as $\lambda_{1,2} = m \pm \sqrt{h^2 + T_{01}^2}$ with
+ * $m=\frac{1}{2}(T_{00}+T_{11})$ and $h=\frac 12 (T_{00}-T_{11})$, which
+ * also avoids the cancellation in the discriminant of the characteristic
+ * polynomial.
+ *
+ * @relatesalso SymmetricTensor
+ */
+template <typename Number, std::size_t width>
+inline std::array<VectorizedArray<Number, width>, 2>
+eigenvalues(const SymmetricTensor<2, 2, VectorizedArray<Number, width>> &T);
+
+
+
+/**
+ * Return the eigenvalues of a symmetric $3\times 3$ tensor of vectorized
+ * numbers, sorted in descending order in each lane. The eigenvalues are
+ * computed from the trigonometric solution of the characteristic equation
+ * as in the function for scalar numbers, but without any branches, such
+ * that all lanes follow the same path. The lanes holding diagonal tensors
+ * get the sorted diagonal entries.
+ *
+ * @warning As for scalar numbers, the trigonometric solution is subject to
+ * round-off errors of order $\sqrt{\epsilon}$ times the distance of the
+ * eigenvalues from their mean in case of (nearly) repeated eigenvalues.
+ *
+ * @relatesalso SymmetricTensor
+ */
+template <typename Number, std::size_t width>
+inline std::array<VectorizedArray<Number, width>, 3>
+eigenvalues(const SymmetricTensor<2, 3, VectorizedArray<Number, width>> &T);
+
+
+
+/**
+ * Return the eigenvalues and eigenvectors of a symmetric tensor of
+ * vectorized numbers, sorted in descending order of the eigenvalues in each
+ * lane. This overload is selected for tensors used inside FEEvaluation,
+ * e.g., for the evaluation of finite-strain material models at the
+ * quadrature points of a batch of cells.
+ *
+ * The eigenvalues are computed by the eigenvalues() functions above. The
+ * eigenvectors are computed with the non-iterative algorithm described by
+ * D. Eberly, "A robust eigensolver for 3x3 symmetric matrices" (2014):
+ * After scaling the tensor by its largest entry, the eigenvector of the
+ * eigenvalue that is best separated from the other two is computed as the
+ * normalized cross product of two rows of $\mathbf T - \lambda \mathbf I$.
+ * The second eigenvector is the null vector of the projection of
+ * $\mathbf T - \lambda \mathbf I$ onto the plane orthogonal to the first
+ * one, and the third one is the cross product of the first two. All
+ * decisions are made with compare_and_apply_mask(), so the computations
+ * for all lanes are done together. In particular, tensors with repeated
+ * eigenvalues do not need a fallback to an iterative algorithm.
+ *
+ * @note The argument @p method is ignored since the iterative algorithms
+ * would need different numbers of iterations in the different lanes. It is
+ * only present for compatibility with the function for scalar numbers.
+ *
+ * @relatesalso SymmetricTensor
+ */
+template <int dim, typename Number, std::size_t width>
+inline std::array<
+  std::pair<VectorizedArray<Number, width>,
+            Tensor<1, dim, VectorizedArray<Number, width>>>,
+  dim>
+eigenvectors(const SymmetricTensor<2, dim, VectorizedArray<Number, width>> &T,
+             const SymmetricTensorEigenvectorMethod method =
+               SymmetricTensorEigenvectorMethod::ql_implicit_shifts);
+
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace SymmetricTensorImplementation
+  {
+    /**
+     * Select the vector @p true_value in the lanes in which @p left is
+     * greater than @p right and @p false_value in the other ones.
+     */
+    template <int dim, typename Number>
+    inline Tensor<1, dim, Number>
+    select_greater_than(const Number                 &left,
+                        const Number                 &right,
+                        const Tensor<1, dim, Number> &true_value,
+                        const Tensor<1, dim, Number> &false_value)
+    {
+      Tensor<1, dim, Number> result;
+      for (unsigned int d = 0; d < dim; ++d)
+        result[d] = compare_and_apply_mask<SIMDComparison::greater_than>(
+          left, right, true_value[d], false_value[d]);
+      return result;
+    }
+
+
+
+    /**
+     * Return the normalized cross product with the largest norm of two rows
+     * of the matrix $\mathbf A - \lambda \mathbf I$, which is an eigenvector
+     * for an eigenvalue $\lambda$ of multiplicity one. If all cross
+     * products vanish, the first unit vector is returned.
+     */
+    template <typename Number>
+    inline Tensor<1, 3, Number>
+    eigenvector_from_rows(const SymmetricTensor<2, 3, Number> &A,
+                          const Number                        &lambda)
+    {
+      Tensor<1, 3, Number> rows[3];
+      for (unsigned int i = 0; i < 3; ++i)
+        for (unsigned int j = 0; j < 3; ++j)
+          rows[i][j] = A[i][j];
+      for (unsigned int i = 0; i < 3; ++i)
+        rows[i][i] -= lambda;
+
+      Tensor<1, 3, Number> result    = cross_product_3d(rows[0], rows[1]);
+      Number               max_norm2 = result.norm_square();
+      for (const auto &[i, j] : {std::make_pair(0, 2), std::make_pair(1, 2)})
+        {
+          const Tensor<1, 3, Number> candidate =
+            cross_product_3d(rows[i], rows[j]);
+          const Number norm2 = candidate.norm_square();
+          result    = select_greater_than(norm2, max_norm2, candidate, result);
+          max_norm2 = std::max(norm2, max_norm2);
+        }
+
+      const Number zero = 0.;
+      const Number one  = 1.;
+      const Number inverse_norm =
+        one / compare_and_apply_mask<SIMDComparison::greater_than>(
+                max_norm2, zero, std::sqrt(max_norm2), one);
+      const Tensor<1, 3, Number> normalized = result * inverse_norm;
+      Tensor<1, 3, Number>       unit_vector;
+      unit_vector[0] = one;
+      return select_greater_than(max_norm2, zero, normalized, unit_vector);
+    }
+
+
+
+    /**
+     * Return an eigenvector of the tensor @p A for the eigenvalue @p lambda
+     * that is orthogonal to the unit eigenvector @p w, which belongs to
+     * another eigenvalue.
+     */
+    template <typename Number>
+    inline Tensor<1, 3, Number>
+    eigenvector_orthogonal_to(const SymmetricTensor<2, 3, Number> &A,
+                              const Number                        &lambda,
+                              const Tensor<1, 3, Number>          &w)
+    {
+      // set up an orthonormal basis u, v of the plane orthogonal to w,
+      // using the two largest components of w for u
+      Tensor<1, 3, Number> u_0, u_1;
+      u_0[0] = -w[2];
+      u_0[2] = w[0];
+      u_1[1] = w[2];
+      u_1[2] = -w[1];
+      const Number abs_w0 = std::abs(w[0]);
+      const Number abs_w1 = std::abs(w[1]);
+      const Number norm2_u =
+        compare_and_apply_mask<SIMDComparison::greater_than>(
+          abs_w0, abs_w1, w[0] * w[0] + w[2] * w[2], w[1] * w[1] + w[2] * w[2]);
+      const Tensor<1, 3, Number> u =
+        select_greater_than(abs_w0, abs_w1, u_0, u_1) / std::sqrt(norm2_u);
+      const Tensor<1, 3, Number> v = cross_product_3d(w, u);
+
+      // the projection of A - lambda I onto the plane is a singular 2x2
+      // matrix; its row with the larger entries determines the null vector
+      const Tensor<1, 3, Number> Au  = A * u;
+      const Tensor<1, 3, Number> Av  = A * v;
+      const Number               m00 = u * Au - lambda;
+      const Number               m01 = u * Av;
+      const Number               m11 = v * Av - lambda;
+
+      const Number abs_m01   = std::abs(m01);
+      const Number max_row_0 = std::max(std::abs(m00), abs_m01);
+      const Number max_row_1 = std::max(std::abs(m11), abs_m01);
+
+      const Number alpha = compare_and_apply_mask<SIMDComparison::less_than>(
+        max_row_0, max_row_1, m01, m00);
+      const Number beta = compare_and_apply_mask<SIMDComparison::less_than>(
+        max_row_0, max_row_1, m11, m01);
+
+      // if the matrix vanishes, all vectors in the plane are eigenvectors
+      const Number zero  = 0.;
+      const Number one   = 1.;
+      const Number norm2 = alpha * alpha + beta * beta;
+      const Number inverse_norm =
+        one / compare_and_apply_mask<SIMDComparison::greater_than>(
+                norm2, zero, std::sqrt(norm2), one);
+      const Tensor<1, 3, Number> null_vector =
+        (beta * inverse_norm) * u - (alpha * inverse_norm) * v;
+      return select_greater_than(norm2, zero, null_vector, u);
+    }
+  } // namespace SymmetricTensorImplementation
+} // namespace internal
+
+
+
+template <typename Number, std::size_t width>
+inline std::array<VectorizedArray<Number, width>, 1>
+eigenvalues(const SymmetricTensor<2, 1, VectorizedArray<Number, width>> &T)
+{
+  return {{T[0][0]}};
+}
+
+
+
+template <typename Number, std::size_t width>
+inline std::array<VectorizedArray<Number, width>, 2>
+eigenvalues(const SymmetricTensor<2, 2, VectorizedArray<Number, width>> &T)
+{
+  using VectorizedArrayType = VectorizedArray<Number, width>;
+
+  const VectorizedArrayType mean = Number(0.5) * (T[0][0] + T[1][1]);
+  const VectorizedArrayType half_difference = Number(0.5) * (T[0][0] - T[1][1]);
+
+  // compute the radius sqrt(half_difference^2 + T_01^2) without underflow or
+  // overflow of the squares
+  const VectorizedArrayType zero = 0.;
+  const VectorizedArrayType one  = 1.;
+  VectorizedArrayType       scale =
+    std::max(std::abs(half_difference), std::abs(T[0][1]));
+  scale = compare_and_apply_mask<SIMDComparison::greater_than>(scale,
+                                                               zero,
+                                                               scale,
+                                                               one);
+  const VectorizedArrayType h      = half_difference / scale;
+  const VectorizedArrayType b      = T[0][1] / scale;
+  const VectorizedArrayType radius = scale * std::sqrt(h * h + b * b);
+  return {{mean + radius, mean - radius}};
+}
+
+
+
+template <typename Number, std::size_t width>
+inline std::array<VectorizedArray<Number, width>, 3>
+eigenvalues(const SymmetricTensor<2, 3, VectorizedArray<Number, width>> &T)
+{
+  using VectorizedArrayType = VectorizedArray<Number, width>;
+
+  const VectorizedArrayType zero = 0.;
+  const VectorizedArrayType one  = 1.;
+
+  // scale the tensor by its largest entry to avoid underflow or overflow of
+  // the squares below
+  VectorizedArrayType scale = zero;
+  for (unsigned int i = 0; i < 3; ++i)
+    for (unsigned int j = i; j < 3; ++j)
+      scale = std::max(scale, std::abs(T[i][j]));
+  scale = compare_and_apply_mask<SIMDComparison::greater_than>(scale,
+                                                               zero,
+                                                               scale,
+                                                               one);
+  const SymmetricTensor<2, 3, VectorizedArrayType> A = (one / scale) * T;
+
+  // Decompose A = p*B + q*I as in the function for scalar numbers and solve
+  // the characteristic equation of B, which has the trigonometric solution
+  // 2*cos(1/3 * acos(det(B)/2) + 2/3*pi*k), k = 0,1,2
+  const VectorizedArrayType q = trace(A) * Number(1. / 3.);
+  const VectorizedArrayType upp_tri_sq =
+    A[0][1] * A[0][1] + A[0][2] * A[0][2] + A[1][2] * A[1][2];
+  const VectorizedArrayType p =
+    std::sqrt(Number(1. / 6.) * ((A[0][0] - q) * (A[0][0] - q) +
+                                 (A[1][1] - q) * (A[1][1] - q) +
+                                 (A[2][2] - q) * (A[2][2] - q) +
+                                 Number(2.) * upp_tri_sq));
+
+  // For multiples of the identity, p is zero and so are all entries of
+  // A - q*I, so that any nonzero divisor gives the right result
+  const VectorizedArrayType inverse_p =
+    one / compare_and_apply_mask<SIMDComparison::greater_than>(p, zero, p, one);
+  const SymmetricTensor<2, 3, VectorizedArrayType> B =
+    inverse_p * (A - q * unit_symmetric_tensor<3, VectorizedArrayType>());
+
+  // The value of det(B)/2 should be within [-1,1], but floating point
+  // errors might place it slightly outside this range
+  const VectorizedArrayType half_det_B =
+    std::min(std::max(Number(0.5) * determinant(B), -one), one);
+  const VectorizedArrayType phi = std::acos(half_det_B) * Number(1. / 3.);
+
+  // the trigonometric solution gives the eigenvalues in descending order
+  std::array<VectorizedArrayType, 3> eig_vals;
+  eig_vals[0] = q + Number(2.) * p * std::cos(phi);
+  eig_vals[2] =
+    q + Number(2.) * p * std::cos(phi + Number(2.0 / 3.0 * numbers::PI));
+  eig_vals[1] = Number(3.) * q - eig_vals[0] - eig_vals[2];
+
+  // The trigonometric solution is inaccurate for repeated eigenvalues. For
+  // diagonal tensors, which often appear e.g. in uniaxial loading, use the
+  // sorted diagonal entries instead
+  const VectorizedArrayType upper = std::max(A[0][0], A[1][1]);
+  const VectorizedArrayType lower = std::min(A[0][0], A[1][1]);
+  const std::array<VectorizedArrayType, 3> diagonal = {
+    {std::max(upper, A[2][2]),
+     std::min(upper, std::max(lower, A[2][2])),
+     std::min(lower, A[2][2])}};
+  for (unsigned int i = 0; i < 3; ++i)
+    eig_vals[i] = scale * compare_and_apply_mask<SIMDComparison::equal>(
+                            upp_tri_sq, zero, diagonal[i], eig_vals[i]);
+  return eig_vals;
+}
+
+
+
+template <int dim, typename Number, std::size_t width>
+inline std::array<
+  std::pair<VectorizedArray<Number, width>,
+            Tensor<1, dim, VectorizedArray<Number, width>>>,
+  dim>
+eigenvectors(const SymmetricTensor<2, dim, VectorizedArray<Number, width>> &T,
+             const SymmetricTensorEigenvectorMethod /*method*/)
+{
+  using VectorizedArrayType = VectorizedArray<Number, width>;
+
+  std::array<
+    std::pair<VectorizedArrayType, Tensor<1, dim, VectorizedArrayType>>,
+    dim>
+    eig_vals_vecs;
+
+  const VectorizedArrayType zero = 0.;
+  const VectorizedArrayType one  = 1.;
+
+  if constexpr (dim == 1)
+    {
+      eig_vals_vecs[0].first     = T[0][0];
+      eig_vals_vecs[0].second[0] = one;
+    }
+  else if constexpr (dim == 2)
+    {
+      // the eigenvector (lambda_1 - T_11, T_01) of the larger eigenvalue is
+      // accurate for T_00 >= T_11, the equivalent representation
+      // (T_01, lambda_1 - T_00) in the other case
+      const std::array<VectorizedArrayType, 2> eig_vals = eigenvalues(T);
+      const VectorizedArrayType half_difference =
+        Number(0.5) * (T[0][0] - T[1][1]);
+      const VectorizedArrayType radius =
+        Number(0.5) * (eig_vals[0] - eig_vals[1]);
+
+      Tensor<1, 2, VectorizedArrayType> v;
+      v[0] = compare_and_apply_mask<SIMDComparison::less_than>(
+        half_difference, zero, T[0][1], half_difference + radius);
+      v[1] = compare_and_apply_mask<SIMDComparison::less_than>(
+        half_difference, zero, radius - half_difference, T[0][1]);
+
+      // scale v by its largest entry before the normalization to avoid
+      // overflow of the squares; for multiples of the identity, v vanishes
+      // and all vectors are eigenvectors
+      const VectorizedArrayType max_v =
+        std::max(std::abs(v[0]), std::abs(v[1]));
+      v[0] = compare_and_apply_mask<SIMDComparison::greater_than>(max_v,
+                                                                   zero,
+                                                                   v[0],
+                                                                   one);
+      v /= compare_and_apply_mask<SIMDComparison::greater_than>(max_v,
+                                                                zero,
+                                                                max_v,
+                                                                one);
+      v /= std::sqrt(v.norm_square());
+
+      eig_vals_vecs[0].first     = eig_vals[0];
+      eig_vals_vecs[0].second    = v;
+      eig_vals_vecs[1].first     = eig_vals[1];
+      eig_vals_vecs[1].second[0] = -v[1];
+      eig_vals_vecs[1].second[1] = v[0];
+    }
+  else
+    {
+      static_assert(dim == 3, "Only implemented for dim = 1, 2, 3");
+
+      // scale the tensor by its largest entry to avoid over- and underflow
+      VectorizedArrayType max_entry = zero;
+      for (unsigned int i = 0; i < 3; ++i)
+        for (unsigned int j = i; j < 3; ++j)
+          max_entry = std::max(max_entry, std::abs(T[i][j]));
+      max_entry = compare_and_apply_mask<SIMDComparison::greater_than>(
+        max_entry, zero, max_entry, one);
+      const SymmetricTensor<2, 3, VectorizedArrayType> A =
+        (one / max_entry) * T;
+      const std::array<VectorizedArrayType, 3> eig_vals = eigenvalues(A);
+
+      // start with the eigenvalue that is separated best from the others,
+      // which is either the largest or the smallest one
+      const VectorizedArrayType gap_above = eig_vals[0] - eig_vals[1];
+      const VectorizedArrayType gap_below = eig_vals[1] - eig_vals[2];
+      const VectorizedArrayType first_eigenvalue =
+        compare_and_apply_mask<SIMDComparison::greater_than_or_equal>(
+          gap_above, gap_below, eig_vals[0], eig_vals[2]);
+
+      const Tensor<1, 3, VectorizedArrayType> v_first =
+        internal::SymmetricTensorImplementation::eigenvector_from_rows(
+          A, first_eigenvalue);
+      const Tensor<1, 3, VectorizedArrayType> v_middle =
+        internal::SymmetricTensorImplementation::eigenvector_orthogonal_to(
+          A, eig_vals[1], v_first);
+      const Tensor<1, 3, VectorizedArrayType> v_last =
+        cross_product_3d(v_first, v_middle);
+
+      // the selection is done with the opposite test to handle ties in the
+      // same way as in the computation of first_eigenvalue
+      eig_vals_vecs[0].second =
+        internal::SymmetricTensorImplementation::select_greater_than(
+          gap_below, gap_above, v_last, v_first);
+      eig_vals_vecs[1].second = v_middle;
+      eig_vals_vecs[2].second =
+        internal::SymmetricTensorImplementation::select_greater_than(
+          gap_below, gap_above, v_first, v_last);
+      for (unsigned int i = 0; i < 3; ++i)
+        eig_vals_vecs[i].first = eig_vals[i] * max_entry;
+    }
+
+  return eig_vals_vecs;
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -761,6 +761,28 @@ namespace Threads
       return (task_data != nullptr);
     }
 
+    /**
+     * Return whether the task represented by this object has finished, i.e.,
+     * whether a subsequent call to join() or return_value() would return
+     * without waiting. In contrast to join(), this function never blocks and
+     * does not rethrow exceptions thrown by the task. It also returns false
+     * if another thread is currently joining the task, and if the task has
+     * been deferred by the fallback implementation based on `std::async`
+     * and will only run once it is joined.
+     *
+     * This function allows to poll for the completion of tasks, for example
+     * from a coroutine of type Threads::AsyncTask that awaits a task.
+     *
+     * @pre The function joinable() must return true.
+     */
+    bool
+    is_ready() const
+    {
+      AssertThrow(joinable(), ExcNoTask());
+
+      return task_data->is_ready();
+    }
+
 
     /**
      * Get the return value of the function of the task. Since it is
@@ -1060,6 +1082,27 @@ namespace Threads
 
 
 
+      /**
+       * Return whether the task has finished without waiting for it. If
+       * another thread holds the lock because it is waiting for the task,
+       * return false rather than blocking.
+       */
+      bool
+      is_ready()
+      {
+        if (task_has_finished)
+          return true;
+
+        std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+        if (lock.owns_lock() == false)
+          return false;
+        return task_has_finished ||
+               (future.wait_for(std::chrono::seconds(0)) ==
+                std::future_status::ready);
+      }
+
+
+
       typename internal::return_value<RT>::reference_type
       get()
       {
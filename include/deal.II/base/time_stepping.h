@@ -469,6 +469,75 @@ namespace TimeStepping
       VectorType &vec_ri,
       VectorType &vec_ki);
 
+    /**
+     * Same as the function above, but with the evaluation of the operator and
+     * the stage update fused into a single user-provided function
+     * @p perform_stage. For every stage, this function is called as
+     * `perform_stage(t_i, factor_solution, factor_ai, current_ri, vec_ki,
+     * solution, next_ri)` and must compute $k_i = f(t_i, r_i)$ with
+     * $r_i$ given by @p current_ri, store it in @p vec_ki and then apply the
+     * low-storage update
+     * @f{align*}{
+     *   r_{i+1} &= y + \text{factor\_ai}\; k_i,\\
+     *   y &\leftarrow y + \text{factor\_solution}\; k_i,
+     * @f}
+     * where $y$ is @p solution and $r_{i+1}$ is @p next_ri. For the last stage,
+     * the argument factor_ai is zero and @p next_ri must not be written.
+     * Note that @p current_ri and @p solution are the same vector in the
+     * first stage and @p current_ri and @p next_ri are the same vector in
+     * all later stages, so an entry may only be overwritten once it is no
+     * longer needed for computing $k_i$.
+     *
+     * The point of this variant is that the update only touches the vector
+     * entries the operator has just computed, so it can be performed while
+     * those entries are still in cache. With MatrixFree::cell_loop(), this is
+     * done with the `operation_after_loop` hook, which is called on ranges of
+     * locally owned degrees of freedom as soon as all cells touching them
+     * have been processed (see step-67):
+     * @code
+     * const auto perform_stage = [&](const double      t,
+     *                                const double      factor_solution,
+     *                                const double      factor_ai,
+     *                                const VectorType &current_ri,
+     *                                VectorType       &vec_ki,
+     *                                VectorType       &solution,
+     *                                VectorType       &next_ri) {
+     *   matrix_free.cell_loop(
+     *     &Operator::local_apply_cell, &op, vec_ki, current_ri, true,
+     *     [&](const unsigned int start_range, const unsigned int end_range) {
+     *       DEAL_II_OPENMP_SIMD_PRAGMA
+     *       for (unsigned int i = start_range; i < end_range; ++i)
+     *         {
+     *           const auto k_i   = vec_ki.local_element(i);
+     *           const auto sol_i = solution.local_element(i);
+     *           solution.local_element(i) = sol_i + factor_solution * k_i;
+     *           if (factor_ai != 0.)
+     *             next_ri.local_element(i) = sol_i + factor_ai * k_i;
+     *         }
+     *     });
+     * };
+     * time_integrator.evolve_one_time_step(
+     *   perform_stage, t, dt, solution, vec_ri, vec_ki);
+     * @endcode
+     * In contrast to the variant taking a function $f(t,y)$, no temporary
+     * vectors are created, and @p vec_ri and @p vec_ki must already be
+     * initialized with the same layout as @p solution.
+     */
+    double
+    evolve_one_time_step(
+      const std::function<void(const double      t,
+                               const double      factor_solution,
+                               const double      factor_ai,
+                               const VectorType &current_ri,
+                               VectorType       &vec_ki,
+                               VectorType       &solution,
+                               VectorType       &next_ri)> &perform_stage,
+      double                                               t,
+      double                                               delta_t,
+      VectorType                                          &solution,
+      VectorType                                          &vec_ri,
+      VectorType                                          &vec_ki);
+
     /**
      * Get the coefficients of the scheme.
      * Note that here vector @p a is not the conventional definition in terms of a
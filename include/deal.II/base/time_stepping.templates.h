@@ -423,6 +423,57 @@ namespace TimeStepping
     return (t + delta_t);
   }
 
+
+
+  template <typename VectorType>
+  double
+  LowStorageRungeKutta<VectorType>::evolve_one_time_step(
+    const std::function<void(const double,
+                             const double,
+                             const double,
+                             const VectorType &,
+                             VectorType &,
+                             VectorType &,
+                             VectorType &)> &perform_stage,
+    double                                  t,
+    double                                  delta_t,
+    VectorType                             &solution,
+    VectorType                             &vec_ri,
+    VectorType                             &vec_ki)
+  {
+    Assert(status.method != runge_kutta_method::invalid, ExcNoMethodSelected());
+    AssertDimension(vec_ri.size(), solution.size());
+    AssertDimension(vec_ki.size(), solution.size());
+
+    // In the first stage, the operator is evaluated on the solution itself;
+    // later stages use vec_ri both as input and output, like the variant
+    // above
+    perform_stage(t,
+                  this->b[0] * delta_t,
+                  this->a[0][0] * delta_t,
+                  solution,
+                  vec_ki,
+                  solution,
+                  vec_ri);
+
+    for (unsigned int stage = 1; stage < this->n_stages; ++stage)
+      {
+        const double c_i = this->c[stage];
+        const double factor_ai =
+          (stage == this->n_stages - 1 ? 0 : this->a[0][stage] * delta_t);
+        perform_stage(t + c_i * delta_t,
+                      this->b[stage] * delta_t,
+                      factor_ai,
+                      vec_ri,
+                      vec_ki,
+                      solution,
+                      vec_ri);
+      }
+    return (t + delta_t);
+  }
+
+
+
   template <typename VectorType>
   void
   LowStorageRungeKutta<VectorType>::get_coefficients(
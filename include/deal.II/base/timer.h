@@ -22,9 +22,13 @@
 #include <deal.II/base/mutex.h>
 
 #include <chrono>
+#include <cstdint>
 #include <list>
 #include <map>
+#include <ostream>
 #include <string>
+#include <thread>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -543,11 +547,81 @@ private:
  * taken by the 10\% of the slowest and fastest ranks, respectively, to get
  * additional insight into the statistical distribution.
  *
+ *
+ * <h3>Timing many small sections and tracing</h3>
+ *
+ * Entering and leaving a section by its name involves looking up the name
+ * among all sections. For code regions that are entered very often, e.g.
+ * inside a loop over cells, this overhead can be avoided by registering the
+ * section once and then using the returned handle:
+ * @code
+ *   const TimerOutput::SectionHandle assemble_cell =
+ *     timer.register_section("Assemble cell");
+ *
+ *   for (const auto &cell : dof_handler.active_cell_iterators())
+ *     {
+ *       TimerOutput::Scope timer_section(timer, assemble_cell);
+ *       // ...
+ *     }
+ * @endcode
+ *
+ * The summary only shows the accumulated times of the sections. To see
+ * how the sections nest and when they are executed on the various threads
+ * and MPI processes, e.g., to find out where processes wait on each other,
+ * the TimerOutput object can additionally record a trace of all calls. After
+ * calling enable_tracing(), the times of entering and leaving each section
+ * are stored in a buffer for each thread, which holds the given number of
+ * most recent events. The trace can then be written with write_chrome_trace()
+ * in the JSON trace event format understood by the Chrome and Perfetto trace
+ * viewers:
+ * @code
+ *   timer.enable_tracing(100000, MPI_COMM_WORLD);
+ *   // ... run the program ...
+ *   std::ofstream trace_file("trace.json");
+ *   timer.write_chrome_trace(trace_file, MPI_COMM_WORLD);
+ * @endcode
+ * Each MPI process appears as a separate process in the viewer, and each
+ * thread that entered a section as a separate thread.
+ *
  * @ingroup utilities
  */
 class TimerOutput
 {
 public:
+  /**
+   * A handle to a section obtained from register_section(). Entering and
+   * leaving a section through its handle avoids looking up the section by
+   * its name. A default-constructed handle is invalid. Handles become
+   * invalid when reset() is called.
+   */
+  class SectionHandle
+  {
+  public:
+    /**
+     * Default constructor, creating an invalid handle.
+     */
+    SectionHandle() = default;
+
+    /**
+     * Return whether the handle refers to a section.
+     */
+    bool
+    is_valid() const;
+
+  private:
+    /**
+     * Constructor used by TimerOutput::register_section().
+     */
+    explicit SectionHandle(const unsigned int index);
+
+    /**
+     * Index of the section within the TimerOutput object.
+     */
+    unsigned int index = numbers::invalid_unsigned_int;
+
+    friend class TimerOutput;
+  };
+
   /**
    * Helper class to enter/exit sections in TimerOutput be constructing a
    * simple scope-based object. The purpose of this class is explained in the
@@ -562,6 +636,12 @@ public:
      */
     Scope(dealii::TimerOutput &timer_, const std::string &section_name);
 
+    /**
+     * Enter the section given by @p section_handle in the timer. Exit
+     * automatically when calling stop() or destructor runs.
+     */
+    Scope(dealii::TimerOutput &timer_, const SectionHandle &section_handle);
+
     /**
      * Destructor calls stop()
      */
@@ -585,6 +665,12 @@ public:
      */
     const std::string section_name;
 
+    /**
+     * Handle of the section we need to exit, if the section was entered
+     * through its handle.
+     */
+    const SectionHandle section_handle;
+
     /**
      * Do we still need to exit the section we are in?
      */
@@ -763,6 +849,62 @@ public:
   void
   leave_subsection(const std::string &section_name = "");
 
+  /**
+   * Create the section with name @p section_name, unless it already exists,
+   * and return a handle to it that can be used to enter and leave the
+   * section without looking it up by name.
+   */
+  SectionHandle
+  register_section(const std::string &section_name);
+
+  /**
+   * Same as the function above taking a section name, but for a section
+   * obtained from register_section().
+   */
+  void
+  enter_subsection(const SectionHandle &section_handle);
+
+  /**
+   * Same as the function above taking a section name, but for a section
+   * obtained from register_section().
+   */
+  void
+  leave_subsection(const SectionHandle &section_handle);
+
+  /**
+   * Start recording a trace of all subsequent entries into and exits from
+   * sections. For each thread, the @p n_events_per_thread most recent events
+   * are kept; older events are overwritten. The times of all events are
+   * measured relative to the time of this call, synchronized by a barrier
+   * over @p mpi_comm, so that the traces of different MPI processes can be
+   * compared.
+   *
+   * @warning This is a collective call over @p mpi_comm.
+   */
+  void
+  enable_tracing(const unsigned int n_events_per_thread = 65536,
+                 const MPI_Comm     mpi_comm            = MPI_COMM_SELF);
+
+  /**
+   * Stop recording events. Events recorded so far are kept until reset() is
+   * called or tracing is enabled again.
+   */
+  void
+  disable_tracing();
+
+  /**
+   * Write the events recorded since enable_tracing() to @p out in the JSON
+   * trace event format used by the Chrome and Perfetto trace viewers. The
+   * events of all processes in @p mpi_comm are collected on the first process
+   * of the communicator, which is the only one writing to @p out. This
+   * function must not be called while other threads enter or leave sections.
+   *
+   * @warning This is a collective call over @p mpi_comm.
+   */
+  void
+  write_chrome_trace(std::ostream  &out,
+                     const MPI_Comm mpi_comm = MPI_COMM_SELF) const;
+
   /**
    * Get a map with the collected data of the specified type for each subsection
    */
@@ -849,6 +991,7 @@ private:
     double       total_cpu_time;
     double       total_wall_time;
     unsigned int n_calls;
+    unsigned int index;
   };
 
   /**
@@ -856,6 +999,85 @@ private:
    */
   std::map<std::string, Section> sections;
 
+  /**
+   * The sections in the order they were created, so that a section can be
+   * accessed by its index, as stored in SectionHandle and the trace events.
+   */
+  std::vector<std::map<std::string, Section>::iterator> section_list;
+
+  /**
+   * An entry into (if @p is_begin is true) or exit from the section with
+   * index @p section, at the given time in nanoseconds since
+   * enable_tracing() was called.
+   */
+  struct TraceEvent
+  {
+    unsigned int section;
+    bool         is_begin;
+    std::int64_t time;
+  };
+
+  /**
+   * Ring buffer of the trace events of one thread, where the latest event
+   * is stored at position `(n_recorded - 1) % events.size()`.
+   */
+  struct TraceBuffer
+  {
+    std::vector<TraceEvent> events;
+    std::uint64_t           n_recorded;
+    unsigned int            thread_index;
+  };
+
+  /**
+   * Whether events are currently recorded.
+   */
+  bool tracing_enabled;
+
+  /**
+   * The number of events kept for each thread.
+   */
+  unsigned int n_trace_events_per_thread;
+
+  /**
+   * The time relative to which the times of trace events are measured.
+   */
+  std::chrono::steady_clock::time_point trace_start_time;
+
+  /**
+   * The trace buffers of all threads that have entered or left a section
+   * since tracing was enabled.
+   */
+  std::map<std::thread::id, TraceBuffer> trace_buffers;
+
+  /**
+   * Create a new section with name @p section_name and return an iterator
+   * to it. The mutex needs to be held when calling this function.
+   */
+  std::map<std::string, Section>::iterator
+  create_section(const std::string &section_name);
+
+  /**
+   * Start the timer of the given section and record it as active. The mutex
+   * needs to be held when calling this function.
+   */
+  void
+  enter_section(const std::map<std::string, Section>::iterator &section);
+
+  /**
+   * Stop the timer of the given section, accumulate its times, and remove
+   * it from the active sections. The mutex needs to be held when calling
+   * this function.
+   */
+  void
+  leave_section(const std::map<std::string, Section>::iterator &section);
+
+  /**
+   * Record a trace event for the current thread if tracing is enabled. The
+   * mutex needs to be held when calling this function.
+   */
+  void
+  record_trace_event(const unsigned int section, const bool is_begin);
+
   /**
    * The stream object to which we are to output.
    */
@@ -941,6 +1163,20 @@ Timer::print_accumulated_wall_time_data(StreamType &stream) const
 
 
 
+inline TimerOutput::SectionHandle::SectionHandle(const unsigned int index)
+  : index(index)
+{}
+
+
+
+inline bool
+TimerOutput::SectionHandle::is_valid() const
+{
+  return index != numbers::invalid_unsigned_int;
+}
+
+
+
 inline TimerOutput::Scope::Scope(dealii::TimerOutput &timer_,
                                  const std::string   &section_name_)
   : timer(timer_)
@@ -952,6 +1188,17 @@ inline TimerOutput::Scope::Scope(dealii::TimerOutput &timer_,
 
 
 
+inline TimerOutput::Scope::Scope(dealii::TimerOutput &timer_,
+                                 const SectionHandle &section_handle_)
+  : timer(timer_)
+  , section_handle(section_handle_)
+  , in(true)
+{
+  timer.enter_subsection(section_handle);
+}
+
+
+
 inline void
 TimerOutput::Scope::stop()
 {
@@ -959,7 +1206,10 @@ TimerOutput::Scope::stop()
     return;
   in = false;
 
-  timer.leave_subsection(section_name);
+  if (section_handle.is_valid())
+    timer.leave_subsection(section_handle);
+  else
+    timer.leave_subsection(section_name);
 }
 
 
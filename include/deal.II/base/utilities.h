@@ -545,6 +545,11 @@ namespace Utilities
    *   followed by a bit-by-bit copy of the contents of the vector. A
    *   similar process is used for vectors of vectors of objects whose type
    *   `T` satisfies `std::is_trivially_copyable`.
+   * - The previous case also applies to vectors of (possibly nested)
+   *   std::pair objects of such types, e.g.,
+   *   `std::vector<std::pair<unsigned int, Point<dim>>>`, and to such
+   *   pairs themselves if no compression is requested. The members of each
+   *   pair are copied bit by bit one after the other.
    * - Finally, if the type `T` of the object to be packed is std::tuple<>
    *   (i.e., a tuple without any elements as indicated by the empty argument
    *   list) and if no compression is requested, then this
@@ -929,6 +934,124 @@ namespace Utilities
      */
     void
     posix_memalign(void **memptr, std::size_t alignment, std::size_t size);
+
+    /**
+     * A structure describing how the operating system should back large
+     * memory allocations, such as the arrays of AlignedVector or the local
+     * elements of LinearAlgebra::distributed::Vector, with physical memory.
+     *
+     * The default policy leaves everything to the operating system, i.e.,
+     * pages are placed on the NUMA domain of the thread that first touches
+     * them, and transparent huge pages are used according to the system-wide
+     * settings. For memory-bandwidth bound codes like matrix-free operator
+     * evaluation, it can be beneficial to explicitly request huge pages in
+     * order to reduce the number of TLB misses, or to distribute the pages
+     * of large arrays over all NUMA domains of a node when the threads that
+     * access the data are not the ones that initialize it.
+     *
+     * The policy is applied by apply_memory_allocation_policy(), which only
+     * acts on Linux systems and otherwise does nothing. It is used by
+     * AlignedVector, and thus by all data structures built on it such as the
+     * geometry data of MatrixFree stored in internal::MatrixFreeFunctions::
+     * MappingInfo, and by the local elements of
+     * LinearAlgebra::distributed::Vector if the vector does not use
+     * MPI shared memory.
+     */
+    struct MemoryAllocationPolicy
+    {
+      /**
+       * The placement of pages on the NUMA domains of a node.
+       */
+      enum class NumaPlacement : unsigned char
+      {
+        /**
+         * Use the default policy of the operating system, which places a
+         * page on the NUMA domain of the thread that first writes to it.
+         */
+        first_touch,
+        /**
+         * Distribute the pages round-robin over all NUMA domains the process
+         * is allowed to use.
+         */
+        interleave,
+        /**
+         * Place the pages on the NUMA domain given by
+         * MemoryAllocationPolicy::numa_node.
+         */
+        bind
+      };
+
+      /**
+       * Whether to align allocations of at least 2 MB to 2 MB boundaries
+       * and to advise the operating system to back them by transparent huge
+       * pages.
+       */
+      bool use_huge_pages = false;
+
+      /**
+       * The NUMA placement of the pages.
+       */
+      NumaPlacement numa_placement = NumaPlacement::first_touch;
+
+      /**
+       * The NUMA domain used for NumaPlacement::bind.
+       */
+      unsigned short numa_node = 0;
+
+      /**
+       * Return whether this is the default policy, in which case no special
+       * action is needed when allocating memory.
+       */
+      bool
+      is_default() const;
+    };
+
+    /**
+     * Set the policy used for the memory allocations of all objects that do
+     * not specify a policy of their own, see
+     * AlignedVector::set_allocation_policy(). This function is not
+     * thread-safe and should be called at the beginning of a program, before
+     * the data structures of interest are allocated.
+     */
+    void
+    set_default_memory_allocation_policy(const MemoryAllocationPolicy &policy);
+
+    /**
+     * Return the policy set by set_default_memory_allocation_policy().
+     */
+    const MemoryAllocationPolicy &
+    get_default_memory_allocation_policy();
+
+    /**
+     * Return the alignment in bytes an allocation of @p size bytes should
+     * have in order for apply_memory_allocation_policy() to be effective,
+     * given the minimal alignment @p min_alignment requested by the caller.
+     */
+    std::size_t
+    get_memory_allocation_alignment(const MemoryAllocationPolicy &policy,
+                                    const std::size_t min_alignment,
+                                    const std::size_t size);
+
+    /**
+     * Apply the given policy to the memory region of @p size bytes starting
+     * at @p ptr. The operating system offers the settings only for whole
+     * pages, so the policy is applied to all pages that are completely
+     * contained in the region, which is why allocations should be aligned
+     * according to get_memory_allocation_alignment(). Since the NUMA domain
+     * of a page is determined when it is first touched, this function needs
+     * to be called before the memory is written to; for pages that are
+     * already in use, the policy has no effect. Huge pages are only
+     * requested for regions of at least 2 MB.
+     *
+     * Failures of the underlying system calls, e.g., because huge pages are
+     * disabled on the system or the requested NUMA domain does not exist,
+     * are not reported as errors since the policy is merely a performance
+     * hint.
+     */
+    void
+    apply_memory_allocation_policy(void                         *ptr,
+                                   const std::size_t             size,
+                                   const MemoryAllocationPolicy &policy);
   } // namespace System
 } // namespace Utilities
 
@@ -1136,10 +1259,100 @@ namespace Utilities
 
   namespace internal
   {
+    /**
+     * A structure that is used to identify whether objects of type T can be
+     * copied bit for bit into a character array and back. This is the case
+     * for types that satisfy std::is_trivially_copyable_v<T> == true, and
+     * for (possibly nested) std::pair objects of such types. The latter are
+     * not trivially copyable themselves because std::pair has a
+     * user-defined assignment operator, but their members are copied one
+     * after the other.
+     */
+    template <typename T>
+    struct IsBitwisePackable
+    {
+      static constexpr bool value = std::is_trivially_copyable_v<T>;
+    };
+
+
+
+    template <typename T1, typename T2>
+    struct IsBitwisePackable<std::pair<T1, T2>>
+    {
+      static constexpr bool value =
+        IsBitwisePackable<T1>::value && IsBitwisePackable<T2>::value;
+    };
+
+
+
+    /**
+     * Return the number of bytes needed to store an object of type T for
+     * which IsBitwisePackable<T>::value is true.
+     */
+    template <typename T>
+    constexpr std::size_t
+    bitwise_packed_size()
+    {
+      if constexpr (std::is_trivially_copyable_v<T>)
+        return sizeof(T);
+      else
+        return bitwise_packed_size<typename T::first_type>() +
+               bitwise_packed_size<typename T::second_type>();
+    }
+
+
+
+    /**
+     * Copy an object of type T for which IsBitwisePackable<T>::value is true
+     * bit for bit to the memory location @p dest, and advance @p dest
+     * past it.
+     */
+    template <typename T>
+    inline void
+    write_bitwise(const T &object, char *&dest)
+    {
+      if constexpr (std::is_trivially_copyable_v<T>)
+        {
+          std::memcpy(dest, &object, sizeof(T));
+          dest += sizeof(T);
+        }
+      else
+        {
+          write_bitwise(object.first, dest);
+          write_bitwise(object.second, dest);
+        }
+    }
+
+
+
+    /**
+     * The inverse of write_bitwise(): Copy the memory at @p src bit for
+     * bit into @p object, and advance @p src past it.
+     */
+    template <typename T>
+    inline void
+    read_bitwise(const char *&src, T &object)
+    {
+      if constexpr (std::is_trivially_copyable_v<T>)
+        {
+          std::memcpy(&object, src, sizeof(T));
+          src += sizeof(T);
+        }
+      else
+        {
+          read_bitwise(src, object.first);
+          read_bitwise(src, object.second);
+        }
+    }
+
+
+
     /**
      * A structure that is used to identify whether a template argument is a
      * std::vector<T> or std::vector<std::vector<T>> where T is a type that
-     * satisfies std::is_trivially_copyable_v<T> == true.
+     * satisfies IsBitwisePackable<T>::value == true, i.e., a type that
+     * satisfies std::is_trivially_copyable_v<T> == true or a std::pair of
+     * such types.
      */
     template <typename T>
     struct IsVectorOfTriviallyCopyable
@@ -1153,7 +1366,7 @@ namespace Utilities
     struct IsVectorOfTriviallyCopyable<std::vector<T>>
     {
       static constexpr bool value =
-        std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>;
+        IsBitwisePackable<T>::value && !std::is_same_v<T, bool>;
     };
 
 
@@ -1162,11 +1375,40 @@ namespace Utilities
     struct IsVectorOfTriviallyCopyable<std::vector<std::vector<T>>>
     {
       static constexpr bool value =
-        std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>;
+        IsBitwisePackable<T>::value && !std::is_same_v<T, bool>;
     };
 
 
 
+    /**
+     * Append the bit for bit copies of the elements in the range
+     * [@p begin, @p end) to @p dest_buffer, whose capacity must already be
+     * large enough. For trivially copyable types, this is a single copy
+     * operation.
+     */
+    template <typename T>
+    inline void
+    append_bitwise_to_buffer(const T           *begin,
+                             const T           *end,
+                             std::vector<char> &dest_buffer)
+    {
+      if constexpr (std::is_trivially_copyable_v<T>)
+        dest_buffer.insert(dest_buffer.end(),
+                           reinterpret_cast<const char *>(begin),
+                           reinterpret_cast<const char *>(end));
+      else
+        {
+          const std::size_t previous_size = dest_buffer.size();
+          dest_buffer.resize(previous_size +
+                             (end - begin) * bitwise_packed_size<T>());
+          char *dest = dest_buffer.data() + previous_size;
+          for (const T *p = begin; p != end; ++p)
+            write_bitwise(*p, dest);
+        }
+    }
+
+
+
     /**
      * A function that is used to append the contents of a std::vector<T>
      * (where T is a type that satisfies std::is_trivially_copyable_v<T>
@@ -1188,7 +1430,7 @@ namespace Utilities
 
     template <typename T,
               typename = std::enable_if_t<!std::is_same_v<T, bool> &&
-                                          std::is_trivially_copyable_v<T>>>
+                                          IsBitwisePackable<T>::value>>
     inline void
     append_vector_of_trivially_copyable_to_buffer(
       const std::vector<T> &object,
@@ -1199,7 +1441,7 @@ namespace Utilities
       // Reserve for the buffer so that it can store the size of 'object' as
       // well as all of its elements.
       dest_buffer.reserve(dest_buffer.size() + sizeof(vector_size) +
-                          vector_size * sizeof(T));
+                          vector_size * bitwise_packed_size<T>());
 
       // Copy the size into the vector
       dest_buffer.insert(dest_buffer.end(),
@@ -1208,17 +1450,16 @@ namespace Utilities
 
       // Insert the elements at the end of the vector:
       if (vector_size > 0)
-        dest_buffer.insert(dest_buffer.end(),
-                           reinterpret_cast<const char *>(object.data()),
-                           reinterpret_cast<const char *>(object.data() +
-                                                          vector_size));
+        append_bitwise_to_buffer(object.data(),
+                                 object.data() + vector_size,
+                                 dest_buffer);
     }
 
 
 
     template <typename T,
               typename = std::enable_if_t<!std::is_same_v<T, bool> &&
-                                          std::is_trivially_copyable_v<T>>>
+                                          IsBitwisePackable<T>::value>>
     inline void
     append_vector_of_trivially_copyable_to_buffer(
       const std::vector<std::vector<T>> &object,
@@ -1240,7 +1481,7 @@ namespace Utilities
       // well as all of its elements.
       dest_buffer.reserve(dest_buffer.size() +
                           sizeof(vector_size) * (1 + vector_size) +
-                          aggregated_size * sizeof(T));
+                          aggregated_size * bitwise_packed_size<T>());
 
       // Copy the size into the vector
       dest_buffer.insert(dest_buffer.end(),
@@ -1256,9 +1497,7 @@ namespace Utilities
 
       // Insert the elements at the end of the vector:
       for (const auto &a : object)
-        dest_buffer.insert(dest_buffer.end(),
-                           reinterpret_cast<const char *>(a.data()),
-                           reinterpret_cast<const char *>(a.data() + a.size()));
+        append_bitwise_to_buffer(a.data(), a.data() + a.size(), dest_buffer);
     }
 
 
@@ -1278,7 +1517,7 @@ namespace Utilities
 
     template <typename T,
               typename = std::enable_if_t<!std::is_same_v<T, bool> &&
-                                          std::is_trivially_copyable_v<T>>>
+                                          IsBitwisePackable<T>::value>>
     inline void
     create_vector_of_trivially_copyable_from_buffer(
       const std::vector<char>::const_iterator &cbegin,
@@ -1294,7 +1533,8 @@ namespace Utilities
 
       Assert(static_cast<std::ptrdiff_t>(cend - cbegin) ==
                static_cast<std::ptrdiff_t>(sizeof(vector_size) +
-                                           vector_size * sizeof(T)),
+                                           vector_size *
+                                             bitwise_packed_size<T>()),
              ExcMessage("The given buffer has the wrong size."));
       (void)cend;
 
@@ -1317,17 +1557,26 @@ namespace Utilities
       // In practice, the difference is likely rather small, assuming the
       // compiler does not already optimize away the first initialization.
       object.resize(vector_size);
-      if (vector_size > 0)
-        std::memcpy(object.data(),
-                    &*cbegin + sizeof(vector_size),
-                    vector_size * sizeof(T));
+      if constexpr (std::is_trivially_copyable_v<T>)
+        {
+          if (vector_size > 0)
+            std::memcpy(object.data(),
+                        &*cbegin + sizeof(vector_size),
+                        vector_size * sizeof(T));
+        }
+      else
+        {
+          const char *src = &*cbegin + sizeof(vector_size);
+          for (auto &entry : object)
+            read_bitwise(src, entry);
+        }
     }
 
 
 
     template <typename T,
               typename = std::enable_if_t<!std::is_same_v<T, bool> &&
-                                          std::is_trivially_copyable_v<T>>>
+                                          IsBitwisePackable<T>::value>>
     inline void
     create_vector_of_trivially_copyable_from_buffer(
       const std::vector<char>::const_iterator &cbegin,
@@ -1353,7 +1602,8 @@ namespace Utilities
         aggregated_size += a;
 
       Assert(static_cast<std::ptrdiff_t>(cend - iterator) ==
-               static_cast<std::ptrdiff_t>(aggregated_size * sizeof(T)),
+               static_cast<std::ptrdiff_t>(aggregated_size *
+                                           bitwise_packed_size<T>()),
              ExcMessage("The given buffer has the wrong size."));
       (void)cend;
 
@@ -1364,8 +1614,17 @@ namespace Utilities
         if (sizes[i] > 0)
           {
             object[i].resize(sizes[i]);
-            std::memcpy(object[i].data(), &*iterator, sizes[i] * sizeof(T));
-            iterator += sizes[i] * sizeof(T);
+            if constexpr (std::is_trivially_copyable_v<T>)
+              std::memcpy(object[i].data(),
+                          &*iterator,
+                          sizes[i] * sizeof(T));
+            else
+              {
+                const char *src = &*iterator;
+                for (auto &entry : object[i])
+                  read_bitwise(src, entry);
+              }
+            iterator += sizes[i] * bitwise_packed_size<T>();
           }
 
       Assert(iterator == cend,
@@ -1424,6 +1683,21 @@ namespace Utilities
 
         size = dest_buffer.size() - previous_size;
       }
+    // Pairs of bitwise copyable objects are copied member by member.
+    else if (!std::is_trivially_copyable_v<T> &&
+             internal::IsBitwisePackable<T>::value &&
+             (allow_compression == false))
+      {
+        if constexpr (internal::IsBitwisePackable<T>::value)
+          {
+            size = internal::bitwise_packed_size<T>();
+
+            const std::size_t previous_size = dest_buffer.size();
+            dest_buffer.resize(previous_size + size);
+            char *dest = dest_buffer.data() + previous_size;
+            internal::write_bitwise(object, dest);
+          }
+      }
     else
       {
         // use buffer as the target of a compressing
@@ -1510,6 +1784,22 @@ namespace Utilities
                                                                   object);
         return object;
       }
+    // Pairs of bitwise copyable objects are copied member by member.
+    else if (!std::is_trivially_copyable_v<T> &&
+             internal::IsBitwisePackable<T>::value &&
+             (allow_compression == false))
+      {
+        T object;
+        if constexpr (internal::IsBitwisePackable<T>::value)
+          {
+            Assert(static_cast<std::size_t>(std::distance(cbegin, cend)) ==
+                     internal::bitwise_packed_size<T>(),
+                   ExcMessage("The given buffer has the wrong size."));
+            const char *src = &*cbegin;
+            internal::read_bitwise(src, object);
+          }
+        return object;
+      }
     else
       {
         // decompress the buffer section into the object
@@ -50,14 +50,23 @@
 // very strange errors as the size of data structures differs between the
 // compiled deal.II code sitting in libdeal_II.so and the user code if not
 // detected.
-#  if DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 256 && !defined(__AVX__)
+#  if DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 256 && !defined(__AVX__) && \
+    !defined(__ARM_FEATURE_SVE)
 #    error \
       "Mismatch in vectorization capabilities: AVX was detected during configuration of deal.II and switched on, but it is apparently not available for the file you are trying to compile at the moment. Check compilation flags controlling the instruction set, such as -march=native."
 #  endif
-#  if DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 512 && !defined(__AVX512F__)
+#  if DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 512 && !defined(__AVX512F__) && \
+    !defined(__ARM_FEATURE_SVE)
 #    error \
       "Mismatch in vectorization capabilities: AVX-512F was detected during configuration of deal.II and switched on, but it is apparently not available for the file you are trying to compile at the moment. Check compilation flags controlling the instruction set, such as -march=native."
 #  endif
+#  if DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 256 && defined(__ARM_FEATURE_SVE)
+#    if !defined(__ARM_FEATURE_SVE_BITS) || \
+      __ARM_FEATURE_SVE_BITS != DEAL_II_VECTORIZATION_WIDTH_IN_BITS
+#      error \
+        "Mismatch in vectorization capabilities: SVE with a fixed vector length was detected during configuration of deal.II and switched on, but the vector length of the file you are trying to compile at the moment is different or not fixed. Check that the flag -msve-vector-bits is set to the same value as for deal.II."
+#    endif
+#  endif
 
 #  ifdef _MSC_VER
 #    include <intrin.h>
@@ -71,6 +80,9 @@
 #    undef bool
 #  elif defined(__ARM_NEON)
 #    include <arm_neon.h>
+#    ifdef __ARM_FEATURE_SVE
+#      include <arm_sve.h>
+#    endif
 #  elif defined(__x86_64__)
 #    include <x86intrin.h>
 #  endif
@@ -421,6 +433,16 @@ public:
  *  - VectorizedArray<double, 1>
  *  - VectorizedArray<double, 2>
  *
+ * and for ARM processors with SVE support, when both deal.II and the user
+ * code are compiled with a fixed vector length of 512 bits (e.g., with
+ * `-msve-vector-bits=512` on A64FX):
+ *  - VectorizedArray<double, 1> // no vectorization (auto-optimization)
+ *  - VectorizedArray<double, 2> // NEON
+ *  - VectorizedArray<double, 8> // SVE (default)
+ *
+ * In the case of a vector length of 256 bits (e.g., Graviton3), the SVE
+ * variant is VectorizedArray<double, 4>.
+ *
  * For older x86 processors or in case no processor-specific compilation flags
  * were added (i.e., without `-D CMAKE_CXX_FLAGS=-march=native` or similar
  * flags):
@@ -913,104 +935,699 @@ vectorized_load_and_transpose(const unsigned int                 n_entries,
 
 
 
-/**
- * This method stores the vectorized arrays in transposed form into the given
- * output array @p out with the given offsets @p offsets. This operation
- * corresponds to a transformation of a struct-of-array (input) into an
- * array-of-struct (output). This method operates on plain array, so no checks
- * for valid data access are made. It is the user's responsibility to ensure
- * that the given arrays are valid according to the access layout below.
- *
- * This method assumes that the specified offsets do not overlap. Otherwise,
- * the behavior is undefined in the vectorized case. It is the user's
- * responsibility to make sure that the access does not overlap and avoid
- * undefined behavior.
- *
- * The argument @p add_into selects where the entries should only be written
- * into the output arrays or the result should be added into the existing
- * entries in the output. For <code>add_into == false</code>, the following
- * code is assumed:
- *
- * @code
- * for (unsigned int i=0; i<n_entries; ++i)
- *   for (unsigned int v=0; v<VectorizedArray<Number>::size(); ++v)
- *     out[offsets[v]+i] = in[i][v];
- * @endcode
- *
- * For <code>add_into == true</code>, the code implements the following
- * action:
- * @code
- * for (unsigned int i=0; i<n_entries; ++i)
- *   for (unsigned int v=0; v<VectorizedArray<Number>::size(); ++v)
- *     out[offsets[v]+i] += in[i][v];
- * @endcode
- *
- * A more optimized version of this code will be used for supported types.
- *
- * This is the inverse operation to vectorized_load_and_transpose().
- *
- * @relatesalso VectorizedArray
- */
-template <typename Number, std::size_t width>
-inline DEAL_II_ALWAYS_INLINE void
-vectorized_transpose_and_store(const bool                            add_into,
-                               const unsigned int                    n_entries,
-                               const VectorizedArray<Number, width> *in,
-                               const unsigned int                   *offsets,
-                               Number                               *out)
-{
-  if (add_into)
-    for (unsigned int i = 0; i < n_entries; ++i)
-      for (unsigned int v = 0; v < VectorizedArray<Number, width>::size(); ++v)
-        out[offsets[v] + i] += in[i][v];
-  else
-    for (unsigned int i = 0; i < n_entries; ++i)
-      for (unsigned int v = 0; v < VectorizedArray<Number, width>::size(); ++v)
-        out[offsets[v] + i] = in[i][v];
-}
+/**
+ * This method stores the vectorized arrays in transposed form into the given
+ * output array @p out with the given offsets @p offsets. This operation
+ * corresponds to a transformation of a struct-of-array (input) into an
+ * array-of-struct (output). This method operates on plain array, so no checks
+ * for valid data access are made. It is the user's responsibility to ensure
+ * that the given arrays are valid according to the access layout below.
+ *
+ * This method assumes that the specified offsets do not overlap. Otherwise,
+ * the behavior is undefined in the vectorized case. It is the user's
+ * responsibility to make sure that the access does not overlap and avoid
+ * undefined behavior.
+ *
+ * The argument @p add_into selects where the entries should only be written
+ * into the output arrays or the result should be added into the existing
+ * entries in the output. For <code>add_into == false</code>, the following
+ * code is assumed:
+ *
+ * @code
+ * for (unsigned int i=0; i<n_entries; ++i)
+ *   for (unsigned int v=0; v<VectorizedArray<Number>::size(); ++v)
+ *     out[offsets[v]+i] = in[i][v];
+ * @endcode
+ *
+ * For <code>add_into == true</code>, the code implements the following
+ * action:
+ * @code
+ * for (unsigned int i=0; i<n_entries; ++i)
+ *   for (unsigned int v=0; v<VectorizedArray<Number>::size(); ++v)
+ *     out[offsets[v]+i] += in[i][v];
+ * @endcode
+ *
+ * A more optimized version of this code will be used for supported types.
+ *
+ * This is the inverse operation to vectorized_load_and_transpose().
+ *
+ * @relatesalso VectorizedArray
+ */
+template <typename Number, std::size_t width>
+inline DEAL_II_ALWAYS_INLINE void
+vectorized_transpose_and_store(const bool                            add_into,
+                               const unsigned int                    n_entries,
+                               const VectorizedArray<Number, width> *in,
+                               const unsigned int                   *offsets,
+                               Number                               *out)
+{
+  if (add_into)
+    for (unsigned int i = 0; i < n_entries; ++i)
+      for (unsigned int v = 0; v < VectorizedArray<Number, width>::size(); ++v)
+        out[offsets[v] + i] += in[i][v];
+  else
+    for (unsigned int i = 0; i < n_entries; ++i)
+      for (unsigned int v = 0; v < VectorizedArray<Number, width>::size(); ++v)
+        out[offsets[v] + i] = in[i][v];
+}
+
+
+/**
+ * The same as above with the difference that an array of pointers are
+ * passed in as input argument @p out.
+ *
+ * In analogy to the function above, one can consider that
+ * `out+offset[v]` is precomputed and passed as input argument.
+ *
+ * However, this function can also be used if some function returns an array
+ * of pointers and no assumption can be made that they belong to the same array,
+ * i.e., they can have their origin in different memory allocations.
+ */
+template <typename Number, std::size_t width>
+inline DEAL_II_ALWAYS_INLINE void
+vectorized_transpose_and_store(const bool                            add_into,
+                               const unsigned int                    n_entries,
+                               const VectorizedArray<Number, width> *in,
+                               std::array<Number *, width>          &out)
+{
+  if (add_into)
+    for (unsigned int i = 0; i < n_entries; ++i)
+      for (unsigned int v = 0; v < VectorizedArray<Number, width>::size(); ++v)
+        out[v][i] += in[i][v];
+  else
+    for (unsigned int i = 0; i < n_entries; ++i)
+      for (unsigned int v = 0; v < VectorizedArray<Number, width>::size(); ++v)
+        out[v][i] = in[i][v];
+}
+
+
+/** @} */
+
+#ifndef DOXYGEN
+
+#  if DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 128 && defined(__ARM_NEON)
+
+/**
+ * Specialization for double and ARM Neon.
+ */
+template <>
+class VectorizedArray<double, 2>
+  : public VectorizedArrayBase<VectorizedArray<double, 2>, 2>
+{
+public:
+  /**
+   * This gives the type of the array elements.
+   */
+  using value_type = double;
+
+  /**
+   * Record the fact that the given specialization of VectorizedArray is
+   * indeed implemented.
+   */
+  static constexpr bool is_implemented = true;
+
+  /**
+   * Default empty constructor, leaving the data in an uninitialized state
+   * similar to float/double.
+   */
+  VectorizedArray() = default;
+
+  /**
+   * Construct an array with the given scalar broadcast to all lanes.
+   */
+  VectorizedArray(const double scalar)
+  {
+    this->operator=(scalar);
+  }
+
+  /**
+   * Construct an array with the given initializer list.
+   */
+  template <typename U>
+  VectorizedArray(const std::initializer_list<U> &list)
+    : VectorizedArrayBase<VectorizedArray<double, 2>, 2>(list)
+  {}
+
+  /**
+   * This function can be used to set all data fields to a given scalar.
+   */
+  VectorizedArray &
+  operator=(const double x) &
+  {
+    data = vdupq_n_f64(x);
+    return *this;
+  }
+
+  /**
+   * Assign a scalar to the current object. This overload is used for
+   * rvalue references; because it does not make sense to assign
+   * something to a temporary, the function is deleted.
+   */
+  VectorizedArray &
+  operator=(const double scalar) && = delete;
+
+  /**
+   * Access operator.
+   */
+  double &
+  operator[](const unsigned int comp)
+  {
+    return *(reinterpret_cast<double *>(&data) + comp);
+  }
+
+  /**
+   * Constant access operator.
+   */
+  const double &
+  operator[](const unsigned int comp) const
+  {
+    return *(reinterpret_cast<const double *>(&data) + comp);
+  }
+
+  /**
+   * Element-wise addition of two arrays of numbers.
+   */
+  VectorizedArray &
+  operator+=(const VectorizedArray &vec)
+  {
+    data = vaddq_f64(data, vec.data);
+    return *this;
+  }
+
+  /**
+   * Element-wise subtraction of two arrays of numbers.
+   */
+  VectorizedArray &
+  operator-=(const VectorizedArray &vec)
+  {
+    data = vsubq_f64(data, vec.data);
+    return *this;
+  }
+
+  /**
+   * Element-wise multiplication of two arrays of numbers.
+   */
+  VectorizedArray &
+  operator*=(const VectorizedArray &vec)
+  {
+    data = vmulq_f64(data, vec.data);
+    return *this;
+  }
+
+  /**
+   * Element-wise division of two arrays of numbers.
+   */
+  VectorizedArray &
+  operator/=(const VectorizedArray &vec)
+  {
+    data = vdivq_f64(data, vec.data);
+    return *this;
+  }
+
+  /**
+   * Load @p size() from memory into the calling class, starting at
+   * the given address. The memory need not be aligned by 16 bytes, as opposed
+   * to casting a double address to VectorizedArray<double>*.
+   */
+  void
+  load(const double *ptr)
+  {
+    data = vld1q_f64(ptr);
+  }
+
+  DEAL_II_ALWAYS_INLINE
+  void
+  load(const float *ptr)
+  {
+    DEAL_II_OPENMP_SIMD_PRAGMA
+    for (unsigned int i = 0; i < 2; ++i)
+      data[i] = ptr[i];
+  }
+
+  /**
+   * Write the content of the calling class into memory in form of @p
+   * size() to the given address. The memory need not be aligned by
+   * 16 bytes, as opposed to casting a double address to
+   * VectorizedArray<double>*.
+   */
+  void
+  store(double *ptr) const
+  {
+    vst1q_f64(ptr, data);
+  }
+
+  DEAL_II_ALWAYS_INLINE
+  void
+  store(float *ptr) const
+  {
+    DEAL_II_OPENMP_SIMD_PRAGMA
+    for (unsigned int i = 0; i < 2; ++i)
+      ptr[i] = data[i];
+  }
+
+  /**
+   * @copydoc VectorizedArray<Number>::streaming_store()
+   * @note Memory must be aligned by 16 bytes.
+   */
+  DEAL_II_ALWAYS_INLINE
+  void
+  streaming_store(double *ptr) const
+  {
+    Assert(reinterpret_cast<std::size_t>(ptr) % 16 == 0,
+           ExcMessage("Memory not aligned"));
+    vst1q_f64(ptr, data);
+  }
+
+  /**
+   * Load @p size() from memory into the calling class, starting at
+   * the given address and with given offsets, each entry from the offset
+   * providing one element of the vectorized array.
+   *
+   * This operation corresponds to the following code (but uses a more
+   * efficient implementation in case the hardware allows for that):
+   * @code
+   * for (unsigned int v=0; v<VectorizedArray<Number>::size(); ++v)
+   *   this->operator[](v) = base_ptr[offsets[v]];
+   * @endcode
+   */
+  void
+  gather(const double *base_ptr, const unsigned int *offsets)
+  {
+    for (unsigned int i = 0; i < 2; ++i)
+      *(reinterpret_cast<double *>(&data) + i) = base_ptr[offsets[i]];
+  }
+
+  /**
+   * Write the content of the calling class into memory in form of @p
+   * size() to the given address and the given offsets, filling the
+   * elements of the vectorized array into each offset.
+   *
+   * This operation corresponds to the following code (but uses a more
+   * efficient implementation in case the hardware allows for that):
+   * @code
+   * for (unsigned int v=0; v<VectorizedArray<Number>::size(); ++v)
+   *   base_ptr[offsets[v]] = this->operator[](v);
+   * @endcode
+   */
+  void
+  scatter(const unsigned int *offsets, double *base_ptr) const
+  {
+    for (unsigned int i = 0; i < 2; ++i)
+      base_ptr[offsets[i]] = *(reinterpret_cast<const double *>(&data) + i);
+  }
+
+  /**
+   * Returns sum over entries of the data field, $\sum_{i=1}^{\text{size}()}
+   * this->data[i]$.
+   */
+  double
+  sum() const
+  {
+    return vaddvq_f64(data);
+  }
+
+  /**
+   * Actual data field. To be consistent with the standard layout type and to
+   * enable interaction with external SIMD functionality, this member is
+   * declared public.
+   */
+  mutable float64x2_t data;
+
+private:
+  /**
+   * Return the square root of this field. Not for use in user code. Use
+   * sqrt(x) instead.
+   */
+  VectorizedArray
+  get_sqrt() const
+  {
+    VectorizedArray res;
+    res.data = vsqrtq_f64(data);
+    return res;
+  }
+
+  /**
+   * Return the absolute value of this field. Not for use in user code. Use
+   * abs(x) instead.
+   */
+  VectorizedArray
+  get_abs() const
+  {
+    VectorizedArray res;
+    res.data = vabsq_f64(data);
+    return res;
+  }
+
+  /**
+   * Return the component-wise maximum of this field and another one. Not for
+   * use in user code. Use max(x,y) instead.
+   */
+  VectorizedArray
+  get_max(const VectorizedArray &other) const
+  {
+    VectorizedArray res;
+    res.data = vmaxq_f64(data, other.data);
+    return res;
+  }
+
+  /**
+   * Return the component-wise minimum of this field and another one. Not for
+   * use in user code. Use min(x,y) instead.
+   */
+  VectorizedArray
+  get_min(const VectorizedArray &other) const
+  {
+    VectorizedArray res;
+    res.data = vminq_f64(data, other.data);
+    return res;
+  }
+
+  // Make a few functions friends.
+  template <typename Number2, std::size_t width2>
+  friend VectorizedArray<Number2, width2>
+  std::sqrt(const VectorizedArray<Number2, width2> &);
+  template <typename Number2, std::size_t width2>
+  friend VectorizedArray<Number2, width2>
+  std::abs(const VectorizedArray<Number2, width2> &);
+  template <typename Number2, std::size_t width2>
+  friend VectorizedArray<Number2, width2>
+  std::max(const VectorizedArray<Number2, width2> &,
+           const VectorizedArray<Number2, width2> &);
+  template <typename Number2, std::size_t width2>
+  friend VectorizedArray<Number2, width2>
+  std::min(const VectorizedArray<Number2, width2> &,
+           const VectorizedArray<Number2, width2> &);
+};
+
+/**
+ * Specialization for float and ARM Neon.
+ */
+template <>
+class VectorizedArray<float, 4>
+  : public VectorizedArrayBase<VectorizedArray<float, 4>, 4>
+{
+public:
+  /**
+   * This gives the type of the array elements.
+   */
+  using value_type = float;
+
+  /**
+   * Record the fact that the given specialization of VectorizedArray is
+   * indeed implemented.
+   */
+  static constexpr bool is_implemented = true;
+
+  /**
+   * Default empty constructor, leaving the data in an uninitialized state
+   * similar to float/double.
+   */
+  VectorizedArray() = default;
+
+  /**
+   * Construct an array with the given scalar broadcast to all lanes.
+   */
+  VectorizedArray(const float scalar)
+  {
+    this->operator=(scalar);
+  }
+
+  /**
+   * Construct an array with the given initializer list.
+   */
+  template <typename U>
+  VectorizedArray(const std::initializer_list<U> &list)
+    : VectorizedArrayBase<VectorizedArray<float, 4>, 4>(list)
+  {}
+
+  /**
+   * This function can be used to set all data fields to a given scalar.
+   */
+  VectorizedArray &
+  operator=(const float x) &
+  {
+    data = vdupq_n_f32(x);
+    return *this;
+  }
+
+  /**
+   * Assign a scalar to the current object. This overload is used for
+   * rvalue references; because it does not make sense to assign
+   * something to a temporary, the function is deleted.
+   */
+  VectorizedArray &
+  operator=(const float scalar) && = delete;
+
+  /**
+   * Access operator.
+   */
+  value_type &
+  operator[](const unsigned int comp)
+  {
+    return *(reinterpret_cast<float *>(&data) + comp);
+  }
+
+  /**
+   * Constant access operator.
+   */
+  const value_type &
+  operator[](const unsigned int comp) const
+  {
+    return *(reinterpret_cast<const float *>(&data) + comp);
+  }
+
+  /**
+   * Element-wise addition of two arrays of numbers.
+   */
+  VectorizedArray &
+  operator+=(const VectorizedArray &vec)
+  {
+    data = vaddq_f32(data, vec.data);
+    return *this;
+  }
+
+  /**
+   * Element-wise subtraction of two arrays of numbers.
+   */
+  VectorizedArray &
+  operator-=(const VectorizedArray &vec)
+  {
+    data = vsubq_f32(data, vec.data);
+    return *this;
+  }
+
+  /**
+   * Element-wise multiplication of two arrays of numbers.
+   */
+  VectorizedArray &
+  operator*=(const VectorizedArray &vec)
+  {
+    data = vmulq_f32(data, vec.data);
+    return *this;
+  }
+
+  /**
+   * Element-wise division of two arrays of numbers.
+   */
+  VectorizedArray &
+  operator/=(const VectorizedArray &vec)
+  {
+    data = vdivq_f32(data, vec.data);
+    return *this;
+  }
+
+  /**
+   * Load @p size() from memory into the calling class, starting at
+   * the given address. The memory need not be aligned by 16 bytes, as opposed
+   * to casting a float address to VectorizedArray<float>*.
+   */
+  void
+  load(const float *ptr)
+  {
+    data = vld1q_f32(ptr);
+  }
+
+  /**
+   * Write the content of the calling class into memory in form of @p
+   * size() to the given address. The memory need not be aligned by
+   * 16 bytes, as opposed to casting a float address to
+   * VectorizedArray<float>*.
+   */
+  void
+  store(float *ptr) const
+  {
+    vst1q_f32(ptr, data);
+  }
+
+  /**
+   * @copydoc VectorizedArray<Number>::streaming_store()
+   * @note Memory must be aligned by 16 bytes.
+   */
+  DEAL_II_ALWAYS_INLINE
+  void
+  streaming_store(float *ptr) const
+  {
+    Assert(reinterpret_cast<std::size_t>(ptr) % 16 == 0,
+           ExcMessage("Memory not aligned"));
+    vst1q_f32(ptr, data);
+  }
+
+  /**
+   * Load @p size() from memory into the calling class, starting at
+   * the given address and with given offsets, each entry from the offset
+   * providing one element of the vectorized array.
+   *
+   * This operation corresponds to the following code (but uses a more
+   * efficient implementation in case the hardware allows for that):
+   * @code
+   * for (unsigned int v=0; v<VectorizedArray<Number>::size(); ++v)
+   *   this->operator[](v) = base_ptr[offsets[v]];
+   * @endcode
+   */
+  void
+  gather(const float *base_ptr, const unsigned int *offsets)
+  {
+    for (unsigned int i = 0; i < 4; ++i)
+      *(reinterpret_cast<float *>(&data) + i) = base_ptr[offsets[i]];
+  }
+
+  /**
+   * Write the content of the calling class into memory in form of @p
+   * size() to the given address and the given offsets, filling the
+   * elements of the vectorized array into each offset.
+   *
+   * This operation corresponds to the following code (but uses a more
+   * efficient implementation in case the hardware allows for that):
+   * @code
+   * for (unsigned int v=0; v<VectorizedArray<Number>::size(); ++v)
+   *   base_ptr[offsets[v]] = this->operator[](v);
+   * @endcode
+   */
+  void
+  scatter(const unsigned int *offsets, float *base_ptr) const
+  {
+    for (unsigned int i = 0; i < 4; ++i)
+      base_ptr[offsets[i]] = *(reinterpret_cast<const float *>(&data) + i);
+  }
+
+  /**
+   * Returns sum over entries of the data field, $\sum_{i=1}^{\text{size}()}
+   * this->data[i]$.
+   */
+  float
+  sum() const
+  {
+    return vaddvq_f32(data);
+  }
+
+  /**
+   * Actual data field. To be consistent with the standard layout type and to
+   * enable interaction with external SIMD functionality, this member is
+   * declared public.
+   */
+  mutable float32x4_t data;
+
+private:
+  /**
+   * Return the square root of this field. Not for use in user code. Use
+   * sqrt(x) instead.
+   */
+  VectorizedArray
+  get_sqrt() const
+  {
+    VectorizedArray res;
+    res.data = vsqrtq_f32(data);
+    return res;
+  }
+
+  /**
+   * Return the absolute value of this field. Not for use in user code. Use
+   * abs(x) instead.
+   */
+  VectorizedArray
+  get_abs() const
+  {
+    VectorizedArray res;
+    res.data = vabsq_f32(data);
+    return res;
+  }
+
+  /**
+   * Return the component-wise maximum of this field and another one. Not for
+   * use in user code. Use max(x,y) instead.
+   */
+  VectorizedArray
+  get_max(const VectorizedArray &other) const
+  {
+    VectorizedArray res;
+    res.data = vmaxq_f32(data, other.data);
+    return res;
+  }
+
+  /**
+   * Return the component-wise minimum of this field and another one. Not for
+   * use in user code. Use min(x,y) instead.
+   */
+  VectorizedArray
+  get_min(const VectorizedArray &other) const
+  {
+    VectorizedArray res;
+    res.data = vminq_f32(data, other.data);
+    return res;
+  }
 
+  // Make a few functions friends.
+  template <typename Number2, std::size_t width2>
+  friend VectorizedArray<Number2, width2>
+  std::sqrt(const VectorizedArray<Number2, width2> &);
+  template <typename Number2, std::size_t width2>
+  friend VectorizedArray<Number2, width2>
+  std::abs(const VectorizedArray<Number2, width2> &);
+  template <typename Number2, std::size_t width2>
+  friend VectorizedArray<Number2, width2>
+  std::max(const VectorizedArray<Number2, width2> &,
+           const VectorizedArray<Number2, width2> &);
+  template <typename Number2, std::size_t width2>
+  friend VectorizedArray<Number2, width2>
+  std::min(const VectorizedArray<Number2, width2> &,
+           const VectorizedArray<Number2, width2> &);
+};
 
-/**
- * The same as above with the difference that an array of pointers are
- * passed in as input argument @p out.
- *
- * In analogy to the function above, one can consider that
- * `out+offset[v]` is precomputed and passed as input argument.
- *
- * However, this function can also be used if some function returns an array
- * of pointers and no assumption can be made that they belong to the same array,
- * i.e., they can have their origin in different memory allocations.
- */
-template <typename Number, std::size_t width>
-inline DEAL_II_ALWAYS_INLINE void
-vectorized_transpose_and_store(const bool                            add_into,
-                               const unsigned int                    n_entries,
-                               const VectorizedArray<Number, width> *in,
-                               std::array<Number *, width>          &out)
-{
-  if (add_into)
-    for (unsigned int i = 0; i < n_entries; ++i)
-      for (unsigned int v = 0; v < VectorizedArray<Number, width>::size(); ++v)
-        out[v][i] += in[i][v];
-  else
-    for (unsigned int i = 0; i < n_entries; ++i)
-      for (unsigned int v = 0; v < VectorizedArray<Number, width>::size(); ++v)
-        out[v][i] = in[i][v];
-}
 
+#  endif
 
-/** @} */
+#  if DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 256 && \
+    defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS)
 
-#ifndef DOXYGEN
+namespace internal
+{
+  /**
+   * Versions of the SVE vector types with the vector length set by the
+   * compiler flag <code>-msve-vector-bits</code>. In contrast to the
+   * sizeless types of the SVE intrinsics, these types can be used as
+   * members of classes.
+   */
+  typedef svfloat64_t SVEFloat64
+    __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+  typedef svfloat32_t SVEFloat32
+    __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
 
-#  if DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 128 && defined(__ARM_NEON)
+  /**
+   * The number of lanes of the SVE vector types.
+   */
+  constexpr std::size_t n_sve_lanes_double = __ARM_FEATURE_SVE_BITS / 64;
+  constexpr std::size_t n_sve_lanes_float  = __ARM_FEATURE_SVE_BITS / 32;
+} // namespace internal
 
 /**
- * Specialization for double and ARM Neon.
+ * Specialization for double and ARM SVE with a vector length fixed at
+ * compile time by the flag <code>-msve-vector-bits</code>.
  */
 template <>
-class VectorizedArray<double, 2>
-  : public VectorizedArrayBase<VectorizedArray<double, 2>, 2>
+class VectorizedArray<double, internal::n_sve_lanes_double>
+  : public VectorizedArrayBase<
+      VectorizedArray<double, internal::n_sve_lanes_double>,
+      internal::n_sve_lanes_double>
 {
 public:
   /**
@@ -1043,7 +1660,8 @@ public:
    */
   template <typename U>
   VectorizedArray(const std::initializer_list<U> &list)
-    : VectorizedArrayBase<VectorizedArray<double, 2>, 2>(list)
+    : VectorizedArrayBase<VectorizedArray<double, internal::n_sve_lanes_double>,
+                          internal::n_sve_lanes_double>(list)
   {}
 
   /**
@@ -1052,7 +1670,7 @@ public:
   VectorizedArray &
   operator=(const double x) &
   {
-    data = vdupq_n_f64(x);
+    data = svdup_n_f64(x);
     return *this;
   }
 
@@ -1088,7 +1706,7 @@ public:
   VectorizedArray &
   operator+=(const VectorizedArray &vec)
   {
-    data = vaddq_f64(data, vec.data);
+    data = svadd_f64_x(svptrue_b64(), data, vec.data);
     return *this;
   }
 
@@ -1098,7 +1716,7 @@ public:
   VectorizedArray &
   operator-=(const VectorizedArray &vec)
   {
-    data = vsubq_f64(data, vec.data);
+    data = svsub_f64_x(svptrue_b64(), data, vec.data);
     return *this;
   }
 
@@ -1108,7 +1726,7 @@ public:
   VectorizedArray &
   operator*=(const VectorizedArray &vec)
   {
-    data = vmulq_f64(data, vec.data);
+    data = svmul_f64_x(svptrue_b64(), data, vec.data);
     return *this;
   }
 
@@ -1118,19 +1736,18 @@ public:
   VectorizedArray &
   operator/=(const VectorizedArray &vec)
   {
-    data = vdivq_f64(data, vec.data);
+    data = svdiv_f64_x(svptrue_b64(), data, vec.data);
     return *this;
   }
 
   /**
    * Load @p size() from memory into the calling class, starting at
-   * the given address. The memory need not be aligned by 16 bytes, as opposed
-   * to casting a double address to VectorizedArray<double>*.
+   * the given address. The memory need not be aligned.
    */
   void
   load(const double *ptr)
   {
-    data = vld1q_f64(ptr);
+    data = svld1_f64(svptrue_b64(), ptr);
   }
 
   DEAL_II_ALWAYS_INLINE
@@ -1138,20 +1755,18 @@ public:
   load(const float *ptr)
   {
     DEAL_II_OPENMP_SIMD_PRAGMA
-    for (unsigned int i = 0; i < 2; ++i)
-      data[i] = ptr[i];
+    for (unsigned int i = 0; i < internal::n_sve_lanes_double; ++i)
+      operator[](i) = ptr[i];
   }
 
   /**
    * Write the content of the calling class into memory in form of @p
-   * size() to the given address. The memory need not be aligned by
-   * 16 bytes, as opposed to casting a double address to
-   * VectorizedArray<double>*.
+   * size() to the given address. The memory need not be aligned.
    */
   void
   store(double *ptr) const
   {
-    vst1q_f64(ptr, data);
+    svst1_f64(svptrue_b64(), ptr, data);
   }
 
   DEAL_II_ALWAYS_INLINE
@@ -1159,21 +1774,18 @@ public:
   store(float *ptr) const
   {
     DEAL_II_OPENMP_SIMD_PRAGMA
-    for (unsigned int i = 0; i < 2; ++i)
-      ptr[i] = data[i];
+    for (unsigned int i = 0; i < internal::n_sve_lanes_double; ++i)
+      ptr[i] = operator[](i);
   }
 
   /**
    * @copydoc VectorizedArray<Number>::streaming_store()
-   * @note Memory must be aligned by 16 bytes.
    */
   DEAL_II_ALWAYS_INLINE
   void
   streaming_store(double *ptr) const
   {
-    Assert(reinterpret_cast<std::size_t>(ptr) % 16 == 0,
-           ExcMessage("Memory not aligned"));
-    vst1q_f64(ptr, data);
+    svstnt1_f64(svptrue_b64(), ptr, data);
   }
 
   /**
@@ -1191,8 +1803,9 @@ public:
   void
   gather(const double *base_ptr, const unsigned int *offsets)
   {
-    for (unsigned int i = 0; i < 2; ++i)
-      *(reinterpret_cast<double *>(&data) + i) = base_ptr[offsets[i]];
+    const svbool_t   all     = svptrue_b64();
+    const svuint64_t indices = svld1uw_u64(all, offsets);
+    data = svld1_gather_u64index_f64(all, base_ptr, indices);
   }
 
   /**
@@ -1210,8 +1823,9 @@ public:
   void
   scatter(const unsigned int *offsets, double *base_ptr) const
   {
-    for (unsigned int i = 0; i < 2; ++i)
-      base_ptr[offsets[i]] = *(reinterpret_cast<const double *>(&data) + i);
+    const svbool_t   all     = svptrue_b64();
+    const svuint64_t indices = svld1uw_u64(all, offsets);
+    svst1_scatter_u64index_f64(all, base_ptr, indices, data);
   }
 
   /**
@@ -1221,7 +1835,7 @@ public:
   double
   sum() const
   {
-    return vaddvq_f64(data);
+    return svaddv_f64(svptrue_b64(), data);
   }
 
   /**
@@ -1229,7 +1843,7 @@ public:
    * enable interaction with external SIMD functionality, this member is
    * declared public.
    */
-  mutable float64x2_t data;
+  mutable internal::SVEFloat64 data;
 
 private:
   /**
@@ -1240,7 +1854,7 @@ private:
   get_sqrt() const
   {
     VectorizedArray res;
-    res.data = vsqrtq_f64(data);
+    res.data = svsqrt_f64_x(svptrue_b64(), data);
     return res;
   }
 
@@ -1252,7 +1866,7 @@ private:
   get_abs() const
   {
     VectorizedArray res;
-    res.data = vabsq_f64(data);
+    res.data = svabs_f64_x(svptrue_b64(), data);
     return res;
   }
 
@@ -1264,7 +1878,7 @@ private:
   get_max(const VectorizedArray &other) const
   {
     VectorizedArray res;
-    res.data = vmaxq_f64(data, other.data);
+    res.data = svmax_f64_x(svptrue_b64(), data, other.data);
     return res;
   }
 
@@ -1276,7 +1890,7 @@ private:
   get_min(const VectorizedArray &other) const
   {
     VectorizedArray res;
-    res.data = vminq_f64(data, other.data);
+    res.data = svmin_f64_x(svptrue_b64(), data, other.data);
     return res;
   }
 
@@ -1298,11 +1912,14 @@ private:
 };
 
 /**
- * Specialization for float and ARM Neon.
+ * Specialization for float and ARM SVE with a vector length fixed at
+ * compile time by the flag <code>-msve-vector-bits</code>.
  */
 template <>
-class VectorizedArray<float, 4>
-  : public VectorizedArrayBase<VectorizedArray<float, 4>, 4>
+class VectorizedArray<float, internal::n_sve_lanes_float>
+  : public VectorizedArrayBase<
+      VectorizedArray<float, internal::n_sve_lanes_float>,
+      internal::n_sve_lanes_float>
 {
 public:
   /**
@@ -1335,7 +1952,8 @@ public:
    */
   template <typename U>
   VectorizedArray(const std::initializer_list<U> &list)
-    : VectorizedArrayBase<VectorizedArray<float, 4>, 4>(list)
+    : VectorizedArrayBase<VectorizedArray<float, internal::n_sve_lanes_float>,
+                          internal::n_sve_lanes_float>(list)
   {}
 
   /**
@@ -1344,7 +1962,7 @@ public:
   VectorizedArray &
   operator=(const float x) &
   {
-    data = vdupq_n_f32(x);
+    data = svdup_n_f32(x);
     return *this;
   }
 
@@ -1359,7 +1977,7 @@ public:
   /**
    * Access operator.
    */
-  value_type &
+  float &
   operator[](const unsigned int comp)
   {
     return *(reinterpret_cast<float *>(&data) + comp);
@@ -1368,7 +1986,7 @@ public:
   /**
    * Constant access operator.
    */
-  const value_type &
+  const float &
   operator[](const unsigned int comp) const
   {
     return *(reinterpret_cast<const float *>(&data) + comp);
@@ -1380,7 +1998,7 @@ public:
   VectorizedArray &
   operator+=(const VectorizedArray &vec)
   {
-    data = vaddq_f32(data, vec.data);
+    data = svadd_f32_x(svptrue_b32(), data, vec.data);
     return *this;
   }
 
@@ -1390,7 +2008,7 @@ public:
   VectorizedArray &
   operator-=(const VectorizedArray &vec)
   {
-    data = vsubq_f32(data, vec.data);
+    data = svsub_f32_x(svptrue_b32(), data, vec.data);
     return *this;
   }
 
@@ -1400,7 +2018,7 @@ public:
   VectorizedArray &
   operator*=(const VectorizedArray &vec)
   {
-    data = vmulq_f32(data, vec.data);
+    data = svmul_f32_x(svptrue_b32(), data, vec.data);
     return *this;
   }
 
@@ -1410,44 +2028,38 @@ public:
   VectorizedArray &
   operator/=(const VectorizedArray &vec)
   {
-    data = vdivq_f32(data, vec.data);
+    data = svdiv_f32_x(svptrue_b32(), data, vec.data);
     return *this;
   }
 
   /**
    * Load @p size() from memory into the calling class, starting at
-   * the given address. The memory need not be aligned by 16 bytes, as opposed
-   * to casting a float address to VectorizedArray<float>*.
+   * the given address. The memory need not be aligned.
    */
   void
   load(const float *ptr)
   {
-    data = vld1q_f32(ptr);
+    data = svld1_f32(svptrue_b32(), ptr);
   }
 
   /**
    * Write the content of the calling class into memory in form of @p
-   * size() to the given address. The memory need not be aligned by
-   * 16 bytes, as opposed to casting a float address to
-   * VectorizedArray<float>*.
+   * size() to the given address. The memory need not be aligned.
    */
   void
   store(float *ptr) const
   {
-    vst1q_f32(ptr, data);
+    svst1_f32(svptrue_b32(), ptr, data);
   }
 
   /**
    * @copydoc VectorizedArray<Number>::streaming_store()
-   * @note Memory must be aligned by 16 bytes.
    */
   DEAL_II_ALWAYS_INLINE
   void
   streaming_store(float *ptr) const
   {
-    Assert(reinterpret_cast<std::size_t>(ptr) % 16 == 0,
-           ExcMessage("Memory not aligned"));
-    vst1q_f32(ptr, data);
+    svstnt1_f32(svptrue_b32(), ptr, data);
   }
 
   /**
@@ -1465,8 +2077,9 @@ public:
   void
   gather(const float *base_ptr, const unsigned int *offsets)
   {
-    for (unsigned int i = 0; i < 4; ++i)
-      *(reinterpret_cast<float *>(&data) + i) = base_ptr[offsets[i]];
+    const svbool_t   all     = svptrue_b32();
+    const svuint32_t indices = svld1_u32(all, offsets);
+    data = svld1_gather_u32index_f32(all, base_ptr, indices);
   }
 
   /**
@@ -1484,8 +2097,9 @@ public:
   void
   scatter(const unsigned int *offsets, float *base_ptr) const
   {
-    for (unsigned int i = 0; i < 4; ++i)
-      base_ptr[offsets[i]] = *(reinterpret_cast<const float *>(&data) + i);
+    const svbool_t   all     = svptrue_b32();
+    const svuint32_t indices = svld1_u32(all, offsets);
+    svst1_scatter_u32index_f32(all, base_ptr, indices, data);
   }
 
   /**
@@ -1495,7 +2109,7 @@ public:
   float
   sum() const
   {
-    return vaddvq_f32(data);
+    return svaddv_f32(svptrue_b32(), data);
   }
 
   /**
@@ -1503,7 +2117,7 @@ public:
    * enable interaction with external SIMD functionality, this member is
    * declared public.
    */
-  mutable float32x4_t data;
+  mutable internal::SVEFloat32 data;
 
 private:
   /**
@@ -1514,7 +2128,7 @@ private:
   get_sqrt() const
   {
     VectorizedArray res;
-    res.data = vsqrtq_f32(data);
+    res.data = svsqrt_f32_x(svptrue_b32(), data);
     return res;
   }
 
@@ -1526,7 +2140,7 @@ private:
   get_abs() const
   {
     VectorizedArray res;
-    res.data = vabsq_f32(data);
+    res.data = svabs_f32_x(svptrue_b32(), data);
     return res;
   }
 
@@ -1538,7 +2152,7 @@ private:
   get_max(const VectorizedArray &other) const
   {
     VectorizedArray res;
-    res.data = vmaxq_f32(data, other.data);
+    res.data = svmax_f32_x(svptrue_b32(), data, other.data);
     return res;
   }
 
@@ -1550,7 +2164,7 @@ private:
   get_min(const VectorizedArray &other) const
   {
     VectorizedArray res;
-    res.data = vminq_f32(data, other.data);
+    res.data = svmin_f32_x(svptrue_b32(), data, other.data);
     return res;
   }
 
@@ -1571,7 +2185,6 @@ private:
            const VectorizedArray<Number2, width2> &);
 };
 
-
 #  endif
 
 #  if DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 128 && defined(__SSE2__)
@@ -6394,6 +7007,88 @@ compare_and_apply_mask(const VectorizedArray<double, 2> &left,
   return result;
 }
 
+#  endif
+#  if DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 256 && \
+    defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS)
+
+template <SIMDComparison predicate>
+DEAL_II_ALWAYS_INLINE inline VectorizedArray<double,
+                                             internal::n_sve_lanes_double>
+compare_and_apply_mask(
+  const VectorizedArray<double, internal::n_sve_lanes_double> &left,
+  const VectorizedArray<double, internal::n_sve_lanes_double> &right,
+  const VectorizedArray<double, internal::n_sve_lanes_double> &true_values,
+  const VectorizedArray<double, internal::n_sve_lanes_double> &false_values)
+{
+  const svbool_t all = svptrue_b64();
+  svbool_t       mask;
+  switch (predicate)
+    {
+      case SIMDComparison::equal:
+        mask = svcmpeq_f64(all, left.data, right.data);
+        break;
+      case SIMDComparison::not_equal:
+        mask = svcmpne_f64(all, left.data, right.data);
+        break;
+      case SIMDComparison::less_than:
+        mask = svcmplt_f64(all, left.data, right.data);
+        break;
+      case SIMDComparison::less_than_or_equal:
+        mask = svcmple_f64(all, left.data, right.data);
+        break;
+      case SIMDComparison::greater_than:
+        mask = svcmpgt_f64(all, left.data, right.data);
+        break;
+      case SIMDComparison::greater_than_or_equal:
+        mask = svcmpge_f64(all, left.data, right.data);
+        break;
+    }
+
+  VectorizedArray<double, internal::n_sve_lanes_double> result;
+  result.data = svsel_f64(mask, true_values.data, false_values.data);
+
+  return result;
+}
+
+
+template <SIMDComparison predicate>
+DEAL_II_ALWAYS_INLINE inline VectorizedArray<float, internal::n_sve_lanes_float>
+compare_and_apply_mask(
+  const VectorizedArray<float, internal::n_sve_lanes_float> &left,
+  const VectorizedArray<float, internal::n_sve_lanes_float> &right,
+  const VectorizedArray<float, internal::n_sve_lanes_float> &true_values,
+  const VectorizedArray<float, internal::n_sve_lanes_float> &false_values)
+{
+  const svbool_t all = svptrue_b32();
+  svbool_t       mask;
+  switch (predicate)
+    {
+      case SIMDComparison::equal:
+        mask = svcmpeq_f32(all, left.data, right.data);
+        break;
+      case SIMDComparison::not_equal:
+        mask = svcmpne_f32(all, left.data, right.data);
+        break;
+      case SIMDComparison::less_than:
+        mask = svcmplt_f32(all, left.data, right.data);
+        break;
+      case SIMDComparison::less_than_or_equal:
+        mask = svcmple_f32(all, left.data, right.data);
+        break;
+      case SIMDComparison::greater_than:
+        mask = svcmpgt_f32(all, left.data, right.data);
+        break;
+      case SIMDComparison::greater_than_or_equal:
+        mask = svcmpge_f32(all, left.data, right.data);
+        break;
+    }
+
+  VectorizedArray<float, internal::n_sve_lanes_float> result;
+  result.data = svsel_f32(mask, true_values.data, false_values.data);
+
+  return result;
+}
+
 #  endif
 #endif // DOXYGEN
 
@@ -708,17 +708,24 @@ namespace WorkStream
     /**
      * Mostly a copy of the 2nd implementation of the Workstream paper taking
      * advantage of thread local lists for re-use. Uses taskflow for task
-     * scheduling rather than TBB. Currently does not support chunking.
+     * scheduling rather than TBB.
      */
 
 
     namespace taskflow_no_coloring
     {
       /**
-       * The main run function for the taskflow colorless implementation. The
-       * last two arguments in this function are for chunking support which
-       * currently does not exist but ideally will later. For now they are
-       * ignored but still here to permit existing programs to function
+       * The main run function for the taskflow colorless implementation.
+       *
+       * Like the TBB implementation, this function groups @p chunk_size
+       * consecutive iterators into one item that is handled by a single
+       * worker and a single copier task, and it keeps at most
+       * @p queue_length items in flight at any given time. The CopyData
+       * objects of the items are stored in a ring buffer with
+       * @p queue_length slots and are re-used for all items that map to the
+       * same slot, rather than being allocated anew for each item. The
+       * worker of an item only starts once the copier of the item that
+       * previously used the same slot has finished.
        */
       template <typename Worker,
                 typename Copier,
@@ -732,9 +739,8 @@ namespace WorkStream
           Copier                                      copier,
           const ScratchData                          &sample_scratch_data,
           const CopyData                             &sample_copy_data,
-          const unsigned int /*queue_length*/ = 2 *
-                                                MultithreadInfo::n_threads(),
-          const unsigned int /*chunk_size*/ = 8)
+          const unsigned int queue_length = 2 * MultithreadInfo::n_threads(),
+          const unsigned int chunk_size   = 8)
 
       {
         tf::Executor &executor = MultithreadInfo::get_taskflow_executor();
@@ -745,31 +751,45 @@ namespace WorkStream
         Threads::ThreadLocalStorage<ScratchDataList>
           thread_safe_scratch_data_list;
 
-        tf::Task last_copier;
-
-        // idx is used to connect each worker to its copier as communication
-        // between tasks is not supported. It does this by providing a unique
-        // index in the vector of pointers copy_datas at which the copy data
-        // object where the work done by work task #idx is stored
-        unsigned int idx = 0;
+        // The ring buffer of CopyData objects. Slot number idx%queue_length
+        // holds the CopyData objects of item #idx, which connects each worker
+        // to its copier as communication between tasks is not supported. The
+        // objects of a slot are created by the first worker that uses the
+        // slot, so that they are first touched by a worker thread. Since the
+        // number of items is not known in advance, we need to reserve the
+        // maximal number of slots so that the references captured by the
+        // tasks below stay valid.
+        std::vector<std::vector<CopyData>> copy_datas(queue_length);
+
+        // The copier tasks of all items generated so far, to let the worker
+        // of item #idx wait for the copier of item #(idx-queue_length) that
+        // used the same slot before.
+        std::vector<tf::Task> copier_tasks;
+
+        // Generate a static task graph. Here we generate a task for each
+        // chunk of iterators that will be worked on. The tasks are not
+        // executed until all of them are created, this code runs
+        // sequentially.
+        Iterator it = begin;
+        for (unsigned int idx = 0; it != end; ++idx)
+          {
+            std::vector<Iterator> iterators;
+            iterators.reserve(chunk_size);
+            for (; it != end && iterators.size() < chunk_size; ++it)
+              iterators.push_back(it);
 
-        std::vector<std::unique_ptr<CopyData>> copy_datas;
+            const unsigned int     n_iterators = iterators.size();
+            std::vector<CopyData> &copy_data_slot =
+              copy_datas[idx % queue_length];
 
-        // Generate a static task graph. Here we generate a task for each cell
-        // that will be worked on. The tasks are not executed until all of them
-        // are created, this code runs sequentially.
-        for (Iterator it = begin; it != end; ++it, ++idx)
-          {
-            copy_datas.emplace_back();
             // Create a worker task.
             auto worker_task =
               taskflow
-                .emplace([it,
-                          idx,
+                .emplace([iterators = std::move(iterators),
+                          &copy_data_slot,
                           &thread_safe_scratch_data_list,
                           &sample_scratch_data,
                           &sample_copy_data,
-                          &copy_datas,
                           &worker]() {
                   ScratchData *scratch_data = nullptr;
 
@@ -797,11 +817,14 @@ namespace WorkStream
                         scratch_data_list.back().scratch_data.get();
                     }
 
-                  // Create a unique copy data object where this
-                  // worker's work will be stored.
-                  auto &copy = copy_datas[idx];
-                  copy       = std::make_unique<CopyData>(sample_copy_data);
-                  worker(it, *scratch_data, *copy.get());
+                  // Make sure there are enough copy data objects in the slot
+                  // of this item, and re-use the ones left over from the
+                  // previous item of this slot otherwise.
+                  while (copy_data_slot.size() < iterators.size())
+                    copy_data_slot.push_back(sample_copy_data);
+
+                  for (unsigned int i = 0; i < iterators.size(); ++i)
+                    worker(iterators[i], *scratch_data, copy_data_slot[i]);
 
                   // Find our currently used scratch data and
                   // mark it as unused.
@@ -819,12 +842,13 @@ namespace WorkStream
 
             // Create a copier task. This task is a separate object from the
             // worker task.
-            tf::Task copier_task = taskflow
-                                     .emplace([idx, &copy_datas, &copier]() {
-                                       copier(*copy_datas[idx].get());
-                                       copy_datas[idx].reset();
-                                     })
-                                     .name("copy");
+            tf::Task copier_task =
+              taskflow
+                .emplace([n_iterators, &copy_data_slot, &copier]() {
+                  for (unsigned int i = 0; i < n_iterators; ++i)
+                    copier(copy_data_slot[i]);
+                })
+                .name("copy");
 
             // Ensure the copy task runs after the worker task.
             worker_task.precede(copier_task);
@@ -832,13 +856,20 @@ namespace WorkStream
             // Ensure that only one copy task can run at a time. The code below
             // makes each copy task wait until the previous one has finished
             // before it can start
-            if (!last_copier.empty())
-              last_copier.precede(copier_task);
-
-            // Keep a handle to the last copier. Tasks in taskflow are
-            // basically handles to internally stored data, so this does not
-            // perform a copy:
-            last_copier = copier_task;
+            if (idx > 0)
+              copier_tasks.back().precede(copier_task);
+
+            // Ensure that the slot of the ring buffer is no longer used by
+            // the item that was previously assigned to it. Since the copiers
+            // run in order, this also bounds the number of items in flight
+            // by the length of the queue.
+            if (idx >= queue_length)
+              copier_tasks[idx - queue_length].precede(worker_task);
+
+            // Keep a handle to the copier. Tasks in taskflow are basically
+            // handles to internally stored data, so this does not perform a
+            // copy:
+            copier_tasks.push_back(copier_task);
           }
 
         // Now we run all the tasks in the task graph. They will be run in
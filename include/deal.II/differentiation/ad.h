@@ -26,6 +26,7 @@
 #include <deal.II/differentiation/ad/sacado_math.h>
 #include <deal.II/differentiation/ad/sacado_number_types.h>
 #include <deal.II/differentiation/ad/sacado_product_types.h>
+#include <deal.II/differentiation/ad/vectorized_fad.h>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -0,0 +1,1291 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_differentiation_ad_vectorized_fad_h
+#define dealii_differentiation_ad_vectorized_fad_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/std_cxx20/type_traits.h>
+#include <deal.II/base/symmetric_tensor.h>
+#include <deal.II/base/table_indices.h>
+#include <deal.II/base/template_constraints.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <array>
+#include <cmath>
+#include <ostream>
+#include <type_traits>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Differentiation
+{
+  namespace AD
+  {
+    /**
+     * A forward-mode automatic differentiation number with a fixed number
+     * of derivatives, whose value and derivatives are of type @p Number.
+     *
+     * The number types provided by the wrappers of ADOL-C and Sacado are
+     * designed for scalar floating point values and thus operate on a
+     * single quadrature point at a time. In matrix-free operator evaluation
+     * with FEEvaluation, the data of a batch of cells is instead held in
+     * VectorizedArray objects. This class can use a VectorizedArray as its
+     * value type, so that the values and all derivatives are propagated for
+     * all lanes of a cell batch at once with the SIMD instructions of the
+     * processor. Since the number of derivatives is a compile-time
+     * constant, the derivatives are stored in a fixed-size array without any
+     * memory allocation, like the <code>Sacado::Fad::SFad</code> type, and
+     * all loops over the derivatives can be unrolled by the compiler. In
+     * contrast to the types of the external libraries, this class is
+     * always available.
+     *
+     * The class provides the arithmetic operations as well as the functions
+     * <code>std::sqrt</code>, <code>std::exp</code>, <code>std::log</code>,
+     * <code>std::pow</code>, <code>std::sin</code>, <code>std::cos</code>,
+     * and <code>std::abs</code>, and it can be used as the number type of
+     * Tensor and SymmetricTensor objects. Functions like make_independent_
+     * variables(), extract_values(), extract_gradient(), and
+     * extract_jacobian() translate between the tensors of VectorizedArray
+     * objects used by FEEvaluation and the tensors of differentiable numbers
+     * used to evaluate a material law, similarly to what
+     * ADHelperQuadraturePoint does for a single quadrature point. A typical
+     * use at a quadrature point of a cell batch looks as follows:
+     * @code
+     *   using VA = VectorizedArray<double>;
+     *   constexpr int n_derivatives =
+     *     SymmetricTensor<2, dim>::n_independent_components;
+     *   using ADNumber = Differentiation::AD::VectorizedFad<VA, n_derivatives>;
+     *
+     *   for (const unsigned int q : phi.quadrature_point_indices())
+     *     {
+     *       const SymmetricTensor<2, dim, VA> strain =
+     *         phi.get_symmetric_gradient(q);
+     *
+     *       // evaluate the material law, written as a template in the
+     *       // number type, with differentiable numbers
+     *       const SymmetricTensor<2, dim, ADNumber> strain_ad =
+     *         Differentiation::AD::make_independent_variables<n_derivatives>(
+     *           strain);
+     *       const SymmetricTensor<2, dim, ADNumber> stress_ad =
+     *         compute_stress(strain_ad);
+     *
+     *       // the stress for the residual, and the tangent for the Jacobian
+     *       const SymmetricTensor<2, dim, VA> stress =
+     *         Differentiation::AD::extract_values(stress_ad);
+     *       const SymmetricTensor<4, dim, VA> tangent =
+     *         Differentiation::AD::extract_jacobian(stress_ad);
+     *       ...
+     *     }
+     * @endcode
+     *
+     * Second derivatives can be computed by nesting the class, i.e., by
+     * using a VectorizedFad as the @p Number type of another VectorizedFad.
+     *
+     * @tparam Number The type of the value and the derivatives, e.g.,
+     * VectorizedArray<double> or double.
+     * @tparam n_derivatives The number of independent variables the
+     * derivatives are taken with respect to.
+     *
+     * @ingroup auto_symb_diff
+     */
+    template <typename Number, int n_derivatives>
+    class VectorizedFad
+    {
+    public:
+      static_assert(n_derivatives > 0,
+                    "The number of derivatives must be positive.");
+
+      /**
+       * The type of the value and the derivatives.
+       */
+      using value_type = Number;
+
+      /**
+       * The number of derivatives.
+       */
+      static constexpr int size = n_derivatives;
+
+      /**
+       * Default constructor, setting the value and all derivatives to zero.
+       */
+      VectorizedFad();
+
+      /**
+       * Constructor for a constant, i.e., a number with the given value and
+       * zero derivatives.
+       */
+      VectorizedFad(const Number &value);
+
+      /**
+       * Constructor for a constant from a scalar of arithmetic type, which
+       * is converted to @p Number. This constructor allows to use literals
+       * like <code>0.</code> or <code>1.</code> wherever a VectorizedFad is
+       * expected.
+       */
+      template <typename OtherNumber,
+                std::enable_if_t<std::is_arithmetic_v<OtherNumber>, int> = 0>
+      VectorizedFad(const OtherNumber value);
+
+      /**
+       * Constructor for an independent variable with the given value, whose
+       * derivative with respect to the independent variable with index
+       * @p derivative_index is one while all other derivatives are zero.
+       */
+      VectorizedFad(const Number &value, const unsigned int derivative_index);
+
+      /**
+       * Return the value.
+       */
+      const Number &
+      val() const;
+
+      /**
+       * Return a writable reference to the value.
+       */
+      Number &
+      val();
+
+      /**
+       * Return the derivative with respect to the independent variable with
+       * index @p i.
+       */
+      const Number &
+      dx(const unsigned int i) const;
+
+      /**
+       * Return a writable reference to the derivative with respect to the
+       * independent variable with index @p i.
+       */
+      Number &
+      dx(const unsigned int i);
+
+      /**
+       * Add another number to this one.
+       */
+      VectorizedFad &
+      operator+=(const VectorizedFad &other);
+
+      /**
+       * Add a constant to this number.
+       */
+      VectorizedFad &
+      operator+=(const std_cxx20::type_identity_t<Number> &other);
+
+      /**
+       * Subtract another number from this one.
+       */
+      VectorizedFad &
+      operator-=(const VectorizedFad &other);
+
+      /**
+       * Subtract a constant from this number.
+       */
+      VectorizedFad &
+      operator-=(const std_cxx20::type_identity_t<Number> &other);
+
+      /**
+       * Multiply this number by another one.
+       */
+      VectorizedFad &
+      operator*=(const VectorizedFad &other);
+
+      /**
+       * Multiply this number by a constant.
+       */
+      VectorizedFad &
+      operator*=(const std_cxx20::type_identity_t<Number> &other);
+
+      /**
+       * Divide this number by another one.
+       */
+      VectorizedFad &
+      operator/=(const VectorizedFad &other);
+
+      /**
+       * Divide this number by a constant.
+       */
+      VectorizedFad &
+      operator/=(const std_cxx20::type_identity_t<Number> &other);
+
+      /**
+       * Return the negative of this number.
+       */
+      VectorizedFad
+      operator-() const;
+
+    private:
+      /**
+       * The value.
+       */
+      Number value;
+
+      /**
+       * The derivatives with respect to the independent variables.
+       */
+      std::array<Number, n_derivatives> derivatives;
+    };
+
+
+
+    /**
+     * Return a differentiable number for the given @p value, which is the
+     * independent variable with index @p first_index among the
+     * @p n_derivatives independent variables.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <int n_derivatives, typename Number>
+    VectorizedFad<Number, n_derivatives>
+    make_independent_variables(const Number      &value,
+                               const unsigned int first_index = 0);
+
+    /**
+     * Return a tensor of differentiable numbers for the given tensor
+     * @p value, whose components are the independent variables with indices
+     * <code>first_index</code> to
+     * <code>first_index + Tensor<rank,dim>::n_independent_components - 1</code>
+     * among the @p n_derivatives independent variables, in the order given by
+     * Tensor::unrolled_to_component_indices().
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <int n_derivatives, int rank, int dim, typename Number>
+    Tensor<rank, dim, VectorizedFad<Number, n_derivatives>>
+    make_independent_variables(const Tensor<rank, dim, Number> &value,
+                               const unsigned int first_index = 0);
+
+    /**
+     * Return a symmetric tensor of differentiable numbers for the given
+     * symmetric tensor @p value, whose independent components are the
+     * independent variables with indices <code>first_index</code> to
+     * <code>first_index + SymmetricTensor<2,dim>::n_independent_components -
+     * 1</code> among the @p n_derivatives independent variables, in the order
+     * given by SymmetricTensor::unrolled_to_component_indices().
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <int n_derivatives, int dim, typename Number>
+    SymmetricTensor<2, dim, VectorizedFad<Number, n_derivatives>>
+    make_independent_variables(const SymmetricTensor<2, dim, Number> &value,
+                               const unsigned int first_index = 0);
+
+    /**
+     * Return the value of a differentiable number.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    Number
+    extract_values(const VectorizedFad<Number, n_derivatives> &value);
+
+    /**
+     * Return the values of a tensor of differentiable numbers.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <int rank, int dim, typename Number, int n_derivatives>
+    Tensor<rank, dim, Number>
+    extract_values(
+      const Tensor<rank, dim, VectorizedFad<Number, n_derivatives>> &value);
+
+    /**
+     * Return the values of a symmetric tensor of differentiable numbers.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <int rank, int dim, typename Number, int n_derivatives>
+    SymmetricTensor<rank, dim, Number>
+    extract_values(
+      const SymmetricTensor<rank, dim, VectorizedFad<Number, n_derivatives>>
+        &value);
+
+    /**
+     * Return the derivative of the scalar differentiable number @p value with
+     * respect to the independent variables set up by a call to
+     * make_independent_variables() with an argument of type
+     * @p IndependentType and the index @p first_index, i.e., the
+     * gradient of a function with respect to a scalar, a Tensor, or a
+     * SymmetricTensor. As in ADHelperQuadraturePoint, the derivative with
+     * respect to a SymmetricTensor is the symmetric one, i.e., the
+     * off-diagonal components are scaled by one half as compared to the
+     * derivatives with respect to the individual independent variables.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename IndependentType, typename Number, int n_derivatives>
+    IndependentType
+    extract_gradient(const VectorizedFad<Number, n_derivatives> &value,
+                     const unsigned int first_index = 0);
+
+    /**
+     * Return the derivatives of the tensor of differentiable numbers @p value
+     * with respect to the independent variables set up by a call to
+     * make_independent_variables() with a tensor of rank
+     * @p independent_rank and the index @p first_index. The result is the
+     * tensor of rank <code>rank + independent_rank</code> whose first
+     * @p rank indices refer to @p value and whose last @p independent_rank
+     * indices refer to the independent variables.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <int independent_rank,
+              int rank,
+              int dim,
+              typename Number,
+              int n_derivatives>
+    Tensor<rank + independent_rank, dim, Number>
+    extract_jacobian(
+      const Tensor<rank, dim, VectorizedFad<Number, n_derivatives>> &value,
+      const unsigned int first_index = 0);
+
+    /**
+     * Return the derivatives of the symmetric tensor of differentiable
+     * numbers @p value with respect to the independent variables set up by a
+     * call to make_independent_variables() with a symmetric tensor of rank
+     * two and the index @p first_index, e.g., the tangent of a stress with
+     * respect to a strain. The derivatives with respect to the off-diagonal
+     * components are the symmetric ones, like in extract_gradient().
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <int dim, typename Number, int n_derivatives>
+    SymmetricTensor<4, dim, Number>
+    extract_jacobian(
+      const SymmetricTensor<2, dim, VectorizedFad<Number, n_derivatives>>
+                        &value,
+      const unsigned int first_index = 0);
+
+  } // namespace AD
+} // namespace Differentiation
+
+
+
+/**
+ * Enable the EnableIfScalar type trait for VectorizedFad such that it can be
+ * used as the number type of Tensor and SymmetricTensor.
+ */
+template <typename Number, int n_derivatives>
+struct EnableIfScalar<Differentiation::AD::VectorizedFad<Number, n_derivatives>>
+{
+  using type = Differentiation::AD::VectorizedFad<Number, n_derivatives>;
+};
+
+
+
+/* ---------------------- inline and template functions ------------------- */
+
+#ifndef DOXYGEN
+
+namespace Differentiation
+{
+  namespace AD
+  {
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>::VectorizedFad()
+      : value(0.)
+    {
+      derivatives.fill(Number(0.));
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>::VectorizedFad(
+      const Number &value)
+      : value(value)
+    {
+      derivatives.fill(Number(0.));
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    template <typename OtherNumber,
+              std::enable_if_t<std::is_arithmetic_v<OtherNumber>, int>>
+    inline VectorizedFad<Number, n_derivatives>::VectorizedFad(
+      const OtherNumber value)
+      : value(value)
+    {
+      derivatives.fill(Number(0.));
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>::VectorizedFad(
+      const Number      &value,
+      const unsigned int derivative_index)
+      : value(value)
+    {
+      AssertIndexRange(derivative_index, n_derivatives);
+      derivatives.fill(Number(0.));
+      derivatives[derivative_index] = Number(1.);
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline const Number &
+    VectorizedFad<Number, n_derivatives>::val() const
+    {
+      return value;
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline Number &
+    VectorizedFad<Number, n_derivatives>::val()
+    {
+      return value;
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline const Number &
+    VectorizedFad<Number, n_derivatives>::dx(const unsigned int i) const
+    {
+      AssertIndexRange(i, n_derivatives);
+      return derivatives[i];
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline Number &
+    VectorizedFad<Number, n_derivatives>::dx(const unsigned int i)
+    {
+      AssertIndexRange(i, n_derivatives);
+      return derivatives[i];
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives> &
+    VectorizedFad<Number, n_derivatives>::operator+=(
+      const VectorizedFad &other)
+    {
+      value += other.value;
+      for (unsigned int i = 0; i < n_derivatives; ++i)
+        derivatives[i] += other.derivatives[i];
+      return *this;
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives> &
+    VectorizedFad<Number, n_derivatives>::operator+=(
+      const std_cxx20::type_identity_t<Number> &other)
+    {
+      value += other;
+      return *this;
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives> &
+    VectorizedFad<Number, n_derivatives>::operator-=(
+      const VectorizedFad &other)
+    {
+      value -= other.value;
+      for (unsigned int i = 0; i < n_derivatives; ++i)
+        derivatives[i] -= other.derivatives[i];
+      return *this;
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives> &
+    VectorizedFad<Number, n_derivatives>::operator-=(
+      const std_cxx20::type_identity_t<Number> &other)
+    {
+      value -= other;
+      return *this;
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives> &
+    VectorizedFad<Number, n_derivatives>::operator*=(
+      const VectorizedFad &other)
+    {
+      // product rule, using the old value of this number
+      for (unsigned int i = 0; i < n_derivatives; ++i)
+        derivatives[i] =
+          derivatives[i] * other.value + value * other.derivatives[i];
+      value *= other.value;
+      return *this;
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives> &
+    VectorizedFad<Number, n_derivatives>::operator*=(
+      const std_cxx20::type_identity_t<Number> &other)
+    {
+      value *= other;
+      for (unsigned int i = 0; i < n_derivatives; ++i)
+        derivatives[i] *= other;
+      return *this;
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives> &
+    VectorizedFad<Number, n_derivatives>::operator/=(
+      const VectorizedFad &other)
+    {
+      // quotient rule: (u/v)' = (u' - (u/v) v') / v
+      const Number inverse = Number(1.) / other.value;
+      value *= inverse;
+      for (unsigned int i = 0; i < n_derivatives; ++i)
+        derivatives[i] =
+          (derivatives[i] - value * other.derivatives[i]) * inverse;
+      return *this;
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives> &
+    VectorizedFad<Number, n_derivatives>::operator/=(
+      const std_cxx20::type_identity_t<Number> &other)
+    {
+      const Number inverse = Number(1.) / other;
+      return (*this *= inverse);
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>
+    VectorizedFad<Number, n_derivatives>::operator-() const
+    {
+      VectorizedFad result;
+      result.value = -value;
+      for (unsigned int i = 0; i < n_derivatives; ++i)
+        result.derivatives[i] = -derivatives[i];
+      return result;
+    }
+
+
+
+    /**
+     * Addition of two differentiable numbers.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>
+    operator+(const VectorizedFad<Number, n_derivatives> &u,
+              const VectorizedFad<Number, n_derivatives> &v)
+    {
+      VectorizedFad<Number, n_derivatives> tmp = u;
+      return (tmp += v);
+    }
+
+
+
+    /**
+     * Addition of a differentiable number and a constant.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>
+    operator+(const VectorizedFad<Number, n_derivatives> &u,
+              const std_cxx20::type_identity_t<Number>   &v)
+    {
+      VectorizedFad<Number, n_derivatives> tmp = u;
+      return (tmp += v);
+    }
+
+
+
+    /**
+     * Addition of a constant and a differentiable number.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>
+    operator+(const std_cxx20::type_identity_t<Number>   &u,
+              const VectorizedFad<Number, n_derivatives> &v)
+    {
+      VectorizedFad<Number, n_derivatives> tmp = v;
+      return (tmp += u);
+    }
+
+
+
+    /**
+     * Subtraction of two differentiable numbers.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>
+    operator-(const VectorizedFad<Number, n_derivatives> &u,
+              const VectorizedFad<Number, n_derivatives> &v)
+    {
+      VectorizedFad<Number, n_derivatives> tmp = u;
+      return (tmp -= v);
+    }
+
+
+
+    /**
+     * Subtraction of a constant from a differentiable number.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>
+    operator-(const VectorizedFad<Number, n_derivatives> &u,
+              const std_cxx20::type_identity_t<Number>   &v)
+    {
+      VectorizedFad<Number, n_derivatives> tmp = u;
+      return (tmp -= v);
+    }
+
+
+
+    /**
+     * Subtraction of a differentiable number from a constant.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>
+    operator-(const std_cxx20::type_identity_t<Number>   &u,
+              const VectorizedFad<Number, n_derivatives> &v)
+    {
+      VectorizedFad<Number, n_derivatives> tmp = -v;
+      return (tmp += u);
+    }
+
+
+
+    /**
+     * Multiplication of two differentiable numbers.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>
+    operator*(const VectorizedFad<Number, n_derivatives> &u,
+              const VectorizedFad<Number, n_derivatives> &v)
+    {
+      VectorizedFad<Number, n_derivatives> tmp = u;
+      return (tmp *= v);
+    }
+
+
+
+    /**
+     * Multiplication of a differentiable number by a constant.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>
+    operator*(const VectorizedFad<Number, n_derivatives> &u,
+              const std_cxx20::type_identity_t<Number>   &v)
+    {
+      VectorizedFad<Number, n_derivatives> tmp = u;
+      return (tmp *= v);
+    }
+
+
+
+    /**
+     * Multiplication of a constant by a differentiable number.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>
+    operator*(const std_cxx20::type_identity_t<Number>   &u,
+              const VectorizedFad<Number, n_derivatives> &v)
+    {
+      VectorizedFad<Number, n_derivatives> tmp = v;
+      return (tmp *= u);
+    }
+
+
+
+    /**
+     * Division of two differentiable numbers.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>
+    operator/(const VectorizedFad<Number, n_derivatives> &u,
+              const VectorizedFad<Number, n_derivatives> &v)
+    {
+      VectorizedFad<Number, n_derivatives> tmp = u;
+      return (tmp /= v);
+    }
+
+
+
+    /**
+     * Division of a differentiable number by a constant.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>
+    operator/(const VectorizedFad<Number, n_derivatives> &u,
+              const std_cxx20::type_identity_t<Number>   &v)
+    {
+      VectorizedFad<Number, n_derivatives> tmp = u;
+      return (tmp /= v);
+    }
+
+
+
+    /**
+     * Division of a constant by a differentiable number.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    inline VectorizedFad<Number, n_derivatives>
+    operator/(const std_cxx20::type_identity_t<Number>   &u,
+              const VectorizedFad<Number, n_derivatives> &v)
+    {
+      // (c/v)' = -(c/v) v' / v
+      const Number                         inverse = Number(1.) / v.val();
+      VectorizedFad<Number, n_derivatives> result(u * inverse);
+      const Number                         factor = -result.val() * inverse;
+      for (unsigned int i = 0; i < n_derivatives; ++i)
+        result.dx(i) = factor * v.dx(i);
+      return result;
+    }
+
+
+
+    /**
+     * Output operator, printing the value followed by the derivatives in
+     * brackets.
+     *
+     * @relatesalso VectorizedFad
+     */
+    template <typename Number, int n_derivatives>
+    inline std::ostream &
+    operator<<(std::ostream                               &out,
+               const VectorizedFad<Number, n_derivatives> &value)
+    {
+      out << value.val() << " [";
+      for (unsigned int i = 0; i < n_derivatives; ++i)
+        out << ' ' << value.dx(i);
+      out << " ]";
+      return out;
+    }
+
+
+
+    namespace internal
+    {
+      /**
+       * Apply the chain rule for a function with value @p value and
+       * derivative @p derivative at <code>x.val()</code>.
+       */
+      template <typename Number, int n_derivatives>
+      inline VectorizedFad<Number, n_derivatives>
+      apply_chain_rule(const VectorizedFad<Number, n_derivatives> &x,
+                       const Number                               &value,
+                       const Number                               &derivative)
+      {
+        VectorizedFad<Number, n_derivatives> result(value);
+        for (unsigned int i = 0; i < n_derivatives; ++i)
+          result.dx(i) = derivative * x.dx(i);
+        return result;
+      }
+
+
+
+      /**
+       * Return -1 for the negative entries of @p x and +1 otherwise.
+       */
+      template <typename Number>
+      inline Number
+      sign(const Number &x)
+      {
+        return compare_and_apply_mask<SIMDComparison::less_than>(x,
+                                                                 Number(0.),
+                                                                 Number(-1.),
+                                                                 Number(1.));
+      }
+
+
+
+      /**
+       * Same as above for nested differentiable numbers, for which the sign
+       * is a constant given by the sign of the value.
+       */
+      template <typename Number, int n_derivatives>
+      inline VectorizedFad<Number, n_derivatives>
+      sign(const VectorizedFad<Number, n_derivatives> &x)
+      {
+        return VectorizedFad<Number, n_derivatives>(sign(x.val()));
+      }
+    } // namespace internal
+
+
+
+    template <int n_derivatives, typename Number>
+    inline VectorizedFad<Number, n_derivatives>
+    make_independent_variables(const Number      &value,
+                               const unsigned int first_index)
+    {
+      return VectorizedFad<Number, n_derivatives>(value, first_index);
+    }
+
+
+
+    template <int n_derivatives, int rank, int dim, typename Number>
+    inline Tensor<rank, dim, VectorizedFad<Number, n_derivatives>>
+    make_independent_variables(const Tensor<rank, dim, Number> &value,
+                               const unsigned int               first_index)
+    {
+      constexpr unsigned int n_components =
+        Tensor<rank, dim, Number>::n_independent_components;
+      Assert(first_index + n_components <= n_derivatives,
+             ExcMessage("The number of derivatives is too small for the "
+                        "components of the tensor."));
+
+      Tensor<rank, dim, VectorizedFad<Number, n_derivatives>> result;
+      for (unsigned int c = 0; c < n_components; ++c)
+        {
+          const TableIndices<rank> indices =
+            Tensor<rank, dim, Number>::unrolled_to_component_indices(c);
+          result[indices] =
+            VectorizedFad<Number, n_derivatives>(value[indices],
+                                                 first_index + c);
+        }
+      return result;
+    }
+
+
+
+    template <int n_derivatives, int dim, typename Number>
+    inline SymmetricTensor<2, dim, VectorizedFad<Number, n_derivatives>>
+    make_independent_variables(const SymmetricTensor<2, dim, Number> &value,
+                               const unsigned int first_index)
+    {
+      constexpr unsigned int n_components =
+        SymmetricTensor<2, dim, Number>::n_independent_components;
+      Assert(first_index + n_components <= n_derivatives,
+             ExcMessage("The number of derivatives is too small for the "
+                        "components of the tensor."));
+
+      SymmetricTensor<2, dim, VectorizedFad<Number, n_derivatives>> result;
+      for (unsigned int c = 0; c < n_components; ++c)
+        {
+          const TableIndices<2> indices =
+            SymmetricTensor<2, dim, Number>::unrolled_to_component_indices(c);
+          result[indices] =
+            VectorizedFad<Number, n_derivatives>(value[indices],
+                                                 first_index + c);
+        }
+      return result;
+    }
+
+
+
+    template <typename Number, int n_derivatives>
+    inline Number
+    extract_values(const VectorizedFad<Number, n_derivatives> &value)
+    {
+      return value.val();
+    }
+
+
+
+    template <int rank, int dim, typename Number, int n_derivatives>
+    inline Tensor<rank, dim, Number>
+    extract_values(
+      const Tensor<rank, dim, VectorizedFad<Number, n_derivatives>> &value)
+    {
+      Tensor<rank, dim, Number> result;
+      for (unsigned int c = 0;
+           c < Tensor<rank, dim, Number>::n_independent_components;
+           ++c)
+        {
+          const TableIndices<rank> indices =
+            Tensor<rank, dim, Number>::unrolled_to_component_indices(c);
+          result[indices] = value[indices].val();
+        }
+      return result;
+    }
+
+
+
+    template <int rank, int dim, typename Number, int n_derivatives>
+    inline SymmetricTensor<rank, dim, Number>
+    extract_values(
+      const SymmetricTensor<rank, dim, VectorizedFad<Number, n_derivatives>>
+        &value)
+    {
+      SymmetricTensor<rank, dim, Number> result;
+      for (unsigned int c = 0;
+           c < SymmetricTensor<rank, dim, Number>::n_independent_components;
+           ++c)
+        {
+          const TableIndices<rank> indices =
+            SymmetricTensor<rank, dim, Number>::unrolled_to_component_indices(
+              c);
+          result[indices] = value[indices].val();
+        }
+      return result;
+    }
+
+
+
+    namespace internal
+    {
+      /**
+       * A helper class to access the derivatives with respect to the
+       * components of an independent variable of type @p IndependentType. The
+       * general template handles scalar types.
+       */
+      template <typename IndependentType>
+      struct VectorizedFadIndependentVariables
+      {
+        static constexpr unsigned int n_components = 1;
+
+        static IndependentType &
+        component(IndependentType &t, const unsigned int)
+        {
+          return t;
+        }
+
+        static double
+        derivative_scaling(const unsigned int)
+        {
+          return 1.;
+        }
+      };
+
+
+
+      template <int rank, int dim, typename Number>
+      struct VectorizedFadIndependentVariables<Tensor<rank, dim, Number>>
+      {
+        static constexpr unsigned int n_components =
+          Tensor<rank, dim, Number>::n_independent_components;
+
+        static Number &
+        component(Tensor<rank, dim, Number> &t, const unsigned int c)
+        {
+          return t[Tensor<rank, dim, Number>::unrolled_to_component_indices(
+            c)];
+        }
+
+        static double
+        derivative_scaling(const unsigned int)
+        {
+          return 1.;
+        }
+      };
+
+
+
+      template <int dim, typename Number>
+      struct VectorizedFadIndependentVariables<SymmetricTensor<2, dim, Number>>
+      {
+        static constexpr unsigned int n_components =
+          SymmetricTensor<2, dim, Number>::n_independent_components;
+
+        static Number &
+        component(SymmetricTensor<2, dim, Number> &t, const unsigned int c)
+        {
+          return t[SymmetricTensor<2, dim, Number>::
+                     unrolled_to_component_indices(c)];
+        }
+
+        // each off-diagonal independent variable represents two entries of
+        // the tensor, so the symmetric derivative is half the derivative
+        // with respect to the independent variable
+        static double
+        derivative_scaling(const unsigned int c)
+        {
+          const TableIndices<2> indices =
+            SymmetricTensor<2, dim, Number>::unrolled_to_component_indices(c);
+          return (indices[0] == indices[1] ? 1. : 0.5);
+        }
+      };
+    } // namespace internal
+
+
+
+    template <typename IndependentType, typename Number, int n_derivatives>
+    inline IndependentType
+    extract_gradient(const VectorizedFad<Number, n_derivatives> &value,
+                     const unsigned int                          first_index)
+    {
+      using Helper = internal::VectorizedFadIndependentVariables<
+        std::remove_cv_t<IndependentType>>;
+      Assert(first_index + Helper::n_components <= n_derivatives,
+             ExcMessage("The number of derivatives is too small for the "
+                        "components of the independent variables."));
+
+      IndependentType result;
+      for (unsigned int c = 0; c < Helper::n_components; ++c)
+        Helper::component(result, c) =
+          Helper::derivative_scaling(c) * value.dx(first_index + c);
+      return result;
+    }
+
+
+
+    template <int independent_rank,
+              int rank,
+              int dim,
+              typename Number,
+              int n_derivatives>
+    inline Tensor<rank + independent_rank, dim, Number>
+    extract_jacobian(
+      const Tensor<rank, dim, VectorizedFad<Number, n_derivatives>> &value,
+      const unsigned int first_index)
+    {
+      constexpr unsigned int n_independent_components =
+        Tensor<independent_rank, dim, Number>::n_independent_components;
+      Assert(first_index + n_independent_components <= n_derivatives,
+             ExcMessage("The number of derivatives is too small for the "
+                        "components of the independent variables."));
+
+      Tensor<rank + independent_rank, dim, Number> result;
+      for (unsigned int c = 0;
+           c < Tensor<rank, dim, Number>::n_independent_components;
+           ++c)
+        {
+          const TableIndices<rank> indices =
+            Tensor<rank, dim, Number>::unrolled_to_component_indices(c);
+          for (unsigned int d = 0; d < n_independent_components; ++d)
+            {
+              const TableIndices<independent_rank> independent_indices =
+                Tensor<independent_rank, dim, Number>::
+                  unrolled_to_component_indices(d);
+
+              TableIndices<rank + independent_rank> result_indices;
+              for (unsigned int i = 0; i < rank; ++i)
+                result_indices[i] = indices[i];
+              for (unsigned int i = 0; i < independent_rank; ++i)
+                result_indices[rank + i] = independent_indices[i];
+
+              result[result_indices] = value[indices].dx(first_index + d);
+            }
+        }
+      return result;
+    }
+
+
+
+    template <int dim, typename Number, int n_derivatives>
+    inline SymmetricTensor<4, dim, Number>
+    extract_jacobian(
+      const SymmetricTensor<2, dim, VectorizedFad<Number, n_derivatives>>
+                        &value,
+      const unsigned int first_index)
+    {
+      using Helper =
+        internal::VectorizedFadIndependentVariables<SymmetricTensor<2, dim>>;
+      Assert(first_index + Helper::n_components <= n_derivatives,
+             ExcMessage("The number of derivatives is too small for the "
+                        "components of the independent variables."));
+
+      SymmetricTensor<4, dim, Number> result;
+      for (unsigned int c = 0; c < Helper::n_components; ++c)
+        {
+          const TableIndices<2> indices =
+            SymmetricTensor<2, dim>::unrolled_to_component_indices(c);
+          for (unsigned int d = 0; d < Helper::n_components; ++d)
+            {
+              const TableIndices<2> independent_indices =
+                SymmetricTensor<2, dim>::unrolled_to_component_indices(d);
+              result[TableIndices<4>(indices[0],
+                                     indices[1],
+                                     independent_indices[0],
+                                     independent_indices[1])] =
+                Helper::derivative_scaling(d) *
+                value[indices].dx(first_index + d);
+            }
+        }
+      return result;
+    }
+  } // namespace AD
+} // namespace Differentiation
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+
+
+namespace std
+{
+  /**
+   * Compute the square root of a differentiable number.
+   *
+   * @relatesalso dealii::Differentiation::AD::VectorizedFad
+   */
+  template <typename Number, int n_derivatives>
+  inline ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+  sqrt(const ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+         &x)
+  {
+    const Number value = std::sqrt(x.val());
+    return ::dealii::Differentiation::AD::internal::apply_chain_rule(
+      x, value, Number(0.5) / value);
+  }
+
+
+
+  /**
+   * Compute the exponential of a differentiable number.
+   *
+   * @relatesalso dealii::Differentiation::AD::VectorizedFad
+   */
+  template <typename Number, int n_derivatives>
+  inline ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+  exp(const ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+        &x)
+  {
+    const Number value = std::exp(x.val());
+    return ::dealii::Differentiation::AD::internal::apply_chain_rule(x,
+                                                                     value,
+                                                                     value);
+  }
+
+
+
+  /**
+   * Compute the natural logarithm of a differentiable number.
+   *
+   * @relatesalso dealii::Differentiation::AD::VectorizedFad
+   */
+  template <typename Number, int n_derivatives>
+  inline ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+  log(const ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+        &x)
+  {
+    return ::dealii::Differentiation::AD::internal::apply_chain_rule(
+      x, Number(std::log(x.val())), Number(Number(1.) / x.val()));
+  }
+
+
+
+  /**
+   * Raise a differentiable number to a differentiable power, using
+   * $x^p = \exp(p \log x)$.
+   *
+   * @relatesalso dealii::Differentiation::AD::VectorizedFad
+   */
+  template <typename Number, int n_derivatives>
+  inline ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+  pow(const ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+        &x,
+      const ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+        &p)
+  {
+    return std::exp(p * std::log(x));
+  }
+
+
+
+  /**
+   * Raise a differentiable number to a constant power.
+   *
+   * @relatesalso dealii::Differentiation::AD::VectorizedFad
+   */
+  template <typename Number, int n_derivatives>
+  inline ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+  pow(const ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+                                                       &x,
+      const ::dealii::std_cxx20::type_identity_t<Number> &p)
+  {
+    const Number value_m1 = std::pow(x.val(), Number(p - Number(1.)));
+    return ::dealii::Differentiation::AD::internal::apply_chain_rule(
+      x, Number(value_m1 * x.val()), Number(p * value_m1));
+  }
+
+
+
+  /**
+   * Compute the sine of a differentiable number.
+   *
+   * @relatesalso dealii::Differentiation::AD::VectorizedFad
+   */
+  template <typename Number, int n_derivatives>
+  inline ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+  sin(const ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+        &x)
+  {
+    return ::dealii::Differentiation::AD::internal::apply_chain_rule(
+      x, Number(std::sin(x.val())), Number(std::cos(x.val())));
+  }
+
+
+
+  /**
+   * Compute the cosine of a differentiable number.
+   *
+   * @relatesalso dealii::Differentiation::AD::VectorizedFad
+   */
+  template <typename Number, int n_derivatives>
+  inline ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+  cos(const ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+        &x)
+  {
+    return ::dealii::Differentiation::AD::internal::apply_chain_rule(
+      x, Number(std::cos(x.val())), Number(-std::sin(x.val())));
+  }
+
+
+
+  /**
+   * Compute the absolute value of a differentiable number. The derivative at
+   * zero is taken as the one of the positive branch.
+   *
+   * @relatesalso dealii::Differentiation::AD::VectorizedFad
+   */
+  template <typename Number, int n_derivatives>
+  inline ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+  abs(const ::dealii::Differentiation::AD::VectorizedFad<Number, n_derivatives>
+        &x)
+  {
+    const Number sign =
+      ::dealii::Differentiation::AD::internal::sign(x.val());
+    return ::dealii::Differentiation::AD::internal::apply_chain_rule(
+      x, Number(sign * x.val()), sign);
+  }
+} // namespace std
+
+#endif
@@ -33,6 +33,7 @@
 #  endif
 
 #  include <deal.II/base/exceptions.h>
+#  include <deal.II/base/mpi_stub.h>
 #  include <deal.II/base/utilities.h>
 
 #  include <deal.II/differentiation/sd/symengine_number_types.h>
@@ -47,6 +48,7 @@
 #  include <algorithm>
 #  include <map>
 #  include <memory>
+#  include <string>
 #  include <type_traits>
 #  include <utility>
 #  include <vector>
@@ -1786,6 +1788,42 @@ namespace Differentiation
       void
       optimize();
 
+      /**
+       * Same as optimize(), but perform the optimization only once for all
+       * processes in @p mpi_communicator and, optionally, only once over
+       * several runs of a program.
+       *
+       * The optimization is performed on the root process of
+       * @p mpi_communicator only. The state of the optimized object is then
+       * serialized and broadcast to all other processes, which deserialize
+       * it instead of repeating the optimization. If @p cache_directory is
+       * not empty, the root process first looks for a file in this directory
+       * that stores the result of an earlier optimization of the same
+       * problem and deserializes it if it exists; otherwise, the result of
+       * the optimization is written to such a file after the optimization.
+       * The file name contains a hash of the optimization method and flags,
+       * the registered symbols and functions, the @p ReturnType, and the
+       * version of deal.II, so that a change of the symbolic expressions
+       * leads to a new optimization rather than to incorrect results, and
+       * the same directory can be used for several optimizers.
+       *
+       * This function is collective over @p mpi_communicator, and all
+       * processes must have registered the same symbols and functions.
+       *
+       * @note The "lambda" optimization method cannot be fully serialized,
+       * see the discussion of the serialize() function. In this case, this
+       * function simply calls optimize() on each process.
+       *
+       * @note An optimizer using the "LLVM" optimization method contains
+       * machine code that has been compiled for the processor of the root
+       * process. The processes in @p mpi_communicator, as well as all
+       * programs sharing the @p cache_directory, must therefore run on the
+       * same kind of processor and use the same SymEngine library.
+       */
+      void
+      optimize(const MPI_Comm mpi_communicator,
+               const std::string &cache_directory = "");
+
       /**
        * Returns a flag which indicates whether the optimize()
        * function has been called and the class is finalized.
@@ -201,6 +201,58 @@ namespace parallel
     static WeightingFunction
     ndofs_weighting(const std::vector<std::pair<float, float>> &coefficients);
 
+    /**
+     * The container @p costs provides, for each index $i$ of the
+     * hp::FECollection associated with the DoFHandler, the cost $c_i$ of the
+     * work on a cell with this finite element, in arbitrary units. Each cell
+     * $K$ with future finite element $i$ is then weighted as \f[ w_K =
+     * \text{factor} \, \frac{c_i}{\max_j c_j}, \f] i.e., the cells with
+     * the most expensive element get the weight @p factor and all others
+     * proportionally less.
+     *
+     * As opposed to ndofs_weighting(), which relies on a model of the cost in
+     * terms of the number of degrees of freedom, this function allows
+     * using measured costs, e.g., as determined by
+     * measure_cost_per_fe_index(). This is useful for matrix-free methods,
+     * for which the actual cost per cell depends on the throughput of the
+     * kernels for the different polynomial degrees and on how well the cells
+     * fill the SIMD lanes, and is therefore not well described by a simple
+     * power of the number of degrees of freedom.
+     *
+     * The right hand side will be rounded to the nearest integer since cell
+     * weights are required to be integers.
+     */
+    static WeightingFunction
+    fe_index_weighting(const std::vector<double> &costs,
+                       const unsigned int         factor = 1000);
+
+    /**
+     * Measure the cost of the work associated with each of the
+     * @p n_fe_indices entries of an hp::FECollection, to be used with
+     * fe_index_weighting().
+     *
+     * The function @p kernel is called with each index of the collection
+     * and is supposed to perform a representative amount of work for cells
+     * with this finite element, such as applying the matrix-free operator
+     * to a fixed number of cell batches of this element. The amount of work
+     * should be the same for all indices and all processes, and must not
+     * depend on how many cells of the given element a process currently
+     * owns, since the measured costs are interpreted per cell. The kernel is
+     * called once for warming up caches and then @p n_repetitions times,
+     * and the smallest of the measured wall times is taken as the cost of
+     * the given index.
+     *
+     * The function is collective over @p mpi_communicator. To make sure
+     * that all processes weight their cells identically, the maximum of the
+     * measured costs over all processes is returned.
+     */
+    static std::vector<double>
+    measure_cost_per_fe_index(
+      const unsigned int                             n_fe_indices,
+      const std::function<void(const unsigned int)> &kernel,
+      const MPI_Comm                                 mpi_communicator,
+      const unsigned int                             n_repetitions = 5);
+
     /**
      * @}
      */
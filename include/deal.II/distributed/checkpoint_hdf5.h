@@ -0,0 +1,202 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_distributed_checkpoint_hdf5_h
+#define dealii_distributed_checkpoint_hdf5_h
+
+#include <deal.II/base/config.h>
+
+#ifdef DEAL_II_WITH_HDF5
+
+#  include <deal.II/base/hdf5.h>
+
+#  include <deal.II/dofs/dof_handler.h>
+
+#  include <deal.II/grid/tria.h>
+
+#  include <deal.II/lac/vector.h>
+
+#  include <string>
+#  include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace parallel
+{
+  /**
+   * A checkpoint container that stores the refinement of a triangulation,
+   * data attached to its active cells, and finite element vectors in a
+   * single HDF5 group, using the interface of the HDF5 namespace.
+   *
+   * In contrast to parallel::distributed::Triangulation::save() and
+   * SolutionTransfer::prepare_for_serialization(), which write the p4est
+   * forest and the serialized cell data in files only readable by deal.II,
+   * all data is stored in plain HDF5 datasets that can be inspected with
+   * standard tools such as `h5dump` or h5py:
+   * - The dataset `cells` contains the active cells of the triangulation as
+   *   a two-dimensional array of unsigned integers. Each row is the binary
+   *   representation of the CellId of one cell, see CellId::to_binary(), and
+   *   the rows are sorted by CellId, which is the order of the space filling
+   *   curve of parallel::distributed::Triangulation. The group carries the
+   *   attributes `dim`, `spacedim` and `n_coarse_cells`.
+   * - Cell data written by save_cell_data() is a one-dimensional dataset with
+   *   one entry per row of `cells`.
+   * - A vector written by save_vector() is a two-dimensional dataset with
+   *   one row per row of `cells` containing the values of the degrees of
+   *   freedom of that cell in the order of the finite element. The dataset
+   *   stores the name of the finite element in the attribute `fe`.
+   *
+   * Because the layout of all datasets only depends on the mesh and not on
+   * its partitioning, a checkpoint can be restarted on a different number
+   * of MPI processes. Every process writes and reads one contiguous block
+   * of rows in a collective operation, and the datasets are stored in
+   * chunks to let the parallel HDF5 library align the I/O with the file
+   * system.
+   *
+   * A typical use writes a checkpoint as follows:
+   * @code
+   * HDF5::File file("restart.h5",
+   *                 HDF5::File::FileAccessMode::create,
+   *                 mpi_communicator);
+   * parallel::CheckpointHDF5<dim> checkpoint(file);
+   * checkpoint.save(triangulation);
+   * checkpoint.save_vector("solution", dof_handler, locally_relevant_solution);
+   * @endcode
+   * and restarts from it by recreating the coarse mesh with the same
+   * settings of the triangulation:
+   * @code
+   * HDF5::File file("restart.h5",
+   *                 HDF5::File::FileAccessMode::open,
+   *                 mpi_communicator);
+   * parallel::CheckpointHDF5<dim> checkpoint(file);
+   * GridGenerator::hyper_cube(triangulation);
+   * checkpoint.load(triangulation);
+   * dof_handler.distribute_dofs(fe);
+   * ...
+   * checkpoint.load_vector("solution", dof_handler, locally_owned_solution);
+   * @endcode
+   *
+   * The class works with parallel::distributed::Triangulation and with the
+   * serial Triangulation class. It requires that the locally owned cells of
+   * every process form a contiguous range in the order of CellId, which is
+   * the case for these two classes.
+   *
+   * <h4>Note on ghost elements</h4> As for SolutionTransfer, the vectors
+   * passed to save_vector() need to have their ghost elements set, whereas
+   * the vectors passed to load_vector() must be writable and are compressed
+   * at the end of the function.
+   *
+   * @note The vector functions do not support DoFHandler objects with
+   * hp-capabilities, since every row of the dataset has the same length.
+   *
+   * @ingroup distributed
+   */
+  template <int dim, int spacedim = dim>
+  class CheckpointHDF5
+  {
+  public:
+    /**
+     * Constructor. All data is written to and read from @p group, which is
+     * typically an HDF5::File opened with the MPI communicator of the
+     * triangulation.
+     */
+    CheckpointHDF5(const HDF5::Group &group);
+
+    /**
+     * Store the active cells of @p triangulation in the dataset `cells`.
+     * This function is collective over the MPI communicator of the
+     * triangulation.
+     */
+    void
+    save(const Triangulation<dim, spacedim> &triangulation);
+
+    /**
+     * Refine @p triangulation, which must only consist of the coarse mesh
+     * that was used to create the triangulation passed to save(), until its
+     * active cells are the ones stored in the checkpoint. The cells are
+     * refined level by level, so the partitioning of a
+     * parallel::distributed::Triangulation is established by the number of
+     * processes of this run, not of the one that wrote the checkpoint. The
+     * triangulation has to use the same mesh smoothing flags as the one
+     * passed to save().
+     */
+    void
+    load(Triangulation<dim, spacedim> &triangulation) const;
+
+    /**
+     * Store the values of @p vector on all active cells of @p dof_handler in
+     * the dataset @p name. The triangulation of @p dof_handler needs to be
+     * the one stored by save().
+     */
+    template <typename VectorType>
+    void
+    save_vector(const std::string               &name,
+                const DoFHandler<dim, spacedim> &dof_handler,
+                const VectorType                &vector);
+
+    /**
+     * Read the dataset @p name written by save_vector() into @p vector,
+     * whose layout is described by @p dof_handler. The finite element has
+     * to be the one used when writing the checkpoint.
+     */
+    template <typename VectorType>
+    void
+    load_vector(const std::string               &name,
+                const DoFHandler<dim, spacedim> &dof_handler,
+                VectorType                      &vector) const;
+
+    /**
+     * Store data attached to the active cells of @p triangulation in the
+     * dataset @p name. The vector @p cell_data is indexed by the
+     * active_cell_index() of the cells, like the cell data of DataOut, and
+     * only the entries of the locally owned cells are written.
+     */
+    template <typename Number>
+    void
+    save_cell_data(const std::string                  &name,
+                   const Triangulation<dim, spacedim> &triangulation,
+                   const Vector<Number>               &cell_data);
+
+    /**
+     * Read the dataset @p name written by save_cell_data(). After the call,
+     * @p cell_data has the size Triangulation::n_active_cells() and
+     * contains the values of the locally owned cells; the other entries are
+     * zero.
+     */
+    template <typename Number>
+    void
+    load_cell_data(const std::string                  &name,
+                   const Triangulation<dim, spacedim> &triangulation,
+                   Vector<Number>                     &cell_data) const;
+
+    /**
+     * Exception
+     */
+    DeclExceptionMsg(ExcCheckpointMismatch,
+                     "The checkpoint does not match the given triangulation "
+                     "or finite element.");
+
+  private:
+    /**
+     * The group all datasets are placed in.
+     */
+    HDF5::Group group;
+  };
+} // namespace parallel
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif // DEAL_II_WITH_HDF5
+
+#endif
@@ -21,6 +21,12 @@
 
 DEAL_II_NAMESPACE_OPEN
 
+// Forward declarations
+#ifndef DOXYGEN
+template <int dim, int spacedim>
+class FiniteElement;
+#endif
+
 /**
  * A namespace with repartitioning policies. These classes return vectors
  * of the new owners of the active locally owned and ghost cells of a
@@ -128,6 +134,18 @@ namespace RepartitioningPolicyTools
    * process. If a threshold is reached, processes might be left
    * without cells. The cells will be distributed evenly among the
    * remaining processes.
+   *
+   * Used in
+   * MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(),
+   * this policy agglomerates the coarse levels of a global-coarsening
+   * multigrid hierarchy onto fewer processes once the levels become too
+   * small to be distributed efficiently. The processes left without cells
+   * do not own any degrees of freedom on these levels, so they
+   * only take part in the transfer to the first finer level that
+   * assigns cells to them (MGTwoLevelTransfer redistributes the data
+   * between the two partitionings) and do no work on the coarser levels.
+   * The threshold can be given either as the number of cells or as the
+   * number of degrees of freedom per process.
    */
   template <int dim, int spacedim = dim>
   class MinimalGranularityPolicy : public Base<dim, spacedim>
@@ -138,6 +156,17 @@ namespace RepartitioningPolicyTools
      */
     MinimalGranularityPolicy(const unsigned int n_min_cells);
 
+    /**
+     * Constructor taking the minimum number of degrees of freedom per
+     * process for a DoFHandler that uses the finite element @p fe. The
+     * number of degrees of freedom per cell is estimated by the number of
+     * degrees of freedom not shared with neighbors on a structured
+     * hypercube mesh, e.g., $p^d$ for FE_Q of degree $p$ and $(p+1)^d$ for
+     * FE_DGQ, which gives the minimal number of cells per process.
+     */
+    MinimalGranularityPolicy(const FiniteElement<dim, spacedim> &fe,
+                             const types::global_dof_index       n_min_dofs);
+
     virtual LinearAlgebra::distributed::Vector<double>
     partition(const Triangulation<dim, spacedim> &tria_in) const override;
 
@@ -177,6 +206,74 @@ namespace RepartitioningPolicyTools
       weighting_function;
   };
 
+  /**
+   * A policy that partitions the cells such that the weights of the cells
+   * are distributed equally among the processes, like CellWeightPolicy, and
+   * that the number of faces between cells on different processes, i.e.,
+   * the edge cut of the graph of the cells connected through their faces,
+   * is small. This reduces the size of the ghost layer and the amount of
+   * communication in applications, in particular on complex geometries
+   * such as thin-walled parts, where the partitions along a space-filling
+   * curve can have a large surface.
+   *
+   * The partition is computed by the library itself without calling an
+   * external graph partitioner. The algorithm starts from the partition
+   * of CellWeightPolicy and then improves it by a number of refinement
+   * steps known from multilevel graph partitioners: In each step, every
+   * process considers the locally owned cells at the interface between two
+   * partitions, and moves a cell to a neighboring partition if that
+   * partition owns more of the face neighbors of the cell than the current
+   * one and if the weight of the target partition stays below the average
+   * weight times (1 + @p imbalance_tolerance). To avoid that two processes
+   * exchange the same cells back and forth, cells are only moved towards
+   * partitions with higher numbers in even steps and towards lower numbers
+   * in odd steps. The algorithm stops after @p n_refinement_steps steps or
+   * when no cell is moved in two consecutive steps.
+   *
+   * Since only face neighbors are considered and the partition information
+   * is exchanged through the ghost layer, the work in every step is
+   * proportional to the number of locally owned cells.
+   */
+  template <int dim, int spacedim = dim>
+  class GraphPartitioningPolicy : public Base<dim, spacedim>
+  {
+  public:
+    /**
+     * Constructor taking a function that gives a weight to each cell (a
+     * weight of one for all cells if the function is empty), the allowed
+     * imbalance of the weights of the partitions, and the maximal number of
+     * refinement steps.
+     */
+    GraphPartitioningPolicy(
+      const std::function<unsigned int(
+        const typename Triangulation<dim, spacedim>::cell_iterator &,
+        const CellStatus)> &weighting_function  = {},
+      const double          imbalance_tolerance = 0.05,
+      const unsigned int    n_refinement_steps  = 10);
+
+    virtual LinearAlgebra::distributed::Vector<double>
+    partition(const Triangulation<dim, spacedim> &tria_in) const override;
+
+  private:
+    /**
+     * A function that gives a weight to each cell.
+     */
+    const std::function<
+      unsigned int(const typename Triangulation<dim, spacedim>::cell_iterator &,
+                   const CellStatus)>
+      weighting_function;
+
+    /**
+     * Allowed relative excess of the weight of a partition over the average.
+     */
+    const double imbalance_tolerance;
+
+    /**
+     * Maximal number of refinement steps.
+     */
+    const unsigned int n_refinement_steps;
+  };
+
 } // namespace RepartitioningPolicyTools
 
 DEAL_II_NAMESPACE_CLOSE
@@ -99,6 +99,19 @@ namespace parallel
      * enumerate degrees of freedom in ways appropriate for the partitioned
      * mesh.
      *
+     * @note The cells, faces, vertices, and manifold information are held in
+     * the data structures of the base class dealii::Triangulation, which owns
+     * its memory. Consequently, every MPI process stores its own copy of the
+     * mesh, also if several processes run on the same node, and the memory
+     * used for the mesh on a node grows with the number of processes per node.
+     * In contrast to the vector entries of
+     * LinearAlgebra::distributed::Vector, which can be placed in an MPI-3
+     * shared-memory window, the mesh cannot be shared between the processes of
+     * a node. If the memory on a node is the limiting factor, consider to run
+     * fewer MPI processes per node and use threads within each process, or to
+     * use parallel::fullydistributed::Triangulation, which only stores the
+     * locally relevant part of the mesh on each process.
+     *
      * @ingroup distributed
      *
      * @dealiiConceptRequires{(concepts::is_valid_dim_spacedim<dim, spacedim>)}
@@ -229,6 +242,21 @@ namespace parallel
          * active cell partitioning method.
          */
         construct_multigrid_hierarchy = 0x8,
+
+        /**
+         * When partitioning the active cells with METIS or Zoltan, run the
+         * graph partitioner only on the process with rank zero and
+         * broadcast the resulting subdomain ids to all other processes.
+         * Without this flag, every process computes the same partitioning
+         * of the whole mesh redundantly, which for large meshes costs both
+         * time and memory on all processes and relies on the partitioner
+         * returning identical results everywhere.
+         *
+         * This flag can be combined with any of the flags selecting the
+         * partitioning scheme and has no effect for partition_zorder and
+         * partition_custom_signal.
+         */
+        partition_on_root_process = 0x10,
       };
 
 
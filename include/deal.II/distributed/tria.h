@@ -345,7 +345,26 @@ namespace parallel
          * active cell that owns an arbitrary point in case all attached
          * manifolds are flat.
          */
-        communicate_vertices_to_p4est = 0x8
+        communicate_vertices_to_p4est = 0x8,
+        /**
+         * Setting this flag will restrict the layer of ghost cells to those
+         * cells that share a face with a locally owned cell, rather than
+         * all cells that share at least a vertex with a locally owned cell.
+         * Constructing this smaller ghost layer in p4est and copying it into
+         * the deal.II mesh is cheaper after each refinement and
+         * repartitioning cycle, and it reduces the amount of data exchanged
+         * for ghosted vectors.
+         *
+         * This option is only suitable for discretizations whose coupling
+         * between cells is exclusively through faces, such as discontinuous
+         * Galerkin methods with FE_DGQ and related elements, or for
+         * cell-local operations. Continuous elements, which need to agree on
+         * degrees of freedom located at vertices and edges with cells that
+         * only share these objects, require the full ghost layer. For the
+         * same reason, this flag cannot be combined with
+         * construct_multigrid_hierarchy.
+         */
+        face_neighbor_ghost_layer_only = 0x10
       };
 
 
@@ -890,7 +909,8 @@ namespace parallel
         mesh_reconstruction_after_repartitioning = 0x1,
         construct_multigrid_hierarchy            = 0x2,
         no_automatic_repartitioning              = 0x4,
-        communicate_vertices_to_p4est            = 0x8
+        communicate_vertices_to_p4est            = 0x8,
+        face_neighbor_ghost_layer_only           = 0x10
       };
 
       /**
@@ -1025,7 +1045,8 @@ namespace parallel
         mesh_reconstruction_after_repartitioning = 0x1,
         construct_multigrid_hierarchy            = 0x2,
         no_automatic_repartitioning              = 0x4,
-        communicate_vertices_to_p4est            = 0x8
+        communicate_vertices_to_p4est            = 0x8,
+        face_neighbor_ghost_layer_only           = 0x10
       };
 
       /**
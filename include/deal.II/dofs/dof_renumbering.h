@@ -23,6 +23,9 @@
 
 #include <deal.II/dofs/dof_handler.h>
 
+#include <deal.II/grid/cell_id.h>
+
+#include <map>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -31,6 +34,12 @@ DEAL_II_NAMESPACE_OPEN
 // forward declaration
 template <int, typename, typename>
 class MatrixFree;
+
+namespace Portable
+{
+  template <int, typename>
+  class MatrixFree;
+}
 #endif
 
 /**
@@ -230,7 +239,11 @@ class MatrixFree;
  * operations on vectors before and after the access of the vector data in the
  * respective loops. The algorithm matrix_free_data_locality() makes sure
  * that all unknowns with a short distance between the first and last access
- * are grouped together, in order to increase the spatial data locality.
+ * are grouped together, in order to increase the spatial data locality. For
+ * the device loops of Portable::MatrixFree, the function
+ * portable_matrix_free_data_locality() numbers the unknowns in the order in
+ * which the threads on the device access them, such that the memory accesses
+ * of neighboring threads can be coalesced.
  *
  *
  * <h3>A comparison of reordering strategies</h3>
@@ -1277,6 +1290,79 @@ namespace DoFRenumbering
    * @}
    */
 
+  /**
+   * @name Renumbering after adaptive mesh refinement
+   * @{
+   */
+
+  /**
+   * Return the global indices of the degrees of freedom of all locally owned
+   * active cells of @p dof_handler, sorted by the CellId of the cells. The
+   * result is meant to be stored before calling
+   * Triangulation::execute_coarsening_and_refinement() and to be passed to
+   * incremental() after the degrees of freedom have been distributed on the
+   * new mesh.
+   *
+   * @note This function does not support DoFHandler objects with
+   * hp-capabilities.
+   */
+  template <int dim, int spacedim>
+  std::map<CellId, std::vector<types::global_dof_index>>
+  extract_cell_dof_indices(const DoFHandler<dim, spacedim> &dof_handler);
+
+  /**
+   * Renumber the degrees of freedom after adaptive mesh refinement such that
+   * the numbering follows the one before the refinement, without having to
+   * compute a new locality-preserving numbering (like Cuthill_McKee() or
+   * matrix_free_data_locality()) for the whole mesh from scratch.
+   *
+   * The argument @p old_cell_dof_indices is the result of
+   * extract_cell_dof_indices() called before the mesh was refined. A cell is
+   * considered unchanged if it is contained in @p old_cell_dof_indices with
+   * the same number of degrees of freedom. The degrees of freedom of these
+   * cells keep the relative order they had before the refinement. All other
+   * degrees of freedom, i.e., those on refined or coarsened cells, are
+   * placed right after the first old degree of freedom of the cell they were
+   * created from, so the changed regions are renumbered locally and their
+   * entries end up close to the ones of the neighboring unchanged cells. As
+   * a consequence, a numbering with good locality before the refinement
+   * also has good locality afterwards, provided that only a small part of
+   * the mesh changed.
+   *
+   * The return value is the set of locally owned degrees of freedom in the
+   * new numbering that are not located on an unchanged cell. These are the
+   * only entries of a solution vector that need to be interpolated from the
+   * old mesh, whereas all other entries can be copied; it can also be used
+   * to limit the update of data structures depending on the numbering.
+   *
+   * For a parallel triangulation, each process only renumbers the
+   * degrees of freedom it owns among themselves, so the locally owned index
+   * sets are not changed by this function.
+   */
+  template <int dim, int spacedim>
+  IndexSet
+  incremental(DoFHandler<dim, spacedim> &dof_handler,
+              const std::map<CellId, std::vector<types::global_dof_index>>
+                &old_cell_dof_indices);
+
+  /**
+   * Compute the renumbering vector needed by the incremental() function.
+   * Does not perform the renumbering on the @p DoFHandler dofs but returns
+   * the renumbering vector as well as the set of changed degrees of freedom
+   * in the new numbering.
+   */
+  template <int dim, int spacedim>
+  IndexSet
+  compute_incremental(
+    std::vector<types::global_dof_index> &new_dof_indices,
+    const DoFHandler<dim, spacedim>      &dof_handler,
+    const std::map<CellId, std::vector<types::global_dof_index>>
+      &old_cell_dof_indices);
+
+  /**
+   * @}
+   */
+
   /**
    * @name Numberings for better performance with the MatrixFree infrastructure
    * @{
@@ -1367,6 +1453,45 @@ namespace DoFRenumbering
     const AffineConstraints<Number> &constraints,
     const AdditionalDataType        &matrix_free_additional_data);
 
+  /**
+   * Renumber the locally owned degrees of freedom in the order in which the
+   * device kernels of Portable::MatrixFree access them, in order to
+   * coalesce the memory accesses of the threads of a team. The unknowns are
+   * numbered as they are first touched when running over the colors of
+   * Portable::MatrixFree::get_colored_graph(), over the cells of each color
+   * (and thus over the blocks of cells assigned to one team) in the order
+   * of the teams, and over the unknowns of each cell in lexicographic order,
+   * which is the order in which consecutive threads of a team read and write
+   * the vector entries of a cell. Unknowns not touched by any cell are
+   * placed at the end of the locally owned range.
+   *
+   * In contrast to matrix_free_data_locality(), which targets the cache
+   * reuse between cell batches on CPUs, the goal of this ordering is that
+   * neighboring threads load neighboring vector entries. The
+   * Portable::MatrixFree object in @p matrix_free needs to be set up with
+   * @p dof_handler, and it needs to be set up again after the renumbering.
+   * Since the cell coloring does not depend on the numbering of the
+   * degrees of freedom, the new object runs over the cells in the same
+   * order.
+   */
+  template <int dim, typename Number>
+  void
+  portable_matrix_free_data_locality(
+    DoFHandler<dim>                         &dof_handler,
+    const Portable::MatrixFree<dim, Number> &matrix_free);
+
+  /**
+   * Compute the renumbering vector needed by the
+   * portable_matrix_free_data_locality() function. Does not perform the
+   * renumbering on the @p DoFHandler dofs but returns the renumbering
+   * vector.
+   */
+  template <int dim, typename Number>
+  std::vector<types::global_dof_index>
+  compute_portable_matrix_free_data_locality(
+    const DoFHandler<dim>                   &dof_handler,
+    const Portable::MatrixFree<dim, Number> &matrix_free);
+
   /**
    * @}
    */
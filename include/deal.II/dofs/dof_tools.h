@@ -417,6 +417,11 @@ namespace DoFTools
    * need to remember using SparsityPattern::compress() after generating the
    * pattern.
    *
+   * @note If more than one thread is available, the entries of the cells
+   * are computed in parallel using WorkStream::run() and then added to
+   * the sparsity pattern one cell after the other, in the same order as in
+   * the sequential case. The same holds for make_flux_sparsity_pattern().
+   *
    * @ingroup constraints
    */
   template <int dim, int spacedim, typename number = double>
@@ -1837,6 +1842,50 @@ namespace DoFTools
   dof_indices_with_subdomain_association(
     const DoFHandler<dim, spacedim> &dof_handler,
     const types::subdomain_id        subdomain);
+
+  /**
+   * Color the locally owned active cells of @p dof_handler such that no two
+   * cells of the same color write into the same row of a matrix or vector
+   * when their local contributions are added with
+   * AffineConstraints::distribute_local_to_global() using @p constraints.
+   * To this end, the conflict indices passed to
+   * GraphColoring::make_graph_coloring() are the degrees of freedom of a
+   * cell together with all degrees of freedom they are constrained to, as
+   * returned by AffineConstraints::resolve_indices().
+   *
+   * The result can be passed to the variant of WorkStream::run() that takes
+   * colored iterators. Since that function runs the worker and the copier
+   * for the cells of one color concurrently, the copier does not need to be
+   * serialized any more and the assembly into a SparseMatrix and a Vector
+   * proceeds in parallel without locks or atomic operations:
+   * @code
+   * const auto colored_cells =
+   *   DoFTools::make_cell_coloring_for_assembly(dof_handler, constraints);
+   * WorkStream::run(colored_cells,
+   *                 worker,
+   *                 [&](const CopyData &data) {
+   *                   constraints.distribute_local_to_global(
+   *                     data.cell_matrix,
+   *                     data.cell_rhs,
+   *                     data.local_dof_indices,
+   *                     system_matrix,
+   *                     system_rhs);
+   *                 },
+   *                 ScratchData(...),
+   *                 CopyData(...));
+   * @endcode
+   * This is correct because AffineConstraints::distribute_local_to_global()
+   * only uses thread-local scratch data and writes into the rows of the
+   * resolved indices only.
+   *
+   * The coloring has to be recomputed whenever the mesh, the numbering of
+   * the degrees of freedom, or the constraints change.
+   */
+  template <int dim, int spacedim, typename number>
+  std::vector<
+    std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>>
+  make_cell_coloring_for_assembly(const DoFHandler<dim, spacedim> &dof_handler,
+                                  const AffineConstraints<number> &constraints);
   /** @} */
 
   /**
@@ -0,0 +1,246 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_dofs_work_stream_coloring_h
+#define dealii_dofs_work_stream_coloring_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/work_stream.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/lac/affine_constraints.h>
+
+#include <boost/signals2/connection.hpp>
+
+#include <functional>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace WorkStream
+{
+  /**
+   * A cache for a coloring of the locally owned active cells of a
+   * DoFHandler that allows to run the worker and the copier of an assembly
+   * loop concurrently, as computed by
+   * DoFTools::make_cell_coloring_for_assembly(). The coloring is computed
+   * the first time it is requested and then stored until it becomes
+   * invalid.
+   *
+   * Objects of this class are meant to be used with the variant of
+   * WorkStream::run() taking an object of this class instead of a range of
+   * iterators:
+   * @code
+   * WorkStream::DoFHandlerColoring<dim> coloring(dof_handler, constraints);
+   * ...
+   * WorkStream::run(coloring,
+   *                 worker,
+   *                 [&](const CopyData &data) {
+   *                   constraints.distribute_local_to_global(
+   *                     data.cell_matrix,
+   *                     data.cell_rhs,
+   *                     data.local_dof_indices,
+   *                     system_matrix,
+   *                     system_rhs);
+   *                 },
+   *                 ScratchData(...),
+   *                 CopyData(...));
+   * @endcode
+   *
+   * The coloring is recomputed automatically after the triangulation has
+   * changed, and if the number of degrees of freedom of the DoFHandler is
+   * different from the one the coloring was computed for. Since neither the
+   * DoFHandler nor the AffineConstraints object signal other changes, one
+   * needs to call invalidate() after renumbering the degrees of freedom or
+   * changing the constraints without changing the mesh.
+   *
+   * The DoFHandler and AffineConstraints objects passed to the constructor
+   * must live at least as long as this object.
+   */
+  template <int dim, int spacedim = dim>
+  class DoFHandlerColoring
+  {
+  public:
+    /**
+     * The type of the iterators stored in the coloring.
+     */
+    using CellIterator =
+      typename DoFHandler<dim, spacedim>::active_cell_iterator;
+
+    /**
+     * Constructor. The coloring is not computed here but on the first call
+     * to get_colored_cells().
+     */
+    template <typename number>
+    DoFHandlerColoring(const DoFHandler<dim, spacedim> &dof_handler,
+                       const AffineConstraints<number> &constraints);
+
+    /**
+     * Destructor. Disconnects from the signals of the triangulation.
+     */
+    ~DoFHandlerColoring();
+
+    /**
+     * Return the colored cells, computing them if necessary.
+     */
+    const std::vector<std::vector<CellIterator>> &
+    get_colored_cells() const;
+
+    /**
+     * Mark the stored coloring as outdated, so that it is recomputed the
+     * next time it is requested.
+     */
+    void
+    invalidate();
+
+  private:
+    /**
+     * The DoFHandler the cells are taken from.
+     */
+    ObserverPointer<const DoFHandler<dim, spacedim>> dof_handler;
+
+    /**
+     * A function computing the coloring with the constraints given to the
+     * constructor.
+     */
+    std::function<std::vector<std::vector<CellIterator>>()> compute_coloring;
+
+    /**
+     * The stored coloring.
+     */
+    mutable std::vector<std::vector<CellIterator>> colored_cells;
+
+    /**
+     * Whether the stored coloring is up to date.
+     */
+    mutable bool is_valid;
+
+    /**
+     * The number of degrees of freedom the coloring was computed for.
+     */
+    mutable types::global_dof_index n_dofs;
+
+    /**
+     * The connection to the signal of the triangulation that is triggered
+     * by all changes of the mesh.
+     */
+    boost::signals2::connection tria_change_signal;
+  };
+
+
+
+  /**
+   * Run the worker and copier functions on the locally owned cells of a
+   * DoFHandler in parallel, using the colored variant of WorkStream::run()
+   * with the coloring cached in @p coloring. In contrast to the variants of
+   * WorkStream::run() taking a range of iterators, the copier is run
+   * concurrently on all cells within one color, so it must be safe to call
+   * it from several threads for cells of the same color, which is the case
+   * for AffineConstraints::distribute_local_to_global() with the constraints
+   * used for the coloring.
+   */
+  template <int dim,
+            int spacedim,
+            typename Worker,
+            typename Copier,
+            typename ScratchData,
+            typename CopyData>
+  void
+  run(const DoFHandlerColoring<dim, spacedim> &coloring,
+      Worker                                   worker,
+      Copier                                   copier,
+      const ScratchData                       &sample_scratch_data,
+      const CopyData                          &sample_copy_data,
+      const unsigned int queue_length = 2 * MultithreadInfo::n_threads(),
+      const unsigned int chunk_size   = 8)
+  {
+    run(coloring.get_colored_cells(),
+        worker,
+        copier,
+        sample_scratch_data,
+        sample_copy_data,
+        queue_length,
+        chunk_size);
+  }
+
+
+
+#ifndef DOXYGEN
+  /* ---------------------- Template functions ---------------------------- */
+
+  template <int dim, int spacedim>
+  template <typename number>
+  DoFHandlerColoring<dim, spacedim>::DoFHandlerColoring(
+    const DoFHandler<dim, spacedim> &dof_handler,
+    const AffineConstraints<number> &constraints)
+    : dof_handler(&dof_handler)
+    , compute_coloring([&dof_handler, &constraints]() {
+      return DoFTools::make_cell_coloring_for_assembly(dof_handler,
+                                                       constraints);
+    })
+    , is_valid(false)
+    , n_dofs(numbers::invalid_dof_index)
+  {
+    tria_change_signal =
+      dof_handler.get_triangulation().signals.any_change.connect(
+        [this]() { invalidate(); });
+  }
+
+
+
+  template <int dim, int spacedim>
+  DoFHandlerColoring<dim, spacedim>::~DoFHandlerColoring()
+  {
+    tria_change_signal.disconnect();
+  }
+
+
+
+  template <int dim, int spacedim>
+  const std::vector<
+    std::vector<typename DoFHandlerColoring<dim, spacedim>::CellIterator>> &
+  DoFHandlerColoring<dim, spacedim>::get_colored_cells() const
+  {
+    if (is_valid == false || n_dofs != dof_handler->n_dofs())
+      {
+        colored_cells = compute_coloring();
+        n_dofs        = dof_handler->n_dofs();
+        is_valid      = true;
+      }
+    return colored_cells;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  DoFHandlerColoring<dim, spacedim>::invalidate()
+  {
+    is_valid = false;
+    colored_cells.clear();
+  }
+
+#endif // DOXYGEN
+
+} // namespace WorkStream
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -719,6 +719,27 @@ public:
      */
     UpdateFlags update_each;
 
+    /**
+     * Return a copy of this object that can be used by another FEValues,
+     * FEFaceValues, or FESubfaceValues object set up with the same mapping,
+     * quadrature, and update flags as the one owning the current object, or
+     * a null pointer if the element does not support this.
+     *
+     * Implementations in derived classes share the data that is only written
+     * in FiniteElement::get_data() and its face and subface variants (such as
+     * the values and derivatives of the shape functions on the reference
+     * cell) between the copies, and duplicate everything that is modified on
+     * each cell, so that the copies can be used concurrently. This way,
+     * copying FEValues objects, as is done for the scratch objects of
+     * WorkStream::run(), does not need to recompute these tables for every
+     * copy.
+     *
+     * The default implementation returns a null pointer, in which case
+     * FEValues calls FiniteElement::get_data() again.
+     */
+    virtual std::unique_ptr<InternalDataBase>
+    clone() const;
+
     /**
      * Return an estimate (in bytes) for the memory consumption of this object.
      */
@@ -26,6 +26,11 @@
 #include <deal.II/hp/fe_values.h>
 #include <deal.II/hp/q_collection.h>
 
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
 DEAL_II_NAMESPACE_OPEN
 
 #ifndef DOXYGEN
@@ -1688,7 +1693,7 @@ public:
    * @note This function is only available after a call to reinit() and can
    * change from one call to reinit() to the next.
    */
-  std::vector<types::global_dof_index>
+  const std::vector<types::global_dof_index> &
   get_interface_dof_indices() const;
 
   /**
@@ -2068,6 +2073,16 @@ private:
    */
   std::vector<std::array<unsigned int, 2>> dofmap;
 
+  /**
+   * Temporary arrays for the local dof indices of the two cells and their
+   * sorted combination used in reinit(). They are kept as members in order
+   * to avoid allocating memory for every interface.
+   */
+  std::vector<types::global_dof_index> dof_indices_1;
+  std::vector<types::global_dof_index> dof_indices_2;
+  std::vector<std::pair<types::global_dof_index, unsigned int>>
+    sorted_dof_indices;
+
   /**
    * Pointer to internal_fe_face_values or internal_fe_subface_values,
    * respectively as determined in reinit().
@@ -2519,43 +2534,47 @@ FEInterfaceValues<dim, spacedim>::reinit(
   if constexpr (is_dof_cell_accessor_neighbor && is_dof_cell_accessor)
     {
       // Get dof indices first:
-      std::vector<types::global_dof_index> v(
-        fe_face_values->get_fe().n_dofs_per_cell());
-      cell->get_active_or_mg_dof_indices(v);
-      std::vector<types::global_dof_index> v2(
-        fe_face_values_neighbor->get_fe().n_dofs_per_cell());
-      cell_neighbor->get_active_or_mg_dof_indices(v2);
-
-      // Fill a map from the global dof index to the left and right
-      // local index.
-      std::map<types::global_dof_index, std::pair<unsigned int, unsigned int>>
-                                            tempmap;
-      std::pair<unsigned int, unsigned int> invalid_entry(
-        numbers::invalid_unsigned_int, numbers::invalid_unsigned_int);
-
-      for (unsigned int i = 0; i < v.size(); ++i)
-        {
-          // If not already existing, add an invalid entry:
-          auto result = tempmap.insert(std::make_pair(v[i], invalid_entry));
-          result.first->second.first = i;
-        }
-
-      for (unsigned int i = 0; i < v2.size(); ++i)
-        {
-          // If not already existing, add an invalid entry:
-          auto result = tempmap.insert(std::make_pair(v2[i], invalid_entry));
-          result.first->second.second = i;
-        }
-
-      // Transfer from the map to the sorted std::vectors.
-      dofmap.resize(tempmap.size());
-      interface_dof_indices.resize(tempmap.size());
-      unsigned int idx = 0;
-      for (auto &x : tempmap)
+      const unsigned int n_dofs_per_cell_1 =
+        fe_face_values->get_fe().n_dofs_per_cell();
+      const unsigned int n_dofs_per_cell_2 =
+        fe_face_values_neighbor->get_fe().n_dofs_per_cell();
+      dof_indices_1.resize(n_dofs_per_cell_1);
+      cell->get_active_or_mg_dof_indices(dof_indices_1);
+      dof_indices_2.resize(n_dofs_per_cell_2);
+      cell_neighbor->get_active_or_mg_dof_indices(dof_indices_2);
+
+      // Sort the global dof indices of both cells, together with their
+      // position in the concatenation of the two lists of local dof indices.
+      // Using the position as the second sort key, entries with the same
+      // global index are ordered by cell first and by local index within
+      // each cell, i.e., in the order they would have been visited
+      // sequentially.
+      sorted_dof_indices.resize(n_dofs_per_cell_1 + n_dofs_per_cell_2);
+      for (unsigned int i = 0; i < n_dofs_per_cell_1; ++i)
+        sorted_dof_indices[i] = {dof_indices_1[i], i};
+      for (unsigned int i = 0; i < n_dofs_per_cell_2; ++i)
+        sorted_dof_indices[n_dofs_per_cell_1 + i] = {dof_indices_2[i],
+                                                     n_dofs_per_cell_1 + i};
+      std::sort(sorted_dof_indices.begin(), sorted_dof_indices.end());
+
+      // Merge entries with the same global index into one interface dof,
+      // which keeps the local indices on both cells. The memory of the
+      // member vectors is retained between calls.
+      interface_dof_indices.clear();
+      dofmap.clear();
+      for (const auto &[dof_index, position] : sorted_dof_indices)
         {
-          interface_dof_indices[idx] = x.first;
-          dofmap[idx]                = {{x.second.first, x.second.second}};
-          ++idx;
+          if (interface_dof_indices.empty() ||
+              interface_dof_indices.back() != dof_index)
+            {
+              interface_dof_indices.push_back(dof_index);
+              dofmap.push_back({{numbers::invalid_unsigned_int,
+                                 numbers::invalid_unsigned_int}});
+            }
+          if (position < n_dofs_per_cell_1)
+            dofmap.back()[0] = position;
+          else
+            dofmap.back()[1] = position - n_dofs_per_cell_1;
         }
     }
   else
@@ -2847,7 +2866,7 @@ FEInterfaceValues<dim, spacedim>::at_boundary() const
 
 
 template <int dim, int spacedim>
-std::vector<types::global_dof_index>
+const std::vector<types::global_dof_index> &
 FEInterfaceValues<dim, spacedim>::get_interface_dof_indices() const
 {
   return interface_dof_indices;
@@ -278,20 +278,6 @@ protected:
 
     const unsigned int n_q_points = quadrature.size();
 
-    // initialize some scratch arrays. we need them for the underlying
-    // polynomial to put the values and derivatives of shape functions
-    // to put there, depending on what the user requested
-    std::vector<double> values(
-      update_flags & update_values ? this->n_dofs_per_cell() : 0);
-    std::vector<Tensor<1, dim>> grads(
-      update_flags & update_gradients ? this->n_dofs_per_cell() : 0);
-    std::vector<Tensor<2, dim>> grad_grads(
-      update_flags & update_hessians ? this->n_dofs_per_cell() : 0);
-    std::vector<Tensor<3, dim>> third_derivatives(
-      update_flags & update_3rd_derivatives ? this->n_dofs_per_cell() : 0);
-    std::vector<Tensor<4, dim>>
-      fourth_derivatives; // won't be needed, so leave empty
-
     // now also initialize fields the fields of this class's own
     // temporary storage, depending on what we need for the given
     // update flags.
@@ -324,51 +310,36 @@ protected:
 
     // next already fill those fields of which we have information by
     // now. note that the shape gradients are only those on the unit
-    // cell, and need to be transformed when visiting an actual cell
+    // cell, and need to be transformed when visiting an actual cell.
+    //
+    // the values of shape functions at quadrature points don't change.
+    // consequently, write these values right into the output array if
+    // we can, i.e., if the output array has the correct size. this is
+    // the case on cells. on faces, we already precompute data on *all*
+    // faces and subfaces, but we later on copy only a portion of it
+    // into the output object; in that case, compute the data on all
+    // faces into the scratch object. for everything else, derivatives
+    // need to be transformed, so we write them into our scratch space
+    // and only later copy stuff into where FEValues wants it
+    Table<2, double>  no_values;
+    Table<2, double> &values =
+      (!(update_flags & update_values) ||
+       output_data.shape_values.n_rows() == 0) ?
+        no_values :
+        (output_data.shape_values.n_cols() == n_q_points ?
+           output_data.shape_values :
+           data.shape_values);
+    Table<2, Tensor<4, dim>>
+      fourth_derivatives; // won't be needed, so leave empty
+
     if (update_flags & (update_values | update_gradients | update_hessians |
                         update_3rd_derivatives))
-      for (unsigned int i = 0; i < n_q_points; ++i)
-        {
-          poly_space->evaluate(quadrature.point(i),
-                               values,
-                               grads,
-                               grad_grads,
-                               third_derivatives,
-                               fourth_derivatives);
-
-          // the values of shape functions at quadrature points don't change.
-          // consequently, write these values right into the output array if
-          // we can, i.e., if the output array has the correct size. this is
-          // the case on cells. on faces, we already precompute data on *all*
-          // faces and subfaces, but we later on copy only a portion of it
-          // into the output object; in that case, copy the data from all
-          // faces into the scratch object
-          if (update_flags & update_values)
-            if (output_data.shape_values.n_rows() > 0)
-              {
-                if (output_data.shape_values.n_cols() == n_q_points)
-                  for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-                    output_data.shape_values[k][i] = values[k];
-                else
-                  for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-                    data.shape_values[k][i] = values[k];
-              }
-
-          // for everything else, derivatives need to be transformed,
-          // so we write them into our scratch space and only later
-          // copy stuff into where FEValues wants it
-          if (update_flags & update_gradients)
-            for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-              data.shape_gradients[k][i] = grads[k];
-
-          if (update_flags & update_hessians)
-            for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-              data.shape_hessians[k][i] = grad_grads[k];
-
-          if (update_flags & update_3rd_derivatives)
-            for (unsigned int k = 0; k < this->n_dofs_per_cell(); ++k)
-              data.shape_3rd_derivatives[k][i] = third_derivatives[k];
-        }
+      poly_space->evaluate_at_points(quadrature.get_points(),
+                                     values,
+                                     data.shape_gradients,
+                                     data.shape_hessians,
+                                     data.shape_3rd_derivatives,
+                                     fourth_derivatives);
     return data_ptr;
   }
 
@@ -425,7 +396,58 @@ protected:
    */
   class InternalData : public FiniteElement<dim, spacedim>::InternalDataBase
   {
+  private:
+    /**
+     * The tables referenced by the public members of this class. They are
+     * kept in a separate object so that the copies created by clone() can
+     * share them.
+     */
+    struct ShapeTables
+    {
+      Table<2, double>         shape_values;
+      Table<2, Tensor<1, dim>> shape_gradients;
+      Table<2, Tensor<2, dim>> shape_hessians;
+      Table<2, Tensor<3, dim>> shape_3rd_derivatives;
+    };
+
+    /**
+     * Pointer to the tables, shared among all copies of this object.
+     */
+    std::shared_ptr<ShapeTables> shape_tables;
+
+    /**
+     * Constructor for an object that uses the given tables.
+     */
+    explicit InternalData(const std::shared_ptr<ShapeTables> &tables)
+      : shape_tables(tables)
+      , shape_values(tables->shape_values)
+      , shape_gradients(tables->shape_gradients)
+      , shape_hessians(tables->shape_hessians)
+      , shape_3rd_derivatives(tables->shape_3rd_derivatives)
+    {}
+
   public:
+    /**
+     * Constructor. Sets up empty tables.
+     */
+    InternalData()
+      : InternalData(std::make_shared<ShapeTables>())
+    {}
+
+    /**
+     * Return a copy of the current object that refers to the same tables.
+     * This is possible because the tables are only written in get_data()
+     * and its face and subface variants, and only read afterwards.
+     */
+    virtual std::unique_ptr<
+      typename FiniteElement<dim, spacedim>::InternalDataBase>
+    clone() const override
+    {
+      std::unique_ptr<InternalData> copy(new InternalData(shape_tables));
+      copy->update_each = this->update_each;
+      return copy;
+    }
+
     /**
      * Array with shape function values in quadrature points. There is one row
      * for each shape function, containing values for each quadrature point.
@@ -435,7 +457,7 @@ protected:
      * under transformation to the real cell, we only need to copy them over
      * when visiting a concrete cell.
      */
-    Table<2, double> shape_values;
+    Table<2, double> &shape_values;
 
     /**
      * Array with shape function gradients in quadrature points. There is one
@@ -446,7 +468,7 @@ protected:
      * then only have to apply the transformation (which is a matrix-vector
      * multiplication) when visiting an actual cell.
      */
-    Table<2, Tensor<1, dim>> shape_gradients;
+    Table<2, Tensor<1, dim>> &shape_gradients;
 
     /**
      * Array with shape function hessians in quadrature points. There is one
@@ -457,7 +479,7 @@ protected:
      * then only have to apply the transformation when visiting an actual
      * cell.
      */
-    Table<2, Tensor<2, dim>> shape_hessians;
+    Table<2, Tensor<2, dim>> &shape_hessians;
 
     /**
      * Array with shape function third derivatives in quadrature points. There
@@ -468,7 +490,7 @@ protected:
      * cell. We then only have to apply the transformation when visiting an
      * actual cell.
      */
-    Table<2, Tensor<3, dim>> shape_3rd_derivatives;
+    Table<2, Tensor<3, dim>> &shape_3rd_derivatives;
   };
 
   /**
@@ -17,7 +17,7 @@
 
 #include <deal.II/base/config.h>
 
-#include <deal.II/base/mutex.h>
+#include <deal.II/base/lazy.h>
 
 #include <deal.II/fe/fe_poly.h>
 
@@ -327,11 +327,15 @@ protected:
 
 private:
   /**
-   * Mutex variables used for protecting the initialization of restriction
-   * and embedding matrices.
+   * The restriction and embedding matrices, indexed by the refinement case
+   * (shifted by one) and the child, as computed upon first request by
+   * get_restriction_matrix() and get_prolongation_matrix(). Each matrix is
+   * initialized independently of all others, such that only the matrices
+   * that are actually used get computed, and can be accessed without
+   * locking once available.
    */
-  mutable Threads::Mutex restriction_matrix_mutex;
-  mutable Threads::Mutex prolongation_matrix_mutex;
+  std::vector<std::vector<Lazy<FullMatrix<double>>>> lazy_restriction_matrices;
+  std::vector<std::vector<Lazy<FullMatrix<double>>>> lazy_prolongation_matrices;
 
   /**
    * The highest polynomial degree of the underlying tensor product space
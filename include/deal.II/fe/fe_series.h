@@ -125,6 +125,26 @@ namespace FESeries
               const unsigned int            cell_active_fe_index,
               Table<dim, CoefficientType>  &fourier_coefficients);
 
+    /**
+     * Calculate the Fourier coefficients of a whole batch of cells
+     * that all share the same finite element with @p cell_active_fe_index .
+     * Each row of @p local_dof_values contains the local degrees of freedom
+     * of one cell. On return, the corresponding row of @p coefficients
+     * contains the coefficients of that cell in the same order as the
+     * elements of a Table<dim, CoefficientType> filled by Table::fill(), i.e.,
+     * with the last index running fastest.
+     *
+     * Rather than transforming the cells one at a time, this function does
+     * the work of all cells in the batch in a single matrix-matrix product,
+     * which is considerably faster if many cells are to be processed.
+     * @p coefficients is resized as necessary.
+     */
+    template <typename Number>
+    void
+    calculate(const FullMatrix<Number>    &local_dof_values,
+              const unsigned int          cell_active_fe_index,
+              FullMatrix<CoefficientType> &coefficients);
+
     /**
      * Return the number of coefficients in each coordinate direction for the
      * finite element associated with @p index in the provided hp::FECollection.
@@ -295,6 +315,26 @@ namespace FESeries
               const unsigned int            cell_active_fe_index,
               Table<dim, CoefficientType>  &legendre_coefficients);
 
+    /**
+     * Calculate the Legendre coefficients of a whole batch of cells
+     * that all share the same finite element with @p cell_active_fe_index .
+     * Each row of @p local_dof_values contains the local degrees of freedom
+     * of one cell. On return, the corresponding row of @p coefficients
+     * contains the coefficients of that cell in the same order as the
+     * elements of a Table<dim, CoefficientType> filled by Table::fill(), i.e.,
+     * with the last index running fastest.
+     *
+     * Rather than transforming the cells one at a time, this function does
+     * the work of all cells in the batch in a single matrix-matrix product,
+     * which is considerably faster if many cells are to be processed.
+     * @p coefficients is resized as necessary.
+     */
+    template <typename Number>
+    void
+    calculate(const FullMatrix<Number>    &local_dof_values,
+              const unsigned int          cell_active_fe_index,
+              FullMatrix<CoefficientType> &coefficients);
+
     /**
      * Return the number of coefficients in each coordinate direction for the
      * finite element associated with @p index in the provided hp::FECollection.
@@ -17,6 +17,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/lazy.h>
+
 #include <deal.II/fe/fe.h>
 #include <deal.II/fe/fe_tools.h>
 
@@ -1271,6 +1273,15 @@ private:
      */
     ~InternalData() override;
 
+    /**
+     * Return a copy of the current object if all base elements support
+     * copying their internal data, and a null pointer otherwise. The output
+     * objects of the base elements are duplicated.
+     */
+    virtual std::unique_ptr<
+      typename FiniteElement<dim, spacedim>::InternalDataBase>
+    clone() const override;
+
     /**
      * Give write-access to the pointer to a @p InternalData of the
      * `base_no`th base element.
@@ -1324,11 +1335,15 @@ private:
   };
 
   /**
-   * Mutex variables used for protecting the initialization of restriction
-   * and embedding matrices.
+   * The restriction and embedding matrices, indexed by the refinement case
+   * (shifted by one) and the child, as computed upon first request by
+   * get_restriction_matrix() and get_prolongation_matrix(). Each matrix is
+   * initialized independently of all others, such that only the matrices
+   * that are actually used get computed, and can be accessed without
+   * locking once available.
    */
-  mutable std::mutex restriction_matrix_mutex;
-  mutable std::mutex prolongation_matrix_mutex;
+  std::vector<std::vector<Lazy<FullMatrix<double>>>> lazy_restriction_matrices;
+  std::vector<std::vector<Lazy<FullMatrix<double>>>> lazy_prolongation_matrices;
 
   friend class FE_Enriched<dim, spacedim>;
 };
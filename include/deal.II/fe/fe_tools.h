@@ -388,6 +388,43 @@ namespace FETools
     const unsigned int face_fine,
     const double       threshold = 1.e-12);
 
+  /**
+   * Enable the memoization of the matrices computed by
+   * compute_embedding_matrices() and compute_face_embedding_matrices(),
+   * which are called by the constructors of many finite element classes and
+   * dominate the construction time of elements of high degree.
+   *
+   * Once enabled, the matrices are kept in memory, such that constructing
+   * the same element again, e.g. in an hp::FECollection or as base element
+   * of several FESystem objects, does not recompute them. The matrices are
+   * identified by the name of the element, the space dimensions, the number
+   * type, the arguments of the functions above, and a checksum of the
+   * (generalized) support points of the element.
+   *
+   * If @p directory is not empty, the matrices are additionally written
+   * into one binary file per set of matrices in that directory, and read
+   * from there if not yet in memory. This allows subsequent runs of a
+   * program, or all processes of a parallel program after one of them (or a
+   * previous serial run) has filled the directory, to skip the computation
+   * altogether. Each file is tagged with the deal.II version and is ignored
+   * if it does not match the present version or the requested matrices.
+   * Files are written under a temporary name and then renamed, such that
+   * many processes may use the same directory concurrently. The directory
+   * needs to exist.
+   *
+   * @note The cache is disabled by default.
+   */
+  void
+  enable_embedding_matrix_cache(const std::string &directory = "");
+
+  /**
+   * Disable the cache enabled by enable_embedding_matrix_cache() and release
+   * the matrices kept in memory. Files written into the cache directory are
+   * not removed.
+   */
+  void
+  disable_embedding_matrix_cache();
+
   /**
    * For all possible (isotropic and anisotropic) refinement cases compute the
    * <i>L<sup>2</sup></i>-projection matrices from the children to a coarse
@@ -64,10 +64,19 @@
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/householder.h>
 
+#include <atomic>
 #include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <sstream>
+#include <thread>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -1299,6 +1308,241 @@ namespace FETools
         interpolation_matrix = tmp;
       }
     } // namespace FEToolsGetInterpolationMatrixHelper
+
+    namespace FEToolsEmbeddingMatrixCache
+    {
+      // The state of the cache set by FETools::enable_embedding_matrix_cache()
+      // and FETools::disable_embedding_matrix_cache(). The variables are
+      // declared 'extern' here because we are in a .h file, but they are
+      // defined in fe_tools.cc. The lock protects the directory and the
+      // in-memory caches below.
+      extern std::atomic<bool> cache_enabled;
+      extern std::string       cache_directory;
+      extern std::mutex        cache_lock;
+
+      // The in-memory cache, mapping the key of a set of matrices to the
+      // matrices, one map for each number type
+      template <typename number>
+      std::map<std::string, std::vector<FullMatrix<number>>> &
+      get_memory_cache()
+      {
+        static std::map<std::string, std::vector<FullMatrix<number>>> cache;
+        return cache;
+      }
+
+
+
+      // Compute a checksum of the given points, used to distinguish finite
+      // elements with the same name but different (generalized) support
+      // points
+      template <int dim>
+      std::uint64_t
+      checksum(const std::vector<Point<dim>> &points)
+      {
+        // 64-bit FNV-1a hash of the bytes of the coordinates
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (const Point<dim> &point : points)
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              const double         coordinate = point[d];
+              const unsigned char *bytes =
+                reinterpret_cast<const unsigned char *>(&coordinate);
+              for (unsigned int b = 0; b < sizeof(double); ++b)
+                {
+                  hash ^= bytes[b];
+                  hash *= 1099511628211ULL;
+                }
+            }
+        return hash;
+      }
+
+
+
+      // Return the key identifying the matrices of kind @p kind computed for
+      // the finite element @p fe with the additional parameters @p parameters,
+      // or an empty string if the cache is disabled
+      template <typename number, int dim, int spacedim>
+      std::string
+      get_key(const FiniteElement<dim, spacedim> &fe,
+              const std::string                  &kind,
+              const std::string                  &parameters)
+      {
+        if (cache_enabled == false)
+          return "";
+
+        std::ostringstream key;
+        key << kind << ';' << fe.get_name() << ';' << dim << ';' << spacedim
+            << ';' << sizeof(number) << ';' << fe.n_dofs_per_cell() << ';'
+            << parameters << ';' << std::hex
+            << (fe.has_support_points() ?
+                  checksum(fe.get_unit_support_points()) :
+                  0)
+            << ';'
+            << (fe.has_generalized_support_points() ?
+                  checksum(fe.get_generalized_support_points()) :
+                  0);
+        return key.str();
+      }
+
+
+
+      // Return the name of the file in the cache directory holding the
+      // matrices with the given key
+      inline std::string
+      get_file_name(const std::string &key)
+      {
+        std::ostringstream file_name;
+        file_name << cache_directory << "/fe_embedding_" << std::hex
+                  << std::hash<std::string>()(key) << ".bin";
+        return file_name.str();
+      }
+
+
+
+      // The header of a cache file, consisting of an identifier, the
+      // library version, and the key
+      inline std::string
+      get_file_header(const std::string &key)
+      {
+        return std::string("deal.II embedding matrix cache\n") +
+               DEAL_II_PACKAGE_VERSION + '\n' + key + '\n';
+      }
+
+
+
+      // Load the matrices with the given key from the cache into the
+      // matrices pointed to by @p matrices. Return whether the matrices were
+      // found in the cache and had the sizes of the given matrices.
+      template <typename number>
+      bool
+      load(const std::string                       &key,
+           const std::vector<FullMatrix<number> *> &matrices)
+      {
+        if (key.empty())
+          return false;
+
+        std::lock_guard<std::mutex> lock(cache_lock);
+
+        auto      &memory_cache = get_memory_cache<number>();
+        const auto entry        = memory_cache.find(key);
+        if (entry == memory_cache.end())
+          {
+            if (cache_directory.empty())
+              return false;
+
+            // try to read the matrices from the cache file, which holds
+            // the sizes and the entries of all matrices after the header
+            std::ifstream file(get_file_name(key), std::ios::binary);
+            if (!file)
+              return false;
+
+            const std::string expected_header = get_file_header(key);
+            std::string       header(expected_header.size(), '\0');
+            file.read(header.data(), header.size());
+            if (!file || header != expected_header)
+              return false;
+
+            std::uint64_t n_matrices = 0;
+            file.read(reinterpret_cast<char *>(&n_matrices),
+                      sizeof(n_matrices));
+            if (!file || n_matrices != matrices.size())
+              return false;
+
+            std::vector<FullMatrix<number>> loaded(n_matrices);
+            for (FullMatrix<number> &matrix : loaded)
+              {
+                std::uint64_t size[2] = {0, 0};
+                file.read(reinterpret_cast<char *>(size), sizeof(size));
+                if (!file)
+                  return false;
+                matrix.reinit(size[0], size[1]);
+                if (matrix.m() > 0 && matrix.n() > 0)
+                  file.read(reinterpret_cast<char *>(&matrix(0, 0)),
+                            matrix.m() * matrix.n() * sizeof(number));
+                if (!file)
+                  return false;
+              }
+
+            memory_cache[key] = std::move(loaded);
+          }
+
+        const std::vector<FullMatrix<number>> &cached = memory_cache[key];
+        if (cached.size() != matrices.size())
+          return false;
+        for (unsigned int i = 0; i < matrices.size(); ++i)
+          if (cached[i].m() != matrices[i]->m() ||
+              cached[i].n() != matrices[i]->n())
+            return false;
+
+        for (unsigned int i = 0; i < matrices.size(); ++i)
+          *matrices[i] = cached[i];
+        return true;
+      }
+
+
+
+      // Store the given matrices in the cache under the given key, and
+      // write them to the cache file if a cache directory has been set
+      template <typename number>
+      void
+      store(const std::string                       &key,
+            const std::vector<FullMatrix<number> *> &matrices)
+      {
+        if (key.empty())
+          return;
+
+        std::lock_guard<std::mutex> lock(cache_lock);
+
+        std::vector<FullMatrix<number>> &cached =
+          get_memory_cache<number>()[key];
+        cached.resize(matrices.size());
+        for (unsigned int i = 0; i < matrices.size(); ++i)
+          cached[i] = *matrices[i];
+
+        if (cache_directory.empty())
+          return;
+
+        // Many processes might try to write the same file at the same
+        // time. Write to a file with a unique name first and then rename
+        // it, which replaces the target atomically on POSIX file systems,
+        // such that other processes never read an incomplete file. Errors
+        // are ignored since the cache file is only an optimization.
+        const std::string file_name = get_file_name(key);
+        std::ostringstream temporary_name;
+        temporary_name
+          << file_name << ".tmp." << std::hex
+          << std::hash<std::thread::id>()(std::this_thread::get_id()) << '.'
+          << std::chrono::steady_clock::now().time_since_epoch().count();
+        {
+          std::ofstream file(temporary_name.str(), std::ios::binary);
+          if (!file)
+            return;
+
+          const std::string header = get_file_header(key);
+          file.write(header.data(), header.size());
+
+          const std::uint64_t n_matrices = cached.size();
+          file.write(reinterpret_cast<const char *>(&n_matrices),
+                     sizeof(n_matrices));
+          for (const FullMatrix<number> &matrix : cached)
+            {
+              const std::uint64_t size[2] = {matrix.m(), matrix.n()};
+              file.write(reinterpret_cast<const char *>(size), sizeof(size));
+              if (matrix.m() > 0 && matrix.n() > 0)
+                file.write(reinterpret_cast<const char *>(&matrix(0, 0)),
+                           matrix.m() * matrix.n() * sizeof(number));
+            }
+          if (!file)
+            {
+              file.close();
+              std::remove(temporary_name.str().c_str());
+              return;
+            }
+        }
+        if (std::rename(temporary_name.str().c_str(), file_name.c_str()) != 0)
+          std::remove(temporary_name.str().c_str());
+      }
+    } // namespace FEToolsEmbeddingMatrixCache
   }   // namespace internal
 
 
@@ -1672,6 +1916,28 @@ namespace FETools
                            RefinementCase<dim>::cut_x;
         ref_case_end   = RefinementCase<dim>::isotropic_refinement;
       }
+
+    // look up the matrices of the given refinement cases in the cache, if
+    // enabled
+    std::vector<FullMatrix<number> *> cached_matrices;
+    std::ostringstream                parameters;
+    parameters << ref_case_start << ',' << ref_case_end << ',' << std::hexfloat
+               << threshold;
+    const std::string cache_key =
+      internal::FEToolsEmbeddingMatrixCache::get_key<number>(fe,
+                                                             "embedding",
+                                                             parameters.str());
+    if (cache_key.empty() == false)
+      {
+        for (unsigned int ref_case = ref_case_start; ref_case <= ref_case_end;
+             ++ref_case)
+          for (FullMatrix<number> &matrix : matrices[ref_case - 1])
+            cached_matrices.push_back(&matrix);
+        if (internal::FEToolsEmbeddingMatrixCache::load(cache_key,
+                                                        cached_matrices))
+          return;
+      }
+
     for (unsigned int ref_case = ref_case_start; ref_case <= ref_case_end;
          ++ref_case)
       {
@@ -1806,6 +2072,8 @@ namespace FETools
                   this_matrix(i, j) = 0.;
           }
       }
+
+    internal::FEToolsEmbeddingMatrixCache::store(cache_key, cached_matrices);
   }
 
 
@@ -1837,6 +2105,24 @@ namespace FETools
         Assert(matrices[i].m() == n, ExcDimensionMismatch(matrices[i].m(), n));
       }
 
+    // look up the matrices in the cache, if enabled
+    std::ostringstream parameters;
+    parameters << face_coarse << ',' << face_fine << ',' << std::hexfloat
+               << threshold;
+    const std::string cache_key =
+      internal::FEToolsEmbeddingMatrixCache::get_key<number>(fe,
+                                                             "face_embedding",
+                                                             parameters.str());
+    std::vector<FullMatrix<number> *> cached_matrices;
+    if (cache_key.empty() == false)
+      {
+        for (unsigned int i = 0; i < nc; ++i)
+          cached_matrices.push_back(&matrices[i]);
+        if (internal::FEToolsEmbeddingMatrixCache::load(cache_key,
+                                                        cached_matrices))
+          return;
+      }
+
     // In order to make the loops below
     // simpler, we introduce vectors
     // containing for indices 0-n the
@@ -2025,6 +2311,8 @@ namespace FETools
             if (std::fabs(this_matrix(i, j)) < 1e-12)
               this_matrix(i, j) = 0.;
       }
+
+    internal::FEToolsEmbeddingMatrixCache::store(cache_key, cached_matrices);
   }
 
 
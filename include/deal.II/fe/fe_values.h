@@ -107,6 +107,20 @@ public:
            const hp::QCollection<dim>         &quadrature,
            const UpdateFlags                   update_flags);
 
+  /**
+   * Copy constructor. The new object uses the same mapping, finite element,
+   * quadrature, and update flags as @p other, but is not yet initialized for
+   * any cell. If the finite element supports it (see
+   * FiniteElement::InternalDataBase::clone()), the values and derivatives of
+   * the shape functions on the reference cell that were precomputed for
+   * @p other are shared with the new object instead of being computed again;
+   * only the data that changes from cell to cell is duplicated. This makes
+   * copies, such as the ones WorkStream::run() creates of scratch objects for
+   * every thread, considerably cheaper to create and to store.
+   */
+  FEValues(const FEValues<dim, spacedim> &other);
+
+
   /**
    * Reinitialize the gradients, Jacobi determinants, etc for the given cell
    * of type "iterator into a DoFHandler object", and the finite element
@@ -141,6 +155,33 @@ public:
   const Quadrature<dim> &
   get_quadrature() const;
 
+  /**
+   * Keep the mapping and shape function data of up to @p n_entries cells
+   * that are not translations of each other, and reuse them on all later
+   * cells that are a translation of one of the stored cells. By default,
+   * i.e., for @p n_entries equal to zero, only the data of the previous cell
+   * is reused if the present cell is a translation of it, see
+   * CellSimilarity. With the cache, meshes that consist of a few cell shapes
+   * that are not visited in sequence, such as Cartesian meshes with
+   * different mesh sizes in several blocks, can skip most of the work in
+   * reinit() on almost all cells, regardless of the order of the cells.
+   *
+   * A cell is compared with the stored cells via the vertex positions
+   * relative to its first vertex with the same tolerance as
+   * TriaAccessor::is_translation_of(). Once the cache is full, the entry
+   * stored first is replaced. The cache is only used if checking for cell
+   * similarity is allowed, see always_allow_check_for_cell_similarity(), and
+   * it is switched off automatically if the mapping does not support the
+   * reuse of data for translated cells, e.g. for MappingQ with a polynomial
+   * degree larger than one.
+   *
+   * @note Each entry stores copies of all data computed on a cell, so the
+   * size of the cache should be of the order of the number of different cell
+   * shapes in the mesh.
+   */
+  void
+  set_cell_similarity_cache_size(const unsigned int n_entries);
+
   /**
    * Determine an estimate for the memory consumption (in bytes) of this
    * object.
@@ -166,16 +207,93 @@ public:
   get_present_fe_values() const;
 
 private:
+  /**
+   * The data of a cell stored by the cache described in
+   * set_cell_similarity_cache_size().
+   */
+  struct SimilarityCacheEntry
+  {
+    /**
+     * The first vertex of the cell.
+     */
+    Point<spacedim> vertex_0;
+
+    /**
+     * The positions of all other vertices relative to the first vertex.
+     */
+    std::vector<Tensor<1, spacedim>> vertex_offsets;
+
+    /**
+     * The direction flag of the cell, see
+     * TriaAccessor::direction_flag().
+     */
+    bool direction_flag;
+
+    /**
+     * The output of the mapping on the cell.
+     */
+    internal::FEValuesImplementation::MappingRelatedData<dim, spacedim>
+      mapping_output;
+
+    /**
+     * The output of the finite element on the cell.
+     */
+    internal::FEValuesImplementation::FiniteElementRelatedData<dim, spacedim>
+      finite_element_output;
+  };
+
   /**
    * Store a copy of the quadrature formula here.
    */
   const Quadrature<dim> quadrature;
 
   /**
-   * Do work common to the two constructors.
+   * The maximal number of entries of #similarity_cache.
+   */
+  unsigned int similarity_cache_size;
+
+  /**
+   * The cells whose data can be reused, see
+   * set_cell_similarity_cache_size().
+   */
+  std::vector<SimilarityCacheEntry> similarity_cache;
+
+  /**
+   * The entry of #similarity_cache to be replaced next once the cache is
+   * full.
+   */
+  unsigned int next_similarity_cache_entry;
+
+  /**
+   * Whether the internal data of the mapping describes a different cell
+   * than the present one, because the data of the present cell has been
+   * taken from #similarity_cache. In that case, the mapping can not be
+   * relied upon to compute the quadrature points of a translated cell.
+   */
+  bool mapping_data_is_stale;
+
+  /**
+   * Do work common to the constructors. If @p other is given, the finite
+   * element data is shared with this object if possible, see
+   * FEValuesBase::share_fe_data_with().
    */
   void
-  initialize(const UpdateFlags update_flags);
+  initialize(const UpdateFlags                  update_flags,
+             const FEValuesBase<dim, spacedim> *other = nullptr);
+
+  /**
+   * Return the index of the entry of #similarity_cache the present cell is a
+   * translation of, or numbers::invalid_unsigned_int if there is no such
+   * entry.
+   */
+  unsigned int
+  find_similar_cached_cell() const;
+
+  /**
+   * Store the data of the present cell in #similarity_cache.
+   */
+  void
+  store_in_similarity_cache();
 
   /**
    * The reinit() functions do only that part of the work that requires
@@ -374,6 +492,19 @@ public:
                const hp::QCollection<dim - 1>     &quadrature,
                const UpdateFlags                   update_flags);
 
+  /**
+   * Copy constructor. The new object uses the same mapping, finite element,
+   * quadrature, and update flags as @p other, but is not yet initialized for
+   * any cell. If the finite element supports it (see
+   * FiniteElement::InternalDataBase::clone()), the values and derivatives of
+   * the shape functions on the reference cell that were precomputed for
+   * @p other are shared with the new object instead of being computed again;
+   * only the data that changes from cell to cell is duplicated. This makes
+   * copies, such as the ones WorkStream::run() creates of scratch objects for
+   * every thread, considerably cheaper to create and to store.
+   */
+  FEFaceValues(const FEFaceValues<dim, spacedim> &other);
+
   /**
    * Reinitialize the gradients, Jacobi determinants, etc for the face with
    * number @p face_no of @p cell and the given finite element.
@@ -451,10 +582,13 @@ public:
 
 private:
   /**
-   * Do work common to the two constructors.
+   * Do work common to the constructors. If @p other is given, the finite
+   * element data is shared with this object if possible, see
+   * FEValuesBase::share_fe_data_with().
    */
   void
-  initialize(const UpdateFlags update_flags);
+  initialize(const UpdateFlags                  update_flags,
+             const FEValuesBase<dim, spacedim> *other = nullptr);
 
   /**
    * The reinit() functions do only that part of the work that requires
@@ -542,6 +676,20 @@ public:
                   const hp::QCollection<dim - 1>     &face_quadrature,
                   const UpdateFlags                   update_flags);
 
+  /**
+   * Copy constructor. The new object uses the same mapping, finite element,
+   * quadrature, and update flags as @p other, but is not yet initialized for
+   * any cell. If the finite element supports it (see
+   * FiniteElement::InternalDataBase::clone()), the values and derivatives of
+   * the shape functions on the reference cell that were precomputed for
+   * @p other are shared with the new object instead of being computed again;
+   * only the data that changes from cell to cell is duplicated. This makes
+   * copies, such as the ones WorkStream::run() creates of scratch objects for
+   * every thread, considerably cheaper to create and to store.
+   */
+  FESubfaceValues(const FESubfaceValues<dim, spacedim> &other);
+
+
   /**
    * Reinitialize the gradients, Jacobi determinants, etc for the given cell
    * of type "iterator into a DoFHandler object", and the finite element
@@ -641,10 +789,13 @@ public:
 
 private:
   /**
-   * Do work common to the two constructors.
+   * Do work common to the constructors. If @p other is given, the finite
+   * element data is shared with this object if possible, see
+   * FEValuesBase::share_fe_data_with().
    */
   void
-  initialize(const UpdateFlags update_flags);
+  initialize(const UpdateFlags                  update_flags,
+             const FEValuesBase<dim, spacedim> *other = nullptr);
 
   /**
    * The reinit() functions do only that part of the work that requires
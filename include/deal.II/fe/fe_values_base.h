@@ -1758,6 +1758,18 @@ protected:
   UpdateFlags
   compute_update_flags(const UpdateFlags update_flags) const;
 
+  /**
+   * Set up #fe_data and #finite_element_output as copies of the ones of
+   * @p other, which must use the same finite element, mapping, quadrature
+   * and update flags as the current object. The data the finite element has
+   * precomputed for @p other is shared rather than duplicated, see
+   * FiniteElement::InternalDataBase::clone(). Return whether the finite
+   * element supports this; if not, the current object is left unchanged.
+   * Called from the copy constructors of derived classes.
+   */
+  bool
+  share_fe_data_with(const FEValuesBase<dim, spacedim> &other);
+
   /**
    * An enum variable that can store different states of the current cell in
    * comparison to the previously visited cell. If wanted, additional states
@@ -1774,16 +1786,16 @@ protected:
   check_cell_similarity(
     const typename Triangulation<dim, spacedim>::cell_iterator &cell);
 
-private:
   /**
-   * A cache for all possible FEValuesViews objects.
+   * Whether checking for cell similarity is allowed.
    */
-  dealii::internal::FEValuesViews::Cache<dim, spacedim> fe_values_views_cache;
+  bool check_for_cell_similarity_allowed;
 
+private:
   /**
-   * Whether checking for cell similarity is allowed.
+   * A cache for all possible FEValuesViews objects.
    */
-  bool check_for_cell_similarity_allowed;
+  dealii::internal::FEValuesViews::Cache<dim, spacedim> fe_values_views_cache;
 
   // Make the view classes friends of this class, since they access internal
   // data.
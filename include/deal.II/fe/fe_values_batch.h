@@ -0,0 +1,626 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_fe_values_batch_h
+#define dealii_fe_values_batch_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/std_cxx20/iota_view.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe.h>
+#include <deal.II/fe/fe_update_flags.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <array>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+// Forward declaration
+#ifndef DOXYGEN
+template <int dim, typename Number, typename VectorizedArrayType>
+class MatrixFree;
+#endif
+
+/**
+ * A class that evaluates shape functions and geometry on a batch of cells at
+ * once and returns the results in interleaved form, with one cell per lane
+ * of a VectorizedArray. This allows matrix-based assembly loops to use the
+ * SIMD width of the processor for the work at the quadrature points, such
+ * as the evaluation of nonlinear material laws and the computation of the
+ * entries of the local matrices, in the same way as FEEvaluation does for
+ * matrix-free operator evaluation.
+ *
+ * The batch of cells is either given explicitly to reinit() or taken from a
+ * cell batch of a MatrixFree object. The values on the individual cells are
+ * computed by a single FEValues object and transposed to the interleaved
+ * layout, so the geometry related work is the same as for FEValues. The
+ * local matrices and right hand sides are assembled in interleaved form as
+ * well and distributed into the global objects lane by lane with
+ * distribute_local_to_global(). A typical assembly loop reads
+ * @code
+ * FEValuesBatch<dim> fe_batch(mapping, fe, quadrature,
+ *                             update_gradients | update_JxW_values);
+ * Table<2, VectorizedArray<double>> cell_matrix(fe.n_dofs_per_cell(),
+ *                                               fe.n_dofs_per_cell());
+ *
+ * for (unsigned int batch = 0; batch < matrix_free.n_cell_batches(); ++batch)
+ *   {
+ *     fe_batch.reinit(matrix_free, batch);
+ *     cell_matrix.fill(VectorizedArray<double>());
+ *     for (const unsigned int q : fe_batch.quadrature_point_indices())
+ *       for (unsigned int i = 0; i < fe_batch.dofs_per_cell; ++i)
+ *         for (unsigned int j = 0; j < fe_batch.dofs_per_cell; ++j)
+ *           cell_matrix(i, j) += fe_batch.shape_grad(i, q) *
+ *                                fe_batch.shape_grad(j, q) *
+ *                                fe_batch.JxW(q);
+ *     fe_batch.distribute_local_to_global(cell_matrix,
+ *                                         constraints,
+ *                                         system_matrix);
+ *   }
+ * @endcode
+ *
+ * If fewer cells than lanes are given, the unused lanes are filled with the
+ * data of the first cell, such that all operations on the interleaved data
+ * are well-defined, and they are skipped when reading from and writing into
+ * global vectors and matrices.
+ *
+ * The shape functions are accessed by shape_value() and shape_grad() like
+ * for FEValues, so each shape function needs to be primitive, see
+ * FiniteElement::is_primitive(). For vector-valued elements composed of
+ * primitive elements, such as FESystem objects of FE_Q elements, the vector
+ * component of shape function @p i is given by
+ * FiniteElement::system_to_component_index().
+ *
+ * All cells of a batch need to use the finite element given to the
+ * constructor.
+ *
+ * @ingroup feaccess
+ */
+template <int dim, typename VectorizedArrayType = VectorizedArray<double>>
+class FEValuesBatch
+{
+public:
+  /**
+   * The scalar number type of the interleaved data.
+   */
+  using Number = typename VectorizedArrayType::value_type;
+
+  /**
+   * The type of the cells of a batch.
+   */
+  using cell_iterator = typename DoFHandler<dim>::cell_iterator;
+
+  /**
+   * The number of cells processed at once, i.e., the number of lanes of
+   * VectorizedArrayType.
+   */
+  static constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  /**
+   * Constructor. The arguments are the same as for FEValues.
+   */
+  FEValuesBatch(const Mapping<dim>       &mapping,
+                const FiniteElement<dim> &fe,
+                const Quadrature<dim>    &quadrature,
+                const UpdateFlags         update_flags);
+
+  /**
+   * Compute the data on the given cells, one cell per lane. The number of
+   * cells must be between one and #n_lanes.
+   */
+  void
+  reinit(const ArrayView<const cell_iterator> &cells);
+
+  /**
+   * Compute the data on the cells of the cell batch @p cell_batch_index of
+   * @p matrix_free, as described by MatrixFree::get_cell_iterator() for the
+   * DoFHandler with index @p dof_handler_index.
+   */
+  void
+  reinit(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+         const unsigned int                                  cell_batch_index,
+         const unsigned int dof_handler_index = 0);
+
+  /**
+   * Return the number of lanes filled with actual cells in the last call to
+   * reinit().
+   */
+  unsigned int
+  n_active_lanes() const;
+
+  /**
+   * Return the cell of the given lane.
+   */
+  const cell_iterator &
+  get_cell(const unsigned int lane) const;
+
+  /**
+   * Return the global indices of the degrees of freedom of the cell of the
+   * given lane.
+   */
+  const std::vector<types::global_dof_index> &
+  get_dof_indices(const unsigned int lane) const;
+
+  /**
+   * Return the value of shape function @p i at quadrature point @p q on all
+   * cells of the batch.
+   */
+  const VectorizedArrayType &
+  shape_value(const unsigned int i, const unsigned int q) const;
+
+  /**
+   * Return the gradient of shape function @p i at quadrature point @p q on
+   * all cells of the batch.
+   */
+  const Tensor<1, dim, VectorizedArrayType> &
+  shape_grad(const unsigned int i, const unsigned int q) const;
+
+  /**
+   * Return the mapped quadrature weight times the Jacobian determinant at
+   * quadrature point @p q on all cells of the batch.
+   */
+  const VectorizedArrayType &
+  JxW(const unsigned int q) const;
+
+  /**
+   * Return the location of quadrature point @p q on all cells of the batch.
+   */
+  const Point<dim, VectorizedArrayType> &
+  quadrature_point(const unsigned int q) const;
+
+  /**
+   * Return an object that can be thought of as an array containing all
+   * indices from zero to #n_quadrature_points.
+   */
+  std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+  quadrature_point_indices() const;
+
+  /**
+   * Read the values of the degrees of freedom of all cells of the batch from
+   * the global vector @p global into @p local, which needs to have
+   * #dofs_per_cell entries.
+   */
+  template <typename VectorType>
+  void
+  get_dof_values(const VectorType                     &global,
+                 const ArrayView<VectorizedArrayType> &local) const;
+
+  /**
+   * Distribute the interleaved local matrix @p cell_matrix of size
+   * #dofs_per_cell times #dofs_per_cell into the global matrix @p matrix,
+   * lane by lane, using AffineConstraints::distribute_local_to_global().
+   */
+  template <typename MatrixType>
+  void
+  distribute_local_to_global(const Table<2, VectorizedArrayType> &cell_matrix,
+                             const AffineConstraints<Number>     &constraints,
+                             MatrixType                          &matrix) const;
+
+  /**
+   * Distribute the interleaved local matrix @p cell_matrix and the
+   * interleaved local right hand side @p cell_rhs into the global matrix
+   * @p matrix and the global vector @p rhs, lane by lane, using
+   * AffineConstraints::distribute_local_to_global().
+   */
+  template <typename MatrixType, typename VectorType>
+  void
+  distribute_local_to_global(
+    const Table<2, VectorizedArrayType>        &cell_matrix,
+    const ArrayView<const VectorizedArrayType> &cell_rhs,
+    const AffineConstraints<Number>            &constraints,
+    MatrixType                                 &matrix,
+    VectorType                                 &rhs) const;
+
+  /**
+   * Return an estimate of the memory consumption of this object in bytes.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * The number of degrees of freedom per cell.
+   */
+  const unsigned int dofs_per_cell;
+
+  /**
+   * The number of quadrature points per cell.
+   */
+  const unsigned int n_quadrature_points;
+
+private:
+  /**
+   * The flags given to the constructor.
+   */
+  const UpdateFlags update_flags;
+
+  /**
+   * The FEValues object computing the data on the individual cells.
+   */
+  FEValues<dim> fe_values;
+
+  /**
+   * The number of lanes filled in the last call to reinit().
+   */
+  unsigned int n_filled_lanes;
+
+  /**
+   * The cells of the batch.
+   */
+  std::array<cell_iterator, n_lanes> lane_cells;
+
+  /**
+   * The indices of the degrees of freedom of the cells of the batch.
+   */
+  std::array<std::vector<types::global_dof_index>, n_lanes> dof_indices;
+
+  /**
+   * The interleaved shape function values, with the quadrature point
+   * running fastest.
+   */
+  AlignedVector<VectorizedArrayType> shape_values;
+
+  /**
+   * The interleaved shape function gradients, with the quadrature point
+   * running fastest.
+   */
+  AlignedVector<Tensor<1, dim, VectorizedArrayType>> shape_gradients;
+
+  /**
+   * The interleaved JxW values.
+   */
+  AlignedVector<VectorizedArrayType> JxW_values;
+
+  /**
+   * The interleaved quadrature points.
+   */
+  AlignedVector<Point<dim, VectorizedArrayType>> quadrature_points;
+
+  /**
+   * The local matrix of a single lane passed to AffineConstraints.
+   */
+  mutable FullMatrix<Number> lane_matrix;
+
+  /**
+   * The local right hand side of a single lane passed to AffineConstraints.
+   */
+  mutable Vector<Number> lane_rhs;
+};
+
+
+
+#ifndef DOXYGEN
+
+template <int dim, typename VectorizedArrayType>
+FEValuesBatch<dim, VectorizedArrayType>::FEValuesBatch(
+  const Mapping<dim>       &mapping,
+  const FiniteElement<dim> &fe,
+  const Quadrature<dim>    &quadrature,
+  const UpdateFlags         update_flags)
+  : dofs_per_cell(fe.n_dofs_per_cell())
+  , n_quadrature_points(quadrature.size())
+  , update_flags(update_flags)
+  , fe_values(mapping, fe, quadrature, update_flags)
+  , n_filled_lanes(0)
+{
+  for (auto &indices : dof_indices)
+    indices.resize(dofs_per_cell);
+
+  if (update_flags & update_values)
+    shape_values.resize(dofs_per_cell * n_quadrature_points);
+  if (update_flags & update_gradients)
+    shape_gradients.resize(dofs_per_cell * n_quadrature_points);
+  if (update_flags & update_JxW_values)
+    JxW_values.resize(n_quadrature_points);
+  if (update_flags & update_quadrature_points)
+    quadrature_points.resize(n_quadrature_points);
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+void
+FEValuesBatch<dim, VectorizedArrayType>::reinit(
+  const ArrayView<const cell_iterator> &cells)
+{
+  Assert(cells.size() > 0 && cells.size() <= n_lanes,
+         ExcMessage("The number of cells must be between one and the "
+                    "number of lanes of VectorizedArrayType."));
+  n_filled_lanes = cells.size();
+
+  for (unsigned int v = 0; v < n_filled_lanes; ++v)
+    {
+      Assert(cells[v]->get_fe().n_dofs_per_cell() == dofs_per_cell,
+             ExcMessage("All cells must use the finite element given to "
+                        "the constructor."));
+      lane_cells[v] = cells[v];
+      cells[v]->get_dof_indices(dof_indices[v]);
+      fe_values.reinit(cells[v]);
+
+      if (update_flags & update_values)
+        for (unsigned int i = 0; i < dofs_per_cell; ++i)
+          for (const unsigned int q : fe_values.quadrature_point_indices())
+            shape_values[i * n_quadrature_points + q][v] =
+              fe_values.shape_value(i, q);
+
+      if (update_flags & update_gradients)
+        for (unsigned int i = 0; i < dofs_per_cell; ++i)
+          for (const unsigned int q : fe_values.quadrature_point_indices())
+            {
+              const Tensor<1, dim> &grad = fe_values.shape_grad(i, q);
+              for (unsigned int d = 0; d < dim; ++d)
+                shape_gradients[i * n_quadrature_points + q][d][v] = grad[d];
+            }
+
+      if (update_flags & update_JxW_values)
+        for (const unsigned int q : fe_values.quadrature_point_indices())
+          JxW_values[q][v] = fe_values.JxW(q);
+
+      if (update_flags & update_quadrature_points)
+        for (const unsigned int q : fe_values.quadrature_point_indices())
+          for (unsigned int d = 0; d < dim; ++d)
+            quadrature_points[q][d][v] = fe_values.quadrature_point(q)[d];
+    }
+
+  // fill the unused lanes with the data of the first cell
+  for (unsigned int v = n_filled_lanes; v < n_lanes; ++v)
+    {
+      lane_cells[v] = cells[0];
+      for (auto &value : shape_values)
+        value[v] = value[0];
+      for (auto &gradient : shape_gradients)
+        for (unsigned int d = 0; d < dim; ++d)
+          gradient[d][v] = gradient[d][0];
+      for (auto &value : JxW_values)
+        value[v] = value[0];
+      for (auto &point : quadrature_points)
+        for (unsigned int d = 0; d < dim; ++d)
+          point[d][v] = point[d][0];
+    }
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+void
+FEValuesBatch<dim, VectorizedArrayType>::reinit(
+  const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+  const unsigned int                                  cell_batch_index,
+  const unsigned int                                  dof_handler_index)
+{
+  const unsigned int n_cells =
+    matrix_free.n_active_entries_per_cell_batch(cell_batch_index);
+
+  std::array<cell_iterator, n_lanes> batch_cells;
+  for (unsigned int v = 0; v < n_cells; ++v)
+    batch_cells[v] =
+      matrix_free.get_cell_iterator(cell_batch_index, v, dof_handler_index);
+
+  reinit(make_array_view(batch_cells.cbegin(), batch_cells.cbegin() + n_cells));
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+inline unsigned int
+FEValuesBatch<dim, VectorizedArrayType>::n_active_lanes() const
+{
+  return n_filled_lanes;
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+inline const typename FEValuesBatch<dim, VectorizedArrayType>::cell_iterator &
+FEValuesBatch<dim, VectorizedArrayType>::get_cell(
+  const unsigned int lane) const
+{
+  AssertIndexRange(lane, n_filled_lanes);
+  return lane_cells[lane];
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+inline const std::vector<types::global_dof_index> &
+FEValuesBatch<dim, VectorizedArrayType>::get_dof_indices(
+  const unsigned int lane) const
+{
+  AssertIndexRange(lane, n_filled_lanes);
+  return dof_indices[lane];
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+inline const VectorizedArrayType &
+FEValuesBatch<dim, VectorizedArrayType>::shape_value(
+  const unsigned int i,
+  const unsigned int q) const
+{
+  Assert(update_flags & update_values,
+         FEValuesBase<dim>::ExcAccessToUninitializedField("update_values"));
+  AssertIndexRange(i, dofs_per_cell);
+  AssertIndexRange(q, n_quadrature_points);
+  return shape_values[i * n_quadrature_points + q];
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+inline const Tensor<1, dim, VectorizedArrayType> &
+FEValuesBatch<dim, VectorizedArrayType>::shape_grad(
+  const unsigned int i,
+  const unsigned int q) const
+{
+  Assert(update_flags & update_gradients,
+         FEValuesBase<dim>::ExcAccessToUninitializedField("update_gradients"));
+  AssertIndexRange(i, dofs_per_cell);
+  AssertIndexRange(q, n_quadrature_points);
+  return shape_gradients[i * n_quadrature_points + q];
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+inline const VectorizedArrayType &
+FEValuesBatch<dim, VectorizedArrayType>::JxW(const unsigned int q) const
+{
+  Assert(update_flags & update_JxW_values,
+         FEValuesBase<dim>::ExcAccessToUninitializedField("update_JxW_values"));
+  AssertIndexRange(q, n_quadrature_points);
+  return JxW_values[q];
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+inline const Point<dim, VectorizedArrayType> &
+FEValuesBatch<dim, VectorizedArrayType>::quadrature_point(
+  const unsigned int q) const
+{
+  Assert(update_flags & update_quadrature_points,
+         FEValuesBase<dim>::ExcAccessToUninitializedField(
+           "update_quadrature_points"));
+  AssertIndexRange(q, n_quadrature_points);
+  return quadrature_points[q];
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+inline std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+FEValuesBatch<dim, VectorizedArrayType>::quadrature_point_indices() const
+{
+  return {0U, n_quadrature_points};
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+template <typename VectorType>
+void
+FEValuesBatch<dim, VectorizedArrayType>::get_dof_values(
+  const VectorType                     &global,
+  const ArrayView<VectorizedArrayType> &local) const
+{
+  AssertDimension(local.size(), dofs_per_cell);
+  Assert(n_filled_lanes > 0, ExcNotInitialized());
+
+  for (unsigned int i = 0; i < dofs_per_cell; ++i)
+    {
+      for (unsigned int v = 0; v < n_filled_lanes; ++v)
+        local[i][v] = global(dof_indices[v][i]);
+      for (unsigned int v = n_filled_lanes; v < n_lanes; ++v)
+        local[i][v] = local[i][0];
+    }
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+template <typename MatrixType>
+void
+FEValuesBatch<dim, VectorizedArrayType>::distribute_local_to_global(
+  const Table<2, VectorizedArrayType> &cell_matrix,
+  const AffineConstraints<Number>     &constraints,
+  MatrixType                          &matrix) const
+{
+  AssertDimension(cell_matrix.size(0), dofs_per_cell);
+  AssertDimension(cell_matrix.size(1), dofs_per_cell);
+
+  lane_matrix.reinit(dofs_per_cell, dofs_per_cell);
+  for (unsigned int v = 0; v < n_filled_lanes; ++v)
+    {
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        for (unsigned int j = 0; j < dofs_per_cell; ++j)
+          lane_matrix(i, j) = cell_matrix(i, j)[v];
+      constraints.distribute_local_to_global(lane_matrix,
+                                             dof_indices[v],
+                                             matrix);
+    }
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+template <typename MatrixType, typename VectorType>
+void
+FEValuesBatch<dim, VectorizedArrayType>::distribute_local_to_global(
+  const Table<2, VectorizedArrayType>        &cell_matrix,
+  const ArrayView<const VectorizedArrayType> &cell_rhs,
+  const AffineConstraints<Number>            &constraints,
+  MatrixType                                 &matrix,
+  VectorType                                 &rhs) const
+{
+  AssertDimension(cell_matrix.size(0), dofs_per_cell);
+  AssertDimension(cell_matrix.size(1), dofs_per_cell);
+  AssertDimension(cell_rhs.size(), dofs_per_cell);
+
+  lane_matrix.reinit(dofs_per_cell, dofs_per_cell);
+  lane_rhs.reinit(dofs_per_cell);
+  for (unsigned int v = 0; v < n_filled_lanes; ++v)
+    {
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        {
+          for (unsigned int j = 0; j < dofs_per_cell; ++j)
+            lane_matrix(i, j) = cell_matrix(i, j)[v];
+          lane_rhs(i) = cell_rhs[i][v];
+        }
+      constraints.distribute_local_to_global(
+        lane_matrix, lane_rhs, dof_indices[v], matrix, rhs);
+    }
+}
+
+
+
+template <int dim, typename VectorizedArrayType>
+std::size_t
+FEValuesBatch<dim, VectorizedArrayType>::memory_consumption() const
+{
+  std::size_t memory = sizeof(*this) + fe_values.memory_consumption() +
+                       shape_values.memory_consumption() +
+                       shape_gradients.memory_consumption() +
+                       JxW_values.memory_consumption() +
+                       quadrature_points.memory_consumption() +
+                       lane_matrix.memory_consumption() +
+                       lane_rhs.memory_consumption();
+  for (const auto &indices : dof_indices)
+    memory += MemoryConsumption::memory_consumption(indices);
+  return memory;
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -1341,6 +1341,32 @@ public:
   void
   write_vtu(const Triangulation<dim, spacedim> &tria, std::ostream &out) const;
 
+  /**
+   * Write the locally owned active cells of a (possibly distributed)
+   * triangulation into a single VTU file @p filename that is shared by all
+   * processes of the communicator @p comm. The function is collective, and
+   * the output is written with MPI-IO through
+   * DataOutInterface::write_vtu_in_parallel(), i.e., every process only
+   * writes its own part of the file and no process ever holds the entire
+   * mesh. This makes the function suitable also for very large meshes for
+   * which writing one file per process via write_mesh_per_processor_as_vtu()
+   * or gathering the mesh on one process is not an option.
+   *
+   * The cell data written is the same as for write_vtu(). The flags set via
+   * GridOutFlags::Vtu are respected, with the exception of
+   * GridOutFlags::Vtu::serialize_triangulation, which is not supported for
+   * this function. Compact output is obtained by selecting a compression
+   * level in the flags, in which case the data is written in binary form.
+   *
+   * For triangulations that are not derived from
+   * parallel::TriangulationBase, all active cells are written.
+   */
+  template <int dim, int spacedim>
+  void
+  write_vtu_in_parallel(const Triangulation<dim, spacedim> &tria,
+                        const std::string                  &filename,
+                        const MPI_Comm                      comm) const;
+
   /**
    * Write triangulation in VTU format for each processor, and add a .pvtu file
    * for visualization in VisIt or Paraview that describes the collection of VTU
@@ -325,6 +325,14 @@ namespace GridTools
    * default value of this parameter is <code>false</code>.
    *
    * @note This function is not currently implemented for the 1d case.
+   *
+   * @note This function sets up and solves the linear systems from scratch
+   * on every call and only works on serial triangulations. For moving a
+   * mesh repeatedly, e.g., in every time step of an ALE method, and for
+   * distributed triangulations, the MeshMotionSolver class computes a
+   * displacement field for use with MappingQCache or MappingFEField with
+   * matrix-free operators and a multigrid preconditioner that are set up
+   * only once.
    */
   template <int dim>
   void
@@ -1222,6 +1230,41 @@ namespace GridTools
     const std::vector<bool> &marked_vertices = {},
     const double             tolerance       = 1.e-10);
 
+  /**
+   * Find the active non-artificial cells around each of the given @p points,
+   * i.e., the result is the same as calling the previous function for each
+   * point individually, but the search is performed for all points at once
+   * and in parallel on the available threads.
+   *
+   * The points are first assigned to a candidate cell whose bounding box,
+   * as stored in GridTools::Cache::get_cell_bounding_boxes_rtree(), contains
+   * the point. Then, the points are grouped by their candidate cells, and the
+   * reference coordinates of all points of a group are computed at once by
+   * Mapping::transform_points_real_to_unit_cell(), which for MappingQ
+   * processes several points with vectorized arithmetic. Only the points
+   * that do not lie within their candidate cell are passed to the previous
+   * function.
+   *
+   * The result is returned in two arrays with one entry per point, i.e.,
+   * the entry <tt>i</tt> of the first vector is the cell around
+   * <tt>points[i]</tt> and the entry <tt>i</tt> of the second vector the
+   * reference coordinates of the point within that cell. If no cell is found
+   * for a point, the cell is the invalid iterator returned by the previous
+   * function. If a point lies on the boundary between several cells, any of
+   * these cells may be returned.
+   *
+   * @note The mapping stored in the @p cache is called from several threads
+   * at the same time, so it must support concurrent calls of its
+   * transformation functions, as MappingQ and MappingQCache do.
+   */
+  template <int dim, int spacedim>
+  std::pair<
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>,
+    std::vector<Point<dim>>>
+  find_active_cells_around_points(const Cache<dim, spacedim>         &cache,
+                                  const std::vector<Point<spacedim>> &points,
+                                  const double tolerance = 1.e-10);
+
   /**
    * A version of the previous function that exploits an already existing
    * map between vertices and cells (constructed using the function
@@ -31,6 +31,10 @@
 
 #include <deal.II/numerics/rtree.h>
 
+#ifdef DEAL_II_WITH_ARBORX
+#  include <deal.II/arborx/bvh.h>
+#endif
+
 #include <boost/signals2.hpp>
 
 #include <atomic>
@@ -53,14 +57,21 @@ namespace GridTools
    *
    * Notice that this class only notices if the underlying Triangulation has
    * changed due to a Triangulation::Signals::any_change() signal being
-   * triggered.
+   * triggered. If the change is due to the
+   * Triangulation::Signals::mesh_movement() signal, i.e., the vertices have
+   * been moved but the cells and their connectivity are unchanged, only the
+   * objects that depend on the vertex locations are marked for update, see
+   * #update_vertex_locations.
    *
    * If the triangulation changes for other reasons, for example because you
    * use it in conjunction with a MappingQEulerian object that sees the
    * vertices through its own transformation, or because you manually change
    * some vertex locations, then some of the structures in this class become
    * obsolete, and you will have to mark them as outdated, by calling the
-   * method mark_for_update() manually.
+   * method mark_for_update() manually. If only the vertex locations have
+   * changed, calling <code>mark_for_update(update_vertex_locations)</code>
+   * keeps the objects that only depend on the topology of the
+   * triangulation.
    */
   template <int dim, int spacedim = dim>
   class Cache : public EnableObserverPointer
@@ -145,6 +156,38 @@ namespace GridTools
                 typename Triangulation<dim, spacedim>::active_cell_iterator>> &
     get_cell_bounding_boxes_rtree() const;
 
+    /**
+     * Return the bounding boxes and active cells the RTree returned by
+     * get_cell_bounding_boxes_rtree() has been built from, in the order of
+     * the active cells of the triangulation.
+     */
+    const std::vector<
+      std::pair<BoundingBox<spacedim>,
+                typename Triangulation<dim, spacedim>::active_cell_iterator>> &
+    get_cell_bounding_boxes() const;
+
+#ifdef DEAL_II_WITH_ARBORX
+    /**
+     * Return the cached ArborX bounding volume hierarchy of the cell bounding
+     * boxes, i.e., of the same boxes as stored in
+     * get_cell_bounding_boxes_rtree(). The indices returned by the query()
+     * function of the BVH refer to the entries of the vector returned by
+     * get_cell_bounding_boxes().
+     *
+     * In contrast to the RTree, the BVH is constructed in parallel by the
+     * Kokkos host execution space, and answers a whole batch of queries at
+     * once in parallel. It is therefore used by functions such as
+     * GridTools::compute_point_locations() and
+     * GridTools::find_active_cells_around_points() that search for many
+     * points at once.
+     *
+     * @note This function is only available if deal.II has been configured
+     * with ArborX.
+     */
+    ArborXWrappers::BVH &
+    get_cell_bounding_boxes_bvh() const;
+#endif
+
     /**
      * Return the cached RTree object of bounding boxes containing locally owned
      * active cells, constructed using the active cell iterators of the stored
@@ -222,6 +265,13 @@ namespace GridTools
     get_covering_rtree(const unsigned int level = 0) const;
 
   private:
+    /**
+     * Connect to the signals of the triangulation that indicate a change of
+     * the triangulation or a movement of its vertices.
+     */
+    void
+    connect_to_triangulation();
+
     /**
      * Keep track of what needs to be updated every time the triangulation
      * is changed. Each of the get_*() functions above checks whether a
@@ -238,6 +288,24 @@ namespace GridTools
      */
     mutable std::atomic<std::underlying_type_t<CacheUpdateFlags>> update_flags;
 
+    /**
+     * A counter that is incremented every time mark_for_update() is called
+     * with flags that indicate a possible change of the topology of the
+     * triangulation, i.e., flags not contained in #update_vertex_locations.
+     * The lists of cells underlying the RTree objects of the cell bounding
+     * boxes are only collected anew if this counter has changed since they
+     * were last set up.
+     */
+    std::atomic<unsigned int> topology_version;
+
+    /**
+     * Whether the Triangulation::Signals::mesh_movement() signal is currently
+     * being processed. Since that signal also triggers the
+     * Triangulation::Signals::any_change() signal, this flag allows to only
+     * mark the objects depending on the vertex locations in that case.
+     */
+    std::atomic<bool> mesh_movement_in_progress;
+
     /**
      * A pointer to the Triangulation.
      */
@@ -303,6 +371,26 @@ namespace GridTools
                        cell_bounding_boxes_rtree;
     mutable std::mutex cell_bounding_boxes_rtree_mutex;
 
+    /**
+     * The bounding boxes and cells the #cell_bounding_boxes_rtree has been
+     * built from, together with the value of #topology_version at the time
+     * the cells were collected.
+     */
+    mutable std::vector<
+      std::pair<BoundingBox<spacedim>,
+                typename Triangulation<dim, spacedim>::active_cell_iterator>>
+                         cell_bounding_boxes;
+    mutable unsigned int cell_bounding_boxes_topology_version;
+
+#ifdef DEAL_II_WITH_ARBORX
+    /**
+     * Store an ArborX bounding volume hierarchy of the
+     * #cell_bounding_boxes.
+     */
+    mutable std::unique_ptr<ArborXWrappers::BVH> cell_bounding_boxes_bvh;
+    mutable std::mutex                           cell_bounding_boxes_bvh_mutex;
+#endif
+
     /**
      * Store an RTree object, containing the bounding boxes of the locally owned
      * cells of the triangulation.
@@ -313,6 +401,18 @@ namespace GridTools
                        locally_owned_cell_bounding_boxes_rtree;
     mutable std::mutex locally_owned_cell_bounding_boxes_rtree_mutex;
 
+    /**
+     * The bounding boxes and cells the
+     * #locally_owned_cell_bounding_boxes_rtree has been built from, together
+     * with the value of #topology_version at the time the cells were
+     * collected.
+     */
+    mutable std::vector<
+      std::pair<BoundingBox<spacedim>,
+                typename Triangulation<dim, spacedim>::active_cell_iterator>>
+                         locally_owned_cell_bounding_boxes;
+    mutable unsigned int locally_owned_cell_bounding_boxes_topology_version;
+
     /**
      * Store an std::vector of std::set of integer containing the id of all
      * subdomain to which a vertex is connected to.
@@ -333,6 +433,11 @@ namespace GridTools
      */
     boost::signals2::connection tria_change_signal;
 
+    /**
+     * Storage for the status of the triangulation mesh movement signal.
+     */
+    boost::signals2::connection tria_mesh_movement_signal;
+
     /**
      * Storage for the status of the triangulation creation signal.
      */
@@ -89,6 +89,28 @@ namespace GridTools
      */
     update_vertex_with_ghost_neighbors = 0x200,
 
+    /**
+     * Update an ArborX bounding volume hierarchy of the cell bounding boxes.
+     */
+    update_cell_bounding_boxes_bvh = 0x400,
+
+    /**
+     * Update all objects that depend on the locations of the vertices, but
+     * not on the topology of the triangulation. This is the set of objects
+     * that needs to be updated after the vertices have been moved, e.g., by
+     * GridTools::transform() or when the mapping used by the Cache describes
+     * a moving mesh, while the cells and their connectivity stay the same.
+     * The objects depending on the topology only, such as the
+     * vertex_to_cell_map, are left untouched, and the RTree objects of the
+     * cell bounding boxes are rebuilt from the existing list of cells
+     * instead of collecting the cells anew.
+     */
+    update_vertex_locations =
+      0x002 | update_used_vertices | update_used_vertices_rtree |
+      update_cell_bounding_boxes_rtree | update_covering_rtree |
+      update_locally_owned_cell_bounding_boxes_rtree |
+      update_cell_bounding_boxes_bvh,
+
     /**
      * Update all objects.
      */
@@ -23,6 +23,11 @@
 
 #include <deal.II/grid/manifold.h>
 
+#include <array>
+#include <map>
+#include <shared_mutex>
+#include <utility>
+
 DEAL_II_NAMESPACE_OPEN
 
 // forward declaration
@@ -1179,6 +1184,27 @@ private:
             const Point<spacedim>                                      &p,
             const Point<dim> &initial_guess) const;
 
+  /**
+   * Look up the chart point of the point @p p on the coarse cell with index
+   * @p coarse_cell_index in #chart_point_cache. Return true and set @p
+   * chart_point if the point is found.
+   */
+  bool
+  find_cached_chart_point(const unsigned int     coarse_cell_index,
+                          const Point<spacedim> &p,
+                          Point<dim>            &chart_point) const;
+
+  /**
+   * Record the chart points of the points just computed by get_new_point()
+   * or get_new_points() on the coarse cell with index @p coarse_cell_index
+   * in #chart_point_cache.
+   */
+  void
+  cache_chart_points(
+    const unsigned int                      coarse_cell_index,
+    const ArrayView<const Point<spacedim>> &points,
+    const ArrayView<const Point<dim>>      &chart_points) const;
+
   /**
    * Push forward operation.
    *
@@ -1243,11 +1269,55 @@ private:
                 InverseQuadraticApproximation<dim, spacedim>>
     quadratic_approximation;
 
+  /**
+   * The type of the keys of #chart_point_cache, i.e., the index of a coarse
+   * cell and the coordinates of a point in real space.
+   */
+  using ChartPointCacheKey =
+    std::pair<unsigned int, std::array<double, spacedim>>;
+
+  /**
+   * A cache of the chart points of the points computed by get_new_point()
+   * and get_new_points(), for each of the coarse cells. New points are
+   * mostly computed from points that were themselves computed by this class,
+   * e.g., from the vertices created by the refinement of the parent cell, or
+   * from the points MappingQ places on the lines of a cell before it places
+   * points in the interior. For these points, the pull back, i.e., the
+   * expensive Newton iteration in compute_chart_points(), is replaced by a
+   * lookup of the exact chart point the point was computed from.
+   *
+   * To bound the memory consumption, the cache consists of two generations:
+   * Once the current generation holds #max_cached_chart_points entries, it
+   * replaces the previous one and a new generation is started. Both
+   * generations are cleared when the manifold is initialized and when the
+   * mesh is moved.
+   */
+  mutable std::array<std::map<ChartPointCacheKey, Point<dim>>, 2>
+    chart_point_cache;
+
+  /**
+   * The number of entries of a generation of #chart_point_cache.
+   */
+  static constexpr unsigned int max_cached_chart_points = 100000;
+
+  /**
+   * A mutex protecting #chart_point_cache, as the functions computing new
+   * points may be called concurrently, e.g., by MappingQ.
+   */
+  mutable std::shared_mutex chart_point_cache_mutex;
+
   /**
    * The connection to Triangulation::signals::clear that must be reset once
    * this class goes out of scope.
    */
   boost::signals2::connection clear_signal;
+
+  /**
+   * The connection to Triangulation::signals::mesh_movement, which
+   * invalidates #chart_point_cache, that must be reset once this class goes
+   * out of scope.
+   */
+  boost::signals2::connection mesh_movement_signal;
 };
 
 /*----------------------------- inline functions -----------------------------*/
@@ -4762,7 +4762,6 @@ void Triangulation<dim, spacedim>::load(Archive &ar, const unsigned int)
     for (const auto &level : levels)
       {
         level->active_cell_indices.resize(level->refine_flags.size());
-        level->global_active_cell_indices.resize(level->refine_flags.size());
         level->global_level_cell_indices.resize(level->refine_flags.size());
       }
     reset_cell_vertex_indices_cache();
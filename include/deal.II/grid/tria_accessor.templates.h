@@ -4021,8 +4021,14 @@ CellAccessor<dim, spacedim>::global_active_cell_index() const
          ExcMessage(
            "global_active_cell_index() can only be called on active cells!"));
 
-  return this->tria->levels[this->present_level]
-    ->global_active_cell_indices[this->present_index];
+  const std::vector<types::global_cell_index> &global_active_cell_indices =
+    this->tria->levels[this->present_level]->global_active_cell_indices;
+
+  // the indices are only stored if they differ from the active cell indices
+  if (global_active_cell_indices.empty())
+    return this->active_cell_index();
+
+  return global_active_cell_indices[this->present_index];
 }
 
 
@@ -708,6 +708,152 @@ namespace TriangulationDescription
       const TriangulationDescription::Settings setting =
         TriangulationDescription::Settings::default_setting);
 
+    /**
+     * Construct a Description for a parallel::fullydistributed::Triangulation
+     * from a coarse mesh that is distributed among the processes of
+     * @p comm in arbitrary pieces, without ever storing the whole mesh on a
+     * single process.
+     *
+     * The function is meant to be used with readers that only read a part of
+     * a mesh file on each process: Every process passes a contiguous range
+     * of the vertices of the mesh in @p vertices and a contiguous range of
+     * its cells in @p cells. The vertices and cells are numbered globally by
+     * concatenating the ranges in the order of the ranks, and the vertex
+     * indices stored in @p cells refer to this global numbering. Processes
+     * that do not read any part of the file pass empty vectors.
+     *
+     * The cells are then partitioned along a Hilbert space-filling curve
+     * through their centers, with approximately equal numbers of cells per
+     * process, and each process receives its locally owned cells together
+     * with the layer of ghost cells sharing a vertex with them. The global
+     * index of a cell is used as its
+     * @ref GlossCoarseCellId "coarse cell id".
+     * All steps only involve point-to-point communication and data
+     * proportional to the number of cells per process.
+     *
+     * @code
+     * // every process reads its share of the vertices and cells of the mesh
+     * std::vector<Point<dim>>      vertices = ...;
+     * std::vector<CellData<dim>>   cells    = ...;
+     *
+     * parallel::fullydistributed::Triangulation<dim> tria(comm);
+     * tria.create_triangulation(
+     *   TriangulationDescription::Utilities::
+     *     create_description_from_distributed_mesh(vertices, cells, comm));
+     * @endcode
+     *
+     * @note The vertices of the cells need to be ordered in a way that is
+     *   accepted by Triangulation::create_triangulation(), see
+     *   GridTools::consistently_order_cells() for meshes that do not satisfy
+     *   this requirement. The description does not contain boundary
+     *   indicators, which need to be set on the resulting triangulation.
+     */
+    template <int dim, int spacedim = dim>
+    Description<dim, spacedim>
+    create_description_from_distributed_mesh(
+      const std::vector<Point<spacedim>>       &vertices,
+      const std::vector<dealii::CellData<dim>> &cells,
+      const MPI_Comm                            comm,
+      const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing =
+        dealii::Triangulation<dim, spacedim>::none,
+      const TriangulationDescription::Settings settings =
+        TriangulationDescription::Settings::default_setting);
+
+    /**
+     * Construct the Description of the current process for a
+     * parallel::fullydistributed::Triangulation of the same mesh as the one
+     * generated by GridGenerator::subdivided_hyper_rectangle(), i.e., a
+     * rectangle or brick between the points @p p1 and @p p2 with
+     * @p repetitions[d] cells in coordinate direction <tt>d</tt>.
+     *
+     * In contrast to first generating the mesh with
+     * GridGenerator::subdivided_hyper_rectangle() and then calling
+     * create_description_from_triangulation(), the global mesh is never set
+     * up: The cells are partitioned along a Z-order (Morton) space-filling
+     * curve through the structured grid of cells with the same number of
+     * cells on each process (up to one), and each process computes its
+     * locally owned cells, the layer of ghost cells sharing a vertex with
+     * them, and their owners directly from the structure of the grid. This
+     * requires neither communication nor memory proportional to the global
+     * number of cells, so that meshes with more coarse cells than could be
+     * held by a single process can be set up. The position of a cell along
+     * the curve is used as its
+     * @ref GlossCoarseCellId "coarse cell id".
+     *
+     * @code
+     * parallel::fullydistributed::Triangulation<dim> tria(comm);
+     * tria.create_triangulation(
+     *   TriangulationDescription::Utilities::
+     *     create_description_from_subdivided_hyper_rectangle<dim>(
+     *       {10000, 10000, 10000}, Point<dim>(), Point<dim>(1, 1, 1), comm));
+     * @endcode
+     *
+     * The boundary indicators are set as in
+     * GridGenerator::subdivided_hyper_rectangle(), depending on @p colorize.
+     */
+    template <int dim>
+    Description<dim, dim>
+    create_description_from_subdivided_hyper_rectangle(
+      const std::vector<unsigned int> &repetitions,
+      const Point<dim>                &p1,
+      const Point<dim>                &p2,
+      const MPI_Comm                   comm,
+      const bool                       colorize = false,
+      const typename Triangulation<dim, dim>::MeshSmoothing smoothing =
+        dealii::Triangulation<dim, dim>::none,
+      const TriangulationDescription::Settings settings =
+        TriangulationDescription::Settings::default_setting);
+
+    /**
+     * Write @p description to the file @p filename in a binary format that
+     * can be read back by load_description(). In contrast to the
+     * serialization through Description::serialize(), the file stores the
+     * contents of the description as a small number of contiguous arrays, so
+     * that reading it does not involve parsing individual cells.
+     *
+     * A typical use is to compute the descriptions of a large mesh once, for
+     * example by create_description_from_triangulation() with a separate
+     * file for each rank, and to load these files at the start of every
+     * simulation:
+     * @code
+     * const std::string filename =
+     *   "mesh-" + Utilities::int_to_string(
+     *               Utilities::MPI::this_mpi_process(comm), 4) + ".bin";
+     *
+     * // preprocessing run
+     * TriangulationDescription::Utilities::save_description(
+     *   TriangulationDescription::Utilities::
+     *     create_description_from_triangulation(tria, partition),
+     *   filename);
+     *
+     * // simulation run
+     * parallel::fullydistributed::Triangulation<dim> tria_pft(comm);
+     * tria_pft.create_triangulation(
+     *   TriangulationDescription::Utilities::load_description<dim>(filename,
+     *                                                              comm));
+     * @endcode
+     *
+     * The file uses the byte order and the sizes of the integer types of the
+     * machine it was written on and is not meant to be portable between
+     * different platforms or configurations of deal.II. The communicator
+     * stored in @p description is not written.
+     */
+    template <int dim, int spacedim>
+    void
+    save_description(const Description<dim, spacedim> &description,
+                     const std::string                &filename);
+
+    /**
+     * Read a description written by save_description() from the file
+     * @p filename and set its communicator to @p comm. On systems that
+     * support it, the file is mapped into memory and the arrays of the
+     * description are copied directly from the mapped file.
+     */
+    template <int dim, int spacedim = dim>
+    Description<dim, spacedim>
+    load_description(const std::string &filename,
+                     const MPI_Comm     comm = MPI_COMM_SELF);
+
   } // namespace Utilities
 
 
@@ -111,6 +111,13 @@ namespace internal
 
       /**
        * Global cell index of each active cell.
+       *
+       * For triangulations whose global active cell indices coincide with the
+       * active cell indices, i.e., for triangulations that are not distributed
+       * among several processes, this field is empty and
+       * CellAccessor::global_active_cell_index() returns the active cell index
+       * instead. The field is only filled once a global active cell index
+       * different from the active cell index is set.
        */
       std::vector<types::global_cell_index> global_active_cell_indices;
 
@@ -357,6 +357,40 @@ namespace hp
     hp_quad_dof_identities(const std::set<unsigned int> &fes,
                            const unsigned int            face_no = 0) const;
 
+    /**
+     * Return the matrix interpolating from the face of the element with
+     * index @p fe_index_1 to the face of the element with index
+     * @p fe_index_2, as computed by
+     * FiniteElement::get_face_interpolation_matrix() called on the first
+     * element. The matrix has as many rows as the second element and as many
+     * columns as the first element has degrees of freedom on the face.
+     *
+     * Like the identities between degrees of freedom computed by
+     * hp_vertex_dof_identities(), hp_line_dof_identities() and
+     * hp_quad_dof_identities(), the matrix is computed on the first request
+     * only and then cached in this object, such that repeated setups of
+     * hanging node constraints, e.g., in every cycle of an adaptive
+     * computation, do not repeat this work. The cache is thread-safe and is
+     * shared between copies of this object as long as they contain the same
+     * elements.
+     */
+    const FullMatrix<double> &
+    get_face_interpolation_matrix(const unsigned int fe_index_1,
+                                  const unsigned int fe_index_2,
+                                  const unsigned int face_no = 0) const;
+
+    /**
+     * Same as get_face_interpolation_matrix(), but for the interpolation
+     * from the face of the element with index @p fe_index_1 to the subface
+     * @p subface of the element with index @p fe_index_2, as computed by
+     * FiniteElement::get_subface_interpolation_matrix().
+     */
+    const FullMatrix<double> &
+    get_subface_interpolation_matrix(const unsigned int fe_index_1,
+                                     const unsigned int fe_index_2,
+                                     const unsigned int subface,
+                                     const unsigned int face_no = 0) const;
+
 
     /**
      * Return the indices of finite elements in this FECollection that dominate
@@ -869,6 +903,21 @@ namespace hp
     std::function<unsigned int(const typename hp::FECollection<dim, spacedim> &,
                                const unsigned int)>
       hierarchy_prev;
+
+    /**
+     * Data computed for pairs or sets of elements of this collection, i.e.,
+     * the identities between degrees of freedom and the face and subface
+     * interpolation matrices, see get_face_interpolation_matrix(). The
+     * object is replaced by a new one whenever an element is added, so
+     * copies of this collection only share it while they contain the same
+     * elements.
+     */
+    struct InterfaceDataCache;
+
+    /**
+     * The cache of interface data, see InterfaceDataCache.
+     */
+    std::shared_ptr<InterfaceDataCache> interface_data_cache;
   };
 
 
@@ -790,173 +790,149 @@ AffineConstraints<number>::close()
 
 
 
-#ifdef DEBUG
-  // In debug mode we are computing an estimate for the maximum number
-  // of constraints so that we can bail out if there is a cycle in the
-  // constraints (which is easier than searching for cycles in the graph).
+  // replace references to dofs that are themselves constrained. for example
+  // if x3=x0/2+x2/2 and x2=x0/2+x1/2, then the new list will be
+  // x3=x0/2+x0/4+x1/4. note that x0 appears twice. we will throw this
+  // duplicate out in the following step, where we sort the list so that
+  // throwing out duplicates becomes much more efficient.
   //
-  // Let us figure out the largest dof index. This is an upper bound for the
-  // number of constraints because it is an approximation for the number of dofs
-  // in our system.
-  size_type largest_idx = 0;
-  for (const ConstraintLine &line : lines)
-    for (const std::pair<size_type, number> &entry : line.entries)
-      largest_idx = std::max(largest_idx, entry.first);
-#endif
+  // since the dofs a line refers to may themselves be constrained to third
+  // ones, we resolve the lines in a depth-first order: before a line is
+  // expanded, all the lines it refers to are fully resolved, i.e., only
+  // refer to unconstrained dofs. this way, every line is expanded exactly
+  // once in a single pass over all lines, rather than iterating over all
+  // lines until no chains of constraints are replaced any more. ignore
+  // elements that we don't store on the current processor.
+  {
+    const size_type lines_cache_size = lines_cache.size();
+    const auto      get_constraining_line = [&](const size_type dof) {
+      const size_type dof_index = calculate_line_index(dof);
+      return (dof_index < lines_cache_size) ? lines_cache[dof_index] :
+                                                   numbers::invalid_size_type;
+    };
 
-      // replace references to dofs that are themselves constrained. note that
-      // because we may replace references to other dofs that may themselves be
-      // constrained to third ones, we have to iterate over all this until we
-      // replace no chains of constraints any more
-      //
-      // the iteration replaces references to constrained degrees of freedom by
-      // second-order references. for example if x3=x0/2+x2/2 and x2=x0/2+x1/2,
-      // then the new list will be x3=x0/2+x0/4+x1/4. note that x0 appear
-      // twice. we will throw this duplicate out in the following step, where
-      // we sort the list so that throwing out duplicates becomes much more
-      // efficient. also, we have to do it only once, rather than in each
-      // iteration
-#ifdef DEBUG
-  size_type iteration = 0;
-#endif
-  bool              chained_constraint_replaced = false;
-  std::vector<bool> line_finalized(lines.size(), false);
-  do
+    enum class LineState : unsigned char
     {
-      chained_constraint_replaced = false;
-      for (unsigned int line_index = 0; line_index < lines.size(); ++line_index)
-        if (line_finalized[line_index] == false)
-          {
-            ConstraintLine &line = lines[line_index];
-
-#ifdef DEBUG
-            // we need to keep track of how many replacements we do in this
-            // line, because we can end up in a cycle A->B->C->A without the
-            // number of entries growing.
-            size_type n_replacements = 0;
-#endif
-
-            // loop over all entries of this line (including ones that we
-            // have appended in this go around) and see whether they are
-            // further constrained. ignore elements that we don't store on
-            // the current processor.
-            const unsigned int n_original_entries  = line.entries.size();
-            bool               has_sub_constraints = false;
-            const size_type    lines_cache_size    = lines_cache.size();
-            for (unsigned int entry = 0; entry < n_original_entries; ++entry)
-              {
-                const size_type dof_index =
-                  calculate_line_index(line.entries[entry].first);
+      unresolved,
+      in_progress,
+      resolved
+    };
+    std::vector<LineState> line_state(lines.size(), LineState::unresolved);
 
-                if (dof_index < lines_cache_size &&
-                    lines_cache[dof_index] != numbers::invalid_size_type)
-                  {
-                    // Now we found an index that is further constrained, so
-                    // we need to resolve the entries.  We may replace some of
-                    // them, and we may add some, but we only walk through the
-                    // original entries (and also don't touch the
-                    // replacements) even though in principle we could also do
-                    // the ones we have added or replaced. There is no harm in
-                    // doing so: we will simply treat those in the next round
-                    // around of the outer iteration.
-                    has_sub_constraints = true;
-
-                    const number weight = line.entries[entry].second;
-                    Assert(line.entries[entry].first != line.index,
-                           ExcMessage("Cycle in constraints detected!"));
-
-                    const ConstraintLine &constrained_line =
-                      lines[lines_cache[dof_index]];
-                    Assert(constrained_line.index == line.entries[entry].first,
-                           ExcInternalError());
-
-                    // now we have to replace an entry by its expansion. we do
-                    // that by overwriting the entry by the first entry of the
-                    // expansion and adding the remaining ones to the end,
-                    // where we will later process them once more
-                    //
-                    // we can of course only do that if the DoF that we are
-                    // currently handling is constrained by a linear combination
-                    // of other dofs:
-                    if (constrained_line.entries.size() > 0)
-                      {
-                        for (size_type i = 0;
-                             i < constrained_line.entries.size();
-                             ++i)
-                          Assert(line.entries[entry].first !=
-                                   constrained_line.entries[i].first,
-                                 ExcMessage("Cycle in constraints detected!"));
-
-                        // replace first entry, then tack the rest to the end
-                        // of the list
-                        line.entries[entry] = std::pair<size_type, number>(
-                          constrained_line.entries[0].first,
-                          constrained_line.entries[0].second * weight);
-
-                        for (size_type i = 1;
-                             i < constrained_line.entries.size();
-                             ++i)
-                          line.entries.emplace_back(
-                            constrained_line.entries[i].first,
-                            constrained_line.entries[i].second * weight);
+    // the stack of lines currently being resolved, together with the next
+    // entry of each line whose constraining line needs to be checked
+    std::vector<std::pair<size_type, size_type>> stack;
 
-#ifdef DEBUG
-                        // keep track of how many entries we replace in this
-                        // line. If we do more than there are constraints or
-                        // dofs in our system, we must have a cycle.
-                        ++n_replacements;
-                        Assert(n_replacements / 2 < largest_idx,
-                               ExcMessage("Cycle in constraints detected!"));
-#endif
-                      }
-                    else
-                      // the DoF that we encountered is not constrained by a
-                      // linear combination of other dofs but is equal to just
-                      // the inhomogeneity (i.e. its chain of entries is
-                      // empty). in that case, we can't just overwrite the
-                      // current entry, but we have to actually eliminate
-                      // it. we do not want to change the loop length above we
-                      // do so by setting the 'first' entry to
-                      // invalid_size_type here to finally remove entries in a
-                      // second loop
-                      {
-                        line.entries[entry].first = numbers::invalid_size_type;
-                      }
+    for (size_type first_line = 0; first_line < lines.size(); ++first_line)
+      if (line_state[first_line] == LineState::unresolved)
+        {
+          line_state[first_line] = LineState::in_progress;
+          stack.emplace_back(first_line, 0);
 
-                    line.inhomogeneity +=
-                      constrained_line.inhomogeneity * weight;
-                  }
-              }
+          while (stack.empty() == false)
+            {
+              const size_type line_position = stack.back().first;
+              ConstraintLine &line          = lines[line_position];
+
+              // first make sure all the lines this line refers to are
+              // resolved; if we find one that is not, resolve it first and
+              // come back to the current line later
+              bool found_unresolved_line = false;
+              for (size_type &entry = stack.back().second;
+                   entry < line.entries.size();
+                   ++entry)
+                {
+                  const size_type constraining_line =
+                    get_constraining_line(line.entries[entry].first);
+                  if (constraining_line == numbers::invalid_size_type)
+                    continue;
+
+                  Assert(line_state[constraining_line] !=
+                           LineState::in_progress,
+                         ExcMessage("Cycle in constraints detected!"));
+                  if (line_state[constraining_line] == LineState::unresolved)
+                    {
+                      ++entry;
+                      line_state[constraining_line] = LineState::in_progress;
+                      stack.emplace_back(constraining_line, 0);
+                      found_unresolved_line = true;
+                      break;
+                    }
+                }
+              if (found_unresolved_line)
+                continue;
 
-            // If none of the entries in the current line refer to DoFs that are
-            // themselves constrained, then we can move on:
-            if (has_sub_constraints == false)
-              line_finalized[line_index] = true;
-            else
-              {
-                chained_constraint_replaced = true;
+              // now we have to replace every entry referring to a
+              // constrained dof by its expansion. we do that by overwriting
+              // the entry by the first entry of the expansion and adding the
+              // remaining ones to the end. by construction, the added
+              // entries only refer to unconstrained dofs.
+              const size_type n_original_entries  = line.entries.size();
+              bool            has_sub_constraints = false;
+              for (size_type entry = 0; entry < n_original_entries; ++entry)
+                {
+                  const size_type constraining_line =
+                    get_constraining_line(line.entries[entry].first);
+                  if (constraining_line == numbers::invalid_size_type ||
+                      line_state[constraining_line] != LineState::resolved)
+                    continue;
+
+                  has_sub_constraints = true;
+
+                  const number          weight = line.entries[entry].second;
+                  const ConstraintLine &constrained_line =
+                    lines[constraining_line];
+                  Assert(constrained_line.index == line.entries[entry].first,
+                         ExcInternalError());
 
-                // Now delete the elements we have marked for deletion.
-                auto remaining_entries = line.entries.begin();
-                for (const auto &entry : line.entries)
-                  if (entry.first != numbers::invalid_size_type)
+                  // we can of course only do that if the DoF that we are
+                  // currently handling is constrained by a linear combination
+                  // of other dofs:
+                  if (constrained_line.entries.size() > 0)
                     {
-                      *remaining_entries = entry;
-                      ++remaining_entries;
+                      line.entries[entry] = std::pair<size_type, number>(
+                        constrained_line.entries[0].first,
+                        constrained_line.entries[0].second * weight);
+
+                      for (size_type i = 1; i < constrained_line.entries.size();
+                           ++i)
+                        line.entries.emplace_back(
+                          constrained_line.entries[i].first,
+                          constrained_line.entries[i].second * weight);
                     }
-                line.entries.erase(remaining_entries, line.entries.end());
-              }
-          }
+                  else
+                    // the DoF that we encountered is not constrained by a
+                    // linear combination of other dofs but is equal to just
+                    // the inhomogeneity (i.e. its chain of entries is
+                    // empty). in that case, we can't just overwrite the
+                    // current entry, but we have to actually eliminate
+                    // it. we do not want to change the loop length above we
+                    // do so by setting the 'first' entry to
+                    // invalid_size_type here to finally remove entries in a
+                    // second loop
+                    line.entries[entry].first = numbers::invalid_size_type;
+
+                  line.inhomogeneity += constrained_line.inhomogeneity * weight;
+                }
 
-#ifdef DEBUG
-      // increase iteration count. note that we should not iterate more
-      // times than there are constraints, since this puts a natural upper
-      // bound on the length of constraint chains
-      ++iteration;
-      Assert(iteration <= lines.size() + 1, ExcInternalError());
-#endif
-    }
-  while (chained_constraint_replaced == true);
+              // Now delete the elements we have marked for deletion.
+              if (has_sub_constraints)
+                {
+                  auto remaining_entries = line.entries.begin();
+                  for (const auto &entry : line.entries)
+                    if (entry.first != numbers::invalid_size_type)
+                      {
+                        *remaining_entries = entry;
+                        ++remaining_entries;
+                      }
+                  line.entries.erase(remaining_entries, line.entries.end());
+                }
+
+              line_state[line_position] = LineState::resolved;
+              stack.pop_back();
+            }
+        }
+  }
 
   // Finally sort the entries and re-scale them if necessary. in this step,
   // we also throw out duplicates as mentioned above. moreover, as some
@@ -0,0 +1,801 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_batched_full_matrix_h
+#define dealii_batched_full_matrix_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/exceptions.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/lapack_support.h>
+
+#include <cmath>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Matrix1
+ * @{
+ */
+
+/**
+ * A collection of many small dense matrices of the same size, e.g. the
+ * element matrices of a batch of cells, the inverses of the blocks of a
+ * block relaxation method, or the local systems of a static condensation,
+ * with the operations of FullMatrix and LAPACKFullMatrix done on all of
+ * them at once.
+ *
+ * The matrices are stored interleaved in VectorizedArray objects, i.e.,
+ * entry $(i,j)$ of the matrices with index $b \cdot w, \ldots, b \cdot w +
+ * w - 1$ with the width $w$ of the VectorizedArray type forms a single
+ * VectorizedArray object, and the entries of one such batch of matrices are
+ * stored contiguously in row-major order. All operations are then done with
+ * the SIMD instructions across the lanes of a batch, which makes them fast
+ * for the small sizes where calling BLAS and LAPACK for every single matrix
+ * as in FullMatrix and LAPACKFullMatrix is dominated by the call overhead
+ * and where a single matrix does not fill the vector registers.
+ *
+ * The LU factorization uses partial pivoting, where the pivot is selected
+ * for each lane separately, and the Cholesky factorization does not
+ * pivot. As in LAPACKFullMatrix, the factorizations and the inversion
+ * replace the content of the object, whose state is tracked. The lanes of
+ * the last batch beyond the number of matrices are initialized with the
+ * identity matrix, such that the factorizations do not divide by zero in
+ * these lanes.
+ *
+ * The vectors the matrices act on are given by arrays of VectorizedArray
+ * objects, with the same interleaving as the matrices.
+ */
+template <typename Number,
+          std::size_t width =
+            internal::VectorizedArrayWidthSpecifier<Number>::max_width>
+class BatchedFullMatrix
+{
+public:
+  /**
+   * The type of the entries of a batch of matrices.
+   */
+  using value_type = VectorizedArray<Number, width>;
+
+  /**
+   * The number of matrices stored in a single batch.
+   */
+  static constexpr unsigned int n_lanes = width;
+
+  /**
+   * Default constructor. Creates an empty object.
+   */
+  BatchedFullMatrix();
+
+  /**
+   * Constructor, see reinit().
+   */
+  BatchedFullMatrix(const unsigned int n_matrices,
+                    const unsigned int m,
+                    const unsigned int n);
+
+  /**
+   * Set the number of matrices and their size. All entries are set to zero,
+   * except for the diagonal of the unused lanes of the last batch. The state
+   * of the object is LAPACKSupport::matrix.
+   */
+  void
+  reinit(const unsigned int n_matrices,
+         const unsigned int m,
+         const unsigned int n);
+
+  /**
+   * Return the number of matrices.
+   */
+  unsigned int
+  n_matrices() const;
+
+  /**
+   * Return the number of batches of matrices, i.e., the number of matrices
+   * divided by the width of the VectorizedArray type, rounded up.
+   */
+  unsigned int
+  n_batches() const;
+
+  /**
+   * Return the number of rows of each matrix.
+   */
+  unsigned int
+  m() const;
+
+  /**
+   * Return the number of columns of each matrix.
+   */
+  unsigned int
+  n() const;
+
+  /**
+   * Return the state of the object, i.e., whether it contains the matrices,
+   * their factorizations, or their inverses.
+   */
+  LAPACKSupport::State
+  get_state() const;
+
+  /**
+   * Read-write access to entry $(i,j)$ of the matrices of batch @p batch.
+   */
+  value_type &
+  operator()(const unsigned int batch,
+             const unsigned int i,
+             const unsigned int j);
+
+  /**
+   * Read access to entry $(i,j)$ of the matrices of batch @p batch.
+   */
+  const value_type &
+  operator()(const unsigned int batch,
+             const unsigned int i,
+             const unsigned int j) const;
+
+  /**
+   * Copy the matrix @p matrix into the slot @p index.
+   */
+  template <typename Number2>
+  void
+  set_matrix(const unsigned int index, const FullMatrix<Number2> &matrix);
+
+  /**
+   * Copy the content of slot @p index into @p matrix, which is resized as
+   * needed. Depending on the state of the object, this is the matrix, its
+   * factorization, or its inverse.
+   */
+  template <typename Number2>
+  void
+  get_matrix(const unsigned int index, FullMatrix<Number2> &matrix) const;
+
+  /**
+   * Matrix-matrix multiplication $C = A B$ for all matrices, with $A$ being
+   * this object. If @p adding is true, the result is added to @p C instead.
+   */
+  void
+  mmult(BatchedFullMatrix       &C,
+        const BatchedFullMatrix &B,
+        const bool               adding = false) const;
+
+  /**
+   * Matrix-vector multiplication $dst = A src$ for the matrices of batch
+   * @p batch. If the object contains the inverses of the matrices, this
+   * applies the inverses. If @p adding is true, the result is added to
+   * @p dst instead.
+   */
+  void
+  vmult(const unsigned int                 batch,
+        const ArrayView<value_type>       &dst,
+        const ArrayView<const value_type> &src,
+        const bool                         adding = false) const;
+
+  /**
+   * Transpose matrix-vector multiplication $dst = A^T src$ for the matrices
+   * of batch @p batch, see vmult().
+   */
+  void
+  Tvmult(const unsigned int                 batch,
+         const ArrayView<value_type>       &dst,
+         const ArrayView<const value_type> &src,
+         const bool                         adding = false) const;
+
+  /**
+   * Compute the LU factorizations of all matrices with partial pivoting,
+   * where the pivots are chosen separately for each matrix.
+   */
+  void
+  compute_lu_factorization();
+
+  /**
+   * Compute the Cholesky factorizations of all matrices, which need to be
+   * symmetric positive definite. The lower triangular factors are stored,
+   * the upper triangles are set to zero.
+   */
+  void
+  compute_cholesky_factorization();
+
+  /**
+   * Invert all matrices, using an LU factorization with partial pivoting
+   * unless the object already holds the Cholesky or LU factorizations.
+   */
+  void
+  invert();
+
+  /**
+   * Solve the linear systems with the matrices of batch @p batch and the
+   * right hand side @p x in place, using the LU or Cholesky factorizations
+   * or the inverses computed before.
+   */
+  void
+  solve(const unsigned int batch, const ArrayView<value_type> &x) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Return a pointer to the entries of batch @p batch.
+   */
+  value_type *
+  begin_batch(const unsigned int batch);
+
+  /**
+   * Return a pointer to the entries of batch @p batch.
+   */
+  const value_type *
+  begin_batch(const unsigned int batch) const;
+
+  /**
+   * The number of matrices.
+   */
+  unsigned int n_mats;
+
+  /**
+   * The number of rows of each matrix.
+   */
+  unsigned int n_rows;
+
+  /**
+   * The number of columns of each matrix.
+   */
+  unsigned int n_cols;
+
+  /**
+   * The entries of the matrices, batch by batch in row-major order.
+   */
+  AlignedVector<value_type> data;
+
+  /**
+   * The row permutations of the LU factorizations in the format of
+   * LAPACK's getrf, i.e., row $k$ was swapped with row <tt>pivots[k]</tt>
+   * (stored as a floating point number, separately for each lane) in step
+   * $k$ of the factorization.
+   */
+  AlignedVector<value_type> pivots;
+
+  /**
+   * The state of the object.
+   */
+  LAPACKSupport::State state;
+};
+
+/** @} */
+
+/*----------------------- Inline functions ----------------------------*/
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace BatchedFullMatrixImplementation
+  {
+    // Swap the n entries of the rows row_k and row_i in those lanes where
+    // the pivot equals i, the index of row_i, and do nothing if no lane
+    // selected that row as pivot
+    template <typename Number, std::size_t width>
+    inline void
+    swap_rows_by_pivot(const VectorizedArray<Number, width> &pivot,
+                       const unsigned int                    i,
+                       VectorizedArray<Number, width>       *row_k,
+                       VectorizedArray<Number, width>       *row_i,
+                       const unsigned int                    n)
+    {
+      bool any_lane = false;
+      for (unsigned int v = 0; v < width; ++v)
+        if (pivot[v] == static_cast<Number>(i))
+          any_lane = true;
+      if (any_lane == false)
+        return;
+
+      const VectorizedArray<Number, width> index = static_cast<Number>(i);
+      for (unsigned int j = 0; j < n; ++j)
+        {
+          const VectorizedArray<Number, width> tmp = row_k[j];
+          row_k[j] = compare_and_apply_mask<SIMDComparison::equal>(
+            pivot, index, row_i[j], tmp);
+          row_i[j] = compare_and_apply_mask<SIMDComparison::equal>(
+            pivot, index, tmp, row_i[j]);
+        }
+    }
+  } // namespace BatchedFullMatrixImplementation
+} // namespace internal
+
+
+
+template <typename Number, std::size_t width>
+inline BatchedFullMatrix<Number, width>::BatchedFullMatrix()
+  : n_mats(0)
+  , n_rows(0)
+  , n_cols(0)
+  , state(LAPACKSupport::matrix)
+{}
+
+
+
+template <typename Number, std::size_t width>
+inline BatchedFullMatrix<Number, width>::BatchedFullMatrix(
+  const unsigned int n_matrices,
+  const unsigned int m,
+  const unsigned int n)
+  : BatchedFullMatrix()
+{
+  reinit(n_matrices, m, n);
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::reinit(const unsigned int n_matrices,
+                                         const unsigned int m,
+                                         const unsigned int n)
+{
+  n_mats = n_matrices;
+  n_rows = m;
+  n_cols = n;
+  state  = LAPACKSupport::matrix;
+  pivots.clear();
+
+  data.resize_fast(n_batches() * m * n);
+  data.fill(value_type());
+
+  // unused lanes of the last batch get the identity matrix
+  if (n_mats % width != 0)
+    {
+      value_type *last = begin_batch(n_batches() - 1);
+      for (unsigned int i = 0; i < std::min(m, n); ++i)
+        for (unsigned int v = n_mats % width; v < width; ++v)
+          last[i * n + i][v] = Number(1);
+    }
+}
+
+
+
+template <typename Number, std::size_t width>
+inline unsigned int
+BatchedFullMatrix<Number, width>::n_matrices() const
+{
+  return n_mats;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline unsigned int
+BatchedFullMatrix<Number, width>::n_batches() const
+{
+  return (n_mats + width - 1) / width;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline unsigned int
+BatchedFullMatrix<Number, width>::m() const
+{
+  return n_rows;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline unsigned int
+BatchedFullMatrix<Number, width>::n() const
+{
+  return n_cols;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline LAPACKSupport::State
+BatchedFullMatrix<Number, width>::get_state() const
+{
+  return state;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline typename BatchedFullMatrix<Number, width>::value_type *
+BatchedFullMatrix<Number, width>::begin_batch(const unsigned int batch)
+{
+  AssertIndexRange(batch, n_batches());
+  return data.data() + static_cast<std::size_t>(batch) * n_rows * n_cols;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline const typename BatchedFullMatrix<Number, width>::value_type *
+BatchedFullMatrix<Number, width>::begin_batch(const unsigned int batch) const
+{
+  AssertIndexRange(batch, n_batches());
+  return data.data() + static_cast<std::size_t>(batch) * n_rows * n_cols;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline typename BatchedFullMatrix<Number, width>::value_type &
+BatchedFullMatrix<Number, width>::operator()(const unsigned int batch,
+                                             const unsigned int i,
+                                             const unsigned int j)
+{
+  AssertIndexRange(i, n_rows);
+  AssertIndexRange(j, n_cols);
+  return begin_batch(batch)[i * n_cols + j];
+}
+
+
+
+template <typename Number, std::size_t width>
+inline const typename BatchedFullMatrix<Number, width>::value_type &
+BatchedFullMatrix<Number, width>::operator()(const unsigned int batch,
+                                             const unsigned int i,
+                                             const unsigned int j) const
+{
+  AssertIndexRange(i, n_rows);
+  AssertIndexRange(j, n_cols);
+  return begin_batch(batch)[i * n_cols + j];
+}
+
+
+
+template <typename Number, std::size_t width>
+template <typename Number2>
+inline void
+BatchedFullMatrix<Number, width>::set_matrix(const unsigned int         index,
+                                             const FullMatrix<Number2> &matrix)
+{
+  AssertIndexRange(index, n_mats);
+  AssertDimension(matrix.m(), n_rows);
+  AssertDimension(matrix.n(), n_cols);
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+
+  value_type        *batch = begin_batch(index / width);
+  const unsigned int lane  = index % width;
+  for (unsigned int i = 0; i < n_rows; ++i)
+    for (unsigned int j = 0; j < n_cols; ++j)
+      batch[i * n_cols + j][lane] = matrix(i, j);
+}
+
+
+
+template <typename Number, std::size_t width>
+template <typename Number2>
+inline void
+BatchedFullMatrix<Number, width>::get_matrix(const unsigned int   index,
+                                             FullMatrix<Number2> &matrix) const
+{
+  AssertIndexRange(index, n_mats);
+  matrix.reinit(n_rows, n_cols);
+
+  const value_type  *batch = begin_batch(index / width);
+  const unsigned int lane  = index % width;
+  for (unsigned int i = 0; i < n_rows; ++i)
+    for (unsigned int j = 0; j < n_cols; ++j)
+      matrix(i, j) = batch[i * n_cols + j][lane];
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::mmult(BatchedFullMatrix       &C,
+                                        const BatchedFullMatrix &B,
+                                        const bool               adding) const
+{
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+  Assert(B.state == LAPACKSupport::matrix, LAPACKSupport::ExcState(B.state));
+  AssertDimension(n_mats, B.n_mats);
+  AssertDimension(n_cols, B.n_rows);
+  Assert(&C != this && &C != &B,
+         ExcMessage("The result must not be one of the factors."));
+  if (adding)
+    {
+      AssertDimension(C.n_mats, n_mats);
+      AssertDimension(C.n_rows, n_rows);
+      AssertDimension(C.n_cols, B.n_cols);
+    }
+  else
+    C.reinit(n_mats, n_rows, B.n_cols);
+
+  const unsigned int n_cols_C = B.n_cols;
+  for (unsigned int batch = 0; batch < n_batches(); ++batch)
+    {
+      const value_type *a = begin_batch(batch);
+      const value_type *b = B.begin_batch(batch);
+      value_type       *c = C.begin_batch(batch);
+      for (unsigned int i = 0; i < n_rows; ++i)
+        {
+          value_type *c_row = c + i * n_cols_C;
+          if (adding == false)
+            for (unsigned int j = 0; j < n_cols_C; ++j)
+              c_row[j] = value_type();
+          for (unsigned int k = 0; k < n_cols; ++k)
+            {
+              const value_type  a_ik  = a[i * n_cols + k];
+              const value_type *b_row = b + k * n_cols_C;
+              for (unsigned int j = 0; j < n_cols_C; ++j)
+                c_row[j] += a_ik * b_row[j];
+            }
+        }
+    }
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::vmult(
+  const unsigned int                 batch,
+  const ArrayView<value_type>       &dst,
+  const ArrayView<const value_type> &src,
+  const bool                         adding) const
+{
+  Assert(state == LAPACKSupport::matrix ||
+           state == LAPACKSupport::inverse_matrix,
+         LAPACKSupport::ExcState(state));
+  AssertDimension(dst.size(), n_rows);
+  AssertDimension(src.size(), n_cols);
+
+  const value_type *a = begin_batch(batch);
+  for (unsigned int i = 0; i < n_rows; ++i)
+    {
+      value_type sum = adding ? dst[i] : value_type();
+      for (unsigned int j = 0; j < n_cols; ++j)
+        sum += a[i * n_cols + j] * src[j];
+      dst[i] = sum;
+    }
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::Tvmult(
+  const unsigned int                 batch,
+  const ArrayView<value_type>       &dst,
+  const ArrayView<const value_type> &src,
+  const bool                         adding) const
+{
+  Assert(state == LAPACKSupport::matrix ||
+           state == LAPACKSupport::inverse_matrix,
+         LAPACKSupport::ExcState(state));
+  AssertDimension(dst.size(), n_cols);
+  AssertDimension(src.size(), n_rows);
+
+  const value_type *a = begin_batch(batch);
+  if (adding == false)
+    for (unsigned int j = 0; j < n_cols; ++j)
+      dst[j] = value_type();
+  for (unsigned int i = 0; i < n_rows; ++i)
+    {
+      const value_type src_i = src[i];
+      for (unsigned int j = 0; j < n_cols; ++j)
+        dst[j] += a[i * n_cols + j] * src_i;
+    }
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::compute_lu_factorization()
+{
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+  Assert(n_rows == n_cols, LACExceptions::ExcNotQuadratic());
+
+  const unsigned int n = n_rows;
+  pivots.resize_fast(n_batches() * n);
+  for (unsigned int batch = 0; batch < n_batches(); ++batch)
+    {
+      value_type *a     = begin_batch(batch);
+      value_type *pivot = pivots.data() + batch * n;
+      for (unsigned int k = 0; k < n; ++k)
+        {
+          // select the row with the largest entry in column k for each lane
+          value_type max_value = std::abs(a[k * n + k]);
+          pivot[k]             = static_cast<Number>(k);
+          for (unsigned int i = k + 1; i < n; ++i)
+            {
+              const value_type value = std::abs(a[i * n + k]);
+              pivot[k] = compare_and_apply_mask<SIMDComparison::greater_than>(
+                value,
+                max_value,
+                value_type(static_cast<Number>(i)),
+                pivot[k]);
+              max_value = std::max(value, max_value);
+            }
+          for (unsigned int v = 0; v < width; ++v)
+            Assert(max_value[v] != Number(), LACExceptions::ExcSingular());
+
+          for (unsigned int i = k + 1; i < n; ++i)
+            internal::BatchedFullMatrixImplementation::swap_rows_by_pivot(
+              pivot[k], i, a + k * n, a + i * n, n);
+
+          const value_type inverse_diagonal = Number(1) / a[k * n + k];
+          for (unsigned int i = k + 1; i < n; ++i)
+            {
+              const value_type factor = a[i * n + k] * inverse_diagonal;
+              a[i * n + k]            = factor;
+              for (unsigned int j = k + 1; j < n; ++j)
+                a[i * n + j] -= factor * a[k * n + j];
+            }
+        }
+    }
+  state = LAPACKSupport::lu;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::compute_cholesky_factorization()
+{
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+  Assert(n_rows == n_cols, LACExceptions::ExcNotQuadratic());
+
+  const unsigned int n = n_rows;
+  for (unsigned int batch = 0; batch < n_batches(); ++batch)
+    {
+      value_type *a = begin_batch(batch);
+      for (unsigned int j = 0; j < n; ++j)
+        {
+          value_type diagonal = a[j * n + j];
+          for (unsigned int k = 0; k < j; ++k)
+            diagonal -= a[j * n + k] * a[j * n + k];
+          for (unsigned int v = 0; v < width; ++v)
+            Assert(diagonal[v] > Number(),
+                   ExcMessage("The matrix is not positive definite."));
+
+          a[j * n + j]                      = std::sqrt(diagonal);
+          const value_type inverse_diagonal = Number(1) / a[j * n + j];
+          for (unsigned int i = j + 1; i < n; ++i)
+            {
+              value_type sum = a[i * n + j];
+              for (unsigned int k = 0; k < j; ++k)
+                sum -= a[i * n + k] * a[j * n + k];
+              a[i * n + j] = sum * inverse_diagonal;
+              a[j * n + i] = value_type();
+            }
+        }
+    }
+  state = LAPACKSupport::cholesky;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::solve(const unsigned int           batch,
+                                        const ArrayView<value_type> &x) const
+{
+  AssertDimension(x.size(), n_rows);
+
+  const unsigned int n = n_rows;
+  const value_type  *a = begin_batch(batch);
+  if (state == LAPACKSupport::lu)
+    {
+      const value_type *pivot = pivots.data() + batch * n;
+      for (unsigned int k = 0; k < n; ++k)
+        for (unsigned int i = k + 1; i < n; ++i)
+          internal::BatchedFullMatrixImplementation::swap_rows_by_pivot(
+            pivot[k], i, &x[k], &x[i], 1);
+
+      for (unsigned int i = 1; i < n; ++i)
+        {
+          value_type sum = x[i];
+          for (unsigned int j = 0; j < i; ++j)
+            sum -= a[i * n + j] * x[j];
+          x[i] = sum;
+        }
+      for (unsigned int i = n; i > 0;)
+        {
+          --i;
+          value_type sum = x[i];
+          for (unsigned int j = i + 1; j < n; ++j)
+            sum -= a[i * n + j] * x[j];
+          x[i] = sum / a[i * n + i];
+        }
+    }
+  else if (state == LAPACKSupport::cholesky)
+    {
+      for (unsigned int i = 0; i < n; ++i)
+        {
+          value_type sum = x[i];
+          for (unsigned int j = 0; j < i; ++j)
+            sum -= a[i * n + j] * x[j];
+          x[i] = sum / a[i * n + i];
+        }
+      for (unsigned int i = n; i > 0;)
+        {
+          --i;
+          value_type sum = x[i];
+          for (unsigned int j = i + 1; j < n; ++j)
+            sum -= a[j * n + i] * x[j];
+          x[i] = sum / a[i * n + i];
+        }
+    }
+  else if (state == LAPACKSupport::inverse_matrix)
+    {
+      AlignedVector<value_type> src(n);
+      std::copy(x.begin(), x.end(), src.begin());
+      vmult(batch, x, ArrayView<const value_type>(src.data(), n));
+    }
+  else
+    Assert(false, LAPACKSupport::ExcState(state));
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::invert()
+{
+  Assert(n_rows == n_cols, LACExceptions::ExcNotQuadratic());
+  if (state == LAPACKSupport::matrix)
+    compute_lu_factorization();
+  Assert(state == LAPACKSupport::lu || state == LAPACKSupport::cholesky,
+         LAPACKSupport::ExcState(state));
+
+  // solve for the unit vectors, and store the columns of the inverses
+  const unsigned int        n = n_rows;
+  AlignedVector<value_type> inverse(n * n);
+  AlignedVector<value_type> column(n);
+  for (unsigned int batch = 0; batch < n_batches(); ++batch)
+    {
+      for (unsigned int j = 0; j < n; ++j)
+        {
+          column.fill(value_type());
+          column[j] = Number(1);
+          solve(batch, make_array_view(column));
+          for (unsigned int i = 0; i < n; ++i)
+            inverse[i * n + j] = column[i];
+        }
+      std::copy(inverse.begin(), inverse.end(), begin_batch(batch));
+    }
+
+  pivots.clear();
+  state = LAPACKSupport::inverse_matrix;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline std::size_t
+BatchedFullMatrix<Number, width>::memory_consumption() const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(data) +
+         MemoryConsumption::memory_consumption(pivots);
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
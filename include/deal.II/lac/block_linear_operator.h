@@ -18,9 +18,12 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/lac/linear_operator.h>
 
+#include <type_traits>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -39,6 +42,12 @@ namespace internal
 template <typename Number>
 class BlockVector;
 
+template <typename Number>
+class Vector;
+
+template <typename number>
+class SparseMatrix;
+
 template <typename Range  = BlockVector<double>,
           typename Domain = Range,
           typename BlockPayload =
@@ -66,7 +75,8 @@ block_operator(
                                              typename Domain::BlockType,
                                              typename BlockPayload::BlockType>,
                               n>,
-                   m> &);
+                   m> &,
+  const bool run_blocks_in_parallel = false);
 
 template <std::size_t m,
           typename Range  = BlockVector<double>,
@@ -78,7 +88,8 @@ block_diagonal_operator(
   const std::array<LinearOperator<typename Range::BlockType,
                                   typename Domain::BlockType,
                                   typename BlockPayload::BlockType>,
-                   m> &);
+                   m> &,
+  const bool run_blocks_in_parallel = false);
 
 template <std::size_t m,
           typename Range  = BlockVector<double>,
@@ -152,6 +163,20 @@ block_diagonal_operator(
  * <code>std::function</code> objects are no longer available) - the linear
  * operator interface, however, remains intact.
  *
+ * The products of the blocks of different block rows (or block columns for
+ * the transpose) are independent of each other and can be run in parallel
+ * tasks, with each task accumulating the products of its row into one block
+ * of the destination vector. This is done automatically for the operators
+ * created from a BlockSparseMatrix acting on BlockVector objects, whose
+ * blocks can safely be multiplied concurrently. For operators assembled
+ * from individual LinearOperator objects, it can be requested with the
+ * argument @p run_blocks_in_parallel of block_operator() and
+ * block_diagonal_operator(), e.g., for a block-diagonal preconditioner whose
+ * diagonal blocks are independent approximate inverses. This must only be
+ * done if the operators of different blocks can be applied at the same time,
+ * which is not the case if they share state (e.g., the same solver object
+ * in several inverse_operator() objects) or communicate via MPI.
+ *
  * @note This class makes heavy use of <code>std::function</code> objects and
  * lambda functions. This flexibility comes with a run-time penalty. Only use
  * this object to encapsulate object with medium to large individual block
@@ -351,12 +376,57 @@ namespace internal
         v = *tmp;
     }
 
+    // A type trait that is true if the blocks of the block matrix type are
+    // of type SparseMatrix and the blocks of the vector type are of type
+    // Vector, for which the products of different blocks can safely run
+    // concurrently
+    template <typename BlockMatrixType, typename Range, typename = void>
+    struct has_concurrent_blocks : std::false_type
+    {};
+
+    template <typename BlockMatrixType, typename Range>
+    struct has_concurrent_blocks<
+      BlockMatrixType,
+      Range,
+      std::enable_if_t<
+        std::is_same_v<
+          typename BlockMatrixType::BlockType,
+          SparseMatrix<typename BlockMatrixType::value_type>> &&
+        std::is_same_v<typename Range::BlockType,
+                       Vector<typename Range::value_type>>>> : std::true_type
+    {};
+
+    // Call the given function for all block indices from zero to n_blocks,
+    // in parallel tasks if requested
+    template <typename Function>
+    void
+    apply_to_blocks(const unsigned int n_blocks,
+                    const bool         run_blocks_in_parallel,
+                    const Function    &function)
+    {
+      if (run_blocks_in_parallel && n_blocks > 1)
+        parallel::apply_to_subranges(
+          0U,
+          n_blocks,
+          [&function](const unsigned int begin, const unsigned int end) {
+            for (unsigned int b = begin; b < end; ++b)
+              function(b);
+          },
+          1);
+      else
+        for (unsigned int b = 0; b < n_blocks; ++b)
+          function(b);
+    }
+
     // Populate the LinearOperator interfaces with the help of the
-    // BlockLinearOperator functions
+    // BlockLinearOperator functions. If run_blocks_in_parallel is set, the
+    // block rows (or block columns for the transpose) are processed in
+    // parallel tasks
     template <typename Range, typename Domain, typename BlockPayload>
     inline void
     populate_linear_operator_functions(
-      dealii::BlockLinearOperator<Range, Domain, BlockPayload> &op)
+      dealii::BlockLinearOperator<Range, Domain, BlockPayload> &op,
+      const bool run_blocks_in_parallel = false)
     {
       op.reinit_range_vector = [=](Range &v, bool omit_zeroing_entries) {
         const unsigned int m = op.n_block_rows();
@@ -384,7 +454,7 @@ namespace internal
         v.collect_sizes();
       };
 
-      op.vmult = [&op](Range &v, const Domain &u) {
+      op.vmult = [&op, run_blocks_in_parallel](Range &v, const Domain &u) {
         const unsigned int m = op.n_block_rows();
         const unsigned int n = op.n_block_cols();
         Assert(v.n_blocks() == m, ExcDimensionMismatch(v.n_blocks(), m));
@@ -409,17 +479,15 @@ namespace internal
             apply_with_intermediate_storage(first_op, loop_op, v, u, false);
           }
         else
-          {
-            for (unsigned int i = 0; i < m; ++i)
-              {
-                op.block(i, 0).vmult(v.block(i), u.block(0));
-                for (unsigned int j = 1; j < n; ++j)
-                  op.block(i, j).vmult_add(v.block(i), u.block(j));
-              }
-          }
+          apply_to_blocks(m, run_blocks_in_parallel, [&](const unsigned int i) {
+            op.block(i, 0).vmult(v.block(i), u.block(0));
+            for (unsigned int j = 1; j < n; ++j)
+              op.block(i, j).vmult_add(v.block(i), u.block(j));
+          });
       };
 
-      op.vmult_add = [&op](Range &v, const Domain &u) {
+      op.vmult_add = [&op, run_blocks_in_parallel](Range        &v,
+                                                   const Domain &u) {
         const unsigned int m = op.n_block_rows();
         const unsigned int n = op.n_block_cols();
         Assert(v.n_blocks() == m, ExcDimensionMismatch(v.n_blocks(), m));
@@ -444,14 +512,13 @@ namespace internal
             apply_with_intermediate_storage(first_op, loop_op, v, u, true);
           }
         else
-          {
-            for (unsigned int i = 0; i < m; ++i)
-              for (unsigned int j = 0; j < n; ++j)
-                op.block(i, j).vmult_add(v.block(i), u.block(j));
-          }
+          apply_to_blocks(m, run_blocks_in_parallel, [&](const unsigned int i) {
+            for (unsigned int j = 0; j < n; ++j)
+              op.block(i, j).vmult_add(v.block(i), u.block(j));
+          });
       };
 
-      op.Tvmult = [&op](Domain &v, const Range &u) {
+      op.Tvmult = [&op, run_blocks_in_parallel](Domain &v, const Range &u) {
         const unsigned int n = op.n_block_cols();
         const unsigned int m = op.n_block_rows();
         Assert(v.n_blocks() == n, ExcDimensionMismatch(v.n_blocks(), n));
@@ -476,17 +543,15 @@ namespace internal
             apply_with_intermediate_storage(first_op, loop_op, v, u, false);
           }
         else
-          {
-            for (unsigned int i = 0; i < n; ++i)
-              {
-                op.block(0, i).Tvmult(v.block(i), u.block(0));
-                for (unsigned int j = 1; j < m; ++j)
-                  op.block(j, i).Tvmult_add(v.block(i), u.block(j));
-              }
-          }
+          apply_to_blocks(n, run_blocks_in_parallel, [&](const unsigned int i) {
+            op.block(0, i).Tvmult(v.block(i), u.block(0));
+            for (unsigned int j = 1; j < m; ++j)
+              op.block(j, i).Tvmult_add(v.block(i), u.block(j));
+          });
       };
 
-      op.Tvmult_add = [&op](Domain &v, const Range &u) {
+      op.Tvmult_add = [&op, run_blocks_in_parallel](Domain      &v,
+                                                    const Range &u) {
         const unsigned int n = op.n_block_cols();
         const unsigned int m = op.n_block_rows();
         Assert(v.n_blocks() == n, ExcDimensionMismatch(v.n_blocks(), n));
@@ -511,11 +576,10 @@ namespace internal
             apply_with_intermediate_storage(first_op, loop_op, v, u, true);
           }
         else
-          {
-            for (unsigned int i = 0; i < n; ++i)
-              for (unsigned int j = 0; j < m; ++j)
-                op.block(j, i).Tvmult_add(v.block(i), u.block(j));
-          }
+          apply_to_blocks(n, run_blocks_in_parallel, [&](const unsigned int i) {
+            for (unsigned int j = 0; j < m; ++j)
+              op.block(j, i).Tvmult_add(v.block(i), u.block(j));
+          });
       };
     }
 
@@ -609,7 +673,10 @@ block_operator(const BlockMatrixType &block_matrix)
     return BlockType(block_matrix.block(i, j));
   };
 
-  populate_linear_operator_functions(return_op);
+  populate_linear_operator_functions(
+    return_op,
+    internal::BlockLinearOperatorImplementation::
+      has_concurrent_blocks<BlockMatrixType, Range>::value);
   return return_op;
 }
 
@@ -640,6 +707,10 @@ block_operator(const BlockMatrixType &block_matrix)
  * block_operator<2, 2, BlockVector<double>>({op_a00, op_a01, op_a10, op_a11});
  * @endcode
  *
+ * If @p run_blocks_in_parallel is set, the block rows are processed in
+ * parallel tasks, see the discussion in the BlockLinearOperator class. This
+ * must only be done if the operators in @p ops can be applied concurrently.
+ *
  * @ingroup LAOperators
  */
 template <std::size_t m,
@@ -653,7 +724,8 @@ block_operator(
                                              typename Domain::BlockType,
                                              typename BlockPayload::BlockType>,
                               n>,
-                   m> &ops)
+                   m>   &ops,
+  const bool run_blocks_in_parallel)
 {
   static_assert(m > 0 && n > 0,
                 "a blocked LinearOperator must consist of at least one block");
@@ -675,7 +747,7 @@ block_operator(
     return ops[i][j];
   };
 
-  populate_linear_operator_functions(return_op);
+  populate_linear_operator_functions(return_op, run_blocks_in_parallel);
   return return_op;
 }
 
@@ -733,7 +805,10 @@ block_diagonal_operator(const BlockMatrixType &block_matrix)
       return null_operator(BlockType(block_matrix.block(i, j)));
   };
 
-  populate_linear_operator_functions(return_op);
+  populate_linear_operator_functions(
+    return_op,
+    internal::BlockLinearOperatorImplementation::
+      has_concurrent_blocks<BlockMatrixType, Range>::value);
   return return_op;
 }
 
@@ -754,6 +829,10 @@ block_diagonal_operator(const BlockMatrixType &block_matrix)
  * block_diagonal_operator<m, BlockVector<double>>({op_00, op_a1, ..., op_am});
  * @endcode
  *
+ * If @p run_blocks_in_parallel is set, the diagonal blocks are applied in
+ * parallel tasks, see the discussion in the BlockLinearOperator class. This
+ * must only be done if the operators in @p ops can be applied concurrently.
+ *
  * @ingroup LAOperators
  */
 template <std::size_t m, typename Range, typename Domain, typename BlockPayload>
@@ -762,7 +841,8 @@ block_diagonal_operator(
   const std::array<LinearOperator<typename Range::BlockType,
                                   typename Domain::BlockType,
                                   typename BlockPayload::BlockType>,
-                   m> &ops)
+                   m>   &ops,
+  const bool run_blocks_in_parallel)
 {
   static_assert(
     m > 0, "a blockdiagonal LinearOperator must consist of at least one block");
@@ -791,7 +871,7 @@ block_diagonal_operator(
           new_ops[i][j].reinit_domain_vector = ops[j].reinit_domain_vector;
         }
 
-  return block_operator<m, m, Range, Domain>(new_ops);
+  return block_operator<m, m, Range, Domain>(new_ops, run_blocks_in_parallel);
 }
 
 
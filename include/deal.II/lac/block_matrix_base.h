@@ -21,6 +21,7 @@
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/mutex.h>
 #include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/table.h>
 #include <deal.II/base/utilities.h>
 
@@ -33,6 +34,7 @@
 
 #include <cmath>
 #include <mutex>
+#include <type_traits>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -41,6 +43,8 @@ DEAL_II_NAMESPACE_OPEN
 #ifndef DOXYGEN
 template <typename>
 class MatrixIterator;
+template <typename number>
+class SparseMatrix;
 #endif
 
 
@@ -336,6 +340,18 @@ namespace BlockMatrixIterators
  * PETScWrappers::SparseMatrix objects. If you attempt anyway, you will likely
  * get a number of compiler errors.
  *
+ * If the blocks are of type SparseMatrix and the vectors are of type
+ * BlockVector, the matrix-vector products vmult(), Tvmult(), vmult_add(),
+ * Tvmult_add() and residual() work on the blocks in parallel tasks, with
+ * one task per block row (or per block column for the transpose). Each task
+ * accumulates the products with the blocks of its row into the respective
+ * block of the destination vector, so no synchronization between the tasks
+ * is needed. This avoids running the many small, internally parallelized
+ * products of systems with many blocks one after the other. For all other
+ * types, the blocks are processed one after the other, because the products
+ * of, e.g., matrices distributed via MPI must be called in the same order
+ * on all processes.
+ *
  * @note Instantiations for this template are provided for <tt>@<float@> and
  * @<double@></tt>; others can be generated in application programs (see the
  * section on
@@ -1079,6 +1095,50 @@ private:
 /* ------------------------- Template functions ---------------------- */
 
 
+namespace internal
+{
+  namespace BlockMatrixBaseImplementation
+  {
+    /**
+     * Call @p function for each block index from zero to @p n_blocks. The
+     * calls run in parallel tasks if @p MatrixType is SparseMatrix and the
+     * blocks of @p BlockVectorType are of type Vector, whose products can
+     * safely run concurrently on different blocks, and one after the other
+     * otherwise.
+     */
+    template <typename MatrixType, typename BlockVectorType, typename Function>
+    void
+    apply_to_blocks(const unsigned int n_blocks, const Function &function)
+    {
+      if constexpr (std::is_same_v<
+                      MatrixType,
+                      SparseMatrix<typename MatrixType::value_type>> &&
+                    std::is_same_v<
+                      typename BlockVectorType::BlockType,
+                      Vector<typename BlockVectorType::value_type>>)
+        {
+          if (n_blocks > 1)
+            {
+              parallel::apply_to_subranges(
+                0U,
+                n_blocks,
+                [&function](const unsigned int begin, const unsigned int end) {
+                  for (unsigned int b = begin; b < end; ++b)
+                    function(b);
+                },
+                1);
+              return;
+            }
+        }
+
+      for (unsigned int b = 0; b < n_blocks; ++b)
+        function(b);
+    }
+  } // namespace BlockMatrixBaseImplementation
+} // namespace internal
+
+
+
 namespace BlockMatrixIterators
 {
   template <typename BlockMatrixType>
@@ -2218,12 +2278,13 @@ BlockMatrixBase<MatrixType>::vmult_block_block(BlockVectorType       &dst,
   Assert(src.n_blocks() == n_block_cols(),
          ExcDimensionMismatch(src.n_blocks(), n_block_cols()));
 
-  for (size_type row = 0; row < n_block_rows(); ++row)
-    {
-      block(row, 0).vmult(dst.block(row), src.block(0));
-      for (size_type col = 1; col < n_block_cols(); ++col)
-        block(row, col).vmult_add(dst.block(row), src.block(col));
-    };
+  internal::BlockMatrixBaseImplementation::
+    apply_to_blocks<MatrixType, BlockVectorType>(
+      n_block_rows(), [this, &dst, &src](const unsigned int row) {
+        block(row, 0).vmult(dst.block(row), src.block(0));
+        for (unsigned int col = 1; col < n_block_cols(); ++col)
+          block(row, col).vmult_add(dst.block(row), src.block(col));
+      });
 }
 
 
@@ -2288,9 +2349,12 @@ BlockMatrixBase<MatrixType>::vmult_add(BlockVectorType       &dst,
   Assert(src.n_blocks() == n_block_cols(),
          ExcDimensionMismatch(src.n_blocks(), n_block_cols()));
 
-  for (unsigned int row = 0; row < n_block_rows(); ++row)
-    for (unsigned int col = 0; col < n_block_cols(); ++col)
-      block(row, col).vmult_add(dst.block(row), src.block(col));
+  internal::BlockMatrixBaseImplementation::
+    apply_to_blocks<MatrixType, BlockVectorType>(
+      n_block_rows(), [this, &dst, &src](const unsigned int row) {
+        for (unsigned int col = 0; col < n_block_cols(); ++col)
+          block(row, col).vmult_add(dst.block(row), src.block(col));
+      });
 }
 
 
@@ -2307,13 +2371,15 @@ BlockMatrixBase<MatrixType>::Tvmult_block_block(
   Assert(src.n_blocks() == n_block_rows(),
          ExcDimensionMismatch(src.n_blocks(), n_block_rows()));
 
-  dst = 0.;
-
-  for (unsigned int row = 0; row < n_block_rows(); ++row)
-    {
-      for (unsigned int col = 0; col < n_block_cols(); ++col)
-        block(row, col).Tvmult_add(dst.block(col), src.block(row));
-    };
+  // run over the block columns, such that every task only writes into
+  // one block of the destination vector
+  internal::BlockMatrixBaseImplementation::
+    apply_to_blocks<MatrixType, BlockVectorType>(
+      n_block_cols(), [this, &dst, &src](const unsigned int col) {
+        dst.block(col) = 0.;
+        for (unsigned int row = 0; row < n_block_rows(); ++row)
+          block(row, col).Tvmult_add(dst.block(col), src.block(row));
+      });
 }
 
 
@@ -2381,9 +2447,12 @@ BlockMatrixBase<MatrixType>::Tvmult_add(BlockVectorType       &dst,
   Assert(src.n_blocks() == n_block_rows(),
          ExcDimensionMismatch(src.n_blocks(), n_block_rows()));
 
-  for (unsigned int row = 0; row < n_block_rows(); ++row)
-    for (unsigned int col = 0; col < n_block_cols(); ++col)
-      block(row, col).Tvmult_add(dst.block(col), src.block(row));
+  internal::BlockMatrixBaseImplementation::
+    apply_to_blocks<MatrixType, BlockVectorType>(
+      n_block_cols(), [this, &dst, &src](const unsigned int col) {
+        for (unsigned int row = 0; row < n_block_rows(); ++row)
+          block(row, col).Tvmult_add(dst.block(col), src.block(row));
+      });
 }
 
 
@@ -2481,19 +2550,20 @@ BlockMatrixBase<MatrixType>::residual(BlockVectorType       &dst,
   // perform a sign change of the
   // first two term before, and after
   // adding up
-  for (unsigned int row = 0; row < n_block_rows(); ++row)
-    {
-      block(row, 0).residual(dst.block(row), x.block(0), b.block(row));
+  internal::BlockMatrixBaseImplementation::
+    apply_to_blocks<MatrixType, BlockVectorType>(
+      n_block_rows(), [this, &dst, &x, &b](const unsigned int row) {
+        block(row, 0).residual(dst.block(row), x.block(0), b.block(row));
 
-      for (size_type i = 0; i < dst.block(row).size(); ++i)
-        dst.block(row)(i) = -dst.block(row)(i);
+        for (size_type i = 0; i < dst.block(row).size(); ++i)
+          dst.block(row)(i) = -dst.block(row)(i);
 
-      for (unsigned int col = 1; col < n_block_cols(); ++col)
-        block(row, col).vmult_add(dst.block(row), x.block(col));
+        for (unsigned int col = 1; col < n_block_cols(); ++col)
+          block(row, col).vmult_add(dst.block(row), x.block(col));
 
-      for (size_type i = 0; i < dst.block(row).size(); ++i)
-        dst.block(row)(i) = -dst.block(row)(i);
-    };
+        for (size_type i = 0; i < dst.block(row).size(); ++i)
+          dst.block(row)(i) = -dst.block(row)(i);
+      });
 
   value_type res = 0;
   for (size_type row = 0; row < n_block_rows(); ++row)
@@ -494,9 +494,15 @@ BlockSparseMatrix<number>::precondition_Jacobi(BlockVectorType       &dst,
          ExcDimensionMismatch(src.n_blocks(), this->n_block_cols()));
 
   // do a diagonal preconditioning. uses only
-  // the diagonal blocks of the matrix
-  for (size_type i = 0; i < this->n_block_rows(); ++i)
-    this->block(i, i).precondition_Jacobi(dst.block(i), src.block(i), omega);
+  // the diagonal blocks of the matrix, which are independent of each other
+  internal::BlockMatrixBaseImplementation::
+    apply_to_blocks<SparseMatrix<number>, BlockVectorType>(
+      this->n_block_rows(),
+      [this, &dst, &src, omega](const unsigned int i) {
+        this->block(i, i).precondition_Jacobi(dst.block(i),
+                                              src.block(i),
+                                              omega);
+      });
 }
 
 
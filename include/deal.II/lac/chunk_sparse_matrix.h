@@ -27,6 +27,7 @@
 
 #include <iterator>
 #include <memory>
+#include <vector>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -1132,6 +1133,17 @@ public:
            const Vector<somenumber> &b,
            const number              om = 1.) const;
 
+  /**
+   * Do one Jacobi step on <tt>v</tt>.  Performs a direct Jacobi step with
+   * right hand side <tt>b</tt>. This function will need an auxiliary vector,
+   * which is acquired from GrowingVectorMemory.
+   */
+  template <typename somenumber>
+  void
+  Jacobi_step(Vector<somenumber>       &v,
+              const Vector<somenumber> &b,
+              const number              om = 1.) const;
+
   /**
    * Do one adjoint SOR step on <tt>v</tt>.  Performs a direct TSOR step with
    * right hand side <tt>b</tt>.
@@ -1426,6 +1438,21 @@ private:
    */
   size_type max_len;
 
+  /**
+   * Partition of the chunk rows into ranges with a similar number of
+   * nonzero chunks, which are processed in parallel in vmult_add(). The
+   * chunk rows from <tt>row_partition[c]</tt> to <tt>row_partition[c+1]
+   * </tt> form the range @p c.
+   */
+  std::vector<size_type> row_partition;
+
+  /**
+   * Compute #row_partition for the current sparsity pattern, using the
+   * number of threads reported by MultithreadInfo::n_threads().
+   */
+  void
+  compute_row_partition();
+
   /**
    * Return the location of entry $(i,j)$ within the val array.
    */
@@ -19,11 +19,14 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/parallel.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/template_constraints.h>
 
 #include <deal.II/lac/chunk_sparse_matrix.h>
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/vector.h>
+#include <deal.II/lac/vector_memory.h>
 
 #include <algorithm>
 #include <cmath>
@@ -31,6 +34,7 @@
 #include <iomanip>
 #include <numeric>
 #include <ostream>
+#include <type_traits>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -38,10 +42,11 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace internal
 {
-  // TODO: the goal of the ChunkSparseMatrix class is to stream data and use
-  // the vectorization features of modern processors. to make this happen,
-  // we will have to vectorize the functions in the following namespace, either
-  // by hand or by using, for example, optimized BLAS versions for them.
+  // the goal of the ChunkSparseMatrix class is to stream data and use the
+  // vectorization features of modern processors. the matrix-vector product
+  // dispatches the common chunk sizes to the kernels with a compile-time
+  // chunk size below, which the compiler unrolls and vectorizes; the other
+  // functions in the following namespace still use generic loops.
   namespace ChunkSparseMatrixImplementation
   {
     /**
@@ -78,6 +83,37 @@ namespace internal
 
 
 
+    /**
+     * Same as the previous function for a chunk size known at compile time,
+     * adding to an array of @p chunk_size accumulators rather than to the
+     * destination vector. Since all loop bounds are compile-time constants,
+     * the compiler fully unrolls the loops and keeps the accumulators in
+     * registers across all chunks of a chunk row.
+     */
+    template <int chunk_size,
+              typename number,
+              typename SrcIterator,
+              typename ResultType>
+    DEAL_II_ALWAYS_INLINE inline void
+    chunk_vmult_add(const number *const matrix,
+                    const SrcIterator   src,
+                    ResultType         *result)
+    {
+      ResultType src_values[chunk_size];
+      for (int j = 0; j < chunk_size; ++j)
+        src_values[j] = src[j];
+
+      for (int i = 0; i < chunk_size; ++i)
+        {
+          ResultType sum = matrix[i * chunk_size] * src_values[0];
+          for (int j = 1; j < chunk_size; ++j)
+            sum += matrix[i * chunk_size + j] * src_values[j];
+          result[i] += sum;
+        }
+    }
+
+
+
     /**
      * Like the previous function, but subtract. We need this for computing
      * the residual.
@@ -164,6 +200,67 @@ namespace internal
 
 
 
+    /**
+     * Perform a vmult_add on the chunk rows from @p begin_row to @p end_row
+     * that are completely filled, i.e., do not have padding rows, for a
+     * chunk size known at compile time. Chunks in the chunk column
+     * @p irregular_col, which has padding columns, are treated separately.
+     * The pointers to the values and column numbers are advanced to the end
+     * of the rows that have been processed.
+     */
+    template <int chunk_size,
+              typename number,
+              typename InVector,
+              typename OutVector>
+    void
+    vmult_add_on_regular_rows(const unsigned int            begin_row,
+                              const unsigned int            end_row,
+                              const size_type               irregular_col,
+                              const size_type               n_filled_last_cols,
+                              const number                 *values,
+                              const std::size_t            *rowstart,
+                              const number                *&val_ptr,
+                              const size_type             *&colnum_ptr,
+                              const InVector               &src,
+                              typename OutVector::iterator &dst_ptr)
+    {
+      using value_type = typename OutVector::value_type;
+
+      const auto src_ptr = src.begin();
+      for (unsigned int chunk_row = begin_row; chunk_row < end_row;
+           ++chunk_row)
+        {
+          value_type result[chunk_size];
+          for (int r = 0; r < chunk_size; ++r)
+            result[r] = dst_ptr[r];
+
+          const number *const val_end_of_row =
+            &values[rowstart[chunk_row + 1] * chunk_size * chunk_size];
+          while (val_ptr != val_end_of_row)
+            {
+              if (*colnum_ptr != irregular_col)
+                chunk_vmult_add<chunk_size>(val_ptr,
+                                            src_ptr + *colnum_ptr * chunk_size,
+                                            result);
+              else
+                // we're at a chunk column that has padding
+                for (int r = 0; r < chunk_size; ++r)
+                  for (size_type c = 0; c < n_filled_last_cols; ++c)
+                    result[r] += (val_ptr[r * chunk_size + c] *
+                                  src(*colnum_ptr * chunk_size + c));
+
+              ++colnum_ptr;
+              val_ptr += chunk_size * chunk_size;
+            }
+
+          for (int r = 0; r < chunk_size; ++r)
+            dst_ptr[r] = result[r];
+          dst_ptr += chunk_size;
+        }
+    }
+
+
+
     /**
      * Perform a vmult_add using the ChunkSparseMatrix data structures, but
      * only using a subinterval of the matrix rows.
@@ -203,30 +300,68 @@ namespace internal
       const number *val_ptr =
         &values[rowstart[begin_row] * chunk_size * chunk_size];
       const size_type *colnum_ptr = &colnums[rowstart[begin_row]];
-      for (unsigned int chunk_row = begin_row; chunk_row < last_regular_row;
-           ++chunk_row)
-        {
-          const number *const val_end_of_row =
-            &values[rowstart[chunk_row + 1] * chunk_size * chunk_size];
-          while (val_ptr != val_end_of_row)
-            {
-              if (*colnum_ptr != irregular_col)
-                chunk_vmult_add(chunk_size,
-                                val_ptr,
-                                src.begin() + *colnum_ptr * chunk_size,
-                                dst_ptr);
-              else
-                // we're at a chunk column that has padding
-                for (size_type r = 0; r < chunk_size; ++r)
-                  for (size_type c = 0; c < n_filled_last_cols; ++c)
-                    dst_ptr[r] += (val_ptr[r * chunk_size + c] *
-                                   src(*colnum_ptr * chunk_size + c));
-
-              ++colnum_ptr;
-              val_ptr += chunk_size * chunk_size;
-            }
 
-          dst_ptr += chunk_size;
+      // use the kernels with a compile-time chunk size for the common
+      // sizes of vector-valued problems and the generic loops otherwise
+      const auto run_regular_rows = [&](auto fixed_chunk_size) {
+        vmult_add_on_regular_rows<decltype(fixed_chunk_size)::value,
+                                  number,
+                                  InVector,
+                                  OutVector>(begin_row,
+                                             last_regular_row,
+                                             irregular_col,
+                                             n_filled_last_cols,
+                                             values,
+                                             rowstart,
+                                             val_ptr,
+                                             colnum_ptr,
+                                             src,
+                                             dst_ptr);
+      };
+      switch (chunk_size)
+        {
+          case 2:
+            run_regular_rows(std::integral_constant<int, 2>());
+            break;
+          case 3:
+            run_regular_rows(std::integral_constant<int, 3>());
+            break;
+          case 4:
+            run_regular_rows(std::integral_constant<int, 4>());
+            break;
+          case 6:
+            run_regular_rows(std::integral_constant<int, 6>());
+            break;
+          case 8:
+            run_regular_rows(std::integral_constant<int, 8>());
+            break;
+          default:
+            for (unsigned int chunk_row = begin_row;
+                 chunk_row < last_regular_row;
+                 ++chunk_row)
+              {
+                const number *const val_end_of_row =
+                  &values[rowstart[chunk_row + 1] * chunk_size * chunk_size];
+                while (val_ptr != val_end_of_row)
+                  {
+                    if (*colnum_ptr != irregular_col)
+                      chunk_vmult_add(chunk_size,
+                                      val_ptr,
+                                      src.begin() + *colnum_ptr * chunk_size,
+                                      dst_ptr);
+                    else
+                      // we're at a chunk column that has padding
+                      for (size_type r = 0; r < chunk_size; ++r)
+                        for (size_type c = 0; c < n_filled_last_cols; ++c)
+                          dst_ptr[r] += (val_ptr[r * chunk_size + c] *
+                                         src(*colnum_ptr * chunk_size + c));
+
+                    ++colnum_ptr;
+                    val_ptr += chunk_size * chunk_size;
+                  }
+
+                dst_ptr += chunk_size;
+              }
         }
 
       // now deal with last chunk row if necessary
@@ -439,9 +574,12 @@ ChunkSparseMatrix<number>::reinit(const ChunkSparsityPattern &sparsity)
     {
       val.reset();
       max_len = 0;
+      row_partition.clear();
       return;
     }
 
+  compute_row_partition();
+
   // allocate not just m() * n() elements but enough so that we can store full
   // chunks. this entails some padding elements
   const size_type chunk_size = cols->get_chunk_size();
@@ -461,6 +599,48 @@ ChunkSparseMatrix<number>::reinit(const ChunkSparsityPattern &sparsity)
 
 
 
+template <typename number>
+void
+ChunkSparseMatrix<number>::compute_row_partition()
+{
+  row_partition.clear();
+  const size_type n_chunk_rows = cols->sparsity_pattern.n_rows();
+  if (n_chunk_rows == 0)
+    return;
+
+  const unsigned int n_threads  = MultithreadInfo::n_threads();
+  const size_type    grain_size = std::max<size_type>(
+    1,
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+      cols->chunk_size);
+
+  // use a few ranges per thread to balance the remaining differences in the
+  // cost of rows
+  const size_type n_ranges =
+    n_threads > 1 ?
+      std::max<size_type>(
+        1, std::min<size_type>(n_chunk_rows / grain_size, 4 * n_threads)) :
+      1;
+
+  // balance the ranges by the number of nonzero chunks plus one per chunk
+  // row to account for the cost of writing the result
+  const std::size_t *rowstart = cols->sparsity_pattern.rowstart.get();
+  const std::size_t  n_work   = rowstart[n_chunk_rows] + n_chunk_rows;
+  row_partition.resize(n_ranges + 1);
+  row_partition[0] = 0;
+  size_type row    = 0;
+  for (size_type c = 1; c < n_ranges; ++c)
+    {
+      const std::size_t target = n_work * c / n_ranges;
+      while (row < n_chunk_rows && rowstart[row] + row < target)
+        ++row;
+      row_partition[c] = row;
+    }
+  row_partition[n_ranges] = n_chunk_rows;
+}
+
+
+
 template <typename number>
 void
 ChunkSparseMatrix<number>::clear()
@@ -468,6 +648,7 @@ ChunkSparseMatrix<number>::clear()
   cols = nullptr;
   val.reset();
   max_len = 0;
+  row_partition.clear();
 }
 
 
@@ -702,24 +883,32 @@ ChunkSparseMatrix<number>::vmult_add(OutVector &dst, const InVector &src) const
   Assert(n() == src.size(), ExcDimensionMismatch(n(), src.size()));
 
   Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+  Assert(row_partition.empty() ||
+           row_partition.back() == cols->sparsity_pattern.n_rows(),
+         ExcMessage("The partition of rows does not match the sparsity "
+                    "pattern. Did you forget to call reinit() after changing "
+                    "the sparsity pattern?"));
+  if (row_partition.empty())
+    return;
+
+  // run over the ranges of chunk rows with a similar number of nonzero
+  // chunks, see compute_row_partition()
   parallel::apply_to_subranges(
-    0U,
-    cols->sparsity_pattern.n_rows(),
-    [this, &src, &dst](const unsigned int begin_row,
-                       const unsigned int end_row) {
+    size_type(0),
+    size_type(row_partition.size() - 1),
+    [this, &src, &dst](const size_type begin_range,
+                       const size_type end_range) {
       internal::ChunkSparseMatrixImplementation::vmult_add_on_subrange(
         *cols,
-        begin_row,
-        end_row,
+        row_partition[begin_range],
+        row_partition[end_range],
         val.get(),
         cols->sparsity_pattern.rowstart.get(),
         cols->sparsity_pattern.colnums.get(),
         src,
         dst);
     },
-    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
-        cols->chunk_size +
-      1);
+    1);
 }
 
 
@@ -1209,10 +1398,8 @@ template <typename somenumber>
 void
 ChunkSparseMatrix<number>::precondition_Jacobi(Vector<somenumber>       &dst,
                                                const Vector<somenumber> &src,
-                                               const number /*om*/) const
+                                               const number om) const
 {
-  (void)dst;
-  (void)src;
   Assert(cols != nullptr, ExcNeedsSparsityPattern());
   Assert(val != nullptr, ExcNotInitialized());
   Assert(m() == n(),
@@ -1221,7 +1408,52 @@ ChunkSparseMatrix<number>::precondition_Jacobi(Vector<somenumber>       &dst,
   Assert(dst.size() == n(), ExcDimensionMismatch(dst.size(), n()));
   Assert(src.size() == n(), ExcDimensionMismatch(src.size(), n()));
 
-  DEAL_II_NOT_IMPLEMENTED();
+  // the diagonal entries are on the diagonal of the first chunk of each
+  // chunk row, see diag_element()
+  const size_type    chunk_size = cols->get_chunk_size();
+  const std::size_t *rowstart   = cols->sparsity_pattern.rowstart.get();
+  const size_type    n_rows     = m();
+  for (size_type i = 0; i < n_rows; ++i)
+    {
+      const number diagonal =
+        val[rowstart[i / chunk_size] * chunk_size * chunk_size +
+            (i % chunk_size) * (chunk_size + 1)];
+      Assert(diagonal != number(),
+             ExcMessage("The diagonal entry of row " + std::to_string(i) +
+                        " is zero."));
+      dst(i) = om * src(i) / diagonal;
+    }
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+ChunkSparseMatrix<number>::Jacobi_step(Vector<somenumber>       &v,
+                                       const Vector<somenumber> &b,
+                                       const number              om) const
+{
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  AssertDimension(m(), n());
+
+  Assert(m() == v.size(), ExcDimensionMismatch(m(), v.size()));
+  Assert(m() == b.size(), ExcDimensionMismatch(m(), b.size()));
+
+  GrowingVectorMemory<Vector<somenumber>>            mem;
+  typename VectorMemory<Vector<somenumber>>::Pointer w(mem);
+  w->reinit(v);
+
+  if (!v.all_zero())
+    {
+      vmult(*w, v);
+      *w -= b;
+    }
+  else
+    w->equ(-1., b);
+  precondition_Jacobi(*w, *w, om);
+  v -= *w;
 }
 
 
@@ -1614,7 +1846,8 @@ template <typename number>
 std::size_t
 ChunkSparseMatrix<number>::memory_consumption() const
 {
-  return sizeof(*this) + max_len * sizeof(number);
+  return sizeof(*this) + max_len * sizeof(number) +
+         MemoryConsumption::memory_consumption(row_partition);
 }
 
 
@@ -0,0 +1,889 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_eigen_lobpcg_h
+#define dealii_eigen_lobpcg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/numbers.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/lapack_templates.h>
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/vector_memory.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * @addtogroup Solvers
+ * @{
+ */
+
+/**
+ * Locally optimal block preconditioned conjugate gradient method (LOBPCG)
+ * for computing the smallest eigenvalues and the corresponding eigenvectors
+ * of the symmetric generalized eigenvalue problem $A x = \lambda B x$ with a
+ * symmetric positive definite matrix $B$, or of the standard problem
+ * $A x = \lambda x$, see @cite Knyazev2001.
+ *
+ * In each iteration, the method computes the residuals
+ * $r_i = A x_i - \lambda_i B x_i$ of the current approximations, applies
+ * the preconditioner to them, and performs a Rayleigh-Ritz projection onto
+ * the space spanned by the approximations $X$, the preconditioned residuals
+ * $W$, and the previous search directions $P$. In contrast to ArpackSolver
+ * and the SLEPc solvers, the method only needs the action of $A$, $B$, and
+ * the preconditioner on vectors, so it can be used with matrix-free
+ * operators and, e.g., a multigrid V-cycle approximating $A^{-1}$ as
+ * preconditioner, whose quality determines the convergence rate of the
+ * method.
+ *
+ * The vector operations are done on the whole block of vectors: the inner
+ * products needed for the B-orthonormalization of the blocks (via a
+ * Cholesky factorization of the Gram matrix) and for the Rayleigh-Ritz
+ * projection are computed together with a single global reduction each,
+ * and the updates of the vectors by linear combinations of the blocks are
+ * done in a single pass through memory per result vector. For
+ * LinearAlgebra::distributed::Vector, the local inner products are
+ * furthermore computed with a loop blocked for caches and the updates use
+ * LinearAlgebra::distributed::Vector::equ() with several vectors, which
+ * makes the method suitable for computing hundreds of eigenpairs. Other
+ * vector types fall back to the inner products and add() operations of the
+ * individual vectors. Eigenpairs whose residual norm is below the
+ * tolerance of the SolverControl object are excluded from the residual and
+ * search direction blocks ("soft locking"), which reduces the work and the
+ * condition of the projection as more and more eigenpairs converge.
+ *
+ * The number of computed eigenpairs is given by the size of the vector of
+ * initial guesses passed to solve(). The value passed to the SolverControl
+ * object in each iteration is the largest residual norm
+ * $\|A x_i - \lambda_i B x_i\|$ among all eigenpairs, with $x_i$
+ * B-orthonormal.
+ *
+ * @note The class needs ten vectors per eigenpair for the generalized
+ * problem and seven for the standard problem, allocated from the
+ * VectorMemory object. The dense Rayleigh-Ritz problem of size up to three
+ * times the number of eigenpairs is solved by LAPACK on every process.
+ */
+template <typename VectorType = Vector<double>>
+class EigenLOBPCG : private SolverBase<VectorType>
+{
+public:
+  /**
+   * Declare type of container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Standardized data struct to pipe additional data to the solver.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const bool use_soft_locking = true)
+      : use_soft_locking(use_soft_locking)
+    {}
+
+    /**
+     * Remove converged eigenpairs from the blocks of residuals and search
+     * directions. Converged eigenvectors still take part in the
+     * Rayleigh-Ritz projection, so their accuracy is still improved by the
+     * other directions.
+     */
+    bool use_soft_locking;
+  };
+
+  /**
+   * Constructor.
+   */
+  EigenLOBPCG(SolverControl            &cn,
+              VectorMemory<VectorType> &mem,
+              const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  EigenLOBPCG(SolverControl &cn, const AdditionalData &data = AdditionalData());
+
+  /**
+   * Compute the smallest eigenvalues of the standard eigenvalue problem
+   * $A x = \lambda x$. On input, @p eigenvectors contains linearly
+   * independent initial guesses, e.g. random vectors, whose number
+   * determines the number of computed eigenpairs. On output, @p eigenvalues
+   * contains the eigenvalues in ascending order and @p eigenvectors the
+   * orthonormal eigenvectors.
+   *
+   * The preconditioner should approximate the inverse of $A$ (or of a
+   * shifted version of it if $A$ is not positive definite).
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  void
+  solve(const MatrixType         &A,
+        const PreconditionerType &preconditioner,
+        std::vector<double>      &eigenvalues,
+        std::vector<VectorType>  &eigenvectors);
+
+  /**
+   * Compute the smallest eigenvalues of the generalized eigenvalue problem
+   * $A x = \lambda B x$ with the symmetric positive definite matrix @p B.
+   * The arguments are as for the other solve() function, except that the
+   * eigenvectors are B-orthonormal.
+   */
+  template <typename MatrixType,
+            typename MassMatrixType,
+            typename PreconditionerType>
+  void
+  solve(const MatrixType         &A,
+        const MassMatrixType     &B,
+        const PreconditionerType &preconditioner,
+        std::vector<double>      &eigenvalues,
+        std::vector<VectorType>  &eigenvectors);
+
+protected:
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+
+private:
+  /**
+   * Reference to the object that controls convergence, whose tolerance also
+   * decides which eigenpairs are locked.
+   */
+  SolverControl &solver_control;
+
+  /**
+   * Implementation of the solve() functions. A null pointer for @p B
+   * selects the standard eigenvalue problem.
+   */
+  template <typename MatrixType,
+            typename MassMatrixType,
+            typename PreconditionerType>
+  void
+  do_solve(const MatrixType         &A,
+           const MassMatrixType     *B,
+           const PreconditionerType &preconditioner,
+           std::vector<double>      &eigenvalues,
+           std::vector<VectorType>  &eigenvectors);
+};
+
+/** @} */
+
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace EigenLOBPCGImplementation
+  {
+    template <typename VectorType>
+    constexpr bool is_host_distributed_vector =
+      std::is_same_v<VectorType,
+                     LinearAlgebra::distributed::Vector<
+                       typename VectorType::value_type,
+                       ::dealii::MemorySpace::Host>>;
+
+
+
+    // Compute result(i,j) = U[i] * V[j] with a single global reduction for
+    // deal.II's distributed vectors
+    template <typename VectorType>
+    void
+    inner_products(const std::vector<VectorType *> &U,
+                   const std::vector<VectorType *> &V,
+                   FullMatrix<double>              &result)
+    {
+      result.reinit(U.size(), V.size());
+      if (U.empty() || V.empty())
+        return;
+
+      if constexpr (is_host_distributed_vector<VectorType>)
+        {
+          using Number = typename VectorType::value_type;
+
+          // go through the vectors in chunks that fit into caches together
+          // for all vectors of the two blocks
+          const unsigned int     size       = U[0]->locally_owned_size();
+          constexpr unsigned int chunk_size = 256;
+          for (unsigned int start = 0; start < size; start += chunk_size)
+            {
+              const unsigned int end = std::min(size, start + chunk_size);
+              for (unsigned int i = 0; i < U.size(); ++i)
+                {
+                  const Number *u = U[i]->begin();
+                  for (unsigned int j = 0; j < V.size(); ++j)
+                    {
+                      const Number *v   = V[j]->begin();
+                      double        sum = 0.;
+                      for (unsigned int k = start; k < end; ++k)
+                        sum += static_cast<double>(u[k]) * v[k];
+                      result(i, j) += sum;
+                    }
+                }
+            }
+
+          const ArrayView<double> values(&result(0, 0), result.n_elements());
+          Utilities::MPI::sum(ArrayView<const double>(values),
+                              U[0]->get_mpi_communicator(),
+                              values);
+        }
+      else
+        for (unsigned int i = 0; i < U.size(); ++i)
+          for (unsigned int j = 0; j < V.size(); ++j)
+            result(i, j) = (*U[i]) * (*V[j]);
+    }
+
+
+
+    // Compute result[i] = U[i] * V[i] with a single global reduction for
+    // deal.II's distributed vectors
+    template <typename VectorType>
+    void
+    diagonal_inner_products(const std::vector<VectorType *> &U,
+                            const std::vector<VectorType *> &V,
+                            std::vector<double>             &result)
+    {
+      AssertDimension(U.size(), V.size());
+      result.assign(U.size(), 0.);
+      if (U.empty())
+        return;
+
+      if constexpr (is_host_distributed_vector<VectorType>)
+        {
+          using Number = typename VectorType::value_type;
+
+          const unsigned int size = U[0]->locally_owned_size();
+          for (unsigned int i = 0; i < U.size(); ++i)
+            {
+              const Number *u   = U[i]->begin();
+              const Number *v   = V[i]->begin();
+              double        sum = 0.;
+              for (unsigned int k = 0; k < size; ++k)
+                sum += static_cast<double>(u[k]) * v[k];
+              result[i] = sum;
+            }
+
+          Utilities::MPI::sum(ArrayView<const double>(result),
+                              U[0]->get_mpi_communicator(),
+                              ArrayView<double>(result));
+        }
+      else
+        for (unsigned int i = 0; i < U.size(); ++i)
+          result[i] = (*U[i]) * (*V[i]);
+    }
+
+
+
+    // Compute dst = sum_i factors[i] * vectors[i], where dst may appear once
+    // among the vectors
+    template <typename VectorType>
+    void
+    linear_combination(VectorType                      &dst,
+                       const std::vector<double>       &factors,
+                       const std::vector<VectorType *> &vectors)
+    {
+      using Number = typename VectorType::value_type;
+      AssertDimension(factors.size(), vectors.size());
+
+      if constexpr (is_host_distributed_vector<VectorType>)
+        {
+          const std::vector<Number> number_factors(factors.begin(),
+                                                   factors.end());
+          const std::vector<const VectorType *> const_vectors(vectors.begin(),
+                                                              vectors.end());
+          dst.equ(make_array_view(number_factors),
+                  make_array_view(const_vectors));
+        }
+      else
+        {
+          unsigned int self = numbers::invalid_unsigned_int;
+          for (unsigned int i = 0; i < vectors.size(); ++i)
+            if (vectors[i] == &dst)
+              self = i;
+
+          if (self != numbers::invalid_unsigned_int)
+            dst *= static_cast<Number>(factors[self]);
+          else
+            dst = Number();
+          for (unsigned int i = 0; i < vectors.size(); ++i)
+            if (i != self)
+              dst.add(static_cast<Number>(factors[i]), *vectors[i]);
+        }
+    }
+
+
+
+    // Compute the Cholesky factorization G = L L^T of a symmetric matrix and
+    // return the inverse of L in G. A column is considered linearly
+    // dependent on the previous ones if its pivot is below the given
+    // tolerance relative to its diagonal entry. If @p dropped is given, such
+    // columns are marked in it and decoupled from the other columns by a
+    // unit row and column in the factor, otherwise the function returns
+    // false.
+    inline bool
+    invert_cholesky_factor(FullMatrix<double> &G,
+                           const double        relative_tolerance,
+                           std::vector<bool>  *dropped = nullptr)
+    {
+      const unsigned int n = G.m();
+      AssertDimension(G.n(), n);
+      if (dropped != nullptr)
+        dropped->assign(n, false);
+
+      FullMatrix<double> L(n, n);
+      for (unsigned int j = 0; j < n; ++j)
+        {
+          double d = G(j, j);
+          for (unsigned int k = 0; k < j; ++k)
+            d -= L(j, k) * L(j, k);
+          if (!(d > relative_tolerance * std::abs(G(j, j))))
+            {
+              if (dropped == nullptr)
+                return false;
+              (*dropped)[j] = true;
+              for (unsigned int k = 0; k < j; ++k)
+                L(j, k) = 0.;
+              L(j, j) = 1.;
+              continue;
+            }
+          L(j, j) = std::sqrt(d);
+          for (unsigned int i = j + 1; i < n; ++i)
+            {
+              double sum = G(i, j);
+              for (unsigned int k = 0; k < j; ++k)
+                sum -= L(i, k) * L(j, k);
+              L(i, j) = sum / L(j, j);
+            }
+        }
+
+      // invert the lower triangular factor by forward substitution
+      G = 0.;
+      for (unsigned int j = 0; j < n; ++j)
+        {
+          G(j, j) = 1. / L(j, j);
+          for (unsigned int i = j + 1; i < n; ++i)
+            {
+              double sum = 0.;
+              for (unsigned int k = j; k < i; ++k)
+                sum -= L(i, k) * G(k, j);
+              G(i, j) = sum / L(i, i);
+            }
+        }
+      return true;
+    }
+
+
+
+    // Solve the dense generalized eigenvalue problem G_A c = lambda G_B c
+    // and return the eigenvectors of the n_eigenvalues smallest eigenvalues
+    // in the columns of C, normalized with respect to G_B. Return false if
+    // G_B is not sufficiently positive definite.
+    inline bool
+    rayleigh_ritz(const FullMatrix<double> &G_A,
+                  FullMatrix<double>       &G_B,
+                  const unsigned int        n_eigenvalues,
+                  const double              relative_tolerance,
+                  std::vector<double>      &eigenvalues,
+                  FullMatrix<double>       &C)
+    {
+      const unsigned int n = G_A.m();
+      AssertIndexRange(n_eigenvalues, n + 1);
+
+      if (invert_cholesky_factor(G_B, relative_tolerance) == false)
+        return false;
+      const FullMatrix<double> &L_inverse = G_B;
+
+      // transform to the standard problem L^{-1} G_A L^{-T}, stored in the
+      // column-major format of LAPACK (the matrix is symmetric)
+      FullMatrix<double> tmp(n, n);
+      L_inverse.mmult(tmp, G_A);
+      std::vector<double> matrix(n * n);
+      for (unsigned int i = 0; i < n; ++i)
+        for (unsigned int j = 0; j <= i; ++j)
+          {
+            double sum = 0.;
+            for (unsigned int k = 0; k <= j; ++k)
+              sum += tmp(i, k) * L_inverse(j, k);
+            matrix[i + j * n] = sum;
+            matrix[j + i * n] = sum;
+          }
+
+      const types::blas_int n_blas = n;
+      types::blas_int       info   = 0;
+      types::blas_int       lwork  = -1;
+      std::vector<double>   values(n);
+      std::vector<double>   work(1);
+      syev(&LAPACKSupport::V,
+           &LAPACKSupport::U,
+           &n_blas,
+           matrix.data(),
+           &n_blas,
+           values.data(),
+           work.data(),
+           &lwork,
+           &info);
+      lwork = static_cast<types::blas_int>(work[0] + 1);
+      work.resize(lwork);
+      syev(&LAPACKSupport::V,
+           &LAPACKSupport::U,
+           &n_blas,
+           matrix.data(),
+           &n_blas,
+           values.data(),
+           work.data(),
+           &lwork,
+           &info);
+      AssertThrow(info == 0, LAPACKSupport::ExcErrorCode("syev", info));
+
+      // back-transform the eigenvectors, C = L^{-T} Z
+      eigenvalues.assign(values.begin(), values.begin() + n_eigenvalues);
+      C.reinit(n, n_eigenvalues);
+      for (unsigned int i = 0; i < n; ++i)
+        for (unsigned int j = 0; j < n_eigenvalues; ++j)
+          {
+            double sum = 0.;
+            for (unsigned int k = i; k < n; ++k)
+              sum += L_inverse(k, i) * matrix[k + j * n];
+            C(i, j) = sum;
+          }
+      return true;
+    }
+  } // namespace EigenLOBPCGImplementation
+} // namespace internal
+
+
+
+template <typename VectorType>
+EigenLOBPCG<VectorType>::EigenLOBPCG(SolverControl            &cn,
+                                     VectorMemory<VectorType> &mem,
+                                     const AdditionalData     &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+  , solver_control(cn)
+{}
+
+
+
+template <typename VectorType>
+EigenLOBPCG<VectorType>::EigenLOBPCG(SolverControl        &cn,
+                                     const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+  , solver_control(cn)
+{}
+
+
+
+template <typename VectorType>
+template <typename MatrixType, typename PreconditionerType>
+void
+EigenLOBPCG<VectorType>::solve(const MatrixType         &A,
+                               const PreconditionerType &preconditioner,
+                               std::vector<double>      &eigenvalues,
+                               std::vector<VectorType>  &eigenvectors)
+{
+  do_solve(A,
+           static_cast<const MatrixType *>(nullptr),
+           preconditioner,
+           eigenvalues,
+           eigenvectors);
+}
+
+
+
+template <typename VectorType>
+template <typename MatrixType,
+          typename MassMatrixType,
+          typename PreconditionerType>
+void
+EigenLOBPCG<VectorType>::solve(const MatrixType         &A,
+                               const MassMatrixType     &B,
+                               const PreconditionerType &preconditioner,
+                               std::vector<double>      &eigenvalues,
+                               std::vector<VectorType>  &eigenvectors)
+{
+  do_solve(A, &B, preconditioner, eigenvalues, eigenvectors);
+}
+
+
+
+template <typename VectorType>
+template <typename MatrixType,
+          typename MassMatrixType,
+          typename PreconditionerType>
+void
+EigenLOBPCG<VectorType>::do_solve(const MatrixType         &A,
+                                  const MassMatrixType     *B,
+                                  const PreconditionerType &preconditioner,
+                                  std::vector<double>      &eigenvalues,
+                                  std::vector<VectorType>  &eigenvectors)
+{
+  namespace Impl = internal::EigenLOBPCGImplementation;
+  using Number   = typename VectorType::value_type;
+  static_assert(!numbers::NumberTraits<Number>::is_complex,
+                "EigenLOBPCG is only implemented for real vectors.");
+
+  const unsigned int n_eigenvalues = eigenvectors.size();
+  AssertThrow(n_eigenvalues > 0,
+              ExcMessage("You need to provide at least one initial guess."));
+
+  // tolerance for detecting linearly dependent blocks in the Cholesky
+  // factorization of Gram matrices
+  const double relative_tolerance =
+    1e3 * std::numeric_limits<Number>::epsilon();
+
+  LogStream::Prefix prefix("LOBPCG");
+
+  // All vectors are laid out like the initial guesses, and the blocks are
+  // addressed via pointers, such that updates can swap the blocks without
+  // copying. For the standard problem, the B-blocks alias the vectors
+  // themselves.
+  std::vector<typename VectorMemory<VectorType>::Pointer> storage;
+  const auto allocate_block = [&]() {
+    std::vector<VectorType *> block(n_eigenvalues);
+    for (VectorType *&v : block)
+      {
+        storage.emplace_back(this->memory, eigenvectors[0]);
+        v = storage.back().get();
+      }
+    return block;
+  };
+
+  std::vector<VectorType *> X  = allocate_block();
+  std::vector<VectorType *> AX = allocate_block();
+  std::vector<VectorType *> W  = allocate_block();
+  std::vector<VectorType *> AW = allocate_block();
+  std::vector<VectorType *> P  = allocate_block();
+  std::vector<VectorType *> AP = allocate_block();
+  std::vector<VectorType *> T  = allocate_block();
+  std::vector<VectorType *> BX, BW, BP;
+  if (B != nullptr)
+    {
+      BX = allocate_block();
+      BW = allocate_block();
+      BP = allocate_block();
+    }
+
+  const auto update_aliases = [&]() {
+    if (B == nullptr)
+      {
+        BX = X;
+        BW = W;
+        BP = P;
+      }
+  };
+  update_aliases();
+
+  const auto select = [](const std::vector<VectorType *>  &block,
+                         const std::vector<unsigned int> &indices) {
+    std::vector<VectorType *> result;
+    result.reserve(indices.size());
+    for (const unsigned int j : indices)
+      result.push_back(block[j]);
+    return result;
+  };
+
+  const auto concatenate = [](std::vector<VectorType *>        result,
+                              const std::vector<VectorType *> &block) {
+    result.insert(result.end(), block.begin(), block.end());
+    return result;
+  };
+
+  // Make the columns @p indices of @p block B-orthonormal by the inverse of
+  // the transpose of the Cholesky factor of their Gram matrix, and apply
+  // the same transformation to the other blocks in @p update_blocks.
+  // Columns that are numerically linearly dependent on the previous ones
+  // are removed from @p indices. Since the inverse factor is triangular,
+  // going through the columns from the last to the first only reads columns
+  // that have not been overwritten yet.
+  std::vector<double> factors;
+  const auto          orthonormalize =
+    [&](const std::vector<VectorType *>                &block,
+        const std::vector<VectorType *>                &B_block,
+        std::vector<unsigned int>                      &indices,
+        const std::vector<std::vector<VectorType *> *> &update_blocks) {
+      FullMatrix<double> L_inverse;
+      Impl::inner_products(select(block, indices),
+                           select(B_block, indices),
+                           L_inverse);
+      L_inverse.symmetrize();
+      std::vector<bool> dropped;
+      Impl::invert_cholesky_factor(L_inverse, relative_tolerance, &dropped);
+
+      std::vector<unsigned int> kept;
+      for (unsigned int c = 0; c < indices.size(); ++c)
+        if (dropped[c] == false)
+          kept.push_back(c);
+
+      for (std::vector<VectorType *> *update_block : update_blocks)
+        {
+          std::vector<VectorType *> vectors = select(*update_block, indices);
+          for (unsigned int c = kept.size(); c > 0;)
+            {
+              --c;
+              factors.resize(c + 1);
+              std::vector<VectorType *> terms(c + 1);
+              for (unsigned int i = 0; i <= c; ++i)
+                {
+                  factors[i] = L_inverse(kept[c], kept[i]);
+                  terms[i]   = vectors[kept[i]];
+                }
+              Impl::linear_combination(*terms[c], factors, terms);
+            }
+        }
+
+      for (unsigned int c = 0; c < kept.size(); ++c)
+        kept[c] = indices[kept[c]];
+      indices.swap(kept);
+    };
+
+  // Initial Rayleigh-Ritz step on the initial guesses
+  for (unsigned int j = 0; j < n_eigenvalues; ++j)
+    {
+      *X[j] = eigenvectors[j];
+      A.vmult(*AX[j], *X[j]);
+      if (B != nullptr)
+        B->vmult(*BX[j], *X[j]);
+    }
+
+  FullMatrix<double> G_A, G_B, C;
+  Impl::inner_products(X, AX, G_A);
+  Impl::inner_products(X, BX, G_B);
+  G_A.symmetrize();
+  G_B.symmetrize();
+  AssertThrow(Impl::rayleigh_ritz(
+                G_A, G_B, n_eigenvalues, relative_tolerance, eigenvalues, C),
+              ExcMessage("The initial guesses for LOBPCG are not linearly "
+                         "independent."));
+
+  const auto rotate_block = [&](std::vector<VectorType *> &block) {
+    factors.resize(n_eigenvalues);
+    for (unsigned int j = 0; j < n_eigenvalues; ++j)
+      {
+        for (unsigned int i = 0; i < n_eigenvalues; ++i)
+          factors[i] = C(i, j);
+        Impl::linear_combination(*T[j], factors, block);
+      }
+    std::swap(block, T);
+  };
+  rotate_block(X);
+  rotate_block(AX);
+  if (B != nullptr)
+    rotate_block(BX);
+  update_aliases();
+
+  // Rayleigh-Ritz projection onto [X, W, P] restricted to the given
+  // columns of W and P. The products of X with A X and B X are known from
+  // the previous projection and not recomputed.
+  const auto project = [&](const std::vector<unsigned int> &active_W,
+                           const std::vector<unsigned int> &active_P) {
+    const std::vector<VectorType *> S =
+      concatenate(concatenate(X, select(W, active_W)), select(P, active_P));
+    const std::vector<VectorType *> AS =
+      concatenate(select(AW, active_W), select(AP, active_P));
+    const std::vector<VectorType *> BS =
+      concatenate(select(BW, active_W), select(BP, active_P));
+
+    // compute the products with A and B with a single reduction
+    FullMatrix<double> products;
+    Impl::inner_products(S, concatenate(AS, BS), products);
+    const unsigned int n_new = AS.size();
+
+    const unsigned int n = S.size();
+    G_A.reinit(n, n);
+    G_B.reinit(n, n);
+    for (unsigned int i = 0; i < n_eigenvalues; ++i)
+      {
+        G_A(i, i) = eigenvalues[i];
+        G_B(i, i) = 1.;
+      }
+    for (unsigned int i = 0; i < n; ++i)
+      for (unsigned int j = n_eigenvalues; j < n; ++j)
+        {
+          G_A(i, j) = G_A(j, i) = products(i, j - n_eigenvalues);
+          G_B(i, j) = G_B(j, i) = products(i, n_new + j - n_eigenvalues);
+        }
+    for (unsigned int i = n_eigenvalues; i < n; ++i)
+      for (unsigned int j = n_eigenvalues; j < n; ++j)
+        {
+          G_A(i, j) = 0.5 * (products(i, j - n_eigenvalues) +
+                             products(j, i - n_eigenvalues));
+          G_B(i, j) = 0.5 * (products(i, n_new + j - n_eigenvalues) +
+                             products(j, n_new + i - n_eigenvalues));
+        }
+
+    return Impl::rayleigh_ritz(
+      G_A, G_B, n_eigenvalues, relative_tolerance, eigenvalues, C);
+  };
+
+  // Update the block V and its search direction block VP from the
+  // eigenvectors of the projection, using T and the storage of VP for the
+  // results
+  const auto update_block = [&](std::vector<VectorType *>       &V,
+                                const std::vector<VectorType *> &VW,
+                                std::vector<VectorType *>       &VP,
+                                const std::vector<unsigned int> &active_W,
+                                const std::vector<unsigned int> &active_P) {
+    const std::vector<VectorType *> directions =
+      concatenate(select(VW, active_W), select(VP, active_P));
+    factors.resize(directions.size());
+    for (unsigned int j = 0; j < n_eigenvalues; ++j)
+      {
+        for (unsigned int i = 0; i < directions.size(); ++i)
+          factors[i] = C(n_eigenvalues + i, j);
+        Impl::linear_combination(*T[j], factors, directions);
+      }
+
+    factors.resize(n_eigenvalues + 1);
+    std::vector<VectorType *> vectors = concatenate(V, {nullptr});
+    for (unsigned int j = 0; j < n_eigenvalues; ++j)
+      {
+        for (unsigned int i = 0; i < n_eigenvalues; ++i)
+          factors[i] = C(i, j);
+        factors[n_eigenvalues] = 1.;
+        vectors[n_eigenvalues] = T[j];
+        Impl::linear_combination(*VP[j], factors, vectors);
+      }
+
+    std::swap(V, VP);
+    std::swap(VP, T);
+  };
+
+  std::vector<double>       residual_norms;
+  std::vector<unsigned int> active;
+  double                    max_residual = 0.;
+  unsigned int              it           = 0;
+  SolverControl::State      state        = SolverControl::iterate;
+  for (; state == SolverControl::iterate; ++it)
+    {
+      // compute the residuals of all eigenpairs in W and their norms
+      factors.resize(2);
+      for (unsigned int j = 0; j < n_eigenvalues; ++j)
+        {
+          factors[0] = 1.;
+          factors[1] = -eigenvalues[j];
+          Impl::linear_combination(*W[j],
+                                   factors,
+                                   std::vector<VectorType *>{AX[j], BX[j]});
+        }
+      Impl::diagonal_inner_products(W, W, residual_norms);
+
+      max_residual = 0.;
+      active.clear();
+      for (unsigned int j = 0; j < n_eigenvalues; ++j)
+        {
+          residual_norms[j] = std::sqrt(std::max(residual_norms[j], 0.));
+          max_residual      = std::max(max_residual, residual_norms[j]);
+          if (additional_data.use_soft_locking == false ||
+              residual_norms[j] > solver_control.tolerance())
+            active.push_back(j);
+        }
+
+      state = this->iteration_status(it, max_residual, *X[0]);
+      if (state != SolverControl::iterate)
+        break;
+
+      // precondition the active residuals and B-orthogonalize them against
+      // the current approximations
+      for (const unsigned int j : active)
+        {
+          preconditioner.vmult(*T[j], *W[j]);
+          std::swap(W[j], T[j]);
+        }
+      update_aliases();
+
+      const std::vector<VectorType *> W_active = select(W, active);
+      Impl::inner_products(BX, W_active, C);
+      factors.resize(n_eigenvalues + 1);
+      for (unsigned int c = 0; c < active.size(); ++c)
+        {
+          factors[0] = 1.;
+          for (unsigned int i = 0; i < n_eigenvalues; ++i)
+            factors[i + 1] = -C(i, c);
+          Impl::linear_combination(*W_active[c],
+                                   factors,
+                                   concatenate({W_active[c]}, X));
+        }
+
+      if (B != nullptr)
+        for (const unsigned int j : active)
+          B->vmult(*BW[j], *W[j]);
+      std::vector<std::vector<VectorType *> *> W_blocks = {&W};
+      if (B != nullptr)
+        W_blocks.push_back(&BW);
+      std::vector<unsigned int> active_W = active;
+      orthonormalize(W, BW, active_W, W_blocks);
+      for (const unsigned int j : active_W)
+        A.vmult(*AW[j], *W[j]);
+
+      // the search directions are available from the second iteration on
+      std::vector<unsigned int> active_P;
+      if (it > 0)
+        {
+          std::vector<std::vector<VectorType *> *> P_blocks = {&P, &AP};
+          if (B != nullptr)
+            P_blocks.push_back(&BP);
+          active_P = active;
+          orthonormalize(P, BP, active_P, P_blocks);
+        }
+      AssertThrow(active_W.size() + active_P.size() > 0,
+                  SolverControl::NoConvergence(it, max_residual));
+
+      // if the projection fails due to linear dependencies between the
+      // blocks, restart without the search directions
+      bool success = project(active_W, active_P);
+      if (!success && !active_P.empty())
+        {
+          active_P.clear();
+          success = project(active_W, active_P);
+        }
+      AssertThrow(success, SolverControl::NoConvergence(it, max_residual));
+
+      update_block(X, W, P, active_W, active_P);
+      update_block(AX, AW, AP, active_W, active_P);
+      if (B != nullptr)
+        update_block(BX, BW, BP, active_W, active_P);
+      update_aliases();
+    }
+
+  for (unsigned int j = 0; j < n_eigenvalues; ++j)
+    eigenvectors[j] = *X[j];
+
+  AssertThrow(state == SolverControl::success,
+              SolverControl::NoConvergence(it, max_residual));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -26,6 +26,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/template_constraints.h>
+#include <deal.II/base/vectorization.h>
 
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/lapack_full_matrix.h>
@@ -37,11 +38,197 @@
 #include <cstdio>
 #include <cstdlib>
 #include <limits>
+#include <type_traits>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
 
+namespace internal
+{
+  namespace FullMatrixImplementation
+  {
+    /**
+     * Whether the matrix-matrix products between matrices with entries of
+     * type Number and Number2 can use the vectorized kernel below.
+     */
+    template <typename Number, typename Number2>
+    constexpr bool use_vectorized_mmult =
+      std::is_floating_point_v<Number> &&
+      (std::is_same_v<Number2, double> || std::is_same_v<Number2, float>);
+
+
+
+    /**
+     * Register-blocked micro-kernel computing a block of n_rows rows and
+     * n_vectors * VectorizedArray<Number2>::size() columns of C += A B, where
+     * entry (i,k) of A is a[i * a_row_stride + k * a_k_stride], and B and C
+     * are stored row by row with the strides ldb and ldc. The accumulators
+     * are kept in registers through the whole loop over k.
+     */
+    template <unsigned int n_rows,
+              unsigned int n_vectors,
+              typename Number,
+              typename Number2>
+    inline void
+    mmult_micro_kernel(const std::size_t l,
+                       const Number     *a,
+                       const std::size_t a_row_stride,
+                       const std::size_t a_k_stride,
+                       const Number2    *b,
+                       const std::size_t ldb,
+                       Number2          *c,
+                       const std::size_t ldc,
+                       const bool        adding)
+    {
+      using VectorizedArrayType = VectorizedArray<Number2>;
+      constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+      VectorizedArrayType accumulators[n_rows][n_vectors];
+      for (unsigned int r = 0; r < n_rows; ++r)
+        for (unsigned int v = 0; v < n_vectors; ++v)
+          if (adding)
+            accumulators[r][v].load(c + r * ldc + v * n_lanes);
+          else
+            accumulators[r][v] = Number2();
+
+      for (std::size_t k = 0; k < l; ++k)
+        {
+          VectorizedArrayType b_k[n_vectors];
+          for (unsigned int v = 0; v < n_vectors; ++v)
+            b_k[v].load(b + k * ldb + v * n_lanes);
+          for (unsigned int r = 0; r < n_rows; ++r)
+            {
+              const VectorizedArrayType a_rk =
+                static_cast<Number2>(a[r * a_row_stride + k * a_k_stride]);
+              for (unsigned int v = 0; v < n_vectors; ++v)
+                accumulators[r][v] += a_rk * b_k[v];
+            }
+        }
+
+      for (unsigned int r = 0; r < n_rows; ++r)
+        for (unsigned int v = 0; v < n_vectors; ++v)
+          accumulators[r][v].store(c + r * ldc + v * n_lanes);
+    }
+
+
+
+    /**
+     * Run the micro-kernel with blocks of n_vectors vectors of columns on all
+     * rows of C, starting with column @p j.
+     */
+    template <unsigned int n_vectors, typename Number, typename Number2>
+    inline void
+    mmult_column_panel(const std::size_t m,
+                       const std::size_t l,
+                       const Number     *a,
+                       const std::size_t a_row_stride,
+                       const std::size_t a_k_stride,
+                       const Number2    *b,
+                       const std::size_t ldb,
+                       Number2          *c,
+                       const std::size_t ldc,
+                       const bool        adding)
+    {
+      constexpr unsigned int n_block_rows = 4;
+      std::size_t            i            = 0;
+      for (; i + n_block_rows <= m; i += n_block_rows)
+        mmult_micro_kernel<n_block_rows, n_vectors>(l,
+                                                    a + i * a_row_stride,
+                                                    a_row_stride,
+                                                    a_k_stride,
+                                                    b,
+                                                    ldb,
+                                                    c + i * ldc,
+                                                    ldc,
+                                                    adding);
+      for (; i < m; ++i)
+        mmult_micro_kernel<1, n_vectors>(l,
+                                         a + i * a_row_stride,
+                                         a_row_stride,
+                                         a_k_stride,
+                                         b,
+                                         ldb,
+                                         c + i * ldc,
+                                         ldc,
+                                         adding);
+    }
+
+
+
+    /**
+     * Compute the product C = A B (or C += A B if @p adding is true) of the
+     * m x l matrix A, whose entry (i,k) is a[i * a_row_stride + k *
+     * a_k_stride], and the l x n matrix B stored row by row, into the m x n
+     * matrix C stored row by row. The columns are processed in panels of
+     * SIMD vectors that are computed by a register-blocked micro-kernel,
+     * and the summation index is split into chunks, such that the rows of
+     * B touched by one panel stay in the L1 cache.
+     */
+    template <typename Number, typename Number2>
+    void
+    mmult_vectorized(const std::size_t m,
+                     const std::size_t n,
+                     const std::size_t l,
+                     const Number     *a,
+                     const std::size_t a_row_stride,
+                     const std::size_t a_k_stride,
+                     const Number2    *b,
+                     Number2          *c,
+                     const bool        adding)
+    {
+      constexpr unsigned int n_lanes    = VectorizedArray<Number2>::size();
+      constexpr std::size_t  chunk_size = 128;
+
+      for (std::size_t k0 = 0; k0 < l; k0 += chunk_size)
+        {
+          const std::size_t chunk     = std::min(chunk_size, l - k0);
+          const bool        add_chunk = adding || (k0 > 0);
+          const Number     *a_chunk   = a + k0 * a_k_stride;
+          const Number2    *b_chunk   = b + k0 * n;
+
+          std::size_t j = 0;
+          for (; j + 2 * n_lanes <= n; j += 2 * n_lanes)
+            mmult_column_panel<2>(m,
+                                  chunk,
+                                  a_chunk,
+                                  a_row_stride,
+                                  a_k_stride,
+                                  b_chunk + j,
+                                  n,
+                                  c + j,
+                                  n,
+                                  add_chunk);
+          for (; j + n_lanes <= n; j += n_lanes)
+            mmult_column_panel<1>(m,
+                                  chunk,
+                                  a_chunk,
+                                  a_row_stride,
+                                  a_k_stride,
+                                  b_chunk + j,
+                                  n,
+                                  c + j,
+                                  n,
+                                  add_chunk);
+
+          // remaining columns that do not fill a SIMD vector
+          for (; j < n; ++j)
+            for (std::size_t i = 0; i < m; ++i)
+              {
+                Number2 sum = add_chunk ? c[i * n + j] : Number2();
+                for (std::size_t k = 0; k < chunk; ++k)
+                  sum += static_cast<Number2>(
+                           a_chunk[i * a_row_stride + k * a_k_stride]) *
+                         b_chunk[k * n + j];
+                c[i * n + j] = sum;
+              }
+        }
+    }
+  } // namespace FullMatrixImplementation
+} // namespace internal
+
+
+
 template <typename number>
 FullMatrix<number>::FullMatrix(const size_type n)
   : Table<2, number>(n, n)
@@ -573,6 +760,17 @@ FullMatrix<number>::mmult(FullMatrix<number2>       &dst,
 
   const size_type m = this->m(), n = src.n(), l = this->n();
 
+  // for floating point numbers, use a register-blocked kernel that is
+  // vectorized over the columns of src and dst
+  if constexpr (internal::FullMatrixImplementation::
+                  use_vectorized_mmult<number, number2>)
+    {
+      if (n > 0)
+        internal::FullMatrixImplementation::mmult_vectorized(
+          m, n, l, this->values.data(), l, 1, &src(0, 0), &dst(0, 0), adding);
+      return;
+    }
+
   // arrange the loops in a way that we keep write operations low, (writing is
   // usually more costly than reading), even though we need to access the data
   // in src not in a contiguous way.
@@ -656,6 +854,18 @@ FullMatrix<number>::Tmmult(FullMatrix<number2>       &dst,
 
   const size_type m = n(), n = src.n(), l = this->m();
 
+  // for floating point numbers, use a register-blocked kernel that is
+  // vectorized over the columns of src and dst, reading this matrix by
+  // columns
+  if constexpr (internal::FullMatrixImplementation::
+                  use_vectorized_mmult<number, number2>)
+    {
+      if (n > 0)
+        internal::FullMatrixImplementation::mmult_vectorized(
+          m, n, l, this->values.data(), 1, m, &src(0, 0), &dst(0, 0), adding);
+      return;
+    }
+
   // symmetric matrix if the two matrices are the same
   if (PointerComparison::equal(this, &src))
     for (size_type i = 0; i < m; ++i)
@@ -22,6 +22,7 @@
 
 #  include <deal.II/lac/block_sparse_matrix.h>
 #  include <deal.II/lac/exceptions.h>
+#  include <deal.II/lac/la_parallel_vector.h>
 #  include <deal.II/lac/solver_control.h>
 #  include <deal.II/lac/sparse_matrix.h>
 #  include <deal.II/lac/vector.h>
@@ -108,6 +109,9 @@ namespace GinkgoWrappers
 
     /**
      * Initialize the matrix and copy over its data to Ginkgo's data structures.
+     * The matrix stays resident in the memory of the executor, and the
+     * solver, including its preconditioner, is generated once here and
+     * reused by all subsequent calls to apply().
      */
     void
     initialize(const SparseMatrix<ValueType> &matrix);
@@ -120,6 +124,31 @@ namespace GinkgoWrappers
     void
     apply(Vector<ValueType> &solution, const Vector<ValueType> &rhs);
 
+    /**
+     * Same as above, but for vectors of type LinearAlgebra::distributed::Vector
+     * in host memory. The vectors must not be distributed among several
+     * processes, since the Ginkgo matrix set up by initialize() is serial.
+     */
+    void
+    apply(
+      LinearAlgebra::distributed::Vector<ValueType, MemorySpace::Host>
+        &solution,
+      const LinearAlgebra::distributed::Vector<ValueType, MemorySpace::Host>
+        &rhs);
+
+    /**
+     * Same as above, but for vectors in the default memory space. If the
+     * default memory space is a device, the Ginkgo vectors wrap the device
+     * data of @p solution and @p rhs without copying them, which requires the
+     * executor of this object to work on the same device.
+     */
+    void
+    apply(
+      LinearAlgebra::distributed::Vector<ValueType, MemorySpace::Default>
+        &solution,
+      const LinearAlgebra::distributed::Vector<ValueType, MemorySpace::Default>
+        &rhs);
+
     /**
      * Solve the linear system <tt>Ax=b</tt>. Dependent on the information
      * provided by derived classes one of Ginkgo's linear solvers is
@@ -185,6 +214,19 @@ namespace GinkgoWrappers
     void
     initialize_ginkgo_log();
 
+    /**
+     * Solve the linear system with the right hand side and the solution
+     * given as arrays of length @p size in the memory of @p data_executor.
+     * If @p data_executor differs from the executor of this object, the
+     * vectors are copied to and from the memory of the latter. Otherwise,
+     * the solver works on the arrays directly.
+     */
+    void
+    apply_on_arrays(const std::shared_ptr<const gko::Executor> &data_executor,
+                    const std::size_t                           size,
+                    ValueType                                  *solution,
+                    const ValueType                            *rhs);
+
     /**
      * Ginkgo matrix data structure. First template parameter is for storing the
      * array of the non-zeros of the matrix. The second is for the row pointers
@@ -194,6 +236,11 @@ namespace GinkgoWrappers
      */
     std::shared_ptr<gko::matrix::Csr<ValueType, IndexType>> system_matrix;
 
+    /**
+     * The solver generated by initialize() for the system matrix.
+     */
+    std::shared_ptr<gko::LinOp> solver;
+
     /**
      * The execution paradigm as a string to be set by the user. The choices
      * are between `omp`, `cuda` and `reference` and more details can be found
@@ -0,0 +1,661 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_la_parallel_compressed_vector_h
+#define dealii_la_parallel_compressed_vector_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    /**
+     * The formats in which a CompressedVector can store its values.
+     */
+    enum class CompressionFormat
+    {
+      /**
+       * Store the values as IEEE single-precision numbers with 32 bits.
+       */
+      single_precision,
+
+      /**
+       * Store the values as IEEE half-precision numbers with 16 bits, i.e.,
+       * with 5 bits for the exponent and 10 bits for the mantissa. The
+       * relative accuracy is about $10^{-3}$ and the representable range is
+       * between $6 \cdot 10^{-8}$ and $65504$ in magnitude, with values
+       * outside this range being rounded to zero or infinity.
+       */
+      half_precision,
+
+      /**
+       * Store the values in the bfloat16 format with 16 bits, i.e., the upper
+       * half of a single-precision number with 8 bits for the exponent and 7
+       * bits for the mantissa. The relative accuracy is about $4 \cdot
+       * 10^{-3}$, but the range is the same as for single precision.
+       */
+      bfloat16,
+
+      /**
+       * Store the values in a block floating-point format, where each block
+       * of CompressedVector::block_size consecutive entries shares a common
+       * scaling factor, the largest magnitude within the block, and the
+       * entries are stored as 16-bit integers relative to that factor. The
+       * accuracy is about $3 \cdot 10^{-5}$ relative to the largest entry of
+       * the block, which makes this format well suited for vectors with
+       * smoothly varying entries.
+       */
+      block_floating_point
+    };
+
+
+
+    /**
+     * A vector that stores the locally owned values of a
+     * LinearAlgebra::distributed::Vector with the same parallel layout in a
+     * compressed, reduced-precision format, see CompressionFormat. The
+     * arithmetic is performed in the precision @p Number of the
+     * uncompressed vectors: the values are decompressed on the fly in small
+     * chunks that stay in the caches, so that the memory transfer is
+     * reduced to the size of the compressed data, which is half or a quarter
+     * of the data of a vector of doubles.
+     *
+     * This is useful for data that is read more often than it is written
+     * and whose accuracy can be lower than the one of the computations, for
+     * example a collection of basis vectors of a Krylov space, solution
+     * history data in time stepping, or auxiliary vectors on the levels of a
+     * multigrid method. The class only provides the operations that are
+     * needed in these contexts: storing the values of a vector with
+     * store(), retrieving them with load(), adding a multiple of the
+     * stored vector to a vector with add_to(), and the inner product with a
+     * vector with inner_product(). Each of these functions makes a single
+     * pass through the data. Ghost values are not stored.
+     *
+     * A typical use is
+     * @code
+     * LinearAlgebra::distributed::Vector<double> solution;
+     * // ... compute the solution ...
+     *
+     * LinearAlgebra::distributed::CompressedVector<double> old_solution(
+     *   solution, LinearAlgebra::distributed::CompressionFormat::bfloat16);
+     * old_solution.store(solution);
+     *
+     * // ... later: solution += 0.5 * old_solution
+     * old_solution.add_to(solution, 0.5);
+     * @endcode
+     *
+     * @ingroup Vectors
+     */
+    template <typename Number>
+    class CompressedVector : public EnableObserverPointer
+    {
+    public:
+      /**
+       * The number type in which the computations are performed.
+       */
+      using value_type = Number;
+
+      /**
+       * The type for indices into the vector.
+       */
+      using size_type = types::global_dof_index;
+
+      /**
+       * The number of entries sharing a scaling factor in the format
+       * CompressionFormat::block_floating_point, which is also the size of
+       * the chunks that are decompressed at once.
+       */
+      static constexpr unsigned int block_size = 64;
+
+      /**
+       * Default constructor. Create an empty vector.
+       */
+      CompressedVector();
+
+      /**
+       * Create a vector with the parallel layout of @p model that stores its
+       * values in the format @p format. The values are not copied; use
+       * store() for that purpose.
+       */
+      CompressedVector(const Vector<Number>   &model,
+                       const CompressionFormat format);
+
+      /**
+       * Set the parallel layout to the one of @p model and the format to
+       * @p format. The values are not copied; use store() for that purpose.
+       */
+      void
+      reinit(const Vector<Number> &model, const CompressionFormat format);
+
+      /**
+       * Set the parallel layout to the one given by @p partitioner and the
+       * format to @p format.
+       */
+      void
+      reinit(
+        const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+        const CompressionFormat                                   format);
+
+      /**
+       * Compress the locally owned values of @p v, which needs to have the
+       * same parallel layout as this vector, and store them.
+       */
+      void
+      store(const Vector<Number> &v);
+
+      /**
+       * Decompress the stored values into the locally owned entries of
+       * @p v, which needs to have the same parallel layout as this vector.
+       */
+      void
+      load(Vector<Number> &v) const;
+
+      /**
+       * Add @p factor times the stored vector to @p v, i.e., $v \leftarrow
+       * v + \text{factor} \cdot u$ where $u$ is the stored vector.
+       */
+      void
+      add_to(Vector<Number> &v, const Number factor = Number(1.)) const;
+
+      /**
+       * Return the inner product of the stored vector with @p v, including
+       * the sum over all MPI processes.
+       */
+      Number
+      inner_product(const Vector<Number> &v) const;
+
+      /**
+       * Return the global size of the vector.
+       */
+      size_type
+      size() const;
+
+      /**
+       * Return the number of locally owned entries.
+       */
+      unsigned int
+      locally_owned_size() const;
+
+      /**
+       * Return the format in which the values are stored.
+       */
+      CompressionFormat
+      get_format() const;
+
+      /**
+       * Return the partitioner describing the parallel layout of the vector.
+       */
+      const std::shared_ptr<const Utilities::MPI::Partitioner> &
+      get_partitioner() const;
+
+      /**
+       * Return the memory consumption of this class in bytes.
+       */
+      std::size_t
+      memory_consumption() const;
+
+    private:
+      /**
+       * Decompress the @p n_entries entries starting at @p start into the
+       * array @p values, with @p n_entries at most the block size and @p
+       * start a multiple of it.
+       */
+      void
+      decompress_chunk(const unsigned int start,
+                       const unsigned int n_entries,
+                       Number            *values) const;
+
+      /**
+       * Compress the @p n_entries entries of the array @p values and store
+       * them starting at index @p start, with @p n_entries at most the block
+       * size and @p start a multiple of it.
+       */
+      void
+      compress_chunk(const unsigned int start,
+                     const unsigned int n_entries,
+                     const Number      *values);
+
+      /**
+       * The parallel layout of the vector.
+       */
+      std::shared_ptr<const Utilities::MPI::Partitioner> partitioner;
+
+      /**
+       * The storage format.
+       */
+      CompressionFormat format;
+
+      /**
+       * Storage for the format CompressionFormat::single_precision.
+       */
+      AlignedVector<float> values_32;
+
+      /**
+       * Storage for the 16-bit formats.
+       */
+      AlignedVector<std::uint16_t> values_16;
+
+      /**
+       * The scaling factors of the blocks in the format
+       * CompressionFormat::block_floating_point.
+       */
+      AlignedVector<Number> block_scaling;
+    };
+  } // namespace distributed
+} // namespace LinearAlgebra
+
+
+
+/* ------------------------- Inline functions ------------------------------ */
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace CompressedVectorImplementation
+  {
+    inline std::uint32_t
+    float_bits(const float value)
+    {
+      std::uint32_t bits;
+      std::memcpy(&bits, &value, sizeof(float));
+      return bits;
+    }
+
+
+
+    inline float
+    bits_to_float(const std::uint32_t bits)
+    {
+      float value;
+      std::memcpy(&value, &bits, sizeof(float));
+      return value;
+    }
+
+
+
+    // Conversion to IEEE half precision with rounding to the nearest
+    // representable number (ties to even)
+    inline std::uint16_t
+    float_to_half(const float value)
+    {
+      const std::uint32_t bits = float_bits(value);
+      const std::uint32_t sign = (bits >> 16) & 0x8000u;
+      const std::uint32_t abs  = bits & 0x7FFFFFFFu;
+
+      // infinity and NaN
+      if (abs >= 0x7F800000u)
+        return sign | 0x7C00u | (abs > 0x7F800000u ? 0x200u : 0u);
+
+      // overflow, starting at the midpoint between the largest half number
+      // 65504 and the next power of two
+      if (abs >= 0x477FF000u)
+        return sign | 0x7C00u;
+
+      // subnormal half numbers below 2^-14, with underflow to zero below
+      // half of the smallest subnormal number 2^-24
+      if (abs < 0x38800000u)
+        {
+          if (abs < 0x33000000u)
+            return sign;
+          const unsigned int  shift     = 126u - (abs >> 23);
+          const std::uint32_t mantissa  = (abs & 0x7FFFFFu) | 0x800000u;
+          std::uint32_t       result    = mantissa >> shift;
+          const std::uint32_t remainder = mantissa & ((1u << shift) - 1u);
+          const std::uint32_t midpoint  = 1u << (shift - 1u);
+          if (remainder > midpoint ||
+              (remainder == midpoint && (result & 1u) != 0u))
+            ++result;
+          return sign | result;
+        }
+
+      // normal numbers: adjust the exponent bias from 127 to 15 and round
+      // the mantissa; a carry into the exponent gives the correct result
+      std::uint32_t       result    = (abs - 0x38000000u) >> 13;
+      const std::uint32_t remainder = abs & 0x1FFFu;
+      if (remainder > 0x1000u || (remainder == 0x1000u && (result & 1u) != 0u))
+        ++result;
+      return sign | result;
+    }
+
+
+
+    inline float
+    half_to_float(const std::uint16_t value)
+    {
+      const std::uint32_t sign     = (value & 0x8000u) << 16;
+      const std::uint32_t exponent = (value >> 10) & 0x1Fu;
+      const std::uint32_t mantissa = value & 0x3FFu;
+
+      if (exponent == 0)
+        {
+          // zero and subnormal numbers, which are mantissa * 2^-24
+          const float result = static_cast<float>(mantissa) * 5.9604645e-8f;
+          return sign != 0u ? -result : result;
+        }
+      else if (exponent == 0x1Fu)
+        return bits_to_float(sign | 0x7F800000u | (mantissa << 13));
+      else
+        return bits_to_float(sign | ((exponent + 112u) << 23) |
+                             (mantissa << 13));
+    }
+
+
+
+    // Conversion to bfloat16, i.e., the upper 16 bits of a float, with
+    // rounding to the nearest representable number (ties to even)
+    inline std::uint16_t
+    float_to_bfloat16(const float value)
+    {
+      const std::uint32_t bits = float_bits(value);
+
+      // keep NaN a (quiet) NaN, which the rounding could turn into infinity
+      if ((bits & 0x7FFFFFFFu) > 0x7F800000u)
+        return (bits >> 16) | 0x40u;
+
+      return (bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16;
+    }
+
+
+
+    inline float
+    bfloat16_to_float(const std::uint16_t value)
+    {
+      return bits_to_float(static_cast<std::uint32_t>(value) << 16);
+    }
+  } // namespace CompressedVectorImplementation
+} // namespace internal
+
+
+
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename Number>
+    inline CompressedVector<Number>::CompressedVector()
+      : partitioner(std::make_shared<Utilities::MPI::Partitioner>())
+      , format(CompressionFormat::single_precision)
+    {}
+
+
+
+    template <typename Number>
+    inline CompressedVector<Number>::CompressedVector(
+      const Vector<Number>   &model,
+      const CompressionFormat format)
+      : CompressedVector()
+    {
+      reinit(model, format);
+    }
+
+
+
+    template <typename Number>
+    inline void
+    CompressedVector<Number>::reinit(const Vector<Number>   &model,
+                                     const CompressionFormat format)
+    {
+      reinit(model.get_partitioner(), format);
+    }
+
+
+
+    template <typename Number>
+    inline void
+    CompressedVector<Number>::reinit(
+      const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+      const CompressionFormat                                   format)
+    {
+      this->partitioner = partitioner;
+      this->format      = format;
+
+      const unsigned int n = partitioner->locally_owned_size();
+      values_32.clear();
+      values_16.clear();
+      block_scaling.clear();
+      if (format == CompressionFormat::single_precision)
+        values_32.resize(n);
+      else
+        values_16.resize(n);
+      if (format == CompressionFormat::block_floating_point)
+        block_scaling.resize((n + block_size - 1) / block_size);
+    }
+
+
+
+    template <typename Number>
+    inline void
+    CompressedVector<Number>::compress_chunk(const unsigned int start,
+                                             const unsigned int n_entries,
+                                             const Number      *values)
+    {
+      using namespace internal::CompressedVectorImplementation;
+      switch (format)
+        {
+          case CompressionFormat::single_precision:
+            for (unsigned int i = 0; i < n_entries; ++i)
+              values_32[start + i] = static_cast<float>(values[i]);
+            break;
+          case CompressionFormat::half_precision:
+            for (unsigned int i = 0; i < n_entries; ++i)
+              values_16[start + i] =
+                float_to_half(static_cast<float>(values[i]));
+            break;
+          case CompressionFormat::bfloat16:
+            for (unsigned int i = 0; i < n_entries; ++i)
+              values_16[start + i] =
+                float_to_bfloat16(static_cast<float>(values[i]));
+            break;
+          case CompressionFormat::block_floating_point:
+            {
+              Number max_value = Number();
+              for (unsigned int i = 0; i < n_entries; ++i)
+                max_value = std::max<Number>(max_value, std::abs(values[i]));
+              block_scaling[start / block_size] = max_value / Number(32767.);
+
+              const Number inverse_scaling =
+                max_value > Number() ? Number(32767.) / max_value : Number();
+              for (unsigned int i = 0; i < n_entries; ++i)
+                values_16[start + i] = static_cast<std::uint16_t>(
+                  static_cast<std::int16_t>(
+                    std::lround(values[i] * inverse_scaling)));
+              break;
+            }
+          default:
+            DEAL_II_NOT_IMPLEMENTED();
+        }
+    }
+
+
+
+    template <typename Number>
+    inline void
+    CompressedVector<Number>::decompress_chunk(const unsigned int start,
+                                               const unsigned int n_entries,
+                                               Number            *values) const
+    {
+      using namespace internal::CompressedVectorImplementation;
+      switch (format)
+        {
+          case CompressionFormat::single_precision:
+            for (unsigned int i = 0; i < n_entries; ++i)
+              values[i] = values_32[start + i];
+            break;
+          case CompressionFormat::half_precision:
+            for (unsigned int i = 0; i < n_entries; ++i)
+              values[i] = half_to_float(values_16[start + i]);
+            break;
+          case CompressionFormat::bfloat16:
+            for (unsigned int i = 0; i < n_entries; ++i)
+              values[i] = bfloat16_to_float(values_16[start + i]);
+            break;
+          case CompressionFormat::block_floating_point:
+            {
+              const Number scaling = block_scaling[start / block_size];
+              for (unsigned int i = 0; i < n_entries; ++i)
+                values[i] =
+                  scaling *
+                  Number(static_cast<std::int16_t>(values_16[start + i]));
+              break;
+            }
+          default:
+            DEAL_II_NOT_IMPLEMENTED();
+        }
+    }
+
+
+
+    template <typename Number>
+    inline void
+    CompressedVector<Number>::store(const Vector<Number> &v)
+    {
+      AssertDimension(v.locally_owned_size(), locally_owned_size());
+      const unsigned int n = locally_owned_size();
+      for (unsigned int start = 0; start < n; start += block_size)
+        compress_chunk(start,
+                       std::min(block_size, n - start),
+                       v.begin() + start);
+    }
+
+
+
+    template <typename Number>
+    inline void
+    CompressedVector<Number>::load(Vector<Number> &v) const
+    {
+      AssertDimension(v.locally_owned_size(), locally_owned_size());
+      const unsigned int n = locally_owned_size();
+      for (unsigned int start = 0; start < n; start += block_size)
+        decompress_chunk(start,
+                         std::min(block_size, n - start),
+                         v.begin() + start);
+    }
+
+
+
+    template <typename Number>
+    inline void
+    CompressedVector<Number>::add_to(Vector<Number> &v,
+                                     const Number    factor) const
+    {
+      AssertDimension(v.locally_owned_size(), locally_owned_size());
+      const unsigned int n = locally_owned_size();
+      Number             values[block_size];
+      Number            *v_ptr = v.begin();
+      for (unsigned int start = 0; start < n; start += block_size)
+        {
+          const unsigned int n_entries = std::min(block_size, n - start);
+          decompress_chunk(start, n_entries, values);
+          for (unsigned int i = 0; i < n_entries; ++i)
+            v_ptr[start + i] += factor * values[i];
+        }
+    }
+
+
+
+    template <typename Number>
+    inline Number
+    CompressedVector<Number>::inner_product(const Vector<Number> &v) const
+    {
+      AssertDimension(v.locally_owned_size(), locally_owned_size());
+      const unsigned int n = locally_owned_size();
+      Number             values[block_size];
+      const Number      *v_ptr = v.begin();
+      Number             sum   = Number();
+      for (unsigned int start = 0; start < n; start += block_size)
+        {
+          const unsigned int n_entries = std::min(block_size, n - start);
+          decompress_chunk(start, n_entries, values);
+          Number local_sum = Number();
+          for (unsigned int i = 0; i < n_entries; ++i)
+            local_sum += values[i] * v_ptr[start + i];
+          sum += local_sum;
+        }
+      return Utilities::MPI::sum(sum, partitioner->get_mpi_communicator());
+    }
+
+
+
+    template <typename Number>
+    inline typename CompressedVector<Number>::size_type
+    CompressedVector<Number>::size() const
+    {
+      return partitioner->size();
+    }
+
+
+
+    template <typename Number>
+    inline unsigned int
+    CompressedVector<Number>::locally_owned_size() const
+    {
+      return partitioner->locally_owned_size();
+    }
+
+
+
+    template <typename Number>
+    inline CompressionFormat
+    CompressedVector<Number>::get_format() const
+    {
+      return format;
+    }
+
+
+
+    template <typename Number>
+    inline const std::shared_ptr<const Utilities::MPI::Partitioner> &
+    CompressedVector<Number>::get_partitioner() const
+    {
+      return partitioner;
+    }
+
+
+
+    template <typename Number>
+    inline std::size_t
+    CompressedVector<Number>::memory_consumption() const
+    {
+      return sizeof(*this) + values_32.memory_consumption() +
+             values_16.memory_consumption() +
+             block_scaling.memory_consumption();
+    }
+  } // namespace distributed
+} // namespace LinearAlgebra
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
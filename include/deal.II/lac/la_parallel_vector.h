@@ -808,6 +808,18 @@ namespace LinearAlgebra
           const Number                       b,
           const Vector<Number, MemorySpace> &W);
 
+      /**
+       * Addition of a linear combination of vectors, i.e. <tt>*this +=
+       * sum_j factors[j]*vectors[j]</tt>. In contrast to repeated calls to
+       * add(), the entries of this vector are loaded from and stored to
+       * memory only once, which reduces the memory traffic of vector updates
+       * involving more than two vectors considerably. This vector itself may
+       * appear in @p vectors.
+       */
+      void
+      add(const ArrayView<const Number>                             &factors,
+          const ArrayView<const Vector<Number, MemorySpace> *const> &vectors);
+
       /**
        * A collective add operation: This function adds a whole set of values
        * stored in @p values to the vector components specified by @p indices.
@@ -839,6 +851,16 @@ namespace LinearAlgebra
       void
       equ(const Number a, const Vector<Number, MemorySpace> &V);
 
+      /**
+       * Assignment of a linear combination of vectors, i.e. <tt>*this =
+       * sum_j factors[j]*vectors[j]</tt>, computed in a single pass through
+       * the vector entries as in the respective add() function. This vector
+       * itself may appear in @p vectors.
+       */
+      void
+      equ(const ArrayView<const Number>                             &factors,
+          const ArrayView<const Vector<Number, MemorySpace> *const> &vectors);
+
       /**
        * Return the l<sub>1</sub> norm of the vector (i.e., the sum of the
        * absolute values of all entries among all processors).
@@ -1317,6 +1339,16 @@ namespace LinearAlgebra
                  const Number                       a,
                  const Vector<Number, MemorySpace> &V);
 
+      /**
+       * Assignment or addition of a linear combination of vectors without MPI
+       * communication, see equ() and add().
+       */
+      void
+      linear_combination_local(
+        const ArrayView<const Number>                             &factors,
+        const ArrayView<const Vector<Number, MemorySpace> *const> &vectors,
+        const bool                                                 add_to_this);
+
       /**
        * Local part of the inner product of two vectors.
        */
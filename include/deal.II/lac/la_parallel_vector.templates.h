@@ -140,6 +140,14 @@ namespace LinearAlgebra
               Kokkos::resize(data.values, new_alloc_size);
 #endif
 
+              // apart from the entries copied from the old allocation, the
+              // memory has not been written to yet, so we can still ask for
+              // huge pages and a NUMA placement
+              Utilities::System::apply_memory_allocation_policy(
+                data.values.data(),
+                new_alloc_size * sizeof(Number),
+                Utilities::System::get_default_memory_allocation_policy());
+
               allocated_size = new_alloc_size;
 
               data.values_sm = {
@@ -1585,6 +1593,76 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpaceType>
+    void
+    Vector<Number, MemorySpaceType>::linear_combination_local(
+      const ArrayView<const Number>                                 &factors,
+      const ArrayView<const Vector<Number, MemorySpaceType> *const> &vectors,
+      const bool add_to_this)
+    {
+      AssertDimension(factors.size(), vectors.size());
+
+      // Collect the vectors to be combined. If this vector is among them,
+      // it has to be the first one with the assignment operation to not
+      // read entries that have already been overwritten.
+      Number              self_factor = add_to_this ? Number(1.) : Number();
+      bool                self_found  = add_to_this;
+      std::vector<Number> combination_factors;
+      std::vector<const ::dealii::MemorySpace::
+                    MemorySpaceData<Number, MemorySpaceType> *>
+        combination_data;
+      combination_factors.reserve(vectors.size() + 1);
+      combination_data.reserve(vectors.size() + 1);
+      combination_factors.push_back(Number());
+      combination_data.push_back(&data);
+      for (unsigned int j = 0; j < vectors.size(); ++j)
+        {
+          AssertIsFinite(factors[j]);
+          Assert(vectors[j] != nullptr, ExcInternalError());
+          AssertDimension(locally_owned_size(),
+                          vectors[j]->locally_owned_size());
+          if (vectors[j] == this)
+            {
+              self_factor += factors[j];
+              self_found = true;
+            }
+          else
+            {
+              combination_factors.push_back(factors[j]);
+              combination_data.push_back(&vectors[j]->data);
+            }
+        }
+
+      const unsigned int offset = self_found ? 0 : 1;
+      combination_factors[0]    = self_factor;
+
+      dealii::internal::VectorOperations::
+        functions<Number, Number, MemorySpaceType>::linear_combination(
+          thread_loop_partitioner,
+          partitioner->locally_owned_size(),
+          combination_factors.size() - offset,
+          combination_factors.data() + offset,
+          combination_data.data() + offset,
+          false,
+          data);
+    }
+
+
+
+    template <typename Number, typename MemorySpaceType>
+    void
+    Vector<Number, MemorySpaceType>::add(
+      const ArrayView<const Number>                                 &factors,
+      const ArrayView<const Vector<Number, MemorySpaceType> *const> &vectors)
+    {
+      linear_combination_local(factors, vectors, true);
+
+      if (vector_is_ghosted)
+        update_ghost_values();
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     void
     Vector<Number, MemorySpaceType>::add(const std::vector<size_type> &indices,
@@ -1731,6 +1809,20 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpaceType>
+    void
+    Vector<Number, MemorySpaceType>::equ(
+      const ArrayView<const Number>                                 &factors,
+      const ArrayView<const Vector<Number, MemorySpaceType> *const> &vectors)
+    {
+      linear_combination_local(factors, vectors, false);
+
+      if (vector_is_ghosted)
+        update_ghost_values();
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     void
     Vector<Number, MemorySpaceType>::extract_subvector_to(
@@ -0,0 +1,274 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_la_parallel_vector_linear_combination_h
+#define dealii_la_parallel_vector_linear_combination_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    /**
+     * A lazily evaluated linear combination of vectors and operator
+     * applications, i.e., an expression of the form
+     * @f[
+     *   \sum_j a_j v_j + \sum_k b_k A_k w_k,
+     * @f]
+     * that is evaluated into a vector of type
+     * LinearAlgebra::distributed::Vector.
+     *
+     * Like PackagedOperation, this class only stores references to the
+     * vectors and operators and evaluates the expression when apply() or
+     * apply_add() is called. In contrast to PackagedOperation, which
+     * performs one pass through memory for each term and allocates
+     * intermediate vectors through GrowingVectorMemory in each application,
+     * the evaluation first applies the operators into temporary vectors that
+     * are kept by this object and reused by subsequent evaluations, and then
+     * combines all vectors in a single loop by Vector::equ() or
+     * Vector::add(). For example, the update $u = a x + b y - c A z$ of a
+     * Krylov solver can be written as
+     * @code
+     * LinearCombination<double> update;
+     * update.add(a, x).add(b, y).add(-c, A, z);
+     * update.apply(u);
+     * @endcode
+     * which passes through the entries of @p u, @p x, @p y, and the result
+     * of $A z$ once instead of three times.
+     *
+     * The same object can be evaluated repeatedly. All changes to the
+     * vectors after the creation of the expression are reflected by the
+     * evaluation, so the vectors and operators need to remain valid for the
+     * lifetime of the terms, i.e., until clear() is called or the object is
+     * destroyed. The destination vector of apply() and apply_add() may also
+     * appear in the expression.
+     *
+     * @ingroup LAOperators
+     */
+    template <typename Number,
+              typename MemorySpace = ::dealii::MemorySpace::Host>
+    class LinearCombination
+    {
+    public:
+      /**
+       * The vector type the expression operates on.
+       */
+      using VectorType = Vector<Number, MemorySpace>;
+
+      /**
+       * Add the term <tt>a*v</tt> to the expression.
+       */
+      LinearCombination &
+      add(const Number a, const VectorType &v);
+
+      /**
+       * Add the term <tt>a*op*v</tt> to the expression. The operator @p op
+       * can be of any type that provides a function
+       * <tt>vmult(VectorType &dst, const VectorType &src)</tt>, such as
+       * matrices and LinearOperator objects. The operator is applied into a
+       * temporary vector laid out like the destination vector of the
+       * evaluation.
+       */
+      template <typename OperatorType>
+      LinearCombination &
+      add(const Number a, const OperatorType &op, const VectorType &v);
+
+      /**
+       * Remove all terms from the expression. The temporary vectors are kept
+       * for reuse by subsequent terms.
+       */
+      void
+      clear();
+
+      /**
+       * Return the number of terms of the expression.
+       */
+      unsigned int
+      n_terms() const;
+
+      /**
+       * Evaluate the expression into @p dst, i.e., <tt>dst = sum of
+       * terms</tt>.
+       */
+      void
+      apply(VectorType &dst) const;
+
+      /**
+       * Add the expression to @p dst, i.e., <tt>dst += sum of terms</tt>.
+       */
+      void
+      apply_add(VectorType &dst) const;
+
+    private:
+      /**
+       * Apply the operators into the temporary vectors and collect the
+       * vectors of all terms in #term_vectors.
+       */
+      void
+      prepare(const VectorType &dst) const;
+
+      /**
+       * The factors of all terms.
+       */
+      std::vector<Number> factors;
+
+      /**
+       * The vectors of all terms. For terms involving an operator, the entry
+       * is a null pointer and replaced by the temporary vector holding the
+       * result of the operator during the evaluation.
+       */
+      std::vector<const VectorType *> vectors;
+
+      /**
+       * The operator applications of the terms, empty for terms without an
+       * operator.
+       */
+      std::vector<std::function<void(VectorType &)>> operator_applications;
+
+      /**
+       * Temporary vectors holding the results of the operator applications,
+       * one for each term involving an operator.
+       */
+      mutable std::vector<std::unique_ptr<VectorType>> temporary_vectors;
+
+      /**
+       * The vectors passed to Vector::equ() and Vector::add().
+       */
+      mutable std::vector<const VectorType *> term_vectors;
+    };
+
+
+
+    /*----------------------- Inline functions ----------------------------*/
+
+#ifndef DOXYGEN
+
+    template <typename Number, typename MemorySpace>
+    inline LinearCombination<Number, MemorySpace> &
+    LinearCombination<Number, MemorySpace>::add(const Number      a,
+                                                const VectorType &v)
+    {
+      factors.push_back(a);
+      vectors.push_back(&v);
+      operator_applications.emplace_back();
+      return *this;
+    }
+
+
+
+    template <typename Number, typename MemorySpace>
+    template <typename OperatorType>
+    inline LinearCombination<Number, MemorySpace> &
+    LinearCombination<Number, MemorySpace>::add(const Number        a,
+                                                const OperatorType &op,
+                                                const VectorType   &v)
+    {
+      factors.push_back(a);
+      vectors.push_back(nullptr);
+      operator_applications.emplace_back(
+        [&op, &v](VectorType &dst) { op.vmult(dst, v); });
+      return *this;
+    }
+
+
+
+    template <typename Number, typename MemorySpace>
+    inline void
+    LinearCombination<Number, MemorySpace>::clear()
+    {
+      factors.clear();
+      vectors.clear();
+      operator_applications.clear();
+    }
+
+
+
+    template <typename Number, typename MemorySpace>
+    inline unsigned int
+    LinearCombination<Number, MemorySpace>::n_terms() const
+    {
+      return factors.size();
+    }
+
+
+
+    template <typename Number, typename MemorySpace>
+    inline void
+    LinearCombination<Number, MemorySpace>::prepare(
+      const VectorType &dst) const
+    {
+      term_vectors.resize(vectors.size());
+      unsigned int n_temporaries = 0;
+      for (unsigned int j = 0; j < vectors.size(); ++j)
+        if (vectors[j] != nullptr)
+          term_vectors[j] = vectors[j];
+        else
+          {
+            if (n_temporaries == temporary_vectors.size())
+              temporary_vectors.push_back(std::make_unique<VectorType>());
+
+            // only reinitialize the temporary vector if the layout changed,
+            // such that repeated evaluations do not allocate memory
+            VectorType &tmp = *temporary_vectors[n_temporaries++];
+            if (tmp.get_partitioner() != dst.get_partitioner())
+              tmp.reinit(dst, true);
+
+            operator_applications[j](tmp);
+            term_vectors[j] = &tmp;
+          }
+    }
+
+
+
+    template <typename Number, typename MemorySpace>
+    inline void
+    LinearCombination<Number, MemorySpace>::apply(VectorType &dst) const
+    {
+      prepare(dst);
+      dst.equ(make_array_view(factors), make_array_view(term_vectors));
+    }
+
+
+
+    template <typename Number, typename MemorySpace>
+    inline void
+    LinearCombination<Number, MemorySpace>::apply_add(VectorType &dst) const
+    {
+      prepare(dst);
+      dst.add(make_array_view(factors), make_array_view(term_vectors));
+    }
+
+#endif
+
+  } // namespace distributed
+} // namespace LinearAlgebra
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -22,6 +22,7 @@
 
 #  include <deal.II/base/enable_observer_pointer.h>
 #  include <deal.II/base/index_set.h>
+#  include <deal.II/base/memory_space.h>
 #  include <deal.II/base/partitioner.h>
 
 #  include <deal.II/lac/exceptions.h>
@@ -33,6 +34,17 @@
 DEAL_II_NAMESPACE_OPEN
 
 
+#  ifndef DOXYGEN
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename Number, typename MemorySpace>
+    class Vector;
+  }
+} // namespace LinearAlgebra
+#  endif
+
 /**
  * @addtogroup PETScWrappers
  * @{
@@ -382,6 +394,35 @@ namespace PETScWrappers
         const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
         const bool make_ghosted = true);
 
+      /**
+       * Initialize the vector such that it does not own its elements but
+       * aliases the memory of the LinearAlgebra::distributed::Vector @p v,
+       * including the ghost elements if the partitioner of @p v has ghost
+       * indices. This allows to hand a vector to PETSc solvers and
+       * preconditioners without copying the data back and forth: all
+       * operations on the present vector act on the elements of @p v and
+       * vice versa.
+       *
+       * The underlying PETSc object is created by VecCreateGhostWithArray()
+       * or, if @p v has no ghost indices, by VecCreateMPIWithArray(). Since
+       * both vector classes store the ghost elements behind the locally owned
+       * ones in the order of Utilities::MPI::Partitioner::ghost_indices(),
+       * the ghost values can be updated from either side, e.g. by
+       * LinearAlgebra::distributed::Vector::update_ghost_values(). A ghosted
+       * view is considered read-only like all ghosted PETSc vectors, see
+       * @ref GlossGhostedVector "vectors with ghost elements".
+       *
+       * The locally owned ranges of @p v need to be ascending and one-to-one
+       * over all processes, see IndexSet::is_ascending_and_one_to_one().
+       *
+       * @note The present vector must not be used after @p v has been
+       * destroyed or reinitialized, since it then refers to released memory.
+       * Copying the present vector creates a vector with its own elements.
+       */
+      void
+      reinit_as_view(
+        LinearAlgebra::distributed::Vector<PetscScalar, MemorySpace::Host> &v);
+
       /**
        * Print to a stream. @p precision denotes the desired precision with
        * which values shall be printed, @p scientific whether scientific
@@ -0,0 +1,551 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_portable_tensor_product_matrix_h
+#define dealii_portable_tensor_product_matrix_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/lac/tensor_product_matrix.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace Portable
+{
+  /**
+   * A device version of dealii::TensorProductMatrixSymmetricSumCollection
+   * for use with Portable::MatrixFree, e.g., to implement additive Schwarz
+   * smoothers based on the fast diagonalization method in GPU multigrid.
+   *
+   * The 1d mass and derivative matrices of each patch are passed to insert()
+   * on the host, where the generalized eigenvalue problems are solved. The
+   * function finalize() then copies the eigenvalues and eigenvectors into
+   * Kokkos views in MemorySpace::Default. The inverse of the tensor product
+   * matrix of a patch can either be applied within a user-defined team
+   * kernel via Data::apply_inverse(), which allows to combine it with the
+   * gathering and scattering of the patch values, or for all patches at once
+   * via apply_inverse().
+   *
+   * In contrast to the host version, the size of the 1d matrices has to be
+   * given at compile time via the template argument @p n_rows_1d, the
+   * matrices are not compressed, and @p Number has to be a scalar type since
+   * the parallelism is provided by the threads of a Kokkos team rather than
+   * by VectorizedArray.
+   */
+  template <int dim, typename Number, int n_rows_1d>
+  class TensorProductMatrixSymmetricSumCollection
+  {
+  public:
+    static_assert(n_rows_1d > 0,
+                  "The size of the 1d matrices has to be known at compile "
+                  "time for the device version.");
+
+    /**
+     * The number of rows and columns of the tensor product matrix of each
+     * patch.
+     */
+    static constexpr unsigned int n_dofs_per_patch =
+      Utilities::pow(n_rows_1d, dim);
+
+    using TeamHandle = Kokkos::TeamPolicy<
+      MemorySpace::Default::kokkos_space::execution_space>::member_type;
+
+    using SharedView =
+      Kokkos::View<Number *,
+                   MemorySpace::Default::kokkos_space::execution_space::
+                     scratch_memory_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+    /**
+     * Structure which is passed to the kernels. It contains the
+     * eigenvalues and eigenvectors of all patches in device memory.
+     */
+    struct Data
+    {
+      /**
+       * Apply the inverse of the tensor product matrix of patch @p index to
+       * @p src and write the result into @p dst within the team kernel of
+       * @p team_member. All threads of the team need to call this function.
+       * The views @p dst, @p src, and @p tmp need to provide
+       * n_dofs_per_patch entries and can, e.g., be subviews of the scratch
+       * memory of the team. The vectors @p dst and @p src must not alias.
+       */
+      template <typename ViewTypeOut, typename ViewTypeIn, typename ViewTypeTmp>
+      DEAL_II_HOST_DEVICE void
+      apply_inverse(const TeamHandle  &team_member,
+                    const unsigned int index,
+                    ViewTypeOut        dst,
+                    const ViewTypeIn   src,
+                    ViewTypeTmp        tmp) const;
+
+      /**
+       * The eigenvectors of the 1d derivative matrices of all patches and
+       * directions, stored as dense matrices of size n_rows_1d times
+       * n_rows_1d with the rows corresponding to the degrees of freedom.
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space> eigenvectors;
+
+      /**
+       * The eigenvalues of the 1d generalized eigenvalue problems of all
+       * patches and directions.
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space> eigenvalues;
+    };
+
+    /**
+     * Allocate the host memory for @p size patches.
+     */
+    void
+    reserve(const unsigned int size);
+
+    /**
+     * For a given @p index, compute the eigenvalues and eigenvectors of the
+     * generalized eigenvalue problems given by the mass matrices @p Ms and
+     * the derivative matrices @p Ks. The same types as for
+     * dealii::TensorProductMatrixSymmetricSumCollection::insert() are
+     * supported.
+     */
+    template <typename T>
+    void
+    insert(const unsigned int index, const T &Ms, const T &Ks);
+
+    /**
+     * Finalize the setup by copying the data to the device and release the
+     * host memory.
+     */
+    void
+    finalize();
+
+    /**
+     * Apply the inverses of all patches, with the values of patch @p p
+     * stored in the row @p p of @p dst and @p src.
+     */
+    void
+    apply_inverse(
+      const Kokkos::View<Number **, MemorySpace::Default::kokkos_space> &dst,
+      const Kokkos::View<const Number **, MemorySpace::Default::kokkos_space>
+        &src) const;
+
+    /**
+     * Return the data structure to be passed to kernels.
+     */
+    const Data &
+    get_data() const;
+
+    /**
+     * Return the number of patches.
+     */
+    unsigned int
+    size() const;
+
+    /**
+     * Return the memory consumption of this class in bytes.
+     */
+    std::size_t
+    memory_consumption() const;
+
+  private:
+    /**
+     * Host copy of the eigenvectors, freed during finalize().
+     */
+    std::vector<Number> eigenvectors_host;
+
+    /**
+     * Host copy of the eigenvalues, freed during finalize().
+     */
+    std::vector<Number> eigenvalues_host;
+
+    /**
+     * The number of patches.
+     */
+    unsigned int n_patches = 0;
+
+    /**
+     * The data on the device.
+     */
+    Data data;
+  };
+
+
+
+  namespace internal
+  {
+    /**
+     * Multiply the 1d matrix @p S, or its transpose if @p transpose is true,
+     * along direction @p direction with the tensor of values @p in and store
+     * the result in @p out.
+     */
+    template <int dim,
+              int n_rows_1d,
+              bool transpose,
+              typename Number,
+              typename ViewTypeIn,
+              typename ViewTypeOut>
+    DEAL_II_HOST_DEVICE void
+    apply_matrix_1d(
+      const Kokkos::TeamPolicy<
+        MemorySpace::Default::kokkos_space::execution_space>::member_type
+                        &team_member,
+      const Number      *S,
+      const unsigned int direction,
+      const ViewTypeIn   in,
+      ViewTypeOut        out)
+    {
+      constexpr int n_dofs = Utilities::pow(n_rows_1d, dim);
+      const int     stride = Utilities::pow(n_rows_1d, direction);
+
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team_member, n_dofs), [&](const int c) {
+          const int i    = (c / stride) % n_rows_1d;
+          const int base = c - i * stride;
+          Number    sum  = 0;
+          for (int k = 0; k < n_rows_1d; ++k)
+            sum += (transpose ? S[k * n_rows_1d + i] : S[i * n_rows_1d + k]) *
+                   in(base + k * stride);
+          out(c) = sum;
+        });
+      team_member.team_barrier();
+    }
+
+
+
+    /**
+     * Divide the values @p values in the eigenbasis by the sums of the 1d
+     * eigenvalues @p eigenvalues.
+     */
+    template <int dim, int n_rows_1d, typename Number, typename ViewType>
+    DEAL_II_HOST_DEVICE void
+    apply_inverse_eigenvalues(
+      const Kokkos::TeamPolicy<
+        MemorySpace::Default::kokkos_space::execution_space>::member_type
+                   &team_member,
+      const Number *eigenvalues,
+      ViewType      values)
+    {
+      constexpr int n_dofs = Utilities::pow(n_rows_1d, dim);
+
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team_member, n_dofs), [&](const int c) {
+          Number lambda = 0;
+          for (int d = 0, stride = 1; d < dim; ++d, stride *= n_rows_1d)
+            lambda += eigenvalues[d * n_rows_1d + (c / stride) % n_rows_1d];
+          values(c) /= lambda;
+        });
+      team_member.team_barrier();
+    }
+
+
+
+    /**
+     * Kernel applying the inverses of all patches of a
+     * TensorProductMatrixSymmetricSumCollection.
+     */
+    template <int dim, typename Number, int n_rows_1d>
+    struct ApplyTensorProductInverseKernel
+    {
+      using CollectionType =
+        TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>;
+
+      ApplyTensorProductInverseKernel(
+        const typename CollectionType::Data                       &data,
+        const Kokkos::View<Number **, MemorySpace::Default::kokkos_space> &dst,
+        const Kokkos::View<const Number **,
+                           MemorySpace::Default::kokkos_space>    &src)
+        : data(data)
+        , dst(dst)
+        , src(src)
+      {}
+
+      const typename CollectionType::Data                       data;
+      const Kokkos::View<Number **, MemorySpace::Default::kokkos_space> dst;
+      const Kokkos::View<const Number **, MemorySpace::Default::kokkos_space>
+        src;
+
+      // Provide the shared memory capacity. This function takes the team_size
+      // as an argument, which allows team_size dependent allocations.
+      size_t
+      team_shmem_size(int /*team_size*/) const
+      {
+        return CollectionType::SharedView::shmem_size(
+          CollectionType::n_dofs_per_patch);
+      }
+
+      DEAL_II_HOST_DEVICE
+      void
+      operator()(const typename CollectionType::TeamHandle &team_member) const
+      {
+        const int                            patch = team_member.league_rank();
+        typename CollectionType::SharedView tmp(
+          team_member.team_shmem(), CollectionType::n_dofs_per_patch);
+
+        data.apply_inverse(team_member,
+                           patch,
+                           Kokkos::subview(dst, patch, Kokkos::ALL),
+                           Kokkos::subview(src, patch, Kokkos::ALL),
+                           tmp);
+      }
+    };
+  } // namespace internal
+
+
+
+  /*----------------------- Inline functions -------------------------------*/
+
+#ifndef DOXYGEN
+
+  template <int dim, typename Number, int n_rows_1d>
+  template <typename ViewTypeOut, typename ViewTypeIn, typename ViewTypeTmp>
+  DEAL_II_HOST_DEVICE void
+  TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::Data::
+    apply_inverse(const TeamHandle  &team_member,
+                  const unsigned int index,
+                  ViewTypeOut        dst,
+                  const ViewTypeIn   src,
+                  ViewTypeTmp        tmp) const
+  {
+    constexpr unsigned int nn = n_rows_1d * n_rows_1d;
+
+    const Number *S      = eigenvectors.data() + index * dim * nn;
+    const Number *lambda = eigenvalues.data() + index * dim * n_rows_1d;
+
+    // Transform into the eigenbasis, divide by the eigenvalues, and
+    // transform back, alternating between tmp and dst such that the result
+    // ends up in dst. This is the same sequence of operations as in
+    // dealii::internal::TensorProductMatrixSymmetricSum::apply_inverse().
+    if constexpr (dim == 1)
+      {
+        internal::apply_matrix_1d<dim, n_rows_1d, true>(
+          team_member, S, 0, src, tmp);
+        internal::apply_inverse_eigenvalues<dim, n_rows_1d>(team_member,
+                                                            lambda,
+                                                            tmp);
+        internal::apply_matrix_1d<dim, n_rows_1d, false>(
+          team_member, S, 0, tmp, dst);
+      }
+    else if constexpr (dim == 2)
+      {
+        internal::apply_matrix_1d<dim, n_rows_1d, true>(
+          team_member, S, 0, src, tmp);
+        internal::apply_matrix_1d<dim, n_rows_1d, true>(
+          team_member, S + nn, 1, tmp, dst);
+        internal::apply_inverse_eigenvalues<dim, n_rows_1d>(team_member,
+                                                            lambda,
+                                                            dst);
+        internal::apply_matrix_1d<dim, n_rows_1d, false>(
+          team_member, S + nn, 1, dst, tmp);
+        internal::apply_matrix_1d<dim, n_rows_1d, false>(
+          team_member, S, 0, tmp, dst);
+      }
+    else if constexpr (dim == 3)
+      {
+        internal::apply_matrix_1d<dim, n_rows_1d, true>(
+          team_member, S, 0, src, tmp);
+        internal::apply_matrix_1d<dim, n_rows_1d, true>(
+          team_member, S + nn, 1, tmp, dst);
+        internal::apply_matrix_1d<dim, n_rows_1d, true>(
+          team_member, S + 2 * nn, 2, dst, tmp);
+        internal::apply_inverse_eigenvalues<dim, n_rows_1d>(team_member,
+                                                            lambda,
+                                                            tmp);
+        internal::apply_matrix_1d<dim, n_rows_1d, false>(
+          team_member, S + 2 * nn, 2, tmp, dst);
+        internal::apply_matrix_1d<dim, n_rows_1d, false>(
+          team_member, S + nn, 1, dst, tmp);
+        internal::apply_matrix_1d<dim, n_rows_1d, false>(
+          team_member, S, 0, tmp, dst);
+      }
+    else
+      Kokkos::abort("Dimension not implemented.");
+  }
+
+
+
+  template <int dim, typename Number, int n_rows_1d>
+  inline void
+  TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::reserve(
+    const unsigned int size)
+  {
+    n_patches = size;
+    eigenvectors_host.assign(static_cast<std::size_t>(size) * dim *
+                               n_rows_1d * n_rows_1d,
+                             Number());
+    eigenvalues_host.assign(static_cast<std::size_t>(size) * dim * n_rows_1d,
+                            Number());
+  }
+
+
+
+  template <int dim, typename Number, int n_rows_1d>
+  template <typename T>
+  inline void
+  TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::insert(
+    const unsigned int index,
+    const T           &Ms_in,
+    const T           &Ks_in)
+  {
+    AssertIndexRange(index, n_patches);
+    Assert(eigenvectors_host.size() > 0,
+           ExcMessage("insert() must not be called after finalize()."));
+
+    const auto Ms =
+      dealii::internal::TensorProductMatrixSymmetricSum::convert<dim>(Ms_in);
+    const auto Ks =
+      dealii::internal::TensorProductMatrixSymmetricSum::convert<dim>(Ks_in);
+
+    for (unsigned int d = 0; d < dim; ++d)
+      {
+        AssertDimension(Ms[d].n_rows(), n_rows_1d);
+        AssertDimension(Ms[d].n_cols(), n_rows_1d);
+      }
+
+    std::array<Table<2, Number>, dim>      eigenvectors;
+    std::array<AlignedVector<Number>, dim> eigenvalues;
+    dealii::internal::TensorProductMatrixSymmetricSum::setup(Ms,
+                                                             Ks,
+                                                             eigenvectors,
+                                                             eigenvalues);
+
+    for (unsigned int d = 0; d < dim; ++d)
+      for (unsigned int i = 0,
+                        m = (index * dim + d) * n_rows_1d * n_rows_1d,
+                        v = (index * dim + d) * n_rows_1d;
+           i < n_rows_1d;
+           ++i, ++v)
+        {
+          for (unsigned int j = 0; j < n_rows_1d; ++j, ++m)
+            eigenvectors_host[m] = eigenvectors[d][i][j];
+          eigenvalues_host[v] = eigenvalues[d][i];
+        }
+  }
+
+
+
+  template <int dim, typename Number, int n_rows_1d>
+  inline void
+  TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::finalize()
+  {
+    data.eigenvectors =
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>(
+        Kokkos::view_alloc("eigenvectors", Kokkos::WithoutInitializing),
+        eigenvectors_host.size());
+    data.eigenvalues =
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>(
+        Kokkos::view_alloc("eigenvalues", Kokkos::WithoutInitializing),
+        eigenvalues_host.size());
+
+    Kokkos::deep_copy(
+      data.eigenvectors,
+      Kokkos::View<Number *, Kokkos::HostSpace>(eigenvectors_host.data(),
+                                                eigenvectors_host.size()));
+    Kokkos::deep_copy(
+      data.eigenvalues,
+      Kokkos::View<Number *, Kokkos::HostSpace>(eigenvalues_host.data(),
+                                                eigenvalues_host.size()));
+
+    eigenvectors_host.clear();
+    eigenvectors_host.shrink_to_fit();
+    eigenvalues_host.clear();
+    eigenvalues_host.shrink_to_fit();
+  }
+
+
+
+  template <int dim, typename Number, int n_rows_1d>
+  inline void
+  TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::
+    apply_inverse(
+      const Kokkos::View<Number **, MemorySpace::Default::kokkos_space> &dst,
+      const Kokkos::View<const Number **, MemorySpace::Default::kokkos_space>
+        &src) const
+  {
+    AssertDimension(dst.extent(0), n_patches);
+    AssertDimension(src.extent(0), n_patches);
+    AssertDimension(dst.extent(1), n_dofs_per_patch);
+    AssertDimension(src.extent(1), n_dofs_per_patch);
+
+    if (n_patches == 0)
+      return;
+
+    MemorySpace::Default::kokkos_space::execution_space exec;
+    Kokkos::TeamPolicy<MemorySpace::Default::kokkos_space::execution_space>
+      team_policy(
+#  if KOKKOS_VERSION >= 20900
+        exec,
+#  endif
+        n_patches,
+        Kokkos::AUTO);
+
+    internal::ApplyTensorProductInverseKernel<dim, Number, n_rows_1d>
+      apply_kernel(data, dst, src);
+
+    Kokkos::parallel_for(
+      "dealii::TensorProductMatrixSymmetricSumCollection::apply_inverse",
+      team_policy,
+      apply_kernel);
+  }
+
+
+
+  template <int dim, typename Number, int n_rows_1d>
+  inline const typename TensorProductMatrixSymmetricSumCollection<dim,
+                                                                  Number,
+                                                                  n_rows_1d>::
+    Data &
+    TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::
+      get_data() const
+  {
+    return data;
+  }
+
+
+
+  template <int dim, typename Number, int n_rows_1d>
+  inline unsigned int
+  TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::size()
+    const
+  {
+    return n_patches;
+  }
+
+
+
+  template <int dim, typename Number, int n_rows_1d>
+  inline std::size_t
+  TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::
+    memory_consumption() const
+  {
+    return sizeof(*this) +
+           (eigenvectors_host.capacity() + eigenvalues_host.capacity() +
+            data.eigenvectors.extent(0) + data.eigenvalues.extent(0)) *
+             sizeof(Number);
+  }
+
+#endif
+
+} // namespace Portable
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -17,6 +17,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/instrumentation_region.h>
 #include <deal.II/base/memory_space.h>
 #include <deal.II/base/mutex.h>
 #include <deal.II/base/observer_pointer.h>
@@ -1982,7 +1983,12 @@ public:
  *
  * Due to the cost of the eigenvalue estimate, this class is most appropriate
  * if it is applied repeatedly, e.g. in a smoother for a geometric multigrid
- * solver, that can in turn be used to solve several linear systems.
+ * solver, that can in turn be used to solve several linear systems. If the
+ * preconditioner is re-initialized for a sequence of slowly changing
+ * matrices, such as in a Newton method or in time stepping, the estimate of
+ * the previous setup can be validated by a few power iterations instead of
+ * estimating the eigenvalues from scratch, see
+ * PreconditionChebyshev::AdditionalData::eigenvalue_validation_n_iterations.
  *
  * <h4>Bypassing the eigenvalue computation</h4>
  *
@@ -2155,6 +2161,37 @@ public:
      * Specifies the polynomial type to be used.
      */
     PolynomialType polynomial_type;
+
+    /**
+     * Number of power iterations used to validate the eigenvalue estimate
+     * of a previous setup when initialize() is called again, e.g. in every
+     * step of a Newton method or a time stepping scheme with slowly varying
+     * coefficients. If set to zero (the default), the eigenvalues are
+     * estimated from scratch after every call to initialize().
+     *
+     * Otherwise, and if the size of the vectors is unchanged, the power
+     * iteration is started from the approximation of the eigenvector of the
+     * largest eigenvalue kept from the previous setup. If the resulting
+     * estimate is below the previous upper bound of the largest eigenvalue
+     * (including the safety factor) and not smaller than the previous
+     * estimate (without the safety factor) by more than
+     * eigenvalue_validation_tolerance, the previous bounds are reused and
+     * only the given number of iterations is spent. Otherwise, the
+     * eigenvalues are estimated with the eigenvalue algorithm as usual. Note
+     * that only the largest eigenvalue is validated, so the smallest
+     * eigenvalue estimate is reused as well, which matters only for a
+     * smoothing range less than one.
+     *
+     * This setting has no effect if eig_cg_n_iterations is zero.
+     */
+    unsigned int eigenvalue_validation_n_iterations;
+
+    /**
+     * Relative tolerance of the decrease of the largest eigenvalue compared
+     * to the previous estimate that is accepted by the validation with
+     * eigenvalue_validation_n_iterations.
+     */
+    double eigenvalue_validation_tolerance;
   };
 
 
@@ -2288,6 +2325,20 @@ private:
    */
   bool eigenvalues_are_initialized;
 
+  /**
+   * The eigenvalue information of the most recent estimate, which is kept
+   * across calls to initialize() for
+   * AdditionalData::eigenvalue_validation_n_iterations.
+   */
+  mutable EigenvalueInformation previous_eigenvalue_information;
+
+  /**
+   * An approximation of the eigenvector of the largest eigenvalue, used as
+   * start vector of the validation with
+   * AdditionalData::eigenvalue_validation_n_iterations.
+   */
+  mutable VectorType dominant_eigenvector;
+
   /**
    * A mutex to avoid that multiple vmult() invocations by different threads
    * overwrite the temporary vectors.
@@ -3466,6 +3517,73 @@ namespace internal
         }
     }
 
+    // selection for diagonal matrix around parallel deal.II vector in the
+    // default memory space: same updates as in VectorUpdater, but run as a
+    // single kernel on the device
+    template <typename Number>
+    inline void
+    vector_updates(
+      const LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>
+        &rhs,
+      const dealii::DiagonalMatrix<
+        LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>>
+                        &jacobi,
+      const unsigned int iteration_index,
+      const double       factor1_,
+      const double       factor2_,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>
+        &solution_old,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>
+        &temp_vector1,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default> &,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>
+        &solution)
+    {
+      const Number factor1        = factor1_;
+      const Number factor1_plus_1 = 1. + factor1_;
+      const Number factor2        = factor2_;
+
+      const Number *rhs_ptr          = rhs.get_values();
+      const Number *diagonal_ptr     = jacobi.get_vector().get_values();
+      Number       *solution_old_ptr = solution_old.get_values();
+      Number       *tmp_ptr          = temp_vector1.get_values();
+      Number       *solution_ptr     = solution.get_values();
+
+      Kokkos::RangePolicy<MemorySpace::Default::kokkos_space::execution_space,
+                          Kokkos::IndexType<types::global_dof_index>>
+        policy(0, rhs.locally_owned_size());
+      if (iteration_index == 0)
+        Kokkos::parallel_for(
+          "dealii::PreconditionChebyshev::vector_updates_0",
+          policy,
+          KOKKOS_LAMBDA(types::global_dof_index i) {
+            solution_ptr[i] = factor2 * diagonal_ptr[i] * rhs_ptr[i];
+          });
+      else if (iteration_index == 1)
+        Kokkos::parallel_for(
+          "dealii::PreconditionChebyshev::vector_updates_1",
+          policy,
+          KOKKOS_LAMBDA(types::global_dof_index i) {
+            tmp_ptr[i] = factor1_plus_1 * solution_ptr[i] +
+                         factor2 * diagonal_ptr[i] * (rhs_ptr[i] - tmp_ptr[i]);
+          });
+      else
+        Kokkos::parallel_for(
+          "dealii::PreconditionChebyshev::vector_updates",
+          policy,
+          KOKKOS_LAMBDA(types::global_dof_index i) {
+            tmp_ptr[i] = factor1_plus_1 * solution_ptr[i] -
+                         factor1 * solution_old_ptr[i] +
+                         factor2 * diagonal_ptr[i] * (rhs_ptr[i] - tmp_ptr[i]);
+          });
+
+      if (iteration_index > 0)
+        {
+          solution.swap(temp_vector1);
+          solution_old.swap(temp_vector1);
+        }
+    }
+
     // We need to have a separate declaration for static const members
 
     // general case and the case that the preconditioner can work on
@@ -3747,6 +3865,8 @@ inline PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
       eigenvalue_algorithm)
   , degree(degree)
   , polynomial_type(polynomial_type)
+  , eigenvalue_validation_n_iterations(0)
+  , eigenvalue_validation_tolerance(0.2)
 {}
 
 
@@ -3794,7 +3914,9 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::clear()
     solution_old.reinit(empty_vector);
     temp_vector1.reinit(empty_vector);
     temp_vector2.reinit(empty_vector);
+    dominant_eigenvector.reinit(empty_vector);
   }
+  previous_eigenvalue_information = EigenvalueInformation();
   data.preconditioner.reset();
 }
 
@@ -3810,8 +3932,55 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   solution_old.reinit(src);
   temp_vector1.reinit(src, true);
 
-  auto info = internal::estimate_eigenvalues<MatrixType>(
-    data, matrix_ptr, solution_old, temp_vector1, data.degree);
+  // check whether the bounds of a previous setup are still valid by a few
+  // steps of the power iteration, started from the previous approximation
+  // of the dominant eigenvector
+  const bool has_previous_estimate =
+    data.eig_cg_n_iterations > 0 &&
+    previous_eigenvalue_information.max_eigenvalue_estimate > 0. &&
+    dominant_eigenvector.size() == src.size();
+  bool reuse_previous_estimate = false;
+  if (data.eigenvalue_validation_n_iterations > 0 && has_previous_estimate)
+    {
+      data.constraints.set_zero(dominant_eigenvector);
+      const double eigenvalue_estimate =
+        internal::power_iteration(*matrix_ptr,
+                                  dominant_eigenvector,
+                                  *data.preconditioner,
+                                  data.eigenvalue_validation_n_iterations);
+      const double previous_max =
+        previous_eigenvalue_information.max_eigenvalue_estimate;
+      reuse_previous_estimate =
+        eigenvalue_estimate <= previous_max &&
+        eigenvalue_estimate >=
+          (1. - data.eigenvalue_validation_tolerance) * previous_max / 1.2;
+    }
+
+  internal::EigenvalueInformation info;
+  if (reuse_previous_estimate)
+    {
+      info               = previous_eigenvalue_information;
+      info.cg_iterations = 0;
+    }
+  else
+    {
+      info = internal::estimate_eigenvalues<MatrixType>(
+        data, matrix_ptr, solution_old, temp_vector1, data.degree);
+
+      // keep the start vector of the power iteration for later validations.
+      // In case of the Lanczos algorithm, a start vector refined by a
+      // previous validation is a better choice than the initial guess.
+      if (data.eigenvalue_validation_n_iterations > 0 &&
+          data.eig_cg_n_iterations > 0 &&
+          (data.eigenvalue_algorithm ==
+             internal::EigenvalueAlgorithm::power_iteration ||
+           has_previous_estimate == false))
+        {
+          dominant_eigenvector.reinit(src, true);
+          dominant_eigenvector = temp_vector1;
+        }
+      previous_eigenvalue_information = info;
+    }
 
   const double alpha = (data.smoothing_range > 1. ?
                           info.max_eigenvalue_estimate / data.smoothing_range :
@@ -3856,13 +4025,13 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   if (std::is_same_v<PreconditionerType, dealii::DiagonalMatrix<VectorType>> ==
         false ||
       (std::is_same_v<VectorType, dealii::Vector<NumberType>> == false &&
-       ((std::is_same_v<
-           VectorType,
-           LinearAlgebra::distributed::Vector<NumberType, MemorySpace::Host>> ==
-         false) ||
-        (std::is_same_v<VectorType,
-                        LinearAlgebra::distributed::
-                          Vector<NumberType, MemorySpace::Default>> == false))))
+       std::is_same_v<
+         VectorType,
+         LinearAlgebra::distributed::Vector<NumberType, MemorySpace::Host>> ==
+         false &&
+       std::is_same_v<VectorType,
+                      LinearAlgebra::distributed::
+                        Vector<NumberType, MemorySpace::Default>> == false))
     temp_vector2.reinit(src, true);
   else
     {
@@ -3885,6 +4054,8 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::vmult(
   VectorType       &solution,
   const VectorType &rhs) const
 {
+  InstrumentationRegion instrumentation_region("PreconditionChebyshev::vmult");
+
   std::lock_guard<std::mutex> lock(mutex);
   if (eigenvalues_are_initialized == false)
     estimate_eigenvalues(rhs);
@@ -4010,6 +4181,8 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::step(
   VectorType       &solution,
   const VectorType &rhs) const
 {
+  InstrumentationRegion instrumentation_region("PreconditionChebyshev::step");
+
   std::lock_guard<std::mutex> lock(mutex);
   if (eigenvalues_are_initialized == false)
     estimate_eigenvalues(rhs);
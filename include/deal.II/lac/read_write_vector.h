@@ -313,6 +313,13 @@ namespace LinearAlgebra
      * current vector or replace the current elements. The last parameter can
      * be used if the same communication pattern is used multiple times. This
      * can be used to improve performance.
+     *
+     * If no communication pattern is given and all elements of the current
+     * vector are either locally owned or ghost elements of @p vec, the
+     * Utilities::MPI::Partitioner of @p vec is used, which needs no setup.
+     * Otherwise, a new partitioner is created the first time this function is
+     * called, and stored for subsequent imports from vectors with the same
+     * locally owned elements, until the current vector is reinitialized.
      */
     template <typename MemorySpace>
     void
@@ -743,7 +750,7 @@ namespace LinearAlgebra
      * use.
      */
     template <typename MemorySpace = dealii::MemorySpace::Host>
-    TpetraWrappers::CommunicationPattern<MemorySpace>
+    std::shared_ptr<const TpetraWrappers::CommunicationPattern<MemorySpace>>
     create_tpetra_comm_pattern(const IndexSet &source_index_set,
                                const MPI_Comm  mpi_comm);
 #  endif
@@ -752,7 +759,7 @@ namespace LinearAlgebra
      * Return a EpetraWrappers::CommunicationPattern and store it for future
      * use.
      */
-    EpetraWrappers::CommunicationPattern
+    std::shared_ptr<const EpetraWrappers::CommunicationPattern>
     create_epetra_comm_pattern(const IndexSet &source_index_set,
                                const MPI_Comm  mpi_comm);
 #endif
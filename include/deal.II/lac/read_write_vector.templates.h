@@ -414,29 +414,65 @@ namespace LinearAlgebra
     const std::shared_ptr<const Utilities::MPI::CommunicationPatternBase>
       &communication_pattern)
   {
-    // If no communication pattern is given, create one. Otherwise, use the
-    // given one.
-    std::shared_ptr<const Utilities::MPI::Partitioner> comm_pattern;
+    // If no communication pattern is given, find a suitable one. Otherwise,
+    // use the given one.
+    std::shared_ptr<const Utilities::MPI::Partitioner> partitioner;
     if (communication_pattern.get() == nullptr)
       {
-        comm_pattern = std::make_shared<Utilities::MPI::Partitioner>(
-          vec.locally_owned_elements(),
-          get_stored_elements(),
-          vec.get_mpi_communicator());
+        const std::shared_ptr<const Utilities::MPI::Partitioner>
+                       &vec_partitioner = vec.get_partitioner();
+        const IndexSet &source_elements =
+          vec_partitioner->locally_owned_range();
+
+        // The partitioner of the source vector can be used directly if all
+        // elements of the current vector are either locally owned or ghost
+        // elements of the source vector, which does not need any setup.
+        IndexSet non_owned_elements = stored_elements;
+        non_owned_elements.subtract_set(source_elements);
+        if (non_owned_elements.is_subset_of(vec_partitioner->ghost_indices()))
+          partitioner = vec_partitioner;
+
+        // Otherwise, check if the communication pattern of the last import
+        // can be reused.
+        else if ((source_elements.size() == source_stored_elements.size()) &&
+                 (source_elements == source_stored_elements))
+          {
+            partitioner =
+              std::dynamic_pointer_cast<const Utilities::MPI::Partitioner>(
+                comm_pattern);
+            if (partitioner != nullptr &&
+                partitioner->get_mpi_communicator() !=
+                  vec.get_mpi_communicator())
+              partitioner.reset();
+          }
+
+        // Else, create a new communication pattern and store it for future
+        // use, since its setup involves global communication.
+        if (partitioner == nullptr)
+          {
+            source_stored_elements = source_elements;
+            const std::shared_ptr<Utilities::MPI::Partitioner>
+              new_partitioner = std::make_shared<Utilities::MPI::Partitioner>(
+                source_stored_elements,
+                stored_elements,
+                vec.get_mpi_communicator());
+            comm_pattern = new_partitioner;
+            partitioner  = new_partitioner;
+          }
       }
     else
       {
-        comm_pattern =
+        partitioner =
           std::dynamic_pointer_cast<const Utilities::MPI::Partitioner>(
             communication_pattern);
-        AssertThrow(comm_pattern != nullptr,
+        AssertThrow(partitioner != nullptr,
                     ExcMessage("The communication pattern is not of type "
                                "Utilities::MPI::Partitioner."));
       }
 
 
     internal::read_write_vector_functions<Number, MemorySpace>::import_elements(
-      comm_pattern, vec.begin(), operation, *this);
+      partitioner, vec.begin(), operation, *this);
   }
 
 
@@ -539,15 +575,13 @@ namespace LinearAlgebra
               const TpetraWrappers::CommunicationPattern<MemorySpace>>(
               comm_pattern);
             if (tpetra_comm_pattern == nullptr)
-              tpetra_comm_pattern = std::make_shared<
-                const TpetraWrappers::CommunicationPattern<MemorySpace>>(
+              tpetra_comm_pattern =
                 create_tpetra_comm_pattern<MemorySpace>(source_elements,
-                                                        mpi_comm));
+                                                        mpi_comm);
           }
         else
-          tpetra_comm_pattern = std::make_shared<
-            const TpetraWrappers::CommunicationPattern<MemorySpace>>(
-            create_tpetra_comm_pattern<MemorySpace>(source_elements, mpi_comm));
+          tpetra_comm_pattern =
+            create_tpetra_comm_pattern<MemorySpace>(source_elements, mpi_comm);
       }
     else
       {
@@ -671,13 +705,11 @@ namespace LinearAlgebra
               const EpetraWrappers::CommunicationPattern>(comm_pattern);
             if (epetra_comm_pattern == nullptr)
               epetra_comm_pattern =
-                std::make_shared<const EpetraWrappers::CommunicationPattern>(
-                  create_epetra_comm_pattern(source_elements, mpi_comm));
+                create_epetra_comm_pattern(source_elements, mpi_comm);
           }
         else
           epetra_comm_pattern =
-            std::make_shared<const EpetraWrappers::CommunicationPattern>(
-              create_epetra_comm_pattern(source_elements, mpi_comm));
+            create_epetra_comm_pattern(source_elements, mpi_comm);
       }
     else
       {
@@ -906,17 +938,16 @@ namespace LinearAlgebra
 #  ifdef DEAL_II_TRILINOS_WITH_TPETRA
   template <typename Number>
   template <typename MemorySpace>
-  TpetraWrappers::CommunicationPattern<MemorySpace>
+  std::shared_ptr<const TpetraWrappers::CommunicationPattern<MemorySpace>>
   ReadWriteVector<Number>::create_tpetra_comm_pattern(
     const IndexSet &source_index_set,
     const MPI_Comm  mpi_comm)
   {
     source_stored_elements = source_index_set;
-    TpetraWrappers::CommunicationPattern<MemorySpace> tpetra_comm_pattern(
-      source_stored_elements, stored_elements, mpi_comm);
-    comm_pattern =
+    const auto tpetra_comm_pattern =
       std::make_shared<TpetraWrappers::CommunicationPattern<MemorySpace>>(
         source_stored_elements, stored_elements, mpi_comm);
+    comm_pattern = tpetra_comm_pattern;
 
     return tpetra_comm_pattern;
   }
@@ -925,16 +956,16 @@ namespace LinearAlgebra
 
 
   template <typename Number>
-  EpetraWrappers::CommunicationPattern
+  std::shared_ptr<const EpetraWrappers::CommunicationPattern>
   ReadWriteVector<Number>::create_epetra_comm_pattern(
     const IndexSet &source_index_set,
     const MPI_Comm  mpi_comm)
   {
     source_stored_elements = source_index_set;
-    EpetraWrappers::CommunicationPattern epetra_comm_pattern(
-      source_stored_elements, stored_elements, mpi_comm);
-    comm_pattern = std::make_shared<EpetraWrappers::CommunicationPattern>(
-      source_stored_elements, stored_elements, mpi_comm);
+    const auto epetra_comm_pattern =
+      std::make_shared<EpetraWrappers::CommunicationPattern>(
+        source_stored_elements, stored_elements, mpi_comm);
+    comm_pattern = epetra_comm_pattern;
 
     return epetra_comm_pattern;
   }
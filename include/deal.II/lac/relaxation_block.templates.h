@@ -22,6 +22,8 @@
 #include <deal.II/lac/trilinos_vector.h>
 #include <deal.II/lac/vector_memory.h>
 
+#include <map>
+
 DEAL_II_NAMESPACE_OPEN
 
 template <typename MatrixType, typename InverseNumberType, typename VectorType>
@@ -83,6 +85,10 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::clear()
 {
   A               = nullptr;
   additional_data = nullptr;
+  batch_blocks.clear();
+  batch_starts.clear();
+  batch_block_sizes.clear();
+  batched_inverses.clear();
   PreconditionBlockBase<InverseNumberType>::clear();
 }
 
@@ -107,6 +113,77 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::invert_diagblocks()
         16);
     }
   this->inverses_computed(true);
+
+  if (this->additional_data->vectorize_blocks)
+    compute_batched_inverses();
+}
+
+
+
+template <typename MatrixType, typename InverseNumberType, typename VectorType>
+inline void
+RelaxationBlock<MatrixType, InverseNumberType, VectorType>::
+  compute_batched_inverses()
+{
+  using VectorizedArrayType       = VectorizedArray<InverseNumberType>;
+  constexpr unsigned int n_lanes  = VectorizedArrayType::size();
+  const SparsityPattern &block_list = this->additional_data->block_list;
+
+  // sort the blocks by their size, keeping the original order within each
+  // size, and count the number of batches and entries needed
+  std::map<unsigned int, std::vector<size_type>> blocks_by_size;
+  for (size_type block = 0; block < block_list.n_rows(); ++block)
+    if (block_list.row_length(block) > 0)
+      blocks_by_size[block_list.row_length(block)].push_back(block);
+
+  batch_blocks.clear();
+  batch_block_sizes.clear();
+  batch_starts.assign(1, 0);
+  for (const auto &[bs, blocks] : blocks_by_size)
+    for (std::size_t b = 0; b < blocks.size(); b += n_lanes)
+      {
+        for (unsigned int v = 0; v < n_lanes; ++v)
+          batch_blocks.push_back(b + v < blocks.size() ?
+                                   blocks[b + v] :
+                                   numbers::invalid_size_type);
+        batch_block_sizes.push_back(bs);
+        batch_starts.push_back(batch_starts.back() +
+                               static_cast<std::size_t>(bs) * bs);
+      }
+
+  // compute the explicit inverses column by column by applying the
+  // inverses to unit vectors, which works for all inversion methods
+  batched_inverses.resize_fast(batch_starts.back());
+  parallel::apply_to_subranges(
+    0,
+    batch_block_sizes.size(),
+    [this](const std::size_t batch_begin, const std::size_t batch_end) {
+      Vector<typename VectorType::value_type> unit, column;
+      for (std::size_t batch = batch_begin; batch < batch_end; ++batch)
+        {
+          const unsigned int   bs      = batch_block_sizes[batch];
+          VectorizedArrayType *inverse = &batched_inverses[batch_starts[batch]];
+          unit.reinit(bs);
+          column.reinit(bs);
+          for (unsigned int i = 0; i < bs * bs; ++i)
+            inverse[i] = InverseNumberType();
+          for (unsigned int v = 0; v < n_lanes; ++v)
+            {
+              const size_type block = batch_blocks[batch * n_lanes + v];
+              if (block == numbers::invalid_size_type)
+                continue;
+              for (unsigned int j = 0; j < bs; ++j)
+                {
+                  unit    = 0;
+                  unit(j) = 1;
+                  this->inverse_vmult(block, column, unit);
+                  for (unsigned int i = 0; i < bs; ++i)
+                    inverse[i * bs + j][v] = column(i);
+                }
+            }
+        }
+    },
+    16);
 }
 
 
@@ -223,6 +300,14 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_step(
 {
   Assert(additional_data->invert_diagonal, ExcNotImplemented());
 
+  // the batched inverses can only be used if all blocks are independent of
+  // each other, i.e., for the Jacobi method
+  if (!batched_inverses.empty() && &dst != &prev)
+    {
+      do_batched_step(dst, prev, src);
+      return;
+    }
+
   const VectorType &ghosted_prev =
     internal::prepare_ghost_vector(prev, additional_data->temp_ghost_vector);
 
@@ -286,6 +371,93 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_step(
 }
 
 
+
+template <typename MatrixType, typename InverseNumberType, typename VectorType>
+inline void
+RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_batched_step(
+  VectorType       &dst,
+  const VectorType &prev,
+  const VectorType &src) const
+{
+  using VectorizedArrayType      = VectorizedArray<InverseNumberType>;
+  constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  const VectorType &ghosted_prev =
+    internal::prepare_ghost_vector(prev, additional_data->temp_ghost_vector);
+
+  const MatrixType      &M          = *this->A;
+  const SparsityPattern &block_list = additional_data->block_list;
+
+  if (!additional_data->order.empty())
+    for (unsigned int i = 0; i < additional_data->order.size(); ++i)
+      AssertDimension(additional_data->order[i].size(), this->size());
+
+  // the order of the blocks does not matter for the Jacobi method, but each
+  // permutation contributes one update of all blocks
+  const unsigned int n_permutations =
+    additional_data->order.empty() ? 1U : additional_data->order.size();
+
+  AlignedVector<VectorizedArrayType> b_cell, x_cell;
+  for (unsigned int perm = 0; perm < n_permutations; ++perm)
+    for (std::size_t batch = 0; batch < batch_block_sizes.size(); ++batch)
+      {
+        const unsigned int bs = batch_block_sizes[batch];
+        b_cell.resize_fast(bs);
+        x_cell.resize_fast(bs);
+
+        // Collect off-diagonal parts of all blocks of the batch
+        for (unsigned int v = 0; v < n_lanes; ++v)
+          {
+            const size_type block = batch_blocks[batch * n_lanes + v];
+            if (block == numbers::invalid_size_type)
+              {
+                for (unsigned int i = 0; i < bs; ++i)
+                  b_cell[i][v] = InverseNumberType();
+                continue;
+              }
+            SparsityPattern::iterator row = block_list.begin(block);
+            for (unsigned int row_cell = 0; row_cell < bs; ++row_cell, ++row)
+              {
+                typename VectorType::value_type b = src(row->column());
+                for (typename MatrixType::const_iterator entry =
+                       M.begin(row->column());
+                     entry != M.end(row->column());
+                     ++entry)
+                  b -= entry->value() * ghosted_prev(entry->column());
+                b_cell[row_cell][v] = b;
+              }
+          }
+
+        // Apply the inverse diagonal blocks of all lanes at once
+        const VectorizedArrayType *inverse =
+          &batched_inverses[batch_starts[batch]];
+        for (unsigned int i = 0; i < bs; ++i, inverse += bs)
+          {
+            VectorizedArrayType sum = inverse[0] * b_cell[0];
+            for (unsigned int j = 1; j < bs; ++j)
+              sum += inverse[j] * b_cell[j];
+            x_cell[i] = sum;
+          }
+
+        // Store in result vector
+        for (unsigned int v = 0; v < n_lanes; ++v)
+          {
+            const size_type block = batch_blocks[batch * n_lanes + v];
+            if (block == numbers::invalid_size_type)
+              continue;
+            SparsityPattern::iterator row = block_list.begin(block);
+            for (unsigned int row_cell = 0; row_cell < bs; ++row_cell, ++row)
+              {
+                AssertIsFinite(x_cell[row_cell][v]);
+                dst(row->column()) +=
+                  additional_data->relaxation * x_cell[row_cell][v];
+              }
+          }
+      }
+  dst.compress(VectorOperation::add);
+}
+
+
 //----------------------------------------------------------------------//
 
 template <typename MatrixType, typename InverseNumberType, typename VectorType>
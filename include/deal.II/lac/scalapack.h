@@ -26,11 +26,13 @@
 #  include <deal.II/base/process_grid.h>
 
 #  include <deal.II/lac/full_matrix.h>
+#  include <deal.II/lac/la_parallel_vector.h>
 #  include <deal.II/lac/lapack_full_matrix.h>
 #  include <deal.II/lac/lapack_support.h>
 
 #  include <limits>
 #  include <memory>
+#  include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -205,6 +207,49 @@ public:
   copy_from(const LAPACKFullMatrix<NumberType> &matrix,
             const unsigned int                  rank);
 
+  /**
+   * Copy the entries of the distributed @p vectors into the columns of the
+   * distributed matrix, i.e., column $j$ of the matrix is set to
+   * <code>vectors[j]</code>, as needed, e.g., to set up the snapshot matrix
+   * of a proper orthogonal decomposition. The matrix must have as many
+   * rows as the vectors have entries and as many columns as there are
+   * vectors, and the vectors must share the same contiguous locally owned
+   * range and be distributed over the MPI communicator of the process grid
+   * of the matrix. The processes outside the process grid may own vector
+   * entries as well.
+   *
+   * The entries are sent directly from the owners of the vector entries to
+   * the processes of the process grid owning them in the block-cyclic
+   * distribution, without forming a (replicated) full matrix. All
+   * messages are non-blocking: every process posts its receives first,
+   * sends each message as soon as it has been packed, and unpacks the
+   * received messages in the order they arrive, such that the packing and
+   * unpacking overlaps with the communication.
+   *
+   * This is a collective call over the MPI communicator of the process
+   * grid.
+   */
+  void
+  copy_from(
+    const std::vector<LinearAlgebra::distributed::Vector<NumberType>>
+      &vectors);
+
+  /**
+   * Copy the columns of the distributed matrix into the distributed
+   * @p vectors, i.e., <code>vectors[j]</code> is set to column $j$ of the
+   * matrix, as needed, e.g., to obtain the modes of a proper orthogonal
+   * decomposition from the left singular vectors. This is the inverse
+   * operation of copy_from() with the same requirements on the vectors,
+   * which need to be initialized to the correct size and partition, and the
+   * same non-blocking communication pattern.
+   *
+   * This is a collective call over the MPI communicator of the process
+   * grid.
+   */
+  void
+  copy_to(
+    std::vector<LinearAlgebra::distributed::Vector<NumberType>> &vectors) const;
+
   /**
    * Copy the contents of the distributed matrix into @p matrix.
    *
@@ -605,6 +650,43 @@ public:
   compute_SVD(ScaLAPACKMatrix<NumberType> *U  = nullptr,
               ScaLAPACKMatrix<NumberType> *VT = nullptr);
 
+  /**
+   * Compute the thin singular value decomposition (SVD) of a tall and
+   * skinny matrix $\mathbf{A} \in \mathbb{R}^{M \times N}$ with $M \geq
+   * N$, e.g., a snapshot matrix with many more degrees of freedom than
+   * snapshots, as $\mathbf{A} = \mathbf{U} \cdot \mathbf{\Sigma} \cdot
+   * \mathbf{V}^T$ with $\mathbf{U} \in \mathbb{R}^{M \times N}$ having
+   * orthonormal columns and $\mathbf{V} \in \mathbb{R}^{N \times N}$
+   * orthogonal. The singular values are returned in decreasing order.
+   *
+   * Instead of the bidiagonalization of the full matrix in compute_SVD(),
+   * this function first computes the QR factorization $\mathbf{A} =
+   * \mathbf{Q} \cdot \mathbf{R}$ with Householder reflectors, which are
+   * applied column by column to the tall matrix, then computes the SVD
+   * $\mathbf{R} = \mathbf{U}_R \cdot \mathbf{\Sigma} \cdot \mathbf{V}^T$
+   * of the small triangular factor, and finally the left singular vectors
+   * as $\mathbf{U} = \mathbf{Q} \cdot \mathbf{U}_R$. Only the $N \times N$
+   * factor is subject to the SVD, and only the first $N$ columns of
+   * $\mathbf{U}$ are formed instead of the $M \times M$ matrix returned by
+   * compute_SVD(). For a process grid with a single column, the QR
+   * factorization works on contiguous blocks of rows of the snapshot matrix.
+   *
+   * Upon return the content of the matrix is unusable.
+   * The matrix $\mathbf{A}$ must have identical block cyclic distribution for
+   * the rows and columns.
+   *
+   * If left singular vectors are required, the matrix $\mathbf{U}$ of size
+   * $M \times N$ has to be constructed with the same process grid and block
+   * cyclic distribution as $\mathbf{A}$. If right singular vectors are
+   * required, the matrix $\mathbf{V}^T$ of size $N \times N$ has to be
+   * constructed with the same process grid and block sizes as
+   * $\mathbf{A}$. To avoid computing the left and/or right singular vectors
+   * the function accepts <code>nullptr</code> for @p U and/or @p VT.
+   */
+  std::vector<NumberType>
+  compute_SVD_tall_skinny(ScaLAPACKMatrix<NumberType> *U  = nullptr,
+                          ScaLAPACKMatrix<NumberType> *VT = nullptr);
+
   /**
    * Solving overdetermined or underdetermined real linear
    * systems involving matrix $\mathbf{A} \in \mathbb{R}^{M \times N}$, or its
@@ -879,6 +961,27 @@ private:
   void
   load_parallel(const std::string &filename);
 
+  /**
+   * Determine the communication pattern between the block-cyclic
+   * distribution of this matrix and a set of distributed vectors with the
+   * locally owned range @p local_range, as used by copy_from() and
+   * copy_to() for distributed vectors. On return,
+   * @p vector_rows_on_process_row contains for each row of the process grid
+   * the local indices of the locally owned vector entries in the matrix
+   * rows distributed to that process row, @p columns_on_process_column
+   * contains for each column of the process grid the matrix columns
+   * distributed to it, and @p matrix_rows_on_process contains for each MPI
+   * process the local matrix rows of this process whose vector entries are
+   * owned by that process. All indices are sorted by their global index.
+   */
+  void
+  compute_vector_exchange_pattern(
+    const std::pair<types::global_dof_index, types::global_dof_index>
+                                           &local_range,
+    std::vector<std::vector<unsigned int>> &vector_rows_on_process_row,
+    std::vector<std::vector<unsigned int>> &columns_on_process_column,
+    std::vector<std::vector<unsigned int>> &matrix_rows_on_process) const;
+
   /**
    * Since ScaLAPACK operations notoriously change the meaning of the matrix
    * entries, we record the current state after the last operation here.
@@ -804,6 +804,75 @@ extern "C"
           int        *lwork,
           int        *info);
 
+  /*
+   * P_GEQRF computes a QR factorization of a real distributed M-by-N
+   * matrix A = Q * R.
+   */
+  void
+  pdgeqrf_(const int *m,
+           const int *n,
+           double    *A,
+           const int *ia,
+           const int *ja,
+           const int *desca,
+           double    *tau,
+           double    *work,
+           int       *lwork,
+           int       *info);
+  void
+  psgeqrf_(const int *m,
+           const int *n,
+           float     *A,
+           const int *ia,
+           const int *ja,
+           const int *desca,
+           float     *tau,
+           float     *work,
+           int       *lwork,
+           int       *info);
+
+  /*
+   * P_ORMQR overwrites the general real M-by-N distributed matrix C with
+   * Q * C, Q^T * C, C * Q, or C * Q^T, where Q is the orthogonal matrix
+   * of Householder reflectors returned by P_GEQRF.
+   */
+  void
+  pdormqr_(const char   *side,
+           const char   *trans,
+           const int    *m,
+           const int    *n,
+           const int    *k,
+           const double *A,
+           const int    *ia,
+           const int    *ja,
+           const int    *desca,
+           const double *tau,
+           double       *C,
+           const int    *ic,
+           const int    *jc,
+           const int    *descc,
+           double       *work,
+           int          *lwork,
+           int          *info);
+  void
+  psormqr_(const char  *side,
+           const char  *trans,
+           const int   *m,
+           const int   *n,
+           const int   *k,
+           const float *A,
+           const int   *ia,
+           const int   *ja,
+           const int   *desca,
+           const float *tau,
+           float       *C,
+           const int   *ic,
+           const int   *jc,
+           const int   *descc,
+           float       *work,
+           int         *lwork,
+           int         *info);
+
   /*
    * Perform matrix sum:
    * @f{equation*}{
@@ -2019,6 +2088,153 @@ pgels(const char *trans,
 }
 
 
+template <typename number>
+inline void
+pgeqrf(const int * /*m*/,
+       const int * /*n*/,
+       number * /*A*/,
+       const int * /*ia*/,
+       const int * /*ja*/,
+       const int * /*desca*/,
+       number * /*tau*/,
+       number * /*work*/,
+       int * /*lwork*/,
+       int * /*info*/)
+{
+  DEAL_II_NOT_IMPLEMENTED();
+}
+
+inline void
+pgeqrf(const int *m,
+       const int *n,
+       double    *A,
+       const int *ia,
+       const int *ja,
+       const int *desca,
+       double    *tau,
+       double    *work,
+       int       *lwork,
+       int       *info)
+{
+  pdgeqrf_(m, n, A, ia, ja, desca, tau, work, lwork, info);
+}
+
+inline void
+pgeqrf(const int *m,
+       const int *n,
+       float     *A,
+       const int *ia,
+       const int *ja,
+       const int *desca,
+       float     *tau,
+       float     *work,
+       int       *lwork,
+       int       *info)
+{
+  psgeqrf_(m, n, A, ia, ja, desca, tau, work, lwork, info);
+}
+
+
+template <typename number>
+inline void
+pormqr(const char * /*side*/,
+       const char * /*trans*/,
+       const int * /*m*/,
+       const int * /*n*/,
+       const int * /*k*/,
+       const number * /*A*/,
+       const int * /*ia*/,
+       const int * /*ja*/,
+       const int * /*desca*/,
+       const number * /*tau*/,
+       number * /*C*/,
+       const int * /*ic*/,
+       const int * /*jc*/,
+       const int * /*descc*/,
+       number * /*work*/,
+       int * /*lwork*/,
+       int * /*info*/)
+{
+  DEAL_II_NOT_IMPLEMENTED();
+}
+
+inline void
+pormqr(const char   *side,
+       const char   *trans,
+       const int    *m,
+       const int    *n,
+       const int    *k,
+       const double *A,
+       const int    *ia,
+       const int    *ja,
+       const int    *desca,
+       const double *tau,
+       double       *C,
+       const int    *ic,
+       const int    *jc,
+       const int    *descc,
+       double       *work,
+       int          *lwork,
+       int          *info)
+{
+  pdormqr_(side,
+           trans,
+           m,
+           n,
+           k,
+           A,
+           ia,
+           ja,
+           desca,
+           tau,
+           C,
+           ic,
+           jc,
+           descc,
+           work,
+           lwork,
+           info);
+}
+
+inline void
+pormqr(const char  *side,
+       const char  *trans,
+       const int   *m,
+       const int   *n,
+       const int   *k,
+       const float *A,
+       const int   *ia,
+       const int   *ja,
+       const int   *desca,
+       const float *tau,
+       float       *C,
+       const int   *ic,
+       const int   *jc,
+       const int   *descc,
+       float       *work,
+       int         *lwork,
+       int         *info)
+{
+  psormqr_(side,
+           trans,
+           m,
+           n,
+           k,
+           A,
+           ia,
+           ja,
+           desca,
+           tau,
+           C,
+           ic,
+           jc,
+           descc,
+           work,
+           lwork,
+           info);
+}
+
+
 template <typename number>
 inline void
 pgeadd(const char * /*transa*/,
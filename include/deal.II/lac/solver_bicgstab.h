@@ -25,7 +25,9 @@
 
 #include <deal.II/lac/solver.h>
 #include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_inner_products.h>
 
+#include <array>
 #include <cmath>
 #include <limits>
 
@@ -68,6 +70,18 @@ DEAL_II_NAMESPACE_OPEN
  * to find a general good criterion, so if things do not work for you, try to
  * change this value.
  *
+ * The inner products needed within one step are grouped such that the
+ * iteration only needs two global reductions per step: the norms of the
+ * intermediate and the new residual as well as the product with the shadow
+ * residual for the next step are obtained from inner products against the
+ * results of the matrix-vector products. For
+ * LinearAlgebra::distributed::Vector and
+ * LinearAlgebra::distributed::BlockVector, the inner products of each group
+ * are computed in a single pass through the vectors and are summed up with
+ * a single call to MPI. When the residual norm obtained in this way is
+ * affected by cancellation, i.e., when it drops by more than three orders of
+ * magnitude within one step, it is computed explicitly instead.
+ *
  *
  * <h3>Observing the progress of linear solver iterations</h3>
  *
@@ -327,11 +341,15 @@ typename SolverBicgstab<VectorType>::IterationResult
   value_type rho   = 1.;
   value_type omega = 1.;
 
+  // The product (r, rbar) of the next step, which is obtained from the
+  // inner products computed together with omega in the preceding step
+  value_type next_rhobar = res * res;
+
   do
     {
       ++step;
 
-      const value_type rhobar = (step == 1 + last_step) ? res * res : r * rbar;
+      const value_type rhobar = next_rhobar;
 
       if (std::fabs(rhobar) < additional_data.breakdown)
         {
@@ -352,7 +370,14 @@ typename SolverBicgstab<VectorType>::IterationResult
 
       preconditioner.vmult(y, p);
       A.vmult(v, y);
-      const value_type rbar_dot_v = rbar * v;
+
+      // Compute (rbar, v) together with the inner products that give the
+      // norm of the updated residual s = r - alpha v, such that only a
+      // single global reduction is needed
+      const std::array<value_type, 3> dots_v =
+        internal::SolverInnerProducts::compute<VectorType, 3>(
+          {{{&rbar, &v}, {&r, &v}, {&v, &v}}});
+      const value_type rbar_dot_v = dots_v[0];
       if (std::fabs(rbar_dot_v) < additional_data.breakdown)
         {
           return IterationResult(true, state, step, res);
@@ -360,7 +385,20 @@ typename SolverBicgstab<VectorType>::IterationResult
 
       alpha = rho / rbar_dot_v;
 
-      res = std::sqrt(real_type(r.add_and_dot(-alpha, v, r)));
+      const real_type res_squared = real_type(res * res);
+      r.add(-alpha, v);
+      const real_type s_squared =
+        res_squared - real_type(2. * alpha * dots_v[1]) +
+        real_type(alpha * alpha * dots_v[2]);
+
+      // The norm computed through the inner products suffers from
+      // cancellation when the residual is reduced by many orders of
+      // magnitude within a single step, so compute it explicitly in that
+      // case in order to not report a wrong residual to the SolverControl
+      if (s_squared > real_type(1e-6) * res_squared)
+        res = std::sqrt(s_squared);
+      else
+        res = r.l2_norm();
 
       // check for early success, see the lac/bicgstab_early testcase as to
       // why this is necessary
@@ -377,22 +415,35 @@ typename SolverBicgstab<VectorType>::IterationResult
 
       preconditioner.vmult(z, r);
       A.vmult(t, z);
-      const value_type t_dot_r   = t * r;
-      const real_type  t_squared = t * t;
+
+      // Compute all inner products of this step with a single reduction,
+      // including those that give the norm of the new residual r - omega t
+      // and its product with rbar for the next step
+      const std::array<value_type, 5> dots_t =
+        internal::SolverInnerProducts::compute<VectorType, 5>(
+          {{{&t, &r}, {&t, &t}, {&r, &r}, {&r, &rbar}, {&t, &rbar}}});
+      const value_type t_dot_r   = dots_t[0];
+      const real_type  t_squared = real_type(dots_t[1]);
       if (t_squared < additional_data.breakdown)
         {
           return IterationResult(true, state, step, res);
         }
       omega = t_dot_r / t_squared;
       x.add(alpha, y, omega, z);
+      r.add(-omega, t);
+      next_rhobar = dots_t[3] - omega * dots_t[4];
 
       if (additional_data.exact_residual)
+        res = criterion(A, x, b, t);
+      else
         {
-          r.add(-omega, t);
-          res = criterion(A, x, b, t);
+          const real_type r_squared =
+            real_type(dots_t[2]) - real_type(omega * t_dot_r);
+          if (r_squared > real_type(1e-6) * real_type(dots_t[2]))
+            res = std::sqrt(r_squared);
+          else
+            res = r.l2_norm();
         }
-      else
-        res = std::sqrt(real_type(r.add_and_dot(-omega, t, r)));
 
       state = this->iteration_status(step, res, x);
       print_vectors(step, x, r, y);
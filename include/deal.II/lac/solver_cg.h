@@ -20,6 +20,7 @@
 
 #include <deal.II/base/enable_observer_pointer.h>
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/instrumentation_region.h>
 #include <deal.II/base/logstream.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/vectorization.h>
@@ -608,9 +609,9 @@ namespace internal
         , flexible(flexible)
         , x(x)
         , b(b)
-        , r_pointer(memory)
-        , p_pointer(memory)
-        , v_pointer(memory)
+        , r_pointer(memory, x)
+        , p_pointer(memory, x)
+        , v_pointer(memory, x)
         , z_pointer(memory)
         , explicit_r_pointer(memory)
         , r(*r_pointer)
@@ -630,10 +631,8 @@ namespace internal
       startup()
       {
         // Initialize without setting the vector entries, as those would soon
-        // be overwritten anyway
-        r.reinit(x, true);
-        p.reinit(x, true);
-        v.reinit(x, true);
+        // be overwritten anyway. The vectors r, p, and v have already been
+        // laid out like x upon allocation.
         if (flexible)
           z.reinit(x, true);
         if (!use_default_residual)
@@ -1393,6 +1392,8 @@ void SolverCG<VectorType>::solve(const MatrixType         &A,
                                  const VectorType         &b,
                                  const PreconditionerType &preconditioner)
 {
+  InstrumentationRegion instrumentation_region("SolverCG::solve");
+
   using number = typename VectorType::value_type;
 
   SolverControl::State solver_state = SolverControl::iterate;
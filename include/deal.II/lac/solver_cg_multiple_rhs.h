@@ -0,0 +1,359 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_cg_multiple_rhs_h
+#define dealii_solver_cg_multiple_rhs_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/block_vector_base.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/** @addtogroup Solvers */
+/** @{ */
+
+/**
+ * This class implements the preconditioned conjugate gradient method for
+ * several linear systems with the same symmetric positive definite matrix
+ * and different right hand sides, which are solved simultaneously. The
+ * right hand sides and solutions are the blocks of a block vector, e.g.
+ * BlockVector or LinearAlgebra::distributed::BlockVector, and each block is
+ * iterated by its own CG recurrence with its own step lengths, i.e., the
+ * iterates are the same as when calling SolverCG for each block in turn.
+ * However, the matrix-vector product and the preconditioner are applied to
+ * all blocks at once, which allows the operator to read the data it needs
+ * (e.g., the sparsity pattern of a matrix or the geometry information of
+ * a matrix-free operator) only once for all right hand sides. For
+ * LinearAlgebra::distributed::BlockVector, the inner products of all blocks
+ * are furthermore combined into a single global reduction.
+ *
+ * The iteration continues until all systems have converged; the value
+ * passed to the SolverControl object is the largest residual norm among the
+ * blocks. Blocks that have converged exactly (zero residual) are frozen.
+ *
+ * <h3>Matrix-free operators for multiple right hand sides</h3>
+ *
+ * The operator and the preconditioner need to provide a function
+ * <tt>vmult(BlockVectorType &dst, const BlockVectorType &src)</tt> that
+ * applies the action to each block. For matrix-free operators, this is done
+ * most efficiently by passing the block vectors to MatrixFree::cell_loop(),
+ * which exchanges the ghost entries of all blocks together, and by using an
+ * FEEvaluation object with as many components as there are right hand
+ * sides. FEEvaluation::read_dof_values() then reads one block per component
+ * with a single pass through the indices of the cell, and the quadrature
+ * point operations in the loop over the components reuse the geometry data
+ * of the cell batch while it is still in cache:
+ * @code
+ * template <int n_rhs>
+ * void
+ * local_apply(const MatrixFree<dim, double>                         &data,
+ *             LinearAlgebra::distributed::BlockVector<double>       &dst,
+ *             const LinearAlgebra::distributed::BlockVector<double> &src,
+ *             const std::pair<unsigned int, unsigned int> &cell_range) const
+ * {
+ *   FEEvaluation<dim, fe_degree, fe_degree + 1, n_rhs, double> phi(data);
+ *   for (unsigned int cell = cell_range.first; cell < cell_range.second;
+ *        ++cell)
+ *     {
+ *       phi.reinit(cell);
+ *       phi.read_dof_values(src);
+ *       phi.evaluate(EvaluationFlags::gradients);
+ *       for (const unsigned int q : phi.quadrature_point_indices())
+ *         phi.submit_gradient(phi.get_gradient(q), q);
+ *       phi.integrate(EvaluationFlags::gradients);
+ *       phi.distribute_local_to_global(dst);
+ *     }
+ * }
+ * @endcode
+ * If the number of right hand sides is not known at compile time, an
+ * FEEvaluation object with a single component can be used by calling
+ * FEEvaluation::read_dof_values() and
+ * FEEvaluation::distribute_local_to_global() with the index of the block as
+ * second argument, at the cost of going through the indices for every
+ * block.
+ */
+template <typename BlockVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<BlockVectorType>)
+class SolverCGMultipleRHS : public SolverBase<BlockVectorType>
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Standardized data struct to pipe additional data to the solver. There is
+   * no data in here for this class.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverCGMultipleRHS(SolverControl                 &cn,
+                      VectorMemory<BlockVectorType> &mem,
+                      const AdditionalData          &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverCGMultipleRHS(SolverControl        &cn,
+                      const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear systems $A x_i = b_i$ for all blocks $i$ of the
+   * vectors @p x and @p b.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, BlockVectorType> &&
+     concepts::is_linear_operator_on<PreconditionerType, BlockVectorType>))
+  void solve(const MatrixType         &A,
+             BlockVectorType          &x,
+             const BlockVectorType    &b,
+             const PreconditionerType &preconditioner);
+
+protected:
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+};
+
+/** @} */
+
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace SolverCGMultipleRHS
+  {
+    // Compute the inner products of the corresponding blocks of two block
+    // vectors, using the inner product of the blocks
+    template <typename BlockVectorType, typename = void>
+    struct BlockwiseInnerProducts
+    {
+      using Number = typename BlockVectorType::value_type;
+
+      static void
+      apply(const BlockVectorType &v,
+            const BlockVectorType &w,
+            std::vector<Number>   &result)
+      {
+        result.resize(v.n_blocks());
+        for (unsigned int b = 0; b < v.n_blocks(); ++b)
+          result[b] = v.block(b) * w.block(b);
+      }
+    };
+
+
+
+    // Specialization for LinearAlgebra::distributed::BlockVector, which sums
+    // up the local contributions of all blocks with a single reduction
+    template <typename BlockVectorType>
+    struct BlockwiseInnerProducts<
+      BlockVectorType,
+      std::enable_if_t<
+        std::is_same_v<BlockVectorType,
+                       LinearAlgebra::distributed::BlockVector<
+                         typename BlockVectorType::value_type>>>>
+    {
+      using Number = typename BlockVectorType::value_type;
+
+      static void
+      apply(const BlockVectorType &v,
+            const BlockVectorType &w,
+            std::vector<Number>   &result)
+      {
+        result.resize(v.n_blocks());
+        if (v.n_blocks() == 0)
+          return;
+
+        for (unsigned int b = 0; b < v.n_blocks(); ++b)
+          {
+            const Number      *v_ptr = v.block(b).begin();
+            const Number      *w_ptr = w.block(b).begin();
+            const unsigned int size  = v.block(b).locally_owned_size();
+            Number             sum   = Number();
+            for (unsigned int i = 0; i < size; ++i)
+              sum += v_ptr[i] * numbers::NumberTraits<Number>::conjugate(
+                                  w_ptr[i]);
+            result[b] = sum;
+          }
+
+        Utilities::MPI::sum(ArrayView<const Number>(result),
+                            v.block(0).get_mpi_communicator(),
+                            ArrayView<Number>(result));
+      }
+    };
+  } // namespace SolverCGMultipleRHS
+} // namespace internal
+
+
+
+template <typename BlockVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<BlockVectorType>)
+SolverCGMultipleRHS<BlockVectorType>::SolverCGMultipleRHS(
+  SolverControl                 &cn,
+  VectorMemory<BlockVectorType> &mem,
+  const AdditionalData          &data)
+  : SolverBase<BlockVectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename BlockVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<BlockVectorType>)
+SolverCGMultipleRHS<BlockVectorType>::SolverCGMultipleRHS(
+  SolverControl        &cn,
+  const AdditionalData &data)
+  : SolverBase<BlockVectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename BlockVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<BlockVectorType>)
+template <typename MatrixType, typename PreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, BlockVectorType> &&
+   concepts::is_linear_operator_on<PreconditionerType, BlockVectorType>))
+void SolverCGMultipleRHS<BlockVectorType>::solve(
+  const MatrixType         &A,
+  BlockVectorType          &x,
+  const BlockVectorType    &b,
+  const PreconditionerType &preconditioner)
+{
+  static_assert(IsBlockVector<BlockVectorType>::value,
+                "SolverCGMultipleRHS needs a block vector type, with one "
+                "block per right hand side.");
+
+  using number = typename BlockVectorType::value_type;
+  using InnerProducts =
+    internal::SolverCGMultipleRHS::BlockwiseInnerProducts<BlockVectorType>;
+  const unsigned int n_rhs = b.n_blocks();
+
+  SolverControl::State solver_state = SolverControl::iterate;
+
+  LogStream::Prefix prefix("cg_multiple_rhs");
+
+  typename VectorMemory<BlockVectorType>::Pointer r_pointer(this->memory);
+  typename VectorMemory<BlockVectorType>::Pointer z_pointer(this->memory);
+  typename VectorMemory<BlockVectorType>::Pointer p_pointer(this->memory);
+  typename VectorMemory<BlockVectorType>::Pointer v_pointer(this->memory);
+
+  BlockVectorType &r = *r_pointer;
+  BlockVectorType &z = *z_pointer;
+  BlockVectorType &p = *p_pointer;
+  BlockVectorType &v = *v_pointer;
+
+  r.reinit(x, true);
+  z.reinit(x, true);
+  p.reinit(x, true);
+  v.reinit(x, true);
+
+  if (!x.all_zero())
+    {
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+    }
+  else
+    r.equ(1., b);
+
+  std::vector<number> r_dot_z(n_rhs), p_dot_v(n_rhs), r_dot_r(n_rhs);
+
+  const auto compute_residual_norm = [&]() {
+    InnerProducts::apply(r, r, r_dot_r);
+    double max_norm = 0.;
+    for (unsigned int i = 0; i < n_rhs; ++i)
+      max_norm = std::max<double>(max_norm, std::sqrt(std::abs(r_dot_r[i])));
+    return max_norm;
+  };
+
+  double       residual_norm = compute_residual_norm();
+  unsigned int it            = 0;
+
+  solver_state = this->iteration_status(it, residual_norm, x);
+  if (solver_state != SolverControl::iterate)
+    return;
+
+  preconditioner.vmult(z, r);
+  InnerProducts::apply(r, z, r_dot_z);
+  p = z;
+
+  while (solver_state == SolverControl::iterate)
+    {
+      ++it;
+
+      A.vmult(v, p);
+      InnerProducts::apply(p, v, p_dot_v);
+
+      for (unsigned int i = 0; i < n_rhs; ++i)
+        {
+          // a zero curvature only happens for a zero search direction, i.e.,
+          // after exact convergence of this block, which we then freeze
+          const number alpha =
+            p_dot_v[i] != number() ? r_dot_z[i] / p_dot_v[i] : number();
+          x.block(i).add(alpha, p.block(i));
+          r.block(i).add(-alpha, v.block(i));
+        }
+
+      residual_norm = compute_residual_norm();
+      solver_state  = this->iteration_status(it, residual_norm, x);
+      if (solver_state != SolverControl::iterate)
+        break;
+
+      preconditioner.vmult(z, r);
+      const std::vector<number> previous_r_dot_z = r_dot_z;
+      InnerProducts::apply(r, z, r_dot_z);
+
+      for (unsigned int i = 0; i < n_rhs; ++i)
+        {
+          const number beta = previous_r_dot_z[i] != number() ?
+                                r_dot_z[i] / previous_r_dot_z[i] :
+                                number();
+          p.block(i).sadd(beta, 1., z.block(i));
+        }
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norm));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
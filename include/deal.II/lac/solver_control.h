@@ -49,6 +49,20 @@ class ParameterHandler;
  * tests.
  *
  *
+ * <h3>Reduced frequency of convergence checks</h3>
+ *
+ * Computing the value passed to check() usually involves a norm and thus a
+ * global reduction. Some solvers do not need this value for their own
+ * recurrence, but only to determine convergence, e.g. SolverRichardson. For
+ * those solvers, check_frequency() allows to only check every few steps,
+ * and predict_check_step() allows to skip the steps in which convergence is
+ * not yet expected according to the average convergence rate observed so
+ * far. Such solvers ask check_needed() whether they need to evaluate the
+ * convergence criterion in a given step. The price is that the iteration may
+ * run a few steps longer than necessary, because convergence is only
+ * detected in the next step in which a check is performed.
+ *
+ *
  * <h3>State</h3> The return states of the check function are of type #State,
  * which is an enum local to this class. It indicates the state the solver is
  * in.
@@ -308,6 +322,39 @@ public:
   unsigned int
   log_frequency(unsigned int);
 
+  /**
+   * Set the frequency of convergence checks in solvers that do not need the
+   * convergence criterion for their recurrence, see the class documentation.
+   * With a frequency of @p f, the convergence is checked in step zero, every
+   * @p f steps after the last check, and in the last allowed step. When
+   * predict_check_step() is enabled, @p f is the maximal distance between two
+   * checks. The default is one, i.e., every step is checked. Return the
+   * previous value.
+   *
+   * @note Every step is checked if the history data is enabled, since the
+   * functions evaluating the data need the values of all steps.
+   */
+  unsigned int
+  check_frequency(unsigned int);
+
+  /**
+   * Enable or disable the prediction of the step in which the convergence
+   * criterion is expected to hit the tolerance, based on the average
+   * convergence rate between the initial and the last checked value, for
+   * which step one is always checked. If enabled, solvers skip the checks
+   * until this step is reached or check_frequency() steps have passed since
+   * the last check. This is disabled by default.
+   */
+  void
+  predict_check_step(const bool);
+
+  /**
+   * Return whether a solver that has the freedom to skip convergence checks,
+   * see check_frequency(), needs to call check() in step @p step.
+   */
+  virtual bool
+  check_needed(const unsigned int step) const;
+
   /**
    * Log start and end step.
    */
@@ -328,6 +375,14 @@ public:
   DeclException0(ExcHistoryDataRequired);
 
 protected:
+  /**
+   * Implementation of check_needed() for a given target value of the
+   * convergence criterion, which is used for the prediction of the step in
+   * which convergence is expected.
+   */
+  bool
+  check_needed(const unsigned int step, const double target_value) const;
+
   /**
    * Maximum number of steps.
    */
@@ -387,6 +442,17 @@ protected:
    */
   unsigned int m_log_frequency;
 
+  /**
+   * Check the convergence at least every nth step in solvers that may skip
+   * the check.
+   */
+  unsigned int m_check_frequency;
+
+  /**
+   * Skip the checks before the predicted step of convergence.
+   */
+  bool m_predict_check_step;
+
   /**
    * Log iteration result to @p deallog.  If true, after finishing the
    * iteration, a statement about failure or success together with @p lstep
@@ -473,6 +539,13 @@ public:
   virtual State
   check(const unsigned int step, const double check_value) override;
 
+  /**
+   * Return whether a check is needed in step @p step, where the prediction
+   * of the convergence step is based on the reduced tolerance.
+   */
+  virtual bool
+  check_needed(const unsigned int step) const override;
+
   /**
    * Reduction factor.
    */
@@ -603,6 +676,13 @@ public:
   virtual State
   check(const unsigned int step, const double check_value) override;
 
+  /**
+   * Return true for all steps, since this class needs the convergence
+   * criterion of all consecutive steps.
+   */
+  virtual bool
+  check_needed(const unsigned int step) const override;
+
 protected:
   /**
    * The number of consecutive iterations which should satisfy the prescribed
@@ -176,6 +176,42 @@ namespace internal
         const boost::signals2::signal<void(int)> &reorthogonalize_signal =
           boost::signals2::signal<void(int)>());
 
+      /**
+       * Orthonormalize the vectors at the positions <tt>n + 1, ..., n +
+       * s</tt> within the array @p orthogonal_vectors, which must have been
+       * computed by the s-step GMRES method as scaled powers of the operator
+       * applied to the vector at position @p n, i.e., the vector at position
+       * <tt>n + j</tt> is the operator applied to the one at position <tt>n +
+       * j - 1</tt> divided by @p basis_scaling. The first @p n + 1 vectors
+       * must be orthonormal already. The block is orthogonalized by two
+       * passes of block classical Gram-Schmidt with a Cholesky factorization
+       * of the Gram matrix, using two global reductions in total, and the
+       * columns <tt>n, ..., n + s - 1</tt> of the Hessenberg matrix are
+       * filled accordingly.
+       *
+       * If the block of vectors is too ill-conditioned to be orthonormalized
+       * accurately, only its leading part is used. The number of new basis
+       * vectors is returned, which is at least one. In contrast to
+       * orthonormalize_nth_vector(), the columns of the Hessenberg matrix are
+       * not transformed to triangular form; this must be done by calling
+       * eliminate_hessenberg_column() for each column.
+       */
+      template <typename VectorType>
+      unsigned int
+      orthonormalize_s_step_block(const unsigned int      n,
+                                  const unsigned int      s,
+                                  const double            basis_scaling,
+                                  TmpVectors<VectorType> &orthogonal_vectors);
+
+      /**
+       * Transform column @p col of the Hessenberg matrix as computed by
+       * orthonormalize_s_step_block() to upper triangular form by a Givens
+       * rotation, and return the resulting estimate of the residual. The
+       * function must be called with consecutive column indices.
+       */
+      double
+      eliminate_hessenberg_column(const unsigned int col);
+
       /**
        * Using the matrix and right hand side computed during the
        * factorization, solve the underlying minimization problem for the
@@ -351,6 +387,34 @@ namespace internal
  * can be obtained by connecting a function as a slot using @p
  * connect_condition_number_slot and @p connect_eigenvalues_slot. These slots
  * will then be called from the solver with the estimates as argument.
+ *
+ *
+ * <h3>s-step GMRES</h3>
+ *
+ * On large parallel computers, the global reductions in the
+ * orthogonalization of the Arnoldi basis often dominate the run time of
+ * GMRES, as each iteration needs at least one of them. If
+ * AdditionalData::s_step_size is set to a value $s>1$, the solver instead
+ * generates $s$ new basis vectors at once by repeated application of the
+ * (preconditioned) operator to the last orthonormal vector, scaled by an
+ * estimate of the norm of the operator from the previous steps. This block
+ * is then orthogonalized against the previous basis and within itself by
+ * two passes of block classical Gram-Schmidt combined with a Cholesky
+ * factorization of the Gram matrix (CholQR2), needing two global
+ * reductions for $s$ iterations, and the Hessenberg matrix is recovered
+ * from the factors. The result is the same Krylov space as with the
+ * classical algorithm.
+ *
+ * Since the vectors of the monomial basis become increasingly parallel with
+ * growing powers of the operator, the block is truncated when the
+ * Gram matrix becomes too ill-conditioned, which keeps the method stable at
+ * the price of fewer steps per block. Values of $s$ between 3 and 8 are
+ * typical. The s-step variant always uses two orthogonalization passes and
+ * ignores AdditionalData::orthogonalization_strategy and
+ * AdditionalData::force_re_orthogonalization. It requires
+ * AdditionalData::use_default_residual to be set. Note that the
+ * matrix-vector products are still applied one after the other, each with
+ * its own exchange of ghost entries with the neighboring processes.
  */
 template <typename VectorType = Vector<double>>
 DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
@@ -370,7 +434,8 @@ public:
      * information is disabled by default. Finally, the default
      * orthogonalization algorithm is the classical Gram-Schmidt method with
      * delayed reorthogonalization, which combines stability with fast
-     * execution, especially in parallel.
+     * execution, especially in parallel. The s-step variant is disabled by
+     * default.
      */
     explicit AdditionalData(const unsigned int max_basis_size        = 30,
                             const bool         right_preconditioning = false,
@@ -380,7 +445,8 @@ public:
                             const LinearAlgebra::OrthogonalizationStrategy
                               orthogonalization_strategy =
                                 LinearAlgebra::OrthogonalizationStrategy::
-                                  delayed_classical_gram_schmidt);
+                                  delayed_classical_gram_schmidt,
+                            const unsigned int s_step_size = 1);
 
     /**
      * Maximum number of temporary vectors. Together with max_basis_size, this
@@ -438,6 +504,15 @@ public:
      * Strategy to orthogonalize vectors.
      */
     LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy;
+
+    /**
+     * Number of basis vectors that are generated and orthogonalized together
+     * in the s-step variant of the method, see the section on s-step GMRES in
+     * the documentation of this class. A value of one, the default, selects
+     * the classical algorithm with the orthogonalization given by
+     * @p orthogonalization_strategy.
+     */
+    unsigned int s_step_size;
   };
 
   /**
@@ -737,7 +812,8 @@ inline SolverGMRES<VectorType>::AdditionalData::AdditionalData(
   const bool                                     use_default_residual,
   const bool                                     force_re_orthogonalization,
   const bool                                     batched_mode,
-  const LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy)
+  const LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy,
+  const unsigned int                             s_step_size)
   : max_n_tmp_vectors(0)
   , max_basis_size(max_basis_size)
   , right_preconditioning(right_preconditioning)
@@ -745,10 +821,13 @@ inline SolverGMRES<VectorType>::AdditionalData::AdditionalData(
   , force_re_orthogonalization(force_re_orthogonalization)
   , batched_mode(batched_mode)
   , orthogonalization_strategy(orthogonalization_strategy)
+  , s_step_size(s_step_size)
 {
   Assert(max_basis_size >= 1,
          ExcMessage("SolverGMRES needs at least one vector in the "
                     "Arnoldi basis."));
+  Assert(s_step_size >= 1,
+         ExcMessage("The s-step size of SolverGMRES must be at least one."));
 }
 
 
@@ -1148,6 +1227,74 @@ namespace internal
 
 
 
+    // Compute the inner products of each of the vectors n + 1, ..., n + s
+    // with all vectors up to and including itself, which are the entries
+    // needed by the block orthogonalization of s-step GMRES. The products
+    // of vector n + j are stored contiguously in h, starting at the index
+    // (j - 1) * (n + 1) + (j - 1) * j / 2.
+    template <typename VectorType,
+              std::enable_if_t<!is_dealii_compatible_vector<VectorType>::value,
+                               VectorType> * = nullptr>
+    void
+    block_Tvmult(const unsigned int            n,
+                 const unsigned int            s,
+                 const TmpVectors<VectorType> &orthogonal_vectors,
+                 Vector<double>               &h,
+                 std::vector<const typename VectorType::value_type *> &)
+    {
+      h.reinit((n + 1) * s + s * (s + 1) / 2);
+      unsigned int index = 0;
+      for (unsigned int j = 1; j <= s; ++j)
+        for (unsigned int i = 0; i <= n + j; ++i)
+          h(index++) = orthogonal_vectors[n + j] * orthogonal_vectors[i];
+    }
+
+
+
+    // Variant for deal.II's vector types that computes all inner products
+    // with a single global reduction
+    template <typename VectorType,
+              std::enable_if_t<is_dealii_compatible_vector<VectorType>::value,
+                               VectorType> * = nullptr>
+    void
+    block_Tvmult(
+      const unsigned int                                    n,
+      const unsigned int                                    s,
+      const TmpVectors<VectorType>                         &orthogonal_vectors,
+      Vector<double>                                       &h,
+      std::vector<const typename VectorType::value_type *> &vector_ptrs)
+    {
+      h.reinit((n + 1) * s + s * (s + 1) / 2);
+      Vector<double> h_local;
+      for (unsigned int b = 0; b < n_blocks(orthogonal_vectors[0]); ++b)
+        {
+          unsigned int index = 0;
+          for (unsigned int j = 1; j <= s; ++j)
+            {
+              const VectorType  &vv        = orthogonal_vectors[n + j];
+              const unsigned int n_vectors = n + j + 1;
+              vector_ptrs.resize(n_vectors);
+              for (unsigned int i = 0; i < n_vectors; ++i)
+                vector_ptrs[i] = block(orthogonal_vectors[i], b).begin();
+
+              h_local.reinit(n_vectors);
+              do_Tvmult_add<false>(n_vectors,
+                                   block(vv, b).end() - block(vv, b).begin(),
+                                   block(vv, b).begin(),
+                                   vector_ptrs,
+                                   h_local);
+              for (unsigned int i = 0; i < n_vectors; ++i)
+                h(index + i) += h_local(i);
+              index += n_vectors;
+            }
+        }
+
+      Utilities::MPI::sum(
+        h, block(orthogonal_vectors[0], 0).get_mpi_communicator(), h);
+    }
+
+
+
     template <typename Number>
     inline void
     ArnoldiProcess<Number>::initialize(
@@ -1362,6 +1509,204 @@ namespace internal
 
 
 
+    template <typename Number>
+    template <typename VectorType>
+    inline unsigned int
+    ArnoldiProcess<Number>::orthonormalize_s_step_block(
+      const unsigned int      n,
+      const unsigned int      s,
+      const double            basis_scaling,
+      TmpVectors<VectorType> &orthogonal_vectors)
+    {
+      Assert(s > 0, ExcInternalError());
+      AssertIndexRange(n + s, hessenberg_matrix.m());
+      AssertIndexRange(n + s, orthogonal_vectors.size() + 1);
+
+      // The block W = [w_1, ..., w_s] of the vectors n+1, ..., n+s is
+      // represented as W = Q C + Y R with the orthonormal vectors Q = [q_0,
+      // ..., q_n], the new orthonormal vectors Y, the (n+1) x s matrix C and
+      // the upper triangular s x s matrix R. Each of the two passes computes
+      // the inner products of the block with Q and the Gram matrix of the
+      // block in one reduction, forms the Cholesky factor of the projected
+      // Gram matrix and overwrites the block by the new orthonormal vectors.
+      FullMatrix<double> coefficients(n + 1, s);
+      FullMatrix<double> triangular(s, s);
+      unsigned int       n_accepted   = s;
+      bool               is_breakdown = false;
+
+      const double tolerance =
+        1e4 * std::numeric_limits<typename VectorType::value_type>::epsilon();
+
+      Vector<double> coefficients_pass(n + 1 + s);
+      for (unsigned int pass = 0; pass < 2 && !is_breakdown; ++pass)
+        {
+          block_Tvmult(n, n_accepted, orthogonal_vectors, h, vector_ptrs);
+
+          // extract the inner products with Q (first n+1 entries of each
+          // vector) and the Gram matrix of the block (lower part)
+          FullMatrix<double> C(n + 1, n_accepted);
+          FullMatrix<double> G(n_accepted, n_accepted);
+          for (unsigned int j = 0, index = 0; j < n_accepted; ++j)
+            {
+              for (unsigned int i = 0; i <= n; ++i, ++index)
+                C(i, j) = h(index);
+              for (unsigned int l = 0; l <= j; ++l, ++index)
+                G(l, j) = G(j, l) = h(index);
+            }
+
+          // Cholesky factorization of the projected Gram matrix G - C^T C,
+          // truncating the block in the first pass when a column has lost
+          // too much of its norm in the projection to be accurate
+          FullMatrix<double> R(n_accepted, n_accepted);
+          for (unsigned int j = 0; j < n_accepted; ++j)
+            {
+              for (unsigned int l = 0; l <= j; ++l)
+                {
+                  double sum = G(l, j);
+                  for (unsigned int i = 0; i <= n; ++i)
+                    sum -= C(i, l) * C(i, j);
+                  for (unsigned int k = 0; k < l; ++k)
+                    sum -= R(k, l) * R(k, j);
+                  if (l < j)
+                    R(l, j) = sum / R(l, l);
+                  else if (sum > tolerance * G(j, j) || (pass == 1 && sum > 0))
+                    R(j, j) = std::sqrt(sum);
+                  else if (j > 0)
+                    n_accepted = j;
+                  else if (pass == 0 && G(j, j) > 0.)
+                    // the first vector has almost vanished in the
+                    // projection and its norm cannot be computed accurately
+                    // from the Gram matrix, so let the second pass recover
+                    // its direction and norm from the remaining part
+                    R(j, j) = std::sqrt(sum > 0. ? sum : G(j, j));
+                  else
+                    {
+                      // lucky breakdown: the new vector is in the span of
+                      // the previous ones
+                      R(j, j)      = 0.;
+                      is_breakdown = true;
+                      n_accepted   = 1;
+                    }
+                }
+              if (n_accepted <= j || is_breakdown)
+                break;
+            }
+
+          // Y = (W - Q C) R^{-1}, column by column, using the vectors of the
+          // block already overwritten by their orthonormal counterparts
+          for (unsigned int j = 0; j < n_accepted; ++j)
+            {
+              for (unsigned int i = 0; i <= n; ++i)
+                coefficients_pass(i) = -C(i, j);
+              for (unsigned int l = 0; l < j; ++l)
+                coefficients_pass(n + 1 + l) = -R(l, j);
+              VectorType &vv = orthogonal_vectors[n + 1 + j];
+              add(vv,
+                  n + 1 + j,
+                  coefficients_pass,
+                  orthogonal_vectors,
+                  false,
+                  vector_ptrs);
+              if (R(j, j) != 0.)
+                vv /= R(j, j);
+            }
+
+          // accumulate the factors of the two passes: with W = Q C_0 + Y_0
+          // R_0 and Y_0 = Q C_1 + Y_1 R_1, we get W = Q (C_0 + C_1 R_0) + Y_1
+          // R_1 R_0
+          if (pass == 0)
+            {
+              for (unsigned int j = 0; j < n_accepted; ++j)
+                {
+                  for (unsigned int i = 0; i <= n; ++i)
+                    coefficients(i, j) = C(i, j);
+                  for (unsigned int l = 0; l <= j; ++l)
+                    triangular(l, j) = R(l, j);
+                }
+            }
+          else
+            {
+              FullMatrix<double> new_coefficients(n + 1, s);
+              FullMatrix<double> new_triangular(s, s);
+              for (unsigned int j = 0; j < n_accepted; ++j)
+                {
+                  for (unsigned int i = 0; i <= n; ++i)
+                    {
+                      double sum = coefficients(i, j);
+                      for (unsigned int l = 0; l <= j; ++l)
+                        sum += C(i, l) * triangular(l, j);
+                      new_coefficients(i, j) = sum;
+                    }
+                  for (unsigned int l = 0; l <= j; ++l)
+                    {
+                      double sum = 0;
+                      for (unsigned int k = l; k <= j; ++k)
+                        sum += R(l, k) * triangular(k, j);
+                      new_triangular(l, j) = sum;
+                    }
+                }
+              coefficients = new_coefficients;
+              triangular   = new_triangular;
+            }
+        }
+
+      // Recover the columns n, ..., n+s-1 of the Hessenberg matrix from
+      // Op [w_0, ..., w_{s-1}] = basis_scaling [w_1, ..., w_s] with w_0 =
+      // q_n. We write [w_0, ..., w_{s-1}] = [q_0, ..., q_{n-1}] P + [q_n,
+      // ..., q_{n+s-1}] T with the upper triangular s x s matrix T, and
+      // use Op [q_0, ..., q_{n-1}] = [q_0, ..., q_n] H_old, which gives the
+      // new columns as (basis_scaling [C; R] - [H_old P; 0]) T^{-1}.
+      const unsigned int s_used = n_accepted;
+      FullMatrix<double> T(s_used, s_used);
+      T(0, 0) = 1.;
+      for (unsigned int j = 1; j < s_used; ++j)
+        {
+          T(0, j) = coefficients(n, j - 1);
+          for (unsigned int i = 1; i <= j; ++i)
+            T(i, j) = triangular(i - 1, j - 1);
+        }
+
+      for (unsigned int j = 0; j < s_used; ++j)
+        {
+          const unsigned int col = n + j;
+          for (unsigned int i = 0; i <= n + s_used; ++i)
+            {
+              double value = 0;
+              if (i <= n)
+                value = basis_scaling * coefficients(i, j);
+              else if (i - n - 1 <= j)
+                value = basis_scaling * triangular(i - n - 1, j);
+
+              // subtract H_old P, where column 0 of P is zero as w_0 = q_n
+              if (j > 0 && i <= n)
+                for (unsigned int k = (i == 0 ? 0 : i - 1); k < n; ++k)
+                  value -= hessenberg_matrix(i, k) * coefficients(k, j - 1);
+
+              for (unsigned int l = 0; l < j; ++l)
+                value -= hessenberg_matrix(i, n + l) * T(l, j);
+              hessenberg_matrix(i, col) = value / T(j, j);
+            }
+          // the matrix is upper Hessenberg by construction, so remove
+          // round-off below the first subdiagonal
+          for (unsigned int i = col + 2; i <= n + s_used; ++i)
+            hessenberg_matrix(i, col) = 0.;
+        }
+
+      return s_used;
+    }
+
+
+
+    template <typename Number>
+    inline double
+    ArnoldiProcess<Number>::eliminate_hessenberg_column(const unsigned int col)
+    {
+      return do_givens_rotation(
+        false, col, triangular_matrix, givens_rotations, projected_rhs);
+    }
+
+
+
     template <typename Number>
     inline double
     ArnoldiProcess<Number>::do_givens_rotation(
@@ -1647,9 +1992,25 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
       x_->reinit(x);
     }
 
-  arnoldi_process.initialize(additional_data.orthogonalization_strategy,
-                             basis_size,
-                             additional_data.force_re_orthogonalization);
+  // the s-step variant orthogonalizes the blocks on its own and only uses
+  // the classical Gram-Schmidt setup of the Arnoldi process for the first
+  // vector and the solution of the projected system
+  const bool use_s_step = additional_data.s_step_size > 1;
+  Assert(!use_s_step || use_default_residual,
+         ExcMessage("The s-step variant of SolverGMRES requires the default "
+                    "residual as stopping criterion."));
+
+  // scaling of the monomial basis in the s-step variant, estimated from
+  // the norm of the columns of the Hessenberg matrix; before the first
+  // estimate is available, only blocks of size one are generated
+  double s_step_scaling = 0.;
+
+  arnoldi_process.initialize(
+    use_s_step ?
+      LinearAlgebra::OrthogonalizationStrategy::classical_gram_schmidt :
+      additional_data.orthogonalization_strategy,
+    basis_size,
+    additional_data.force_re_orthogonalization);
 
   ///////////////////////////////////////////////////////////////////////////
   // outer iteration: loop until we either reach convergence or the maximum
@@ -1732,7 +2093,74 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
       // inner iteration doing at most as many steps as the size of the
       // Arnoldi basis
       unsigned int inner_iteration = 0;
-      for (; (inner_iteration < basis_size &&
+
+      // s-step variant: generate several basis vectors by powers of the
+      // operator and orthogonalize them together, then check convergence
+      // for each new column of the Hessenberg matrix
+      while (use_s_step && inner_iteration < basis_size &&
+             iteration_state == SolverControl::iterate)
+        {
+          const unsigned int s =
+            s_step_scaling > 0. ?
+              std::min(additional_data.s_step_size,
+                       basis_size - inner_iteration) :
+              1;
+          const double scaling = s_step_scaling > 0. ? s_step_scaling : 1.;
+
+          for (unsigned int j = 1; j <= s; ++j)
+            {
+              VectorType       &vv = basis_vectors(inner_iteration + j, x);
+              const VectorType &previous =
+                basis_vectors[inner_iteration + j - 1];
+              if (left_precondition)
+                {
+                  A.vmult(p, previous);
+                  preconditioner.vmult(vv, p);
+                }
+              else
+                {
+                  preconditioner.vmult(p, previous);
+                  A.vmult(vv, p);
+                }
+              if (scaling != 1.)
+                vv /= scaling;
+            }
+
+          const unsigned int n_new_vectors =
+            arnoldi_process.orthonormalize_s_step_block(inner_iteration,
+                                                        s,
+                                                        scaling,
+                                                        basis_vectors);
+
+          // the norm of a column of the Hessenberg matrix is the norm of the
+          // operator applied to an orthonormal vector
+          const FullMatrix<double> &H = arnoldi_process.get_hessenberg_matrix();
+          double column_norm          = 0.;
+          for (unsigned int i = 0; i <= inner_iteration + n_new_vectors; ++i)
+            column_norm += H(i, inner_iteration + n_new_vectors - 1) *
+                           H(i, inner_iteration + n_new_vectors - 1);
+          if (column_norm > 0.)
+            s_step_scaling = std::sqrt(column_norm);
+
+          for (unsigned int j = 0; j < n_new_vectors; ++j)
+            {
+              res =
+                arnoldi_process.eliminate_hessenberg_column(inner_iteration);
+              ++inner_iteration;
+              ++accumulated_iterations;
+
+              if (additional_data.batched_mode)
+                iteration_state =
+                  solver_control.check(accumulated_iterations, res);
+              else
+                iteration_state =
+                  this->iteration_status(accumulated_iterations, res, x);
+              if (iteration_state != SolverControl::iterate)
+                break;
+            }
+        }
+
+      for (; (!use_s_step && inner_iteration < basis_size &&
               iteration_state == SolverControl::iterate);
            ++inner_iteration)
         {
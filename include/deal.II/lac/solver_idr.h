@@ -27,9 +27,12 @@
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/solver.h>
 #include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_inner_products.h>
 
+#include <array>
 #include <cmath>
 #include <random>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -114,6 +117,15 @@ namespace internal
  * iteration. If the user enables the history data, the residual at each of
  * these steps is stored and therefore there will be multiple values per
  * iteration.
+ *
+ * Inner products that do not depend on each other, such as the projections
+ * of the residual onto the shadow space and the new column of the small
+ * matrix $M$, are computed together. For LinearAlgebra::distributed::Vector
+ * and LinearAlgebra::distributed::BlockVector, this combines their global
+ * communication into a single reduction. The orthogonalization of the
+ * vectors $G$ against the shadow space uses the modified Gram-Schmidt
+ * process for stability, whose inner products depend on each other and are
+ * therefore computed one after the other.
  */
 template <typename VectorType = Vector<double>>
 DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
@@ -408,6 +420,12 @@ void SolverIDR<VectorType>::solve(const MatrixType         &A,
 
   bool early_exit = false;
 
+  // Inner products that do not depend on each other are computed together,
+  // in order to combine their global communication into a single reduction
+  using VectorPair = internal::SolverInnerProducts::VectorPair<VectorType>;
+  std::vector<VectorPair> pairs;
+  std::vector<value_type> products;
+
   // Outer iteration
   while (iteration_state == SolverControl::iterate)
     {
@@ -415,8 +433,11 @@ void SolverIDR<VectorType>::solve(const MatrixType         &A,
 
       // Compute phi
       Vector<value_type> phi(s);
+      pairs.resize(s);
       for (unsigned int i = 0; i < s; ++i)
-        phi(i) = Q[i] * r;
+        pairs[i] = {&Q[i], &r};
+      internal::SolverInnerProducts::compute<VectorType>(make_array_view(pairs),
+                                                         make_array_view(phi));
 
       // Inner iteration over s
       for (unsigned int k = 0; k < s; ++k)
@@ -475,23 +496,29 @@ void SolverIDR<VectorType>::solve(const MatrixType         &A,
                   if (i % 2 == 1)
                     uhat.add(-alpha_old, U[i - 1], -alpha, U[i]);
                 }
-              M(k, k) = G[k].add_and_dot(-alpha, G[k - 1], Q[k]);
+              G[k].add(-alpha, G[k - 1]);
               if (k % 2 == 1)
                 uhat.add(-alpha, U[k - 1]);
             }
-          else
-            M(k, k) = G[k] * Q[k];
 
           U[k].swap(uhat);
 
-          // Update kth column of M
+          // Update kth column of M, including the diagonal entry, with a
+          // single reduction
+          pairs.resize(s - k);
+          products.resize(s - k);
+          pairs[0] = {&G[k], &Q[k]};
           for (unsigned int i = k + 1; i < s; ++i)
-            M(i, k) = Q[i] * G[k];
+            pairs[i - k] = {&Q[i], &G[k]};
+          internal::SolverInnerProducts::compute<VectorType>(
+            make_array_view(pairs), make_array_view(products));
+          for (unsigned int i = k; i < s; ++i)
+            M(i, k) = products[i - k];
 
           // Orthogonalize r to Q0,...,Qk, update x
           {
             const value_type beta = phi(k) / M(k, k);
-            r.add(-beta, G[k]);
+            res = std::sqrt(std::abs(r.add_and_dot(-beta, G[k], r)));
             x.add(beta, U[k]);
 
             print_vectors(step, x, r, U[k]);
@@ -499,7 +526,6 @@ void SolverIDR<VectorType>::solve(const MatrixType         &A,
             // Check for early convergence. If so, store
             // information in early_exit so that outer iteration
             // is broken before recomputing the residual
-            res             = r.l2_norm();
             iteration_state = this->iteration_status(step, res, x);
             if (iteration_state != SolverControl::iterate)
               {
@@ -524,7 +550,10 @@ void SolverIDR<VectorType>::solve(const MatrixType         &A,
       preconditioner.vmult(uhat, r);
       A.vmult(v, uhat);
 
-      omega = (v * r) / (v * v);
+      const std::array<value_type, 2> dots =
+        internal::SolverInnerProducts::compute<VectorType, 2>(
+          {{{&v, &r}, {&v, &v}}});
+      omega = dots[0] / dots[1];
 
       res = std::sqrt(r.add_and_dot(-1.0 * omega, v, r));
       x.add(omega, uhat);
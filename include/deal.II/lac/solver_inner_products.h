@@ -0,0 +1,230 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_inner_products_h
+#define dealii_solver_inner_products_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  /**
+   * Helper functions for the iterative solvers that need several inner
+   * products per iteration which do not depend on each other. Computing
+   * them together allows to combine all global communication into a single
+   * reduction for the vector types that support it.
+   */
+  namespace SolverInnerProducts
+  {
+    /**
+     * A pair of vectors whose inner product is to be computed.
+     */
+    template <typename VectorType>
+    using VectorPair = std::pair<const VectorType *, const VectorType *>;
+
+
+
+    /**
+     * Generic implementation, which simply computes the inner products one
+     * after the other with the inner product of the vector class.
+     */
+    template <typename VectorType, typename = void>
+    struct InnerProducts
+    {
+      using Number = typename VectorType::value_type;
+
+      static void
+      apply(const ArrayView<const VectorPair<VectorType>> &pairs,
+            const ArrayView<Number>                       &result)
+      {
+        AssertDimension(pairs.size(), result.size());
+        for (unsigned int i = 0; i < pairs.size(); ++i)
+          result[i] = (*pairs[i].first) * (*pairs[i].second);
+      }
+    };
+
+
+
+    /**
+     * Compute the local contributions of the inner products on the locally
+     * owned range of the given pointers. The vectors are traversed in
+     * chunks, such that the entries of a vector that appears in more than
+     * one of the inner products are loaded from main memory only once.
+     */
+    template <typename Number>
+    void
+    add_local_inner_products(
+      const ArrayView<const std::pair<const Number *, const Number *>> &ptrs,
+      const unsigned int                                                size,
+      const ArrayView<Number>                                          &result)
+    {
+      constexpr unsigned int chunk_size = 512;
+      for (unsigned int start = 0; start < size; start += chunk_size)
+        {
+          const unsigned int end = std::min(start + chunk_size, size);
+          for (unsigned int i = 0; i < ptrs.size(); ++i)
+            {
+              const Number *v   = ptrs[i].first;
+              const Number *w   = ptrs[i].second;
+              Number        sum = Number();
+              for (unsigned int j = start; j < end; ++j)
+                sum += v[j] * numbers::NumberTraits<Number>::conjugate(w[j]);
+              result[i] += sum;
+            }
+        }
+    }
+
+
+
+    // Specialization for LinearAlgebra::distributed::Vector, which sums up
+    // the local contributions of all inner products with a single reduction
+    template <typename VectorType>
+    struct InnerProducts<
+      VectorType,
+      std::enable_if_t<
+        std::is_same_v<VectorType,
+                       LinearAlgebra::distributed::
+                         Vector<typename VectorType::value_type,
+                                MemorySpace::Host>>>>
+    {
+      using Number = typename VectorType::value_type;
+
+      static void
+      apply(const ArrayView<const VectorPair<VectorType>> &pairs,
+            const ArrayView<Number>                       &result)
+      {
+        AssertDimension(pairs.size(), result.size());
+        if (pairs.empty())
+          return;
+
+        std::vector<std::pair<const Number *, const Number *>> ptrs(
+          pairs.size());
+        for (unsigned int i = 0; i < pairs.size(); ++i)
+          {
+            AssertDimension(pairs[i].first->locally_owned_size(),
+                            pairs[i].second->locally_owned_size());
+            ptrs[i] = {pairs[i].first->begin(), pairs[i].second->begin()};
+          }
+
+        std::fill(result.begin(), result.end(), Number());
+        add_local_inner_products<Number>(make_array_view(ptrs),
+                                         pairs[0].first->locally_owned_size(),
+                                         result);
+
+        Utilities::MPI::sum(ArrayView<const Number>(result.data(),
+                                                    result.size()),
+                            pairs[0].first->get_mpi_communicator(),
+                            result);
+      }
+    };
+
+
+
+    // Specialization for LinearAlgebra::distributed::BlockVector, which sums
+    // up the local contributions of all blocks and all inner products with a
+    // single reduction
+    template <typename VectorType>
+    struct InnerProducts<
+      VectorType,
+      std::enable_if_t<
+        std::is_same_v<VectorType,
+                       LinearAlgebra::distributed::BlockVector<
+                         typename VectorType::value_type>>>>
+    {
+      using Number = typename VectorType::value_type;
+
+      static void
+      apply(const ArrayView<const VectorPair<VectorType>> &pairs,
+            const ArrayView<Number>                       &result)
+      {
+        AssertDimension(pairs.size(), result.size());
+        std::fill(result.begin(), result.end(), Number());
+        if (pairs.empty() || pairs[0].first->n_blocks() == 0)
+          return;
+
+        std::vector<std::pair<const Number *, const Number *>> ptrs(
+          pairs.size());
+        for (unsigned int b = 0; b < pairs[0].first->n_blocks(); ++b)
+          {
+            for (unsigned int i = 0; i < pairs.size(); ++i)
+              ptrs[i] = {pairs[i].first->block(b).begin(),
+                         pairs[i].second->block(b).begin()};
+            add_local_inner_products<Number>(
+              make_array_view(ptrs),
+              pairs[0].first->block(b).locally_owned_size(),
+              result);
+          }
+
+        Utilities::MPI::sum(ArrayView<const Number>(result.data(),
+                                                    result.size()),
+                            pairs[0].first->block(0).get_mpi_communicator(),
+                            result);
+      }
+    };
+
+
+
+    /**
+     * Compute the inner products `*pairs[i].first * *pairs[i].second` and
+     * store them in @p result.
+     */
+    template <typename VectorType>
+    void
+    compute(const ArrayView<const VectorPair<VectorType>>    &pairs,
+            const ArrayView<typename VectorType::value_type> &result)
+    {
+      InnerProducts<VectorType>::apply(pairs, result);
+    }
+
+
+
+    /**
+     * Same as above for a number of inner products known at compile time.
+     */
+    template <typename VectorType, std::size_t n>
+    std::array<typename VectorType::value_type, n>
+    compute(const std::array<VectorPair<VectorType>, n> &pairs)
+    {
+      std::array<typename VectorType::value_type, n> result;
+      InnerProducts<VectorType>::apply(make_array_view(pairs),
+                                       make_array_view(result));
+      return result;
+    }
+  } // namespace SolverInnerProducts
+} // namespace internal
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,247 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_iterative_refinement_h
+#define dealii_solver_iterative_refinement_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Solvers
+ * @{
+ */
+
+/**
+ * Iterative refinement (defect correction) with an inner solver that works
+ * in a different, typically lower, precision than the outer iteration. In
+ * each step, the residual $r = b - Ax$ is computed in the precision of
+ * @p VectorType, converted into a vector of type @p InnerVectorType, and
+ * an approximate solution $c \approx A^{-1} r$ is computed by the inner
+ * solver in that precision. The correction is then converted back and added
+ * to the solution, $x \leftarrow x + c$. The iteration stops when the norm
+ * of the residual in the outer precision satisfies the SolverControl object
+ * passed to the constructor.
+ *
+ * Since the outer residual is computed in full precision, the iteration
+ * converges to the accuracy of @p VectorType as long as the inner solver
+ * reduces the error by some factor in each step, even though the inner
+ * solves themselves only reach the accuracy of @p InnerVectorType. On the
+ * other hand, the inner solver, which does most of the work, reads and
+ * writes only half the data when running in single instead of double
+ * precision. Typically, a reduction of the inner residual by two or three
+ * orders of magnitude per outer step gives the best overall performance.
+ * The defect is scaled to unit norm before it is handed to the inner solver,
+ * such that the inner precision does not underflow for small residuals.
+ *
+ * The inner solver is any object providing a function `vmult(dst, src)` for
+ * vectors of type @p InnerVectorType that approximately applies the inverse
+ * of the matrix. For a Krylov solver, this is conveniently obtained through
+ * inverse_operator(). The matrix for the inner solver needs to be available
+ * in the inner precision, which for matrix-free operators templated on the
+ * number type means that the operator is set up a second time for that type:
+ * @code
+ * using VectorType      = LinearAlgebra::distributed::Vector<double>;
+ * using InnerVectorType = LinearAlgebra::distributed::Vector<float>;
+ *
+ * LaplaceOperator<dim, fe_degree, double> system_matrix;
+ * LaplaceOperator<dim, fe_degree, float>  system_matrix_float;
+ * // ... set up both operators ...
+ *
+ * ReductionControl                inner_control(100, 1e-30, 1e-3);
+ * SolverGMRES<InnerVectorType>    inner_solver(inner_control);
+ * PreconditionJacobi<LaplaceOperator<dim, fe_degree, float>> inner_prec;
+ * // ... set up the preconditioner ...
+ * const auto inner_inverse =
+ *   inverse_operator(linear_operator<InnerVectorType>(system_matrix_float),
+ *                    inner_solver,
+ *                    inner_prec);
+ *
+ * SolverControl solver_control(100, 1e-12 * rhs.l2_norm());
+ * SolverIterativeRefinement<VectorType, InnerVectorType> solver(
+ *   solver_control);
+ * solver.solve(system_matrix, solution, rhs, inner_inverse);
+ * @endcode
+ * A multigrid V-cycle running on vectors of type @p InnerVectorType, e.g.
+ * PreconditionMG or PreconditionMGMixedPrecision, can be passed directly as
+ * inner solver. Note that an inner Krylov solver must not throw in case it
+ * does not reach its tolerance, so its SolverControl should either be a
+ * ReductionControl with a sufficient number of iterations or an
+ * IterationNumberControl.
+ *
+ * Each step needs one matrix-vector product in the outer precision in
+ * addition to the work of the inner solver.
+ *
+ * @tparam VectorType The vector type of the outer iteration, e.g.
+ * LinearAlgebra::distributed::Vector<double>.
+ * @tparam InnerVectorType The vector type of the inner solver, e.g.
+ * LinearAlgebra::distributed::Vector<float>. It needs to provide a function
+ * `reinit()` from a vector of type @p VectorType and assignment in both
+ * directions, which is the case for the vector classes of deal.II with
+ * different number types.
+ *
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * The solve() function of this class uses the mechanism described in the
+ * Solver base class to determine convergence. This mechanism can also be used
+ * to observe the progress of the iteration.
+ */
+template <typename VectorType = LinearAlgebra::distributed::Vector<double>,
+          typename InnerVectorType = LinearAlgebra::distributed::Vector<float>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverIterativeRefinement : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Standardized data struct to pipe additional data to the solver. This
+   * solver does not need additional data yet.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverIterativeRefinement(SolverControl            &cn,
+                            VectorMemory<VectorType> &mem,
+                            const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverIterativeRefinement(SolverControl        &cn,
+                            const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear system $Ax=b$ for x, using @p inner_solver to compute
+   * the corrections in the precision of @p InnerVectorType.
+   */
+  template <typename MatrixType, typename InnerSolverType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<InnerSolverType, InnerVectorType>))
+  void solve(const MatrixType      &A,
+             VectorType            &x,
+             const VectorType      &b,
+             const InnerSolverType &inner_solver);
+
+protected:
+  /**
+   * Control parameters.
+   */
+  AdditionalData additional_data;
+};
+
+/** @} */
+
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+template <typename VectorType, typename InnerVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverIterativeRefinement<VectorType, InnerVectorType>::
+  SolverIterativeRefinement(SolverControl            &cn,
+                            VectorMemory<VectorType> &mem,
+                            const AdditionalData     &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType, typename InnerVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverIterativeRefinement<VectorType, InnerVectorType>::
+  SolverIterativeRefinement(SolverControl &cn, const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType, typename InnerVectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename InnerSolverType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<InnerSolverType, InnerVectorType>))
+void SolverIterativeRefinement<VectorType, InnerVectorType>::solve(
+  const MatrixType      &A,
+  VectorType            &x,
+  const VectorType      &b,
+  const InnerSolverType &inner_solver)
+{
+  LogStream::Prefix prefix("IterativeRefinement");
+
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  VectorType                                &r = *r_pointer;
+  r.reinit(x, true);
+
+  // the defect and the correction in the precision of the inner solver
+  InnerVectorType inner_defect, inner_correction;
+  inner_defect.reinit(x, true);
+  inner_correction.reinit(x, true);
+
+  A.vmult(r, x);
+  r.sadd(-1., 1., b);
+  double res = r.l2_norm();
+
+  unsigned int         step  = 0;
+  SolverControl::State state = this->iteration_status(step, res, x);
+
+  while (state == SolverControl::iterate)
+    {
+      ++step;
+
+      // scale the defect to unit norm in the outer precision before the
+      // conversion, in order to use the full range of the inner precision
+      r *= 1. / res;
+      inner_defect = r;
+
+      inner_correction = 0.;
+      inner_solver.vmult(inner_correction, inner_defect);
+
+      // convert the correction back, undo the scaling and update the
+      // solution; the vector r is only used as temporary storage here
+      r = inner_correction;
+      x.add(res, r);
+
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+      res = r.l2_norm();
+
+      state = this->iteration_status(step, res, x);
+    }
+
+  if (state != SolverControl::success)
+    AssertThrow(false, SolverControl::NoConvergence(step, res));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -59,6 +59,12 @@ DEAL_II_NAMESPACE_OPEN
  * The algorithm is taken from the Master thesis of Astrid Battermann
  * @cite Battermann1996 with some changes.
  *
+ * Each step needs two inner products, one of which depends on the result of
+ * the preconditioner applied to the vector built with the other one, so the
+ * two global reductions per step cannot be combined without changing the
+ * algorithm. The first inner product is instead fused with the vector update
+ * preceding it, such that the vectors are traversed only once.
+ *
  *
  * <h3>Observing the progress of linear solver iterations</h3>
  *
@@ -281,9 +287,8 @@ void SolverMinRes<VectorType>::solve(const MatrixType         &A,
         v.reinit(b);
 
       A.vmult(*u[2], v);
-      u[2]->add(-std::sqrt(delta[1] / delta[0]), *u[0]);
-
-      const double gamma = *u[2] * v;
+      const double gamma =
+        u[2]->add_and_dot(-std::sqrt(delta[1] / delta[0]), *u[0], v);
       u[2]->add(-gamma / std::sqrt(delta[1]), *u[1]);
       *m[0] = v;
 
@@ -321,9 +326,10 @@ void SolverMinRes<VectorType>::solve(const MatrixType         &A,
       if (j == 1)
         tau = r0 * c;
 
-      m[0]->add(-e[0], *m[1]);
       if (j > 1)
-        m[0]->add(-f[0], *m[2]);
+        m[0]->add(-e[0], *m[1], -f[0], *m[2]);
+      else
+        m[0]->add(-e[0], *m[1]);
       *m[0] *= 1. / d;
       x.add(tau, *m[0]);
       r_l2 *= std::fabs(s);
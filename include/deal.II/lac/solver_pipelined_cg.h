@@ -0,0 +1,537 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_pipelined_cg_h
+#define dealii_solver_pipelined_cg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+DEAL_II_NAMESPACE_OPEN
+
+/** @addtogroup Solvers */
+/** @{ */
+
+/**
+ * This class implements the pipelined preconditioned conjugate gradient
+ * method of P. Ghysels and W. Vanroose, "Hiding global synchronization
+ * latency in the preconditioned Conjugate Gradient algorithm", Parallel
+ * Computing 40 (2014), pp. 224-238. Like SolverCG, it solves linear systems
+ * with a symmetric positive definite matrix and a symmetric positive
+ * definite preconditioner, and computes the same iterates in exact
+ * arithmetic.
+ *
+ * The classical CG method needs two global reductions per iteration that
+ * depend on the result of the matrix-vector product and the preconditioner,
+ * respectively, which means that every iteration must wait twice for the
+ * latency of an MPI_Allreduce. The pipelined variant rewrites the recurrences
+ * with additional auxiliary vectors such that all three scalars needed in an
+ * iteration, $\gamma = (\mathbf r, \mathbf u)$, $\delta = (\mathbf w,
+ * \mathbf u)$ and the residual norm $(\mathbf r, \mathbf r)$, are computed by
+ * a single reduction, which does not depend on the preconditioner
+ * application and the matrix-vector product of the same iteration. When
+ * using LinearAlgebra::distributed::Vector with MemorySpace::Host and a
+ * floating point number type, this reduction is started as a non-blocking
+ * MPI_Iallreduce before the preconditioner and the operator are applied, and
+ * completed afterwards, hiding its latency behind the computations. For
+ * this vector type, the eight vector updates of an iteration and the local
+ * parts of the three inner products for the next iteration are furthermore
+ * fused into a single sweep through the vectors. For all other vector types,
+ * the algorithm runs with blocking inner products and separate vector
+ * updates.
+ *
+ * These benefits come at a price: The method needs ten vectors instead of
+ * four and performs more vector updates than SolverCG, so it only pays off
+ * when the latency of the global reduction dominates, i.e., close to the
+ * strong scaling limit of a computation. Furthermore, the residual is
+ * computed by a recurrence that accumulates more round-off errors than the
+ * one of SolverCG, such that the attainable accuracy may be somewhat
+ * reduced. Finally, because the convergence check becomes available only
+ * after the matrix-vector product of the same iteration, the last iteration
+ * performs one matrix-vector product and preconditioner application whose
+ * results are not used.
+ *
+ * The fused vector updates only involve locally owned entries and run on a
+ * single thread per MPI process, which is the typical setup when the
+ * latency of the reductions is the bottleneck.
+ */
+template <typename VectorType = Vector<double>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverPipelinedCG : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Standardized data struct to pipe additional data to the solver. There is
+   * no data in here for this class.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverPipelinedCG(SolverControl            &cn,
+                    VectorMemory<VectorType> &mem,
+                    const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverPipelinedCG(SolverControl        &cn,
+                    const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear system $Ax=b$ for x.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+  void solve(const MatrixType         &A,
+             VectorType               &x,
+             const VectorType         &b,
+             const PreconditionerType &preconditioner);
+
+protected:
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+};
+
+/** @} */
+
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace SolverPipelinedCG
+  {
+    // The general implementation of the reductions and vector updates of
+    // the pipelined CG method, using blocking inner products and the
+    // operations of the vector class
+    template <typename VectorType, typename = void>
+    struct ReductionsAndUpdates
+    {
+      using Number = typename VectorType::value_type;
+
+      // The three scalars gamma = (r,u), delta = (w,u) and (r,r)
+      std::array<Number, 3> values = {};
+
+      void
+      start_reduction(const VectorType &r,
+                      const VectorType &u,
+                      const VectorType &w)
+      {
+        values[0] = r * u;
+        values[1] = w * u;
+        values[2] = r.norm_sqr();
+      }
+
+      void
+      finish_reduction()
+      {}
+
+      void
+      update_and_start_reduction(const Number      alpha,
+                                 const Number      beta,
+                                 VectorType       &x,
+                                 VectorType       &r,
+                                 VectorType       &u,
+                                 VectorType       &w,
+                                 const VectorType &m,
+                                 const VectorType &n,
+                                 VectorType       &z,
+                                 VectorType       &q,
+                                 VectorType       &s,
+                                 VectorType       &p)
+      {
+        z.sadd(beta, 1., n);
+        q.sadd(beta, 1., m);
+        s.sadd(beta, 1., w);
+        p.sadd(beta, 1., u);
+        x.add(alpha, p);
+        r.add(-alpha, s);
+        u.add(-alpha, q);
+        w.add(-alpha, z);
+        start_reduction(r, u, w);
+      }
+    };
+
+
+
+    // Specialization for LinearAlgebra::distributed::Vector on the host,
+    // which computes the local contributions to the inner products in the
+    // same loop as the vector updates and sums them up with a non-blocking
+    // MPI_Iallreduce
+    template <typename VectorType>
+    struct ReductionsAndUpdates<
+      VectorType,
+      std::enable_if_t<
+        std::is_same_v<VectorType,
+                       LinearAlgebra::distributed::Vector<
+                         typename VectorType::value_type,
+                         MemorySpace::Host>> &&
+        std::is_floating_point_v<typename VectorType::value_type>>>
+    {
+      using Number = typename VectorType::value_type;
+
+      std::array<Number, 3> values = {};
+
+#  ifdef DEAL_II_WITH_MPI
+      MPI_Request request = MPI_REQUEST_NULL;
+#  endif
+
+      ~ReductionsAndUpdates()
+      {
+        // in case the solver is left through an exception while a
+        // reduction is in flight, we must still complete it
+#  ifdef DEAL_II_WITH_MPI
+        if (request != MPI_REQUEST_NULL)
+          MPI_Wait(&request, MPI_STATUS_IGNORE);
+#  endif
+      }
+
+      void
+      start_reduction(const VectorType &r,
+                      const VectorType &u,
+                      const VectorType &w)
+      {
+        const Number      *r_ptr = r.begin();
+        const Number      *u_ptr = u.begin();
+        const Number      *w_ptr = w.begin();
+        const unsigned int size  = r.locally_owned_size();
+
+        constexpr unsigned int n_lanes = VectorizedArray<Number>::size();
+        const unsigned int     end_regular = size / n_lanes * n_lanes;
+
+        std::array<VectorizedArray<Number>, 3> sums = {};
+        for (unsigned int j = 0; j < end_regular; j += n_lanes)
+          {
+            VectorizedArray<Number> rj, uj, wj;
+            rj.load(r_ptr + j);
+            uj.load(u_ptr + j);
+            wj.load(w_ptr + j);
+            sums[0] += rj * uj;
+            sums[1] += wj * uj;
+            sums[2] += rj * rj;
+          }
+        for (unsigned int j = end_regular; j < size; ++j)
+          {
+            sums[0][0] += r_ptr[j] * u_ptr[j];
+            sums[1][0] += w_ptr[j] * u_ptr[j];
+            sums[2][0] += r_ptr[j] * r_ptr[j];
+          }
+
+        submit(sums, r.get_mpi_communicator());
+      }
+
+      void
+      finish_reduction()
+      {
+#  ifdef DEAL_II_WITH_MPI
+        if (request != MPI_REQUEST_NULL)
+          {
+            const int ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+          }
+#  endif
+      }
+
+      void
+      update_and_start_reduction(const Number      alpha,
+                                 const Number      beta,
+                                 VectorType       &x,
+                                 VectorType       &r,
+                                 VectorType       &u,
+                                 VectorType       &w,
+                                 const VectorType &m,
+                                 const VectorType &n,
+                                 VectorType       &z,
+                                 VectorType       &q,
+                                 VectorType       &s,
+                                 VectorType       &p)
+      {
+        Number            *x_ptr = x.begin();
+        Number            *r_ptr = r.begin();
+        Number            *u_ptr = u.begin();
+        Number            *w_ptr = w.begin();
+        const Number      *m_ptr = m.begin();
+        const Number      *n_ptr = n.begin();
+        Number            *z_ptr = z.begin();
+        Number            *q_ptr = q.begin();
+        Number            *s_ptr = s.begin();
+        Number            *p_ptr = p.begin();
+        const unsigned int size  = x.locally_owned_size();
+
+        constexpr unsigned int n_lanes = VectorizedArray<Number>::size();
+        const unsigned int     end_regular = size / n_lanes * n_lanes;
+
+        std::array<VectorizedArray<Number>, 3> sums = {};
+        for (unsigned int j = 0; j < end_regular; j += n_lanes)
+          {
+            VectorizedArray<Number> zj, qj, sj, pj, tmp;
+            zj.load(z_ptr + j);
+            tmp.load(n_ptr + j);
+            zj = beta * zj + tmp;
+            zj.store(z_ptr + j);
+            qj.load(q_ptr + j);
+            tmp.load(m_ptr + j);
+            qj = beta * qj + tmp;
+            qj.store(q_ptr + j);
+
+            VectorizedArray<Number> wj, uj;
+            wj.load(w_ptr + j);
+            sj.load(s_ptr + j);
+            sj = beta * sj + wj;
+            sj.store(s_ptr + j);
+            uj.load(u_ptr + j);
+            pj.load(p_ptr + j);
+            pj = beta * pj + uj;
+            pj.store(p_ptr + j);
+
+            tmp.load(x_ptr + j);
+            tmp += alpha * pj;
+            tmp.store(x_ptr + j);
+
+            VectorizedArray<Number> rj;
+            rj.load(r_ptr + j);
+            rj -= alpha * sj;
+            rj.store(r_ptr + j);
+            uj -= alpha * qj;
+            uj.store(u_ptr + j);
+            wj -= alpha * zj;
+            wj.store(w_ptr + j);
+
+            sums[0] += rj * uj;
+            sums[1] += wj * uj;
+            sums[2] += rj * rj;
+          }
+        for (unsigned int j = end_regular; j < size; ++j)
+          {
+            z_ptr[j] = beta * z_ptr[j] + n_ptr[j];
+            q_ptr[j] = beta * q_ptr[j] + m_ptr[j];
+            s_ptr[j] = beta * s_ptr[j] + w_ptr[j];
+            p_ptr[j] = beta * p_ptr[j] + u_ptr[j];
+            x_ptr[j] += alpha * p_ptr[j];
+            r_ptr[j] -= alpha * s_ptr[j];
+            u_ptr[j] -= alpha * q_ptr[j];
+            w_ptr[j] -= alpha * z_ptr[j];
+
+            sums[0][0] += r_ptr[j] * u_ptr[j];
+            sums[1][0] += w_ptr[j] * u_ptr[j];
+            sums[2][0] += r_ptr[j] * r_ptr[j];
+          }
+
+        submit(sums, x.get_mpi_communicator());
+      }
+
+    private:
+      // Sum up the vectorized partial sums locally and start the global
+      // reduction
+      void
+      submit(const std::array<VectorizedArray<Number>, 3> &sums,
+             const MPI_Comm                                 communicator)
+      {
+        for (unsigned int i = 0; i < 3; ++i)
+          values[i] = sums[i].sum();
+
+#  ifdef DEAL_II_WITH_MPI
+        Assert(request == MPI_REQUEST_NULL, ExcInternalError());
+        if (Utilities::MPI::n_mpi_processes(communicator) > 1)
+          {
+            const int ierr =
+              MPI_Iallreduce(MPI_IN_PLACE,
+                             values.data(),
+                             values.size(),
+                             Utilities::MPI::mpi_type_id_for_type<Number>,
+                             MPI_SUM,
+                             communicator,
+                             &request);
+            AssertThrowMPI(ierr);
+          }
+#  else
+        (void)communicator;
+#  endif
+      }
+    };
+  } // namespace SolverPipelinedCG
+} // namespace internal
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverPipelinedCG<VectorType>::SolverPipelinedCG(SolverControl &cn,
+                                                 VectorMemory<VectorType> &mem,
+                                                 const AdditionalData &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverPipelinedCG<VectorType>::SolverPipelinedCG(SolverControl        &cn,
+                                                 const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename PreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+void SolverPipelinedCG<VectorType>::solve(
+  const MatrixType         &A,
+  VectorType               &x,
+  const VectorType         &b,
+  const PreconditionerType &preconditioner)
+{
+  using number = typename VectorType::value_type;
+
+  SolverControl::State solver_state = SolverControl::iterate;
+
+  LogStream::Prefix prefix("pipelined_cg");
+
+  // Use the names of the vectors of Algorithm 4 of Ghysels and Vanroose:
+  // 'r' is the residual, 'u' the preconditioned residual, 'w' = A*u,
+  // 'm' = M^{-1}*w, 'n' = A*m, and 'p', 's', 'q', 'z' the search direction
+  // and its images under A, M^{-1}*A, and A*M^{-1}*A, respectively
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer u_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer w_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer m_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer n_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer p_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer s_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer q_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer z_pointer(this->memory);
+
+  VectorType &r = *r_pointer;
+  VectorType &u = *u_pointer;
+  VectorType &w = *w_pointer;
+  VectorType &m = *m_pointer;
+  VectorType &n = *n_pointer;
+  VectorType &p = *p_pointer;
+  VectorType &s = *s_pointer;
+  VectorType &q = *q_pointer;
+  VectorType &z = *z_pointer;
+
+  // The vectors that are always overwritten before being read do not need
+  // to be zeroed, whereas the search directions are updated with a factor
+  // beta = 0 in the first iteration and must not contain garbage
+  r.reinit(x, true);
+  u.reinit(x, true);
+  w.reinit(x, true);
+  m.reinit(x, true);
+  n.reinit(x, true);
+  p.reinit(x);
+  s.reinit(x);
+  q.reinit(x);
+  z.reinit(x);
+
+  if (!x.all_zero())
+    {
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+    }
+  else
+    r.equ(1., b);
+
+  preconditioner.vmult(u, r);
+  A.vmult(w, u);
+
+  internal::SolverPipelinedCG::ReductionsAndUpdates<VectorType> reductions;
+  reductions.start_reduction(r, u, w);
+
+  number       previous_gamma = number();
+  number       previous_alpha = number();
+  double       residual_norm  = 0.;
+  unsigned int it             = 0;
+  while (true)
+    {
+      // these operations overlap with the reduction started at the end of
+      // the previous iteration
+      preconditioner.vmult(m, w);
+      A.vmult(n, m);
+
+      reductions.finish_reduction();
+      const number gamma = reductions.values[0];
+      const number delta = reductions.values[1];
+      residual_norm      = std::sqrt(std::abs(reductions.values[2]));
+
+      solver_state = this->iteration_status(it, residual_norm, x);
+      if (solver_state != SolverControl::iterate)
+        break;
+
+      number alpha, beta;
+      if (it == 0)
+        {
+          beta  = number();
+          alpha = gamma / delta;
+        }
+      else
+        {
+          beta  = gamma / previous_gamma;
+          alpha = gamma / (delta - beta * gamma / previous_alpha);
+        }
+      Assert(std::isfinite(std::abs(alpha)),
+             ExcMessage("The pipelined CG method broke down with a zero "
+                        "denominator, which indicates that the matrix or "
+                        "the preconditioner is not positive definite."));
+
+      reductions.update_and_start_reduction(
+        alpha, beta, x, r, u, w, m, n, z, q, s, p);
+
+      previous_gamma = gamma;
+      previous_alpha = alpha;
+      ++it;
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norm));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
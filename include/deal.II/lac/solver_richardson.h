@@ -53,6 +53,14 @@ DEAL_II_NAMESPACE_OPEN
  * which is the only content of the @p AdditionalData structure. By default,
  * the constructor of the structure sets it to one.
  *
+ * Since the norm of the residual is not needed for the iteration itself, this
+ * class skips its computation in the steps for which
+ * SolverControl::check_needed() returns false, see the options
+ * SolverControl::check_frequency() and SolverControl::predict_check_step().
+ * This saves the global reduction of the norm in parallel computations. Note
+ * that functions attached with connect() are then not called in those steps
+ * either.
+ *
  *
  * <h3>Observing the progress of linear solver iterations</h3>
  *
@@ -161,6 +169,12 @@ protected:
    * Control parameters.
    */
   AdditionalData additional_data;
+
+  /**
+   * A reference to the underlying SolverControl object, which is asked
+   * whether the convergence criterion needs to be evaluated in a given step.
+   */
+  SolverControl &solver_control;
 };
 
 /** @} */
@@ -185,6 +199,7 @@ SolverRichardson<VectorType>::SolverRichardson(SolverControl            &cn,
                                                const AdditionalData     &data)
   : SolverBase<VectorType>(cn, mem)
   , additional_data(data)
+  , solver_control(cn)
 {}
 
 
@@ -195,6 +210,7 @@ SolverRichardson<VectorType>::SolverRichardson(SolverControl        &cn,
                                                const AdditionalData &data)
   : SolverBase<VectorType>(cn)
   , additional_data(data)
+  , solver_control(cn)
 {}
 
 
@@ -240,11 +256,15 @@ void SolverRichardson<VectorType>::solve(
       preconditioner.vmult(d, r);
 
       // get the required norm of the (possibly preconditioned)
-      // residual
-      last_criterion = criterion(r, d);
-      conv           = this->iteration_status(iter, last_criterion, x);
-      if (conv != SolverControl::iterate)
-        break;
+      // residual, unless the solver control allows to skip the check in
+      // this step
+      if (solver_control.check_needed(iter))
+        {
+          last_criterion = criterion(r, d);
+          conv           = this->iteration_status(iter, last_criterion, x);
+          if (conv != SolverControl::iterate)
+            break;
+        }
 
       x.add(additional_data.omega, d);
       print_vectors(iter, x, r, d);
@@ -299,10 +319,13 @@ void SolverRichardson<VectorType>::Tsolve(
       r.sadd(-1., 1., b);
       preconditioner.Tvmult(d, r);
 
-      last_criterion = criterion(r, d);
-      conv           = this->iteration_status(iter, last_criterion, x);
-      if (conv != SolverControl::iterate)
-        break;
+      if (solver_control.check_needed(iter))
+        {
+          last_criterion = criterion(r, d);
+          conv           = this->iteration_status(iter, last_criterion, x);
+          if (conv != SolverControl::iterate)
+            break;
+        }
 
       x.add(additional_data.omega, d);
       print_vectors(iter, x, r, d);
@@ -0,0 +1,329 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sparse_amg_h
+#define dealii_sparse_amg_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/observer_pointer.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Preconditioners
+ * @{
+ */
+
+/**
+ * An algebraic multigrid preconditioner based on smoothed aggregation for
+ * symmetric positive definite matrices of type SparseMatrix. In contrast
+ * to TrilinosWrappers::PreconditionAMG and
+ * PETScWrappers::PreconditionBoomerAMG, this class does not depend on any
+ * external library, which makes it a lightweight option, e.g., as a
+ * preconditioner for the coarse-grid solver MGCoarseGridIterativeSolver of
+ * geometric multigrid methods.
+ *
+ * <h3>Setup</h3>
+ *
+ * The hierarchy of levels is built by the following steps, starting from
+ * the matrix $A_0$ passed to initialize():
+ * <ol>
+ * <li> Two rows $i \neq j$ of $A_l$ are considered strongly coupled if
+ * $|a_{ij}| > \theta \sqrt{|a_{ii} a_{jj}|}$ with the threshold $\theta$
+ * given by AdditionalData::strong_threshold. Rows that are not strongly
+ * coupled to any other row, e.g., rows of constrained degrees of freedom,
+ * are left out of the coarse space.
+ * <li> The rows are grouped into aggregates of mutually strongly
+ * coupled rows with the classical three-phase greedy algorithm. The rows are
+ * split into contiguous chunks that are aggregated independently in
+ * parallel, so that aggregates do not extend across chunks.
+ * <li> The tentative prolongator $\tilde P_l$, which interpolates the
+ * constant function on each aggregate, is smoothed by a damped Jacobi
+ * step, $P_l = (I - \omega D_l^{-1} A_l) \tilde P_l$ with
+ * $\omega = \frac{4}{3 \lambda_\text{max}(D_l^{-1} A_l)}$.
+ * <li> The next coarser matrix is computed by the Galerkin product
+ * $A_{l+1} = P_l^T A_l P_l$.
+ * </ol>
+ * The coarsening stops once a level has at most
+ * AdditionalData::max_coarse_size rows, once the maximal number of levels
+ * is reached, or once the aggregation does not reduce the size of the
+ * level sufficiently. On the coarsest level, the matrix is inverted
+ * exactly if it is small enough, otherwise the smoother is applied.
+ *
+ * <h3>Application</h3>
+ *
+ * The vmult() function performs AdditionalData::n_cycles V-cycles with a
+ * zero initial guess. On each level, a PreconditionChebyshev object, whose
+ * eigenvalues are estimated during the setup, is used as pre- and
+ * post-smoother. Since the V-cycle is symmetric, the preconditioner is
+ * symmetric as well and can be used within SolverCG.
+ *
+ * @note The exact inverse on the coarsest level requires the coarsest
+ * matrix to be regular. For singular problems, e.g. pure Neumann problems,
+ * the null space has to be removed from the matrix, e.g. by constraining a
+ * single degree of freedom.
+ */
+template <typename number>
+class SparseAMG : public EnableObserverPointer
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Standardized data struct to pipe additional parameters to the
+   * preconditioner.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const double       strong_threshold       = 0.,
+                   const unsigned int max_coarse_size        = 500,
+                   const unsigned int max_n_levels           = 20,
+                   const unsigned int smoother_degree        = 2,
+                   const double       smoothing_range        = 20.,
+                   const unsigned int n_cycles               = 1,
+                   const unsigned int aggregation_chunk_size = 4096);
+
+    /**
+     * The threshold $\theta$ for two rows to be considered strongly
+     * coupled. The default of zero considers all nonzero off-diagonal entries
+     * as strong couplings, which is suitable for the scalar elliptic problems
+     * discretized by finite elements. Larger values, e.g. 0.02 to 0.1, are
+     * useful for anisotropic problems.
+     */
+    double strong_threshold;
+
+    /**
+     * The maximal number of rows of the coarsest level, which is also the
+     * size up to which the coarsest matrix is inverted exactly.
+     */
+    unsigned int max_coarse_size;
+
+    /**
+     * The maximal number of levels including the finest level.
+     */
+    unsigned int max_n_levels;
+
+    /**
+     * The degree of the Chebyshev polynomial of the smoother, see
+     * PreconditionChebyshev::AdditionalData::degree.
+     */
+    unsigned int smoother_degree;
+
+    /**
+     * The ratio between the largest eigenvalue and the smallest
+     * eigenvalue that the smoother targets, see
+     * PreconditionChebyshev::AdditionalData::smoothing_range.
+     */
+    double smoothing_range;
+
+    /**
+     * The number of V-cycles performed by a single vmult().
+     */
+    unsigned int n_cycles;
+
+    /**
+     * The number of rows aggregated together by a single task. A smaller
+     * value increases the parallelism of the setup, but reduces the quality
+     * of the aggregates, since aggregates do not cross chunk boundaries.
+     */
+    unsigned int aggregation_chunk_size;
+  };
+
+  /**
+   * Constructor. Does nothing except initializing the members.
+   */
+  SparseAMG();
+
+  /**
+   * Set up the multigrid hierarchy for the matrix @p matrix. The matrix
+   * needs to be square, symmetric, positive definite, and needs to live
+   * longer than this object or until clear() is called.
+   */
+  void
+  initialize(const SparseMatrix<number> &matrix,
+             const AdditionalData       &additional_data = AdditionalData());
+
+  /**
+   * Release all the memory and the reference to the matrix.
+   */
+  void
+  clear();
+
+  /**
+   * Apply the preconditioner, i.e., perform the number of V-cycles set by
+   * AdditionalData::n_cycles for the system with right hand side @p src,
+   * starting from a zero initial guess.
+   */
+  void
+  vmult(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Apply the transpose of the preconditioner, which is the same as
+   * vmult() since the V-cycle is symmetric.
+   */
+  void
+  Tvmult(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Return the dimension of the codomain (or range) space.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the dimension of the domain space.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the number of levels of the hierarchy including the finest level.
+   */
+  unsigned int
+  n_levels() const;
+
+  /**
+   * Return the matrix on level @p level, with level zero being the matrix
+   * passed to initialize().
+   */
+  const SparseMatrix<number> &
+  get_level_matrix(const unsigned int level) const;
+
+  /**
+   * Return the operator complexity of the hierarchy, i.e., the sum of the
+   * number of nonzero entries of the matrices on all levels divided by the
+   * number of nonzero entries of the finest matrix.
+   */
+  double
+  operator_complexity() const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The data of a single level of the hierarchy.
+   */
+  struct Level
+  {
+    /**
+     * The sparsity pattern of the matrix of this level (unused on the
+     * finest level, whose matrix is given by the user).
+     */
+    SparsityPattern sparsity;
+
+    /**
+     * The matrix of this level (unused on the finest level).
+     */
+    SparseMatrix<number> matrix;
+
+    /**
+     * The sparsity pattern of the prolongation matrix.
+     */
+    SparsityPattern prolongation_sparsity;
+
+    /**
+     * The prolongation matrix from the next coarser level to this level
+     * (unused on the coarsest level).
+     */
+    SparseMatrix<number> prolongation;
+
+    /**
+     * The smoother of this level.
+     */
+    PreconditionChebyshev<SparseMatrix<number>,
+                          Vector<number>,
+                          DiagonalMatrix<Vector<number>>>
+      smoother;
+
+    /**
+     * Temporary vectors for the solution, right hand side, and residual of
+     * the V-cycle on this level.
+     */
+    mutable Vector<number> solution;
+    mutable Vector<number> rhs;
+    mutable Vector<number> residual;
+  };
+
+  /**
+   * Perform a V-cycle with zero initial guess on level @p level.
+   */
+  void
+  v_cycle(const unsigned int    level,
+          Vector<number>       &dst,
+          const Vector<number> &src) const;
+
+  /**
+   * Return the matrix on level @p level.
+   */
+  const SparseMatrix<number> &
+  level_matrix(const unsigned int level) const;
+
+  /**
+   * The matrix passed to initialize().
+   */
+  ObserverPointer<const SparseMatrix<number>, SparseAMG<number>> matrix;
+
+  /**
+   * The levels of the hierarchy. The objects are stored by pointer since
+   * the matrices and smoothers refer to the sparsity patterns and matrices
+   * by address.
+   */
+  std::vector<std::unique_ptr<Level>> levels;
+
+  /**
+   * The inverse of the coarsest matrix if it is small enough to be inverted
+   * exactly, otherwise empty.
+   */
+  FullMatrix<number> coarse_inverse;
+
+  /**
+   * The number of V-cycles per application.
+   */
+  unsigned int n_cycles;
+
+  /**
+   * Temporary vectors used if more than one V-cycle is performed.
+   */
+  mutable Vector<number> defect;
+  mutable Vector<number> correction;
+};
+
+/** @} */
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -17,6 +17,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/lac/sparse_matrix.h>
 
 #include <cmath>
@@ -323,6 +325,47 @@ protected:
   void
   prebuild_lower_bound();
 
+  /**
+   * Group the rows into levels for the forward substitution with the lower
+   * triangular factor, and for the backward substitution with the upper
+   * triangular factor, such that the rows of one level only depend on rows
+   * of previous levels. The rows within a level can therefore be processed
+   * in parallel (this is also known as level scheduling or wavefront
+   * ordering). The schedules are only set up if more than one thread is
+   * available and if the levels contain enough rows on average to make the
+   * parallel execution worthwhile.
+   */
+  void
+  compute_level_schedule();
+
+  /**
+   * Call @p row_operation for each row such that every row is processed
+   * after all the rows it couples to in the lower triangle (if @p forward is
+   * true) or in the upper triangle (otherwise) of the sparsity pattern. If
+   * compute_level_schedule() has set up a schedule for this direction, the
+   * rows within a level are processed in parallel, otherwise the rows are
+   * processed one after the other in ascending or descending order.
+   */
+  template <typename RowOperation>
+  void
+  apply_in_dependency_order(const bool          forward,
+                            const RowOperation &row_operation) const;
+
+  /**
+   * The rows of the matrix sorted by the levels of the forward
+   * substitution, and the start of each level within this array. Set up by
+   * compute_level_schedule() and empty if no schedule is used.
+   */
+  std::vector<size_type> lower_level_rows;
+  std::vector<size_type> lower_level_starts;
+
+  /**
+   * Same as #lower_level_rows and #lower_level_starts, but for the backward
+   * substitution.
+   */
+  std::vector<size_type> upper_level_rows;
+  std::vector<size_type> upper_level_starts;
+
 private:
   /**
    * In general this pointer is zero except for the case that no
@@ -407,6 +450,53 @@ SparseLUDecomposition<number>::Tvmult_add(OutVector      &dst,
   dst += tmp;
 }
 
+
+
+template <typename number>
+template <typename RowOperation>
+inline void
+SparseLUDecomposition<number>::apply_in_dependency_order(
+  const bool          forward,
+  const RowOperation &row_operation) const
+{
+  const std::vector<size_type> &level_starts =
+    forward ? lower_level_starts : upper_level_starts;
+  const std::vector<size_type> &level_rows =
+    forward ? lower_level_rows : upper_level_rows;
+
+  if (level_starts.empty())
+    {
+      const size_type N = this->m();
+      if (forward)
+        for (size_type row = 0; row < N; ++row)
+          row_operation(row);
+      else
+        for (size_type row = N; row > 0;)
+          row_operation(--row);
+      return;
+    }
+
+  // the minimal number of rows a thread works on
+  const unsigned int grainsize = 256;
+
+  for (unsigned int level = 0; level + 1 < level_starts.size(); ++level)
+    {
+      const auto process_rows = [&](const size_type begin,
+                                    const size_type end) {
+        for (size_type i = begin; i < end; ++i)
+          row_operation(level_rows[i]);
+      };
+
+      if (level_starts[level + 1] - level_starts[level] < 2 * grainsize)
+        process_rows(level_starts[level], level_starts[level + 1]);
+      else
+        parallel::apply_to_subranges(level_starts[level],
+                                     level_starts[level + 1],
+                                     process_rows,
+                                     grainsize);
+    }
+}
+
 //---------------------------------------------------------------------------
 
 
@@ -20,6 +20,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/utilities.h>
 
@@ -27,6 +28,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <numeric>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -56,6 +58,11 @@ SparseLUDecomposition<number>::clear()
   std::vector<const size_type *> tmp;
   tmp.swap(prebuilt_lower_bound);
 
+  lower_level_rows.clear();
+  lower_level_starts.clear();
+  upper_level_rows.clear();
+  upper_level_starts.clear();
+
   SparseMatrix<number>::clear();
 
   if (own_sparsity != nullptr)
@@ -158,6 +165,80 @@ SparseLUDecomposition<number>::prebuild_lower_bound()
     }
 }
 
+template <typename number>
+void
+SparseLUDecomposition<number>::compute_level_schedule()
+{
+  lower_level_rows.clear();
+  lower_level_starts.clear();
+  upper_level_rows.clear();
+  upper_level_starts.clear();
+
+  if (MultithreadInfo::n_threads() == 1)
+    return;
+
+  const size_type *const column_numbers =
+    this->get_sparsity_pattern().colnums.get();
+  const std::size_t *const rowstart_indices =
+    this->get_sparsity_pattern().rowstart.get();
+  const size_type N = this->m();
+
+  // the minimal average number of rows per level for which the level
+  // schedule is used, see apply_in_dependency_order()
+  const size_type min_rows_per_level = 256;
+
+  const auto compute_schedule = [&](const bool              forward,
+                                    std::vector<size_type> &level_rows,
+                                    std::vector<size_type> &level_starts) {
+    // the level of a row is one more than the largest level of the rows it
+    // depends on. we visit the rows in the order of the substitution, so
+    // that the levels of these rows are already known
+    std::vector<unsigned int> level(N, 0);
+    unsigned int              n_levels = 0;
+    for (size_type i = 0; i < N; ++i)
+      {
+        const size_type row       = forward ? i : N - 1 - i;
+        unsigned int    row_level = 0;
+
+        // skip the diagonal element, which is stored first
+        for (std::size_t j = rowstart_indices[row] + 1;
+             j < rowstart_indices[row + 1];
+             ++j)
+          if (forward ? (column_numbers[j] < row) : (column_numbers[j] > row))
+            row_level = std::max(row_level, level[column_numbers[j]] + 1);
+
+        level[row] = row_level;
+        n_levels   = std::max(n_levels, row_level + 1);
+      }
+
+    if (N < n_levels * min_rows_per_level)
+      return;
+
+    // sort the rows by level, keeping the order of the substitution within
+    // each level
+    level_starts.assign(n_levels + 1, 0);
+    for (size_type row = 0; row < N; ++row)
+      ++level_starts[level[row] + 1];
+    std::partial_sum(level_starts.begin(),
+                     level_starts.end(),
+                     level_starts.begin());
+
+    std::vector<size_type> next_index(level_starts.begin(),
+                                      level_starts.end() - 1);
+    level_rows.resize(N);
+    for (size_type i = 0; i < N; ++i)
+      {
+        const size_type row                  = forward ? i : N - 1 - i;
+        level_rows[next_index[level[row]]++] = row;
+      }
+  };
+
+  compute_schedule(true, lower_level_rows, lower_level_starts);
+  compute_schedule(false, upper_level_rows, upper_level_starts);
+}
+
+
+
 template <typename number>
 template <typename somenumber>
 void
@@ -238,7 +319,11 @@ std::size_t
 SparseLUDecomposition<number>::memory_consumption() const
 {
   return (SparseMatrix<number>::memory_consumption() +
-          MemoryConsumption::memory_consumption(prebuilt_lower_bound));
+          MemoryConsumption::memory_consumption(prebuilt_lower_bound) +
+          MemoryConsumption::memory_consumption(lower_level_rows) +
+          MemoryConsumption::memory_consumption(lower_level_starts) +
+          MemoryConsumption::memory_consumption(upper_level_rows) +
+          MemoryConsumption::memory_consumption(upper_level_starts));
 }
 
 
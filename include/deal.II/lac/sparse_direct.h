@@ -22,6 +22,7 @@
 #include <deal.II/base/exceptions.h>
 
 #include <deal.II/lac/block_sparse_matrix.h>
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/sparse_matrix.h>
 #include <deal.II/lac/sparse_matrix_ez.h>
 #include <deal.II/lac/vector.h>
@@ -150,6 +151,26 @@ public:
   void
   factorize(const Matrix &matrix);
 
+  /**
+   * Recompute the factorization for a matrix that has the same sparsity
+   * pattern as the matrix passed to the last call of factorize(), but
+   * different entries, as is the case, e.g., in Newton iterations or in
+   * implicit time stepping schemes. In contrast to factorize(), this
+   * function reuses the symbolic analysis (i.e., the fill-reducing ordering)
+   * of the previous factorization and only recomputes the numerical
+   * factorization, which saves a substantial part of the setup cost.
+   *
+   * If factorize() has not been called before, this function simply calls
+   * factorize().
+   *
+   * @pre The matrix needs to have the same size and sparsity pattern as the
+   * previously factorized one, and needs to be real-valued if and only if
+   * the previously factorized one was.
+   */
+  template <class Matrix>
+  void
+  refactorize(const Matrix &matrix);
+
   /**
    * Initialize memory and call SparseDirectUMFPACK::factorize.
    */
@@ -274,6 +295,16 @@ public:
   solve(BlockVector<std::complex<double>> &rhs_and_solution,
         const bool                         transpose = false) const;
 
+  /**
+   * Solve for several right hand side vectors at once, which are given by
+   * the columns of @p rhs_and_solution. The solutions are returned in place
+   * of the right hand sides. Compared to calling solve() for each column
+   * separately, the workspace of UMFPACK is only allocated once.
+   */
+  void
+  solve(FullMatrix<double> &rhs_and_solution,
+        const bool          transpose = false) const;
+
   /**
    * Call the two functions factorize() and solve() in that order, i.e.
    * perform the whole solution process for the given right hand side vector.
@@ -377,6 +408,8 @@ private:
    * The UMFPACK routines allocate objects in which they store information
    * about symbolic and numeric values of the decomposition. The actual data
    * type of these objects is opaque, and only passed around as void pointers.
+   * The symbolic decomposition is kept after factorize() so that
+   * refactorize() can reuse it.
    */
   void *symbolic_decomposition;
   void *numeric_decomposition;
@@ -387,6 +420,22 @@ private:
   void
   clear();
 
+  /**
+   * Copy the entries of @p matrix into the arrays #Ap, #Ai, #Ax, and #Az in
+   * the sorted format UMFPACK expects.
+   */
+  template <class Matrix>
+  void
+  copy_matrix_entries(const Matrix &matrix);
+
+  /**
+   * Compute the numeric factorization from the arrays #Ap, #Ai, #Ax, and
+   * #Az, using the symbolic factorization stored in
+   * #symbolic_decomposition.
+   */
+  void
+  compute_numeric_factorization();
+
   /**
    * Make sure that the arrays Ai and Ap are sorted in each row. UMFPACK wants
    * it this way. We need to have three versions of this function, one for the
@@ -42,6 +42,13 @@ template <typename Matrix>
 class BlockMatrixBase;
 template <typename number>
 class SparseILU;
+namespace parallel
+{
+  namespace internal
+  {
+    class TBBPartitioner;
+  }
+} // namespace parallel
 #  ifdef DEAL_II_WITH_MPI
 namespace Utilities
 {
@@ -772,6 +779,37 @@ public:
   const SparsityPattern &
   get_sparsity_pattern() const;
 
+  /**
+   * Return the partition of the rows used for the parallel matrix-vector
+   * products. The rows from <tt>get_row_partition()[c]</tt> to
+   * <tt>get_row_partition()[c+1]</tt> form the chunk @p c. The chunks are
+   * balanced by the number of nonzero entries (plus one per row) rather
+   * than by the number of rows, and they are computed when the sparsity
+   * pattern is associated with the matrix in reinit(), using the number of
+   * threads reported by MultithreadInfo::n_threads() at that time.
+   *
+   * The chunks are assigned to threads through an affinity partitioner that
+   * is kept in this object, such that repeated calls to vmult() let the same
+   * thread work on the same rows. Together with the initialization of the
+   * matrix entries (done in reinit()) and of vectors through
+   * reinit_vector_with_row_partition(), this places the data touched by a
+   * thread into the memory of its NUMA domain on systems with a first-touch
+   * policy.
+   */
+  const std::vector<size_type> &
+  get_row_partition() const;
+
+  /**
+   * Resize @p vector to the number of rows of this matrix and set it to zero
+   * with the same assignment of rows to threads as in vmult(), see
+   * get_row_partition(). This only affects the placement of memory pages if
+   * the vector's memory is freshly allocated by this call, i.e., if
+   * @p vector is empty before.
+   */
+  template <typename somenumber>
+  void
+  reinit_vector_with_row_partition(Vector<somenumber> &vector) const;
+
   /**
    * Determine an estimate for the memory consumption (in bytes) of this
    * object. See MemoryConsumption.
@@ -1763,6 +1801,34 @@ private:
    */
   std::size_t max_len;
 
+  /**
+   * Partition of the rows into chunks with a similar number of nonzero
+   * entries, see get_row_partition().
+   */
+  std::vector<size_type> row_partition;
+
+  /**
+   * Affinity partitioner to assign the chunks of #row_partition to the same
+   * threads in repeated loops.
+   */
+  mutable std::shared_ptr<parallel::internal::TBBPartitioner>
+    thread_loop_partitioner;
+
+  /**
+   * Compute #row_partition for the current sparsity pattern.
+   */
+  void
+  compute_row_partition();
+
+  /**
+   * Run @p function on the chunks of rows of #row_partition in parallel.
+   * The function is called with the first and one past the last row of a
+   * contiguous range of rows.
+   */
+  template <typename Function>
+  void
+  apply_to_row_partition(const Function &function) const;
+
   // make all other sparse matrices friends
   template <typename somenumber>
   friend class SparseMatrix;
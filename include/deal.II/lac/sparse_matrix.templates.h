@@ -18,6 +18,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/parallel.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/utilities.h>
@@ -76,10 +78,13 @@ SparseMatrix<number>::SparseMatrix(SparseMatrix<number> &&m) noexcept
   , cols(std::move(m.cols))
   , val(std::move(m.val))
   , max_len(m.max_len)
+  , row_partition(std::move(m.row_partition))
+  , thread_loop_partitioner(std::move(m.thread_loop_partitioner))
 {
   m.cols    = nullptr;
   m.val     = nullptr;
   m.max_len = 0;
+  m.row_partition.clear();
 }
 
 
@@ -104,13 +109,16 @@ template <typename number>
 SparseMatrix<number> &
 SparseMatrix<number>::operator=(SparseMatrix<number> &&m) noexcept
 {
-  cols    = m.cols;
-  val     = std::move(m.val);
-  max_len = m.max_len;
+  cols                    = m.cols;
+  val                     = std::move(m.val);
+  max_len                 = m.max_len;
+  row_partition           = std::move(m.row_partition);
+  thread_loop_partitioner = std::move(m.thread_loop_partitioner);
 
   m.cols    = nullptr;
   m.val     = nullptr;
   m.max_len = 0;
+  m.row_partition.clear();
 
   return *this;
 }
@@ -195,27 +203,17 @@ SparseMatrix<number>::operator=(const double d)
   Assert(cols->compressed || cols->empty(),
          SparsityPattern::ExcNotCompressed());
 
-  // do initial zeroing of elements in parallel. Try to achieve a similar
-  // layout as when doing matrix-vector products, as on some NUMA systems, a
-  // memory block is assigned to memory banks where the first access is
-  // generated. For sparse matrices, the first operations is usually the
-  // operator=. The grain size is chosen to reflect the number of rows in
-  // minimum_parallel_grain_size, weighted by the number of nonzero entries
-  // per row on average.
+  // do initial zeroing of elements in parallel. Use the same layout as when
+  // doing matrix-vector products, as on some NUMA systems, a memory block is
+  // assigned to memory banks where the first access is generated. For sparse
+  // matrices, the first operations is usually the operator=.
   const std::size_t matrix_size = cols->n_nonzero_elements();
-  const size_type   grain_size =
-    internal::SparseMatrixImplementation::minimum_parallel_grain_size *
-    (cols->n_nonzero_elements() + m()) / m();
-  if (matrix_size > grain_size)
-    parallel::apply_to_subranges(
-      0U,
-      matrix_size,
-      [this](const size_type begin, const size_type end) {
-        internal::SparseMatrixImplementation::zero_subrange(begin,
-                                                            end,
-                                                            val.get());
-      },
-      grain_size);
+  if (row_partition.size() > 2)
+    apply_to_row_partition(
+      [this](const size_type begin_row, const size_type end_row) {
+        internal::SparseMatrixImplementation::zero_subrange(
+          cols->rowstart[begin_row], cols->rowstart[end_row], val.get());
+      });
   else if (matrix_size > 0)
     {
       if constexpr (std::is_trivial_v<number>)
@@ -258,13 +256,18 @@ SparseMatrix<number>::reinit(const SparsityPattern &sparsity)
     {
       val.reset();
       max_len = 0;
+      row_partition.clear();
       return;
     }
 
+  compute_row_partition();
+
+  // do not value-initialize the entries here but leave the first touch to
+  // the parallel zeroing below
   const std::size_t N = cols->n_nonzero_elements();
   if (N > max_len || max_len == 0)
     {
-      val     = std::make_unique<number[]>(N);
+      val     = std::unique_ptr<number[]>(new number[N]);
       max_len = N;
     }
 
@@ -273,6 +276,90 @@ SparseMatrix<number>::reinit(const SparsityPattern &sparsity)
 
 
 
+template <typename number>
+void
+SparseMatrix<number>::compute_row_partition()
+{
+  row_partition.clear();
+  const size_type n_rows = m();
+  if (n_rows == 0)
+    return;
+
+  const unsigned int n_threads = MultithreadInfo::n_threads();
+  const size_type    grain_size =
+    std::max(1U,
+             internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+
+  // use a few chunks per thread to balance the remaining differences in the
+  // cost of rows
+  const size_type n_chunks =
+    n_threads > 1 ?
+      std::max<size_type>(
+        1, std::min<size_type>(n_rows / grain_size, 4 * n_threads)) :
+      1;
+
+  // balance the chunks by the number of nonzero entries plus one per row to
+  // account for the cost of writing the result
+  const std::size_t *rowstart = cols->rowstart.get();
+  const std::size_t  n_work   = rowstart[n_rows] + n_rows;
+  row_partition.resize(n_chunks + 1);
+  row_partition[0] = 0;
+  size_type row    = 0;
+  for (size_type c = 1; c < n_chunks; ++c)
+    {
+      const std::size_t target = n_work * c / n_chunks;
+      while (row < n_rows && rowstart[row] + row < target)
+        ++row;
+      row_partition[c] = row;
+    }
+  row_partition[n_chunks] = n_rows;
+
+  // start with a fresh affinity partitioner for the new partition
+  thread_loop_partitioner =
+    std::make_shared<parallel::internal::TBBPartitioner>();
+}
+
+
+
+template <typename number>
+template <typename Function>
+void
+SparseMatrix<number>::apply_to_row_partition(const Function &function) const
+{
+  Assert(row_partition.empty() || row_partition.back() == m(),
+         ExcMessage("The partition of rows does not match the sparsity "
+                    "pattern. Did you forget to call reinit() after changing "
+                    "the sparsity pattern?"));
+
+#ifdef DEAL_II_WITH_TBB
+  if (row_partition.size() > 2 && MultithreadInfo::n_threads() > 1)
+    {
+      std::shared_ptr<tbb::affinity_partitioner> tbb_partitioner =
+        thread_loop_partitioner->acquire_one_partitioner();
+
+      // the grain size of one refers to the chunks of rows, which are
+      // already large enough to amortize the scheduling overhead
+      parallel::internal::parallel_for(
+        size_type(0),
+        size_type(row_partition.size() - 1),
+        [this, &function](const tbb::blocked_range<size_type> &range) {
+          for (size_type c = range.begin(); c < range.end(); ++c)
+            function(row_partition[c], row_partition[c + 1]);
+        },
+        1,
+        tbb_partitioner);
+
+      thread_loop_partitioner->release_one_partitioner(tbb_partitioner);
+      return;
+    }
+#endif
+
+  if (m() > 0)
+    function(size_type(0), m());
+}
+
+
+
 template <typename number>
 void
 SparseMatrix<number>::clear()
@@ -280,6 +367,7 @@ SparseMatrix<number>::clear()
   cols = nullptr;
   val.reset();
   max_len = 0;
+  row_partition.clear();
 }
 
 
@@ -778,9 +866,7 @@ SparseMatrix<number>::vmult(OutVector &dst, const InVector &src) const
 
   Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
 
-  parallel::apply_to_subranges(
-    0U,
-    m(),
+  apply_to_row_partition(
     [this, &src, &dst](const size_type begin_row, const size_type end_row) {
       internal::SparseMatrixImplementation::vmult_on_subrange(
         begin_row,
@@ -791,8 +877,7 @@ SparseMatrix<number>::vmult(OutVector &dst, const InVector &src) const
         src,
         dst,
         false);
-    },
-    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+    });
 }
 
 
@@ -836,9 +921,7 @@ SparseMatrix<number>::vmult_add(OutVector &dst, const InVector &src) const
 
   Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
 
-  parallel::apply_to_subranges(
-    0U,
-    m(),
+  apply_to_row_partition(
     [this, &src, &dst](const size_type begin_row, const size_type end_row) {
       internal::SparseMatrixImplementation::vmult_on_subrange(
         begin_row,
@@ -849,8 +932,7 @@ SparseMatrix<number>::vmult_add(OutVector &dst, const InVector &src) const
         src,
         dst,
         true);
-    },
-    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+    });
 }
 
 
@@ -1904,6 +1986,31 @@ SparseMatrix<number>::get_sparsity_pattern() const
 
 
 
+template <typename number>
+const std::vector<typename SparseMatrix<number>::size_type> &
+SparseMatrix<number>::get_row_partition() const
+{
+  return row_partition;
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrix<number>::reinit_vector_with_row_partition(
+  Vector<somenumber> &vector) const
+{
+  vector.reinit(m(), /*omit_zeroing_entries=*/true);
+  somenumber *const vector_ptr = vector.begin();
+  apply_to_row_partition(
+    [vector_ptr](const size_type begin_row, const size_type end_row) {
+      std::fill(vector_ptr + begin_row, vector_ptr + end_row, somenumber());
+    });
+}
+
+
+
 template <typename number>
 void
 SparseMatrix<number>::print_formatted(std::ostream      &out,
@@ -2086,7 +2193,8 @@ template <typename number>
 std::size_t
 SparseMatrix<number>::memory_consumption() const
 {
-  return max_len * static_cast<std::size_t>(sizeof(number)) + sizeof(*this);
+  return max_len * static_cast<std::size_t>(sizeof(number)) + sizeof(*this) +
+         MemoryConsumption::memory_consumption(row_partition);
 }
 
 
@@ -0,0 +1,379 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sparse_matrix_sell_h
+#define dealii_sparse_matrix_sell_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/exceptions.h>
+
+#include <deal.II/lac/exceptions.h>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+// Forward declarations
+#ifndef DOXYGEN
+template <typename number>
+class Vector;
+template <typename number>
+class SparseMatrix;
+class SparsityPattern;
+#endif
+
+/**
+ * @addtogroup Matrix1
+ * @{
+ */
+
+/**
+ * A sparse matrix in the sliced ELLPACK format with row sorting, also known
+ * as SELL-C-$\sigma$ (see M. Kreutzer, G. Hager, G. Wellein, H. Fehske,
+ * A. R. Bishop, "A unified sparse matrix data format for efficient general
+ * sparse matrix-vector multiplication on modern processors with wide SIMD
+ * units", SIAM J. Sci. Comput. 36 (2014), C401-C423).
+ *
+ * The rows of the matrix are grouped into slices of @p slice_size
+ * consecutive rows. Within a slice, all rows are padded with zeros to the
+ * length of the longest row of the slice, and the entries are stored
+ * column-major, i.e., the $j$-th entry of all @p slice_size rows of the slice
+ * is contiguous in memory. A matrix-vector product then performs
+ * @p slice_size independent multiply-add operations per step, which the
+ * compiler can map to SIMD instructions, with unit-stride access to the
+ * matrix entries. To reduce the padding overhead for matrices with varying
+ * row lengths, the rows are sorted by decreasing length within windows of
+ * $\sigma$ rows (the @p sorting_scope) before forming the slices. This does
+ * not change the meaning of the matrix: vectors are passed in the original
+ * numbering and the permutation is applied when writing the result.
+ *
+ * The class is not meant to be assembled into. Rather, it is set up from a
+ * SparsityPattern or a SparseMatrix, with the values copied from a
+ * SparseMatrix by copy_from() (which can be called repeatedly as long as the
+ * sparsity pattern does not change). It provides the operations needed by
+ * the iterative solvers such as SolverCG and by preconditioners such as
+ * PreconditionChebyshev, namely vmult(), Tvmult(), the diagonal through
+ * diag_element(), and precondition_Jacobi().
+ *
+ * The slice size is chosen such that one step within a slice fills a cache
+ * line of entries (8 rows for @p double and 16 rows for @p float), which
+ * matches the SIMD width of AVX-512.
+ */
+template <typename number>
+class SparseMatrixSELL : public EnableObserverPointer
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Type of matrix entries.
+   */
+  using value_type = number;
+
+  /**
+   * Number of rows in a slice.
+   */
+  static constexpr unsigned int slice_size = 64 / sizeof(number);
+
+  /**
+   * Constructor. Initializes an empty matrix of dimension zero times zero.
+   */
+  SparseMatrixSELL() = default;
+
+  /**
+   * Constructor. Set up the structure from the sparsity pattern of
+   * @p matrix and copy its values, see reinit() for the meaning of
+   * @p sorting_scope.
+   */
+  template <typename number2>
+  explicit SparseMatrixSELL(const SparseMatrix<number2> &matrix,
+                            const unsigned int sorting_scope = 16 *
+                                                               slice_size);
+
+  /**
+   * Set up the slices for the given sparsity pattern and set all entries to
+   * zero. The rows are sorted by their length within consecutive windows of
+   * @p sorting_scope rows. A value of one disables the sorting, a value of
+   * at least the number of rows sorts all rows globally, which minimizes
+   * the padding but may destroy the locality of the accesses to the vector
+   * entries.
+   */
+  void
+  reinit(const SparsityPattern &sparsity,
+         const unsigned int     sorting_scope = 16 * slice_size);
+
+  /**
+   * Copy the values of @p matrix into this object. The sparsity pattern of
+   * @p matrix must be the same as the one passed to reinit().
+   */
+  template <typename number2>
+  void
+  copy_from(const SparseMatrix<number2> &matrix);
+
+  /**
+   * Release all memory and return to a state just like after having called
+   * the default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Return whether the object is empty, i.e., whether one of the dimensions
+   * is zero.
+   */
+  bool
+  empty() const;
+
+  /**
+   * Return the number of rows of this matrix.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of this matrix.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the number of nonzero elements of the original sparsity pattern.
+   */
+  std::size_t
+  n_nonzero_elements() const;
+
+  /**
+   * Return the number of stored entries, including the zeros added for
+   * padding the slices.
+   */
+  std::size_t
+  n_stored_elements() const;
+
+  /**
+   * Return the value of the entry (@p i,@p j), or zero if the entry is not
+   * part of the sparsity pattern. This function needs to search through the
+   * slice of row @p i and is meant for occasional access only.
+   */
+  number
+  el(const size_type i, const size_type j) const;
+
+  /**
+   * Return the diagonal entry in row @p i. The matrix must be square.
+   */
+  number
+  diag_element(const size_type i) const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M*src$ with $M$ being this
+   * matrix. The slices are processed in parallel.
+   */
+  template <typename somenumber>
+  void
+  vmult(Vector<somenumber> &dst, const Vector<somenumber> &src) const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M^T*src$ with $M$ being this
+   * matrix.
+   */
+  template <typename somenumber>
+  void
+  Tvmult(Vector<somenumber> &dst, const Vector<somenumber> &src) const;
+
+  /**
+   * Adding matrix-vector multiplication: add $M*src$ to $dst$ with $M$ being
+   * this matrix.
+   */
+  template <typename somenumber>
+  void
+  vmult_add(Vector<somenumber> &dst, const Vector<somenumber> &src) const;
+
+  /**
+   * Adding matrix-vector multiplication: add $M^T*src$ to $dst$ with $M$
+   * being this matrix.
+   */
+  template <typename somenumber>
+  void
+  Tvmult_add(Vector<somenumber> &dst, const Vector<somenumber> &src) const;
+
+  /**
+   * Apply the Jacobi preconditioner, which multiplies every element of the
+   * @p src vector by the inverse of the respective diagonal element and
+   * multiplies the result with the damping factor @p omega.
+   */
+  template <typename somenumber>
+  void
+  precondition_Jacobi(Vector<somenumber>       &dst,
+                      const Vector<somenumber> &src,
+                      const number              omega = 1.) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * @addtogroup Exceptions
+   * @{
+   */
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcDifferentSparsityPattern,
+                   "The sparsity pattern of the given matrix does not match "
+                   "the one used to set up this object.");
+  /** @} */
+
+private:
+  /**
+   * Compute the product of the matrix with @p src on the slices in the
+   * half-open interval [@p begin_slice, @p end_slice).
+   */
+  template <typename somenumber>
+  void
+  vmult_on_subrange(const size_type           begin_slice,
+                    const size_type           end_slice,
+                    Vector<somenumber>       &dst,
+                    const Vector<somenumber> &src,
+                    const bool                add) const;
+
+  /**
+   * Number of rows.
+   */
+  size_type n_rows = 0;
+
+  /**
+   * Number of columns.
+   */
+  size_type n_cols = 0;
+
+  /**
+   * Number of entries in the original sparsity pattern.
+   */
+  std::size_t n_nonzero = 0;
+
+  /**
+   * For each slice, the index of the first entry in @p values and
+   * @p column_indices. The width of a slice is given by the difference of
+   * two consecutive entries divided by @p slice_size.
+   */
+  std::vector<std::size_t> slice_start;
+
+  /**
+   * For each position within the slices, the row of the matrix stored
+   * there, or numbers::invalid_size_type for the padding rows of the last
+   * slice.
+   */
+  std::vector<size_type> row_of_position;
+
+  /**
+   * The inverse of @p row_of_position, i.e., the position of each row of
+   * the matrix within the slices.
+   */
+  std::vector<size_type> position_of_row;
+
+  /**
+   * The column indices of the entries, stored slice by slice and
+   * column-major within a slice. Padding entries refer to a valid column
+   * of the same row to keep the vector access in bounds.
+   */
+  std::vector<size_type> column_indices;
+
+  /**
+   * The values of the entries in the same layout as @p column_indices, with
+   * zeros for the padding.
+   */
+  std::vector<number> values;
+
+  /**
+   * The diagonal of a square matrix, which is needed in
+   * precondition_Jacobi() and diag_element().
+   */
+  std::vector<number> diagonal;
+};
+
+/** @} */
+
+#ifndef DOXYGEN
+/*---------------------- Inline functions -----------------------------------*/
+
+
+
+template <typename number>
+inline bool
+SparseMatrixSELL<number>::empty() const
+{
+  return n_rows == 0 || n_cols == 0;
+}
+
+
+
+template <typename number>
+inline typename SparseMatrixSELL<number>::size_type
+SparseMatrixSELL<number>::m() const
+{
+  return n_rows;
+}
+
+
+
+template <typename number>
+inline typename SparseMatrixSELL<number>::size_type
+SparseMatrixSELL<number>::n() const
+{
+  return n_cols;
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixSELL<number>::n_nonzero_elements() const
+{
+  return n_nonzero;
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixSELL<number>::n_stored_elements() const
+{
+  return values.size();
+}
+
+
+
+template <typename number>
+inline number
+SparseMatrixSELL<number>::diag_element(const size_type i) const
+{
+  AssertDimension(m(), n());
+  AssertIndexRange(i, m());
+  return diagonal[i];
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,375 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sparse_matrix_sell_templates_h
+#define dealii_sparse_matrix_sell_templates_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparse_matrix_sell.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <algorithm>
+#include <numeric>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+template <typename number>
+template <typename number2>
+SparseMatrixSELL<number>::SparseMatrixSELL(const SparseMatrix<number2> &matrix,
+                                           const unsigned int sorting_scope)
+{
+  reinit(matrix.get_sparsity_pattern(), sorting_scope);
+  copy_from(matrix);
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::reinit(const SparsityPattern &sparsity,
+                                 const unsigned int     sorting_scope)
+{
+  Assert(sparsity.is_compressed(), SparsityPattern::ExcNotCompressed());
+  Assert(sorting_scope > 0, ExcMessage("The sorting scope must be positive."));
+
+  n_rows    = sparsity.n_rows();
+  n_cols    = sparsity.n_cols();
+  n_nonzero = sparsity.n_nonzero_elements();
+
+  // sort the rows by decreasing length within each window of sorting_scope
+  // rows, keeping the original order for rows of the same length
+  std::vector<size_type> sorted_rows(n_rows);
+  std::iota(sorted_rows.begin(), sorted_rows.end(), size_type(0));
+  if (sorting_scope > 1)
+    for (size_type start = 0; start < n_rows; start += sorting_scope)
+      std::stable_sort(sorted_rows.begin() + start,
+                       sorted_rows.begin() +
+                         std::min<size_type>(start + sorting_scope, n_rows),
+                       [&sparsity](const size_type a, const size_type b) {
+                         return sparsity.row_length(a) > sparsity.row_length(b);
+                       });
+
+  const size_type n_slices = (n_rows + slice_size - 1) / slice_size;
+  row_of_position.assign(n_slices * slice_size, numbers::invalid_size_type);
+  std::copy(sorted_rows.begin(), sorted_rows.end(), row_of_position.begin());
+  position_of_row.resize(n_rows);
+  for (size_type p = 0; p < n_rows; ++p)
+    position_of_row[sorted_rows[p]] = p;
+
+  slice_start.resize(n_slices + 1);
+  slice_start[0] = 0;
+  for (size_type s = 0; s < n_slices; ++s)
+    {
+      unsigned int width = 0;
+      for (unsigned int c = 0; c < slice_size; ++c)
+        {
+          const size_type row = row_of_position[s * slice_size + c];
+          if (row != numbers::invalid_size_type)
+            width = std::max(width, sparsity.row_length(row));
+        }
+      slice_start[s + 1] =
+        slice_start[s] + static_cast<std::size_t>(width) * slice_size;
+    }
+
+  column_indices.resize(slice_start.back());
+  values.clear();
+  values.resize(slice_start.back(), number());
+
+  for (size_type s = 0; s < n_slices; ++s)
+    {
+      const std::size_t width = (slice_start[s + 1] - slice_start[s]) /
+                                slice_size;
+      for (unsigned int c = 0; c < slice_size; ++c)
+        {
+          const size_type    row = row_of_position[s * slice_size + c];
+          const unsigned int row_length =
+            row != numbers::invalid_size_type ? sparsity.row_length(row) : 0;
+
+          // pad with the last column of the row (or the first column for
+          // empty rows), which is guaranteed to be in bounds
+          size_type padding_column = 0;
+          for (unsigned int k = 0; k < row_length; ++k)
+            {
+              padding_column = sparsity.column_number(row, k);
+              column_indices[slice_start[s] + k * slice_size + c] =
+                padding_column;
+            }
+          for (std::size_t k = row_length; k < width; ++k)
+            column_indices[slice_start[s] + k * slice_size + c] =
+              padding_column;
+        }
+    }
+
+  diagonal.clear();
+  if (n_rows == n_cols)
+    diagonal.resize(n_rows, number());
+}
+
+
+
+template <typename number>
+template <typename number2>
+void
+SparseMatrixSELL<number>::copy_from(const SparseMatrix<number2> &matrix)
+{
+  Assert(matrix.m() == n_rows && matrix.n() == n_cols &&
+           matrix.n_nonzero_elements() == n_nonzero,
+         ExcDifferentSparsityPattern());
+
+  const size_type n_slices = slice_start.size() - 1;
+  for (size_type s = 0; s < n_slices; ++s)
+    for (unsigned int c = 0; c < slice_size; ++c)
+      {
+        const size_type row = row_of_position[s * slice_size + c];
+        if (row == numbers::invalid_size_type)
+          continue;
+
+        std::size_t index = slice_start[s] + c;
+        for (auto entry = matrix.begin(row); entry != matrix.end(row);
+             ++entry, index += slice_size)
+          {
+            AssertIndexRange(index, slice_start[s + 1]);
+            Assert(column_indices[index] == entry->column(),
+                   ExcDifferentSparsityPattern());
+            values[index] = entry->value();
+            if (entry->column() == row && diagonal.size() > 0)
+              diagonal[row] = entry->value();
+          }
+      }
+}
+
+
+
+template <typename number>
+number
+SparseMatrixSELL<number>::el(const size_type i, const size_type j) const
+{
+  AssertIndexRange(i, m());
+  AssertIndexRange(j, n());
+
+  const size_type   position = position_of_row[i];
+  const size_type   s        = position / slice_size;
+  const std::size_t end      = slice_start[s + 1];
+
+  // the padding entries repeat the last column of the row with a zero value,
+  // so the first match is the actual entry
+  for (std::size_t index = slice_start[s] + position % slice_size; index < end;
+       index += slice_size)
+    if (column_indices[index] == j)
+      return values[index];
+
+  return number();
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::clear()
+{
+  n_rows    = 0;
+  n_cols    = 0;
+  n_nonzero = 0;
+  slice_start.clear();
+  row_of_position.clear();
+  position_of_row.clear();
+  column_indices.clear();
+  values.clear();
+  diagonal.clear();
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrixSELL<number>::vmult_on_subrange(const size_type     begin_slice,
+                                            const size_type     end_slice,
+                                            Vector<somenumber> &dst,
+                                            const Vector<somenumber> &src,
+                                            const bool add) const
+{
+  const somenumber *src_ptr = src.begin();
+  somenumber       *dst_ptr = dst.begin();
+
+  for (size_type s = begin_slice; s < end_slice; ++s)
+    {
+      const std::size_t begin = slice_start[s];
+      const std::size_t width = (slice_start[s + 1] - begin) / slice_size;
+
+      const number    *val_ptr = values.data() + begin;
+      const size_type *col_ptr = column_indices.data() + begin;
+
+      somenumber sums[slice_size] = {};
+      for (std::size_t k = 0; k < width;
+           ++k, val_ptr += slice_size, col_ptr += slice_size)
+        {
+          DEAL_II_OPENMP_SIMD_PRAGMA
+          for (unsigned int c = 0; c < slice_size; ++c)
+            sums[c] += somenumber(val_ptr[c]) * src_ptr[col_ptr[c]];
+        }
+
+      const size_type *rows = row_of_position.data() + s * slice_size;
+      for (unsigned int c = 0; c < slice_size; ++c)
+        if (rows[c] != numbers::invalid_size_type)
+          {
+            if (add)
+              dst_ptr[rows[c]] += sums[c];
+            else
+              dst_ptr[rows[c]] = sums[c];
+          }
+    }
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrixSELL<number>::vmult(Vector<somenumber>       &dst,
+                                const Vector<somenumber> &src) const
+{
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  parallel::apply_to_subranges(
+    size_type(0),
+    size_type(slice_start.size() - 1),
+    [this, &src, &dst](const size_type begin, const size_type end) {
+      vmult_on_subrange(begin, end, dst, src, false);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+      slice_size);
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrixSELL<number>::vmult_add(Vector<somenumber>       &dst,
+                                    const Vector<somenumber> &src) const
+{
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  parallel::apply_to_subranges(
+    size_type(0),
+    size_type(slice_start.size() - 1),
+    [this, &src, &dst](const size_type begin, const size_type end) {
+      vmult_on_subrange(begin, end, dst, src, true);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+      slice_size);
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrixSELL<number>::Tvmult(Vector<somenumber>       &dst,
+                                 const Vector<somenumber> &src) const
+{
+  dst = somenumber();
+  Tvmult_add(dst, src);
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrixSELL<number>::Tvmult_add(Vector<somenumber>       &dst,
+                                     const Vector<somenumber> &src) const
+{
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), m());
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  // the transpose product scatters into the destination vector, which we
+  // cannot do in parallel without synchronization
+  const somenumber *src_ptr  = src.begin();
+  somenumber       *dst_ptr  = dst.begin();
+  const size_type   n_slices = slice_start.size() - 1;
+  for (size_type s = 0; s < n_slices; ++s)
+    {
+      const std::size_t begin = slice_start[s];
+      const std::size_t width = (slice_start[s + 1] - begin) / slice_size;
+
+      const size_type *rows = row_of_position.data() + s * slice_size;
+      somenumber       src_values[slice_size];
+      for (unsigned int c = 0; c < slice_size; ++c)
+        src_values[c] =
+          rows[c] != numbers::invalid_size_type ? src_ptr[rows[c]] : 0;
+
+      const number    *val_ptr = values.data() + begin;
+      const size_type *col_ptr = column_indices.data() + begin;
+      for (std::size_t k = 0; k < width;
+           ++k, val_ptr += slice_size, col_ptr += slice_size)
+        for (unsigned int c = 0; c < slice_size; ++c)
+          dst_ptr[col_ptr[c]] += somenumber(val_ptr[c]) * src_values[c];
+    }
+}
+
+
+
+template <typename number>
+template <typename somenumber>
+void
+SparseMatrixSELL<number>::precondition_Jacobi(Vector<somenumber>       &dst,
+                                              const Vector<somenumber> &src,
+                                              const number omega) const
+{
+  AssertDimension(m(), n());
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), n());
+
+  const somenumber *src_ptr = src.begin();
+  somenumber       *dst_ptr = dst.begin();
+  for (size_type i = 0; i < n_rows; ++i)
+    {
+      Assert(diagonal[i] != number(), ExcDivideByZero());
+      dst_ptr[i] = src_ptr[i] * somenumber(omega / diagonal[i]);
+    }
+}
+
+
+
+template <typename number>
+std::size_t
+SparseMatrixSELL<number>::memory_consumption() const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(slice_start) +
+         MemoryConsumption::memory_consumption(row_of_position) +
+         MemoryConsumption::memory_consumption(position_of_row) +
+         MemoryConsumption::memory_consumption(column_indices) +
+         MemoryConsumption::memory_consumption(values) +
+         MemoryConsumption::memory_consumption(diagonal);
+}
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -25,9 +25,10 @@
 // kernels. If no value is given by the user during
 // compilation, we choose its value so that all number of rows are pre-compiled
 // to support smoothers for cell-centered patches with overlap for continuous
-// elements with degrees up to FE_EVAL_FACTORY_DEGREE_MAX (default value 6).
+// elements with degrees up to FE_EVAL_FACTORY_DEGREE_MAX (default value set
+// by the CMake variable DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX).
 #  ifndef FE_EVAL_FACTORY_DEGREE_MAX
-#    define FDM_N_ROWS_MAX 17
+#    define FDM_N_ROWS_MAX (DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX * 3 - 1)
 #  else
 #    define FDM_N_ROWS_MAX (FE_EVAL_FACTORY_DEGREE_MAX * 3 - 1)
 #  endif
@@ -1574,6 +1574,27 @@ namespace TrilinosWrappers
        * settings as for the smoother type are possible.
        */
       const char *coarse_type;
+
+      /**
+       * If this flag is set to <tt>true</tt>, ML keeps the aggregates
+       * computed by initialize(). This allows reinit() to recompute the
+       * multilevel hierarchy for a matrix whose entries have changed, but
+       * whose sparsity pattern is the same, by only recomputing the
+       * prolongation and restriction operators, the coarse level matrices,
+       * the smoothers, and the coarse solver, skipping the aggregation. This
+       * corresponds to the ML option <tt>reuse: enable</tt>. The default is
+       * <tt>false</tt>.
+       */
+      bool reuse_aggregates;
+
+      /**
+       * The factor by which the number of iterations of the linear solver
+       * may grow, relative to the first solve after a full setup of the
+       * preconditioner, before update() performs a new full setup instead of
+       * reusing the aggregates. A value of zero disables the automatic full
+       * setup. The default is 1.5.
+       */
+      double rebuild_iteration_factor;
     };
 
     /**
@@ -1666,10 +1687,38 @@ namespace TrilinosWrappers
      * considerably faster than the initialize function, since the coarsening
      * pattern is usually the most difficult thing to do when setting up the
      * AMG ML preconditioner.
+     *
+     * The matrix is the one given to initialize(), which must still exist.
+     * For the coarsening structure to be available, the preconditioner must
+     * have been set up with AdditionalData::reuse_aggregates set to
+     * <tt>true</tt>, or with the ML option <tt>reuse: enable</tt>.
      */
     void
     reinit();
 
+    /**
+     * Update the preconditioner for the changed entries of @p matrix, as is
+     * typically done in every time step or Newton iteration, choosing
+     * between a full setup with initialize() and the cheaper reinit():
+     * - A full setup is done if the preconditioner has not been set up yet,
+     *   if it has been set up for a different matrix object, or if
+     *   AdditionalData::reuse_aggregates is <tt>false</tt>.
+     * - Otherwise, @p n_iterations is interpreted as the number of
+     *   iterations of the last linear solve with this preconditioner. The
+     *   number of the first solve after a full setup serves as reference,
+     *   and a full setup is done once the number of iterations exceeds
+     *   AdditionalData::rebuild_iteration_factor times this reference,
+     *   because the reused aggregates no longer fit the matrix. In all other
+     *   cases, reinit() is called.
+     *
+     * The sparsity pattern of @p matrix must not change between calls to
+     * this function unless the matrix object is also reinitialized.
+     */
+    void
+    update(const SparseMatrix   &matrix,
+           const AdditionalData &additional_data = AdditionalData(),
+           const unsigned int    n_iterations    = 0);
+
     /**
      * Destroys the preconditioner, leaving an object like just after having
      * called the constructor.
@@ -1688,6 +1737,18 @@ namespace TrilinosWrappers
      * A copy of the deal.II matrix into Trilinos format.
      */
     std::shared_ptr<SparseMatrix> trilinos_matrix;
+
+    /**
+     * The matrix the preconditioner has been set up for by the last call to
+     * initialize(), used by update() to detect a change of the matrix.
+     */
+    const Epetra_RowMatrix *setup_matrix = nullptr;
+
+    /**
+     * The number of iterations of the first solve after the last full
+     * setup, as reported to update(), or zero if not known yet.
+     */
+    unsigned int n_iterations_after_setup = 0;
   };
 
 
@@ -1844,6 +1905,15 @@ namespace TrilinosWrappers
        * settings as for the smoother type are possible.
        */
       const char *coarse_type;
+
+      /**
+       * The factor by which the number of iterations of the linear solver
+       * may grow, relative to the first solve after a full setup of the
+       * preconditioner, before update() performs a new full setup instead of
+       * calling reinit(). A value of zero disables the automatic full setup.
+       * The default is 1.5.
+       */
+      double rebuild_iteration_factor;
     };
 
     /**
@@ -1914,6 +1984,38 @@ namespace TrilinosWrappers
                const double          drop_tolerance  = 1e-13,
                const ::dealii::SparsityPattern *use_this_sparsity = nullptr);
 
+    /**
+     * Recompute the multilevel hierarchy after the entries of the matrix
+     * given to initialize() have changed, but its sparsity pattern has
+     * remained the same. This calls MueLu::ReuseEpetraPreconditioner(),
+     * which keeps the hierarchy object and recomputes those parts of it
+     * that the MueLu option <tt>reuse: type</tt> marks as not reusable. For
+     * instance, <tt>reuse: type</tt> set to <tt>tP</tt> keeps the tentative
+     * prolongators, i.e., the aggregates and the near null space, and
+     * recomputes the smoothed prolongators, the coarse level matrices, the
+     * smoothers, and the coarse solver. This option needs to be given in a
+     * parameter list with MueLu syntax to the initialize() function taking
+     * a Teuchos::ParameterList; for the ML syntax used with AdditionalData,
+     * the whole hierarchy is recomputed in place.
+     */
+    void
+    reinit();
+
+    /**
+     * Update the preconditioner for the changed entries of @p matrix,
+     * choosing between a full setup with initialize() and the cheaper
+     * reinit() in the same way as PreconditionAMG::update(): A full setup
+     * is done if the preconditioner has not been set up yet, if it has been
+     * set up for a different matrix object, or if @p n_iterations, the
+     * number of iterations of the last linear solve, exceeds
+     * AdditionalData::rebuild_iteration_factor times the number of the
+     * first solve after the last full setup. Otherwise, reinit() is called.
+     */
+    void
+    update(const SparseMatrix   &matrix,
+           const AdditionalData &additional_data = AdditionalData(),
+           const unsigned int    n_iterations    = 0);
+
     /**
      * Destroys the preconditioner, leaving an object like just after having
      * called the constructor.
@@ -1932,6 +2034,18 @@ namespace TrilinosWrappers
      * A copy of the deal.II matrix into Trilinos format.
      */
     std::shared_ptr<SparseMatrix> trilinos_matrix;
+
+    /**
+     * The matrix the preconditioner has been set up for by the last call to
+     * initialize(), used by reinit() and update().
+     */
+    const Epetra_CrsMatrix *setup_matrix = nullptr;
+
+    /**
+     * The number of iterations of the first solve after the last full
+     * setup, as reported to update(), or zero if not known yet.
+     */
+    unsigned int n_iterations_after_setup = 0;
   };
 #  endif
 
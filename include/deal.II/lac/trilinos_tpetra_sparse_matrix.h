@@ -547,6 +547,35 @@ namespace LinearAlgebra
       void
       add(const Number factor, const SparseMatrix<Number, MemorySpace> &matrix);
 
+      /**
+       * Add a set of element matrices into this matrix without leaving the
+       * memory space of the matrix. The entry <tt>(e, i, j)</tt> of
+       * @p element_matrices is added to the entry of the matrix in the row
+       * <tt>dof_indices(e, i)</tt> and the column <tt>dof_indices(e, j)</tt>.
+       * Both views live in the memory space of the matrix, so that element
+       * matrices computed in a Kokkos kernel, e.g. by a Portable::MatrixFree
+       * cell loop, can be scattered into the local matrix of the underlying
+       * Tpetra::CrsMatrix on the device. Since several elements usually
+       * contribute to the same entry, the values are summed with atomic
+       * operations.
+       *
+       * In contrast to the other add() functions, this function neither
+       * applies constraints nor communicates: all the rows must be locally
+       * owned and all the entries must be part of the sparsity pattern of
+       * the matrix, otherwise an exception is thrown. Element matrices with
+       * constrained or ghosted degrees of freedom must be added through
+       * AffineConstraints::distribute_local_to_global() instead. Calling
+       * compress() afterwards is not necessary but harmless.
+       *
+       * @note This function requires Trilinos 13.2 or newer.
+       */
+      void
+      add_element_matrices(
+        const Kokkos::View<const Number ***, typename MemorySpace::kokkos_space>
+          &element_matrices,
+        const Kokkos::View<const size_type **,
+                           typename MemorySpace::kokkos_space> &dof_indices);
+
       /**
        * Set the element (<i>i,j</i>) to @p value.
        *
@@ -1251,6 +1251,81 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpace>
+    void
+    SparseMatrix<Number, MemorySpace>::add_element_matrices(
+      const Kokkos::View<const Number ***, typename MemorySpace::kokkos_space>
+        &element_matrices,
+      const Kokkos::View<const size_type **, typename MemorySpace::kokkos_space>
+        &dof_indices)
+    {
+      AssertDimension(element_matrices.extent(0), dof_indices.extent(0));
+      AssertDimension(element_matrices.extent(1), dof_indices.extent(1));
+      AssertDimension(element_matrices.extent(2), dof_indices.extent(1));
+
+#  if DEAL_II_TRILINOS_VERSION_GTE(13, 2, 0)
+      const int n_elements = dof_indices.extent(0);
+      const int n_dofs     = dof_indices.extent(1);
+      if (n_elements == 0 || n_dofs == 0)
+        return;
+
+      // The local matrix and the local maps can be used inside of kernels
+      // running in the memory space of the matrix. Requesting the local
+      // matrix on the device marks the values as modified there, so that
+      // Tpetra synchronizes them before they are accessed on the host.
+      const auto local_matrix     = matrix->getLocalMatrixDevice();
+      const auto local_row_map    = matrix->getRowMap()->getLocalMap();
+      const auto local_column_map = matrix->getColMap()->getLocalMap();
+
+      const TpetraTypes::LO invalid =
+        Tpetra::Details::OrdinalTraits<TpetraTypes::LO>::invalid();
+
+      using ExecutionSpace =
+        typename MemorySpace::kokkos_space::execution_space;
+
+      int n_missing_entries = 0;
+      Kokkos::parallel_reduce(
+        "dealii::TpetraWrappers::SparseMatrix::add_element_matrices",
+        Kokkos::MDRangePolicy<ExecutionSpace, Kokkos::Rank<2>>(
+          {0, 0}, {n_elements, n_dofs}),
+        KOKKOS_LAMBDA(const int e, const int i, int &n_missing) {
+          const TpetraTypes::LO row = local_row_map.getLocalElement(
+            static_cast<TpetraTypes::GO>(dof_indices(e, i)));
+          if (row == invalid)
+            {
+              n_missing += n_dofs;
+              return;
+            }
+
+          for (int j = 0; j < n_dofs; ++j)
+            {
+              const TpetraTypes::LO column = local_column_map.getLocalElement(
+                static_cast<TpetraTypes::GO>(dof_indices(e, j)));
+              const Number value = element_matrices(e, i, j);
+              if (column == invalid ||
+                  local_matrix.sumIntoValues(
+                    row, &column, 1, &value, false, true) != 1)
+                ++n_missing;
+            }
+        },
+        n_missing_entries);
+
+      AssertThrow(n_missing_entries == 0,
+                  ExcMessage(
+                    "Some of the entries of the element matrices are either "
+                    "in rows not owned by this process or not part of the "
+                    "sparsity pattern of the matrix."));
+#  else
+      (void)element_matrices;
+      (void)dof_indices;
+      AssertThrow(false,
+                  ExcMessage("Adding element matrices in the memory space "
+                             "of the matrix requires Trilinos 13.2 or newer."));
+#  endif
+    }
+
+
+
     template <typename Number, typename MemorySpace>
     void
     SparseMatrix<Number, MemorySpace>::clear_row(const size_type row,
@@ -25,6 +25,7 @@
 
 #include <iostream>
 #include <memory>
+#include <thread>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -149,6 +150,22 @@ public:
   virtual void
   free(const VectorType *const) = 0;
 
+  /**
+   * Return a pointer to a new vector that has the same size and layout as
+   * @p layout, i.e., that has been initialized by
+   * <tt>reinit(layout, true)</tt>. The contents of the vector are
+   * unspecified. The vector needs to be returned by free() as for alloc().
+   *
+   * The default implementation calls alloc() and then reinitializes the
+   * vector. Memory pools like GrowingVectorMemory override this function to
+   * preferably hand out an unused vector that already has the requested
+   * layout, which avoids reallocating memory when vectors of different sizes
+   * are drawn from the same pool, e.g., by the solvers on the different
+   * levels of a multigrid method.
+   */
+  virtual VectorType *
+  alloc_like(const VectorType &layout);
+
   /**
    * @addtogroup Exceptions
    * @{
@@ -216,6 +233,13 @@ public:
      */
     Pointer(VectorMemory<VectorType> &mem);
 
+    /**
+     * Constructor. This constructor automatically allocates a vector with
+     * the same layout as @p layout from the given vector memory object
+     * @p mem, see VectorMemory::alloc_like().
+     */
+    Pointer(VectorMemory<VectorType> &mem, const VectorType &layout);
+
     /**
      * Destructor, automatically releasing the vector from the memory pool.
      */
@@ -374,6 +398,22 @@ public:
   virtual void
   free(const VectorType *const) override;
 
+  /**
+   * Return a pointer to a new vector with the same size and layout as
+   * @p layout, see VectorMemory::alloc_like().
+   *
+   * For the present class, this function looks for an unused vector in the
+   * pool that already has the layout of @p layout, i.e., that shares the
+   * same Utilities::MPI::Partitioner object for vectors that have one, or
+   * has the same size (and block sizes) otherwise. Reinitializing such a
+   * vector does not need to allocate new memory, and the memory pages keep
+   * their placement from the first touch upon the original allocation.
+   * Among the suitable vectors, the ones most recently used by the calling
+   * thread are preferred.
+   */
+  virtual VectorType *
+  alloc_like(const VectorType &layout) override;
+
   /**
    * Release all vectors that are not currently in use.
    */
@@ -389,11 +429,32 @@ public:
 private:
   /**
    * A type that describes this entries of an array that represents
-   * the vectors stored by this object. The first component of the pair
-   * is be a flag telling whether the vector is used, the second
-   * a pointer to the vector itself.
+   * the vectors stored by this object.
    */
-  using entry_type = std::pair<bool, std::unique_ptr<VectorType>>;
+  struct entry_type
+  {
+    /**
+     * A flag telling whether the vector is used.
+     */
+    bool in_use = false;
+
+    /**
+     * The thread that has most recently allocated the vector.
+     */
+    std::thread::id last_thread;
+
+    /**
+     * A pointer to the vector itself.
+     */
+    std::unique_ptr<VectorType> vector;
+  };
+
+  /**
+   * Mark the entry @p entry as used by the calling thread and return its
+   * vector. Must be called with #mutex locked.
+   */
+  VectorType *
+  use_entry(entry_type &entry);
 
   /**
    * The class providing the actual storage for the memory pool.
@@ -482,6 +543,27 @@ inline VectorMemory<VectorType>::Pointer::Pointer(VectorMemory<VectorType> &mem)
 
 
 
+template <typename VectorType>
+inline VectorMemory<VectorType>::Pointer::Pointer(VectorMemory<VectorType> &mem,
+                                                  const VectorType &layout)
+  : std::unique_ptr<VectorType, std::function<void(VectorType *)>>(
+      mem.alloc_like(layout),
+      [&mem](VectorType *v) { mem.free(v); })
+{}
+
+
+
+template <typename VectorType>
+inline VectorType *
+VectorMemory<VectorType>::alloc_like(const VectorType &layout)
+{
+  VectorType *v = alloc();
+  v->reinit(layout, true);
+  return v;
+}
+
+
+
 template <typename VectorType>
 VectorType *
 PrimitiveVectorMemory<VectorType>::alloc()
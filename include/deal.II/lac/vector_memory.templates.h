@@ -25,10 +25,59 @@
 #include <deal.II/lac/vector_memory.h>
 
 #include <memory>
+#include <type_traits>
 
 DEAL_II_NAMESPACE_OPEN
 
 
+namespace internal
+{
+  namespace GrowingVectorMemoryImplementation
+  {
+    template <typename VectorType>
+    using get_partitioner_op =
+      decltype(std::declval<const VectorType &>().get_partitioner());
+
+    template <typename VectorType>
+    using n_blocks_op =
+      decltype(std::declval<const VectorType &>().n_blocks());
+
+    template <typename VectorType>
+    using size_op = decltype(std::declval<const VectorType &>().size());
+
+    /**
+     * Return whether the vector @p v has the same layout as the vector
+     * @p layout, such that <tt>v.reinit(layout, true)</tt> does not need to
+     * allocate memory. For vectors that are based on a
+     * Utilities::MPI::Partitioner, this checks for the same partitioner
+     * object; for block vectors, for the same block sizes; and for all other
+     * vectors, for the same size.
+     */
+    template <typename VectorType>
+    bool
+    has_same_layout(const VectorType &v, const VectorType &layout)
+    {
+      if constexpr (is_supported_operation<get_partitioner_op, VectorType>)
+        return v.get_partitioner().get() == layout.get_partitioner().get();
+      else if constexpr (is_supported_operation<n_blocks_op, VectorType>)
+        {
+          if (v.n_blocks() != layout.n_blocks())
+            return false;
+          for (unsigned int b = 0; b < v.n_blocks(); ++b)
+            if (!has_same_layout(v.block(b), layout.block(b)))
+              return false;
+          return true;
+        }
+      else if constexpr (is_supported_operation<size_op, VectorType>)
+        return v.size() == layout.size();
+      else
+        return false;
+    }
+  } // namespace GrowingVectorMemoryImplementation
+} // namespace internal
+
+
+
 template <typename VectorType>
 typename GrowingVectorMemory<VectorType>::Pool &
 GrowingVectorMemory<VectorType>::get_pool()
@@ -90,10 +139,7 @@ GrowingVectorMemory<VectorType>::Pool::initialize(const size_type size)
       for (typename std::vector<entry_type>::iterator i = data->begin();
            i != data->end();
            ++i)
-        {
-          i->first  = false;
-          i->second = std::make_unique<VectorType>();
-        }
+        i->vector = std::make_unique<VectorType>();
     }
 }
 
@@ -135,29 +181,98 @@ inline GrowingVectorMemory<VectorType>::~GrowingVectorMemory()
 
 template <typename VectorType>
 inline VectorType *
-GrowingVectorMemory<VectorType>::alloc()
+GrowingVectorMemory<VectorType>::use_entry(entry_type &entry)
 {
-  std::lock_guard<std::mutex> lock(mutex);
-
   ++total_alloc;
   ++current_alloc;
 
-  // See if there is a currently unused vector available in our list
+  entry.in_use      = true;
+  entry.last_thread = std::this_thread::get_id();
+  return entry.vector.get();
+}
+
+
+
+template <typename VectorType>
+inline VectorType *
+GrowingVectorMemory<VectorType>::alloc()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  // See if there is a currently unused vector available in our list,
+  // preferably one that has last been used by the calling thread such that
+  // its memory is likely still in the caches of the current core
+  const std::thread::id this_thread = std::this_thread::get_id();
+  entry_type           *candidate   = nullptr;
   for (entry_type &i : *get_pool().data)
-    {
-      if (i.first == false)
-        {
-          i.first = true;
-          return i.second.get();
-        }
-    }
+    if (i.in_use == false)
+      {
+        if (i.last_thread == this_thread)
+          return use_entry(i);
+        else if (candidate == nullptr)
+          candidate = &i;
+      }
+
+  if (candidate != nullptr)
+    return use_entry(*candidate);
 
   // No currently unused vector found, so let's just allocate a new one
   // and return it:
-  const auto &new_entry =
-    get_pool().data->emplace_back(true, std::make_unique<VectorType>());
+  entry_type &new_entry = get_pool().data->emplace_back();
+  new_entry.vector      = std::make_unique<VectorType>();
+
+  return use_entry(new_entry);
+}
 
-  return new_entry.second.get();
+
+
+template <typename VectorType>
+inline VectorType *
+GrowingVectorMemory<VectorType>::alloc_like(const VectorType &layout)
+{
+  VectorType *v = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Rank the unused vectors: a vector with the same layout can be
+    // reinitialized without allocating memory, which also keeps the memory
+    // pages where they were placed by the first touch. Among those, prefer
+    // vectors last used by the calling thread.
+    const std::thread::id this_thread = std::this_thread::get_id();
+    entry_type           *candidate   = nullptr;
+    unsigned int          best_score  = 0;
+    for (entry_type &i : *get_pool().data)
+      if (i.in_use == false)
+        {
+          const bool same_layout =
+            internal::GrowingVectorMemoryImplementation::has_same_layout(
+              *i.vector, layout);
+          const unsigned int score = 1 + (same_layout ? 2 : 0) +
+                                     (i.last_thread == this_thread ? 1 : 0);
+          if (score > best_score)
+            {
+              candidate  = &i;
+              best_score = score;
+              if (score == 4)
+                break;
+            }
+        }
+
+    if (candidate != nullptr)
+      v = use_entry(*candidate);
+    else
+      {
+        entry_type &new_entry = get_pool().data->emplace_back();
+        new_entry.vector      = std::make_unique<VectorType>();
+        v                     = use_entry(new_entry);
+      }
+  }
+
+  // The vector is owned by the calling thread now, so it can be
+  // reinitialized without holding the lock. This is a no-op in terms of
+  // memory allocation if the layout matches.
+  v->reinit(layout, true);
+  return v;
 }
 
 
@@ -171,9 +286,9 @@ GrowingVectorMemory<VectorType>::free(const VectorType *const v)
   // Find the vector to be de-allocated and mark it as now unused:
   for (entry_type &i : *get_pool().data)
     {
-      if (v == i.second.get())
+      if (v == i.vector.get())
         {
-          i.first = false;
+          i.in_use = false;
           --current_alloc;
           return;
         }
@@ -205,9 +320,13 @@ GrowingVectorMemory<VectorType>::memory_consumption() const
   std::lock_guard<std::mutex> lock(mutex);
 
   std::size_t result = sizeof(*this);
-  for (const auto &[_, ptr] : *get_pool().data)
-    result += sizeof(ptr) + (ptr ? MemoryConsumption::memory_consumption(*ptr) :
-                                   MemoryConsumption::memory_consumption(ptr));
+  for (const entry_type &entry : *get_pool().data)
+    {
+      const auto &ptr = entry.vector;
+      result +=
+        sizeof(entry) + (ptr ? MemoryConsumption::memory_consumption(*ptr) :
+                               MemoryConsumption::memory_consumption(ptr));
+    }
 
   return result;
 }
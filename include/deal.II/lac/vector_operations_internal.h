@@ -29,6 +29,7 @@
 
 #include <cstdio>
 #include <cstring>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -263,6 +264,7 @@ namespace internal
         , stored_factor(factor)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -298,6 +300,7 @@ namespace internal
         , stored_factor(factor)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -335,6 +338,7 @@ namespace internal
         , stored_x(x)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -369,6 +373,7 @@ namespace internal
         , v_val(v_val)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -397,6 +402,7 @@ namespace internal
         , stored_factor(factor)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -427,6 +433,7 @@ namespace internal
         , v_val(v_val)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -462,6 +469,7 @@ namespace internal
         , stored_b(b)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -498,6 +506,7 @@ namespace internal
         , stored_x(x)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -538,6 +547,7 @@ namespace internal
         , stored_b(b)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -572,6 +582,7 @@ namespace internal
         , v_val(v_val)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -603,6 +614,7 @@ namespace internal
         , stored_a(a)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -641,6 +653,7 @@ namespace internal
         , stored_b(b)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -685,6 +698,7 @@ namespace internal
         , stored_c(c)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -712,6 +726,78 @@ namespace internal
       const Number        stored_c;
     };
 
+    template <typename Number>
+    struct Vectorization_linear_combination
+    {
+      Vectorization_linear_combination(Number *const        val,
+                                       const Number *const *v_vals,
+                                       const Number *const  factors,
+                                       const unsigned int   n_vectors,
+                                       const bool           add_to_val)
+        : val(val)
+        , v_vals(v_vals)
+        , factors(factors)
+        , n_vectors(n_vectors)
+        , add_to_val(add_to_val)
+      {}
+
+      DEAL_II_TARGET_CLONES
+      void
+      operator()(const size_type begin, const size_type end) const
+      {
+        // Work on blocks of entries that fit into the L1 cache, such that
+        // the destination is loaded from and stored to memory only once
+        // regardless of the number of vectors
+        constexpr size_type block_size = 512;
+        for (size_type block_begin = begin; block_begin < end;
+             block_begin += block_size)
+          {
+            const size_type block_end = std::min(block_begin + block_size, end);
+            for (unsigned int j = 0; j < n_vectors; ++j)
+              {
+                const Number        a     = factors[j];
+                const Number *const v_val = v_vals[j];
+                if (j == 0 && !add_to_val)
+                  {
+                    if (::dealii::parallel::internal::EnableOpenMPSimdFor<
+                          Number>::value)
+                      {
+                        DEAL_II_OPENMP_SIMD_PRAGMA
+                        for (size_type i = block_begin; i < block_end; ++i)
+                          val[i] = a * v_val[i];
+                      }
+                    else
+                      {
+                        for (size_type i = block_begin; i < block_end; ++i)
+                          val[i] = a * v_val[i];
+                      }
+                  }
+                else
+                  {
+                    if (::dealii::parallel::internal::EnableOpenMPSimdFor<
+                          Number>::value)
+                      {
+                        DEAL_II_OPENMP_SIMD_PRAGMA
+                        for (size_type i = block_begin; i < block_end; ++i)
+                          val[i] += a * v_val[i];
+                      }
+                    else
+                      {
+                        for (size_type i = block_begin; i < block_end; ++i)
+                          val[i] += a * v_val[i];
+                      }
+                  }
+              }
+          }
+      }
+
+      Number *const              val;
+      const Number *const *const v_vals;
+      const Number *const        factors;
+      const unsigned int         n_vectors;
+      const bool                 add_to_val;
+    };
+
     template <typename Number>
     struct Vectorization_ratio
     {
@@ -721,6 +807,7 @@ namespace internal
         , b_val(b_val)
       {}
 
+      DEAL_II_TARGET_CLONES
       void
       operator()(const size_type begin, const size_type end) const
       {
@@ -1608,6 +1695,19 @@ namespace internal
         ::dealii::MemorySpace::MemorySpaceData<Number, MemorySpace> & /*data*/)
       {}
 
+      static void
+      linear_combination(
+        const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner> &
+        /*thread_loop_partitioner*/,
+        const size_type /*size*/,
+        const unsigned int /*n_vectors*/,
+        const Number * /*factors*/,
+        const ::dealii::MemorySpace::MemorySpaceData<Number, MemorySpace>
+          *const * /*v_data*/,
+        const bool /*add_to_data*/,
+        ::dealii::MemorySpace::MemorySpaceData<Number, MemorySpace> & /*data*/)
+      {}
+
       static void
       equ_aubv(
         const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner> &
@@ -1953,6 +2053,35 @@ namespace internal
         parallel_for(vector_equ, 0, size, thread_loop_partitioner);
       }
 
+      static void
+      linear_combination(
+        const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
+                           &thread_loop_partitioner,
+        const size_type     size,
+        const unsigned int  n_vectors,
+        const Number *const factors,
+        const ::dealii::MemorySpace::
+          MemorySpaceData<Number, ::dealii::MemorySpace::Host> *const *v_data,
+        const bool add_to_data,
+        ::dealii::MemorySpace::MemorySpaceData<Number,
+                                               ::dealii::MemorySpace::Host>
+          &data)
+      {
+        if (n_vectors == 0)
+          {
+            if (!add_to_data)
+              set(thread_loop_partitioner, size, Number(), data);
+            return;
+          }
+
+        std::vector<const Number *> v_vals(n_vectors);
+        for (unsigned int j = 0; j < n_vectors; ++j)
+          v_vals[j] = v_data[j]->values.data();
+        Vectorization_linear_combination<Number> vector_combination(
+          data.values.data(), v_vals.data(), factors, n_vectors, add_to_data);
+        parallel_for(vector_combination, 0, size, thread_loop_partitioner);
+      }
+
       static Number
       dot(const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
                          &thread_loop_partitioner,
@@ -2435,6 +2564,58 @@ namespace internal
         exec.fence();
       }
 
+      static void
+      linear_combination(
+        const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
+                           &thread_loop_partitioner,
+        const size_type     size,
+        const unsigned int  n_vectors,
+        const Number *const factors,
+        const ::dealii::MemorySpace::
+          MemorySpaceData<Number, ::dealii::MemorySpace::Default>
+            *const *v_data,
+        const bool add_to_data,
+        ::dealii::MemorySpace::MemorySpaceData<Number,
+                                               ::dealii::MemorySpace::Default>
+          &data)
+      {
+        // The pointers to the vectors live in host memory, so we combine
+        // the vectors two at a time with the kernels above
+        unsigned int j = 0;
+        if (!add_to_data)
+          {
+            if (n_vectors == 0)
+              {
+                set(thread_loop_partitioner, size, Number(), data);
+                return;
+              }
+            else if (n_vectors == 1)
+              {
+                equ_au(
+                  thread_loop_partitioner, size, factors[0], *v_data[0], data);
+                return;
+              }
+            equ_aubv(thread_loop_partitioner,
+                     size,
+                     factors[0],
+                     factors[1],
+                     *v_data[0],
+                     *v_data[1],
+                     data);
+            j = 2;
+          }
+        for (; j + 1 < n_vectors; j += 2)
+          add_avpbw(thread_loop_partitioner,
+                    size,
+                    factors[j],
+                    factors[j + 1],
+                    *v_data[j],
+                    *v_data[j + 1],
+                    data);
+        if (j < n_vectors)
+          add_av(thread_loop_partitioner, size, factors[j], *v_data[j], data);
+      }
+
       static Number
       dot(const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner> &,
           const size_type size,
@@ -322,7 +322,9 @@ namespace internal
        *
        * The intent of this pattern is to zero the vector entries in close
        * temporal proximity to the first access and thus keeping the vector
-       * entries in cache.
+       * entries in cache. This function also fills the lists for the
+       * operations before and after the cell loop as well as
+       * @p cell_loop_fused_stage.
        */
       template <int length>
       void
@@ -330,6 +332,25 @@ namespace internal
         const TaskInfo                                &task_info,
         const std::vector<FaceToCellTopology<length>> &faces);
 
+      /**
+       * Return whether this object stores the same indices as @p other, such
+       * that vectors set up with either of the two objects can be accessed
+       * through the other one. This is the case for DoFHandler objects with
+       * the same numbering of the unknowns and the same constraints, e.g.,
+       * for the different species of a reaction-diffusion system.
+       */
+      bool
+      has_identical_indices(const DoFInfo &other) const;
+
+      /**
+       * Release the memory of the index arrays of this object and use the
+       * vector partitioner and the vector exchangers of @p other instead,
+       * for which has_identical_indices() must return true. Afterwards,
+       * vector entries can only be accessed through @p other.
+       */
+      void
+      release_indices_identical_to(const DoFInfo &other);
+
       /**
        * Return the memory consumption in bytes of this class.
        */
@@ -386,7 +407,11 @@ namespace internal
          * scatter operations). For a cell/face of this index type, the data
          * access in FEEvaluationBase is directed to the array
          * `dof_indices_interleaved` with the index
-         * `row_starts[cell_index*n_vectorization*n_components].first`.
+         * `row_starts[cell_index*n_vectorization*n_components].first`, or,
+         * if the indices of each cell in the batch span less than $2^{16}$
+         * entries, to the 16-bit offsets in
+         * `dof_indices_interleaved_compressed` that are added to the
+         * smallest index of each cell.
          */
         interleaved,
         /**
@@ -542,6 +567,33 @@ namespace internal
        */
       std::vector<unsigned int> dof_indices_interleaved;
 
+      /**
+       * Compressed variant of @p dof_indices_interleaved for the cell batches
+       * of type `IndexStorageVariants::interleaved` whose indices are all
+       * within a range of $2^{16}$ entries from the smallest index on each
+       * cell. For these batches, the index of a degree of freedom is
+       * represented by the 16-bit offset stored here, in the same interleaved
+       * order as in @p dof_indices_interleaved, plus the smallest index of
+       * the cell stored in @p dof_indices_interleaved_compressed_base. This
+       * halves the amount of index data to be loaded.
+       */
+      std::vector<unsigned short> dof_indices_interleaved_compressed;
+
+      /**
+       * The position of the entries of a cell batch within @p
+       * dof_indices_interleaved_compressed, or numbers::invalid_unsigned_int
+       * if the indices of the cell batch are not compressed. Empty if no
+       * cell batch is compressed.
+       */
+      std::vector<unsigned int> dof_indices_interleaved_compressed_start;
+
+      /**
+       * The smallest index on each cell of the cell batches with compressed
+       * indices, to be added to the offsets in @p
+       * dof_indices_interleaved_compressed.
+       */
+      std::vector<unsigned int> dof_indices_interleaved_compressed_base;
+
       /**
        * Compressed index storage for faster access than through @p
        * dof_indices used according to the description in IndexStorageVariants.
@@ -766,6 +818,17 @@ namespace internal
        * entries.
        */
       std::vector<std::pair<unsigned int, unsigned int>> cell_loop_post_list;
+
+      /**
+       * Stores for each partition in TaskInfo the last partition of a cell
+       * loop that writes into the vector entries read by the cells of the
+       * partition. This allows to start a second loop on a partition once
+       * its input computed by a first loop is complete. Partitions that read
+       * vector entries that are exchanged with other processes are assigned
+       * the number of partitions, i.e., they can only run after the data
+       * exchange of the first loop.
+       */
+      std::vector<unsigned int> cell_loop_fused_stage;
     };
 
 
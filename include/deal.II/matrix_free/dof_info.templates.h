@@ -574,6 +574,30 @@ namespace internal
                                 cell_loop_post_list_index,
                                 cell_loop_post_list,
                                 vector_partitioner->locally_owned_size());
+
+      // finally, determine for every partition the last partition that
+      // touches any of its unknowns, where ghost and import indices are only
+      // complete after the data exchange
+      cell_loop_fused_stage.resize(n_partitions);
+      for (unsigned int chunk = 0; chunk < n_partitions; ++chunk)
+        {
+          unsigned int stage = chunk;
+          for (unsigned int cell = task_info.cell_partition_data[chunk];
+               cell < task_info.cell_partition_data[chunk + 1];
+               ++cell)
+            for (unsigned int it =
+                   row_starts[cell * vectorization_length * n_components].first;
+                 it !=
+                 row_starts[(cell + 1) * vectorization_length * n_components]
+                   .first;
+                 ++it)
+              stage = std::max(
+                stage,
+                dof_indices[it] < vector_partitioner->locally_owned_size() ?
+                  touched_last_by[dof_indices[it] / chunk_size_zero_vector] :
+                  n_partitions);
+          cell_loop_fused_stage[chunk] = stage;
+        }
     }
 
 
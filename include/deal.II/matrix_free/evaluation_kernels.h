@@ -181,6 +181,43 @@ namespace internal
               Number                                *values_dofs_actual,
               FEEvaluationData<dim, Number, false>  &fe_eval,
               const bool                             add_into_values_array);
+
+  private:
+    using Number2 =
+      typename FEEvaluationData<dim, Number, false>::shape_info_number_type;
+
+    /**
+     * Evaluate values and gradients of a single component in one sweep over
+     * the degrees of freedom. Compared to two separate matrix-vector
+     * products, every entry of @p in is loaded only once and the rows of
+     * the value and gradient matrices are streamed together. The quadrature
+     * points are blocked in pairs to keep 2 * (dim + 1) partial sums in
+     * registers.
+     */
+    static void
+    evaluate_values_and_gradients(const Number2     *shape_values,
+                                  const Number2     *shape_gradients,
+                                  const Number      *in,
+                                  Number            *out_values,
+                                  Number            *out_gradients,
+                                  const unsigned int n_dofs,
+                                  const unsigned int n_q_points);
+
+    /**
+     * Transpose operation of evaluate_values_and_gradients(): test by
+     * values and gradients of a single component in one sweep over the
+     * quadrature points, blocking four degrees of freedom at a time to
+     * reuse the loads of quadrature point data.
+     */
+    static void
+    integrate_values_and_gradients(const Number2     *shape_values,
+                                   const Number2     *shape_gradients,
+                                   const Number      *in_values,
+                                   const Number      *in_gradients,
+                                   Number            *out,
+                                   const unsigned int n_dofs,
+                                   const unsigned int n_q_points,
+                                   const bool         add_into_out);
   };
 
 
@@ -608,6 +645,156 @@ namespace internal
 
 
 
+  template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+  inline void
+  FEEvaluationImpl<MatrixFreeFunctions::tensor_none,
+                   dim,
+                   fe_degree,
+                   n_q_points_1d,
+                   Number>::
+    evaluate_values_and_gradients(const Number2     *shape_values,
+                                  const Number2     *shape_gradients,
+                                  const Number      *in,
+                                  Number            *out_values,
+                                  Number            *out_gradients,
+                                  const unsigned int n_dofs,
+                                  const unsigned int n_q_points)
+  {
+    Assert(n_dofs > 0, ExcInternalError("Empty evaluation task!"));
+
+    const unsigned int n_q_regular = (n_q_points / 2) * 2;
+    for (unsigned int q = 0; q < n_q_regular; q += 2)
+      {
+        const Number2 *values_ptr    = shape_values + q;
+        const Number2 *gradients_ptr = shape_gradients + q * dim;
+
+        Number val0, val1, grad[2 * dim];
+        {
+          const Number x = in[0];
+          val0           = values_ptr[0] * x;
+          val1           = values_ptr[1] * x;
+          for (unsigned int e = 0; e < 2 * dim; ++e)
+            grad[e] = gradients_ptr[e] * x;
+        }
+        for (unsigned int i = 1; i < n_dofs; ++i)
+          {
+            values_ptr += n_q_points;
+            gradients_ptr += n_q_points * dim;
+            const Number x = in[i];
+            val0 += values_ptr[0] * x;
+            val1 += values_ptr[1] * x;
+            for (unsigned int e = 0; e < 2 * dim; ++e)
+              grad[e] += gradients_ptr[e] * x;
+          }
+
+        out_values[q]     = val0;
+        out_values[q + 1] = val1;
+        for (unsigned int e = 0; e < 2 * dim; ++e)
+          out_gradients[q * dim + e] = grad[e];
+      }
+
+    if (n_q_regular < n_q_points)
+      {
+        const unsigned int q             = n_q_regular;
+        const Number2     *values_ptr    = shape_values + q;
+        const Number2     *gradients_ptr = shape_gradients + q * dim;
+
+        Number val0, grad[dim];
+        {
+          const Number x = in[0];
+          val0           = values_ptr[0] * x;
+          for (unsigned int d = 0; d < dim; ++d)
+            grad[d] = gradients_ptr[d] * x;
+        }
+        for (unsigned int i = 1; i < n_dofs; ++i)
+          {
+            values_ptr += n_q_points;
+            gradients_ptr += n_q_points * dim;
+            const Number x = in[i];
+            val0 += values_ptr[0] * x;
+            for (unsigned int d = 0; d < dim; ++d)
+              grad[d] += gradients_ptr[d] * x;
+          }
+
+        out_values[q] = val0;
+        for (unsigned int d = 0; d < dim; ++d)
+          out_gradients[q * dim + d] = grad[d];
+      }
+  }
+
+
+
+  template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+  inline void
+  FEEvaluationImpl<MatrixFreeFunctions::tensor_none,
+                   dim,
+                   fe_degree,
+                   n_q_points_1d,
+                   Number>::
+    integrate_values_and_gradients(const Number2     *shape_values,
+                                   const Number2     *shape_gradients,
+                                   const Number      *in_values,
+                                   const Number      *in_gradients,
+                                   Number            *out,
+                                   const unsigned int n_dofs,
+                                   const unsigned int n_q_points,
+                                   const bool         add_into_out)
+  {
+    Assert(n_q_points > 0, ExcInternalError("Empty evaluation task!"));
+
+    const unsigned int n_q_dim       = n_q_points * dim;
+    const unsigned int n_dofs_blocks = (n_dofs / 4) * 4;
+    for (unsigned int i = 0; i < n_dofs_blocks; i += 4)
+      {
+        const Number2 *values_ptr    = shape_values + i * n_q_points;
+        const Number2 *gradients_ptr = shape_gradients + i * n_q_dim;
+
+        Number res[4];
+        {
+          const Number x = in_values[0];
+          for (unsigned int k = 0; k < 4; ++k)
+            res[k] = values_ptr[k * n_q_points] * x;
+        }
+        for (unsigned int q = 1; q < n_q_points; ++q)
+          {
+            const Number x = in_values[q];
+            for (unsigned int k = 0; k < 4; ++k)
+              res[k] += values_ptr[k * n_q_points + q] * x;
+          }
+        for (unsigned int q = 0; q < n_q_dim; ++q)
+          {
+            const Number x = in_gradients[q];
+            for (unsigned int k = 0; k < 4; ++k)
+              res[k] += gradients_ptr[k * n_q_dim + q] * x;
+          }
+
+        for (unsigned int k = 0; k < 4; ++k)
+          if (add_into_out)
+            out[i + k] += res[k];
+          else
+            out[i + k] = res[k];
+      }
+
+    for (unsigned int i = n_dofs_blocks; i < n_dofs; ++i)
+      {
+        const Number2 *values_ptr    = shape_values + i * n_q_points;
+        const Number2 *gradients_ptr = shape_gradients + i * n_q_dim;
+
+        Number res = values_ptr[0] * in_values[0];
+        for (unsigned int q = 1; q < n_q_points; ++q)
+          res += values_ptr[q] * in_values[q];
+        for (unsigned int q = 0; q < n_q_dim; ++q)
+          res += gradients_ptr[q] * in_gradients[q];
+
+        if (add_into_out)
+          out[i] += res;
+        else
+          out[i] = res;
+      }
+  }
+
+
+
   template <int dim, int fe_degree, int n_q_points_1d, typename Number>
   inline void
   FEEvaluationImpl<
@@ -628,8 +815,22 @@ namespace internal
 
     const auto &shape_data = fe_eval.get_shape_info().data;
 
-    using Number2 =
-      typename FEEvaluationData<dim, Number, false>::shape_info_number_type;
+    // fused path for the common case of values and gradients, sweeping over
+    // the degrees of freedom only once
+    if ((evaluation_flag & EvaluationFlags::values) &&
+        (evaluation_flag & EvaluationFlags::gradients))
+      {
+        for (unsigned int c = 0; c < n_components; ++c)
+          evaluate_values_and_gradients(
+            shape_data.front().shape_values.data(),
+            shape_data.front().shape_gradients.data(),
+            values_dofs_actual + c * n_dofs,
+            fe_eval.begin_values() + c * n_q_points,
+            fe_eval.begin_gradients() + c * n_q_points * dim,
+            n_dofs,
+            n_q_points);
+        return;
+      }
 
     if (evaluation_flag & EvaluationFlags::values)
       {
@@ -745,8 +946,23 @@ namespace internal
 
     const auto &shape_data = fe_eval.get_shape_info().data;
 
-    using Number2 =
-      typename FEEvaluationData<dim, Number, false>::shape_info_number_type;
+    // fused path for the common case of values and gradients, sweeping over
+    // the quadrature points only once
+    if ((integration_flag & EvaluationFlags::values) &&
+        (integration_flag & EvaluationFlags::gradients))
+      {
+        for (unsigned int c = 0; c < n_components; ++c)
+          integrate_values_and_gradients(
+            shape_data.front().shape_values.data(),
+            shape_data.front().shape_gradients.data(),
+            fe_eval.begin_values() + c * n_q_points,
+            fe_eval.begin_gradients() + c * n_q_points * dim,
+            values_dofs_actual + c * n_dofs,
+            n_dofs,
+            n_q_points,
+            add_into_values_array);
+        return;
+      }
 
     if (integration_flag & EvaluationFlags::values)
       {
@@ -2103,6 +2319,253 @@ namespace internal
 
 
 
+  /**
+   * Specialization for MatrixFreeFunctions::tensor_nedelec, which uses a
+   * sum-factorization kernel with a different polynomial degree in the
+   * direction of each vector component than in the other directions. The
+   * sizes of the tensor product are only known at run time, so this class
+   * is only used with the template arguments fe_degree=-1 and
+   * n_q_points_1d=0. Gradients in the reference coordinates are computed
+   * via the collocation derivative at the quadrature points.
+   */
+  template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+  struct FEEvaluationImpl<MatrixFreeFunctions::tensor_nedelec,
+                          dim,
+                          fe_degree,
+                          n_q_points_1d,
+                          Number>
+  {
+    using Number2 =
+      typename FEEvaluationData<dim, Number, false>::shape_info_number_type;
+
+    template <bool integrate>
+    static void
+    evaluate_or_integrate(
+      const EvaluationFlags::EvaluationFlags evaluation_flag,
+      Number                                *values_dofs_actual,
+      FEEvaluationData<dim, Number, false>  &fe_eval,
+      const bool                             add_into_values_array = false);
+
+  private:
+    /**
+     * Apply the 1d matrix @p shape with @p n_rows times @p n_columns
+     * entries along the direction with stride @p stride of a tensor
+     * product array, with @p n_blocks blocks in the directions above. If
+     * @p contract_over_rows is true, the input has @p n_rows entries in
+     * the given direction and the output @p n_columns. The entries of the
+     * input and the output are placed @p in_skip and @p out_skip entries
+     * apart in memory, respectively.
+     */
+    template <bool contract_over_rows, bool add>
+    static void
+    apply_1d(const Number2     *shape,
+             const unsigned int n_rows,
+             const unsigned int n_columns,
+             const unsigned int stride,
+             const unsigned int n_blocks,
+             const Number      *in,
+             Number            *out,
+             const unsigned int in_skip  = 1,
+             const unsigned int out_skip = 1);
+  };
+
+
+
+  template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+  template <bool contract_over_rows, bool add>
+  inline void
+  FEEvaluationImpl<MatrixFreeFunctions::tensor_nedelec,
+                   dim,
+                   fe_degree,
+                   n_q_points_1d,
+                   Number>::apply_1d(const Number2     *shape,
+                                     const unsigned int n_rows,
+                                     const unsigned int n_columns,
+                                     const unsigned int stride,
+                                     const unsigned int n_blocks,
+                                     const Number      *in,
+                                     Number            *out,
+                                     const unsigned int in_skip,
+                                     const unsigned int out_skip)
+  {
+    const unsigned int n_in  = contract_over_rows ? n_rows : n_columns;
+    const unsigned int n_out = contract_over_rows ? n_columns : n_rows;
+    for (unsigned int b = 0; b < n_blocks; ++b)
+      for (unsigned int i0 = 0; i0 < stride; ++i0)
+        {
+          const Number *in_ptr  = in + (b * n_in * stride + i0) * in_skip;
+          Number       *out_ptr = out + (b * n_out * stride + i0) * out_skip;
+          for (unsigned int o = 0; o < n_out; ++o)
+            {
+              Number sum =
+                (contract_over_rows ? shape[o] : shape[o * n_columns]) *
+                in_ptr[0];
+              for (unsigned int i = 1; i < n_in; ++i)
+                sum += (contract_over_rows ? shape[i * n_columns + o] :
+                                             shape[o * n_columns + i]) *
+                       in_ptr[i * stride * in_skip];
+              if (add)
+                out_ptr[o * stride * out_skip] += sum;
+              else
+                out_ptr[o * stride * out_skip] = sum;
+            }
+        }
+  }
+
+
+
+  template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+  template <bool integrate>
+  inline void
+  FEEvaluationImpl<MatrixFreeFunctions::tensor_nedelec,
+                   dim,
+                   fe_degree,
+                   n_q_points_1d,
+                   Number>::
+    evaluate_or_integrate(
+      const EvaluationFlags::EvaluationFlags evaluation_flag,
+      Number                                *values_dofs,
+      FEEvaluationData<dim, Number, false>  &fe_eval,
+      const bool                             add)
+  {
+    Assert(dim == 2 || dim == 3,
+           ExcMessage("Only dim = 2,3 implemented for Nedelec "
+                      "evaluation/integration"));
+    Assert((evaluation_flag & EvaluationFlags::hessians) == 0u,
+           ExcNotImplemented("Hessians are not implemented for FE_Nedelec"));
+
+    if (evaluation_flag == EvaluationFlags::nothing)
+      return;
+
+    const auto &shape_data = fe_eval.get_shape_info().data;
+    AssertDimension(shape_data.size(), 2);
+    AssertDimension(shape_data[0].fe_degree, shape_data[1].fe_degree + 1);
+
+    const unsigned int nq                = shape_data[0].n_q_points_1d;
+    const unsigned int n_points          = Utilities::pow(nq, dim);
+    const unsigned int n_dofs_normal     = shape_data[1].fe_degree + 1;
+    const unsigned int n_dofs_tangential = shape_data[0].fe_degree + 1;
+    const unsigned int dofs_per_component =
+      n_dofs_normal * Utilities::pow(n_dofs_tangential, dim - 1);
+    const bool do_gradients =
+      (evaluation_flag & EvaluationFlags::gradients) != 0u;
+    Assert(do_gradients == false || nq >= n_dofs_tangential,
+           ExcNotImplemented("The derivatives for FE_Nedelec are computed in "
+                             "the collocation space of the quadrature "
+                             "points, which requires at least degree+1 "
+                             "quadrature points per direction."));
+    const Number2 *collocation_gradients =
+      shape_data[0].shape_gradients_collocation.begin();
+
+    const unsigned int temp_size =
+      Utilities::pow(std::max(nq, n_dofs_tangential), dim);
+    AssertIndexRange(2 * temp_size - 1, fe_eval.get_scratch_data().size());
+    Number *temp1 = fe_eval.get_scratch_data().begin();
+    Number *temp2 = temp1 + temp_size;
+
+    for (unsigned int c = 0; c < dim; ++c)
+      {
+        Number *values    = fe_eval.begin_values() + c * n_points;
+        Number *gradients = fe_eval.begin_gradients() + c * dim * n_points;
+        Number *dofs      = values_dofs + c * dofs_per_component;
+
+        // the direction of the component uses the Legendre polynomials in
+        // shape_data[1], the other directions the Lobatto polynomials
+        std::array<unsigned int, 3>    n_dofs = {{1, 1, 1}};
+        std::array<const Number2 *, 3> shape  = {{nullptr, nullptr, nullptr}};
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            const unsigned int index = (d == c) ? 1 : 0;
+            n_dofs[d]                = shape_data[index].fe_degree + 1;
+            shape[d]                 = shape_data[index].shape_values.begin();
+          }
+
+        if (integrate)
+          {
+            if (do_gradients)
+              {
+                const bool do_values =
+                  (evaluation_flag & EvaluationFlags::values) != 0u;
+                for (unsigned int d = 0; d < dim; ++d)
+                  {
+                    const unsigned int stride = Utilities::pow(nq, d);
+                    if (d > 0 || do_values)
+                      apply_1d<false, true>(collocation_gradients,
+                                            nq,
+                                            nq,
+                                            stride,
+                                            n_points / stride / nq,
+                                            gradients + d,
+                                            values,
+                                            dim);
+                    else
+                      apply_1d<false, false>(collocation_gradients,
+                                             nq,
+                                             nq,
+                                             stride,
+                                             n_points / stride / nq,
+                                             gradients + d,
+                                             values,
+                                             dim);
+                  }
+              }
+
+            if constexpr (dim == 3)
+              {
+                apply_1d<false, false>(
+                  shape[2], n_dofs[2], nq, nq * nq, 1, values, temp1);
+                apply_1d<false, false>(
+                  shape[1], n_dofs[1], nq, nq, n_dofs[2], temp1, temp2);
+              }
+            else
+              apply_1d<false, false>(
+                shape[1], n_dofs[1], nq, nq, 1, values, temp2);
+            const unsigned int n_blocks =
+              dim == 3 ? n_dofs[1] * n_dofs[2] : n_dofs[1];
+            if (add)
+              apply_1d<false, true>(
+                shape[0], n_dofs[0], nq, 1, n_blocks, temp2, dofs);
+            else
+              apply_1d<false, false>(
+                shape[0], n_dofs[0], nq, 1, n_blocks, temp2, dofs);
+          }
+        else
+          {
+            const unsigned int n_blocks =
+              dim == 3 ? n_dofs[1] * n_dofs[2] : n_dofs[1];
+            apply_1d<true, false>(
+              shape[0], n_dofs[0], nq, 1, n_blocks, dofs, temp1);
+            if constexpr (dim == 3)
+              {
+                apply_1d<true, false>(
+                  shape[1], n_dofs[1], nq, nq, n_dofs[2], temp1, temp2);
+                apply_1d<true, false>(
+                  shape[2], n_dofs[2], nq, nq * nq, 1, temp2, values);
+              }
+            else
+              apply_1d<true, false>(
+                shape[1], n_dofs[1], nq, nq, 1, temp1, values);
+
+            if (do_gradients)
+              for (unsigned int d = 0; d < dim; ++d)
+                {
+                  const unsigned int stride = Utilities::pow(nq, d);
+                  apply_1d<true, false>(collocation_gradients,
+                                        nq,
+                                        nq,
+                                        stride,
+                                        n_points / stride / nq,
+                                        values,
+                                        gradients + d,
+                                        1,
+                                        dim);
+                }
+          }
+      }
+  }
+
+
+
   /**
    * This class chooses an appropriate evaluation/integration strategy based on
    * the template parameters and the shape_info variable which contains runtime
@@ -2140,11 +2603,22 @@ namespace internal
       Assert(fe_eval.get_shape_info().data.size() == 1 ||
                (fe_eval.get_shape_info().data.size() == dim &&
                 element_type == ElementType::tensor_general) ||
-               element_type == ElementType::tensor_raviart_thomas,
+               element_type == ElementType::tensor_raviart_thomas ||
+               element_type == ElementType::tensor_nedelec,
              ExcNotImplemented());
 
       EvaluationFlags::EvaluationFlags actual_flag = evaluation_flag;
       bool sum_into_values_array                   = sum_into_values_array_in;
+      if (element_type == ElementType::tensor_nedelec)
+        {
+          FEEvaluationImpl<ElementType::tensor_nedelec, dim, -1, 0, Number>::
+            template evaluate_or_integrate<do_integrate>(
+              evaluation_flag,
+              const_cast<Number *>(values_dofs),
+              fe_eval,
+              sum_into_values_array);
+          return false;
+        }
       if (evaluation_flag & EvaluationFlags::hessians)
         {
           actual_flag |= EvaluationFlags::values;
@@ -1802,6 +1802,9 @@ namespace internal
         FEEvaluationData<dim, Number, true>   &fe_eval)
     {
       const auto &shape_info = fe_eval.get_shape_info();
+      Assert(shape_info.element_type != MatrixFreeFunctions::tensor_nedelec,
+             ExcNotImplemented("Face integrals are not implemented for "
+                               "FE_Nedelec"));
 
       if (shape_info.element_type == MatrixFreeFunctions::tensor_none)
         return evaluate_tensor_none(n_components,
@@ -2347,6 +2350,9 @@ namespace internal
         const bool                             sum_into_values)
     {
       const auto &shape_info = fe_eval.get_shape_info();
+      Assert(shape_info.element_type != MatrixFreeFunctions::tensor_nedelec,
+             ExcNotImplemented("Face integrals are not implemented for "
+                               "FE_Nedelec"));
 
       if (shape_info.element_type == MatrixFreeFunctions::tensor_none)
         return integrate_tensor_none(n_components,
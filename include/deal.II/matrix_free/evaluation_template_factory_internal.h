@@ -19,8 +19,16 @@
 
 #include <deal.II/base/config.h>
 
+#include <iterator>
+#include <utility>
+
 #ifndef FE_EVAL_FACTORY_DEGREE_MAX
-#  define FE_EVAL_FACTORY_DEGREE_MAX 6
+#  define FE_EVAL_FACTORY_DEGREE_MAX DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX
+#endif
+
+#ifndef FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS
+#  define FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS \
+    DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS
 #endif
 
 DEAL_II_NAMESPACE_OPEN
@@ -42,6 +50,41 @@ namespace internal
     }
   };
 
+  /**
+   * The pairs of polynomial degree and number of quadrature points in 1d
+   * that are precompiled in addition to the ones selected by
+   * FE_EVAL_FACTORY_DEGREE_MAX, as configured by the CMake variable
+   * DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS. The first entry is a
+   * placeholder that allows for an empty list and is skipped.
+   */
+  inline constexpr std::pair<int, int>
+    fe_eval_factory_additional_n_q_points[] = {
+      {-1, 0} FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS};
+
+  template <std::size_t index, typename EvaluatorType, typename... Args>
+  bool
+  instantiation_helper_run_additional(const unsigned int given_degree,
+                                      const unsigned int n_q_points_1d,
+                                      Args &...args)
+  {
+    if constexpr (index < std::size(fe_eval_factory_additional_n_q_points))
+      {
+        constexpr int degree =
+          fe_eval_factory_additional_n_q_points[index].first;
+        constexpr int n_q_points =
+          fe_eval_factory_additional_n_q_points[index].second;
+        if (given_degree == degree && n_q_points_1d == n_q_points)
+          return EvaluatorType::template run<degree, n_q_points>(args...);
+        else
+          return instantiation_helper_run_additional<index + 1,
+                                                     EvaluatorType>(
+            given_degree, n_q_points_1d, args...);
+      }
+    else
+      // slow path
+      return EvaluatorType::template run<-1, 0>(args...);
+  }
+
   template <int degree, typename EvaluatorType, typename... Args>
   bool
   instantiation_helper_run(const unsigned int given_degree,
@@ -62,16 +105,16 @@ namespace internal
         else if ((n_q_points_1d == (2 * degree)) && (degree <= 4))
           return EvaluatorType::template run<degree, (2 * degree)>(args...);
         else
-          // slow path
-          return EvaluatorType::template run<-1, 0>(args...);
+          return instantiation_helper_run_additional<1, EvaluatorType>(
+            given_degree, n_q_points_1d, args...);
       }
     else if (degree < FE_EVAL_FACTORY_DEGREE_MAX)
       return instantiation_helper_run<
         (degree < FE_EVAL_FACTORY_DEGREE_MAX ? degree + 1 : degree),
         EvaluatorType>(given_degree, n_q_points_1d, args...);
     else
-      // slow path
-      return EvaluatorType::template run<-1, 0>(args...);
+      return instantiation_helper_run_additional<1, EvaluatorType>(
+        given_degree, n_q_points_1d, args...);
   }
 
   template <int degree, typename EvaluatorType, typename... Args>
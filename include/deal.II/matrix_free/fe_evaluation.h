@@ -23,6 +23,7 @@
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/observer_pointer.h>
 #include <deal.II/base/symmetric_tensor.h>
+#include <deal.II/base/symmetric_tensor_vectorized.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/vectorization.h>
 
@@ -588,6 +589,14 @@ public:
    *
    * @note Only available for the vector-valued case (n_components == dim) in
    * 2 and 3 dimensions.
+   *
+   * @note For the H(curl)-conforming element FE_Nedelec, the values are
+   * obtained by the covariant Piola transform and the curl by the
+   * associated transformation $\frac{1}{\det J} J \hat{\nabla} \times
+   * \hat{v}$. For this element, only get_value(), submit_value(),
+   * get_curl() and submit_curl() are implemented, on cells but not on faces
+   * and only for meshes where all lines have the standard orientation, such
+   * as meshes created by the GridGenerator functions for hypercubes.
    */
   template <int dim_ = dim,
             typename = std::enable_if_t<n_components_ == dim_ && dim_ != 1>>
@@ -1180,14 +1189,22 @@ using FEEvaluationAccess DEAL_II_DEPRECATED =
  * instantiating the classes FEEvaluationFactory and FEFaceEvaluationFactory
  * (the latter for FEFaceEvaluation) creates paths to templated functions for
  * a possibly larger set of degrees. This can both be set when configuring
- * deal.II by passing the flag `-D FE_EVAL_FACTORY_DEGREE_MAX=8` (in case you
- * want to compile all degrees up to eight; recommended setting) or by
+ * deal.II by passing the flag `-D DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX=8` (in
+ * case you want to compile all degrees up to eight; recommended setting) or by
  * compiling `evaluation_template_factory.templates.h` and
  * `evaluation_template_face_factory.templates.h` with the
  * `FE_EVAL_FACTORY_DEGREE_MAX` overridden to the desired value. In the second
  * option, symbols will be available twice, and it depends on your linker and
  * dynamic library loader whether the user-specified setting takes precedence;
- * use `LD_PRELOAD` to select the desired library. You can check if fast
+ * use `LD_PRELOAD` to select the desired library. For each degree, the
+ * kernels are compiled for `degree`, `degree+1`, `degree+2`, and
+ * `(3*degree)/2+1` quadrature points in 1d, the latter for over-integration
+ * of nonlinear terms. Additional combinations can be selected by the CMake
+ * variable `DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS` with a list of
+ * `degree:n_q_points_1d` pairs, e.g.,
+ * `-D DEAL_II_FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS="8:13;10:16"`, or the
+ * macro `FE_EVAL_FACTORY_ADDITIONAL_N_Q_POINTS` set to a list of pairs in
+ * the form `,{8,13},{10,16}`. You can check if fast
  * evaluation/integration for a given degree/n_quadrature_points pair by
  * calling FEEvaluation::fast_evaluation_supported() or
  * FEFaceEvaluation::fast_evaluation_supported().
@@ -2942,8 +2959,12 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
   std::bool_constant<internal::is_vectorizable<VectorType, Number>::value>
     vector_selector;
 
+  // The hanging-node constraints are applied to the values read from the
+  // unconstrained indices after this function, so they do not prevent the
+  // vectorized access except for reading the plain indices
   const bool use_vectorized_path =
-    !(masking_is_active || has_hn_constraints || accesses_exterior_dofs);
+    !(masking_is_active || (has_hn_constraints && !apply_constraints) ||
+      accesses_exterior_dofs);
 
   const std::size_t dofs_per_component = this->data->dofs_per_component_on_cell;
   std::array<VectorizedArrayType *, n_components> values_dofs;
@@ -2959,14 +2980,11 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
                             IndexStorageVariants::interleaved &&
       use_vectorized_path)
     {
-      const unsigned int *dof_indices =
-        dof_info.dof_indices_interleaved.data() +
-        dof_info.row_starts[this->cell * this->n_fe_components * n_lanes]
-          .first +
+      const unsigned int component_offset =
         this->dof_info
-            ->component_dof_indices_offset[this->active_fe_index]
-                                          [this->first_selected_component] *
-          n_lanes;
+          ->component_dof_indices_offset[this->active_fe_index]
+                                        [this->first_selected_component] *
+        n_lanes;
 
       std::array<typename VectorType::value_type *, n_components> src_ptrs;
       if (n_components == 1 || this->n_fe_components == 1)
@@ -2977,6 +2995,57 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
         src_ptrs[0] =
           const_cast<typename VectorType::value_type *>(src[0]->begin());
 
+      // Case of 16-bit offsets to the smallest index on each cell: decode
+      // the indices of one degree of freedom on all lanes before the gather
+      if (!dof_info.dof_indices_interleaved_compressed_start.empty() &&
+          dof_info.dof_indices_interleaved_compressed_start[this->cell] !=
+            numbers::invalid_unsigned_int)
+        {
+          const unsigned short *compressed_indices =
+            dof_info.dof_indices_interleaved_compressed.data() +
+            dof_info.dof_indices_interleaved_compressed_start[this->cell] +
+            component_offset;
+          const unsigned int *base_indices =
+            dof_info.dof_indices_interleaved_compressed_base.data() +
+            this->cell * n_lanes;
+          unsigned int dof_indices[n_lanes];
+
+          const unsigned int n_components_outer =
+            (n_components == 1 || this->n_fe_components == 1) ? 1 :
+                                                                 n_components;
+          for (unsigned int c = 0; c < n_components_outer; ++c)
+            for (unsigned int i = 0; i < dofs_per_component;
+                 ++i, compressed_indices += n_lanes)
+              {
+                DEAL_II_OPENMP_SIMD_PRAGMA
+                for (unsigned int v = 0; v < n_lanes; ++v)
+                  dof_indices[v] = base_indices[v] + compressed_indices[v];
+
+                if (n_components_outer == 1)
+                  for (unsigned int comp = 0; comp < n_components; ++comp)
+                    operation.process_dof_gather(dof_indices,
+                                                 *src[comp],
+                                                 0,
+                                                 src_ptrs[comp],
+                                                 values_dofs[comp][i],
+                                                 vector_selector);
+                else
+                  operation.process_dof_gather(dof_indices,
+                                               *src[0],
+                                               0,
+                                               src_ptrs[0],
+                                               values_dofs[c][i],
+                                               vector_selector);
+              }
+          return;
+        }
+
+      const unsigned int *dof_indices =
+        dof_info.dof_indices_interleaved.data() +
+        dof_info.row_starts[this->cell * this->n_fe_components * n_lanes]
+          .first +
+        component_offset;
+
       if (n_components == 1 || this->n_fe_components == 1)
         for (unsigned int i = 0; i < dofs_per_component;
              ++i, dof_indices += n_lanes)
@@ -4174,6 +4243,31 @@ inline DEAL_II_ALWAYS_INLINE
             }
           return value_out;
         }
+      else if (n_components == dim &&
+               this->data->element_type ==
+                 internal::MatrixFreeFunctions::ElementType::tensor_nedelec)
+        {
+          // covariant Piola transform J^{-T} * u
+          Assert(!is_face, ExcNotImplemented());
+          Assert(this->jacobian != nullptr,
+                 internal::ExcMatrixFreeAccessToUninitializedMappingField(
+                   "update_values"));
+          const std::size_t nqp = this->n_quadrature_points;
+          const Tensor<2, dim, VectorizedArrayType> &inv_t_jac =
+            this->jacobian[this->cell_type >
+                               internal::MatrixFreeFunctions::affine ?
+                             q_point :
+                             0];
+          Tensor<1, n_components, VectorizedArrayType> value_out;
+          for (unsigned int comp = 0; comp < n_components; ++comp)
+            {
+              value_out[comp] = inv_t_jac[comp][0] * this->values_quad[q_point];
+              for (unsigned int e = 1; e < dim; ++e)
+                value_out[comp] +=
+                  inv_t_jac[comp][e] * this->values_quad[e * nqp + q_point];
+            }
+          return value_out;
+        }
       else
         {
           const std::size_t nqp = this->n_quadrature_points;
@@ -4205,6 +4299,10 @@ inline DEAL_II_ALWAYS_INLINE
   Assert(this->gradients_quad_initialized == true,
          internal::ExcAccessToUninitializedField());
 #  endif
+  Assert(this->data->element_type !=
+           internal::MatrixFreeFunctions::ElementType::tensor_nedelec,
+         ExcNotImplemented("Only values and curls are implemented for "
+                           "FE_Nedelec"));
 
   AssertIndexRange(q_point, this->n_quadrature_points);
   Assert(this->jacobian != nullptr,
@@ -5024,6 +5122,28 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
                 }
             }
         }
+      else if (n_components == dim &&
+               this->data->element_type ==
+                 internal::MatrixFreeFunctions::ElementType::tensor_nedelec)
+        {
+          // transpose of the covariant Piola transform, J^{-1} * u * JxW
+          Assert(!is_face, ExcNotImplemented());
+          Assert(this->jacobian != nullptr,
+                 internal::ExcMatrixFreeAccessToUninitializedMappingField(
+                   "update_values"));
+          const Tensor<2, dim, VectorizedArrayType> &inv_t_jac =
+            this->jacobian[this->cell_type >
+                               internal::MatrixFreeFunctions::affine ?
+                             q_point :
+                             0];
+          for (unsigned int comp = 0; comp < n_components; ++comp)
+            {
+              values[comp * nqp] = inv_t_jac[0][comp] * val_in[0];
+              for (unsigned int e = 1; e < dim; ++e)
+                values[comp * nqp] += inv_t_jac[e][comp] * val_in[e];
+              values[comp * nqp] *= JxW;
+            }
+        }
       else
         for (unsigned int comp = 0; comp < n_components; ++comp)
           values[comp * nqp] = val_in[comp] * JxW;
@@ -5063,6 +5183,10 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
 #  ifdef DEBUG
   Assert(this->is_reinitialized, ExcNotInitialized());
 #  endif
+  Assert(this->data->element_type !=
+           internal::MatrixFreeFunctions::ElementType::tensor_nedelec,
+         ExcNotImplemented("Only values and curls are implemented for "
+                           "FE_Nedelec"));
   AssertIndexRange(q_point, this->n_quadrature_points);
   Assert(this->J_value != nullptr,
          internal::ExcMatrixFreeAccessToUninitializedMappingField(
@@ -5697,6 +5821,11 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
          internal::ExcMatrixFreeAccessToUninitializedMappingField(
            "update_gradients"));
 
+  Assert(this->data->element_type !=
+           internal::MatrixFreeFunctions::ElementType::tensor_nedelec,
+         ExcNotImplemented("Only values and curls are implemented for "
+                           "FE_Nedelec"));
+
   VectorizedArrayType divergence;
   const std::size_t   nqp = this->n_quadrature_points;
 
@@ -5818,6 +5947,52 @@ inline DEAL_II_ALWAYS_INLINE
                 "Do not try to modify the default template parameters used for"
                 " selectively enabling this function via std::enable_if!");
 
+  if (this->data->element_type ==
+      internal::MatrixFreeFunctions::ElementType::tensor_nedelec)
+    {
+#  ifdef DEBUG
+      Assert(this->gradients_quad_initialized == true,
+             internal::ExcAccessToUninitializedField());
+#  endif
+      AssertIndexRange(q_point, this->n_quadrature_points);
+      Assert(!is_face, ExcNotImplemented());
+      Assert(this->jacobian != nullptr,
+             internal::ExcMatrixFreeAccessToUninitializedMappingField(
+               "update_gradients"));
+
+      // curl in reference coordinates, transformed by J / det(J)
+      const std::size_t          nqp_d = this->n_quadrature_points * dim;
+      const VectorizedArrayType *gradients =
+        this->gradients_quad + q_point * dim;
+      const Tensor<2, dim, VectorizedArrayType> &inv_t_jac =
+        this->jacobian[this->cell_type > internal::MatrixFreeFunctions::affine ?
+                         q_point :
+                         0];
+      const VectorizedArrayType inv_det = determinant(inv_t_jac);
+      Tensor<1, (dim == 2 ? 1 : dim), VectorizedArrayType> curl;
+      if constexpr (dim == 2)
+        curl[0] = (gradients[nqp_d] - gradients[1]) * inv_det;
+      else
+        {
+          Tensor<1, dim, VectorizedArrayType> curl_ref;
+          curl_ref[0] = gradients[2 * nqp_d + 1] - gradients[nqp_d + 2];
+          curl_ref[1] = gradients[2] - gradients[2 * nqp_d];
+          curl_ref[2] = gradients[nqp_d] - gradients[1];
+          const Tensor<2, dim, VectorizedArrayType> jac =
+            this->cell_type > internal::MatrixFreeFunctions::affine ?
+              transpose(invert(inv_t_jac)) :
+              this->jacobian[1];
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              curl[d] = jac[d][0] * curl_ref[0];
+              for (unsigned int e = 1; e < dim; ++e)
+                curl[d] += jac[d][e] * curl_ref[e];
+              curl[d] *= inv_det;
+            }
+        }
+      return curl;
+    }
+
   // copy from generic function into dim-specialization function
   const Tensor<2, dim, VectorizedArrayType> grad = get_gradient(q_point);
   Tensor<1, (dim == 2 ? 1 : dim), VectorizedArrayType> curl;
@@ -5853,6 +6028,10 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
   static_assert(n_components == dim,
                 "Do not try to modify the default template parameters used for"
                 " selectively enabling this function via std::enable_if!");
+  Assert(this->data->element_type !=
+           internal::MatrixFreeFunctions::ElementType::tensor_nedelec,
+         ExcNotImplemented("Only values and curls are implemented for "
+                           "FE_Nedelec"));
 
 #  ifdef DEBUG
   Assert(this->is_reinitialized, ExcNotInitialized());
@@ -5953,7 +6132,9 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
 
   AssertThrow(
     this->data->element_type !=
-      internal::MatrixFreeFunctions::ElementType::tensor_raviart_thomas,
+        internal::MatrixFreeFunctions::ElementType::tensor_raviart_thomas &&
+      this->data->element_type !=
+        internal::MatrixFreeFunctions::ElementType::tensor_nedelec,
     ExcNotImplemented());
 
   // could have used base class operator, but that involves some overhead
@@ -6042,6 +6223,55 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
                 "Do not try to modify the default template parameters used for"
                 " selectively enabling this function via std::enable_if!");
 
+  if (this->data->element_type ==
+      internal::MatrixFreeFunctions::ElementType::tensor_nedelec)
+    {
+#  ifdef DEBUG
+      Assert(this->is_reinitialized, ExcNotInitialized());
+      this->gradients_quad_submitted = true;
+#  endif
+      AssertIndexRange(q_point, this->n_quadrature_points);
+      Assert(!is_face, ExcNotImplemented());
+      Assert(this->jacobian != nullptr,
+             internal::ExcMatrixFreeAccessToUninitializedMappingField(
+               "update_gradients"));
+
+      // test with the curl in reference coordinates: the factors det(J) of
+      // the transformation and of JxW cancel, leaving J^T * curl * weight
+      const std::size_t    nqp_d     = this->n_quadrature_points * dim;
+      VectorizedArrayType *gradients = this->gradients_quad + q_point * dim;
+      const VectorizedArrayType weight = this->quadrature_weights[q_point];
+      for (unsigned int comp = 0; comp < dim; ++comp)
+        gradients[comp * nqp_d + comp] = VectorizedArrayType();
+      if constexpr (dim == 2)
+        {
+          gradients[nqp_d] = curl[0] * weight;
+          gradients[1]     = -curl[0] * weight;
+        }
+      else
+        {
+          const Tensor<2, dim, VectorizedArrayType> jac =
+            this->cell_type > internal::MatrixFreeFunctions::affine ?
+              transpose(invert(this->jacobian[q_point])) :
+              this->jacobian[1];
+          Tensor<1, dim, VectorizedArrayType> curl_ref;
+          for (unsigned int e = 0; e < dim; ++e)
+            {
+              curl_ref[e] = jac[0][e] * curl[0];
+              for (unsigned int d = 1; d < dim; ++d)
+                curl_ref[e] += jac[d][e] * curl[d];
+              curl_ref[e] *= weight;
+            }
+          gradients[2 * nqp_d + 1] = curl_ref[0];
+          gradients[nqp_d + 2]     = -curl_ref[0];
+          gradients[2]             = curl_ref[1];
+          gradients[2 * nqp_d]     = -curl_ref[1];
+          gradients[nqp_d]         = curl_ref[2];
+          gradients[1]             = -curl_ref[2];
+        }
+      return;
+    }
+
   Tensor<2, dim, VectorizedArrayType> grad;
   switch (dim)
     {
@@ -6478,18 +6708,6 @@ FEEvaluation<dim,
   this->cell_type =
     this->matrix_free->get_mapping_info().get_cell_type(cell_index);
 
-  const unsigned int offsets =
-    this->mapping_data->data_index_offsets[cell_index];
-  this->jacobian = &this->mapping_data->jacobians[0][offsets];
-  this->J_value  = &this->mapping_data->JxW_values[offsets];
-  if (!this->mapping_data->jacobian_gradients[0].empty())
-    {
-      this->jacobian_gradients =
-        this->mapping_data->jacobian_gradients[0].data() + offsets;
-      this->jacobian_gradients_non_inverse =
-        this->mapping_data->jacobian_gradients_non_inverse[0].data() + offsets;
-    }
-
   if (this->matrix_free->n_active_entries_per_cell_batch(this->cell) == n_lanes)
     {
       DEAL_II_OPENMP_SIMD_PRAGMA
@@ -6506,10 +6724,47 @@ FEEvaluation<dim,
         this->cell_ids[i] = numbers::invalid_unsigned_int;
     }
 
-  if (this->mapping_data->quadrature_points.empty() == false)
-    this->quadrature_points =
-      &this->mapping_data->quadrature_points
-         [this->mapping_data->quadrature_point_offsets[this->cell]];
+  const auto &mapping_info = this->matrix_free->get_mapping_info();
+  if (mapping_info.cell_geometry_is_computed_on_the_fly(cell_index))
+    {
+      if (this->mapped_geometry == nullptr)
+        this->mapped_geometry =
+          std::make_shared<internal::MatrixFreeFunctions::
+                             MappingDataOnTheFly<dim, VectorizedArrayType>>();
+
+      auto &mapping_storage = this->mapped_geometry->get_data_storage();
+      AlignedVector<VectorizedArrayType> *scratch_data =
+        this->matrix_free->acquire_scratch_data();
+      mapping_info.compute_cell_geometry_on_the_fly(cell_index,
+                                                    this->quad_no,
+                                                    *scratch_data,
+                                                    mapping_storage);
+      this->matrix_free->release_scratch_data(scratch_data);
+
+      this->jacobian          = mapping_storage.jacobians[0].data();
+      this->J_value           = mapping_storage.JxW_values.data();
+      this->quadrature_points = mapping_storage.quadrature_points.data();
+    }
+  else
+    {
+      const unsigned int offsets =
+        this->mapping_data->data_index_offsets[cell_index];
+      this->jacobian = &this->mapping_data->jacobians[0][offsets];
+      this->J_value  = &this->mapping_data->JxW_values[offsets];
+      if (!this->mapping_data->jacobian_gradients[0].empty())
+        {
+          this->jacobian_gradients =
+            this->mapping_data->jacobian_gradients[0].data() + offsets;
+          this->jacobian_gradients_non_inverse =
+            this->mapping_data->jacobian_gradients_non_inverse[0].data() +
+            offsets;
+        }
+
+      if (this->mapping_data->quadrature_points.empty() == false)
+        this->quadrature_points =
+          &this->mapping_data->quadrature_points
+             [this->mapping_data->quadrature_point_offsets[this->cell]];
+    }
 
 #  ifdef DEBUG
   this->is_reinitialized           = true;
@@ -6543,6 +6798,16 @@ FEEvaluation<dim,
   this->cell     = numbers::invalid_unsigned_int;
   this->cell_ids = cell_ids;
 
+#  ifdef DEBUG
+  for (const unsigned int cell_index : cell_ids)
+    Assert(cell_index == numbers::invalid_unsigned_int ||
+             !this->matrix_free->get_mapping_info()
+                .cell_geometry_is_computed_on_the_fly(cell_index / n_lanes),
+           ExcMessage("FEEvaluation::reinit() with a list of cell indices is "
+                      "not implemented for cells whose geometry is computed "
+                      "on the fly."));
+#  endif
+
   // determine type of cell batch
   this->cell_type = internal::MatrixFreeFunctions::GeometryType::cartesian;
 
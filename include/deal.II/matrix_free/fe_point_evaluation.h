@@ -854,6 +854,23 @@ public:
   unsigned int
   n_active_entries_per_quadrature_batch(unsigned int q);
 
+  /**
+   * Evaluate the shape functions of the finite element at all points of the
+   * cells the MappingInfo object passed to the constructor has been set up
+   * for, and store them in the MappingInfo object, see
+   * NonMatching::MappingInfo::precompute_shape_values(). Afterwards, reinit()
+   * of this object and of all other objects sharing the MappingInfo object
+   * with the same finite element does not need to compute shape values
+   * anymore, which makes repeated evaluations on fixed points, e.g., of
+   * several vectors or in several time steps, cheaper.
+   *
+   * This function has no effect if the evaluation does not use the fast path
+   * for tensor product elements or if the shape functions are linear, since
+   * their evaluation is cheaper than loading precomputed values.
+   */
+  void
+  precompute_shape_values();
+
 protected:
   static constexpr std::size_t n_lanes_user_interface =
     internal::VectorizedArrayTrait<Number>::width();
@@ -1091,6 +1108,13 @@ protected:
    */
   AlignedVector<dealii::ndarray<VectorizedArrayType, 2, dim - 1>> shapes_faces;
 
+  /**
+   * Pointer to the tensor product shape functions at the vectorized unit
+   * points of the current cell, pointing either into @p shapes or into the
+   * data precomputed by NonMatching::MappingInfo::precompute_shape_values().
+   */
+  const dealii::ndarray<VectorizedArrayType, 2, dim> *shapes_ptr;
+
   const bool is_interior;
 };
 
@@ -1844,6 +1868,7 @@ FEPointEvaluationBase<n_components_, dim, spacedim, Number>::
   , current_cell_index(numbers::invalid_unsigned_int)
   , current_face_number(numbers::invalid_unsigned_int)
   , must_reinitialize_pointers(false)
+  , shapes_ptr(nullptr)
   , is_interior(true)
 {
   setup(first_selected_component);
@@ -1869,6 +1894,7 @@ FEPointEvaluationBase<n_components_, dim, spacedim, Number>::
   , current_cell_index(numbers::invalid_unsigned_int)
   , current_face_number(numbers::invalid_unsigned_int)
   , must_reinitialize_pointers(true)
+  , shapes_ptr(nullptr)
   , is_interior(is_interior)
 {
   setup(first_selected_component);
@@ -1909,6 +1935,7 @@ FEPointEvaluationBase<n_components_, dim, spacedim, Number>::
   , current_face_number(other.current_face_number)
   , fast_path(other.fast_path)
   , must_reinitialize_pointers(true)
+  , shapes_ptr(nullptr)
   , is_interior(other.is_interior)
 {}
 
@@ -1941,6 +1968,9 @@ FEPointEvaluationBase<n_components_, dim, spacedim, Number>::
   , current_face_number(other.current_face_number)
   , fast_path(other.fast_path)
   , must_reinitialize_pointers(other.must_reinitialize_pointers)
+  , shapes(std::move(other.shapes))
+  , shapes_faces(std::move(other.shapes_faces))
+  , shapes_ptr(other.shapes_ptr)
   , is_interior(other.is_interior)
 {}
 
@@ -2108,6 +2138,13 @@ FEPointEvaluationBase<n_components_, dim, spacedim, Number>::do_reinit()
 
   if (!is_linear && fast_path)
     {
+      if (!is_face)
+        {
+          shapes_ptr = mapping_info->get_shape_values(unit_point_offset, poly);
+          if (shapes_ptr != nullptr)
+            return;
+        }
+
       const std::size_t n_shapes = poly.size();
       if (is_face)
         shapes_faces.resize_fast(n_q_batches * n_shapes);
@@ -2154,6 +2191,9 @@ FEPointEvaluationBase<n_components_, dim, spacedim, Number>::do_reinit()
                                                   0);
               }
           }
+
+      if (!is_face)
+        shapes_ptr = shapes.data();
     }
 }
 
@@ -2611,6 +2651,21 @@ FEPointEvaluationBase<n_components_, dim, spacedim, Number>::
 
 
 
+template <int n_components_, int dim, int spacedim, typename Number>
+void
+FEPointEvaluationBase<n_components_, dim, spacedim, Number>::
+  precompute_shape_values()
+{
+  Assert(mapping_info_on_the_fly.get() == nullptr,
+         ExcMessage("Shape values can only be precomputed for a MappingInfo "
+                    "object passed to the constructor."));
+
+  if (fast_path && !use_linear_path)
+    mapping_info->precompute_shape_values(poly);
+}
+
+
+
 template <int n_components_, int dim, int spacedim, typename Number>
 template <std::size_t stride_view>
 void
@@ -2708,7 +2763,7 @@ FEPointEvaluation<n_components_, dim, spacedim, Number>::compute_evaluate_fast(
           scalar_value_type,
           VectorizedArrayType,
           1,
-          false>(this->shapes.data() + qb * n_shapes,
+          false>(this->shapes_ptr + qb * n_shapes,
                  n_shapes,
                  this->solution_renumbered.data());
       gradient[0] = result[0];
@@ -2738,7 +2793,7 @@ FEPointEvaluation<n_components_, dim, spacedim, Number>::compute_evaluate_fast(
                                                          scalar_value_type,
                                                          VectorizedArrayType,
                                                          false>(
-            this->shapes.data() + qb * n_shapes,
+            this->shapes_ptr + qb * n_shapes,
             n_shapes,
             this->solution_renumbered.data());
     }
@@ -2910,7 +2965,7 @@ FEPointEvaluation<n_components_, dim, spacedim, Number>::compute_integrate_fast(
       is_linear,
       dim,
       VectorizedArrayType,
-      vectorized_value_type>(this->shapes.data() + qb * n_shapes,
+      vectorized_value_type>(this->shapes_ptr + qb * n_shapes,
                              n_shapes,
                              &value,
                              gradient,
@@ -2924,7 +2979,7 @@ FEPointEvaluation<n_components_, dim, spacedim, Number>::compute_integrate_fast(
                                              dim,
                                              VectorizedArrayType,
                                              vectorized_value_type>(
-      this->shapes.data() + qb * n_shapes,
+      this->shapes_ptr + qb * n_shapes,
       n_shapes,
       value,
       is_linear ? solution_values_vectorized_linear :
@@ -26,6 +26,7 @@
 #include <deal.II/fe/fe.h>
 #include <deal.II/fe/mapping.h>
 
+#include <deal.II/grid/cell_id.h>
 #include <deal.II/grid/reference_cell.h>
 
 #include <deal.II/hp/mapping_collection.h>
@@ -33,7 +34,9 @@
 
 #include <deal.II/matrix_free/face_info.h>
 #include <deal.II/matrix_free/mapping_info_storage.h>
+#include <deal.II/matrix_free/shape_info.h>
 
+#include <map>
 #include <memory>
 
 
@@ -73,7 +76,9 @@ namespace internal
         const UpdateFlags update_flags_boundary_faces,
         const UpdateFlags update_flags_inner_faces,
         const UpdateFlags update_flags_faces_by_cells,
-        const bool        piola_transform);
+        const bool        piola_transform,
+        const bool        reuse_geometry_of_unchanged_cells = false,
+        const bool        compute_cell_geometry_on_the_fly  = false);
 
       /**
        * Update the information in the given cells and faces that is the
@@ -95,6 +100,30 @@ namespace internal
       GeometryType
       get_cell_type(const unsigned int cell_chunk_no) const;
 
+      /**
+       * Return whether the geometry of the given cell batch is not stored in
+       * @p cell_data but needs to be computed with
+       * compute_cell_geometry_on_the_fly().
+       */
+      bool
+      cell_geometry_is_computed_on_the_fly(
+        const unsigned int cell_chunk_no) const;
+
+      /**
+       * Compute the inverse Jacobians, the JxW values and, if requested by
+       * @p update_flags_cells, the quadrature points of the given cell batch
+       * with the quadrature formula @p quad_no from the support points of
+       * the mapping, storing the result in the first entries of @p result
+       * in the same format as for a general cell in @p cell_data. The vector
+       * @p scratch_data is used as temporary storage for the evaluation.
+       */
+      void
+      compute_cell_geometry_on_the_fly(
+        const unsigned int                                 cell_chunk_no,
+        const unsigned int                                 quad_no,
+        AlignedVector<VectorizedArrayType>                &scratch_data,
+        MappingInfoStorage<dim, dim, VectorizedArrayType> &result) const;
+
       /**
        * Clear all data fields in this class.
        */
@@ -194,6 +223,85 @@ namespace internal
        */
       ObserverPointer<const Mapping<dim>> mapping;
 
+      /**
+       * The geometry of the cells as computed in the first step of
+       * compute_mapping_q(), i.e., the position of the support points of the
+       * mapping, the Jacobians on a stencil around the first support point,
+       * and the type of the cell, stored by the CellId of the cells. If
+       * enabled via the last argument of initialize(), this information is
+       * kept from one call of initialize() to the next one, and all cells
+       * found in the cache are not evaluated again.
+       */
+      struct CellGeometryCache
+      {
+        /**
+         * Whether the geometry is stored after a call to initialize().
+         */
+        bool is_active = false;
+
+        /**
+         * The degree of the MappingQ object the data has been computed with.
+         */
+        unsigned int mapping_degree = numbers::invalid_unsigned_int;
+
+        /**
+         * The position of the data of a cell in the remaining fields.
+         */
+        std::map<CellId, unsigned int> cell_indices;
+
+        /**
+         * The coordinates of the support points of the mapping, with the
+         * same layout as used in compute_mapping_q().
+         */
+        AlignedVector<double> mapping_points;
+
+        /**
+         * The Jacobians evaluated on the stencil used for detecting similar
+         * cells.
+         */
+        AlignedVector<std::array<Tensor<2, dim>, dim + 1>> jacobians_on_stencil;
+
+        /**
+         * The geometry type of the cells.
+         */
+        std::vector<GeometryType> cell_type;
+      };
+
+      /**
+       * The cache for the geometry of the cells.
+       */
+      CellGeometryCache geometry_cache;
+
+      /**
+       * Whether the geometry of cells with general (curved) shape is
+       * computed on the fly from the support points of the mapping rather
+       * than stored for every quadrature point, as set by the last argument
+       * of initialize(). Only implemented for MappingQ without hp-capabilities
+       * and without @p update_jacobian_grads.
+       */
+      bool cell_geometry_on_the_fly = false;
+
+      /**
+       * The support points of the mapping on the cell batches whose
+       * geometry is computed on the fly, with @p dim times the number of
+       * support points entries per cell batch, ordered by component.
+       */
+      AlignedVector<VectorizedArrayType> cell_mapping_support_points;
+
+      /**
+       * The start index of the support points of a cell batch within
+       * @p cell_mapping_support_points, or numbers::invalid_unsigned_int if
+       * the geometry of the cell batch is stored in @p cell_data.
+       */
+      std::vector<unsigned int> cell_mapping_support_point_offsets;
+
+      /**
+       * The interpolation matrices from the support points of the mapping to
+       * the quadrature points of each quadrature formula, used for
+       * computing the geometry on the fly.
+       */
+      std::vector<ShapeInfo<Number>> cell_mapping_shape_info;
+
       /**
        * Reference-cell type related to each quadrature and active quadrature
        * index.
@@ -299,6 +407,19 @@ namespace internal
 
     /* ------------------- inline functions ----------------------------- */
 
+    template <int dim, typename Number, typename VectorizedArrayType>
+    inline bool
+    MappingInfo<dim, Number, VectorizedArrayType>::
+      cell_geometry_is_computed_on_the_fly(
+        const unsigned int cell_chunk_no) const
+    {
+      return cell_chunk_no < cell_mapping_support_point_offsets.size() &&
+             cell_mapping_support_point_offsets[cell_chunk_no] !=
+               numbers::invalid_unsigned_int;
+    }
+
+
+
     template <int dim, typename Number, typename VectorizedArrayType>
     inline GeometryType
     MappingInfo<dim, Number, VectorizedArrayType>::get_cell_type(
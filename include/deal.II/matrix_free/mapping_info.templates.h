@@ -54,6 +54,11 @@ namespace internal
       face_type.clear();
       mapping_collection = nullptr;
       mapping            = nullptr;
+      geometry_cache     = CellGeometryCache();
+      cell_geometry_on_the_fly = false;
+      cell_mapping_support_points.clear();
+      cell_mapping_support_point_offsets.clear();
+      cell_mapping_shape_info.clear();
     }
 
 
@@ -71,9 +76,17 @@ namespace internal
       const UpdateFlags update_flags_boundary_faces,
       const UpdateFlags update_flags_inner_faces,
       const UpdateFlags update_flags_faces_by_cells,
-      const bool        piola_transform)
+      const bool        piola_transform,
+      const bool        reuse_geometry_of_unchanged_cells,
+      const bool        compute_cell_geometry_on_the_fly)
     {
+      CellGeometryCache old_geometry_cache = std::move(geometry_cache);
       clear();
+      if (reuse_geometry_of_unchanged_cells)
+        geometry_cache = std::move(old_geometry_cache);
+      geometry_cache.is_active = reuse_geometry_of_unchanged_cells;
+      cell_geometry_on_the_fly = compute_cell_geometry_on_the_fly;
+
       this->mapping_collection = mapping;
       this->mapping            = &mapping->operator[](0);
 
@@ -190,6 +203,11 @@ namespace internal
         compute_mapping_q(tria, cells, face_info);
       else
         {
+          AssertThrow(cell_geometry_on_the_fly == false || cells.empty(),
+                      ExcNotImplemented(
+                        "Computing the cell geometry on the fly is only "
+                        "implemented for MappingQ without hp-capabilities."));
+
           // Could call these functions in parallel, but not useful because
           // the work inside is nicely split up already
           initialize_cells(tria, cells, active_fe_index, *mapping);
@@ -220,6 +238,12 @@ namespace internal
       for (auto &data : face_data_by_cells)
         data.clear_data_fields();
 
+      // the geometry of the cells changes with the mapping, so the stored
+      // data can not be used any more
+      const bool store_geometry = geometry_cache.is_active;
+      geometry_cache            = CellGeometryCache();
+      geometry_cache.is_active  = store_geometry;
+
       this->mapping_collection = mapping;
       this->mapping            = &mapping->operator[](0);
 
@@ -228,6 +252,11 @@ namespace internal
         compute_mapping_q(tria, cells, face_info);
       else
         {
+          AssertThrow(cell_geometry_on_the_fly == false || cells.empty(),
+                      ExcNotImplemented(
+                        "Computing the cell geometry on the fly is only "
+                        "implemented for MappingQ without hp-capabilities."));
+
           // Could call these functions in parallel, but not useful because
           // the work inside is nicely split up already
           initialize_cells(tria, cells, active_fe_index, *mapping);
@@ -1169,6 +1198,7 @@ namespace internal
         const std::vector<GeometryType>                          &cell_type,
         const std::vector<bool>                                  &process_cell,
         const UpdateFlags            update_flags_cells,
+        const bool                   geometry_on_the_fly,
         const AlignedVector<double> &plain_quadrature_points,
         const ShapeInfo<double>     &shape_info,
         MappingInfoStorage<dim, dim, VectorizedArrayType> &my_data)
@@ -1189,6 +1219,10 @@ namespace internal
         for (unsigned int cell = begin_cell; cell < end_cell; ++cell)
           for (unsigned vv = 0; vv < n_lanes; vv += n_lanes_d)
             {
+              // the geometry of these cells is computed by FEEvaluation
+              if (geometry_on_the_fly && cell_type[cell] == general)
+                continue;
+
               if (cell_type[cell] > affine || process_cell[cell])
                 {
                   unsigned int start_indices[n_lanes_d];
@@ -2689,32 +2723,137 @@ namespace internal
         AlignedVector<std::array<Tensor<2, dim>, dim + 1>> jacobians_on_stencil(
           cell_array.size());
 
-        // Create as many chunks of cells as we have threads and spawn the
-        // work
-        unsigned int work_per_chunk =
-          std::max(std::size_t(1),
-                   (cell_array.size() + MultithreadInfo::n_threads() - 1) /
-                     MultithreadInfo::n_threads());
-
-        // we manually use tasks here rather than parallel::apply_to_subranges
-        // because we want exactly as many loops as we have threads - the
-        // initialization of the loops with FEValues is expensive
-        std::size_t          offset = 0;
-        Threads::TaskGroup<> tasks;
-        for (unsigned int t = 0; t < MultithreadInfo::n_threads();
-             ++t, offset += work_per_chunk)
-          tasks += Threads::new_task(
-            &ExtractCellHelper::mapping_q_query_fe_values<dim>,
-            offset,
-            std::min(cell_array.size(), offset + work_per_chunk),
-            *mapping_q,
-            tria,
-            cell_array,
-            jacobian_size,
-            preliminary_cell_type,
-            plain_quadrature_points,
-            jacobians_on_stencil);
-        tasks.join_all();
+        const auto query_fe_values =
+          [&](const std::vector<std::pair<unsigned int, unsigned int>> &cells,
+              std::vector<GeometryType>                          &cell_types,
+              AlignedVector<double>                              &points,
+              AlignedVector<std::array<Tensor<2, dim>, dim + 1>> &jacobians) {
+            // Create as many chunks of cells as we have threads and spawn the
+            // work
+            unsigned int work_per_chunk =
+              std::max(std::size_t(1),
+                       (cells.size() + MultithreadInfo::n_threads() - 1) /
+                         MultithreadInfo::n_threads());
+
+            // we manually use tasks here rather than
+            // parallel::apply_to_subranges because we want exactly as many
+            // loops as we have threads - the initialization of the loops with
+            // FEValues is expensive
+            std::size_t          offset = 0;
+            Threads::TaskGroup<> tasks;
+            for (unsigned int t = 0; t < MultithreadInfo::n_threads();
+                 ++t, offset += work_per_chunk)
+              tasks += Threads::new_task(
+                &ExtractCellHelper::mapping_q_query_fe_values<dim>,
+                offset,
+                std::min(cells.size(), offset + work_per_chunk),
+                *mapping_q,
+                tria,
+                cells,
+                jacobian_size,
+                cell_types,
+                points,
+                jacobians);
+            tasks.join_all();
+          };
+
+        if (geometry_cache.is_active == false)
+          query_fe_values(cell_array,
+                          preliminary_cell_type,
+                          plain_quadrature_points,
+                          jacobians_on_stencil);
+        else
+          {
+            // look up the cells in the geometry stored by a previous call,
+            // and only evaluate the mapping on the cells not found there
+            const unsigned int n_points_per_cell = n_mapping_points * dim;
+            if (geometry_cache.mapping_degree != mapping_degree)
+              geometry_cache.cell_indices.clear();
+
+            std::vector<CellId>       cell_ids(cell_array.size());
+            std::vector<unsigned int> cached_index(cell_array.size());
+            dealii::parallel::apply_to_subranges(
+              std::size_t(0),
+              cell_array.size(),
+              [&](const std::size_t begin, const std::size_t end) {
+                for (std::size_t cell = begin; cell < end; ++cell)
+                  {
+                    const typename dealii::Triangulation<dim>::cell_iterator
+                      cell_it(&tria,
+                              cell_array[cell].first,
+                              cell_array[cell].second);
+                    cell_ids[cell] = cell_it->id();
+
+                    const auto entry =
+                      geometry_cache.cell_indices.find(cell_ids[cell]);
+                    if (entry == geometry_cache.cell_indices.end())
+                      {
+                        cached_index[cell] = numbers::invalid_unsigned_int;
+                        continue;
+                      }
+
+                    const unsigned int index = entry->second;
+                    cached_index[cell]       = index;
+                    std::copy_n(geometry_cache.mapping_points.data() +
+                                  std::size_t(index) * n_points_per_cell,
+                                n_points_per_cell,
+                                plain_quadrature_points.data() +
+                                  cell * n_points_per_cell);
+                    jacobians_on_stencil[cell] =
+                      geometry_cache.jacobians_on_stencil[index];
+                    preliminary_cell_type[cell] =
+                      geometry_cache.cell_type[index];
+                  }
+              },
+              64);
+
+            std::vector<std::pair<unsigned int, unsigned int>> new_cells;
+            std::vector<std::size_t>                           new_positions;
+            for (std::size_t cell = 0; cell < cell_array.size(); ++cell)
+              if (cached_index[cell] == numbers::invalid_unsigned_int)
+                {
+                  new_cells.push_back(cell_array[cell]);
+                  new_positions.push_back(cell);
+                }
+
+            if (new_cells.size() == cell_array.size())
+              query_fe_values(cell_array,
+                              preliminary_cell_type,
+                              plain_quadrature_points,
+                              jacobians_on_stencil);
+            else if (!new_cells.empty())
+              {
+                std::vector<GeometryType> new_cell_type(new_cells.size());
+                AlignedVector<double>     new_points(new_cells.size() *
+                                                 n_points_per_cell);
+                AlignedVector<std::array<Tensor<2, dim>, dim + 1>>
+                  new_jacobians(new_cells.size());
+                query_fe_values(new_cells,
+                                new_cell_type,
+                                new_points,
+                                new_jacobians);
+                for (std::size_t i = 0; i < new_cells.size(); ++i)
+                  {
+                    const std::size_t cell = new_positions[i];
+                    std::copy_n(new_points.data() + i * n_points_per_cell,
+                                n_points_per_cell,
+                                plain_quadrature_points.data() +
+                                  cell * n_points_per_cell);
+                    jacobians_on_stencil[cell]  = new_jacobians[i];
+                    preliminary_cell_type[cell] = new_cell_type[i];
+                  }
+              }
+
+            // store the geometry of the current cells for the next call
+            geometry_cache.mapping_degree = mapping_degree;
+            geometry_cache.cell_indices.clear();
+            for (std::size_t cell = 0; cell < cell_array.size(); ++cell)
+              geometry_cache.cell_indices.emplace(cell_ids[cell], cell);
+            geometry_cache.mapping_points       = plain_quadrature_points;
+            geometry_cache.jacobians_on_stencil = jacobians_on_stencil;
+            geometry_cache.cell_type            = preliminary_cell_type;
+          }
+
         cell_data_index =
           ExtractCellHelper::mapping_q_find_compression(jacobian_size,
                                                         jacobians_on_stencil,
@@ -2781,6 +2920,67 @@ namespace internal
                               preliminary_cell_type.data() + cell + n_lanes);
         }
 
+      // step 3b: if requested, keep the support points of the mapping on
+      // the general cells in the layout of FEEvaluation instead of the data
+      // in the quadrature points, and set up the interpolation matrices for
+      // computing the geometry on the fly
+      cell_mapping_support_points.clear();
+      cell_mapping_support_point_offsets.clear();
+      cell_mapping_shape_info.clear();
+      if (cell_geometry_on_the_fly)
+        {
+          AssertThrow((update_flags_cells & update_jacobian_grads) == 0,
+                      ExcNotImplemented(
+                        "Computing the cell geometry on the fly is not "
+                        "implemented for the update flag "
+                        "update_jacobian_grads."));
+
+          cell_mapping_support_point_offsets.resize(
+            cell_type.size(), numbers::invalid_unsigned_int);
+          unsigned int n_stored_cells = 0;
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] == general)
+              {
+                if (process_cell[cell])
+                  cell_mapping_support_point_offsets[cell] =
+                    (n_stored_cells++) * dim * n_mapping_points;
+                else
+                  cell_mapping_support_point_offsets[cell] =
+                    cell_mapping_support_point_offsets
+                      [cell_data_index_vect[cell]];
+                Assert(cell_mapping_support_point_offsets[cell] !=
+                         numbers::invalid_unsigned_int,
+                       ExcInternalError());
+              }
+
+          cell_mapping_support_points.resize_fast(n_stored_cells * dim *
+                                                  n_mapping_points);
+          dealii::parallel::apply_to_subranges(
+            0U,
+            cell_type.size(),
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int cell = begin; cell < end; ++cell)
+                if (cell_type[cell] == general && process_cell[cell])
+                  {
+                    VectorizedArrayType *support_points =
+                      cell_mapping_support_points.data() +
+                      cell_mapping_support_point_offsets[cell];
+                    for (unsigned int v = 0; v < n_lanes; ++v)
+                      for (unsigned int i = 0; i < dim * n_mapping_points; ++i)
+                        support_points[i][v] = plain_quadrature_points
+                          [(cell * n_lanes + v) * dim * n_mapping_points + i];
+                  }
+            },
+            std::max(cell_type.size() / MultithreadInfo::n_threads() / 2,
+                     std::size_t(2U)));
+
+          FE_DGQ<dim> fe_geometry(mapping_degree);
+          cell_mapping_shape_info.resize(cell_data.size());
+          for (unsigned int my_q = 0; my_q < cell_data.size(); ++my_q)
+            cell_mapping_shape_info[my_q].reinit(
+              cell_data[my_q].descriptor[0].quadrature, fe_geometry);
+        }
+
       // step 4: compute the data on cells from the cached quadrature
       // points, filling up all SIMD lanes as appropriate
       for (unsigned int my_q = 0; my_q < cell_data.size(); ++my_q)
@@ -2800,10 +3000,11 @@ namespace internal
                   my_data.data_index_offsets[cell_data_index_vect[cell]];
               else
                 my_data.data_index_offsets[cell] = max_size;
-              max_size =
-                std::max(max_size,
-                         my_data.data_index_offsets[cell] +
-                           (cell_type[cell] <= affine ? 2 : n_q_points));
+              if (cell_geometry_is_computed_on_the_fly(cell) == false)
+                max_size =
+                  std::max(max_size,
+                           my_data.data_index_offsets[cell] +
+                             (cell_type[cell] <= affine ? 2 : n_q_points));
             }
 
           my_data.JxW_values.resize_fast(max_size);
@@ -2816,17 +3017,22 @@ namespace internal
 
           if (update_flags_cells & update_quadrature_points)
             {
+              const auto n_stored_points = [&](const unsigned int cell) {
+                if (cell_type[cell] <= affine)
+                  return 1U;
+                else if (cell_geometry_is_computed_on_the_fly(cell))
+                  return 0U;
+                else
+                  return n_q_points;
+              };
               my_data.quadrature_point_offsets.resize(cell_type.size());
               for (unsigned int cell = 1; cell < cell_type.size(); ++cell)
-                if (cell_type[cell - 1] <= affine)
-                  my_data.quadrature_point_offsets[cell] =
-                    my_data.quadrature_point_offsets[cell - 1] + 1;
-                else
-                  my_data.quadrature_point_offsets[cell] =
-                    my_data.quadrature_point_offsets[cell - 1] + n_q_points;
+                my_data.quadrature_point_offsets[cell] =
+                  my_data.quadrature_point_offsets[cell - 1] +
+                  n_stored_points(cell - 1);
               my_data.quadrature_points.resize_fast(
                 my_data.quadrature_point_offsets.back() +
-                (cell_type.back() <= affine ? 1 : n_q_points));
+                n_stored_points(cell_type.size() - 1));
             }
 
           // step 4b: go through the cells and compute the information using
@@ -2846,6 +3052,7 @@ namespace internal
                 cell_type,
                 process_cell,
                 update_flags_cells,
+                cell_geometry_on_the_fly,
                 plain_quadrature_points,
                 shape_infos[my_q],
                 my_data);
@@ -3362,6 +3569,60 @@ namespace internal
 
 
 
+    template <int dim, typename Number, typename VectorizedArrayType>
+    void
+    MappingInfo<dim, Number, VectorizedArrayType>::
+      compute_cell_geometry_on_the_fly(
+        const unsigned int                                 cell_chunk_no,
+        const unsigned int                                 quad_no,
+        AlignedVector<VectorizedArrayType>                &scratch_data,
+        MappingInfoStorage<dim, dim, VectorizedArrayType> &result) const
+    {
+      AssertIndexRange(quad_no, cell_mapping_shape_info.size());
+      Assert(cell_geometry_is_computed_on_the_fly(cell_chunk_no),
+             ExcInternalError());
+
+      const ShapeInfo<Number> &shape_info = cell_mapping_shape_info[quad_no];
+      const unsigned int       n_q_points = shape_info.n_q_points;
+      const bool compute_points = update_flags_cells & update_quadrature_points;
+
+      FEEvaluationData<dim, VectorizedArrayType, false> eval(shape_info);
+      eval.set_data_pointers(&scratch_data, dim);
+      FEEvaluationFactory<dim, VectorizedArrayType>::evaluate(
+        dim,
+        EvaluationFlags::gradients |
+          (compute_points ? EvaluationFlags::values : EvaluationFlags::nothing),
+        cell_mapping_support_points.data() +
+          cell_mapping_support_point_offsets[cell_chunk_no],
+        eval);
+
+      if (result.jacobians[0].size() != n_q_points)
+        result.jacobians[0].resize_fast(n_q_points);
+      if (result.JxW_values.size() != n_q_points)
+        result.JxW_values.resize_fast(n_q_points);
+      if (compute_points && result.quadrature_points.size() != n_q_points)
+        result.quadrature_points.resize_fast(n_q_points);
+
+      const AlignedVector<Number> &weights =
+        cell_data[quad_no].descriptor[0].quadrature_weights;
+      for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+          Tensor<2, dim, VectorizedArrayType> jac;
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int e = 0; e < dim; ++e)
+              jac[d][e] =
+                eval.begin_gradients()[e + (d * n_q_points + q) * dim];
+          result.JxW_values[q]   = determinant(jac) * weights[q];
+          result.jacobians[0][q] = transpose(invert(jac));
+          if (compute_points)
+            for (unsigned int d = 0; d < dim; ++d)
+              result.quadrature_points[q][d] =
+                eval.begin_values()[q + d * n_q_points];
+        }
+    }
+
+
+
     template <int dim, typename Number, typename VectorizedArrayType>
     std::size_t
     MappingInfo<dim, Number, VectorizedArrayType>::memory_consumption() const
@@ -3373,6 +3634,18 @@ namespace internal
       memory += face_type.capacity() * sizeof(GeometryType);
       memory += faces_by_cells_type.capacity() *
                 GeometryInfo<dim>::faces_per_cell * sizeof(GeometryType);
+      memory += geometry_cache.cell_indices.size() *
+                (sizeof(CellId) + sizeof(unsigned int));
+      memory +=
+        MemoryConsumption::memory_consumption(geometry_cache.mapping_points);
+      memory += MemoryConsumption::memory_consumption(
+        geometry_cache.jacobians_on_stencil);
+      memory += geometry_cache.cell_type.capacity() * sizeof(GeometryType);
+      memory +=
+        MemoryConsumption::memory_consumption(cell_mapping_support_points);
+      memory += MemoryConsumption::memory_consumption(
+        cell_mapping_support_point_offsets);
+      memory += MemoryConsumption::memory_consumption(cell_mapping_shape_info);
       memory += sizeof(*this);
       return memory;
     }
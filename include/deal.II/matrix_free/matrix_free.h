@@ -39,6 +39,7 @@
 #include <deal.II/lac/vector_operation.h>
 
 #include <deal.II/matrix_free/dof_info.h>
+#include <deal.II/matrix_free/evaluation_flags.h>
 #include <deal.II/matrix_free/mapping_info.h>
 #include <deal.II/matrix_free/shape_info.h>
 #include <deal.II/matrix_free/task_info.h>
@@ -48,7 +49,9 @@
 #include <cstdlib>
 #include <limits>
 #include <list>
+#include <map>
 #include <memory>
+#include <string>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -233,7 +236,10 @@ public:
       const bool         overlap_communication_computation    = true,
       const bool         hold_all_faces_to_owned_cells        = false,
       const bool         cell_vectorization_categories_strict = false,
-      const bool         allow_ghosted_vectors_in_loops       = true)
+      const bool         allow_ghosted_vectors_in_loops       = true,
+      const unsigned int communication_progress_interval      = 0,
+      const bool         reuse_geometry_of_unchanged_cells    = false,
+      const bool         compute_cell_geometry_on_the_fly     = false)
       : tasks_parallel_scheme(tasks_parallel_scheme)
       , tasks_block_size(tasks_block_size)
       , mapping_update_flags(mapping_update_flags)
@@ -249,7 +255,11 @@ public:
       , cell_vectorization_categories_strict(
           cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(allow_ghosted_vectors_in_loops)
+      , communication_progress_interval(communication_progress_interval)
+      , reuse_geometry_of_unchanged_cells(reuse_geometry_of_unchanged_cells)
+      , compute_cell_geometry_on_the_fly(compute_cell_geometry_on_the_fly)
       , communicator_sm(MPI_COMM_SELF)
+      , shape_info_source(nullptr)
     {}
 
     /**
@@ -275,7 +285,12 @@ public:
       , cell_vectorization_categories_strict(
           other.cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(other.allow_ghosted_vectors_in_loops)
+      , communication_progress_interval(other.communication_progress_interval)
+      , reuse_geometry_of_unchanged_cells(
+          other.reuse_geometry_of_unchanged_cells)
+      , compute_cell_geometry_on_the_fly(other.compute_cell_geometry_on_the_fly)
       , communicator_sm(other.communicator_sm)
+      , shape_info_source(other.shape_info_source)
     {}
 
     /**
@@ -302,8 +317,13 @@ public:
       cell_vectorization_category   = other.cell_vectorization_category;
       cell_vectorization_categories_strict =
         other.cell_vectorization_categories_strict;
-      allow_ghosted_vectors_in_loops = other.allow_ghosted_vectors_in_loops;
-      communicator_sm                = other.communicator_sm;
+      allow_ghosted_vectors_in_loops  = other.allow_ghosted_vectors_in_loops;
+      communication_progress_interval = other.communication_progress_interval;
+      reuse_geometry_of_unchanged_cells =
+        other.reuse_geometry_of_unchanged_cells;
+      compute_cell_geometry_on_the_fly = other.compute_cell_geometry_on_the_fly;
+      communicator_sm                  = other.communicator_sm;
+      shape_info_source                = other.shape_info_source;
 
       return *this;
     }
@@ -547,10 +567,92 @@ public:
      */
     bool allow_ghosted_vectors_in_loops;
 
+    /**
+     * With the serial loop (@p tasks_parallel_scheme set to @p none), the
+     * loops are split into three phases: First the cells and faces that do
+     * not access data from other MPI processes are processed while the ghost
+     * exchange started by update_ghost_values() is in flight, then the
+     * exchange is completed and the cells and faces at the MPI boundary are
+     * processed, and finally the remaining cells are processed while the
+     * compress() operation is in flight. Many MPI implementations only
+     * progress non-blocking messages while the application is inside the MPI
+     * library. If this variable is set to a positive number, the first and
+     * last phases are subdivided into chunks of that many cell batches, with
+     * a non-blocking call to MPI in between to progress the messages. This
+     * can hide the latency of the data exchange at scale. The default is 0,
+     * i.e., the phases are run without interruption.
+     */
+    unsigned int communication_progress_interval;
+
+    /**
+     * If set to true, the geometry of the cells computed with a MappingQ
+     * (the positions of the support points of the mapping on each cell) is
+     * kept after the call to MatrixFree::reinit(). A subsequent call to
+     * reinit() with this flag set, typically after adaptive refinement of
+     * the mesh, then only evaluates the mapping on the cells that were not
+     * present before, identified by their CellId, and reuses the stored data
+     * for all other cells. The Jacobians and JxW values of the cell batches
+     * are then computed from these data, filling the SIMD lanes according
+     * to the new arrangement of the cells. For meshes where only a small
+     * fraction of the cells changes between two calls, this avoids most of
+     * the cost of evaluating the mapping.
+     *
+     * The stored data is only valid if the triangulation and the mapping
+     * are the same in both calls, except for the refined and coarsened
+     * cells. If the mapping itself changes, e.g. for a MappingQEulerian
+     * with a new displacement, the data is outdated and this flag must not
+     * be set in the next call. The flag has no effect for mappings other
+     * than MappingQ or with hp-capabilities, and it needs additional memory
+     * of the size of one set of mapping support points per cell.
+     */
+    bool reuse_geometry_of_unchanged_cells;
+
+    /**
+     * If set to true, the inverse Jacobians and JxW values (and quadrature
+     * points, if requested) on cells with a general, i.e., curved, geometry
+     * are not precomputed and stored for every quadrature point. Instead,
+     * only the support points of the mapping are stored for these cells,
+     * and FEEvaluation::reinit() evaluates the geometry from them with
+     * sum factorization, in the same way as the solution itself is
+     * interpolated to the quadrature points. For high-degree MappingQ on
+     * curved meshes, where the geometry data dominates the memory
+     * transfer of a matrix-free operator evaluation, this reduces the
+     * data to be loaded per cell from $dim^2+1$ numbers per quadrature
+     * point to $dim$ numbers per mapping support point, at the cost of
+     * additional arithmetic operations.
+     *
+     * This option is only available for MappingQ without hp-capabilities
+     * and without update_jacobian_grads, and only for FEEvaluation objects
+     * initialized by a cell batch index. The data on affine and Cartesian
+     * cells as well as the data on faces are stored as usual. Access to
+     * the geometry of general cells through the MappingInfo data fields
+     * directly, e.g. via MatrixFree::get_mapping_info(), is not possible
+     * with this option.
+     */
+    bool compute_cell_geometry_on_the_fly;
+
     /**
      * Shared-memory MPI communicator. Default: MPI_COMM_SELF.
      */
     MPI_Comm communicator_sm;
+
+    /**
+     * Another MatrixFree object from which to copy the precomputed data of
+     * the shape functions (see get_shape_info()) for all combinations of
+     * finite element, base element, and quadrature formula that it has in
+     * common with the current object, rather than computing them again. A
+     * typical use is a multigrid hierarchy where the MatrixFree objects on
+     * all levels are set up with the same finite element and quadrature: one
+     * can then pass the object of the finest level when setting up all other
+     * levels. The given object must remain valid during the call to
+     * reinit() only. Default: nullptr.
+     *
+     * Independently of this field, reinit() computes the data only once for
+     * combinations that appear several times in the current object (e.g.,
+     * for several DoFHandler objects with the same element), and reuses
+     * the data from a previous call to reinit() on the same object.
+     */
+    const MatrixFree<dim, Number, VectorizedArrayType> *shape_info_source;
   };
 
   /**
@@ -1012,6 +1114,90 @@ public:
                               &operation_after_loop,
             const unsigned int dof_handler_index_pre_post = 0) const;
 
+  /**
+   * This method runs two cell operations after each other, where the second
+   * operation reads the result of the first one, i.e., it computes
+   * `intermediate = A src` followed by `dst = B intermediate` for two
+   * operators `A` and `B` that are both expressed by cell integrals. As
+   * opposed to two calls to cell_loop(), the ranges of cells of the second
+   * operation are run in the same sweep over the cells as soon as all cells
+   * of the first operation that write into the entries of `intermediate`
+   * needed by them have been processed, according to
+   * internal::MatrixFreeFunctions::DoFInfo::cell_loop_fused_stage. This
+   * way, most of the entries of `intermediate` are still in cache when read
+   * by the second operation. The ranges of cells that read entries of
+   * `intermediate` exchanged with other MPI processes, as well as all the
+   * ranges following them, are run after the data exchange of the first
+   * operation.
+   *
+   * The vector `intermediate` is zeroed by this function before the first
+   * operation writes into it, and `dst` is zeroed before the second
+   * operation if `zero_dst_vector` is set. The two functors
+   * `operation_before_loop` and `operation_after_loop` have the same meaning
+   * as for cell_loop(), with `operation_before_loop` scheduled before the
+   * first operation touches a range of unknowns and `operation_after_loop`
+   * scheduled after the second operation has touched a range of unknowns for
+   * the last time. Both work on the degrees of freedom of the DoFHandler with
+   * index `dof_handler_index`, which must also be the one `intermediate`
+   * refers to.
+   *
+   * @note The two operations are only interleaved in the MPI-only case. In
+   * case threading is enabled, the two operations are run one after the
+   * other, as in two calls to cell_loop().
+   */
+  template <typename CLASS1, typename CLASS2, typename VectorType>
+  void
+  cell_loop_fused(void (CLASS1::*first_cell_operation)(
+                    const MatrixFree &,
+                    VectorType &,
+                    const VectorType &,
+                    const std::pair<unsigned int, unsigned int> &) const,
+                  const CLASS1 *first_owning_class,
+                  void (CLASS2::*second_cell_operation)(
+                    const MatrixFree &,
+                    VectorType &,
+                    const VectorType &,
+                    const std::pair<unsigned int, unsigned int> &) const,
+                  const CLASS2     *second_owning_class,
+                  VectorType       &dst,
+                  VectorType       &intermediate,
+                  const VectorType &src,
+                  const bool        zero_dst_vector = false,
+                  const std::function<void(const unsigned int,
+                                           const unsigned int)>
+                    &operation_before_loop = {},
+                  const std::function<void(const unsigned int,
+                                           const unsigned int)>
+                                    &operation_after_loop = {},
+                  const unsigned int dof_handler_index    = 0) const;
+
+  /**
+   * Same as above, but taking two `std::function` objects as the cell
+   * operations rather than class member functions.
+   */
+  template <typename VectorType>
+  void
+  cell_loop_fused(
+    const std::function<void(
+      const MatrixFree<dim, Number, VectorizedArrayType> &,
+      VectorType &,
+      const VectorType &,
+      const std::pair<unsigned int, unsigned int> &)> &first_cell_operation,
+    const std::function<void(
+      const MatrixFree<dim, Number, VectorizedArrayType> &,
+      VectorType &,
+      const VectorType &,
+      const std::pair<unsigned int, unsigned int> &)> &second_cell_operation,
+    VectorType       &dst,
+    VectorType       &intermediate,
+    const VectorType &src,
+    const bool        zero_dst_vector = false,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_before_loop = {},
+    const std::function<void(const unsigned int, const unsigned int)>
+                      &operation_after_loop = {},
+    const unsigned int dof_handler_index    = 0) const;
+
   /**
    * This method runs a loop over all cells (in parallel) and performs the MPI
    * data exchange on the source vector and destination vector. As opposed to
@@ -1491,6 +1677,14 @@ public:
    * FEFaceEvaluation::reinit(cell, face_no) to access quantities on arbitrary
    * faces of a cell and the respective neighbors.
    *
+   * The loop can also be run with threads, using any of the threaded
+   * schemes of AdditionalData::tasks_parallel_scheme. Since the
+   * `cell_operation` only writes into the entries of the cells it works on,
+   * the cells of the partitions of the thread graph are scheduled without
+   * any face ranges. The cells with faces towards ghost cells on remote
+   * processes are placed into the first partition and only worked on once
+   * the ghost values of `src` are available.
+   *
    * @param cell_operation Pointer to member function of `CLASS` with the
    * signature <tt>cell_operation (const MatrixFree<dim,Number> &, OutVector &,
    * InVector &, std::pair<unsigned int,unsigned int> &)</tt> where the first
@@ -2081,6 +2275,130 @@ public:
   std::size_t
   memory_consumption() const;
 
+  /**
+   * Return statistics about how well the locally owned cell batches make use
+   * of the lanes of the vectorized data type. The returned map contains, for
+   * each cell category as returned by get_cell_category(), i.e., the active
+   * FE index in the hp-adaptive case, a pair of the number of cell batches
+   * of that category and the number of lanes within these batches that are
+   * filled with actual cells of the mesh. The lane utilization of category
+   * `c` is hence given by `result[c].second / (result[c].first *
+   * VectorizedArrayType::size())`, and the number of idle lanes by the
+   * difference of the denominator and the numerator.
+   *
+   * Since cells of different categories cannot be combined into the same
+   * batch in the hp case, every category typically contains one partially
+   * filled batch, as well as further ones if cells with a common parent are
+   * to be kept together or the cells are split by the partitions for
+   * overlapping communication and computation. For meshes with many
+   * categories and few cells per category, the idle lanes can thus make up
+   * a sizable fraction of the work. In the non-hp case, setting
+   * AdditionalData::cell_vectorization_categories_strict to false allows
+   * promoting cells to higher categories to fill up batches.
+   */
+  std::map<unsigned int, std::pair<unsigned int, unsigned int>>
+  get_cell_batch_statistics() const;
+
+  /**
+   * A collection of the estimated memory transfer and arithmetic work of one
+   * application of an operator evaluated by cell_loop(), as returned by
+   * estimate_cell_loop_cost(). All numbers refer to the part of the work done
+   * on the current MPI process.
+   */
+  struct CostEstimate
+  {
+    /**
+     * The number of bytes read from and written to the source and
+     * destination vectors, including the ghost entries of the source
+     * vectors.
+     */
+    double vector_bytes = 0.;
+
+    /**
+     * The number of bytes of index data loaded by the read and write
+     * operations of FEEvaluation, which depends on the
+     * DoFInfo::IndexStorageVariants selected for the cell batches.
+     */
+    double index_bytes = 0.;
+
+    /**
+     * The number of bytes of geometry data, i.e., the inverse Jacobians and
+     * the Jacobian determinants times quadrature weights, loaded from
+     * MappingInfo.
+     */
+    double geometry_bytes = 0.;
+
+    /**
+     * The number of floating point operations of the sum-factorization
+     * kernels and the operations at quadrature points, counting all lanes of
+     * the vectorized data type and a fused multiply-add as two operations.
+     */
+    double flops = 0.;
+
+    /**
+     * Return the sum of the vector, index, and geometry transfer in bytes.
+     */
+    double
+    total_bytes() const;
+
+    /**
+     * Return the arithmetic intensity, i.e., the ratio of flops() to
+     * total_bytes(), in flops per byte.
+     */
+    double
+    arithmetic_intensity() const;
+  };
+
+  /**
+   * Return an estimate of the data transfer from main memory and the
+   * arithmetic work of one application of a typical operator implemented
+   * with cell_loop() and FEEvaluation on all locally owned cell batches,
+   * based on the actual data structures stored in this class: The index
+   * compression found for each cell batch, the geometry type and thus the
+   * amount of stored Jacobian data, and the polynomial degree and number of
+   * quadrature points of the element.
+   *
+   * It is assumed that each of the @p n_src_vectors source vectors is read
+   * once including its ghost entries, that each of the @p n_dst_vectors
+   * destination vectors is read and written once, that FEEvaluation::evaluate()
+   * and FEEvaluation::integrate() are called with the same
+   * @p evaluation_flags (only EvaluationFlags::values and
+   * EvaluationFlags::gradients are considered), and that all data structures
+   * only traversed once per operator application need to come from main
+   * memory, i.e., caches are not able to hold the data between two
+   * applications. The estimate hence represents the minimal transfer of an
+   * ideal implementation, which is the relevant metric for a roofline
+   * analysis of the memory-bound operator evaluation. Time spent on
+   * constraints and hanging nodes is not included in the arithmetic work.
+   *
+   * Use print_cost_estimate() to combine the estimate with a measured run
+   * time and report the achieved memory throughput and arithmetic
+   * performance.
+   */
+  CostEstimate
+  estimate_cell_loop_cost(
+    const EvaluationFlags::EvaluationFlags evaluation_flags,
+    const unsigned int                     dof_handler_index = 0,
+    const unsigned int                     quad_index        = 0,
+    const unsigned int                     n_src_vectors     = 1,
+    const unsigned int                     n_dst_vectors     = 1) const;
+
+  /**
+   * Print the cost estimate of an operator as returned by
+   * estimate_cell_loop_cost(), accumulated over all MPI processes of the
+   * communicator of this class, to the given output stream. If the
+   * measured wall time in seconds of one operator application, @p
+   * time_per_application, is positive, the achieved memory throughput in
+   * GB/s and the arithmetic performance in GFlop/s are printed as well,
+   * based on the maximal time over all MPI processes. This function is
+   * collective and must be called on all processes.
+   */
+  template <typename StreamType>
+  void
+  print_cost_estimate(StreamType         &out,
+                      const CostEstimate &estimate,
+                      const double        time_per_application = 0.) const;
+
   /**
    * Prints a detailed summary of memory consumption in the different
    * structures of this class to the given output stream.
@@ -2119,6 +2437,17 @@ public:
 
   /**
    * Return information on indexation degrees of freedom.
+   *
+   * If several DoFHandler objects with the same finite element, numbering of
+   * unknowns, and constraints have been passed to reinit(), the index data
+   * is only stored once, and this function returns the same object for all
+   * of them. The vectors initialized by initialize_dof_vector() then also
+   * share the same partitioner. In that case, fields whose components are
+   * stored in separate vectors (e.g., several species in a
+   * reaction-diffusion system) can also be read and written in a single
+   * pass through the indices by an FEEvaluation object with several
+   * components acting on a scalar element, passing a BlockVector or a
+   * std::vector of vectors.
    */
   const internal::MatrixFreeFunctions::DoFInfo &
   get_dof_info(const unsigned int dof_handler_index_component = 0) const;
@@ -2269,6 +2598,15 @@ private:
    */
   std::vector<internal::MatrixFreeFunctions::DoFInfo> dof_info;
 
+  /**
+   * For each DoFHandler, the index of the entry in @p dof_info that holds
+   * its index data. This is the DoFHandler index itself, unless the indices
+   * are identical to those of a DoFHandler with a lower index, in which
+   * case the arrays of indices have been released from the entry of the
+   * current DoFHandler. See get_dof_info().
+   */
+  std::vector<unsigned int> dof_info_index;
+
   /**
    * Contains the weights for constraints stored in DoFInfo. Filled into a
    * separate field since several vector components might share similar
@@ -2295,6 +2633,14 @@ private:
    */
   Table<4, internal::MatrixFreeFunctions::ShapeInfo<Number>> shape_info;
 
+  /**
+   * For each entry of @p shape_info, a string identifying the finite
+   * element, base element, and quadrature formula the entry was computed
+   * from. Used to detect entries that can be copied rather than recomputed
+   * in reinit(), see AdditionalData::shape_info_source.
+   */
+  Table<4, std::string> shape_info_keys;
+
   /**
    * Describes how the cells are gone through. With the cell level (first
    * index in this field) and the index within the level, one can reconstruct
@@ -2602,7 +2948,8 @@ MatrixFree<dim, Number, VectorizedArrayType>::get_dof_info(
   const unsigned int dof_index) const
 {
   AssertIndexRange(dof_index, n_components());
-  return dof_info[dof_index];
+  return dof_info[dof_info_index.empty() ? dof_index :
+                                           dof_info_index[dof_index]];
 }
 
 
@@ -5092,6 +5439,126 @@ MatrixFree<dim, Number, VectorizedArrayType>::cell_loop(
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename CLASS1, typename CLASS2, typename VectorType>
+inline void
+MatrixFree<dim, Number, VectorizedArrayType>::cell_loop_fused(
+  void (CLASS1::*first_cell_operation)(
+    const MatrixFree &,
+    VectorType &,
+    const VectorType &,
+    const std::pair<unsigned int, unsigned int> &) const,
+  const CLASS1 *first_owning_class,
+  void (CLASS2::*second_cell_operation)(
+    const MatrixFree &,
+    VectorType &,
+    const VectorType &,
+    const std::pair<unsigned int, unsigned int> &) const,
+  const CLASS2     *second_owning_class,
+  VectorType       &dst,
+  VectorType       &intermediate,
+  const VectorType &src,
+  const bool        zero_dst_vector,
+  const std::function<void(const unsigned int, const unsigned int)>
+    &operation_before_loop,
+  const std::function<void(const unsigned int, const unsigned int)>
+                    &operation_after_loop,
+  const unsigned int dof_handler_index) const
+{
+  AssertIndexRange(dof_handler_index, dof_info.size());
+  Assert(&intermediate != &src && &intermediate != &dst,
+         ExcMessage("The intermediate vector of a fused cell loop must be "
+                    "different from the source and destination vectors."));
+
+  internal::MFWorker<MatrixFree<dim, Number, VectorizedArrayType>,
+                     VectorType,
+                     VectorType,
+                     CLASS1,
+                     true>
+    first_worker(*this,
+                 src,
+                 intermediate,
+                 true,
+                 *first_owning_class,
+                 first_cell_operation,
+                 nullptr,
+                 nullptr,
+                 DataAccessOnFaces::none,
+                 DataAccessOnFaces::none,
+                 operation_before_loop,
+                 {},
+                 dof_handler_index);
+  internal::MFWorker<MatrixFree<dim, Number, VectorizedArrayType>,
+                     VectorType,
+                     VectorType,
+                     CLASS2,
+                     true>
+    second_worker(*this,
+                  intermediate,
+                  dst,
+                  zero_dst_vector,
+                  *second_owning_class,
+                  second_cell_operation,
+                  nullptr,
+                  nullptr,
+                  DataAccessOnFaces::none,
+                  DataAccessOnFaces::none,
+                  {},
+                  operation_after_loop,
+                  dof_handler_index);
+
+  task_info.loop(first_worker,
+                 second_worker,
+                 dof_info[dof_handler_index].cell_loop_fused_stage);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename VectorType>
+inline void
+MatrixFree<dim, Number, VectorizedArrayType>::cell_loop_fused(
+  const std::function<void(const MatrixFree<dim, Number, VectorizedArrayType> &,
+                           VectorType &,
+                           const VectorType &,
+                           const std::pair<unsigned int, unsigned int> &)>
+    &first_cell_operation,
+  const std::function<void(const MatrixFree<dim, Number, VectorizedArrayType> &,
+                           VectorType &,
+                           const VectorType &,
+                           const std::pair<unsigned int, unsigned int> &)>
+                   &second_cell_operation,
+  VectorType       &dst,
+  VectorType       &intermediate,
+  const VectorType &src,
+  const bool        zero_dst_vector,
+  const std::function<void(const unsigned int, const unsigned int)>
+    &operation_before_loop,
+  const std::function<void(const unsigned int, const unsigned int)>
+                    &operation_after_loop,
+  const unsigned int dof_handler_index) const
+{
+  using Wrapper =
+    internal::MFClassWrapper<MatrixFree<dim, Number, VectorizedArrayType>,
+                             VectorType,
+                             VectorType>;
+  Wrapper first_wrap(first_cell_operation, nullptr, nullptr);
+  Wrapper second_wrap(second_cell_operation, nullptr, nullptr);
+  cell_loop_fused(&Wrapper::cell_integrator,
+                  &first_wrap,
+                  &Wrapper::cell_integrator,
+                  &second_wrap,
+                  dst,
+                  intermediate,
+                  src,
+                  zero_dst_vector,
+                  operation_before_loop,
+                  operation_after_loop,
+                  dof_handler_index);
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 template <typename OutVector, typename InVector>
 inline void
@@ -5580,7 +6047,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::loop_cell_centric(
            nullptr,
            src_vector_face_access_temp,
            DataAccessOnFaces::none);
-  task_info.loop(worker);
+  task_info.loop_cell_centric(worker);
 }
 
 
@@ -5621,7 +6088,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::loop_cell_centric(
            nullptr,
            src_vector_face_access_temp,
            DataAccessOnFaces::none);
-  task_info.loop(worker);
+  task_info.loop_cell_centric(worker);
 }
 
 
@@ -5667,7 +6134,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::loop_cell_centric(
            &Wrapper::boundary_integrator,
            src_vector_face_access_temp,
            DataAccessOnFaces::none);
-  task_info.loop(worker);
+  task_info.loop_cell_centric(worker);
 }
 
 
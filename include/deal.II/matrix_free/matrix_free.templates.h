@@ -19,12 +19,14 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/memory_registry.h>
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi_consensus_algorithms.h>
 #include <deal.II/base/multithread_info.h>
 #include <deal.II/base/polynomials_piecewise.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/tensor_product_polynomials.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/distributed/tria.h>
 
@@ -45,13 +47,14 @@
 #include <deal.II/matrix_free/hanging_nodes_internal.h>
 #include <deal.II/matrix_free/matrix_free.h>
 
-#ifdef DEAL_II_WITH_TBB
-#  include <deal.II/base/parallel.h>
+#include <deal.II/base/parallel.h>
 
+#ifdef DEAL_II_WITH_TBB
 #  include <tbb/concurrent_unordered_map.h>
 #endif
 
 #include <fstream>
+#include <unordered_map>
 
 //
 // TBB with oneAPI API has deprecated and removed the
@@ -63,8 +66,10 @@
 // free infrastructure has seen less attention than the rest over the last
 // years and is (presumably) not used that often.
 //
-// In case of detected oneAPI backend we simply disable threading in the
-// matrix free backend for now.
+// In case of detected oneAPI backend, and with taskflow, we instead run the
+// partitions of the thread graph in a sequence of fork-join steps via
+// parallel::apply_to_subranges(), which uses the persistent thread pool of
+// the respective library.
 //
 // Matthias Maier, Martin Kronbichler, 2021
 //
@@ -346,10 +351,12 @@ MatrixFree<dim, Number, VectorizedArrayType>::copy_from(
   clear();
   dof_handlers               = v.dof_handlers;
   dof_info                   = v.dof_info;
+  dof_info_index             = v.dof_info_index;
   constraint_pool_data       = v.constraint_pool_data;
   constraint_pool_row_index  = v.constraint_pool_row_index;
   mapping_info               = v.mapping_info;
   shape_info                 = v.shape_info;
+  shape_info_keys            = v.shape_info_keys;
   cell_level_index           = v.cell_level_index;
   cell_level_index_end_local = v.cell_level_index_end_local;
   task_info                  = v.task_info;
@@ -383,6 +390,30 @@ namespace internal
   {
     stored_constraints = affine_constraints;
   }
+
+
+
+  /**
+   * Return a string that identifies the ShapeInfo object computed for the
+   * base element @p base_element of @p fe and the quadrature formula
+   * @p quad. The string consists of the name of the element and the raw
+   * bytes of the quadrature points and weights.
+   */
+  template <int dim, int q_dim>
+  std::string
+  get_shape_info_key(const FiniteElement<dim> &fe,
+                     const unsigned int        base_element,
+                     const Quadrature<q_dim>  &quad)
+  {
+    std::string key = fe.get_name() + '#' + std::to_string(base_element) +
+                      '#' + std::to_string(q_dim) + '#' +
+                      (quad.is_tensor_product() ? 't' : 'n') + '#';
+    key.append(reinterpret_cast<const char *>(quad.get_points().data()),
+               quad.size() * sizeof(Point<q_dim>));
+    key.append(reinterpret_cast<const char *>(quad.get_weights().data()),
+               quad.size() * sizeof(double));
+    return key;
+  }
 } // namespace internal
 
 
@@ -399,6 +430,8 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
   const typename MatrixFree<dim, Number, VectorizedArrayType>::AdditionalData
     &additional_data)
 {
+  MemoryRegistry::Stage memory_stage("MatrixFree::reinit");
+
   // Store the level of the mesh to be worked on.
   this->mg_level = additional_data.mg_level;
 
@@ -417,8 +450,51 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
     unsigned int n_quad_in_collection = 0;
     for (unsigned int q = 0; q < n_quad; ++q)
       n_quad_in_collection = std::max(n_quad_in_collection, quad[q].size());
-    shape_info.reinit(TableIndices<4>(
-      n_components, n_quad, n_fe_in_collection, n_quad_in_collection));
+
+    // Computing the shape information is expensive for higher degrees, so
+    // we look for entries we already know, either from an earlier call to
+    // this function or from the object given in the additional data (e.g.
+    // the same element on another multigrid level), before computing the
+    // remaining ones in parallel.
+    std::map<std::string,
+             const internal::MatrixFreeFunctions::ShapeInfo<Number> *>
+      known_shape_infos;
+    const auto add_known_shape_infos =
+      [&known_shape_infos](
+        const Table<4, internal::MatrixFreeFunctions::ShapeInfo<Number>>
+                                    &infos,
+        const Table<4, std::string> &keys) {
+        if (infos.size() != keys.size())
+          return;
+        for (unsigned int i0 = 0; i0 < keys.size(0); ++i0)
+          for (unsigned int i1 = 0; i1 < keys.size(1); ++i1)
+            for (unsigned int i2 = 0; i2 < keys.size(2); ++i2)
+              for (unsigned int i3 = 0; i3 < keys.size(3); ++i3)
+                if (!keys(i0, i1, i2, i3).empty())
+                  known_shape_infos.emplace(keys(i0, i1, i2, i3),
+                                            &infos(i0, i1, i2, i3));
+      };
+
+    Table<4, internal::MatrixFreeFunctions::ShapeInfo<Number>> old_shape_info;
+    Table<4, std::string>                                      old_keys;
+    old_shape_info.swap(shape_info);
+    old_keys.swap(shape_info_keys);
+    add_known_shape_infos(old_shape_info, old_keys);
+    if (additional_data.shape_info_source != nullptr &&
+        additional_data.shape_info_source != this)
+      add_known_shape_infos(additional_data.shape_info_source->shape_info,
+                            additional_data.shape_info_source->shape_info_keys);
+
+    const TableIndices<4> sizes(n_components,
+                                n_quad,
+                                n_fe_in_collection,
+                                n_quad_in_collection);
+    shape_info.reinit(sizes);
+    shape_info_keys.reinit(sizes);
+
+    std::map<std::string, TableIndices<4>>                   first_occurrence;
+    std::vector<std::pair<TableIndices<4>, TableIndices<4>>> duplicates;
+    Threads::TaskGroup<>                                     tasks;
     for (unsigned int no = 0, c = 0; no < dof_handler.size(); ++no)
       for (unsigned int b = 0; b < dof_handler[no]->get_fe(0).n_base_elements();
            ++b, ++c)
@@ -427,8 +503,31 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
              ++fe_no)
           for (unsigned int nq = 0; nq < n_quad; ++nq)
             for (unsigned int q_no = 0; q_no < quad[nq].size(); ++q_no)
-              shape_info(c, nq, fe_no, q_no)
-                .reinit(quad[nq][q_no], dof_handler[no]->get_fe(fe_no), b);
+              {
+                const TableIndices<4>     index(c, nq, fe_no, q_no);
+                const Quadrature<q_dim>  &quadrature = quad[nq][q_no];
+                const FiniteElement<dim> &fe = dof_handler[no]->get_fe(fe_no);
+
+                shape_info_keys(index) =
+                  internal::get_shape_info_key(fe, b, quadrature);
+                const auto [entry, inserted] =
+                  first_occurrence.emplace(shape_info_keys(index), index);
+                if (inserted == false)
+                  duplicates.emplace_back(index, entry->second);
+                else if (const auto known =
+                           known_shape_infos.find(shape_info_keys(index));
+                         known != known_shape_infos.end())
+                  shape_info(index) = *known->second;
+                else
+                  tasks += Threads::new_task(
+                    [this, index, &quadrature, &fe, b]() {
+                      shape_info(index).reinit(quadrature, fe, b);
+                    });
+              }
+    tasks.join_all();
+
+    for (const auto &[index, source] : duplicates)
+      shape_info(index) = shape_info(source);
   }
 
   // Vector of DoFHandler indices of those that are in hp-mode
@@ -453,13 +552,19 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
 
   if (additional_data.initialize_indices == true)
     {
+      // keep the geometry of the cells from the previous call, which is
+      // either used or discarded in MappingInfo::initialize()
+      auto geometry_cache = std::move(mapping_info.geometry_cache);
       clear();
+      mapping_info.geometry_cache = std::move(geometry_cache);
       Assert(dof_handler.size() > 0, ExcMessage("No DoFHandler is given."));
       AssertDimension(dof_handler.size(), constraints.size());
       AssertDimension(dof_handler.size(), locally_owned_dofs.size());
 
       task_info.allow_ghosted_vectors_in_loops =
         additional_data.allow_ghosted_vectors_in_loops;
+      task_info.communication_progress_interval =
+        additional_data.communication_progress_interval;
 
       task_info.communicator    = dof_handler[0]->get_mpi_communicator();
       task_info.communicator_sm = additional_data.communicator_sm;
@@ -491,7 +596,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
 
         // initialize the basic multithreading information that needs to be
         // passed to the DoFInfo structure
-#if defined(DEAL_II_WITH_TBB) && !defined(DEAL_II_TBB_WITH_ONEAPI)
+#if defined(DEAL_II_WITH_TBB) || defined(DEAL_II_WITH_TASKFLOW)
       if (additional_data.tasks_parallel_scheme != AdditionalData::none &&
           MultithreadInfo::n_threads() > 1)
         {
@@ -515,6 +620,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
   else if (dof_info.size() != dof_handler.size())
     {
       initialize_dof_handlers(dof_handler, additional_data);
+      dof_info_index.clear();
       std::vector<unsigned int>  dummy;
       std::vector<unsigned char> dummy2;
       task_info.vectorization_length = VectorizedArrayType::size();
@@ -848,7 +954,9 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
         additional_data.mapping_update_flags_boundary_faces,
         additional_data.mapping_update_flags_inner_faces,
         additional_data.mapping_update_flags_faces_by_cells,
-        piola_transform);
+        piola_transform,
+        additional_data.reuse_geometry_of_unchanged_cells,
+        additional_data.compute_cell_geometry_on_the_fly);
 
       mapping_is_initialized = true;
     }
@@ -995,9 +1103,8 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_dof_handlers(
 
 namespace internal
 {
-#if defined(DEAL_II_WITH_TBB) && !defined(DEAL_II_TBB_WITH_ONEAPI)
+#if defined(DEAL_II_WITH_TBB) || defined(DEAL_II_WITH_TASKFLOW)
 
-#  ifdef DEAL_II_TBB_WITH_ONEAPI
   struct unsigned_int_pair_hash
   {
     std::size_t
@@ -1007,6 +1114,22 @@ namespace internal
              std::hash<unsigned int>()(pair.second);
     }
   };
+
+  /**
+   * The map between the level and index of a cell in the triangulation and
+   * its index in the matrix-free context. With TBB, the map is filled
+   * in parallel. Otherwise, it is filled serially and only read from
+   * several threads.
+   */
+  using CellLevelIndexMap =
+#  ifdef DEAL_II_WITH_TBB
+    tbb::concurrent_unordered_map<std::pair<unsigned int, unsigned int>,
+                                  unsigned int,
+                                  unsigned_int_pair_hash>;
+#  else
+    std::unordered_map<std::pair<unsigned int, unsigned int>,
+                       unsigned int,
+                       unsigned_int_pair_hash>;
 #  endif
 
   inline void
@@ -1014,13 +1137,7 @@ namespace internal
     const unsigned int                                        begin,
     const unsigned int                                        end,
     const std::vector<std::pair<unsigned int, unsigned int>> &cell_level_index,
-    tbb::concurrent_unordered_map<std::pair<unsigned int, unsigned int>,
-                                  unsigned int
-#  ifdef DEAL_II_TBB_WITH_ONEAPI
-                                  ,
-                                  unsigned_int_pair_hash
-#  endif
-                                  > &map)
+    CellLevelIndexMap                                        &map)
   {
     if (cell_level_index.empty())
       return;
@@ -1039,14 +1156,8 @@ namespace internal
     const unsigned int                                        end,
     const dealii::Triangulation<dim>                         &tria,
     const std::vector<std::pair<unsigned int, unsigned int>> &cell_level_index,
-    const tbb::concurrent_unordered_map<std::pair<unsigned int, unsigned int>,
-                                        unsigned int
-#  ifdef DEAL_II_TBB_WITH_ONEAPI
-                                        ,
-                                        unsigned_int_pair_hash
-#  endif
-                                        > &map,
-    DynamicSparsityPattern                &connectivity_direct)
+    const CellLevelIndexMap                                  &map,
+    DynamicSparsityPattern &connectivity_direct)
   {
     const unsigned int locally_owned_size = connectivity_direct.n_rows();
     std::vector<types::global_dof_index> new_indices;
@@ -1709,17 +1820,11 @@ namespace internal
         connectivity.reinit(task_info.n_active_cells, task_info.n_active_cells);
         if (do_face_integrals)
           {
-#if defined(DEAL_II_WITH_TBB) && !defined(DEAL_II_TBB_WITH_ONEAPI)
+#if defined(DEAL_II_WITH_TBB) || defined(DEAL_II_WITH_TASKFLOW)
             // step 1: build map between the index in the matrix-free context
             // and the one in the triangulation
-            tbb::concurrent_unordered_map<std::pair<unsigned int, unsigned int>,
-                                          unsigned int
-#  ifdef DEAL_II_TBB_WITH_ONEAPI
-                                          ,
-                                          unsigned_int_pair_hash
-#  endif
-                                          >
-              map;
+            CellLevelIndexMap map;
+#  ifdef DEAL_II_WITH_TBB
             dealii::parallel::apply_to_subranges(
               0,
               cell_level_index.size(),
@@ -1728,6 +1833,10 @@ namespace internal
                 fill_index_subrange(begin, end, cell_level_index, map);
               },
               50);
+#  else
+            fill_index_subrange(0, cell_level_index.size(), cell_level_index,
+                                map);
+#  endif
 
             // step 2: Make a list for all blocks with other blocks that write
             // to the cell (due to the faces that are associated to it)
@@ -1852,11 +1961,17 @@ namespace internal
       constraint_pool_row_index.push_back(constraint_pool_row_index.back() +
                                           it.first.size());
 
+    // the DoFInfo objects of the different DoFHandlers are independent of
+    // each other, so reorder them in parallel
+    Threads::TaskGroup<> tasks;
     for (unsigned int no = 0; no < n_dof_handlers; ++no)
-      dof_info[no].reorder_cells(task_info,
-                                 renumbering,
-                                 constraint_pool_row_index,
-                                 irregular_cells);
+      tasks += Threads::new_task([&, no]() {
+        dof_info[no].reorder_cells(task_info,
+                                   renumbering,
+                                   constraint_pool_row_index,
+                                   irregular_cells);
+      });
+    tasks.join_all();
 
     return is_fe_dg;
   }
@@ -1883,8 +1998,9 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
   Table<2, internal::MatrixFreeFunctions::ShapeInfo<double>> shape_info_dummy(
     shape_info.size(0), shape_info.size(2));
   {
-    Quadrature<dim> quad(QGauss<dim>(1));
-    Quadrature<dim> quad_simplex(QGaussSimplex<dim>(1));
+    Quadrature<dim>      quad(QGauss<dim>(1));
+    Quadrature<dim>      quad_simplex(QGaussSimplex<dim>(1));
+    Threads::TaskGroup<> tasks;
     for (unsigned int no = 0, c = 0; no < dof_handlers.size(); ++no)
       for (unsigned int b = 0;
            b < dof_handlers[no]->get_fe(0).n_base_elements();
@@ -1892,13 +2008,16 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
         for (unsigned int fe_no = 0;
              fe_no < dof_handlers[no]->get_fe_collection().size();
              ++fe_no)
-          shape_info_dummy(c, fe_no).reinit(
-            dof_handlers[no]->get_fe(fe_no).reference_cell() ==
-                ReferenceCells::get_hypercube<dim>() ?
-              quad :
-              quad_simplex,
-            dof_handlers[no]->get_fe(fe_no),
-            b);
+          tasks += Threads::new_task([&, no, b, c, fe_no]() {
+            shape_info_dummy(c, fe_no).reinit(
+              dof_handlers[no]->get_fe(fe_no).reference_cell() ==
+                  ReferenceCells::get_hypercube<dim>() ?
+                quad :
+                quad_simplex,
+              dof_handlers[no]->get_fe(fe_no),
+              b);
+          });
+    tasks.join_all();
   }
 
   bool overlap_communication_computation =
@@ -2047,9 +2166,13 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
           (task_info.refinement_edge_face_partition_data[1] -
            task_info.refinement_edge_face_partition_data[0]));
 
-      for (auto &di : dof_info)
-        di.compute_face_index_compression(
-          face_info.faces, additional_data.hold_all_faces_to_owned_cells);
+      Threads::TaskGroup<> tasks;
+      for (unsigned int no = 0; no < dof_info.size(); ++no)
+        tasks += Threads::new_task([&, no]() {
+          dof_info[no].compute_face_index_compression(
+            face_info.faces, additional_data.hold_all_faces_to_owned_cells);
+        });
+      tasks.join_all();
 
       // build the inverse map back from the faces array to
       // cell_and_face_to_plain_faces
@@ -2119,8 +2242,15 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
           task_info.communicator_sm != MPI_COMM_SELF);
     }
 
-  for (auto &di : dof_info)
-    di.compute_vector_zero_access_pattern(task_info, face_info.faces);
+  {
+    Threads::TaskGroup<> tasks;
+    for (unsigned int no = 0; no < dof_info.size(); ++no)
+      tasks += Threads::new_task([&, no]() {
+        dof_info[no].compute_vector_zero_access_pattern(task_info,
+                                                        face_info.faces);
+      });
+    tasks.join_all();
+  }
 
 #ifdef DEAL_II_WITH_MPI
   {
@@ -2341,6 +2471,42 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
   }
 #endif
 
+  // DoFHandler objects with the same element, numbering, and constraints,
+  // e.g. for the different species of a reaction-diffusion system, result
+  // in identical DoFInfo objects. Keep the indices only once and let
+  // get_dof_info() return the first of the identical objects, such that all
+  // FEEvaluation objects read the same index data. Since the objects then
+  // also share the vector partitioner, the decision must be the same on all
+  // processes.
+  dof_info_index.resize(dof_info.size());
+  for (unsigned int no = 0; no < dof_info.size(); ++no)
+    {
+      dof_info_index[no] = no;
+      for (unsigned int j = 0; j < no; ++j)
+        if (dof_info_index[j] == j &&
+            dof_handlers[no]->get_fe_collection() ==
+              dof_handlers[j]->get_fe_collection() &&
+            dof_info[no].has_identical_indices(dof_info[j]))
+          {
+            dof_info_index[no] = j;
+            break;
+          }
+    }
+  if (dof_info.size() > 1)
+    {
+      std::vector<unsigned int> min_index(dof_info.size());
+      std::vector<unsigned int> max_index(dof_info.size());
+      Utilities::MPI::min(dof_info_index, task_info.communicator, min_index);
+      Utilities::MPI::max(dof_info_index, task_info.communicator, max_index);
+      for (unsigned int no = 0; no < dof_info.size(); ++no)
+        if (min_index[no] != max_index[no])
+          dof_info_index[no] = no;
+      for (unsigned int no = 0; no < dof_info.size(); ++no)
+        if (dof_info_index[no] != no)
+          dof_info[no].release_indices_identical_to(
+            dof_info[dof_info_index[no]]);
+    }
+
   indices_are_initialized = true;
 }
 
@@ -2351,6 +2517,7 @@ void
 MatrixFree<dim, Number, VectorizedArrayType>::clear()
 {
   dof_info.clear();
+  dof_info_index.clear();
   mapping_info.clear();
   cell_level_index.clear();
   task_info.clear();
@@ -2380,6 +2547,251 @@ MatrixFree<dim, Number, VectorizedArrayType>::memory_consumption() const
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+std::map<unsigned int, std::pair<unsigned int, unsigned int>>
+MatrixFree<dim, Number, VectorizedArrayType>::get_cell_batch_statistics() const
+{
+  std::map<unsigned int, std::pair<unsigned int, unsigned int>> statistics;
+  for (unsigned int cell = 0; cell < n_cell_batches(); ++cell)
+    {
+      auto &entry = statistics[get_cell_category(cell)];
+      ++entry.first;
+      entry.second += n_active_entries_per_cell_batch(cell);
+    }
+  return statistics;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+double
+MatrixFree<dim, Number, VectorizedArrayType>::CostEstimate::total_bytes() const
+{
+  return vector_bytes + index_bytes + geometry_bytes;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+double
+MatrixFree<dim, Number, VectorizedArrayType>::CostEstimate::
+  arithmetic_intensity() const
+{
+  const double bytes = total_bytes();
+  return bytes > 0. ? flops / bytes : 0.;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+typename MatrixFree<dim, Number, VectorizedArrayType>::CostEstimate
+MatrixFree<dim, Number, VectorizedArrayType>::estimate_cell_loop_cost(
+  const EvaluationFlags::EvaluationFlags evaluation_flags,
+  const unsigned int                     dof_handler_index,
+  const unsigned int                     quad_index,
+  const unsigned int                     n_src_vectors,
+  const unsigned int                     n_dst_vectors) const
+{
+  AssertIndexRange(dof_handler_index, dof_info.size());
+  AssertIndexRange(quad_index, mapping_info.cell_data.size());
+  Assert(indices_are_initialized && mapping_is_initialized,
+         ExcNotInitialized());
+
+  using IndexStorageVariants =
+    internal::MatrixFreeFunctions::DoFInfo::IndexStorageVariants;
+
+  const internal::MatrixFreeFunctions::DoFInfo &dof_info_used =
+    get_dof_info(dof_handler_index);
+  const auto &mapping_data = mapping_info.cell_data[quad_index];
+
+  const bool need_values = (evaluation_flags & EvaluationFlags::values) != 0u;
+  const bool need_gradients =
+    (evaluation_flags & EvaluationFlags::gradients) != 0u;
+
+  const unsigned int n_lanes          = VectorizedArrayType::size();
+  const unsigned int n_components_all = dof_info_used.start_components.back();
+
+  CostEstimate estimate;
+
+  // vector access: the source vectors are read including their ghost
+  // entries, the destination vectors are read and written
+  const Utilities::MPI::Partitioner &partitioner =
+    *dof_info_used.vector_partitioner;
+  estimate.vector_bytes =
+    sizeof(Number) *
+    (static_cast<double>(n_src_vectors) *
+       (partitioner.locally_owned_size() + partitioner.n_ghost_indices()) +
+     2. * n_dst_vectors * partitioner.locally_owned_size());
+
+  const auto &storage_variants =
+    dof_info_used
+      .index_storage_variants[internal::MatrixFreeFunctions::DoFInfo::
+                                dof_access_cell];
+
+  for (unsigned int cell = 0; cell < n_cell_batches(); ++cell)
+    {
+      const unsigned int active_fe_index =
+        dof_info_used.cell_active_fe_index.empty() ?
+          0 :
+          dof_info_used.cell_active_fe_index[cell];
+      const unsigned int active_quad_index =
+        std::min<unsigned int>(active_fe_index,
+                               mapping_data.descriptor.size() - 1);
+      const unsigned int n_q_points =
+        mapping_data.descriptor[active_quad_index].n_q_points;
+
+      // index access, depending on the compression of the indices
+      const unsigned int dofs_per_cell =
+        dof_info_used.dofs_per_cell[active_fe_index];
+      switch (storage_variants[cell])
+        {
+          case IndexStorageVariants::full:
+            {
+              const std::pair<unsigned int, unsigned int> *row_starts =
+                dof_info_used.row_starts.data() +
+                cell * n_lanes * n_components_all;
+              const std::pair<unsigned int, unsigned int> *row_ends =
+                row_starts + n_lanes * n_components_all;
+              estimate.index_bytes +=
+                sizeof(unsigned int) * (row_ends->first - row_starts->first) +
+                sizeof(std::pair<unsigned short, unsigned short>) *
+                  (row_ends->second - row_starts->second);
+              break;
+            }
+          case IndexStorageVariants::interleaved:
+            estimate.index_bytes +=
+              static_cast<double>(sizeof(unsigned int)) * dofs_per_cell *
+              n_lanes;
+            break;
+          default:
+            // contiguous variants only load the first index of each cell
+            estimate.index_bytes += sizeof(unsigned int) * n_lanes;
+            break;
+        }
+
+      // geometry access: affine and Cartesian cells only store a single
+      // entry for the whole cell batch
+      const unsigned int n_geometry_entries =
+        mapping_info.get_cell_type(cell) <=
+            internal::MatrixFreeFunctions::affine ?
+          1 :
+          n_q_points;
+      if (need_values || need_gradients)
+        estimate.geometry_bytes +=
+          static_cast<double>(n_geometry_entries) *
+          (sizeof(VectorizedArrayType) +
+           (need_gradients ? sizeof(Tensor<2, dim, VectorizedArrayType>) : 0));
+
+      // arithmetic work: sum factorization in evaluate() and integrate()
+      // for each base element and component, followed by the operations at
+      // quadrature points
+      for (unsigned int base = 0; base < dof_info_used.n_base_elements; ++base)
+        {
+          const auto &shape = get_shape_info(dof_handler_index,
+                                             quad_index,
+                                             base,
+                                             active_fe_index,
+                                             active_quad_index);
+          const unsigned int n_components = dof_info_used.n_components[base];
+
+          double flops_per_component = 0.;
+          if (shape.element_type == internal::MatrixFreeFunctions::tensor_none)
+            {
+              // dense evaluation with the full shape matrices of size
+              // dofs_per_cell x n_q_points, for the values and each
+              // component of the gradients
+              const double n_matrices =
+                (need_values ? 1. : 0.) + (need_gradients ? dim : 0.);
+              flops_per_component = 2. * 2. * n_matrices *
+                                    shape.dofs_per_component_on_cell *
+                                    n_q_points;
+            }
+          else
+            {
+              const double n_dofs_1d = shape.data.front().fe_degree + 1;
+              const double n_q_1d    = shape.data.front().n_q_points_1d;
+
+              // interpolation between the polynomial basis and the
+              // quadrature points in all directions, unless the basis is
+              // collocated with the quadrature points
+              double interpolation_flops = 0.;
+              if ((need_values || need_gradients) &&
+                  shape.element_type !=
+                    internal::MatrixFreeFunctions::tensor_symmetric_collocation)
+                for (int d = 1; d <= dim; ++d)
+                  interpolation_flops += 2. * std::pow(n_q_1d, d) *
+                                         std::pow(n_dofs_1d, dim - d + 1);
+
+              // collocation derivative in each direction at the quadrature
+              // points
+              const double gradient_flops =
+                need_gradients ? 2. * dim * std::pow(n_q_1d, dim + 1) : 0.;
+
+              // the same work is done in evaluate() and integrate()
+              flops_per_component = 2. * (interpolation_flops + gradient_flops);
+            }
+
+          // operations at quadrature points: multiplication by JxW for the
+          // values, transformation with the inverse Jacobian and its
+          // transpose as well as the multiplication by JxW for the gradients
+          const double quadrature_flops =
+            n_q_points * ((need_values ? 1. : 0.) +
+                          (need_gradients ? 4. * dim * dim + dim : 0.));
+
+          estimate.flops += static_cast<double>(n_lanes) * n_components *
+                            (flops_per_component + quadrature_flops);
+        }
+    }
+
+  return estimate;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename StreamType>
+void
+MatrixFree<dim, Number, VectorizedArrayType>::print_cost_estimate(
+  StreamType         &out,
+  const CostEstimate &estimate,
+  const double        time_per_application) const
+{
+  const MPI_Comm comm = task_info.communicator;
+
+  const double vector_bytes = Utilities::MPI::sum(estimate.vector_bytes, comm);
+  const double index_bytes  = Utilities::MPI::sum(estimate.index_bytes, comm);
+  const double geometry_bytes =
+    Utilities::MPI::sum(estimate.geometry_bytes, comm);
+  const double flops       = Utilities::MPI::sum(estimate.flops, comm);
+  const double total_bytes = vector_bytes + index_bytes + geometry_bytes;
+
+  out << "  Estimated cost of one operator application:" << std::endl;
+  out << "   Vector access:         " << 1e-6 * vector_bytes << " MB"
+      << std::endl;
+  out << "   Index access:          " << 1e-6 * index_bytes << " MB"
+      << std::endl;
+  out << "   Geometry access:       " << 1e-6 * geometry_bytes << " MB"
+      << std::endl;
+  out << "   Total memory transfer: " << 1e-6 * total_bytes << " MB"
+      << std::endl;
+  out << "   Arithmetic work:       " << 1e-6 * flops << " MFlop" << std::endl;
+  out << "   Arithmetic intensity:  "
+      << (total_bytes > 0. ? flops / total_bytes : 0.) << " Flop/byte"
+      << std::endl;
+
+  if (time_per_application > 0.)
+    {
+      const double time = Utilities::MPI::max(time_per_application, comm);
+      out << "   Measured time:         " << time << " s" << std::endl;
+      out << "   Achieved bandwidth:    " << 1e-9 * total_bytes / time
+          << " GB/s" << std::endl;
+      out << "   Achieved performance:  " << 1e-9 * flops / time << " GFlop/s"
+          << std::endl;
+    }
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 template <typename StreamType>
 void
@@ -0,0 +1,865 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_matrix_free_mesh_motion_solver_h
+#define dealii_matrix_free_mesh_motion_solver_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/symmetric_tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/mapping.h>
+
+#include <deal.II/grid/grid_tools_geometry.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include <deal.II/multigrid/mg_coarse.h>
+#include <deal.II/multigrid/mg_constrained_dofs.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/mg_smoother.h>
+#include <deal.II/multigrid/mg_transfer_matrix_free.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include <deal.II/numerics/vector_tools_boundary.h>
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <set>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace internal
+{
+  namespace MeshMotionSolverImplementation
+  {
+    /**
+     * The matrix-free operator of the mesh motion problem, i.e., the vector
+     * Laplacian or the operator of linear elasticity, scaled by a constant
+     * coefficient per cell.
+     */
+    template <int dim, typename Number>
+    class Operator
+      : public MatrixFreeOperators::Base<
+          dim,
+          LinearAlgebra::distributed::Vector<Number>>
+    {
+    public:
+      using VectorType       = LinearAlgebra::distributed::Vector<Number>;
+      using FECellIntegrator = FEEvaluation<dim, -1, 0, dim, Number>;
+
+      /**
+       * Set the parameters of the operator and compute the coefficient on
+       * all cells of the underlying MatrixFree object, which needs to be set
+       * by one of the initialize() functions before.
+       */
+      void
+      set_parameters(const bool   pseudo_elasticity,
+                     const double poisson_ratio,
+                     const double stiffening_exponent,
+                     const double reference_measure);
+
+      /**
+       * Compute the right hand side of the problem for the homogeneous
+       * constraints, i.e., the negative action of the operator on the
+       * vector @p boundary_values that contains the prescribed values on the
+       * constrained degrees of freedom and zero otherwise.
+       */
+      void
+      compute_rhs(VectorType &rhs, const VectorType &boundary_values) const;
+
+      virtual void
+      compute_diagonal() override;
+
+    private:
+      virtual void
+      apply_add(VectorType &dst, const VectorType &src) const override;
+
+      void
+      local_apply(
+        const MatrixFree<dim, Number>               &data,
+        VectorType                                  &dst,
+        const VectorType                            &src,
+        const std::pair<unsigned int, unsigned int> &cell_range) const;
+
+      void
+      local_apply_plain(
+        const MatrixFree<dim, Number>               &data,
+        VectorType                                  &dst,
+        const VectorType                            &src,
+        const std::pair<unsigned int, unsigned int> &cell_range) const;
+
+      void
+      do_cell_integral(FECellIntegrator &phi) const;
+
+      bool pseudo_elasticity = false;
+
+      Number lambda = 0.;
+
+      Number mu = 0.;
+
+      AlignedVector<VectorizedArray<Number>> cell_coefficients;
+    };
+  } // namespace MeshMotionSolverImplementation
+} // namespace internal
+
+
+
+/**
+ * A solver for the motion of the interior of a mesh given the displacement
+ * of (a part of) its boundary, as needed for arbitrary Lagrangian-Eulerian
+ * (ALE) methods or moving-boundary problems where the mesh follows a moving
+ * interface in every time step.
+ *
+ * In contrast to GridTools::laplace_transform(), which assembles a sparse
+ * matrix on a serial triangulation and moves the vertices of the
+ * triangulation, this class computes a continuous displacement field
+ * $\mathbf d$ in the space of a DoFHandler with an FESystem of dim FE_Q
+ * elements by solving either the vector Laplace problem
+ * @f[
+ *   -\nabla \cdot (c \nabla \mathbf d) = 0
+ * @f]
+ * or the pseudo-elasticity problem
+ * @f[
+ *   -\nabla \cdot \left(c \left(2\mu \varepsilon(\mathbf d) + \lambda
+ *   (\nabla \cdot \mathbf d) \mathbf I\right)\right) = 0
+ * @f]
+ * with the prescribed displacement on the boundary parts given to reinit(),
+ * and homogeneous Neumann conditions, i.e., sliding with a free tangential
+ * displacement for the Laplace problem, on the remaining boundary. The Lamé
+ * parameters are computed from a unit Young's modulus and the Poisson ratio
+ * given in AdditionalData. The coefficient $c$ is constant on each cell and
+ * equals $(\bar{|K|}/|K|)^\chi$ with $|K|$ the measure of cell $K$ in the
+ * reference configuration, $\bar{|K|}$ the average cell measure, and
+ * $\chi$ the stiffening exponent in AdditionalData. A positive
+ * exponent makes small cells stiffer, such that the deformation is absorbed
+ * by the larger cells away from a moving boundary.
+ *
+ * The operators are evaluated with MatrixFree for the reference
+ * configuration described by the mapping given to reinit(), and the linear
+ * system is solved by a conjugate gradient method with a geometric
+ * multigrid preconditioner using Chebyshev smoothing, which works on
+ * distributed triangulations and adaptively refined meshes in the same way
+ * as in step-37. The level operators are evaluated in single precision.
+ * All of these data structures are built once in reinit() and reused by
+ * every call to solve() as long as the mesh and the reference configuration
+ * do not change, such that a time step only consists of the computation of
+ * the right hand side from the new boundary displacement and the solution
+ * of the linear system, starting from the displacement of the previous time
+ * step as initial guess.
+ *
+ * The computed displacement describes the deformed mesh relative to the
+ * reference configuration and can be used with MappingQCache or
+ * MappingFEField:
+ * @code
+ * MeshMotionSolver<dim> mesh_motion;
+ * mesh_motion.reinit(mapping, dof_handler, {moving_boundary_id});
+ *
+ * LinearAlgebra::distributed::Vector<double> displacement;
+ * mesh_motion.initialize_dof_vector(displacement);
+ *
+ * MappingQCache<dim> deformed_mapping(mapping_degree);
+ * for (...)
+ *   {
+ *     boundary_displacement.set_time(time);
+ *     mesh_motion.solve(boundary_displacement, displacement);
+ *
+ *     displacement.update_ghost_values();
+ *     deformed_mapping.initialize(mapping, dof_handler, displacement, true);
+ *     ...
+ *   }
+ * @endcode
+ *
+ * Since the multigrid preconditioner works on the levels of the mesh, the
+ * DoFHandler must have distributed the level degrees of freedom with
+ * DoFHandler::distribute_mg_dofs(), which requires the triangulation to be
+ * created with the flag Triangulation::limit_level_difference_at_vertices
+ * and, for parallel::distributed::Triangulation, with the flag
+ * parallel::distributed::Triangulation::construct_multigrid_hierarchy.
+ *
+ * @ingroup matrixfree
+ */
+template <int dim, typename Number = double>
+class MeshMotionSolver : public EnableObserverPointer
+{
+public:
+  /**
+   * The type of the displacement vectors.
+   */
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  /**
+   * The model that determines the motion of the interior of the mesh.
+   */
+  enum class Model
+  {
+    /**
+     * Solve a Laplace problem for each component of the displacement.
+     */
+    laplace,
+
+    /**
+     * Solve the equations of linear elasticity for the displacement, which
+     * couples the components and better preserves the shape of the cells
+     * for rotations and shear deformations of the boundary.
+     */
+    pseudo_elasticity
+  };
+
+  /**
+   * Collects the options of this class.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor which sets the default arguments.
+     */
+    AdditionalData(const Model        model               = Model::laplace,
+                   const double       poisson_ratio       = 0.3,
+                   const double       stiffening_exponent = 0.,
+                   const double       relative_tolerance  = 1e-8,
+                   const unsigned int max_iterations      = 1000,
+                   const unsigned int smoothing_degree    = 5)
+      : model(model)
+      , poisson_ratio(poisson_ratio)
+      , stiffening_exponent(stiffening_exponent)
+      , relative_tolerance(relative_tolerance)
+      , max_iterations(max_iterations)
+      , smoothing_degree(smoothing_degree)
+    {}
+
+    /**
+     * The model of the mesh motion.
+     */
+    Model model;
+
+    /**
+     * The Poisson ratio of the pseudo-elastic material, which needs to be
+     * less than 1/2. Larger values make the mesh motion closer to
+     * volume-preserving. Only used for Model::pseudo_elasticity.
+     */
+    double poisson_ratio;
+
+    /**
+     * The exponent $\chi$ of the stiffening coefficient, see the general
+     * documentation of this class. The default of zero gives a constant
+     * coefficient.
+     */
+    double stiffening_exponent;
+
+    /**
+     * The tolerance of the conjugate gradient method relative to the norm
+     * of the right hand side.
+     */
+    double relative_tolerance;
+
+    /**
+     * The maximal number of iterations of the conjugate gradient method.
+     */
+    unsigned int max_iterations;
+
+    /**
+     * The degree of the Chebyshev smoother on the multigrid levels.
+     */
+    unsigned int smoothing_degree;
+  };
+
+  /**
+   * Set up the operators and the multigrid preconditioner for the reference
+   * configuration described by @p mapping and the degrees of freedom of
+   * @p dof_handler, whose finite element must consist of dim components of
+   * FE_Q type. The displacement is prescribed on the parts of the boundary
+   * with the indicators in @p dirichlet_boundary_ids. The mapping and the
+   * DoFHandler need to live at least as long as this object.
+   */
+  void
+  reinit(const Mapping<dim>                 &mapping,
+         const DoFHandler<dim>              &dof_handler,
+         const std::set<types::boundary_id> &dirichlet_boundary_ids,
+         const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Initialize a vector with the parallel layout of the displacement.
+   */
+  void
+  initialize_dof_vector(VectorType &vector) const;
+
+  /**
+   * Compute the displacement of the mesh. On input, the locally owned
+   * entries of @p displacement at the degrees of freedom on the boundary
+   * parts given to reinit() contain the prescribed displacement, and the
+   * remaining entries are the initial guess for the iterative solver. On
+   * output, @p displacement contains the displacement of all degrees of
+   * freedom, satisfying the hanging node constraints. Returns the number of
+   * iterations of the conjugate gradient method.
+   */
+  unsigned int
+  solve(VectorType &displacement) const;
+
+  /**
+   * Like the previous function, but set the prescribed displacement by
+   * interpolation of the function @p boundary_displacement with dim
+   * components on the boundary parts given to reinit().
+   */
+  unsigned int
+  solve(const Function<dim, Number> &boundary_displacement,
+        VectorType                  &displacement) const;
+
+  /**
+   * Return the constraints of the problem, i.e., the hanging node
+   * constraints and the homogeneous constraints on the boundary parts with
+   * prescribed displacement.
+   */
+  const AffineConstraints<Number> &
+  get_constraints() const;
+
+private:
+  using SystemOperator =
+    internal::MeshMotionSolverImplementation::Operator<dim, Number>;
+  using LevelOperator =
+    internal::MeshMotionSolverImplementation::Operator<dim, float>;
+  using LevelVectorType = LinearAlgebra::distributed::Vector<float>;
+  using SmootherType    = PreconditionChebyshev<LevelOperator, LevelVectorType>;
+
+  /**
+   * The data structures of the multigrid preconditioner. They are declared
+   * in the order in which they depend on each other, such that they are
+   * destroyed in the correct order.
+   */
+  struct MultigridData
+  {
+    MGConstrainedDoFs constrained_dofs;
+
+    MGLevelObject<LevelOperator> operators;
+
+    MGLevelObject<MatrixFreeOperators::MGInterfaceOperator<LevelOperator>>
+      interface_operators;
+
+    MGTransferMatrixFree<dim, float> transfer;
+
+    mg::SmootherRelaxation<SmootherType, LevelVectorType> smoother;
+
+    MGCoarseGridApplySmoother<LevelVectorType> coarse;
+
+    mg::Matrix<LevelVectorType> matrix;
+
+    mg::Matrix<LevelVectorType> interface_matrix;
+
+    std::unique_ptr<Multigrid<LevelVectorType>> multigrid;
+
+    std::unique_ptr<
+      PreconditionMG<dim, LevelVectorType, MGTransferMatrixFree<dim, float>>>
+      preconditioner;
+  };
+
+  /**
+   * The mapping describing the reference configuration.
+   */
+  ObserverPointer<const Mapping<dim>> mapping;
+
+  /**
+   * The DoFHandler of the displacement.
+   */
+  ObserverPointer<const DoFHandler<dim>> dof_handler;
+
+  /**
+   * The boundary indicators of the boundary parts with prescribed
+   * displacement.
+   */
+  std::set<types::boundary_id> dirichlet_boundary_ids;
+
+  /**
+   * The options given to reinit().
+   */
+  AdditionalData additional_data;
+
+  /**
+   * The hanging node constraints.
+   */
+  AffineConstraints<Number> hanging_node_constraints;
+
+  /**
+   * The hanging node constraints together with the homogeneous constraints
+   * on the boundary parts with prescribed displacement.
+   */
+  AffineConstraints<Number> constraints;
+
+  /**
+   * The degrees of freedom on the boundary parts with prescribed
+   * displacement.
+   */
+  IndexSet dirichlet_dofs;
+
+  /**
+   * The operator on the active cells.
+   */
+  SystemOperator system_operator;
+
+  /**
+   * The multigrid preconditioner.
+   */
+  std::unique_ptr<MultigridData> multigrid;
+};
+
+
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace MeshMotionSolverImplementation
+  {
+    template <int dim, typename Number>
+    void
+    Operator<dim, Number>::set_parameters(const bool   pseudo_elasticity,
+                                          const double poisson_ratio,
+                                          const double stiffening_exponent,
+                                          const double reference_measure)
+    {
+      Assert(this->data.get() != nullptr, ExcNotInitialized());
+      Assert(poisson_ratio < 0.5,
+             ExcMessage("The Poisson ratio needs to be less than 1/2."));
+
+      this->pseudo_elasticity = pseudo_elasticity;
+      lambda =
+        poisson_ratio / ((1. + poisson_ratio) * (1. - 2. * poisson_ratio));
+      mu = 1. / (2. * (1. + poisson_ratio));
+
+      // the coefficient is constant on each cell, so compute the measure of
+      // the cells from the sum of the quadrature weights
+      FECellIntegrator phi(*this->data);
+      cell_coefficients.resize(this->data->n_cell_batches());
+      for (unsigned int cell = 0; cell < this->data->n_cell_batches(); ++cell)
+        {
+          phi.reinit(cell);
+          VectorizedArray<Number> measure = 0.;
+          for (const unsigned int q : phi.quadrature_point_indices())
+            measure += phi.JxW(q);
+
+          for (unsigned int v = 0; v < VectorizedArray<Number>::size(); ++v)
+            cell_coefficients[cell][v] =
+              v < this->data->n_active_entries_per_cell_batch(cell) ?
+                std::pow(reference_measure / measure[v], stiffening_exponent) :
+                1.;
+        }
+    }
+
+
+
+    template <int dim, typename Number>
+    void
+    Operator<dim, Number>::compute_rhs(VectorType       &rhs,
+                                       const VectorType &boundary_values) const
+    {
+      this->data->cell_loop(
+        &Operator::local_apply_plain, this, rhs, boundary_values, true);
+      rhs *= -1.;
+    }
+
+
+
+    template <int dim, typename Number>
+    void
+    Operator<dim, Number>::compute_diagonal()
+    {
+      this->inverse_diagonal_entries =
+        std::make_shared<dealii::DiagonalMatrix<VectorType>>();
+      VectorType &inverse_diagonal =
+        this->inverse_diagonal_entries->get_vector();
+      this->data->initialize_dof_vector(inverse_diagonal);
+
+      MatrixFreeTools::compute_diagonal(*this->data,
+                                        inverse_diagonal,
+                                        &Operator::do_cell_integral,
+                                        this);
+
+      // constrained entries will create zeros on the main diagonal, which we
+      // don't want
+      this->set_constrained_entries_to_one(inverse_diagonal);
+
+      for (unsigned int i = 0; i < inverse_diagonal.locally_owned_size(); ++i)
+        {
+          Assert(inverse_diagonal.local_element(i) > Number(0),
+                 ExcInternalError());
+          inverse_diagonal.local_element(i) =
+            Number(1.) / inverse_diagonal.local_element(i);
+        }
+    }
+
+
+
+    template <int dim, typename Number>
+    void
+    Operator<dim, Number>::apply_add(VectorType       &dst,
+                                     const VectorType &src) const
+    {
+      this->data->cell_loop(&Operator::local_apply, this, dst, src);
+    }
+
+
+
+    template <int dim, typename Number>
+    void
+    Operator<dim, Number>::local_apply(
+      const MatrixFree<dim, Number>               &data,
+      VectorType                                  &dst,
+      const VectorType                            &src,
+      const std::pair<unsigned int, unsigned int> &cell_range) const
+    {
+      FECellIntegrator phi(data);
+      for (unsigned int cell = cell_range.first; cell < cell_range.second;
+           ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values(src);
+          do_cell_integral(phi);
+          phi.distribute_local_to_global(dst);
+        }
+    }
+
+
+
+    template <int dim, typename Number>
+    void
+    Operator<dim, Number>::local_apply_plain(
+      const MatrixFree<dim, Number>               &data,
+      VectorType                                  &dst,
+      const VectorType                            &src,
+      const std::pair<unsigned int, unsigned int> &cell_range) const
+    {
+      // in contrast to local_apply(), also read the values of the
+      // constrained degrees of freedom, i.e., the prescribed displacement
+      FECellIntegrator phi(data);
+      for (unsigned int cell = cell_range.first; cell < cell_range.second;
+           ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values_plain(src);
+          do_cell_integral(phi);
+          phi.distribute_local_to_global(dst);
+        }
+    }
+
+
+
+    template <int dim, typename Number>
+    void
+    Operator<dim, Number>::do_cell_integral(FECellIntegrator &phi) const
+    {
+      const VectorizedArray<Number> coefficient =
+        cell_coefficients[phi.get_current_cell_index()];
+
+      phi.evaluate(EvaluationFlags::gradients);
+      for (const unsigned int q : phi.quadrature_point_indices())
+        if (pseudo_elasticity)
+          {
+            const SymmetricTensor<2, dim, VectorizedArray<Number>> strain =
+              phi.get_symmetric_gradient(q);
+            const VectorizedArray<Number> pressure =
+              coefficient * lambda * trace(strain);
+
+            SymmetricTensor<2, dim, VectorizedArray<Number>> stress = strain;
+            stress *= coefficient * (Number(2.) * mu);
+            for (unsigned int d = 0; d < dim; ++d)
+              stress[d][d] += pressure;
+            phi.submit_symmetric_gradient(stress, q);
+          }
+        else
+          {
+            auto gradient = phi.get_gradient(q);
+            gradient *= coefficient;
+            phi.submit_gradient(gradient, q);
+          }
+      phi.integrate(EvaluationFlags::gradients);
+    }
+  } // namespace MeshMotionSolverImplementation
+} // namespace internal
+
+
+
+template <int dim, typename Number>
+void
+MeshMotionSolver<dim, Number>::reinit(
+  const Mapping<dim>                 &mapping,
+  const DoFHandler<dim>              &dof_handler,
+  const std::set<types::boundary_id> &dirichlet_boundary_ids,
+  const AdditionalData               &additional_data)
+{
+  AssertDimension(dof_handler.get_fe().n_components(), dim);
+  Assert(dirichlet_boundary_ids.empty() == false,
+         ExcMessage("The displacement needs to be prescribed on at least "
+                    "one part of the boundary."));
+  Assert(dof_handler.has_level_dofs(),
+         ExcMessage("The multigrid preconditioner needs the level degrees "
+                    "of freedom, see DoFHandler::distribute_mg_dofs()."));
+
+  this->mapping                = &mapping;
+  this->dof_handler            = &dof_handler;
+  this->dirichlet_boundary_ids = dirichlet_boundary_ids;
+  this->additional_data        = additional_data;
+
+  multigrid.reset();
+
+  const Triangulation<dim> &triangulation = dof_handler.get_triangulation();
+  const unsigned int        fe_degree     = dof_handler.get_fe().degree;
+  const bool                pseudo_elasticity =
+    additional_data.model == Model::pseudo_elasticity;
+
+  // the average measure of the active cells, relative to which the
+  // stiffening coefficient is computed on all levels
+  const double reference_measure = GridTools::volume(triangulation, mapping) /
+                                   triangulation.n_global_active_cells();
+
+  // set up the constraints and the operator on the active cells
+  const IndexSet locally_relevant_dofs =
+    DoFTools::extract_locally_relevant_dofs(dof_handler);
+
+  hanging_node_constraints.reinit(dof_handler.locally_owned_dofs(),
+                                  locally_relevant_dofs);
+  DoFTools::make_hanging_node_constraints(dof_handler,
+                                          hanging_node_constraints);
+  hanging_node_constraints.close();
+
+  const Functions::ZeroFunction<dim, Number> zero_function(dim);
+  std::map<types::boundary_id, const Function<dim, Number> *> function_map;
+  for (const types::boundary_id boundary_id : dirichlet_boundary_ids)
+    function_map[boundary_id] = &zero_function;
+
+  constraints.reinit(dof_handler.locally_owned_dofs(), locally_relevant_dofs);
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  VectorTools::interpolate_boundary_values(mapping,
+                                           dof_handler,
+                                           function_map,
+                                           constraints);
+  constraints.close();
+
+  dirichlet_dofs = DoFTools::extract_boundary_dofs(dof_handler,
+                                                   ComponentMask(),
+                                                   dirichlet_boundary_ids);
+
+  {
+    typename MatrixFree<dim, Number>::AdditionalData mf_data;
+    mf_data.mapping_update_flags = update_gradients | update_JxW_values;
+
+    const auto matrix_free = std::make_shared<MatrixFree<dim, Number>>();
+    matrix_free->reinit(
+      mapping, dof_handler, constraints, QGauss<1>(fe_degree + 1), mf_data);
+
+    system_operator.initialize(matrix_free);
+    system_operator.set_parameters(pseudo_elasticity,
+                                   additional_data.poisson_ratio,
+                                   additional_data.stiffening_exponent,
+                                   reference_measure);
+  }
+
+  // set up the level operators and the multigrid preconditioner as in
+  // step-37
+  multigrid                   = std::make_unique<MultigridData>();
+  MultigridData     &mg       = *multigrid;
+  const unsigned int n_levels = triangulation.n_global_levels();
+
+  mg.constrained_dofs.initialize(dof_handler);
+  mg.constrained_dofs.make_zero_boundary_constraints(dof_handler,
+                                                     dirichlet_boundary_ids);
+
+  mg.operators.resize(0, n_levels - 1);
+  for (unsigned int level = 0; level < n_levels; ++level)
+    {
+      AffineConstraints<float> level_constraints(
+        dof_handler.locally_owned_mg_dofs(level),
+        DoFTools::extract_locally_relevant_level_dofs(dof_handler, level));
+      for (const types::global_dof_index dof_index :
+           mg.constrained_dofs.get_boundary_indices(level))
+        level_constraints.constrain_dof_to_zero(dof_index);
+      level_constraints.close();
+
+      typename MatrixFree<dim, float>::AdditionalData mf_data;
+      mf_data.tasks_parallel_scheme =
+        MatrixFree<dim, float>::AdditionalData::none;
+      mf_data.mapping_update_flags = update_gradients | update_JxW_values;
+      mf_data.mg_level             = level;
+
+      const auto matrix_free = std::make_shared<MatrixFree<dim, float>>();
+      matrix_free->reinit(mapping,
+                          dof_handler,
+                          level_constraints,
+                          QGauss<1>(fe_degree + 1),
+                          mf_data);
+
+      mg.operators[level].initialize(matrix_free, mg.constrained_dofs, level);
+      mg.operators[level].set_parameters(pseudo_elasticity,
+                                         additional_data.poisson_ratio,
+                                         additional_data.stiffening_exponent,
+                                         reference_measure);
+      mg.operators[level].compute_diagonal();
+    }
+
+  mg.transfer.initialize_constraints(mg.constrained_dofs);
+  mg.transfer.build(dof_handler);
+
+  MGLevelObject<typename SmootherType::AdditionalData> smoother_data(
+    0, n_levels - 1);
+  for (unsigned int level = 0; level < n_levels; ++level)
+    {
+      if (level > 0)
+        {
+          smoother_data[level].smoothing_range     = 15.;
+          smoother_data[level].degree = additional_data.smoothing_degree;
+          smoother_data[level].eig_cg_n_iterations = 10;
+        }
+      else
+        {
+          smoother_data[0].smoothing_range     = 1e-3;
+          smoother_data[0].degree              = numbers::invalid_unsigned_int;
+          smoother_data[0].eig_cg_n_iterations = mg.operators[0].m();
+        }
+      smoother_data[level].preconditioner =
+        mg.operators[level].get_matrix_diagonal_inverse();
+    }
+  mg.smoother.initialize(mg.operators, smoother_data);
+  mg.coarse.initialize(mg.smoother);
+
+  mg.interface_operators.resize(0, n_levels - 1);
+  for (unsigned int level = 0; level < n_levels; ++level)
+    mg.interface_operators[level].initialize(mg.operators[level]);
+
+  mg.matrix.initialize(mg.operators);
+  mg.interface_matrix.initialize(mg.interface_operators);
+
+  mg.multigrid = std::make_unique<Multigrid<LevelVectorType>>(
+    mg.matrix, mg.coarse, mg.transfer, mg.smoother, mg.smoother);
+  mg.multigrid->set_edge_matrices(mg.interface_matrix, mg.interface_matrix);
+
+  mg.preconditioner = std::make_unique<
+    PreconditionMG<dim, LevelVectorType, MGTransferMatrixFree<dim, float>>>(
+    dof_handler, *mg.multigrid, mg.transfer);
+}
+
+
+
+template <int dim, typename Number>
+void
+MeshMotionSolver<dim, Number>::initialize_dof_vector(VectorType &vector) const
+{
+  Assert(multigrid != nullptr, ExcNotInitialized());
+  system_operator.initialize_dof_vector(vector);
+}
+
+
+
+template <int dim, typename Number>
+unsigned int
+MeshMotionSolver<dim, Number>::solve(VectorType &displacement) const
+{
+  Assert(multigrid != nullptr, ExcNotInitialized());
+
+  displacement.zero_out_ghost_values();
+
+  // split the displacement into the prescribed part, which is nonzero only
+  // on the boundary and in the hanging nodes constrained to it, and the
+  // increment with homogeneous constraints that is solved for
+  VectorType boundary_values, increment, rhs;
+  initialize_dof_vector(boundary_values);
+  for (const types::global_dof_index i : dirichlet_dofs)
+    if (boundary_values.in_local_range(i))
+      boundary_values(i) = displacement(i);
+  hanging_node_constraints.distribute(boundary_values);
+
+  initialize_dof_vector(rhs);
+  system_operator.compute_rhs(rhs, boundary_values);
+
+  initialize_dof_vector(increment);
+  increment.copy_locally_owned_data_from(displacement);
+  increment -= boundary_values;
+  constraints.set_zero(increment);
+
+  SolverControl control(additional_data.max_iterations,
+                        additional_data.relative_tolerance * rhs.l2_norm());
+  SolverCG<VectorType> solver(control);
+  solver.solve(system_operator, increment, rhs, *multigrid->preconditioner);
+
+  constraints.distribute(increment);
+  displacement.copy_locally_owned_data_from(increment);
+  displacement += boundary_values;
+
+  return control.last_step();
+}
+
+
+
+template <int dim, typename Number>
+unsigned int
+MeshMotionSolver<dim, Number>::solve(
+  const Function<dim, Number> &boundary_displacement,
+  VectorType                  &displacement) const
+{
+  Assert(multigrid != nullptr, ExcNotInitialized());
+  AssertDimension(boundary_displacement.n_components, dim);
+
+  std::map<types::boundary_id, const Function<dim, Number> *> function_map;
+  for (const types::boundary_id boundary_id : dirichlet_boundary_ids)
+    function_map[boundary_id] = &boundary_displacement;
+
+  std::map<types::global_dof_index, Number> boundary_values;
+  VectorTools::interpolate_boundary_values(*mapping,
+                                           *dof_handler,
+                                           function_map,
+                                           boundary_values);
+  for (const auto &[index, value] : boundary_values)
+    if (displacement.in_local_range(index))
+      displacement(index) = value;
+
+  return solve(displacement);
+}
+
+
+
+template <int dim, typename Number>
+inline const AffineConstraints<Number> &
+MeshMotionSolver<dim, Number>::get_constraints() const
+{
+  return constraints;
+}
+
+#endif // DOXYGEN
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
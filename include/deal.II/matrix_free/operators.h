@@ -25,6 +25,7 @@
 
 #include <deal.II/lac/diagonal_matrix.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
 
 #include <deal.II/matrix_free/fe_evaluation.h>
 #include <deal.II/matrix_free/matrix_free.h>
@@ -849,6 +850,173 @@ namespace MatrixFreeOperators
 
 
 
+  /**
+   * This class implements the action of the inverse of the
+   * @ref GlossMassMatrix "mass matrix" for continuous elements, for which
+   * the mass matrix is not block-diagonal and CellwiseInverseMassMatrix hence
+   * cannot be used. The inverse is approximated by a Chebyshev iteration on
+   * the mass matrix provided by a MassOperator object, preconditioned by the
+   * inverse of the @ref GlossLumpedMassMatrix "lumped mass matrix". The
+   * number of Chebyshev steps is chosen automatically from the requested
+   * tolerance and the eigenvalue bounds of the preconditioned mass matrix,
+   * which are estimated once in initialize() and then re-used for every
+   * call to vmult(). In contrast to a conjugate gradient solver, the
+   * application of this operator is a fixed linear map without inner
+   * products, and it can therefore also be used as a preconditioner or
+   * within explicit time integrators without global communication beyond
+   * the ghost exchange of the matrix-vector products.
+   *
+   * The lumped mass matrix is spectrally equivalent to the consistent mass
+   * matrix on shape-regular meshes, so the Chebyshev degree needed to reach
+   * a fixed tolerance is independent of the mesh size. For FE_Q elements
+   * with nodes in the points of the Gauss-Lobatto quadrature and a
+   * MatrixFree object set up with QGaussLobatto of degree+1 points (i.e.,
+   * the spectral element method with `n_q_points_1d == fe_degree + 1`),
+   * the mass matrix computed by MassOperator is diagonal and coincides with
+   * the lumped mass matrix. In that case, the eigenvalue estimate returns
+   * one as upper and lower bound, and vmult() skips the Chebyshev iteration
+   * and applies the exact inverse as a single multiplication by the inverse
+   * lumped diagonal.
+   *
+   * A typical use looks as follows:
+   * @code
+   * MatrixFreeOperators::MassOperator<dim, fe_degree> mass;
+   * mass.initialize(matrix_free);
+   * mass.compute_lumped_diagonal();
+   *
+   * MatrixFreeOperators::InverseMassOperator<dim, fe_degree> inverse_mass;
+   * inverse_mass.initialize(mass);
+   * inverse_mass.vmult(dst, src);
+   * @endcode
+   *
+   * @note The MassOperator object given to initialize() must stay alive as
+   * long as this object is used, and compute_lumped_diagonal() must have
+   * been called on it.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d   = fe_degree + 1,
+            int n_components    = 1,
+            typename VectorType = LinearAlgebra::distributed::Vector<double>,
+            typename VectorizedArrayType =
+              VectorizedArray<typename VectorType::value_type>>
+  class InverseMassOperator : public EnableObserverPointer
+  {
+  public:
+    /**
+     * Type of the mass operator whose inverse is applied.
+     */
+    using MassOperatorType = MassOperator<dim,
+                                          fe_degree,
+                                          n_q_points_1d,
+                                          n_components,
+                                          VectorType,
+                                          VectorizedArrayType>;
+
+    /**
+     * Number alias.
+     */
+    using value_type = typename MassOperatorType::value_type;
+
+    /**
+     * size_type needed for preconditioner classes.
+     */
+    using size_type = typename MassOperatorType::size_type;
+
+    /**
+     * Type of the Chebyshev iteration used internally.
+     */
+    using ChebyshevType = PreconditionChebyshev<MassOperatorType,
+                                                VectorType,
+                                                DiagonalMatrix<VectorType>>;
+
+    /**
+     * Collects the options for the approximate inverse.
+     */
+    struct AdditionalData
+    {
+      /**
+       * Constructor.
+       */
+      AdditionalData(const double       tolerance           = 1e-12,
+                     const unsigned int eig_cg_n_iterations = 20);
+
+      /**
+       * Relative accuracy of the approximate inverse in the energy norm of
+       * the mass matrix, from which the number of Chebyshev steps is
+       * determined. Must be between zero and one.
+       */
+      double tolerance;
+
+      /**
+       * Number of iterations of the Lanczos method used to estimate the
+       * eigenvalues of the mass matrix preconditioned by the lumped mass
+       * matrix.
+       */
+      unsigned int eig_cg_n_iterations;
+    };
+
+    /**
+     * Set up the Chebyshev iteration for the given mass operator and
+     * estimate the eigenvalue bounds, which are then kept for all subsequent
+     * calls to vmult().
+     */
+    void
+    initialize(const MassOperatorType &mass_operator,
+               const AdditionalData   &additional_data = AdditionalData());
+
+    /**
+     * Apply the approximate inverse of the mass matrix to the vector @p src
+     * and write the result into @p dst. Both vectors are assumed to be
+     * initialized via MassOperator::initialize_dof_vector().
+     */
+    void
+    vmult(VectorType &dst, const VectorType &src) const;
+
+    /**
+     * Return the eigenvalue bounds and the Chebyshev degree determined in
+     * initialize().
+     */
+    const typename ChebyshevType::EigenvalueInformation &
+    get_eigenvalue_information() const;
+
+    /**
+     * Return the number of rows of the operator.
+     */
+    size_type
+    m() const;
+
+    /**
+     * Return the number of columns of the operator.
+     */
+    size_type
+    n() const;
+
+  private:
+    /**
+     * Pointer to the mass operator.
+     */
+    ObserverPointer<const MassOperatorType> mass_operator;
+
+    /**
+     * The Chebyshev iteration applying the inverse.
+     */
+    ChebyshevType chebyshev;
+
+    /**
+     * Eigenvalue information cached in initialize().
+     */
+    typename ChebyshevType::EigenvalueInformation eigenvalue_information;
+
+    /**
+     * Flag indicating that the lumped mass matrix coincides with the mass
+     * matrix, in which case vmult() only applies the inverse diagonal.
+     */
+    bool lumped_diagonal_is_exact = false;
+  };
+
+
+
   /**
    * This class implements the operation of the action of a Laplace matrix,
    * namely $ L_{ij} = \int_\Omega c(\mathbf x) \mathbf \nabla N_i(\mathbf x)
@@ -2155,6 +2323,185 @@ namespace MatrixFreeOperators
   }
 
 
+  //--------------------------InverseMassOperator-------------------------------
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  InverseMassOperator<dim,
+                      fe_degree,
+                      n_q_points_1d,
+                      n_components,
+                      VectorType,
+                      VectorizedArrayType>::AdditionalData::
+    AdditionalData(const double       tolerance,
+                   const unsigned int eig_cg_n_iterations)
+    : tolerance(tolerance)
+    , eig_cg_n_iterations(eig_cg_n_iterations)
+  {}
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  void
+  InverseMassOperator<dim,
+                      fe_degree,
+                      n_q_points_1d,
+                      n_components,
+                      VectorType,
+                      VectorizedArrayType>::
+    initialize(const MassOperatorType &mass_operator,
+               const AdditionalData   &additional_data)
+  {
+    Assert(additional_data.tolerance > 0. && additional_data.tolerance < 1.,
+           ExcMessage("The tolerance of the inverse mass operator must be "
+                      "between zero and one."));
+    Assert(additional_data.eig_cg_n_iterations > 0,
+           ExcMessage("The eigenvalue estimate needs at least one "
+                      "iteration."));
+
+    this->mass_operator = &mass_operator;
+
+    // Run the Chebyshev iteration in 'solver mode': a tolerance below one as
+    // smoothing range together with an invalid degree lets the class choose
+    // the polynomial degree from the estimated eigenvalue range
+    typename ChebyshevType::AdditionalData chebyshev_data;
+    chebyshev_data.preconditioner =
+      mass_operator.get_matrix_lumped_diagonal_inverse();
+    chebyshev_data.degree              = numbers::invalid_unsigned_int;
+    chebyshev_data.smoothing_range     = additional_data.tolerance;
+    chebyshev_data.eig_cg_n_iterations = additional_data.eig_cg_n_iterations;
+    chebyshev_data.eigenvalue_algorithm =
+      ChebyshevType::AdditionalData::EigenvalueAlgorithm::lanczos;
+    chebyshev.initialize(mass_operator, chebyshev_data);
+
+    VectorType vector;
+    mass_operator.initialize_dof_vector(vector);
+    eigenvalue_information = chebyshev.estimate_eigenvalues(vector);
+
+    // If the lumped mass matrix is exact up to the requested tolerance (or
+    // up to roundoff), as for collocated Gauss-Lobatto nodes and quadrature,
+    // skip the Chebyshev iteration and apply the inverse diagonal directly
+    const double relative_spread =
+      (eigenvalue_information.max_eigenvalue_estimate -
+       eigenvalue_information.min_eigenvalue_estimate) /
+      eigenvalue_information.max_eigenvalue_estimate;
+    lumped_diagonal_is_exact =
+      relative_spread <=
+      std::max(additional_data.tolerance,
+               100. * std::numeric_limits<value_type>::epsilon());
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  void
+  InverseMassOperator<dim,
+                      fe_degree,
+                      n_q_points_1d,
+                      n_components,
+                      VectorType,
+                      VectorizedArrayType>::vmult(VectorType       &dst,
+                                                  const VectorType &src) const
+  {
+    Assert(mass_operator != nullptr, ExcNotInitialized());
+    if (lumped_diagonal_is_exact)
+      mass_operator->get_matrix_lumped_diagonal_inverse()->vmult(dst, src);
+    else
+      chebyshev.vmult(dst, src);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  const typename InverseMassOperator<dim,
+                                     fe_degree,
+                                     n_q_points_1d,
+                                     n_components,
+                                     VectorType,
+                                     VectorizedArrayType>::ChebyshevType::
+    EigenvalueInformation &
+    InverseMassOperator<dim,
+                        fe_degree,
+                        n_q_points_1d,
+                        n_components,
+                        VectorType,
+                        VectorizedArrayType>::get_eigenvalue_information() const
+  {
+    Assert(mass_operator != nullptr, ExcNotInitialized());
+    return eigenvalue_information;
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  typename InverseMassOperator<dim,
+                               fe_degree,
+                               n_q_points_1d,
+                               n_components,
+                               VectorType,
+                               VectorizedArrayType>::size_type
+  InverseMassOperator<dim,
+                      fe_degree,
+                      n_q_points_1d,
+                      n_components,
+                      VectorType,
+                      VectorizedArrayType>::m() const
+  {
+    Assert(mass_operator != nullptr, ExcNotInitialized());
+    return mass_operator->m();
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  typename InverseMassOperator<dim,
+                               fe_degree,
+                               n_q_points_1d,
+                               n_components,
+                               VectorType,
+                               VectorizedArrayType>::size_type
+  InverseMassOperator<dim,
+                      fe_degree,
+                      n_q_points_1d,
+                      n_components,
+                      VectorType,
+                      VectorizedArrayType>::n() const
+  {
+    Assert(mass_operator != nullptr, ExcNotInitialized());
+    return mass_operator->n();
+  }
+
+
+
   //-----------------------------LaplaceOperator----------------------------------
 
   template <int dim,
@@ -238,10 +238,39 @@ namespace Portable
     DEAL_II_HOST_DEVICE void
     apply_for_each_quad_point(const Functor &func);
 
+    /**
+     * Return the index of the cell the object currently works on. Within
+     * the functor passed to apply_for_each_quad_point(), this is the cell
+     * the quadrature point belongs to, also when several cells are
+     * processed by one team (see
+     * MatrixFree::AdditionalData::cells_per_block). Outside of it, this is
+     * the first cell processed by the team.
+     */
+    DEAL_II_HOST_DEVICE int
+    get_current_cell_index() const;
+
   private:
     const data_type         *data;
     SharedData<dim, Number> *shared_data;
     int                      cell_id;
+
+    /**
+     * Number of cells processed at once by read_dof_values(), evaluate(),
+     * integrate(), and distribute_local_to_global().
+     */
+    int n_cells;
+
+    /**
+     * Distance between the scratch data of two consecutive cells in
+     * SharedData::values and SharedData::gradients.
+     */
+    int cell_stride;
+
+    /**
+     * Position of the scratch data of the current cell in
+     * SharedData::values and SharedData::gradients.
+     */
+    int scratch_offset;
   };
 
 
@@ -256,8 +285,15 @@ namespace Portable
     FEEvaluation(const data_type *data, SharedData<dim, Number> *shdata)
     : data(data)
     , shared_data(shdata)
-    , cell_id(shared_data->team_member.league_rank())
-  {}
+    , cell_id(shared_data->team_member.league_rank() * data->cells_per_block)
+    , n_cells(data->cells_per_block)
+    , cell_stride(shared_data->values.extent(0) / data->cells_per_block)
+    , scratch_offset(0)
+  {
+    // The last block of a color may contain fewer cells
+    if (cell_id + n_cells > static_cast<int>(data->n_cells))
+      n_cells = data->n_cells - cell_id;
+  }
 
 
 
@@ -272,22 +308,29 @@ namespace Portable
   {
     // Populate the scratch memory
     Kokkos::parallel_for(
-      Kokkos::TeamThreadRange(shared_data->team_member, n_q_points),
-      [&](const int &i) {
+      Kokkos::TeamThreadRange(shared_data->team_member, n_cells * n_q_points),
+      [&](const int &index) {
+        const int cell = index / n_q_points;
+        const int i    = index % n_q_points;
         for (unsigned int c = 0; c < n_components_; ++c)
-          shared_data->values(i, c) =
-            src[data->local_to_global(cell_id, i + tensor_dofs_per_cell * c)];
+          shared_data->values(cell * cell_stride + i, c) =
+            src[data->local_to_global(cell_id + cell,
+                                      i + tensor_dofs_per_cell * c)];
       });
     shared_data->team_member.team_barrier();
 
-    for (unsigned int c = 0; c < n_components_; ++c)
-      {
-        internal::resolve_hanging_nodes<dim, fe_degree, false, Number>(
-          shared_data->team_member,
-          data->constraint_weights,
-          data->constraint_mask(cell_id),
-          Kokkos::subview(shared_data->values, Kokkos::ALL, c));
-      }
+    for (int cell = 0; cell < n_cells; ++cell)
+      for (unsigned int c = 0; c < n_components_; ++c)
+        {
+          internal::resolve_hanging_nodes<dim, fe_degree, false, Number>(
+            shared_data->team_member,
+            data->constraint_weights,
+            data->constraint_mask(cell_id + cell),
+            Kokkos::subview(shared_data->values,
+                            Kokkos::make_pair(cell * cell_stride,
+                                              (cell + 1) * cell_stride),
+                            c));
+        }
   }
 
 
@@ -301,35 +344,46 @@ namespace Portable
   FEEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
     distribute_local_to_global(Number *dst) const
   {
-    for (unsigned int c = 0; c < n_components_; ++c)
-      {
-        internal::resolve_hanging_nodes<dim, fe_degree, true, Number>(
-          shared_data->team_member,
-          data->constraint_weights,
-          data->constraint_mask(cell_id),
-          Kokkos::subview(shared_data->values, Kokkos::ALL, c));
-      }
+    for (int cell = 0; cell < n_cells; ++cell)
+      for (unsigned int c = 0; c < n_components_; ++c)
+        {
+          internal::resolve_hanging_nodes<dim, fe_degree, true, Number>(
+            shared_data->team_member,
+            data->constraint_weights,
+            data->constraint_mask(cell_id + cell),
+            Kokkos::subview(shared_data->values,
+                            Kokkos::make_pair(cell * cell_stride,
+                                              (cell + 1) * cell_stride),
+                            c));
+        }
 
     if (data->use_coloring)
       {
         Kokkos::parallel_for(
-          Kokkos::TeamThreadRange(shared_data->team_member, n_q_points),
-          [&](const int &i) {
+          Kokkos::TeamThreadRange(shared_data->team_member,
+                                  n_cells * n_q_points),
+          [&](const int &index) {
+            const int cell = index / n_q_points;
+            const int i    = index % n_q_points;
             for (unsigned int c = 0; c < n_components_; ++c)
-              dst[data->local_to_global(cell_id,
+              dst[data->local_to_global(cell_id + cell,
                                         i + tensor_dofs_per_cell * c)] +=
-                shared_data->values(i, c);
+                shared_data->values(cell * cell_stride + i, c);
           });
       }
     else
       {
         Kokkos::parallel_for(
-          Kokkos::TeamThreadRange(shared_data->team_member, n_q_points),
-          [&](const int &i) {
+          Kokkos::TeamThreadRange(shared_data->team_member,
+                                  n_cells * n_q_points),
+          [&](const int &index) {
+            const int cell = index / n_q_points;
+            const int i    = index % n_q_points;
             for (unsigned int c = 0; c < n_components_; ++c)
-              Kokkos::atomic_add(&dst[data->local_to_global(
-                                   cell_id, i + tensor_dofs_per_cell * c)],
-                                 shared_data->values(i, c));
+              Kokkos::atomic_add(
+                &dst[data->local_to_global(cell_id + cell,
+                                           i + tensor_dofs_per_cell * c)],
+                shared_data->values(cell * cell_stride + i, c));
           });
       }
   }
@@ -356,7 +410,10 @@ namespace Portable
       evaluator_tensor_product(shared_data->team_member,
                                data->shape_values,
                                data->shape_gradients,
-                               data->co_shape_gradients);
+                               data->co_shape_gradients,
+                               n_cells,
+                               cell_stride,
+                               shared_data->temporary);
 
     for (unsigned int c = 0; c < n_components_; ++c)
       {
@@ -423,7 +480,10 @@ namespace Portable
       evaluator_tensor_product(shared_data->team_member,
                                data->shape_values,
                                data->shape_gradients,
-                               data->co_shape_gradients);
+                               data->co_shape_gradients,
+                               n_cells,
+                               cell_stride,
+                               shared_data->temporary);
 
 
     for (unsigned int c = 0; c < n_components_; ++c)
@@ -487,13 +547,13 @@ namespace Portable
   {
     if constexpr (n_components_ == 1)
       {
-        return shared_data->values(q_point, 0);
+        return shared_data->values(scratch_offset + q_point, 0);
       }
     else
       {
         value_type result;
         for (unsigned int c = 0; c < n_components; ++c)
-          result[c] = shared_data->values(q_point, c);
+          result[c] = shared_data->values(scratch_offset + q_point, c);
         return result;
       }
   }
@@ -515,13 +575,13 @@ namespace Portable
   {
     if constexpr (n_components_ == 1)
       {
-        return shared_data->values(q_point, 0);
+        return shared_data->values(scratch_offset + q_point, 0);
       }
     else
       {
         value_type result;
         for (unsigned int c = 0; c < n_components; ++c)
-          result[c] = shared_data->values(q_point, c);
+          result[c] = shared_data->values(scratch_offset + q_point, c);
         return result;
       }
   }
@@ -539,12 +599,13 @@ namespace Portable
   {
     if constexpr (n_components_ == 1)
       {
-        shared_data->values(q_point, 0) = val_in * data->JxW(cell_id, q_point);
+        shared_data->values(scratch_offset + q_point, 0) =
+          val_in * data->JxW(cell_id, q_point);
       }
     else
       {
         for (unsigned int c = 0; c < n_components; ++c)
-          shared_data->values(q_point, c) =
+          shared_data->values(scratch_offset + q_point, c) =
             val_in[c] * data->JxW(cell_id, q_point);
       }
   }
@@ -562,12 +623,12 @@ namespace Portable
   {
     if constexpr (n_components_ == 1)
       {
-        shared_data->values(q_point, 0) = val_in;
+        shared_data->values(scratch_offset + q_point, 0) = val_in;
       }
     else
       {
         for (unsigned int c = 0; c < n_components; ++c)
-          shared_data->values(q_point, c) = val_in[c];
+          shared_data->values(scratch_offset + q_point, c) = val_in[c];
       }
   }
 
@@ -595,7 +656,7 @@ namespace Portable
             Number tmp = 0.;
             for (unsigned int d_2 = 0; d_2 < dim; ++d_2)
               tmp += data->inv_jacobian(cell_id, q_point, d_2, d_1) *
-                     shared_data->gradients(q_point, d_2, 0);
+                     shared_data->gradients(scratch_offset + q_point, d_2, 0);
             grad[d_1] = tmp;
           }
       }
@@ -607,7 +668,7 @@ namespace Portable
               Number tmp = 0.;
               for (unsigned int d_2 = 0; d_2 < dim; ++d_2)
                 tmp += data->inv_jacobian(cell_id, q_point, d_2, d_1) *
-                       shared_data->gradients(q_point, d_2, c);
+                       shared_data->gradients(scratch_offset + q_point, d_2, c);
               grad[c][d_1] = tmp;
             }
       }
@@ -634,7 +695,7 @@ namespace Portable
             for (unsigned int d_2 = 0; d_2 < dim; ++d_2)
               tmp +=
                 data->inv_jacobian(cell_id, q_point, d_1, d_2) * grad_in[d_2];
-            shared_data->gradients(q_point, d_1, 0) =
+            shared_data->gradients(scratch_offset + q_point, d_1, 0) =
               tmp * data->JxW(cell_id, q_point);
           }
       }
@@ -647,7 +708,7 @@ namespace Portable
               for (unsigned int d_2 = 0; d_2 < dim; ++d_2)
                 tmp += data->inv_jacobian(cell_id, q_point, d_1, d_2) *
                        grad_in[c][d_2];
-              shared_data->gradients(q_point, d_1, c) =
+              shared_data->gradients(scratch_offset + q_point, d_1, c) =
                 tmp * data->JxW(cell_id, q_point);
             }
       }
@@ -665,22 +726,842 @@ namespace Portable
   FEEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
     apply_for_each_quad_point(const Functor &func)
   {
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(shared_data->team_member,
-                                                 n_q_points),
-                         [&](const int &i) { func(this, i); });
+    if (n_cells == 1)
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(shared_data->team_member,
+                                                   n_q_points),
+                           [&](const int &i) { func(this, i); });
+    else
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(shared_data->team_member, n_cells * n_q_points),
+        [&](const int &index) {
+          // Work on a copy that refers to the cell the point belongs to
+          const int    cell = index / n_q_points;
+          FEEvaluation fe_eval_cell(*this);
+          fe_eval_cell.cell_id        = cell_id + cell;
+          fe_eval_cell.n_cells        = 1;
+          fe_eval_cell.scratch_offset = cell * cell_stride;
+          func(&fe_eval_cell, index % n_q_points);
+        });
     shared_data->team_member.team_barrier();
   }
 
 
 
-#ifndef DOXYGEN
   template <int dim,
             int fe_degree,
             int n_q_points_1d,
             int n_components_,
             typename Number>
-  constexpr unsigned int
-    FEEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+  DEAL_II_HOST_DEVICE int
+  FEEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    get_current_cell_index() const
+  {
+    return cell_id;
+  }
+
+
+
+  /**
+   * This class provides all the functions necessary to evaluate functions at
+   * quadrature points and to perform integrations on faces, i.e., it is the
+   * face counterpart of Portable::FEEvaluation. It is used within the face
+   * functors passed to Portable::MatrixFree::loop(). For inner faces, two
+   * objects are typically created, one with @p is_interior_face set to true
+   * for the cell from which the normal vector points outwards and one with
+   * @p is_interior_face set to false for the neighboring cell.
+   *
+   * The values are first interpolated to the face in the normal direction of
+   * the respective cell using the values and derivatives of the 1d shape
+   * functions in the end points of the unit interval, and then evaluated at
+   * the face quadrature points by the tensor product kernels in dim-1
+   * dimensions.
+   *
+   * The template arguments are the same as for Portable::FEEvaluation.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d = fe_degree + 1,
+            int n_components_ = 1,
+            typename Number   = double>
+  class FEFaceEvaluation
+  {
+  public:
+    static_assert(dim > 1, "Face integrals are only supported for dim > 1.");
+
+    /**
+     * An alias for scalar quantities.
+     */
+    using value_type = std::conditional_t<(n_components_ == 1),
+                                          Number,
+                                          Tensor<1, n_components_, Number>>;
+
+    /**
+     * An alias for vectorial quantities.
+     */
+    using gradient_type = std::conditional_t<
+      n_components_ == 1,
+      Tensor<1, dim, Number>,
+      std::conditional_t<n_components_ == dim,
+                         Tensor<2, dim, Number>,
+                         Tensor<1, n_components_, Tensor<1, dim, Number>>>>;
+
+    /**
+     * An alias to kernel specific information.
+     */
+    using data_type = typename MatrixFree<dim, Number>::FaceData;
+
+    /**
+     * Dimension.
+     */
+    static constexpr unsigned int dimension = dim;
+
+    /**
+     * Number of components.
+     */
+    static constexpr unsigned int n_components = n_components_;
+
+    /**
+     * Number of quadrature points per face.
+     */
+    static constexpr unsigned int n_q_points =
+      Utilities::pow(n_q_points_1d, dim - 1);
+
+    /**
+     * Number of tensor degrees of freedoms per cell.
+     */
+    static constexpr unsigned int tensor_dofs_per_cell =
+      Utilities::pow(fe_degree + 1, dim);
+
+    /**
+     * Constructor. The argument @p shdata is the pointer passed to the face
+     * functor, i.e., it points to the scratch data of both sides for inner
+     * faces.
+     */
+    DEAL_II_HOST_DEVICE
+    FEFaceEvaluation(const data_type         *data,
+                     SharedData<dim, Number> *shdata,
+                     const bool               is_interior_face = true);
+
+    /**
+     * For the vector @p src, read out the values on the degrees of freedom of
+     * the cell on the current side of the face, and store them internally.
+     * Hanging-node constraints are resolved as in FEEvaluation.
+     */
+    DEAL_II_HOST_DEVICE void
+    read_dof_values(const Number *src);
+
+    /**
+     * Take the value stored internally on dof values of the cell on the
+     * current side and sum them into the vector @p dst. Since faces are not
+     * colored, the entries are always added with atomic operations.
+     */
+    DEAL_II_HOST_DEVICE void
+    distribute_local_to_global(Number *dst) const;
+
+    /**
+     * Evaluate the function values and the gradients of the FE function given
+     * at the DoF values of the cell at the quadrature points on the face.
+     */
+    DEAL_II_HOST_DEVICE void
+    evaluate(const EvaluationFlags::EvaluationFlags evaluate_flag);
+
+    /**
+     * This function takes the values and/or gradients that are stored on
+     * the face quadrature points, tests them by all the basis
+     * functions/gradients of the cell and performs the face integration as
+     * specified by the @p integration_flag argument.
+     */
+    DEAL_II_HOST_DEVICE void
+    integrate(const EvaluationFlags::EvaluationFlags integration_flag);
+
+    /**
+     * Return the value at quadrature point number @p q_point after a call to
+     * evaluate().
+     */
+    DEAL_II_HOST_DEVICE value_type
+    get_value(int q_point) const;
+
+    /**
+     * Write a value to the field containing the values on quadrature point
+     * with component @p q_point, multiplied by the face JxW value.
+     */
+    DEAL_II_HOST_DEVICE void
+    submit_value(const value_type &val_in, int q_point);
+
+    /**
+     * Return the gradient in real coordinates at quadrature point number
+     * @p q_point after a call to evaluate().
+     */
+    DEAL_II_HOST_DEVICE gradient_type
+    get_gradient(int q_point) const;
+
+    /**
+     * Write a gradient to the field containing the gradients on quadrature
+     * point number @p q_point, multiplied by the face JxW value.
+     */
+    DEAL_II_HOST_DEVICE void
+    submit_gradient(const gradient_type &grad_in, int q_point);
+
+    /**
+     * Return the derivative in the direction of normal_vector() at quadrature
+     * point number @p q_point.
+     */
+    DEAL_II_HOST_DEVICE value_type
+    get_normal_derivative(int q_point) const;
+
+    /**
+     * Write the derivative in the direction of normal_vector() to quadrature
+     * point number @p q_point, to be tested by gradients in integrate().
+     */
+    DEAL_II_HOST_DEVICE void
+    submit_normal_derivative(const value_type &val_in, int q_point);
+
+    /**
+     * Return the normal vector at quadrature point number @p q_point. As in
+     * dealii::FEFaceEvaluation, the normal vector points out of the interior
+     * cell for both sides of the face.
+     */
+    DEAL_II_HOST_DEVICE Tensor<1, dim, Number>
+    normal_vector(int q_point) const;
+
+    /**
+     * Return the face JxW value at quadrature point number @p q_point.
+     */
+    DEAL_II_HOST_DEVICE Number
+    JxW(int q_point) const;
+
+    /**
+     * Return the boundary id of the current face. Only valid for boundary
+     * faces.
+     */
+    DEAL_II_HOST_DEVICE types::boundary_id
+    boundary_id() const;
+
+    /**
+     * Apply the functor @p func on every quadrature point of the face.
+     *
+     * @p func needs to define
+     * \code
+     * DEAL_II_HOST_DEVICE void operator()(
+     *   Portable::FEFaceEvaluation<dim, fe_degree, n_q_points_1d,
+     *                              n_components, Number> *fe_eval,
+     *   const int q_point) const;
+     * \endcode
+     */
+    template <typename Functor>
+    DEAL_II_HOST_DEVICE void
+    apply_for_each_quad_point(const Functor &func);
+
+  private:
+    /**
+     * Return the index of @p q_point in the numbering of the current side.
+     */
+    DEAL_II_HOST_DEVICE int
+    side_q_point(int q_point) const;
+
+    /**
+     * Return the lexicographic index of the cell degree of freedom with
+     * tangential index @p t and index @p k in normal direction.
+     */
+    DEAL_II_HOST_DEVICE int
+    cell_dof_index(const int t, const int k) const;
+
+    const data_type         *data;
+    SharedData<dim, Number> *shared_data;
+    int                      face_id;
+    unsigned int             side;
+    unsigned int             normal_direction;
+    unsigned int             face_side;
+  };
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    FEFaceEvaluation(const data_type         *data,
+                     SharedData<dim, Number> *shdata,
+                     const bool               is_interior_face)
+    : data(data)
+    , shared_data(shdata + (is_interior_face ? 0 : 1))
+    , face_id(shdata->team_member.league_rank())
+    , side(is_interior_face ? 0 : 1)
+    , normal_direction(data->face_number[side](face_id) / 2)
+    , face_side(data->face_number[side](face_id) % 2)
+  {}
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE int
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    side_q_point(int q_point) const
+  {
+    return side == 0 ? q_point :
+                       data->exterior_q_point_index(face_id, q_point);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE int
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    cell_dof_index(const int t, const int k) const
+  {
+    constexpr int n_dofs_1d = fe_degree + 1;
+    int           stride    = 1;
+    for (unsigned int d = 0; d < normal_direction; ++d)
+      stride *= n_dofs_1d;
+    return (t % stride) + k * stride + (t / stride) * stride * n_dofs_1d;
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    read_dof_values(const Number *src)
+  {
+    Kokkos::parallel_for(
+      Kokkos::TeamThreadRange(shared_data->team_member, tensor_dofs_per_cell),
+      [&](const int &i) {
+        for (unsigned int c = 0; c < n_components_; ++c)
+          shared_data->values(i, c) =
+            src[data->local_to_global[side](face_id,
+                                            i + tensor_dofs_per_cell * c)];
+      });
+    shared_data->team_member.team_barrier();
+
+    for (unsigned int c = 0; c < n_components_; ++c)
+      {
+        internal::resolve_hanging_nodes<dim, fe_degree, false, Number>(
+          shared_data->team_member,
+          data->constraint_weights,
+          data->constraint_mask[side](face_id),
+          Kokkos::subview(shared_data->values, Kokkos::ALL, c));
+      }
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    distribute_local_to_global(Number *dst) const
+  {
+    for (unsigned int c = 0; c < n_components_; ++c)
+      {
+        internal::resolve_hanging_nodes<dim, fe_degree, true, Number>(
+          shared_data->team_member,
+          data->constraint_weights,
+          data->constraint_mask[side](face_id),
+          Kokkos::subview(shared_data->values, Kokkos::ALL, c));
+      }
+
+    Kokkos::parallel_for(
+      Kokkos::TeamThreadRange(shared_data->team_member, tensor_dofs_per_cell),
+      [&](const int &i) {
+        for (unsigned int c = 0; c < n_components_; ++c)
+          Kokkos::atomic_add(
+            &dst[data->local_to_global[side](face_id,
+                                             i + tensor_dofs_per_cell * c)],
+            shared_data->values(i, c));
+      });
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    evaluate(const EvaluationFlags::EvaluationFlags evaluate_flag)
+  {
+    constexpr int n_dofs_1d      = fe_degree + 1;
+    constexpr int n_dofs_face    = Utilities::pow(n_dofs_1d, dim - 1);
+    const auto    face_range     = Kokkos::make_pair(0, n_dofs_face);
+    const bool    evaluate_grads = evaluate_flag & EvaluationFlags::gradients;
+    const int     shape_offset   = face_side * 2 * n_dofs_1d;
+    auto         &team_member    = shared_data->team_member;
+
+    internal::EvaluatorTensorProduct<
+      internal::EvaluatorVariant::evaluate_general,
+      dim - 1,
+      fe_degree,
+      n_q_points_1d,
+      Number>
+      evaluator_tensor_product(team_member,
+                               data->shape_values,
+                               data->shape_gradients,
+                               data->co_shape_gradients);
+
+    for (unsigned int c = 0; c < n_components_; ++c)
+      {
+        auto values    = Kokkos::subview(shared_data->values, Kokkos::ALL, c);
+        auto gradients = Kokkos::subview(
+          shared_data->gradients, Kokkos::ALL, Kokkos::ALL, c);
+
+        // Interpolate the values and the normal derivative to the face. The
+        // values are temporarily stored in the first and the normal
+        // derivative in the last gradient component.
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team_member, n_dofs_face), [&](const int &t) {
+            Number value = 0, derivative = 0;
+            for (int k = 0; k < n_dofs_1d; ++k)
+              {
+                const Number u = values(cell_dof_index(t, k));
+                value += data->shape_data_on_face[shape_offset + k] * u;
+                derivative +=
+                  data->shape_data_on_face[shape_offset + n_dofs_1d + k] * u;
+              }
+            gradients(t, 0) = value;
+            if (evaluate_grads)
+              gradients(t, dim - 1) = derivative;
+          });
+        team_member.team_barrier();
+
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team_member, n_dofs_face),
+                             [&](const int &t) { values(t) = gradients(t, 0); });
+        team_member.team_barrier();
+
+        auto face_values = Kokkos::subview(values, face_range);
+        if (evaluate_grads)
+          {
+            evaluator_tensor_product.evaluate_gradients(
+              face_values,
+              Kokkos::subview(gradients,
+                              face_range,
+                              Kokkos::make_pair(0, dim - 1)));
+            team_member.team_barrier();
+            evaluator_tensor_product.evaluate_values(
+              Kokkos::subview(gradients, face_range, dim - 1));
+            team_member.team_barrier();
+          }
+
+        if (evaluate_flag & EvaluationFlags::values)
+          {
+            evaluator_tensor_product.evaluate_values(face_values);
+            team_member.team_barrier();
+          }
+
+        // Sort the tangential derivatives and the normal derivative into
+        // the coordinate directions of the cell.
+        if (evaluate_grads && normal_direction != dim - 1)
+          {
+            Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team_member, n_q_points),
+              [&](const int &q) {
+                Number tmp[dim];
+                for (unsigned int d = 0; d < dim; ++d)
+                  tmp[d] = gradients(q, d);
+                for (unsigned int d = 0, j = 0; d < dim; ++d)
+                  gradients(q, d) =
+                    (d == normal_direction) ? tmp[dim - 1] : tmp[j++];
+              });
+            team_member.team_barrier();
+          }
+      }
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    integrate(const EvaluationFlags::EvaluationFlags integration_flag)
+  {
+    constexpr int n_dofs_1d      = fe_degree + 1;
+    constexpr int n_dofs_face    = Utilities::pow(n_dofs_1d, dim - 1);
+    const auto    face_range     = Kokkos::make_pair(0, n_dofs_face);
+    const bool    integrate_vals = integration_flag & EvaluationFlags::values;
+    const bool integrate_grads = integration_flag & EvaluationFlags::gradients;
+    const int  shape_offset    = face_side * 2 * n_dofs_1d;
+    auto      &team_member     = shared_data->team_member;
+
+    internal::EvaluatorTensorProduct<
+      internal::EvaluatorVariant::evaluate_general,
+      dim - 1,
+      fe_degree,
+      n_q_points_1d,
+      Number>
+      evaluator_tensor_product(team_member,
+                               data->shape_values,
+                               data->shape_gradients,
+                               data->co_shape_gradients);
+
+    for (unsigned int c = 0; c < n_components_; ++c)
+      {
+        auto values    = Kokkos::subview(shared_data->values, Kokkos::ALL, c);
+        auto gradients = Kokkos::subview(
+          shared_data->gradients, Kokkos::ALL, Kokkos::ALL, c);
+        auto face_values = Kokkos::subview(values, face_range);
+
+        // Move the normal derivative to the last component, followed by the
+        // tangential derivatives, which is the inverse of the sorting in
+        // evaluate().
+        if (integrate_grads && normal_direction != dim - 1)
+          {
+            Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team_member, n_q_points),
+              [&](const int &q) {
+                Number tmp[dim];
+                for (unsigned int d = 0; d < dim; ++d)
+                  tmp[d] = gradients(q, d);
+                for (unsigned int d = 0, j = 0; d < dim; ++d)
+                  if (d == normal_direction)
+                    gradients(q, dim - 1) = tmp[d];
+                  else
+                    gradients(q, j++) = tmp[d];
+              });
+            team_member.team_barrier();
+          }
+
+        if (integrate_vals)
+          {
+            evaluator_tensor_product.integrate_values(face_values);
+            team_member.team_barrier();
+          }
+
+        if (integrate_grads)
+          {
+            auto tangential_gradients = Kokkos::subview(
+              gradients, face_range, Kokkos::make_pair(0, dim - 1));
+            if (integrate_vals)
+              evaluator_tensor_product.template integrate_gradients<true>(
+                face_values, tangential_gradients);
+            else
+              evaluator_tensor_product.template integrate_gradients<false>(
+                face_values, tangential_gradients);
+            team_member.team_barrier();
+            evaluator_tensor_product.integrate_values(
+              Kokkos::subview(gradients, face_range, dim - 1));
+            team_member.team_barrier();
+          }
+
+        // Expand from the face to the cell using the values and the
+        // derivatives of the 1d shape functions in the normal direction.
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team_member, n_dofs_face),
+                             [&](const int &t) { gradients(t, 0) = values(t); });
+        team_member.team_barrier();
+
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team_member, tensor_dofs_per_cell),
+          [&](const int &i) {
+            int stride = 1;
+            for (unsigned int d = 0; d < normal_direction; ++d)
+              stride *= n_dofs_1d;
+            const int k = (i / stride) % n_dofs_1d;
+            const int t = (i % stride) + (i / (stride * n_dofs_1d)) * stride;
+
+            Number result =
+              data->shape_data_on_face[shape_offset + k] * gradients(t, 0);
+            if (integrate_grads)
+              result +=
+                data->shape_data_on_face[shape_offset + n_dofs_1d + k] *
+                gradients(t, dim - 1);
+            values(i) = result;
+          });
+        team_member.team_barrier();
+      }
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE typename FEFaceEvaluation<dim,
+                                                fe_degree,
+                                                n_q_points_1d,
+                                                n_components_,
+                                                Number>::value_type
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    get_value(int q_point) const
+  {
+    const int q = side_q_point(q_point);
+    if constexpr (n_components_ == 1)
+      {
+        return shared_data->values(q, 0);
+      }
+    else
+      {
+        value_type result;
+        for (unsigned int c = 0; c < n_components; ++c)
+          result[c] = shared_data->values(q, c);
+        return result;
+      }
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    submit_value(const value_type &val_in, int q_point)
+  {
+    const int q = side_q_point(q_point);
+    if constexpr (n_components_ == 1)
+      {
+        shared_data->values(q, 0) = val_in * data->JxW(face_id, q_point);
+      }
+    else
+      {
+        for (unsigned int c = 0; c < n_components; ++c)
+          shared_data->values(q, c) = val_in[c] * data->JxW(face_id, q_point);
+      }
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE typename FEFaceEvaluation<dim,
+                                                fe_degree,
+                                                n_q_points_1d,
+                                                n_components_,
+                                                Number>::gradient_type
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    get_gradient(int q_point) const
+  {
+    const int     q = side_q_point(q_point);
+    gradient_type grad;
+
+    if constexpr (n_components_ == 1)
+      {
+        for (unsigned int d_1 = 0; d_1 < dim; ++d_1)
+          {
+            Number tmp = 0.;
+            for (unsigned int d_2 = 0; d_2 < dim; ++d_2)
+              tmp += data->inv_jacobian[side](face_id, q, d_2, d_1) *
+                     shared_data->gradients(q, d_2, 0);
+            grad[d_1] = tmp;
+          }
+      }
+    else
+      {
+        for (unsigned int c = 0; c < n_components; ++c)
+          for (unsigned int d_1 = 0; d_1 < dim; ++d_1)
+            {
+              Number tmp = 0.;
+              for (unsigned int d_2 = 0; d_2 < dim; ++d_2)
+                tmp += data->inv_jacobian[side](face_id, q, d_2, d_1) *
+                       shared_data->gradients(q, d_2, c);
+              grad[c][d_1] = tmp;
+            }
+      }
+
+    return grad;
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    submit_gradient(const gradient_type &grad_in, int q_point)
+  {
+    const int    q   = side_q_point(q_point);
+    const Number JxW = data->JxW(face_id, q_point);
+
+    if constexpr (n_components_ == 1)
+      {
+        for (unsigned int d_1 = 0; d_1 < dim; ++d_1)
+          {
+            Number tmp = 0.;
+            for (unsigned int d_2 = 0; d_2 < dim; ++d_2)
+              tmp += data->inv_jacobian[side](face_id, q, d_1, d_2) *
+                     grad_in[d_2];
+            shared_data->gradients(q, d_1, 0) = tmp * JxW;
+          }
+      }
+    else
+      {
+        for (unsigned int c = 0; c < n_components; ++c)
+          for (unsigned int d_1 = 0; d_1 < dim; ++d_1)
+            {
+              Number tmp = 0.;
+              for (unsigned int d_2 = 0; d_2 < dim; ++d_2)
+                tmp += data->inv_jacobian[side](face_id, q, d_1, d_2) *
+                       grad_in[c][d_2];
+              shared_data->gradients(q, d_1, c) = tmp * JxW;
+            }
+      }
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE typename FEFaceEvaluation<dim,
+                                                fe_degree,
+                                                n_q_points_1d,
+                                                n_components_,
+                                                Number>::value_type
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    get_normal_derivative(int q_point) const
+  {
+    const gradient_type          grad   = get_gradient(q_point);
+    const Tensor<1, dim, Number> normal = normal_vector(q_point);
+
+    if constexpr (n_components_ == 1)
+      return grad * normal;
+    else
+      {
+        value_type result;
+        for (unsigned int c = 0; c < n_components; ++c)
+          result[c] = grad[c] * normal;
+        return result;
+      }
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    submit_normal_derivative(const value_type &val_in, int q_point)
+  {
+    const Tensor<1, dim, Number> normal = normal_vector(q_point);
+    gradient_type                grad;
+
+    if constexpr (n_components_ == 1)
+      grad = val_in * normal;
+    else
+      for (unsigned int c = 0; c < n_components; ++c)
+        grad[c] = val_in[c] * normal;
+
+    submit_gradient(grad, q_point);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE Tensor<1, dim, Number>
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    normal_vector(int q_point) const
+  {
+    Tensor<1, dim, Number> normal;
+    for (unsigned int d = 0; d < dim; ++d)
+      normal[d] = data->normal_vectors(face_id, q_point, d);
+    return normal;
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE Number
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::JxW(
+    int q_point) const
+  {
+    return data->JxW(face_id, q_point);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE types::boundary_id
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    boundary_id() const
+  {
+    return data->boundary_id(face_id);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  template <typename Functor>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    apply_for_each_quad_point(const Functor &func)
+  {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(shared_data->team_member,
+                                                 n_q_points),
+                         [&](const int &i) { func(this, i); });
+    shared_data->team_member.team_barrier();
+  }
+
+
+
+#ifndef DOXYGEN
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  constexpr unsigned int
+    FEEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+      n_q_points;
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  constexpr unsigned int
+    FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
       n_q_points;
 #endif
 } // namespace Portable
@@ -0,0 +1,567 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_portable_fe_point_evaluation_h
+#define dealii_portable_fe_point_evaluation_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_poly.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/evaluation_flags.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Portable
+{
+  /**
+   * This class evaluates a scalar finite element solution at arbitrary
+   * points inside the cells of a mesh, and tests by the shape functions at
+   * these points, directly on the device. It is the Portable counterpart of
+   * dealii::FEPointEvaluation and is meant for applications such as
+   * particle-mesh coupling where both the field vector and the point data
+   * live in MemorySpace::Default and copying them to the host would
+   * dominate the run time.
+   *
+   * The set of points is described on the host by a list of cells together
+   * with the reference coordinates of the points inside each cell, e.g. as
+   * obtained from GridTools::compute_point_locations() or from the particles
+   * of a Particles::ParticleHandler. The reinit() function flattens this
+   * description into Kokkos views holding, for every point, the index of the
+   * cell it belongs to, its reference coordinates and, if gradients are
+   * requested, the inverse Jacobian of the mapping. Afterwards, evaluate()
+   * and integrate() launch one device thread per point that sets up the
+   * one-dimensional Lagrange basis in the reference coordinates of that
+   * point and performs the tensor-product sum over the degrees of freedom of
+   * the cell.
+   *
+   * The class supports scalar elements with a Lagrange basis in tensor
+   * product form, i.e., FE_Q and FE_DGQ, of polynomial degree @p fe_degree.
+   *
+   * @tparam dim Dimension in which this class is to be used
+   *
+   * @tparam fe_degree Degree of the tensor product finite element with
+   * fe_degree+1 degrees of freedom per coordinate direction
+   *
+   * @tparam Number Number format, @p double or @p float. Defaults to @p
+   * double.
+   */
+  template <int dim, int fe_degree, typename Number = double>
+  class FEPointEvaluation
+  {
+  public:
+    /**
+     * The Kokkos memory space the data of this class lives in.
+     */
+    using memory_space = MemorySpace::Default::kokkos_space;
+
+    /**
+     * The vector type evaluate() reads from and integrate() writes into.
+     */
+    using VectorType =
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>;
+
+    /**
+     * View holding one value per point.
+     */
+    using ValueView = Kokkos::View<Number *, memory_space>;
+
+    /**
+     * View holding one gradient per point.
+     */
+    using GradientView = Kokkos::View<Number *[dim], memory_space>;
+
+    /**
+     * Number of degrees of freedom per coordinate direction.
+     */
+    static constexpr unsigned int n_dofs_1d = fe_degree + 1;
+
+    /**
+     * Number of degrees of freedom per cell.
+     */
+    static constexpr unsigned int dofs_per_cell =
+      Utilities::pow(n_dofs_1d, dim);
+
+    /**
+     * Set up the data structures for the points given by @p unit_points,
+     * where <code>unit_points[c]</code> contains the reference coordinates
+     * of the points located in <code>cells[c]</code>. The points are numbered
+     * consecutively in the order given by the two arguments, and the views
+     * passed to evaluate() and integrate() follow this numbering.
+     *
+     * The degrees of freedom are translated to locally owned and ghost
+     * indices of @p partitioner, which must be the partitioner of the
+     * vectors later passed to evaluate() and integrate(). For serial
+     * computations, @p partitioner may be a null pointer, in which case the
+     * global indices are used directly.
+     *
+     * The inverse Jacobians of @p mapping at the points are only computed
+     * if @p update_flags contains update_gradients.
+     */
+    void
+    reinit(
+      const Mapping<dim>    &mapping,
+      const DoFHandler<dim> &dof,
+      const std::vector<typename DoFHandler<dim>::active_cell_iterator> &cells,
+      const std::vector<std::vector<Point<dim>>>               &unit_points,
+      const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+      const UpdateFlags update_flags = update_values | update_gradients);
+
+    /**
+     * Return the number of points set up in reinit().
+     */
+    unsigned int
+    n_points() const;
+
+    /**
+     * Evaluate the finite element function given by @p src at all points,
+     * writing the values into @p values and the gradients in real space into
+     * @p gradients, as selected by @p evaluation_flags. The views must have
+     * n_points() entries if the corresponding flag is set. The vector @p src
+     * must have its ghost values updated.
+     */
+    void
+    evaluate(const VectorType                      &src,
+             const EvaluationFlags::EvaluationFlags evaluation_flags,
+             const ValueView                       &values,
+             const GradientView                    &gradients) const;
+
+    /**
+     * Multiply the @p values and the real-space @p gradients given at the
+     * points by the values and gradients of the shape functions, as selected
+     * by @p integration_flags, and add the result into @p dst. Since several
+     * points, and several cells, contribute to the same entry of @p dst, the
+     * summation uses atomic operations. The contributions to ghost entries
+     * need to be communicated to their owners by calling
+     * <code>dst.compress(VectorOperation::add)</code> afterwards.
+     *
+     * As for dealii::FEPointEvaluation, no quadrature weight is applied, so
+     * @p values and @p gradients should already contain the weights of the
+     * points if the result is meant to approximate an integral.
+     */
+    void
+    integrate(const ValueView                       &values,
+              const GradientView                    &gradients,
+              const EvaluationFlags::EvaluationFlags integration_flags,
+              VectorType                            &dst) const;
+
+  private:
+    /**
+     * For each cell, the vector indices of the degrees of freedom in
+     * lexicographic order.
+     */
+    Kokkos::View<unsigned int **, memory_space> dof_indices;
+
+    /**
+     * Index into the first dimension of @p dof_indices for every point.
+     */
+    Kokkos::View<unsigned int *, memory_space> point_to_cell;
+
+    /**
+     * Reference coordinates of the points.
+     */
+    Kokkos::View<Number *[dim], memory_space> unit_points;
+
+    /**
+     * Inverse Jacobians of the mapping at the points, stored in the same
+     * format as in Portable::MatrixFree, i.e., entry <code>(q, d, e)</code>
+     * is the derivative of the reference coordinate @p d with respect to
+     * the real coordinate @p e.
+     */
+    Kokkos::View<Number *[dim][dim], memory_space> inverse_jacobians;
+
+    /**
+     * Support points of the one-dimensional Lagrange basis.
+     */
+    Kokkos::View<Number[n_dofs_1d], memory_space> support_points_1d;
+
+    /**
+     * Barycentric weights of the one-dimensional Lagrange basis, i.e., the
+     * inverse of the product of the differences between a support point and
+     * all other support points.
+     */
+    Kokkos::View<Number[n_dofs_1d], memory_space> weights_1d;
+
+    /**
+     * Flags passed to reinit().
+     */
+    UpdateFlags update_flags = update_default;
+  };
+
+
+
+#ifndef DOXYGEN
+
+  namespace internal
+  {
+    /**
+     * Evaluate the one-dimensional Lagrange basis given by its support
+     * points and barycentric weights, and its derivative, at @p x.
+     */
+    template <int n_dofs_1d, typename Number, typename ViewType>
+    DEAL_II_HOST_DEVICE inline void
+    evaluate_lagrange_basis_1d(const ViewType &support_points,
+                               const ViewType &weights,
+                               const Number    x,
+                               Number         *values,
+                               Number         *derivatives)
+    {
+      for (int i = 0; i < n_dofs_1d; ++i)
+        {
+          Number value      = weights(i);
+          Number derivative = 0;
+          for (int j = 0; j < n_dofs_1d; ++j)
+            if (j != i)
+              {
+                derivative = derivative * (x - support_points(j)) + value;
+                value *= x - support_points(j);
+              }
+          values[i]      = value;
+          derivatives[i] = derivative;
+        }
+    }
+
+
+
+    /**
+     * Compute the values and gradients in reference coordinates of all
+     * tensor-product shape functions from their one-dimensional
+     * counterparts. The function calls @p func with the lexicographic index
+     * of the shape function, its value, and its reference gradient.
+     */
+    template <int dim, int n_dofs_1d, typename Number, typename Func>
+    DEAL_II_HOST_DEVICE inline void
+    for_each_shape_function(const Number (&values)[dim][n_dofs_1d],
+                            const Number (&derivatives)[dim][n_dofs_1d],
+                            const Func &func)
+    {
+      constexpr int dofs_per_cell = Utilities::pow(n_dofs_1d, dim);
+      for (int i = 0; i < dofs_per_cell; ++i)
+        {
+          int index_1d[dim];
+          for (int d = 0, j = i; d < dim; ++d, j /= n_dofs_1d)
+            index_1d[d] = j % n_dofs_1d;
+
+          Number value = 1;
+          Number gradient[dim];
+          for (int d = 0; d < dim; ++d)
+            gradient[d] = 1;
+          for (int d = 0; d < dim; ++d)
+            {
+              value *= values[d][index_1d[d]];
+              for (int e = 0; e < dim; ++e)
+                gradient[e] *= (e == d) ? derivatives[d][index_1d[d]] :
+                                          values[d][index_1d[d]];
+            }
+          func(i, value, gradient);
+        }
+    }
+  } // namespace internal
+
+
+
+  template <int dim, int fe_degree, typename Number>
+  void
+  FEPointEvaluation<dim, fe_degree, Number>::reinit(
+    const Mapping<dim>                                                &mapping,
+    const DoFHandler<dim>                                             &dof,
+    const std::vector<typename DoFHandler<dim>::active_cell_iterator> &cells,
+    const std::vector<std::vector<Point<dim>>>               &unit_points_in,
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+    const UpdateFlags                                         update_flags_in)
+  {
+    AssertDimension(cells.size(), unit_points_in.size());
+
+    const FiniteElement<dim> &fe = dof.get_fe();
+    AssertThrow(fe.n_components() == 1,
+                ExcMessage("Only scalar elements are supported."));
+    AssertThrow(fe.degree == fe_degree,
+                ExcMessage("The degree of the finite element does not match "
+                           "the template argument fe_degree."));
+    AssertDimension(fe.n_dofs_per_cell(), dofs_per_cell);
+    const FE_Poly<dim> *fe_poly = dynamic_cast<const FE_Poly<dim> *>(&fe);
+    AssertThrow(fe_poly != nullptr && fe.has_support_points(),
+                ExcMessage("Only FE_Q and FE_DGQ elements are supported."));
+
+    update_flags = update_flags_in;
+
+    // The element is a tensor product of Lagrange polynomials, so the
+    // one-dimensional basis is determined by the first coordinate of the
+    // support points along the first coordinate direction
+    const std::vector<unsigned int> lexicographic =
+      fe_poly->get_poly_space_numbering_inverse();
+    {
+      support_points_1d = Kokkos::View<Number[n_dofs_1d], memory_space>(
+        Kokkos::view_alloc("support_points_1d", Kokkos::WithoutInitializing));
+      weights_1d = Kokkos::View<Number[n_dofs_1d], memory_space>(
+        Kokkos::view_alloc("weights_1d", Kokkos::WithoutInitializing));
+      auto support_points_host = Kokkos::create_mirror_view(support_points_1d);
+      auto weights_host        = Kokkos::create_mirror_view(weights_1d);
+      for (unsigned int i = 0; i < n_dofs_1d; ++i)
+        support_points_host(i) =
+          fe.get_unit_support_points()[lexicographic[i]][0];
+      for (unsigned int i = 0; i < n_dofs_1d; ++i)
+        {
+          Number product = 1;
+          for (unsigned int j = 0; j < n_dofs_1d; ++j)
+            if (j != i)
+              product *= support_points_host(i) - support_points_host(j);
+          weights_host(i) = Number(1) / product;
+        }
+      Kokkos::deep_copy(support_points_1d, support_points_host);
+      Kokkos::deep_copy(weights_1d, weights_host);
+    }
+
+    unsigned int n_total_points = 0;
+    for (const auto &points : unit_points_in)
+      n_total_points += points.size();
+
+    dof_indices = Kokkos::View<unsigned int **, memory_space>(
+      Kokkos::view_alloc("dof_indices", Kokkos::WithoutInitializing),
+      cells.size(),
+      dofs_per_cell);
+    point_to_cell = Kokkos::View<unsigned int *, memory_space>(
+      Kokkos::view_alloc("point_to_cell", Kokkos::WithoutInitializing),
+      n_total_points);
+    unit_points = Kokkos::View<Number *[dim], memory_space>(
+      Kokkos::view_alloc("unit_points", Kokkos::WithoutInitializing),
+      n_total_points);
+    if (update_flags & update_gradients)
+      inverse_jacobians = Kokkos::View<Number *[dim][dim], memory_space>(
+        Kokkos::view_alloc("inverse_jacobians", Kokkos::WithoutInitializing),
+        n_total_points);
+    else
+      inverse_jacobians = Kokkos::View<Number *[dim][dim], memory_space>();
+
+    auto dof_indices_host   = Kokkos::create_mirror_view(dof_indices);
+    auto point_to_cell_host = Kokkos::create_mirror_view(point_to_cell);
+    auto unit_points_host   = Kokkos::create_mirror_view(unit_points);
+    auto inverse_jacobians_host =
+      Kokkos::create_mirror_view(inverse_jacobians);
+
+    std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
+    unsigned int                         point = 0;
+    for (unsigned int c = 0; c < cells.size(); ++c)
+      {
+        cells[c]->get_dof_indices(local_dof_indices);
+        for (unsigned int i = 0; i < dofs_per_cell; ++i)
+          {
+            const types::global_dof_index index =
+              local_dof_indices[lexicographic[i]];
+            dof_indices_host(c, i) =
+              partitioner ? partitioner->global_to_local(index) : index;
+          }
+
+        const std::vector<Point<dim>> &points = unit_points_in[c];
+        for (unsigned int q = 0; q < points.size(); ++q)
+          {
+            point_to_cell_host(point + q) = c;
+            for (unsigned int d = 0; d < dim; ++d)
+              unit_points_host(point + q, d) = points[q][d];
+          }
+
+        if ((update_flags & update_gradients) && points.size() > 0)
+          {
+            FEValues<dim> fe_values(mapping,
+                                    fe,
+                                    Quadrature<dim>(points),
+                                    update_inverse_jacobians);
+            fe_values.reinit(cells[c]);
+            for (unsigned int q = 0; q < points.size(); ++q)
+              for (unsigned int d = 0; d < dim; ++d)
+                for (unsigned int e = 0; e < dim; ++e)
+                  inverse_jacobians_host(point + q, d, e) =
+                    fe_values.inverse_jacobian(q)[d][e];
+          }
+
+        point += points.size();
+      }
+
+    Kokkos::deep_copy(dof_indices, dof_indices_host);
+    Kokkos::deep_copy(point_to_cell, point_to_cell_host);
+    Kokkos::deep_copy(unit_points, unit_points_host);
+    Kokkos::deep_copy(inverse_jacobians, inverse_jacobians_host);
+  }
+
+
+
+  template <int dim, int fe_degree, typename Number>
+  inline unsigned int
+  FEPointEvaluation<dim, fe_degree, Number>::n_points() const
+  {
+    return point_to_cell.extent(0);
+  }
+
+
+
+  template <int dim, int fe_degree, typename Number>
+  void
+  FEPointEvaluation<dim, fe_degree, Number>::evaluate(
+    const VectorType                      &src,
+    const EvaluationFlags::EvaluationFlags evaluation_flags,
+    const ValueView                       &values,
+    const GradientView                    &gradients) const
+  {
+    const bool evaluate_values = evaluation_flags & EvaluationFlags::values;
+    const bool evaluate_gradients =
+      evaluation_flags & EvaluationFlags::gradients;
+    Assert(!evaluate_values || values.extent(0) == n_points(),
+           ExcDimensionMismatch(values.extent(0), n_points()));
+    Assert(!evaluate_gradients || gradients.extent(0) == n_points(),
+           ExcDimensionMismatch(gradients.extent(0), n_points()));
+    Assert(!evaluate_gradients || (update_flags & update_gradients),
+           ExcMessage("Gradients can only be evaluated if reinit() was "
+                      "called with update_gradients."));
+
+    // Copy the members into local variables so that the lambda captures
+    // the views by value rather than the this pointer
+    const auto    indices = dof_indices;
+    const auto    cell_of = point_to_cell;
+    const auto    points  = unit_points;
+    const auto    inv_jac = inverse_jacobians;
+    const auto    nodes   = support_points_1d;
+    const auto    weights = weights_1d;
+    const Number *src_ptr = src.get_values();
+
+    Kokkos::parallel_for(
+      "dealii::Portable::FEPointEvaluation::evaluate",
+      Kokkos::RangePolicy<memory_space::execution_space>(0, n_points()),
+      KOKKOS_LAMBDA(const int q) {
+        Number shape_values[dim][n_dofs_1d];
+        Number shape_derivatives[dim][n_dofs_1d];
+        for (int d = 0; d < dim; ++d)
+          internal::evaluate_lagrange_basis_1d<n_dofs_1d>(
+            nodes,
+            weights,
+            points(q, d),
+            shape_values[d],
+            shape_derivatives[d]);
+
+        const unsigned int cell  = cell_of(q);
+        Number             value = 0;
+        Number             reference_gradient[dim] = {};
+        internal::for_each_shape_function<dim, n_dofs_1d>(
+          shape_values,
+          shape_derivatives,
+          [&](const int i, const Number phi, const Number (&grad_phi)[dim]) {
+            const Number dof_value = src_ptr[indices(cell, i)];
+            value += dof_value * phi;
+            for (int d = 0; d < dim; ++d)
+              reference_gradient[d] += dof_value * grad_phi[d];
+          });
+
+        if (evaluate_values)
+          values(q) = value;
+        if (evaluate_gradients)
+          for (int e = 0; e < dim; ++e)
+            {
+              Number gradient = 0;
+              for (int d = 0; d < dim; ++d)
+                gradient += inv_jac(q, d, e) * reference_gradient[d];
+              gradients(q, e) = gradient;
+            }
+      });
+  }
+
+
+
+  template <int dim, int fe_degree, typename Number>
+  void
+  FEPointEvaluation<dim, fe_degree, Number>::integrate(
+    const ValueView                       &values,
+    const GradientView                    &gradients,
+    const EvaluationFlags::EvaluationFlags integration_flags,
+    VectorType                            &dst) const
+  {
+    const bool integrate_values = integration_flags & EvaluationFlags::values;
+    const bool integrate_gradients =
+      integration_flags & EvaluationFlags::gradients;
+    Assert(!integrate_values || values.extent(0) == n_points(),
+           ExcDimensionMismatch(values.extent(0), n_points()));
+    Assert(!integrate_gradients || gradients.extent(0) == n_points(),
+           ExcDimensionMismatch(gradients.extent(0), n_points()));
+    Assert(!integrate_gradients || (update_flags & update_gradients),
+           ExcMessage("Gradients can only be integrated if reinit() was "
+                      "called with update_gradients."));
+
+    const auto indices = dof_indices;
+    const auto cell_of = point_to_cell;
+    const auto points  = unit_points;
+    const auto inv_jac = inverse_jacobians;
+    const auto nodes   = support_points_1d;
+    const auto weights = weights_1d;
+    Number    *dst_ptr = dst.get_values();
+
+    Kokkos::parallel_for(
+      "dealii::Portable::FEPointEvaluation::integrate",
+      Kokkos::RangePolicy<memory_space::execution_space>(0, n_points()),
+      KOKKOS_LAMBDA(const int q) {
+        Number shape_values[dim][n_dofs_1d];
+        Number shape_derivatives[dim][n_dofs_1d];
+        for (int d = 0; d < dim; ++d)
+          internal::evaluate_lagrange_basis_1d<n_dofs_1d>(
+            nodes,
+            weights,
+            points(q, d),
+            shape_values[d],
+            shape_derivatives[d]);
+
+        const Number value = integrate_values ? values(q) : Number(0);
+
+        // Transform the gradient to reference coordinates, so that it can
+        // be tested by the reference gradients of the shape functions
+        Number reference_gradient[dim] = {};
+        if (integrate_gradients)
+          for (int d = 0; d < dim; ++d)
+            for (int e = 0; e < dim; ++e)
+              reference_gradient[d] += inv_jac(q, d, e) * gradients(q, e);
+
+        const unsigned int cell = cell_of(q);
+        internal::for_each_shape_function<dim, n_dofs_1d>(
+          shape_values,
+          shape_derivatives,
+          [&](const int i, const Number phi, const Number (&grad_phi)[dim]) {
+            Number contribution = value * phi;
+            for (int d = 0; d < dim; ++d)
+              contribution += reference_gradient[d] * grad_phi[d];
+            Kokkos::atomic_add(&dst_ptr[indices(cell, i)], contribution);
+          });
+      });
+  }
+
+#endif
+
+} // namespace Portable
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -149,6 +149,11 @@ namespace Portable
                unconstrained))) !=
         dealii::internal::MatrixFreeFunctions::ConstraintKinds::unconstrained;
 
+      // The mask is the same for all threads of the team, so we can skip the
+      // interpolation including the barriers for the whole team
+      if (!constrained_face)
+        return;
+
       Number tmp[n_q_points];
       Kokkos::parallel_for(
         Kokkos::TeamThreadRange(team_member, n_q_points),
@@ -295,6 +300,12 @@ namespace Portable
           dealii::internal::MatrixFreeFunctions::ConstraintKinds::edge_z;
       const auto constrained_face = constraint_mask & (face1 | face2 | edge);
 
+      // The mask is the same for all threads of the team, so we can skip the
+      // interpolation including the barriers for the whole team
+      if (constrained_face ==
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::unconstrained)
+        return;
+
       Number tmp[n_q_points];
       Kokkos::parallel_for(
         Kokkos::TeamThreadRange(team_member, n_q_points),
@@ -420,6 +431,12 @@ namespace Portable
                constraint_mask,
       ViewType values)
     {
+      // Uniform branch for all threads of the team: nothing to do on cells
+      // without hanging nodes
+      if (constraint_mask ==
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::unconstrained)
+        return;
+
       if constexpr (dim == 2)
         {
           interpolate_boundary_2d<fe_degree, 0, transpose>(team_member,
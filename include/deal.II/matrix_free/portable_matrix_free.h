@@ -37,6 +37,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <array>
+
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -80,6 +82,11 @@ namespace Portable
    * shape values, all it does is to cache the respective data. To implement
    * finite element operations, use the class Portable::FEEvaluation.
    *
+   * In addition, loop() runs over the cells, the inner faces, and the
+   * boundary faces, as needed for discontinuous Galerkin methods or for
+   * weakly imposed boundary conditions. The face operations are implemented
+   * with the class Portable::FEFaceEvaluation.
+   *
    * This class traverse the cells in a different order than the usual
    * Triangulation class in deal.II.
    *
@@ -106,22 +113,27 @@ namespace Portable
                        update_gradients | update_JxW_values |
                        update_quadrature_points,
                      const bool use_coloring                      = false,
-                     const bool overlap_communication_computation = false)
+                     const bool overlap_communication_computation = false,
+                     const UpdateFlags mapping_update_flags_boundary_faces =
+                       update_default,
+                     const UpdateFlags mapping_update_flags_inner_faces =
+                       update_default,
+                     const bool         group_cells_by_constraint_kind = false,
+                     const unsigned int cells_per_block                = 1,
+                     const bool         sort_cells_hierarchically      = false)
         : mapping_update_flags(mapping_update_flags)
+        , mapping_update_flags_boundary_faces(
+            mapping_update_flags_boundary_faces)
+        , mapping_update_flags_inner_faces(mapping_update_flags_inner_faces)
         , use_coloring(use_coloring)
         , overlap_communication_computation(overlap_communication_computation)
+        , group_cells_by_constraint_kind(group_cells_by_constraint_kind)
+        , cells_per_block(cells_per_block)
+        , sort_cells_hierarchically(sort_cells_hierarchically)
       {
-#ifndef DEAL_II_MPI_WITH_DEVICE_SUPPORT
-        AssertThrow(
-          overlap_communication_computation == false,
-          ExcMessage(
-            "Overlapping communication and computation requires device-aware MPI."));
-#endif
-        if (overlap_communication_computation == true)
-          AssertThrow(
-            use_coloring == false || overlap_communication_computation == false,
-            ExcMessage(
-              "Overlapping communication and coloring are incompatible options. Only one of them can be enabled."));
+        AssertThrow(cells_per_block > 0,
+                    ExcMessage("At least one cell has to be processed by "
+                               "each team."));
       }
       /**
        * This flag is used to determine which quantities should be cached. This
@@ -134,6 +146,26 @@ namespace Portable
        */
       UpdateFlags mapping_update_flags;
 
+      /**
+       * This flag determines the mapping data on boundary faces to be
+       * cached. If set to anything else than update_default, the data
+       * structures for loop() with a boundary face functor are set up. The
+       * quantities are computed at the tensor-product face quadrature points
+       * derived from the 1d quadrature formula passed to reinit(). Normal
+       * vectors and the face Jacobian determinants (JxW) are always cached
+       * for faces.
+       */
+      UpdateFlags mapping_update_flags_boundary_faces;
+
+      /**
+       * This flag determines the mapping data on interior faces to be
+       * cached. If set to anything else than update_default, the data
+       * structures for loop() with an inner face functor are set up. Only
+       * conforming faces, i.e., faces whose two adjacent cells are on the
+       * same refinement level, are supported.
+       */
+      UpdateFlags mapping_update_flags_inner_faces;
+
       /**
        * If true, use graph coloring. Otherwise, use atomic operations. Graph
        * coloring ensures bitwise reproducibility but is slower on Pascal and
@@ -142,10 +174,69 @@ namespace Portable
       bool use_coloring;
 
       /**
-       * Overlap MPI communications with computation. This requires device-aware
-       * MPI and use_coloring must be false.
+       * Overlap MPI communications with computation. The cells are split
+       * into the cells sharing a vertex with a ghost cell, which can only be
+       * computed once the ghost values of the source vector have arrived, and
+       * the interior cells, which are computed while the ghost exchange is
+       * in flight. With device-aware MPI, part of the interior cells is
+       * additionally deferred until the compression of the destination vector
+       * has been started. Without device-aware MPI, the data is staged
+       * through host buffers and the compression copies the whole
+       * destination vector back to the device, so only the ghost exchange is
+       * overlapped. If use_coloring is true, each of these groups of cells is
+       * colored separately.
        */
       bool overlap_communication_computation;
+
+      /**
+       * If true, the cells within each color are reordered such that cells
+       * with the same hanging-node configuration (the same
+       * internal::MatrixFreeFunctions::ConstraintKinds mask) are adjacent.
+       * Since consecutive cells are assigned to consecutive teams, teams
+       * scheduled together then take the same branches when resolving
+       * hanging-node constraints, and all unconstrained cells are processed
+       * in one contiguous range. This is beneficial on adaptively refined
+       * meshes with a large fraction of hanging cells. The order of the
+       * cells returned by get_colored_graph() reflects the reordering.
+       */
+      bool group_cells_by_constraint_kind;
+
+      /**
+       * Number of cells processed by one Kokkos team in cell_loop(). By
+       * default, every cell is assigned its own team, whose size is bounded
+       * by the number of degrees of freedom of a cell. For low polynomial
+       * degrees, these teams are too small to keep the device busy. With a
+       * value larger than one, consecutive cells are grouped into blocks
+       * that share a team: the scratch memory holds one tile per cell of the
+       * block and the tensor product kernels of Portable::FEEvaluation
+       * distribute the work of all cells of the block among the threads of
+       * the team.
+       *
+       * When more than one cell is processed per team, the @p cell argument
+       * of the cell functor is the index of the first cell of the block, and
+       * the scratch memory in Portable::SharedData holds the data of all
+       * cells of the block. Cell functors therefore must access the data
+       * through Portable::FEEvaluation only, and functors applied at the
+       * quadrature points must query the cell they work on with
+       * Portable::FEEvaluation::get_current_cell_index(). Face kernels are
+       * not affected by this setting.
+       */
+      unsigned int cells_per_block;
+
+      /**
+       * If true, the cells within each color are sorted in the hierarchical
+       * (Z-order, or Morton) order of their refinement tree, i.e., by their
+       * CellId, instead of the level-wise order of the active cell
+       * iterators. Cells assigned to consecutive teams are then close to
+       * each other in space and share many degrees of freedom, which improves
+       * the cache reuse in the gather and scatter phases, in particular
+       * without coloring, where all cells belong to a single color and the
+       * scatter is done with atomic operations. The ordering is applied
+       * before the cells are grouped by constraint kind. Combining this
+       * option with DoFRenumbering::hierarchical() also makes the unknowns
+       * of neighboring cells adjacent in memory.
+       */
+      bool sort_cells_hierarchically;
     };
 
     /**
@@ -234,6 +325,12 @@ namespace Portable
        */
       bool use_coloring;
 
+      /**
+       * Number of cells processed by one team, see
+       * AdditionalData::cells_per_block.
+       */
+      unsigned int cells_per_block;
+
       /**
        * Return the quadrature point index local. The index is
        * only unique for a given MPI process.
@@ -259,6 +356,117 @@ namespace Portable
       }
     };
 
+    /**
+     * Structure which is passed to the face kernels. It is the face
+     * counterpart of Data and contains, for each face, the information of the
+     * interior cell (index 0) and, for inner faces, of the exterior cell
+     * (index 1). The quadrature points of a face are numbered
+     * lexicographically in the tangential coordinate directions of the
+     * interior cell; the data of the exterior cell is stored in its own
+     * numbering and accessed through exterior_q_point_index.
+     */
+    struct FaceData
+    {
+      /**
+       * Map the position in the local vector to the position in the global
+       * vector for the cells on both sides of the face.
+       */
+      Kokkos::View<types::global_dof_index **,
+                   MemorySpace::Default::kokkos_space>
+        local_to_global[2];
+
+      /**
+       * Local number of the face within the cells on both sides.
+       */
+      Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>
+        face_number[2];
+
+      /**
+       * Kokkos::View of the quadrature points on the face.
+       */
+      Kokkos::View<point_type **, MemorySpace::Default::kokkos_space> q_points;
+
+      /**
+       * Kokkos::View of the inverse Jacobian of the cells on both sides,
+       * evaluated on the face.
+       */
+      Kokkos::View<Number **[dim][dim], MemorySpace::Default::kokkos_space>
+        inv_jacobian[2];
+
+      /**
+       * Kokkos::View of the face Jacobian determinant times the weights.
+       */
+      Kokkos::View<Number **, MemorySpace::Default::kokkos_space> JxW;
+
+      /**
+       * Kokkos::View of the normal vectors, pointing out of the interior
+       * cell.
+       */
+      Kokkos::View<Number **[dim], MemorySpace::Default::kokkos_space>
+        normal_vectors;
+
+      /**
+       * Index of the quadrature point in the numbering of the exterior cell
+       * that corresponds to a given quadrature point of the interior cell.
+       * Only set for inner faces.
+       */
+      Kokkos::View<unsigned int **, MemorySpace::Default::kokkos_space>
+        exterior_q_point_index;
+
+      /**
+       * Boundary id of the face. Only set for boundary faces.
+       */
+      Kokkos::View<types::boundary_id *, MemorySpace::Default::kokkos_space>
+        boundary_id;
+
+      /**
+       * Mask deciding where constraints are set on the cells on both sides.
+       */
+      Kokkos::View<dealii::internal::MatrixFreeFunctions::ConstraintKinds *,
+                   MemorySpace::Default::kokkos_space>
+        constraint_mask[2];
+
+      /**
+       * Values of the shape functions.
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space> shape_values;
+
+      /**
+       * Gradients of the shape functions.
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+        shape_gradients;
+
+      /**
+       * Gradients of the shape functions for collocation methods.
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+        co_shape_gradients;
+
+      /**
+       * Values and first derivatives of the 1d shape functions in the points
+       * zero and one, stored as [side][derivative][shape function].
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+        shape_data_on_face;
+
+      /**
+       * Weights used when resolving hanging nodes.
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+        constraint_weights;
+
+      /**
+       * Number of faces.
+       */
+      unsigned int n_faces;
+
+      /**
+       * Number of components.
+       */
+      unsigned int n_components;
+    };
+
     /**
      * Default constructor.
      */
@@ -270,6 +478,13 @@ namespace Portable
     unsigned int
     get_padding_length() const;
 
+    /**
+     * Return the number of cells processed by one team in cell_loop(), see
+     * AdditionalData::cells_per_block.
+     */
+    unsigned int
+    get_cells_per_block() const;
+
     /**
      * Extracts the information needed to perform loops over cells. The
      * DoFHandler and AffineConstraints objects describe the layout of
@@ -339,6 +554,65 @@ namespace Portable
               const VectorType &src,
               VectorType       &dst) const;
 
+    // clang-format off
+    /**
+     * This method runs the loop over all cells, all inner faces, and all
+     * boundary faces and applies the respective local operation on each of
+     * them in parallel. @p cell_func has the same signature as the functor
+     * passed to cell_loop(). The face functors @p face_func and
+     * @p boundary_face_func need to define
+     * \code
+     * DEAL_II_HOST_DEVICE void operator()(
+     *   const unsigned int                                          face,
+     *   const typename Portable::MatrixFree<dim, Number>::FaceData *face_data,
+     *   Portable::SharedData<dim, Number> *                         shared_data,
+     *   const Number *                                              src,
+     *   Number *                                                    dst) const;
+     *   static const unsigned int n_local_dofs;
+     * \endcode
+     * For inner faces, @p shared_data points to an array of two SharedData
+     * objects, the first for the interior and the second for the exterior
+     * cell; for boundary faces, only the first one is present. The functors
+     * are typically implemented with Portable::FEFaceEvaluation.
+     *
+     * The cell, inner face, and boundary face kernels are run one after
+     * another. Since faces share degrees of freedom with other faces and
+     * cells, the contributions of the faces are always added with atomic
+     * operations. The face data must have been requested through
+     * AdditionalData::mapping_update_flags_inner_faces and
+     * AdditionalData::mapping_update_flags_boundary_faces.
+     */
+    // clang-format on
+    template <typename CellFunctor,
+              typename FaceFunctor,
+              typename BoundaryFaceFunctor,
+              typename VectorType>
+    void
+    loop(const CellFunctor         &cell_func,
+         const FaceFunctor         &face_func,
+         const BoundaryFaceFunctor &boundary_face_func,
+         const VectorType          &src,
+         VectorType                &dst) const;
+
+    /**
+     * Return the FaceData structure of the inner faces if @p boundary_faces
+     * is false and of the boundary faces otherwise.
+     */
+    FaceData
+    get_face_data(const bool boundary_faces) const;
+
+    /**
+     * Return the number of inner faces handled by this process.
+     */
+    unsigned int
+    n_inner_faces() const;
+
+    /**
+     * Return the number of boundary faces handled by this process.
+     */
+    unsigned int
+    n_boundary_faces() const;
+
     /**
      * This method runs the loop over all cells and apply the local operation on
      * each element in parallel. This function is very similar to cell_loop()
@@ -417,6 +691,13 @@ namespace Portable
     memory_consumption() const;
 
   private:
+    /**
+     * Return the number of teams needed to process the cells of @p color,
+     * see AdditionalData::cells_per_block.
+     */
+    unsigned int
+    get_n_cell_blocks(const unsigned int color) const;
+
     /**
      * Initializes the data structures.
      */
@@ -440,6 +721,20 @@ namespace Portable
                      const VectorType &src,
                      VectorType       &dst) const;
 
+    /**
+     * Helper function. Run the cell kernels of all colors followed by the
+     * kernels on the inner and boundary faces on the given vector entries.
+     */
+    template <typename CellFunctor,
+              typename FaceFunctor,
+              typename BoundaryFaceFunctor>
+    void
+    apply_cell_and_face_kernels(const CellFunctor         &cell_func,
+                                const FaceFunctor         &face_func,
+                                const BoundaryFaceFunctor &boundary_face_func,
+                                Number *const              src,
+                                Number                    *dst) const;
+
     /**
      * Helper function. Loop over all the cells and apply the functor on each
      * element in parallel. This function is used when MPI is used.
@@ -466,11 +761,24 @@ namespace Portable
     bool use_coloring;
 
     /**
-     *  Overlap MPI communications with computation. This requires device-aware
-     *  MPI and use_coloring must be false.
+     *  Overlap MPI communications with computation.
      */
     bool overlap_communication_computation;
 
+    /**
+     * If communication and computation are overlapped, the colors
+     * <tt>[overlap_phase_begin[p], overlap_phase_begin[p+1])</tt> are
+     * executed in phase <tt>p</tt> of distributed_cell_loop(): phase 0 while
+     * the ghost values of the source vector are exchanged, phase 1 once they
+     * have arrived, and phase 2 while the destination vector is compressed.
+     */
+    std::array<unsigned int, 4> overlap_phase_begin;
+
+    /**
+     * Number of cells processed by one team in cell_loop().
+     */
+    unsigned int cells_per_block;
+
     /**
      * Total number of degrees of freedom.
      */
@@ -582,6 +890,18 @@ namespace Portable
     Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
       constraint_weights;
 
+    /**
+     * Values and first derivatives of the 1d shape functions in the points
+     * zero and one.
+     */
+    Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+      shape_data_on_face;
+
+    /**
+     * Data of the inner faces (index 0) and of the boundary faces (index 1).
+     */
+    FaceData face_data[2];
+
     /**
      * Shared pointer to a Partitioner for distributed Vectors used in
      * cell_loop. When MPI is not used the pointer is null.
@@ -629,14 +949,20 @@ namespace Portable
       Number ***,
       MemorySpace::Default::kokkos_space::execution_space::scratch_memory_space,
       Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+    using SharedViewTemporary = Kokkos::View<
+      Number *,
+      MemorySpace::Default::kokkos_space::execution_space::scratch_memory_space,
+      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
 
     DEAL_II_HOST_DEVICE
     SharedData(const TeamHandle          &team_member,
                const SharedViewValues    &values,
-               const SharedViewGradients &gradients)
+               const SharedViewGradients &gradients,
+               const SharedViewTemporary &temporary = SharedViewTemporary())
       : team_member(team_member)
       , values(values)
       , gradients(gradients)
+      , temporary(temporary)
     {}
 
     /**
@@ -653,6 +979,13 @@ namespace Portable
      * Memory for computed gradients in reference coordinate system.
      */
     SharedViewGradients gradients;
+
+    /**
+     * Memory for intermediate results of the tensor product kernels. It is
+     * only allocated if several cells are processed by one team, see
+     * MatrixFree::AdditionalData::cells_per_block.
+     */
+    SharedViewTemporary temporary;
   };
 
 
@@ -27,14 +27,19 @@
 #include <deal.II/fe/fe_values.h>
 #include <deal.II/fe/mapping_q1.h>
 
+#include <deal.II/grid/cell_id.h>
+
 #include <deal.II/matrix_free/portable_hanging_nodes_internal.h>
 #include <deal.II/matrix_free/portable_matrix_free.h>
 #include <deal.II/matrix_free/shape_info.h>
 
 #include <Kokkos_Core.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
+#include <limits>
+#include <memory>
 #include <string>
 
 
@@ -64,6 +69,12 @@ namespace Portable
       void
       resize(const unsigned int n_colors);
 
+      template <typename CellFilter>
+      void
+      sort_by_constraint_kind(
+        std::vector<CellFilter>                                  &graph,
+        const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner);
+
       template <typename CellFilter>
       void
       fill_data(
@@ -71,6 +82,17 @@ namespace Portable
         const std::vector<CellFilter>                            &graph,
         const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner);
 
+      template <typename CellFilter>
+      void
+      fill_face_data(
+        const Mapping<dim>                                       &mapping,
+        const FiniteElement<dim, dim>                            &fe,
+        const Quadrature<1>                                      &quad,
+        const std::vector<std::vector<CellFilter>>               &graph,
+        const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+        const bool                                                inner_faces,
+        const bool boundary_faces);
+
     private:
       MatrixFree<dim, Number> *data;
       // Local buffer
@@ -148,6 +170,53 @@ namespace Portable
 
 
 
+    template <int dim, typename Number>
+    template <typename CellFilter>
+    void
+    ReinitHelper<dim, Number>::sort_by_constraint_kind(
+      std::vector<CellFilter>                                  &graph,
+      const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner)
+    {
+      using ConstraintKinds =
+        dealii::internal::MatrixFreeFunctions::ConstraintKinds;
+
+      std::vector<std::pair<std::uint16_t, unsigned int>> mask_and_index(
+        graph.size());
+      for (unsigned int cell_id = 0; cell_id < graph.size(); ++cell_id)
+        {
+          graph[cell_id]->get_dof_indices(local_dof_indices);
+          if (partitioner)
+            for (auto &index : local_dof_indices)
+              index = partitioner->global_to_local(index);
+
+          for (unsigned int i = 0; i < dofs_per_cell; ++i)
+            lexicographic_dof_indices[i] =
+              local_dof_indices[lexicographic_inv[i]];
+
+          ConstraintKinds mask = ConstraintKinds::unconstrained;
+          hanging_nodes.setup_constraints(graph[cell_id],
+                                          partitioner,
+                                          {lexicographic_inv},
+                                          lexicographic_dof_indices,
+                                          ArrayView<ConstraintKinds>(mask));
+
+          mask_and_index[cell_id] = {static_cast<std::uint16_t>(mask),
+                                     cell_id};
+        }
+
+      // Sort by the mask and keep the original order within a group to
+      // preserve the data locality of the cell ordering
+      std::sort(mask_and_index.begin(), mask_and_index.end());
+
+      std::vector<CellFilter> sorted_graph;
+      sorted_graph.reserve(graph.size());
+      for (const auto &[mask, cell_id] : mask_and_index)
+        sorted_graph.push_back(graph[cell_id]);
+      graph.swap(sorted_graph);
+    }
+
+
+
     template <int dim, typename Number>
     template <typename CellFilter>
     void
@@ -300,6 +369,341 @@ namespace Portable
 
 
 
+    template <int dim, typename Number>
+    template <typename CellFilter>
+    void
+    ReinitHelper<dim, Number>::fill_face_data(
+      const Mapping<dim>                                       &mapping,
+      const FiniteElement<dim, dim>                            &fe,
+      const Quadrature<1>                                      &quad,
+      const std::vector<std::vector<CellFilter>>               &graph,
+      const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+      const bool                                                inner_faces,
+      const bool                                                boundary_faces)
+    {
+      using CellIterator = typename DoFHandler<dim>::active_cell_iterator;
+
+      const unsigned int n_q_points_1d   = quad.size();
+      const unsigned int n_q_points_face = Utilities::pow(n_q_points_1d,
+                                                          dim - 1);
+
+      // Set up one FEValues object per face number. The quadrature points
+      // are numbered lexicographically in the tangential directions, with
+      // the lowest coordinate direction running fastest, which is the
+      // ordering used by the tensor product kernels in dim-1 dimensions.
+      std::vector<std::unique_ptr<FEValues<dim>>> fe_face_values;
+      for (const unsigned int face_no : GeometryInfo<dim>::face_indices())
+        {
+          const unsigned int normal_direction = face_no / 2;
+          std::vector<Point<dim>> points(n_q_points_face);
+          std::vector<double>     weights(n_q_points_face, 1.);
+          for (unsigned int q = 0; q < n_q_points_face; ++q)
+            {
+              unsigned int index = q;
+              for (unsigned int d = 0; d < dim; ++d)
+                if (d == normal_direction)
+                  points[q][d] = face_no % 2;
+                else
+                  {
+                    points[q][d] = quad.point(index % n_q_points_1d)[0];
+                    weights[q] *= quad.weight(index % n_q_points_1d);
+                    index /= n_q_points_1d;
+                  }
+            }
+          fe_face_values.push_back(std::make_unique<FEValues<dim>>(
+            mapping,
+            fe,
+            Quadrature<dim>(points, weights),
+            update_jacobians | update_inverse_jacobians |
+              update_quadrature_points));
+        }
+
+      // Collect the faces. Inner faces are assigned to the cell with the
+      // lower CellId if both cells are owned by the same process and to the
+      // process with the lower rank otherwise, so that every face is visited
+      // exactly once.
+      std::vector<std::pair<CellIterator, unsigned int>> inner_face_list,
+        boundary_face_list;
+      for (const auto &color : graph)
+        for (const auto &filtered_cell : color)
+          {
+            const CellIterator cell = filtered_cell;
+            for (const unsigned int f : cell->face_indices())
+              if (cell->at_boundary(f))
+                {
+                  AssertThrow(
+                    cell->has_periodic_neighbor(f) == false,
+                    ExcNotImplemented(
+                      "Periodic faces are not supported by the face loops "
+                      "of Portable::MatrixFree."));
+                  if (boundary_faces)
+                    boundary_face_list.emplace_back(cell, f);
+                }
+              else if (inner_faces)
+                {
+                  AssertThrow(
+                    cell->neighbor(f)->has_children() == false &&
+                      cell->neighbor_is_coarser(f) == false,
+                    ExcNotImplemented(
+                      "Faces between cells on different refinement levels "
+                      "are not supported by the face loops of "
+                      "Portable::MatrixFree."));
+                  const CellIterator neighbor = cell->neighbor(f);
+                  Assert(neighbor->is_artificial() == false,
+                         ExcInternalError());
+                  if (neighbor->subdomain_id() == cell->subdomain_id() ?
+                        cell->id() < neighbor->id() :
+                        cell->subdomain_id() < neighbor->subdomain_id())
+                    inner_face_list.emplace_back(cell, f);
+                }
+          }
+
+      const auto fill = [&](const std::vector<std::pair<CellIterator,
+                                                        unsigned int>> &faces,
+                            const bool is_boundary) {
+        typename MatrixFree<dim, Number>::FaceData &face_data =
+          data->face_data[is_boundary ? 1 : 0];
+
+        const unsigned int n_faces = faces.size();
+        const unsigned int n_sides = is_boundary ? 1 : 2;
+        face_data.n_faces          = n_faces;
+        face_data.n_components     = n_components;
+
+        face_data.q_points =
+          Kokkos::View<Point<dim, Number> **,
+                       MemorySpace::Default::kokkos_space>(
+            Kokkos::view_alloc("face_q_points", Kokkos::WithoutInitializing),
+            n_faces,
+            n_q_points_face);
+        face_data.JxW =
+          Kokkos::View<Number **, MemorySpace::Default::kokkos_space>(
+            Kokkos::view_alloc("face_JxW", Kokkos::WithoutInitializing),
+            n_faces,
+            n_q_points_face);
+        face_data.normal_vectors =
+          Kokkos::View<Number **[dim], MemorySpace::Default::kokkos_space>(
+            Kokkos::view_alloc("face_normal_vectors",
+                               Kokkos::WithoutInitializing),
+            n_faces,
+            n_q_points_face);
+        if (is_boundary)
+          face_data.boundary_id =
+            Kokkos::View<types::boundary_id *,
+                         MemorySpace::Default::kokkos_space>(
+              Kokkos::view_alloc("face_boundary_id",
+                                 Kokkos::WithoutInitializing),
+              n_faces);
+        else
+          face_data.exterior_q_point_index =
+            Kokkos::View<unsigned int **, MemorySpace::Default::kokkos_space>(
+              Kokkos::view_alloc("face_exterior_q_point_index",
+                                 Kokkos::WithoutInitializing),
+              n_faces,
+              n_q_points_face);
+        for (unsigned int side = 0; side < n_sides; ++side)
+          {
+            const std::string suffix = "_" + std::to_string(side);
+            face_data.local_to_global[side] =
+              Kokkos::View<types::global_dof_index **,
+                           MemorySpace::Default::kokkos_space>(
+                Kokkos::view_alloc("face_local_to_global" + suffix,
+                                   Kokkos::WithoutInitializing),
+                n_faces,
+                dofs_per_cell);
+            face_data.face_number[side] =
+              Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>(
+                Kokkos::view_alloc("face_number" + suffix,
+                                   Kokkos::WithoutInitializing),
+                n_faces);
+            face_data.inv_jacobian[side] =
+              Kokkos::View<Number **[dim][dim],
+                           MemorySpace::Default::kokkos_space>(
+                Kokkos::view_alloc("face_inv_jacobian" + suffix,
+                                   Kokkos::WithoutInitializing),
+                n_faces,
+                n_q_points_face);
+            // Initialize to zero, i.e., unconstrained cell
+            face_data.constraint_mask[side] =
+              Kokkos::View<
+                dealii::internal::MatrixFreeFunctions::ConstraintKinds *,
+                MemorySpace::Default::kokkos_space>("face_constraint_mask" +
+                                                      suffix,
+                                                    n_faces);
+          }
+
+        auto q_points_host = Kokkos::create_mirror_view(face_data.q_points);
+        auto JxW_host      = Kokkos::create_mirror_view(face_data.JxW);
+        auto normal_vectors_host =
+          Kokkos::create_mirror_view(face_data.normal_vectors);
+        auto boundary_id_host =
+          Kokkos::create_mirror_view(face_data.boundary_id);
+        auto exterior_q_point_index_host =
+          Kokkos::create_mirror_view(face_data.exterior_q_point_index);
+        std::array<decltype(Kokkos::create_mirror_view(
+                     face_data.local_to_global[0])),
+                   2>
+          local_to_global_host;
+        std::array<decltype(Kokkos::create_mirror_view(
+                     face_data.face_number[0])),
+                   2>
+          face_number_host;
+        std::array<decltype(Kokkos::create_mirror_view(
+                     face_data.inv_jacobian[0])),
+                   2>
+          inv_jacobian_host;
+        std::array<decltype(Kokkos::create_mirror_view(
+                     face_data.constraint_mask[0])),
+                   2>
+          constraint_mask_host;
+        for (unsigned int side = 0; side < n_sides; ++side)
+          {
+            local_to_global_host[side] =
+              Kokkos::create_mirror_view(face_data.local_to_global[side]);
+            face_number_host[side] =
+              Kokkos::create_mirror_view(face_data.face_number[side]);
+            inv_jacobian_host[side] =
+              Kokkos::create_mirror_view(face_data.inv_jacobian[side]);
+            constraint_mask_host[side] =
+              Kokkos::create_mirror_view(face_data.constraint_mask[side]);
+          }
+
+        std::vector<Point<dim>> interior_points(n_q_points_face);
+        for (unsigned int face_id = 0; face_id < n_faces; ++face_id)
+          {
+            for (unsigned int side = 0; side < n_sides; ++side)
+              {
+                const CellIterator cell =
+                  side == 0 ? faces[face_id].first :
+                              CellIterator(faces[face_id].first->neighbor(
+                                faces[face_id].second));
+                const unsigned int face_no =
+                  side == 0 ? faces[face_id].second :
+                              faces[face_id].first->neighbor_face_no(
+                                faces[face_id].second);
+                face_number_host[side](face_id) = face_no;
+
+                cell->get_dof_indices(local_dof_indices);
+                if (partitioner)
+                  for (auto &index : local_dof_indices)
+                    index = partitioner->global_to_local(index);
+
+                for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                  lexicographic_dof_indices[i] =
+                    local_dof_indices[lexicographic_inv[i]];
+
+                const ArrayView<
+                  dealii::internal::MatrixFreeFunctions::ConstraintKinds>
+                  mask_view(constraint_mask_host[side][face_id]);
+                hanging_nodes.setup_constraints(cell,
+                                                partitioner,
+                                                {lexicographic_inv},
+                                                lexicographic_dof_indices,
+                                                mask_view);
+
+                for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                  local_to_global_host[side](face_id, i) =
+                    lexicographic_dof_indices[i];
+
+                FEValues<dim> &fe_values = *fe_face_values[face_no];
+                fe_values.reinit(cell);
+
+                for (unsigned int q = 0; q < n_q_points_face; ++q)
+                  for (unsigned int d = 0; d < dim; ++d)
+                    for (unsigned int e = 0; e < dim; ++e)
+                      inv_jacobian_host[side](face_id, q, d, e) =
+                        fe_values.inverse_jacobian(q)[d][e];
+
+                if (side == 0)
+                  {
+                    const unsigned int normal_direction = face_no / 2;
+                    const double       sign = (face_no % 2 == 0) ? -1. : 1.;
+                    for (unsigned int q = 0; q < n_q_points_face; ++q)
+                      {
+                        // Nanson's formula: the normal is the transformed
+                        // reference normal, and the ratio of the surface
+                        // elements is its length times the Jacobian
+                        // determinant.
+                        const DerivativeForm<1, dim, dim> &inv_jac =
+                          fe_values.inverse_jacobian(q);
+                        Tensor<1, dim> normal;
+                        for (unsigned int d = 0; d < dim; ++d)
+                          normal[d] = sign * inv_jac[normal_direction][d];
+                        const double norm = normal.norm();
+
+                        q_points_host(face_id, q) =
+                          fe_values.quadrature_point(q);
+                        interior_points[q] = fe_values.quadrature_point(q);
+                        JxW_host(face_id, q) =
+                          std::abs(fe_values.jacobian(q).determinant()) *
+                          norm * fe_values.get_quadrature().weight(q);
+                        for (unsigned int d = 0; d < dim; ++d)
+                          normal_vectors_host(face_id, q, d) =
+                            normal[d] / norm;
+                      }
+                    if (is_boundary)
+                      boundary_id_host(face_id) =
+                        cell->face(face_no)->boundary_id();
+                  }
+                else
+                  {
+                    // Match the quadrature points of the exterior cell with
+                    // the ones of the interior cell, which accounts for all
+                    // possible orientations of the neighbor.
+                    for (unsigned int q = 0; q < n_q_points_face; ++q)
+                      {
+                        unsigned int best_index    = 0;
+                        double       best_distance = std::numeric_limits<
+                          double>::max();
+                        for (unsigned int qe = 0; qe < n_q_points_face; ++qe)
+                          {
+                            const double distance =
+                              interior_points[q].distance_square(
+                                fe_values.quadrature_point(qe));
+                            if (distance < best_distance)
+                              {
+                                best_distance = distance;
+                                best_index    = qe;
+                              }
+                          }
+                        exterior_q_point_index_host(face_id, q) = best_index;
+                      }
+                  }
+              }
+          }
+
+        Kokkos::deep_copy(face_data.q_points, q_points_host);
+        Kokkos::deep_copy(face_data.JxW, JxW_host);
+        Kokkos::deep_copy(face_data.normal_vectors, normal_vectors_host);
+        if (is_boundary)
+          Kokkos::deep_copy(face_data.boundary_id, boundary_id_host);
+        else
+          Kokkos::deep_copy(face_data.exterior_q_point_index,
+                            exterior_q_point_index_host);
+        for (unsigned int side = 0; side < n_sides; ++side)
+          {
+            Kokkos::deep_copy(face_data.local_to_global[side],
+                              local_to_global_host[side]);
+            Kokkos::deep_copy(face_data.face_number[side],
+                              face_number_host[side]);
+            Kokkos::deep_copy(face_data.inv_jacobian[side],
+                              inv_jacobian_host[side]);
+            Kokkos::deep_copy(face_data.constraint_mask[side],
+                              constraint_mask_host[side]);
+          }
+
+        face_data.shape_values       = data->shape_values;
+        face_data.shape_gradients    = data->shape_gradients;
+        face_data.co_shape_gradients = data->co_shape_gradients;
+        face_data.shape_data_on_face = data->shape_data_on_face;
+        face_data.constraint_weights = data->constraint_weights;
+      };
+
+      fill(inner_face_list, false);
+      fill(boundary_face_list, true);
+    }
+
+
+
     template <int dim, typename number>
     std::vector<types::global_dof_index>
     get_conflict_indices(
@@ -317,6 +721,25 @@ namespace Portable
 
 
 
+    template <typename CellFilter>
+    void
+    sort_cells_hierarchically(std::vector<CellFilter> &cells)
+    {
+      std::vector<std::pair<CellId, unsigned int>> id_and_index(cells.size());
+      for (unsigned int i = 0; i < cells.size(); ++i)
+        id_and_index[i] = {cells[i]->id(), i};
+
+      std::sort(id_and_index.begin(), id_and_index.end());
+
+      std::vector<CellFilter> sorted_cells;
+      sorted_cells.reserve(cells.size());
+      for (const auto &[id, index] : id_and_index)
+        sorted_cells.push_back(cells[index]);
+      cells.swap(sorted_cells);
+    }
+
+
+
     template <typename VectorType>
     struct VectorLocalSize
     {
@@ -344,6 +767,8 @@ namespace Portable
                      MemorySpace::Default::kokkos_space::execution_space::
                        scratch_memory_space,
                      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+      using SharedViewTemporary =
+        typename SharedData<dim, Number>::SharedViewTemporary;
 
       ApplyKernel(Functor                                      func,
                   const typename MatrixFree<dim, Number>::Data gpu_data,
@@ -362,15 +787,21 @@ namespace Portable
 
 
       // Provide the shared memory capacity. This function takes the team_size
-      // as an argument, which allows team_size dependent allocations.
+      // as an argument, which allows team_size dependent allocations. Each
+      // cell of a block is given its own tile of n_local_dofs entries; the
+      // temporary array is only needed if a team works on several cells.
       size_t
       team_shmem_size(int /*team_size*/) const
       {
-        return SharedViewValues::shmem_size(Functor::n_local_dofs,
+        const unsigned int n_entries =
+          gpu_data.cells_per_block * Functor::n_local_dofs;
+        return SharedViewValues::shmem_size(n_entries,
                                             gpu_data.n_components) +
-               SharedViewGradients::shmem_size(Functor::n_local_dofs,
+               SharedViewGradients::shmem_size(n_entries,
                                                dim,
-                                               gpu_data.n_components);
+                                               gpu_data.n_components) +
+               SharedViewTemporary::shmem_size(
+                 gpu_data.cells_per_block > 1 ? n_entries : 0);
       }
 
 
@@ -378,17 +809,120 @@ namespace Portable
       void
       operator()(const TeamHandle &team_member) const
       {
+        const unsigned int n_entries =
+          gpu_data.cells_per_block * Functor::n_local_dofs;
+
         // Get the scratch memory
         SharedViewValues    values(team_member.team_shmem(),
-                                Functor::n_local_dofs,
+                                n_entries,
                                 gpu_data.n_components);
         SharedViewGradients gradients(team_member.team_shmem(),
-                                      Functor::n_local_dofs,
+                                      n_entries,
                                       dim,
                                       gpu_data.n_components);
+        SharedViewTemporary temporary(team_member.team_shmem(),
+                                      gpu_data.cells_per_block > 1 ? n_entries :
+                                                                     0);
+
+        SharedData<dim, Number> shared_data(team_member,
+                                            values,
+                                            gradients,
+                                            temporary);
+        func(team_member.league_rank() * gpu_data.cells_per_block,
+             &gpu_data,
+             &shared_data,
+             src,
+             dst);
+      }
+    };
+
+
 
-        SharedData<dim, Number> shared_data(team_member, values, gradients);
-        func(team_member.league_rank(), &gpu_data, &shared_data, src, dst);
+    template <int dim, typename Number, typename Functor, bool is_boundary>
+    struct ApplyFaceKernel
+    {
+      using TeamHandle = Kokkos::TeamPolicy<
+        MemorySpace::Default::kokkos_space::execution_space>::member_type;
+      using SharedViewValues =
+        Kokkos::View<Number **,
+                     MemorySpace::Default::kokkos_space::execution_space::
+                       scratch_memory_space,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+      using SharedViewGradients =
+        Kokkos::View<Number ***,
+                     MemorySpace::Default::kokkos_space::execution_space::
+                       scratch_memory_space,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+      static constexpr unsigned int n_sides = is_boundary ? 1 : 2;
+
+      ApplyFaceKernel(Functor                                          func,
+                      const typename MatrixFree<dim, Number>::FaceData face_data,
+                      Number *const                                    src,
+                      Number                                          *dst)
+        : func(func)
+        , face_data(face_data)
+        , src(src)
+        , dst(dst)
+      {}
+
+      Functor                                          func;
+      const typename MatrixFree<dim, Number>::FaceData face_data;
+      Number *const                                    src;
+      Number                                          *dst;
+
+
+      // Provide the shared memory capacity, which is the same as for a cell
+      // for each side of the face.
+      size_t
+      team_shmem_size(int /*team_size*/) const
+      {
+        return n_sides *
+               (SharedViewValues::shmem_size(Functor::n_local_dofs,
+                                             face_data.n_components) +
+                SharedViewGradients::shmem_size(Functor::n_local_dofs,
+                                                dim,
+                                                face_data.n_components));
+      }
+
+
+      DEAL_II_HOST_DEVICE
+      void
+      operator()(const TeamHandle &team_member) const
+      {
+        // Get the scratch memory
+        SharedViewValues    values_in(team_member.team_shmem(),
+                                   Functor::n_local_dofs,
+                                   face_data.n_components);
+        SharedViewGradients gradients_in(team_member.team_shmem(),
+                                         Functor::n_local_dofs,
+                                         dim,
+                                         face_data.n_components);
+        if constexpr (is_boundary)
+          {
+            SharedData<dim, Number> shared_data(team_member,
+                                                values_in,
+                                                gradients_in);
+            func(
+              team_member.league_rank(), &face_data, &shared_data, src, dst);
+          }
+        else
+          {
+            SharedViewValues    values_out(team_member.team_shmem(),
+                                        Functor::n_local_dofs,
+                                        face_data.n_components);
+            SharedViewGradients gradients_out(team_member.team_shmem(),
+                                              Functor::n_local_dofs,
+                                              dim,
+                                              face_data.n_components);
+
+            SharedData<dim, Number> shared_data[2] = {
+              SharedData<dim, Number>(team_member, values_in, gradients_in),
+              SharedData<dim, Number>(team_member,
+                                      values_out,
+                                      gradients_out)};
+            func(team_member.league_rank(), &face_data, shared_data, src, dst);
+          }
       }
     };
   } // namespace internal
@@ -398,10 +932,15 @@ namespace Portable
   template <int dim, typename Number>
   MatrixFree<dim, Number>::MatrixFree()
     : my_id(-1)
+    , overlap_phase_begin{{0, 0, 0, 0}}
+    , cells_per_block(1)
     , n_dofs(0)
     , padding_length(0)
     , dof_handler(nullptr)
-  {}
+  {
+    face_data[0].n_faces = 0;
+    face_data[1].n_faces = 0;
+  }
 
 
 
@@ -474,6 +1013,24 @@ namespace Portable
 
 
 
+  template <int dim, typename Number>
+  unsigned int
+  MatrixFree<dim, Number>::get_cells_per_block() const
+  {
+    return cells_per_block;
+  }
+
+
+
+  template <int dim, typename Number>
+  unsigned int
+  MatrixFree<dim, Number>::get_n_cell_blocks(const unsigned int color) const
+  {
+    return (n_cells[color] + cells_per_block - 1) / cells_per_block;
+  }
+
+
+
   template <int dim, typename Number>
   typename MatrixFree<dim, Number>::Data
   MatrixFree<dim, Number>::get_data(unsigned int color) const
@@ -496,12 +1053,40 @@ namespace Portable
     data_copy.padding_length     = padding_length;
     data_copy.row_start          = row_start[color];
     data_copy.use_coloring       = use_coloring;
+    data_copy.cells_per_block    = cells_per_block;
 
     return data_copy;
   }
 
 
 
+  template <int dim, typename Number>
+  typename MatrixFree<dim, Number>::FaceData
+  MatrixFree<dim, Number>::get_face_data(const bool boundary_faces) const
+  {
+    return face_data[boundary_faces ? 1 : 0];
+  }
+
+
+
+  template <int dim, typename Number>
+  unsigned int
+  MatrixFree<dim, Number>::n_inner_faces() const
+  {
+    return face_data[0].n_faces;
+  }
+
+
+
+  template <int dim, typename Number>
+  unsigned int
+  MatrixFree<dim, Number>::n_boundary_faces() const
+  {
+    return face_data[1].n_faces;
+  }
+
+
+
   template <int dim, typename Number>
   template <typename VectorType>
   void
@@ -603,6 +1188,155 @@ namespace Portable
 
 
 
+  template <int dim, typename Number>
+  template <typename CellFunctor,
+            typename FaceFunctor,
+            typename BoundaryFaceFunctor,
+            typename VectorType>
+  void
+  MatrixFree<dim, Number>::loop(const CellFunctor         &cell_func,
+                                const FaceFunctor         &face_func,
+                                const BoundaryFaceFunctor &boundary_face_func,
+                                const VectorType          &src,
+                                VectorType                &dst) const
+  {
+    if (partitioner)
+      {
+        if constexpr (std::is_same_v<VectorType,
+                                     LinearAlgebra::distributed::
+                                       Vector<Number, MemorySpace::Default>>)
+          {
+            // Faces access the degrees of freedom of ghost cells, so both
+            // the import of the source and the export of the destination
+            // are needed. In case we have compatible partitioners, we can
+            // simply use the provided vectors.
+            if (src.get_partitioner().get() == partitioner.get() &&
+                dst.get_partitioner().get() == partitioner.get())
+              {
+                src.update_ghost_values();
+                apply_cell_and_face_kernels(cell_func,
+                                            face_func,
+                                            boundary_face_func,
+                                            src.get_values(),
+                                            dst.get_values());
+                dst.compress(VectorOperation::add);
+                src.zero_out_ghost_values();
+              }
+            else
+              {
+                LinearAlgebra::distributed::Vector<Number,
+                                                   MemorySpace::Default>
+                  ghosted_src(partitioner);
+                LinearAlgebra::distributed::Vector<Number,
+                                                   MemorySpace::Default>
+                  ghosted_dst(ghosted_src);
+                ghosted_src = src;
+                ghosted_dst = dst;
+                ghosted_dst.zero_out_ghost_values();
+
+                apply_cell_and_face_kernels(cell_func,
+                                            face_func,
+                                            boundary_face_func,
+                                            ghosted_src.get_values(),
+                                            ghosted_dst.get_values());
+
+                ghosted_dst.compress(VectorOperation::add);
+                dst = ghosted_dst;
+              }
+          }
+        else
+          {
+            // Other vector types do not provide ghost entries
+            AssertThrow(false, ExcNotImplemented());
+          }
+      }
+    else
+      apply_cell_and_face_kernels(cell_func,
+                                  face_func,
+                                  boundary_face_func,
+                                  src.get_values(),
+                                  dst.get_values());
+  }
+
+
+
+  template <int dim, typename Number>
+  template <typename CellFunctor,
+            typename FaceFunctor,
+            typename BoundaryFaceFunctor>
+  void
+  MatrixFree<dim, Number>::apply_cell_and_face_kernels(
+    const CellFunctor         &cell_func,
+    const FaceFunctor         &face_func,
+    const BoundaryFaceFunctor &boundary_face_func,
+    Number *const              src,
+    Number                    *dst) const
+  {
+    MemorySpace::Default::kokkos_space::execution_space exec;
+
+    for (unsigned int color = 0; color < n_colors; ++color)
+      if (n_cells[color] > 0)
+        {
+          Kokkos::TeamPolicy<
+            MemorySpace::Default::kokkos_space::execution_space>
+            team_policy(
+#if KOKKOS_VERSION >= 20900
+              exec,
+#endif
+              get_n_cell_blocks(color),
+              Kokkos::AUTO);
+
+          internal::ApplyKernel<dim, Number, CellFunctor> apply_kernel(
+            cell_func, get_data(color), src, dst);
+
+          Kokkos::parallel_for("dealii::MatrixFree::loop_cells_" +
+                                 std::to_string(color),
+                               team_policy,
+                               apply_kernel);
+        }
+
+    if (face_data[0].n_faces > 0)
+      {
+        Kokkos::TeamPolicy<MemorySpace::Default::kokkos_space::execution_space>
+          team_policy(
+#if KOKKOS_VERSION >= 20900
+            exec,
+#endif
+            face_data[0].n_faces,
+            Kokkos::AUTO);
+
+        internal::ApplyFaceKernel<dim, Number, FaceFunctor, false>
+          apply_kernel(face_func, face_data[0], src, dst);
+
+        Kokkos::parallel_for("dealii::MatrixFree::loop_inner_faces",
+                             team_policy,
+                             apply_kernel);
+      }
+
+    if (face_data[1].n_faces > 0)
+      {
+        Kokkos::TeamPolicy<MemorySpace::Default::kokkos_space::execution_space>
+          team_policy(
+#if KOKKOS_VERSION >= 20900
+            exec,
+#endif
+            face_data[1].n_faces,
+            Kokkos::AUTO);
+
+        internal::ApplyFaceKernel<dim, Number, BoundaryFaceFunctor, true>
+          apply_kernel(boundary_face_func, face_data[1], src, dst);
+
+        Kokkos::parallel_for("dealii::MatrixFree::loop_boundary_faces",
+                             team_policy,
+                             apply_kernel);
+      }
+
+    // The ghost exchange must not start before all kernels are done.
+    Kokkos::fence();
+  }
+
+
+
   template <int dim, typename Number>
   template <typename Functor>
   void
@@ -651,6 +1385,22 @@ namespace Portable
                  n_cells[i] * sizeof(unsigned int);
       }
 
+    // For the inner and boundary faces, add the data of both sides and the
+    // common face geometry.
+    const unsigned int n_q_points_face =
+      Utilities::pow(fe_degree + 1, dim - 1);
+    for (unsigned int i = 0; i < 2; ++i)
+      {
+        const std::size_t n_sides = (i == 0) ? 2 : 1;
+        bytes += face_data[i].n_faces *
+                 (n_sides * (dofs_per_cell * sizeof(types::global_dof_index) +
+                             n_q_points_face * dim * dim * sizeof(Number) +
+                             sizeof(unsigned int) + sizeof(std::uint16_t)) +
+                  n_q_points_face * ((dim + 1) * sizeof(Number) +
+                                     sizeof(point_type) +
+                                     (2 - n_sides) * sizeof(unsigned int)));
+      }
+
     return bytes;
   }
 
@@ -677,6 +1427,7 @@ namespace Portable
     this->use_coloring = additional_data.use_coloring;
     this->overlap_communication_computation =
       additional_data.overlap_communication_computation;
+    this->cells_per_block = additional_data.cells_per_block;
 
     n_dofs = dof_handler->n_dofs();
 
@@ -755,77 +1506,128 @@ namespace Portable
       }
     Kokkos::deep_copy(constraint_weights, constraint_weights_host);
 
+    const bool setup_inner_faces =
+      additional_data.mapping_update_flags_inner_faces != update_default;
+    const bool setup_boundary_faces =
+      additional_data.mapping_update_flags_boundary_faces != update_default;
+    if (setup_inner_faces || setup_boundary_faces)
+      {
+        shape_data_on_face =
+          Kokkos::View<Number *, MemorySpace::Default::kokkos_space>(
+            Kokkos::view_alloc("shape_data_on_face",
+                               Kokkos::WithoutInitializing),
+            4 * n_dofs_1d);
+        auto shape_data_on_face_host =
+          Kokkos::create_mirror_view(shape_data_on_face);
+        for (unsigned int side = 0; side < 2; ++side)
+          for (unsigned int i = 0; i < 2 * n_dofs_1d; ++i)
+            shape_data_on_face_host[side * 2 * n_dofs_1d + i] =
+              shape_info.data.front().shape_data_on_face[side][i];
+        Kokkos::deep_copy(shape_data_on_face, shape_data_on_face_host);
+      }
+
     // Create a graph coloring
     CellFilter begin(iterator_filter, dof_handler->begin_active());
     CellFilter end(iterator_filter, dof_handler->end());
 
+    graph.clear();
+    overlap_phase_begin = {{0, 0, 0, 0}};
     if (begin != end)
       {
-        if (additional_data.use_coloring)
-          {
-            const auto fun = [&](const CellFilter &filter) {
-              return internal::get_conflict_indices<dim, Number>(filter,
-                                                                 constraints);
-            };
-            graph = GraphColoring::make_graph_coloring(begin, end, fun);
-          }
-        else
+        const auto fun = [&](const CellFilter &filter) {
+          return internal::get_conflict_indices<dim, Number>(filter,
+                                                             constraints);
+        };
+
+        if (additional_data.overlap_communication_computation)
           {
-            graph.clear();
-            if (additional_data.overlap_communication_computation)
+            // We create one group (1) with the cells on the boundary of the
+            // local domain and two groups (0 and 2) with the interior cells.
+            // Without device-aware MPI, compress_finish() copies the complete
+            // host buffer back to the device and would overwrite the
+            // contributions of the cells computed in the meantime, so all the
+            // interior cells are put into group 0.
+            std::array<std::vector<CellFilter>, 3> cell_groups;
+
+            std::vector<bool> ghost_vertices(
+              dof_handler->get_triangulation().n_vertices(), false);
+
+            for (const auto &cell :
+                 dof_handler->get_triangulation().active_cell_iterators())
+              if (cell->is_ghost())
+                for (unsigned int i = 0;
+                     i < GeometryInfo<dim>::vertices_per_cell;
+                     i++)
+                  ghost_vertices[cell->vertex_index(i)] = true;
+
+            std::vector<CellFilter> inner_cells;
+
+            for (auto cell = begin; cell != end; ++cell)
               {
-                // We create one color (1) with the cells on the boundary of the
-                // local domain and two colors (0 and 2) with the interior
-                // cells.
-                graph.resize(3, std::vector<CellFilter>());
-
-                std::vector<bool> ghost_vertices(
-                  dof_handler->get_triangulation().n_vertices(), false);
-
-                for (const auto &cell :
-                     dof_handler->get_triangulation().active_cell_iterators())
-                  if (cell->is_ghost())
-                    for (unsigned int i = 0;
-                         i < GeometryInfo<dim>::vertices_per_cell;
-                         i++)
-                      ghost_vertices[cell->vertex_index(i)] = true;
-
-                std::vector<dealii::FilteredIterator<dealii::TriaActiveIterator<
-                  dealii::DoFCellAccessor<dim, dim, false>>>>
-                  inner_cells;
-
-                for (auto cell = begin; cell != end; ++cell)
-                  {
-                    bool ghost_vertex = false;
-
-                    for (unsigned int i = 0;
-                         i < GeometryInfo<dim>::vertices_per_cell;
-                         i++)
-                      if (ghost_vertices[cell->vertex_index(i)])
-                        {
-                          ghost_vertex = true;
-                          break;
-                        }
-
-                    if (ghost_vertex)
-                      graph[1].emplace_back(cell);
-                    else
-                      inner_cells.emplace_back(cell);
-                  }
-                for (unsigned i = 0; i < inner_cells.size(); ++i)
-                  if (i < inner_cells.size() / 2)
-                    graph[0].emplace_back(inner_cells[i]);
-                  else
-                    graph[2].emplace_back(inner_cells[i]);
+                bool ghost_vertex = false;
+
+                for (unsigned int i = 0;
+                     i < GeometryInfo<dim>::vertices_per_cell;
+                     i++)
+                  if (ghost_vertices[cell->vertex_index(i)])
+                    {
+                      ghost_vertex = true;
+                      break;
+                    }
+
+                if (ghost_vertex)
+                  cell_groups[1].emplace_back(cell);
+                else
+                  inner_cells.emplace_back(cell);
               }
-            else
+#ifdef DEAL_II_MPI_WITH_DEVICE_SUPPORT
+            const std::size_t n_early_inner_cells = inner_cells.size() / 2;
+#else
+            const std::size_t n_early_inner_cells = inner_cells.size();
+#endif
+            for (std::size_t i = 0; i < inner_cells.size(); ++i)
+              if (i < n_early_inner_cells)
+                cell_groups[0].emplace_back(inner_cells[i]);
+              else
+                cell_groups[2].emplace_back(inner_cells[i]);
+
+            // Each group gets one color, or is colored separately such that
+            // the colors of a group can be executed in the same phase of
+            // distributed_cell_loop().
+            for (unsigned int group = 0; group < 3; ++group)
               {
-                // If we are not using coloring, all the cells belong to the
-                // same color.
-                graph.resize(1, std::vector<CellFilter>());
-                for (auto cell = begin; cell != end; ++cell)
-                  graph[0].emplace_back(cell);
+                overlap_phase_begin[group] = graph.size();
+                if (additional_data.use_coloring == false)
+                  graph.emplace_back(std::move(cell_groups[group]));
+                else if (cell_groups[group].size() > 0)
+                  {
+                    using GroupIterator =
+                      typename std::vector<CellFilter>::const_iterator;
+                    const auto group_coloring =
+                      GraphColoring::make_graph_coloring(
+                        cell_groups[group].cbegin(),
+                        cell_groups[group].cend(),
+                        [&](const GroupIterator &it) { return fun(*it); });
+                    for (const auto &color : group_coloring)
+                      {
+                        graph.emplace_back();
+                        graph.back().reserve(color.size());
+                        for (const auto &it : color)
+                          graph.back().push_back(*it);
+                      }
+                  }
               }
+            overlap_phase_begin[3] = graph.size();
+          }
+        else if (additional_data.use_coloring)
+          graph = GraphColoring::make_graph_coloring(begin, end, fun);
+        else
+          {
+            // If we are not using coloring, all the cells belong to the
+            // same color.
+            graph.resize(1, std::vector<CellFilter>());
+            for (auto cell = begin; cell != end; ++cell)
+              graph[0].emplace_back(cell);
           }
       }
     n_colors = graph.size();
@@ -843,9 +1645,24 @@ namespace Portable
     for (unsigned int i = 0; i < n_colors; ++i)
       {
         n_cells[i] = graph[i].size();
+        if (additional_data.sort_cells_hierarchically)
+          internal::sort_cells_hierarchically(graph[i]);
+        if (additional_data.group_cells_by_constraint_kind)
+          helper.sort_by_constraint_kind(graph[i], partitioner);
         helper.fill_data(i, graph[i], partitioner);
       }
 
+    face_data[0].n_faces = 0;
+    face_data[1].n_faces = 0;
+    if (setup_inner_faces || setup_boundary_faces)
+      helper.fill_face_data(mapping,
+                            fe,
+                            quad,
+                            graph,
+                            partitioner,
+                            setup_inner_faces,
+                            setup_boundary_faces);
+
     // Setup row starts
     if (n_colors > 0)
       row_start[0] = 0;
@@ -924,7 +1741,7 @@ namespace Portable
 #if KOKKOS_VERSION >= 20900
               exec,
 #endif
-              n_cells[color],
+              get_n_cell_blocks(color),
               Kokkos::AUTO);
 
           internal::ApplyKernel<dim, Number, Functor> apply_kernel(
@@ -957,80 +1774,50 @@ namespace Portable
         // This code is inspired to the code in TaskInfo::loop.
         if (overlap_communication_computation)
           {
-            src.update_ghost_values_start(0);
-
             // In parallel, it's possible that some processors do not own any
-            // cells.
-            if (n_cells[0] > 0)
-              {
-                Kokkos::TeamPolicy<
-                  MemorySpace::Default::kokkos_space::execution_space>
-                  team_policy(
+            // cells, and in serial the cells of phase 1 do not exist because
+            // there are no ghost cells.
+            const auto run_phase = [&](const unsigned int phase) {
+              for (unsigned int i = overlap_phase_begin[phase];
+                   i < overlap_phase_begin[phase + 1];
+                   ++i)
+                if (n_cells[i] > 0)
+                  {
+                    Kokkos::TeamPolicy<
+                      MemorySpace::Default::kokkos_space::execution_space>
+                      team_policy(
 #if KOKKOS_VERSION >= 20900
-                    exec,
+                        exec,
 #endif
-                    n_cells[0],
-                    Kokkos::AUTO);
-
-                internal::ApplyKernel<dim, Number, Functor> apply_kernel(
-                  func, get_data(0), src.get_values(), dst.get_values());
+                        get_n_cell_blocks(i),
+                        Kokkos::AUTO);
 
-                Kokkos::parallel_for(
-                  "dealii::MatrixFree::distributed_cell_loop_0",
-                  team_policy,
-                  apply_kernel);
-              }
-            src.update_ghost_values_finish();
+                    internal::ApplyKernel<dim, Number, Functor> apply_kernel(
+                      func, get_data(i), src.get_values(), dst.get_values());
 
-            // In serial this color does not exist because there are no ghost
-            // cells
-            if (n_cells[1] > 0)
-              {
-                Kokkos::TeamPolicy<
-                  MemorySpace::Default::kokkos_space::execution_space>
-                  team_policy(
-#if KOKKOS_VERSION >= 20900
-                    exec,
-#endif
-                    n_cells[1],
-                    Kokkos::AUTO);
-
-                internal::ApplyKernel<dim, Number, Functor> apply_kernel(
-                  func, get_data(1), src.get_values(), dst.get_values());
+                    Kokkos::parallel_for(
+                      "dealii::MatrixFree::distributed_cell_loop_" +
+                        std::to_string(i),
+                      team_policy,
+                      apply_kernel);
+                  }
+            };
 
-                Kokkos::parallel_for(
-                  "dealii::MatrixFree::distributed_cell_loop_1",
-                  team_policy,
-                  apply_kernel);
+            // The kernels are launched asynchronously, so the interior cells
+            // are computed while the ghost values are in flight.
+            src.update_ghost_values_start(0);
+            run_phase(0);
+            src.update_ghost_values_finish();
 
-                // We need a synchronization point because we don't want
-                // device-aware MPI to start the MPI communication until the
-                // kernel is done.
-                Kokkos::fence();
-              }
+            run_phase(1);
+            // We need a synchronization point because we don't want
+            // device-aware MPI to start the MPI communication until the
+            // kernels are done.
+            if (overlap_phase_begin[1] != overlap_phase_begin[2])
+              Kokkos::fence();
 
             dst.compress_start(0, VectorOperation::add);
-            // When the mesh is coarse it is possible that some processors do
-            // not own any cells
-            if (n_cells[2] > 0)
-              {
-                Kokkos::TeamPolicy<
-                  MemorySpace::Default::kokkos_space::execution_space>
-                  team_policy(
-#if KOKKOS_VERSION >= 20900
-                    exec,
-#endif
-                    n_cells[2],
-                    Kokkos::AUTO);
-
-                internal::ApplyKernel<dim, Number, Functor> apply_kernel(
-                  func, get_data(2), src.get_values(), dst.get_values());
-
-                Kokkos::parallel_for(
-                  "dealii::MatrixFree::distributed_cell_loop_2",
-                  team_policy,
-                  apply_kernel);
-              }
+            run_phase(2);
             dst.compress_finish(VectorOperation::add);
           }
         else
@@ -1053,7 +1840,7 @@ namespace Portable
 #if KOKKOS_VERSION >= 20900
                       exec,
 #endif
-                      n_cells[i],
+                      get_n_cell_blocks(i),
                       Kokkos::AUTO);
 
                   internal::ApplyKernel<dim, Number, Functor> apply_kernel(
@@ -1090,7 +1877,7 @@ namespace Portable
 #if KOKKOS_VERSION >= 20900
                   exec,
 #endif
-                  n_cells[i],
+                  get_n_cell_blocks(i),
                   Kokkos::AUTO);
 
               internal::ApplyKernel<dim, Number, Functor> apply_kernel(
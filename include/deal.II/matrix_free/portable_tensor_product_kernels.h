@@ -41,6 +41,22 @@ namespace Portable
 
 
 
+    /**
+     * Write @p value into entry @p index of @p out, or add it to the entry
+     * if @p add is true.
+     */
+    template <bool add, typename ViewType, typename Number>
+    DEAL_II_HOST_DEVICE inline void
+    write_entry(ViewType out, const int index, const Number value)
+    {
+      if constexpr (add)
+        Kokkos::atomic_add(&out(index), value);
+      else
+        out(index) = value;
+    }
+
+
+
 #if KOKKOS_VERSION >= 40000
     /**
      * Helper function for values() and gradients() in 1D
@@ -52,7 +68,8 @@ namespace Portable
               bool add,
               bool in_place,
               typename ViewTypeIn,
-              typename ViewTypeOut>
+              typename ViewTypeOut,
+              typename ViewTypeTmp>
     DEAL_II_HOST_DEVICE void
     apply_1d(const Kokkos::TeamPolicy<
                MemorySpace::Default::kokkos_space::execution_space>::member_type
@@ -60,38 +77,59 @@ namespace Portable
              const Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
                               shape_data,
              const ViewTypeIn in,
-             ViewTypeOut      out)
+             ViewTypeOut      out,
+             const int        n_cells,
+             const int        cell_stride,
+             ViewTypeTmp      tmp)
     {
+      using TeamType = Kokkos::TeamPolicy<
+        MemorySpace::Default::kokkos_space::execution_space>::member_type;
+
       Number t[n_q_points_1d];
-      Kokkos::parallel_for(Kokkos::TeamThreadRange(team_member, n_q_points_1d),
-                           [&](const int &q) {
-                             t[q] = 0;
-                             // This loop simply multiplies the shape function
-                             // at the quadrature point by the value finite
-                             // element coefficient.
-                             // FIXME check why using parallel_reduce
-                             // ThreadVector is slower
-                             for (int k = 0; k < n_q_points_1d; ++k)
-                               {
-                                 const unsigned int shape_idx =
-                                   dof_to_quad ? (q + k * n_q_points_1d) :
-                                                 (k + q * n_q_points_1d);
-                                 const unsigned int source_idx = k;
-                                 t[q] += shape_data[shape_idx] * in(source_idx);
-                               }
-                           });
+      auto   thread_policy =
+        Kokkos::TeamThreadMDRange<Kokkos::Rank<2>, TeamType>(team_member,
+                                                             n_cells,
+                                                             n_q_points_1d);
+      Kokkos::parallel_for(thread_policy, [&](const int cell, const int q) {
+        const int offset = cell * cell_stride;
+
+        // This loop simply multiplies the shape function at the quadrature
+        // point by the value finite element coefficient.
+        // FIXME check why using parallel_reduce ThreadVector is slower
+        Number sum = 0;
+        for (int k = 0; k < n_q_points_1d; ++k)
+          {
+            const unsigned int shape_idx =
+              dof_to_quad ? (q + k * n_q_points_1d) : (k + q * n_q_points_1d);
+            sum += shape_data[shape_idx] * in(offset + k);
+          }
+
+        // When working in place, the result can only be written once all
+        // threads have read their input. A single cell keeps the
+        // intermediate result in registers, several cells use the scratch
+        // memory.
+        if constexpr (in_place)
+          {
+            if (n_cells == 1)
+              t[q] = sum;
+            else
+              tmp(offset + q) = sum;
+          }
+        else
+          write_entry<add>(out, offset + q, sum);
+      });
 
       if constexpr (in_place)
-        team_member.team_barrier();
-
-      Kokkos::parallel_for(Kokkos::TeamThreadRange(team_member, n_q_points_1d),
-                           [&](const int &q) {
-                             const unsigned int destination_idx = q;
-                             if constexpr (add)
-                               Kokkos::atomic_add(&out(destination_idx), t[q]);
-                             else
-                               out(destination_idx) = t[q];
-                           });
+        {
+          team_member.team_barrier();
+
+          Kokkos::parallel_for(thread_policy, [&](const int cell, const int q) {
+            const int offset = cell * cell_stride;
+            write_entry<add>(out,
+                             offset + q,
+                             (n_cells == 1) ? t[q] : tmp(offset + q));
+          });
+        }
     }
 
 
@@ -106,7 +144,8 @@ namespace Portable
               bool add,
               bool in_place,
               typename ViewTypeIn,
-              typename ViewTypeOut>
+              typename ViewTypeOut,
+              typename ViewTypeTmp>
     DEAL_II_HOST_DEVICE void
     apply_2d(const Kokkos::TeamPolicy<
                MemorySpace::Default::kokkos_space::execution_space>::member_type
@@ -114,7 +153,10 @@ namespace Portable
              const Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
                               shape_data,
              const ViewTypeIn in,
-             ViewTypeOut      out)
+             ViewTypeOut      out,
+             const int        n_cells,
+             const int        cell_stride,
+             ViewTypeTmp      tmp)
     {
       using TeamType = Kokkos::TeamPolicy<
         MemorySpace::Default::kokkos_space::execution_space>::member_type;
@@ -122,41 +164,59 @@ namespace Portable
 
       Number t[n_q_points];
       auto   thread_policy =
-        Kokkos::TeamThreadMDRange<Kokkos::Rank<2>, TeamType>(team_member,
-                                                             n_q_points_1d,
-                                                             n_q_points_1d);
-      Kokkos::parallel_for(thread_policy, [&](const int i, const int j) {
-        int q_point = i + j * n_q_points_1d;
+        Kokkos::TeamThreadMDRange<Kokkos::Rank<3>, TeamType>(
+          team_member, n_cells, n_q_points_1d, n_q_points_1d);
+      Kokkos::parallel_for(
+        thread_policy, [&](const int cell, const int i, const int j) {
+          const int offset  = cell * cell_stride;
+          const int q_point = i + j * n_q_points_1d;
 
-        // This loop simply multiplies the shape function at the quadrature
-        // point by the value finite element coefficient.
-        // FIXME check why using parallel_reduce ThreadVector is slower
-        const int base_shape   = dof_to_quad ? j : j * n_q_points_1d;
-        const int stride_shape = dof_to_quad ? n_q_points_1d : 1;
-        const int base_in      = (direction == 0) ? (n_q_points_1d * i) : i;
-        const int stride_in    = Utilities::pow(n_q_points_1d, direction);
-        Number    sum          = shape_data[base_shape] * in(base_in);
-        for (int k = 1; k < n_q_points_1d; ++k)
-          {
-            sum += shape_data[base_shape + k * stride_shape] *
-                   in(base_in + k * stride_in);
-          }
-        t[q_point] = sum;
-      });
+          // This loop simply multiplies the shape function at the quadrature
+          // point by the value finite element coefficient.
+          // FIXME check why using parallel_reduce ThreadVector is slower
+          const int base_shape   = dof_to_quad ? j : j * n_q_points_1d;
+          const int stride_shape = dof_to_quad ? n_q_points_1d : 1;
+          const int base_in =
+            offset + ((direction == 0) ? (n_q_points_1d * i) : i);
+          const int stride_in = Utilities::pow(n_q_points_1d, direction);
+          Number    sum       = shape_data[base_shape] * in(base_in);
+          for (int k = 1; k < n_q_points_1d; ++k)
+            {
+              sum += shape_data[base_shape + k * stride_shape] *
+                     in(base_in + k * stride_in);
+            }
 
-      if (in_place)
-        team_member.team_barrier();
+          const int destination_idx =
+            offset + ((direction == 0) ? (j + n_q_points_1d * i) :
+                                         (i + n_q_points_1d * j));
+          if constexpr (in_place)
+            {
+              if (n_cells == 1)
+                t[q_point] = sum;
+              else
+                tmp(destination_idx) = sum;
+            }
+          else
+            write_entry<add>(out, destination_idx, sum);
+        });
 
-      Kokkos::parallel_for(thread_policy, [&](const int i, const int j) {
-        const int          q_point = i + j * n_q_points_1d;
-        const unsigned int destination_idx =
-          (direction == 0) ? (j + n_q_points_1d * i) : (i + n_q_points_1d * j);
+      if constexpr (in_place)
+        {
+          team_member.team_barrier();
 
-        if (add)
-          Kokkos::atomic_add(&out(destination_idx), t[q_point]);
-        else
-          out(destination_idx) = t[q_point];
-      });
+          Kokkos::parallel_for(
+            thread_policy, [&](const int cell, const int i, const int j) {
+              const int q_point = i + j * n_q_points_1d;
+              const int destination_idx =
+                cell * cell_stride + ((direction == 0) ?
+                                        (j + n_q_points_1d * i) :
+                                        (i + n_q_points_1d * j));
+              write_entry<add>(out,
+                               destination_idx,
+                               (n_cells == 1) ? t[q_point] :
+                                                tmp(destination_idx));
+            });
+        }
     }
 
 
@@ -171,7 +231,8 @@ namespace Portable
               bool add,
               bool in_place,
               typename ViewTypeIn,
-              typename ViewTypeOut>
+              typename ViewTypeOut,
+              typename ViewTypeTmp>
     DEAL_II_HOST_DEVICE void
     apply_3d(const Kokkos::TeamPolicy<
                MemorySpace::Default::kokkos_space::execution_space>::member_type
@@ -179,17 +240,22 @@ namespace Portable
              const Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
                               shape_data,
              const ViewTypeIn in,
-             ViewTypeOut      out)
+             ViewTypeOut      out,
+             const int        n_cells,
+             const int        cell_stride,
+             ViewTypeTmp      tmp)
     {
       using TeamType = Kokkos::TeamPolicy<
         MemorySpace::Default::kokkos_space::execution_space>::member_type;
       constexpr unsigned int n_q_points = Utilities::pow(n_q_points_1d, 3);
 
       Number t[n_q_points];
-      auto thread_policy = Kokkos::TeamThreadMDRange<Kokkos::Rank<3>, TeamType>(
-        team_member, n_q_points_1d, n_q_points_1d, n_q_points_1d);
+      auto thread_policy = Kokkos::TeamThreadMDRange<Kokkos::Rank<4>, TeamType>(
+        team_member, n_cells, n_q_points_1d, n_q_points_1d, n_q_points_1d);
       Kokkos::parallel_for(
-        thread_policy, [&](const int i, const int j, const int q) {
+        thread_policy,
+        [&](const int cell, const int i, const int j, const int q) {
+          const int offset = cell * cell_stride;
           const int q_point =
             i + j * n_q_points_1d + q * n_q_points_1d * n_q_points_1d;
 
@@ -199,6 +265,7 @@ namespace Portable
           const int base_shape   = dof_to_quad ? q : q * n_q_points_1d;
           const int stride_shape = dof_to_quad ? n_q_points_1d : 1;
           const int base_in =
+            offset +
             (direction == 0 ?
                (n_q_points_1d * (i + n_q_points_1d * j)) :
                (direction == 1 ? (i + n_q_points_1d * n_q_points_1d * j) :
@@ -210,33 +277,57 @@ namespace Portable
               sum += shape_data[base_shape + k * stride_shape] *
                      in(base_in + k * stride_in);
             }
-          t[q_point] = sum;
-        });
 
-      if (in_place)
-        team_member.team_barrier();
-
-      Kokkos::parallel_for(
-        thread_policy, [&](const int i, const int j, const int q) {
-          const int q_point =
-            i + j * n_q_points_1d + q * n_q_points_1d * n_q_points_1d;
-          const unsigned int destination_idx =
-            (direction == 0) ? (q + n_q_points_1d * (i + n_q_points_1d * j)) :
-            (direction == 1) ? (i + n_q_points_1d * (q + n_q_points_1d * j)) :
-                               (i + n_q_points_1d * (j + n_q_points_1d * q));
-
-          if (add)
-            Kokkos::atomic_add(&out(destination_idx), t[q_point]);
+          const int destination_idx =
+            offset +
+            ((direction == 0) ? (q + n_q_points_1d * (i + n_q_points_1d * j)) :
+             (direction == 1) ? (i + n_q_points_1d * (q + n_q_points_1d * j)) :
+                                (i + n_q_points_1d * (j + n_q_points_1d * q)));
+          if constexpr (in_place)
+            {
+              if (n_cells == 1)
+                t[q_point] = sum;
+              else
+                tmp(destination_idx) = sum;
+            }
           else
-            out(destination_idx) = t[q_point];
+            write_entry<add>(out, destination_idx, sum);
         });
+
+      if constexpr (in_place)
+        {
+          team_member.team_barrier();
+
+          Kokkos::parallel_for(
+            thread_policy,
+            [&](const int cell, const int i, const int j, const int q) {
+              const int q_point =
+                i + j * n_q_points_1d + q * n_q_points_1d * n_q_points_1d;
+              const int destination_idx =
+                cell * cell_stride +
+                ((direction == 0) ?
+                   (q + n_q_points_1d * (i + n_q_points_1d * j)) :
+                 (direction == 1) ?
+                   (i + n_q_points_1d * (q + n_q_points_1d * j)) :
+                   (i + n_q_points_1d * (j + n_q_points_1d * q)));
+              write_entry<add>(out,
+                               destination_idx,
+                               (n_cells == 1) ? t[q_point] :
+                                                tmp(destination_idx));
+            });
+        }
     }
 #endif
 
 
 
     /**
-     * Helper function for values() and gradients().
+     * Helper function for values() and gradients(). The function applies the
+     * one-dimensional operation in @p direction to @p n_cells cells at once,
+     * whose data is stored at a distance of @p cell_stride entries in
+     * @p in and @p out. If @p in_place is true and more than one cell is
+     * processed, the intermediate results are stored in @p tmp, which must
+     * provide the same number of entries as @p out.
      */
     template <int dim,
               int n_q_points_1d,
@@ -246,7 +337,8 @@ namespace Portable
               bool add,
               bool in_place,
               typename ViewTypeIn,
-              typename ViewTypeOut>
+              typename ViewTypeOut,
+              typename ViewTypeTmp>
     DEAL_II_HOST_DEVICE void
     apply(const Kokkos::TeamPolicy<
             MemorySpace::Default::kokkos_space::execution_space>::member_type
@@ -254,32 +346,60 @@ namespace Portable
           const Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
                            shape_data,
           const ViewTypeIn in,
-          ViewTypeOut      out)
+          ViewTypeOut      out,
+          const int        n_cells,
+          const int        cell_stride,
+          ViewTypeTmp      tmp)
     {
 #if KOKKOS_VERSION >= 40000
       if constexpr (dim == 1)
         apply_1d<n_q_points_1d, Number, direction, dof_to_quad, add, in_place>(
-          team_member, shape_data, in, out);
+          team_member, shape_data, in, out, n_cells, cell_stride, tmp);
       if constexpr (dim == 2)
         apply_2d<n_q_points_1d, Number, direction, dof_to_quad, add, in_place>(
-          team_member, shape_data, in, out);
+          team_member, shape_data, in, out, n_cells, cell_stride, tmp);
       if constexpr (dim == 3)
         apply_3d<n_q_points_1d, Number, direction, dof_to_quad, add, in_place>(
-          team_member, shape_data, in, out);
+          team_member, shape_data, in, out, n_cells, cell_stride, tmp);
 #else
       constexpr unsigned int n_q_points = Utilities::pow(n_q_points_1d, dim);
 
+      // Split the index of the range over all cells into the offset of the
+      // cell and the position of the point within the cell
+      const auto get_indices = [&](const int     index,
+                                   int          &offset,
+                                   unsigned int &i,
+                                   unsigned int &j,
+                                   unsigned int &q) {
+        const unsigned int q_point = index % n_q_points;
+
+        offset = (index / n_q_points) * cell_stride;
+        i      = (dim == 1) ? 0 : q_point % n_q_points_1d;
+        j      = (dim == 3) ? (q_point / n_q_points_1d) % n_q_points_1d : 0;
+        q      = (dim == 1) ? q_point :
+                 (dim == 2) ? (q_point / n_q_points_1d) % n_q_points_1d :
+                              q_point / (n_q_points_1d * n_q_points_1d);
+      };
+
+      const auto get_destination_idx = [&](const int          offset,
+                                           const unsigned int i,
+                                           const unsigned int j,
+                                           const unsigned int q) {
+        return offset +
+               ((direction == 0) ?
+                  (q + n_q_points_1d * (i + n_q_points_1d * j)) :
+                (direction == 1) ?
+                  (i + n_q_points_1d * (q + n_q_points_1d * j)) :
+                  (i + n_q_points_1d * (j + n_q_points_1d * q)));
+      };
+
       Number t[n_q_points];
       Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team_member, n_q_points),
-        [&](const int &q_point) {
-          const unsigned int i = (dim == 1) ? 0 : q_point % n_q_points_1d;
-          const unsigned int j =
-            (dim == 3) ? (q_point / n_q_points_1d) % n_q_points_1d : 0;
-          const unsigned int q =
-            (dim == 1) ? q_point :
-            (dim == 2) ? (q_point / n_q_points_1d) % n_q_points_1d :
-                         q_point / (n_q_points_1d * n_q_points_1d);
+        Kokkos::TeamThreadRange(team_member, n_cells * n_q_points),
+        [&](const int &index) {
+          int          offset;
+          unsigned int i, j, q;
+          get_indices(index, offset, i, j, q);
 
           // This loop simply multiplies the shape function at the quadrature
           // point by the value finite element coefficient.
@@ -287,9 +407,10 @@ namespace Portable
           const int stride       = Utilities::pow(n_q_points_1d, direction);
           const int base_shape   = dof_to_quad ? q : (q * n_q_points_1d);
           const int base =
-            (direction == 0) ? (n_q_points_1d * (i + n_q_points_1d * j)) :
-            (direction == 1) ? (i + n_q_points_1d * (n_q_points_1d * j)) :
-                               (i + n_q_points_1d * j);
+            offset +
+            ((direction == 0) ? (n_q_points_1d * (i + n_q_points_1d * j)) :
+             (direction == 1) ? (i + n_q_points_1d * (n_q_points_1d * j)) :
+                                (i + n_q_points_1d * j));
           Number sum =
             shape_data[base_shape] * (in_place ? out(base) : in(base));
           for (int k = 1; k < n_q_points_1d; ++k)
@@ -298,33 +419,37 @@ namespace Portable
                 shape_data[base_shape + k * stride_shape] *
                 (in_place ? out(base + k * stride) : in(base + k * stride));
             }
-          t[q_point] = sum;
-        });
-
-      if (in_place)
-        team_member.team_barrier();
 
-      Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team_member, n_q_points),
-        [&](const int &q_point) {
-          const unsigned int i = (dim == 1) ? 0 : q_point % n_q_points_1d;
-          const unsigned int j =
-            (dim == 3) ? (q_point / n_q_points_1d) % n_q_points_1d : 0;
-          const unsigned int q =
-            (dim == 1) ? q_point :
-            (dim == 2) ? (q_point / n_q_points_1d) % n_q_points_1d :
-                         q_point / (n_q_points_1d * n_q_points_1d);
-
-          const unsigned int destination_idx =
-            (direction == 0) ? (q + n_q_points_1d * (i + n_q_points_1d * j)) :
-            (direction == 1) ? (i + n_q_points_1d * (q + n_q_points_1d * j)) :
-                               (i + n_q_points_1d * (j + n_q_points_1d * q));
-
-          if (add)
-            Kokkos::atomic_add(&out(destination_idx), t[q_point]);
+          const int destination_idx = get_destination_idx(offset, i, j, q);
+          if constexpr (in_place)
+            {
+              if (n_cells == 1)
+                t[index] = sum;
+              else
+                tmp(destination_idx) = sum;
+            }
           else
-            out(destination_idx) = t[q_point];
+            write_entry<add>(out, destination_idx, sum);
         });
+
+      if constexpr (in_place)
+        {
+          team_member.team_barrier();
+
+          Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(team_member, n_cells * n_q_points),
+            [&](const int &index) {
+              int          offset;
+              unsigned int i, j, q;
+              get_indices(index, offset, i, j, q);
+
+              const int destination_idx = get_destination_idx(offset, i, j, q);
+              write_entry<add>(out,
+                               destination_idx,
+                               (n_cells == 1) ? t[index] :
+                                                tmp(destination_idx));
+            });
+        }
 #endif
     }
 
@@ -357,6 +482,19 @@ namespace Portable
       using TeamHandle = Kokkos::TeamPolicy<
         MemorySpace::Default::kokkos_space::execution_space>::member_type;
 
+      using TemporaryView =
+        Kokkos::View<Number *,
+                     MemorySpace::Default::kokkos_space::execution_space::
+                       scratch_memory_space,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+      /**
+       * Constructor. The evaluator acts on the data of @p n_cells cells at
+       * once, which is stored at a distance of @p cell_stride entries in the
+       * views passed to the member functions. If more than one cell is
+       * processed, @p tmp has to provide scratch memory of the same size as
+       * these views.
+       */
       DEAL_II_HOST_DEVICE
       EvaluatorTensorProduct(
         const TeamHandle                                          &team_member,
@@ -364,7 +502,10 @@ namespace Portable
         Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
           shape_gradients,
         Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
-          co_shape_gradients);
+                            co_shape_gradients,
+        const int           n_cells     = 1,
+        const int           cell_stride = 0,
+        const TemporaryView tmp         = TemporaryView());
 
       /**
        * Evaluate the finite element function at the quadrature points.
@@ -473,6 +614,21 @@ namespace Portable
        */
       Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
         co_shape_gradients;
+
+      /**
+       * Number of cells processed at once.
+       */
+      const int n_cells;
+
+      /**
+       * Distance between the data of two consecutive cells.
+       */
+      const int cell_stride;
+
+      /**
+       * Scratch memory for in-place operations on several cells.
+       */
+      const TemporaryView tmp;
     };
 
 
@@ -490,11 +646,17 @@ namespace Portable
         Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
           shape_gradients,
         Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
-          co_shape_gradients)
+                            co_shape_gradients,
+        const int           n_cells,
+        const int           cell_stride,
+        const TemporaryView tmp)
       : team_member(team_member)
       , shape_values(shape_values)
       , shape_gradients(shape_gradients)
       , co_shape_gradients(co_shape_gradients)
+      , n_cells(n_cells)
+      , cell_stride(cell_stride)
+      , tmp(tmp)
     {}
 
 
@@ -515,7 +677,7 @@ namespace Portable
                                            ViewTypeOut      out) const
     {
       apply<dim, n_q_points_1d, Number, direction, dof_to_quad, add, in_place>(
-        team_member, shape_values, in, out);
+        team_member, shape_values, in, out, n_cells, cell_stride, tmp);
     }
 
 
@@ -536,7 +698,7 @@ namespace Portable
                                               ViewTypeOut      out) const
     {
       apply<dim, n_q_points_1d, Number, direction, dof_to_quad, add, in_place>(
-        team_member, shape_gradients, in, out);
+        team_member, shape_gradients, in, out, n_cells, cell_stride, tmp);
     }
 
 
@@ -557,7 +719,7 @@ namespace Portable
                                                  ViewTypeOut      out) const
     {
       apply<dim, n_q_points_1d, Number, direction, dof_to_quad, add, in_place>(
-        team_member, co_shape_gradients, in, out);
+        team_member, co_shape_gradients, in, out, n_cells, cell_stride, tmp);
     }
 
 
@@ -755,7 +917,7 @@ namespace Portable
       if constexpr (dim == 1)
         {
           gradients<0, false, add, false>(
-            Kokkos::subview(grad_u, Kokkos::ALL, dim), u);
+            Kokkos::subview(grad_u, Kokkos::ALL, 0), u);
         }
       else if constexpr (dim == 2)
         {
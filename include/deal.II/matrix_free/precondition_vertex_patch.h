@@ -0,0 +1,628 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_matrix_free_precondition_vertex_patch_h
+#define dealii_matrix_free_precondition_vertex_patch_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/tensor_product_matrix.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/numerics/tensor_product_matrix_creator.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * An additive overlapping Schwarz preconditioner on vertex patches for
+ * continuous finite elements of type FE_Q, intended as a smoother in
+ * matrix-free multigrid methods for the Laplacian and related operators.
+ *
+ * A vertex patch consists of the $2^\text{dim}$ cells around an interior
+ * vertex of the mesh, and its unknowns are the degrees of freedom in the
+ * interior of the patch, i.e., $(2k-1)^\text{dim}$ unknowns for elements of
+ * degree $k$. For every patch, the Laplacian restricted to the patch with
+ * homogeneous Dirichlet conditions on its boundary is approximated by the
+ * Laplacian on a Cartesian patch whose cells have the extents of the actual
+ * cells in the respective coordinate direction. This approximation can be
+ * inverted by the fast diagonalization method implemented in
+ * TensorProductMatrixSymmetricSum at a cost of $\mathcal O(k^{\text{dim}+1})$
+ * operations per patch. The action of the preconditioner is
+ * @f[
+ *   P^{-1} = \omega D^{-1/2} \sum_{p} R_p^T A_p^{-1} R_p D^{-1/2},
+ * @f]
+ * where $R_p$ is the restriction to the unknowns of patch $p$, $A_p$ the
+ * approximate patch matrix, $D$ a diagonal matrix containing the number of
+ * patches each unknown belongs to, and $\omega$ a relaxation parameter. The
+ * preconditioner is symmetric.
+ *
+ * Since the patch matrices are based on the cell extents, the
+ * preconditioner is robust with respect to the aspect ratio of the cells,
+ * e.g. in boundary layers, where a point Jacobi method deteriorates. On
+ * the other hand, it assumes that the cells are (close to) parallelepipeds
+ * aligned with each other, and that the operator is (close to) a Laplacian
+ * with constant coefficient on each patch.
+ *
+ * The patches are collected from the cell batches of a MatrixFree object
+ * and are themselves grouped into batches of VectorizedArrayType::size()
+ * patches, such that the application of the patch inverses runs vectorized
+ * over several patches. Only vertices around which all cells are locally
+ * owned and form a structured arrangement are used as patches. Degrees of
+ * freedom that are not in the interior of any patch, e.g. on a Neumann
+ * boundary, at vertices with an irregular number of adjacent cells, or at
+ * the boundary of the locally owned subdomain, are treated by a point Jacobi
+ * method if an inverse diagonal is provided via AdditionalData, and are left
+ * at zero otherwise. The same holds for constrained degrees of freedom, which
+ * are excluded from the patches.
+ *
+ * The class provides the interface needed by MGSmootherPrecondition, i.e.,
+ * a function initialize() taking a matrix and an AdditionalData object, and
+ * functions vmult() and Tvmult(). An example usage is
+ * @code
+ * using SmootherType = PreconditionVertexPatch<dim, double>;
+ * mg::SmootherRelaxation<SmootherType, VectorType> mg_smoother;
+ * MGLevelObject<typename SmootherType::AdditionalData> smoother_data;
+ * smoother_data.resize(0, n_levels - 1);
+ * for (unsigned int level = 0; level < n_levels; ++level)
+ *   {
+ *     smoother_data[level].matrix_free =
+ *       mg_matrices[level].get_matrix_free();
+ *     smoother_data[level].inverse_diagonal =
+ *       mg_matrices[level].get_matrix_diagonal_inverse();
+ *   }
+ * mg_smoother.initialize(mg_matrices, smoother_data);
+ * @endcode
+ *
+ * @ingroup Preconditioners
+ * @ingroup matrixfree
+ */
+template <int dim,
+          typename Number,
+          typename VectorizedArrayType = VectorizedArray<Number>>
+class PreconditionVertexPatch
+{
+public:
+  /**
+   * The vector type this class works on.
+   */
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  /**
+   * Standardized data struct to pipe additional parameters to the
+   * preconditioner.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(
+      const std::shared_ptr<const MatrixFree<dim, Number, VectorizedArrayType>>
+                        &matrix_free       = nullptr,
+      const unsigned int dof_handler_index = 0,
+      const double       relaxation        = 1.);
+
+    /**
+     * The MatrixFree object the patches are collected from. It determines
+     * the mesh, the level for multigrid computations, the finite element,
+     * and the numbering of the vector entries.
+     */
+    std::shared_ptr<const MatrixFree<dim, Number, VectorizedArrayType>>
+      matrix_free;
+
+    /**
+     * The index of the DoFHandler within @p matrix_free.
+     */
+    unsigned int dof_handler_index;
+
+    /**
+     * The relaxation parameter $\omega$.
+     */
+    double relaxation;
+
+    /**
+     * The inverse of the diagonal of the operator, used for the degrees of
+     * freedom that are not covered by any patch. If not set, the result is
+     * zero for these degrees of freedom.
+     */
+    std::shared_ptr<DiagonalMatrix<VectorType>> inverse_diagonal;
+  };
+
+  /**
+   * Set up the patches and their inverses. The matrix is not used, since
+   * all information is taken from the MatrixFree object in @p data, but it
+   * is part of the interface expected by MGSmootherPrecondition.
+   */
+  template <typename MatrixType>
+  void
+  initialize(const MatrixType &matrix, const AdditionalData &data);
+
+  /**
+   * Set up the patches and their inverses.
+   */
+  void
+  initialize(const AdditionalData &data);
+
+  /**
+   * Release all memory.
+   */
+  void
+  clear();
+
+  /**
+   * Apply the preconditioner, i.e., compute $dst = P^{-1} src$.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the transpose of the preconditioner, which is the same as
+   * vmult() since the preconditioner is symmetric.
+   */
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Return the number of vertex patches.
+   */
+  unsigned int
+  n_patches() const;
+
+  /**
+   * Return the memory consumption of this object in bytes.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The number of patches in each batch.
+   */
+  static constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  /**
+   * The number of unknowns of a patch.
+   */
+  unsigned int n_patch_dofs;
+
+  /**
+   * The number of vertex patches.
+   */
+  unsigned int n_vertex_patches;
+
+  /**
+   * The local indices into the vector of the unknowns of each patch, with
+   * the lanes of a batch running fastest, and numbers::invalid_unsigned_int
+   * for unused lanes and constrained unknowns.
+   */
+  std::vector<unsigned int> patch_dof_indices;
+
+  /**
+   * The approximate inverses of the patch matrices, one for each batch of
+   * patches.
+   */
+  std::vector<TensorProductMatrixSymmetricSum<dim, VectorizedArrayType>>
+    patch_matrices;
+
+  /**
+   * The values $D^{-1/2}$ for each locally owned unknown, or zero if the
+   * unknown is not in any patch.
+   */
+  AlignedVector<Number> weights;
+
+  /**
+   * The relaxation parameter.
+   */
+  Number relaxation;
+
+  /**
+   * The inverse diagonal used for unknowns outside of the patches.
+   */
+  std::shared_ptr<DiagonalMatrix<VectorType>> inverse_diagonal;
+};
+
+
+
+/*----------------------- Inline functions ----------------------------------*/
+
+#ifndef DOXYGEN
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline PreconditionVertexPatch<dim, Number, VectorizedArrayType>::
+  AdditionalData::AdditionalData(
+    const std::shared_ptr<const MatrixFree<dim, Number, VectorizedArrayType>>
+                      &matrix_free,
+    const unsigned int dof_handler_index,
+    const double       relaxation)
+  : matrix_free(matrix_free)
+  , dof_handler_index(dof_handler_index)
+  , relaxation(relaxation)
+{}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename MatrixType>
+inline void
+PreconditionVertexPatch<dim, Number, VectorizedArrayType>::initialize(
+  const MatrixType &,
+  const AdditionalData &data)
+{
+  initialize(data);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionVertexPatch<dim, Number, VectorizedArrayType>::initialize(
+  const AdditionalData &data)
+{
+  Assert(data.matrix_free != nullptr,
+         ExcMessage("The vertex patch smoother needs a MatrixFree object."));
+
+  clear();
+
+  const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free =
+    *data.matrix_free;
+  const unsigned int dof_no = data.dof_handler_index;
+
+  const FE_Q<dim> *fe = dynamic_cast<const FE_Q<dim> *>(
+    &matrix_free.get_dof_handler(dof_no).get_fe());
+  AssertThrow(fe != nullptr,
+              ExcMessage("The vertex patch smoother is only implemented for "
+                         "scalar elements of type FE_Q."));
+
+  relaxation       = data.relaxation;
+  inverse_diagonal = data.inverse_diagonal;
+
+  const unsigned int degree      = fe->degree;
+  const unsigned int n_raw_1d    = 2 * degree + 1;
+  const unsigned int n_interior  = 2 * degree - 1;
+  const unsigned int n_raw_dofs  = Utilities::pow(n_raw_1d, dim);
+  const unsigned int n_cell_dofs = fe->n_dofs_per_cell();
+  n_patch_dofs                   = Utilities::pow(n_interior, dim);
+
+  const std::vector<unsigned int> &lexicographic =
+    fe->get_poly_space_numbering_inverse();
+
+  const auto &partitioner = *matrix_free.get_vector_partitioner(dof_no);
+
+  std::vector<bool> is_constrained(partitioner.locally_owned_size(), false);
+  for (const unsigned int i : matrix_free.get_constrained_dofs(dof_no))
+    is_constrained[i] = true;
+
+  // collect the cells around each vertex, identified by the vertex index,
+  // the cell batch and lane, and the local number of the vertex in the cell
+  std::vector<std::array<unsigned int, 4>> vertex_to_cells;
+  for (unsigned int batch = 0; batch < matrix_free.n_cell_batches(); ++batch)
+    for (unsigned int lane = 0;
+         lane < matrix_free.n_active_entries_per_cell_batch(batch);
+         ++lane)
+      {
+        const auto cell = matrix_free.get_cell_iterator(batch, lane, dof_no);
+        for (const unsigned int v : cell->vertex_indices())
+          vertex_to_cells.push_back({{cell->vertex_index(v), batch, lane, v}});
+      }
+  std::sort(vertex_to_cells.begin(), vertex_to_cells.end());
+
+  // reference matrices of FE_Q in 1d in lexicographic numbering
+  const auto [mass_reference, stiffness_reference, is_dg] =
+    TensorProductMatrixCreator::internal::
+      create_reference_mass_and_stiffness_matrices<Number>(FE_Q<1>(degree),
+                                                           QGauss<1>(degree +
+                                                                     1));
+  (void)is_dg;
+
+  constexpr unsigned int n_cells_per_patch = 1U << dim;
+
+  std::vector<types::global_dof_index>     cell_dof_indices(n_cell_dofs);
+  std::vector<types::global_dof_index>     raw_dof_indices(n_raw_dofs);
+  std::vector<unsigned int>                local_dof_indices(n_patch_dofs);
+  std::vector<std::array<Number, 2 * dim>> patch_extents;
+  std::vector<unsigned int>                n_patches_per_dof(
+    partitioner.locally_owned_size(), 0);
+
+  for (auto group_begin = vertex_to_cells.begin();
+       group_begin != vertex_to_cells.end();)
+    {
+      auto group_end = group_begin;
+      while (group_end != vertex_to_cells.end() &&
+             (*group_end)[0] == (*group_begin)[0])
+        ++group_end;
+
+      const auto group = group_begin;
+      group_begin      = group_end;
+      if (group_end - group != n_cells_per_patch)
+        continue;
+
+      // Place the cells in the patch according to the position of the
+      // vertex within the cell, and fill the degrees of freedom of the patch
+      // in lexicographic order. Two cells that claim the same position, or
+      // different degrees of freedom at the same point of the patch, indicate
+      // an unstructured arrangement of cells, and the vertex is skipped.
+      std::fill(raw_dof_indices.begin(),
+                raw_dof_indices.end(),
+                numbers::invalid_dof_index);
+      std::array<bool, n_cells_per_patch> position_taken = {};
+      std::array<Number, 2 * dim>         extents        = {};
+      bool                                is_valid       = true;
+      for (auto entry = group; entry != group_end && is_valid; ++entry)
+        {
+          const auto cell =
+            matrix_free.get_cell_iterator((*entry)[1], (*entry)[2], dof_no);
+
+          // the cell is on the left of the vertex in those directions in
+          // which the vertex is the right vertex of the cell
+          std::array<unsigned int, dim> position;
+          unsigned int                  position_index = 0;
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              position[d] = 1 - (((*entry)[3] >> d) & 1);
+              position_index += position[d] << d;
+            }
+          if (position_taken[position_index])
+            {
+              is_valid = false;
+              break;
+            }
+          position_taken[position_index] = true;
+
+          for (unsigned int d = 0; d < dim; ++d)
+            extents[2 * d + position[d]] +=
+              cell->extent_in_direction(d) / (n_cells_per_patch / 2);
+
+          cell->get_active_or_mg_dof_indices(cell_dof_indices);
+          for (unsigned int i = 0; i < n_cell_dofs; ++i)
+            {
+              unsigned int raw_index = 0;
+              for (unsigned int d = 0, stride = 1, rest = i; d < dim;
+                   ++d, stride *= n_raw_1d, rest /= (degree + 1))
+                raw_index +=
+                  (position[d] * degree + rest % (degree + 1)) * stride;
+
+              const types::global_dof_index dof =
+                cell_dof_indices[lexicographic[i]];
+              if (raw_dof_indices[raw_index] == numbers::invalid_dof_index)
+                raw_dof_indices[raw_index] = dof;
+              else if (raw_dof_indices[raw_index] != dof)
+                {
+                  is_valid = false;
+                  break;
+                }
+            }
+        }
+      if (!is_valid)
+        continue;
+
+      // extract the unknowns in the interior of the patch, which are all
+      // locally owned if all cells of the patch are
+      for (unsigned int i = 0; i < n_patch_dofs && is_valid; ++i)
+        {
+          unsigned int raw_index = 0;
+          for (unsigned int d = 0, stride = 1, rest = i; d < dim;
+               ++d, stride *= n_raw_1d, rest /= n_interior)
+            raw_index += (rest % n_interior + 1) * stride;
+
+          const types::global_dof_index dof = raw_dof_indices[raw_index];
+          if (dof == numbers::invalid_dof_index ||
+              !partitioner.in_local_range(dof))
+            is_valid = false;
+          else
+            {
+              const unsigned int local_index = partitioner.global_to_local(dof);
+              local_dof_indices[i] = is_constrained[local_index] ?
+                                       numbers::invalid_unsigned_int :
+                                       local_index;
+            }
+        }
+      if (!is_valid)
+        continue;
+
+      for (const unsigned int index : local_dof_indices)
+        if (index != numbers::invalid_unsigned_int)
+          ++n_patches_per_dof[index];
+
+      if (patch_extents.size() % n_lanes == 0)
+        patch_dof_indices.resize(patch_dof_indices.size() +
+                                   n_patch_dofs * n_lanes,
+                                 numbers::invalid_unsigned_int);
+      const unsigned int lane   = patch_extents.size() % n_lanes;
+      const std::size_t  offset =
+        patch_dof_indices.size() - n_patch_dofs * n_lanes;
+      for (unsigned int i = 0; i < n_patch_dofs; ++i)
+        patch_dof_indices[offset + i * n_lanes + lane] = local_dof_indices[i];
+
+      patch_extents.push_back(extents);
+    }
+
+  n_vertex_patches = patch_extents.size();
+
+  // Set up the inverses of the patch matrices. The 1d matrices are
+  // assembled from the two cells of the patch in each direction, skipping
+  // the first and last unknown, which are on the boundary of the patch.
+  // Unused lanes of the last batch get the matrices of the first lane.
+  const unsigned int n_batches = (n_vertex_patches + n_lanes - 1) / n_lanes;
+  patch_matrices.resize(n_batches);
+
+  std::array<Table<2, VectorizedArrayType>, dim> mass_matrices;
+  std::array<Table<2, VectorizedArrayType>, dim> stiffness_matrices;
+  for (unsigned int batch = 0; batch < n_batches; ++batch)
+    {
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          mass_matrices[d].reinit(n_interior, n_interior);
+          stiffness_matrices[d].reinit(n_interior, n_interior);
+          for (unsigned int lane = 0; lane < n_lanes; ++lane)
+            {
+              const unsigned int patch =
+                (batch * n_lanes + lane < n_vertex_patches) ?
+                  batch * n_lanes + lane :
+                  batch * n_lanes;
+              for (unsigned int side = 0; side < 2; ++side)
+                {
+                  const Number h = patch_extents[patch][2 * d + side];
+                  for (unsigned int i = 0; i <= degree; ++i)
+                    for (unsigned int j = 0; j <= degree; ++j)
+                      {
+                        const unsigned int i0 = side * degree + i;
+                        const unsigned int j0 = side * degree + j;
+                        if (i0 == 0 || j0 == 0 || i0 == 2 * degree ||
+                            j0 == 2 * degree)
+                          continue;
+                        mass_matrices[d](i0 - 1, j0 - 1)[lane] +=
+                          mass_reference(i, j) * h;
+                        stiffness_matrices[d](i0 - 1, j0 - 1)[lane] +=
+                          stiffness_reference(i, j) / h;
+                      }
+                }
+            }
+        }
+      patch_matrices[batch].reinit(mass_matrices, stiffness_matrices);
+    }
+
+  weights.resize(partitioner.locally_owned_size());
+  for (unsigned int i = 0; i < weights.size(); ++i)
+    weights[i] = (n_patches_per_dof[i] > 0) ?
+                   Number(1.) / std::sqrt(Number(n_patches_per_dof[i])) :
+                   Number(0.);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionVertexPatch<dim, Number, VectorizedArrayType>::clear()
+{
+  n_patch_dofs     = 0;
+  n_vertex_patches = 0;
+  patch_dof_indices.clear();
+  patch_matrices.clear();
+  weights.clear();
+  inverse_diagonal.reset();
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionVertexPatch<dim, Number, VectorizedArrayType>::vmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  AssertDimension(dst.locally_owned_size(), weights.size());
+  AssertDimension(src.locally_owned_size(), weights.size());
+
+  dst = Number(0.);
+
+  AlignedVector<VectorizedArrayType> patch_src(n_patch_dofs);
+  AlignedVector<VectorizedArrayType> patch_dst(n_patch_dofs);
+  for (unsigned int batch = 0; batch < patch_matrices.size(); ++batch)
+    {
+      const unsigned int *indices =
+        patch_dof_indices.data() + batch * n_patch_dofs * n_lanes;
+
+      for (unsigned int i = 0; i < n_patch_dofs; ++i)
+        for (unsigned int lane = 0; lane < n_lanes; ++lane)
+          {
+            const unsigned int index = indices[i * n_lanes + lane];
+            patch_src[i][lane] =
+              (index != numbers::invalid_unsigned_int) ?
+                src.local_element(index) * weights[index] :
+                Number(0.);
+          }
+
+      patch_matrices[batch].apply_inverse(
+        make_array_view(patch_dst),
+        ArrayView<const VectorizedArrayType>(patch_src.data(),
+                                             patch_src.size()));
+
+      for (unsigned int i = 0; i < n_patch_dofs; ++i)
+        for (unsigned int lane = 0; lane < n_lanes; ++lane)
+          {
+            const unsigned int index = indices[i * n_lanes + lane];
+            if (index != numbers::invalid_unsigned_int)
+              dst.local_element(index) += patch_dst[i][lane];
+          }
+    }
+
+  for (unsigned int i = 0; i < weights.size(); ++i)
+    if (weights[i] != Number(0.))
+      dst.local_element(i) *= relaxation * weights[i];
+    else if (inverse_diagonal != nullptr)
+      dst.local_element(i) =
+        inverse_diagonal->get_vector().local_element(i) * src.local_element(i);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+PreconditionVertexPatch<dim, Number, VectorizedArrayType>::Tvmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline unsigned int
+PreconditionVertexPatch<dim, Number, VectorizedArrayType>::n_patches() const
+{
+  return n_vertex_patches;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline std::size_t
+PreconditionVertexPatch<dim, Number, VectorizedArrayType>::memory_consumption()
+  const
+{
+  return MemoryConsumption::memory_consumption(patch_dof_indices) +
+         MemoryConsumption::memory_consumption(patch_matrices) +
+         MemoryConsumption::memory_consumption(weights);
+}
+
+#endif // DOXYGEN
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
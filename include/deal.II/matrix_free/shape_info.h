@@ -114,7 +114,15 @@ namespace internal
       /**
        * Shape functions without a tensor product properties.
        */
-      tensor_none = 8
+      tensor_none = 8,
+
+      /**
+       * Special case of the FE_Nedelec element with anisotropic tensor
+       * product shape functions, i.e., Legendre polynomials of degree k in
+       * the direction of the vector component and Lobatto polynomials of
+       * degree (k + 1) in the other directions.
+       */
+      tensor_nedelec = 9
 
 
     };
@@ -480,16 +488,22 @@ namespace internal
 
       /**
        * Stores data of univariate shape functions defining the
-       * underlying tensor product finite element.
+       * underlying tensor product finite element. For the element type
+       * tensor_nedelec, the first entry contains the Lobatto polynomials of
+       * degree (k + 1) and the second one the Legendre polynomials of
+       * degree k.
        */
       std::vector<UnivariateShapeData<Number>> data;
 
       /**
        * Grants access to univariate shape function data of given
-       * dimension and vector component. Rows identify dimensions and
-       * columns identify vector components.
+       * dimension and vector component by storing the respective index into
+       * @p data. Rows identify dimensions and columns identify vector
+       * components. Storing indices rather than pointers keeps copies of
+       * this object valid independently of the object they were copied
+       * from.
        */
-      dealii::Table<2, UnivariateShapeData<Number> *> data_access;
+      dealii::Table<2, unsigned int> data_access;
 
       /**
        * Stores the number of space dimensions.
@@ -637,7 +651,7 @@ namespace internal
       AssertDimension(n_components, data_access.size(1));
       AssertIndexRange(dimension, n_dimensions);
       AssertIndexRange(component, n_components);
-      return *(data_access(dimension, component));
+      return data[data_access(dimension, component)];
     }
 
   } // end of namespace MatrixFreeFunctions
@@ -29,6 +29,7 @@
 #include <deal.II/fe/fe.h>
 #include <deal.II/fe/fe_dgp.h>
 #include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_nedelec.h>
 #include <deal.II/fe/fe_nothing.h>
 #include <deal.II/fe/fe_poly.h>
 #include <deal.II/fe/fe_pyramid_p.h>
@@ -43,6 +44,7 @@
 
 #include <deal.II/grid/reference_cell.h>
 
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/householder.h>
 
 #include <deal.II/matrix_free/shape_info.h>
@@ -198,6 +200,176 @@ namespace internal
     }
 
 
+    template <typename Number>
+    void
+    evaluate_univariate_polynomials(
+      const std::vector<Polynomials::Polynomial<double>> &polynomials,
+      const Quadrature<1>                                &quad,
+      UnivariateShapeData<Number>                        &shape_data)
+    {
+      const unsigned int n_dofs_1d     = polynomials.size();
+      const unsigned int n_q_points_1d = quad.size();
+      const unsigned int array_size    = n_dofs_1d * n_q_points_1d;
+      shape_data.shape_values.resize_fast(array_size);
+      shape_data.shape_gradients.resize_fast(array_size);
+      shape_data.shape_hessians.resize_fast(array_size);
+      for (unsigned int i = 0; i < 2; ++i)
+        {
+          shape_data.shape_data_on_face[i].resize(3 * n_dofs_1d);
+          shape_data.values_within_subface[i].resize(array_size);
+          shape_data.gradients_within_subface[i].resize(array_size);
+          shape_data.hessians_within_subface[i].resize(array_size);
+        }
+
+      std::array<double, 3> values;
+      for (unsigned int i = 0; i < n_dofs_1d; ++i)
+        {
+          for (unsigned int q = 0; q < n_q_points_1d; ++q)
+            {
+              const double x = quad.point(q)[0];
+              polynomials[i].value(x, 2, values.data());
+              shape_data.shape_values[i * n_q_points_1d + q]    = values[0];
+              shape_data.shape_gradients[i * n_q_points_1d + q] = values[1];
+              shape_data.shape_hessians[i * n_q_points_1d + q]  = values[2];
+
+              // evaluate on the two subfaces (0, 0.5) and (0.5, 1)
+              for (unsigned int sub = 0; sub < 2; ++sub)
+                {
+                  polynomials[i].value(0.5 * (x + sub), 2, values.data());
+                  shape_data.values_within_subface[sub][i * n_q_points_1d + q] =
+                    values[0];
+                  shape_data
+                    .gradients_within_subface[sub][i * n_q_points_1d + q] =
+                    values[1];
+                  shape_data
+                    .hessians_within_subface[sub][i * n_q_points_1d + q] =
+                    values[2];
+                }
+            }
+
+          for (unsigned int face = 0; face < 2; ++face)
+            {
+              polynomials[i].value(static_cast<double>(face), 2, values.data());
+              for (unsigned int d = 0; d < 3; ++d)
+                shape_data.shape_data_on_face[face][i + d * n_dofs_1d] =
+                  values[d];
+            }
+        }
+
+      // derivatives in the space of Lagrange polynomials in the quadrature
+      // points, see also UnivariateShapeData::evaluate_collocation_space()
+      if (n_q_points_1d >= 200)
+        return;
+
+      shape_data.shape_gradients_collocation.resize(n_q_points_1d *
+                                                    n_q_points_1d);
+      shape_data.shape_hessians_collocation.resize(n_q_points_1d *
+                                                   n_q_points_1d);
+      const std::vector<Polynomials::Polynomial<double>> poly_coll =
+        Polynomials::generate_complete_Lagrange_basis(quad.get_points());
+      for (unsigned int i = 0; i < n_q_points_1d; ++i)
+        for (unsigned int q = 0; q < n_q_points_1d; ++q)
+          {
+            poly_coll[i].value(quad.point(q)[0], 2, values.data());
+            shape_data.shape_gradients_collocation[i * n_q_points_1d + q] =
+              values[1];
+            shape_data.shape_hessians_collocation[i * n_q_points_1d + q] =
+              values[2];
+          }
+
+      for (unsigned int face = 0; face < 2; ++face)
+        {
+          shape_data.quadrature_data_on_face[face].resize(n_q_points_1d * 3);
+          for (unsigned int i = 0; i < n_q_points_1d; ++i)
+            {
+              poly_coll[i].value(static_cast<double>(face), 2, values.data());
+              for (unsigned int d = 0; d < 3; ++d)
+                shape_data
+                  .quadrature_data_on_face[face][i + d * n_q_points_1d] =
+                  values[d];
+            }
+        }
+    }
+
+
+
+    template <int dim, int spacedim>
+    std::vector<unsigned int>
+    get_nedelec_lexicographic_numbering(
+      const FiniteElement<dim, spacedim>                 &fe,
+      const std::vector<Polynomials::Polynomial<double>> &poly_normal,
+      const std::vector<Polynomials::Polynomial<double>> &poly_tangential)
+    {
+      // The shape functions of FE_Nedelec are the products of the
+      // univariate polynomials without any further transformation by a node
+      // matrix. We identify the univariate factors of each shape function by
+      // expanding it along lines in each coordinate direction through a
+      // point that is not on any of the roots of the polynomials.
+      const unsigned int dofs_per_component = fe.n_dofs_per_cell() / dim;
+      std::vector<unsigned int> lexicographic(fe.n_dofs_per_cell(),
+                                              numbers::invalid_unsigned_int);
+      Point<dim>                generic_point;
+      for (unsigned int d = 0; d < dim; ++d)
+        generic_point[d] = 0.2718 + 0.1931 * d;
+
+      for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+        {
+          unsigned int component = 0;
+          for (unsigned int c = 1; c < dim; ++c)
+            if (std::abs(fe.shape_value_component(i, generic_point, c)) >
+                std::abs(fe.shape_value_component(i, generic_point, component)))
+              component = c;
+
+          unsigned int index  = 0;
+          unsigned int stride = 1;
+          double       value  = 1.;
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              const std::vector<Polynomials::Polynomial<double>> &poly =
+                d == component ? poly_normal : poly_tangential;
+              const unsigned int n = poly.size();
+              FullMatrix<double> vandermonde(n, n);
+              Vector<double>     line_values(n), coefficients(n);
+              for (unsigned int s = 0; s < n; ++s)
+                {
+                  Point<dim> point = generic_point;
+                  point[d]         = (s + 0.5) / n;
+                  line_values(s) =
+                    fe.shape_value_component(i, point, component);
+                  for (unsigned int j = 0; j < n; ++j)
+                    vandermonde(s, j) = poly[j].value(point[d]);
+                }
+              vandermonde.gauss_jordan();
+              vandermonde.vmult(coefficients, line_values);
+
+              unsigned int j_max = 0;
+              for (unsigned int j = 1; j < n; ++j)
+                if (std::abs(coefficients(j)) > std::abs(coefficients(j_max)))
+                  j_max = j;
+              index += j_max * stride;
+              stride *= n;
+              value *= poly[j_max].value(generic_point[d]);
+            }
+
+          AssertThrow(std::abs(fe.shape_value_component(i,
+                                                        generic_point,
+                                                        component) -
+                               value) < 1e-10 * std::max(1., std::abs(value)),
+                      ExcNotImplemented("Could not identify the shape "
+                                        "functions of the element " +
+                                        fe.get_name() +
+                                        " as tensor products."));
+          AssertIndexRange(index, dofs_per_component);
+          Assert(lexicographic[component * dofs_per_component + index] ==
+                   numbers::invalid_unsigned_int,
+                 ExcInternalError());
+          lexicographic[component * dofs_per_component + index] = i;
+        }
+      return lexicographic;
+    }
+
+
+
     // ----------------- actual ShapeInfo implementation --------------------
 
     template <typename Number>
@@ -310,6 +482,62 @@ namespace internal
 
           return;
         }
+      // ShapeInfo for FE_Nedelec. The univariate shape data is of size 2,
+      // data[0] contains the Lobatto polynomials of degree k+1 and data[1]
+      // the Legendre polynomials of degree k used in the direction of the
+      // respective vector component
+      else if (dynamic_cast<const FE_Nedelec<dim> *>(
+                 &fe_in.base_element(base_element_number)))
+        {
+          element_type = tensor_nedelec;
+
+          AssertThrow(quad_in.is_tensor_product(),
+                      ExcNotImplemented("FE_Nedelec is only supported with "
+                                        "tensor product quadrature formulas."));
+          const auto quad = quad_in.get_tensor_basis()[0];
+
+          const FiniteElement<dim, spacedim> &fe =
+            fe_in.base_element(base_element_number);
+          n_dimensions = dim;
+          n_components = fe_in.n_components();
+
+          const unsigned int n_q_points_1d = quad.size();
+          n_q_points      = Utilities::fixed_power<dim>(n_q_points_1d);
+          n_q_points_face = Utilities::fixed_power<dim - 1>(n_q_points_1d);
+          dofs_per_component_on_cell = fe.n_dofs_per_cell() / dim;
+
+          // face integrals are not supported for this element
+          dofs_per_component_on_face = 0;
+
+          const std::vector<Polynomials::Polynomial<double>> poly_tangential =
+            Polynomials::Lobatto::generate_complete_basis(fe.degree);
+          const std::vector<Polynomials::Polynomial<double>> poly_normal =
+            Polynomials::Legendre::generate_complete_basis(fe.degree - 1);
+
+          data.resize(2);
+          for (unsigned int direction = 0; direction < 2; ++direction)
+            {
+              data[direction].element_type  = tensor_nedelec;
+              data[direction].quadrature    = quad;
+              data[direction].n_q_points_1d = n_q_points_1d;
+              data[direction].fe_degree     = fe.degree - direction;
+              evaluate_univariate_polynomials(direction == 0 ? poly_tangential :
+                                                               poly_normal,
+                                              quad,
+                                              data[direction]);
+            }
+
+          data_access.reinit(n_dimensions, n_components);
+          for (unsigned int d = 0; d < n_dimensions; ++d)
+            for (unsigned int c = 0; c < n_components; ++c)
+              data_access(d, c) = d == c % dim ? 1 : 0;
+
+          lexicographic_numbering =
+            get_nedelec_lexicographic_numbering(fe,
+                                                poly_normal,
+                                                poly_tangential);
+          return;
+        }
       else if (quad_in.is_tensor_product() == false ||
                dynamic_cast<const FE_SimplexPoly<dim, spacedim> *>(
                  &fe_in.base_element(base_element_number)) != nullptr ||
@@ -339,7 +567,7 @@ namespace internal
           data.resize(1);
           UnivariateShapeData<Number> &univariate_shape_data = data.front();
           data_access.reinit(n_dimensions, n_components);
-          data_access.fill(&univariate_shape_data);
+          data_access.fill(0U);
 
           // note: we cannot write `univariate_shape_data.quadrature = quad`,
           // since the quadrature rule within UnivariateShapeData expects
@@ -594,7 +822,7 @@ namespace internal
       data.resize(1);
       UnivariateShapeData<Number> &univariate_shape_data = data.front();
       data_access.reinit(n_dimensions, n_components);
-      data_access.fill(&univariate_shape_data);
+      data_access.fill(0U);
       univariate_shape_data.quadrature    = quad;
       univariate_shape_data.fe_degree     = fe.degree;
       univariate_shape_data.n_q_points_1d = quad.size();
@@ -1231,7 +1459,8 @@ namespace internal
     bool
     ShapeInfo<Number>::is_supported(const FiniteElement<dim, spacedim> &fe)
     {
-      if (dynamic_cast<const FE_RaviartThomasNodal<dim> *>(&fe))
+      if (dynamic_cast<const FE_RaviartThomasNodal<dim> *>(&fe) ||
+          dynamic_cast<const FE_Nedelec<dim> *>(&fe))
         return true;
 
       for (unsigned int base = 0; base < fe.n_base_elements(); ++base)
@@ -0,0 +1,862 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_matrix_free_static_condensation_h
+#define dealii_matrix_free_static_condensation_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/batched_full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace MatrixFreeTools
+{
+  /**
+   * A class for the static condensation of the interior unknowns of
+   * hybridized methods, such as the hybridizable discontinuous Galerkin
+   * (HDG) method of step-51, working on the cell batches of a MatrixFree
+   * object. On each cell, the local system
+   * @f[
+   * \begin{pmatrix} A & B \\ C & D \end{pmatrix}
+   * \begin{pmatrix} u \\ \lambda \end{pmatrix}
+   * =
+   * \begin{pmatrix} f \\ g \end{pmatrix}
+   * @f]
+   * couples the unknowns $u$ of the discontinuous interior space to the
+   * unknowns $\lambda$ on the faces of the cell, which are the only global
+   * unknowns. Eliminating $u$ gives the trace system with the local
+   * contributions $S = D - C A^{-1} B$ and right hand side $g - C A^{-1} f$,
+   * after whose solution the interior unknowns are reconstructed by
+   * $u = A^{-1} (f - B \lambda)$.
+   *
+   * The local matrices of all cells are held in BatchedFullMatrix objects,
+   * with one cell per lane of a VectorizedArray as in the cell batches of
+   * MatrixFree, such that the factorization of $A$, the computation of $S$,
+   * the condensation of the right hand side and the reconstruction are done
+   * with the SIMD instructions of the processor. The trace system is never
+   * assembled: vmult() applies the matrices $S$ cell batch by cell batch,
+   * so the class can be used as the system matrix of an iterative solver,
+   * together with compute_diagonal() for a point-Jacobi or Chebyshev
+   * preconditioner.
+   *
+   * The interior unknowns are described by the DoFHandler with index
+   * @p dof_no of the MatrixFree object, which needs to use a discontinuous
+   * element, whereas the trace unknowns are given by a separate DoFHandler
+   * on the same triangulation, typically with an FE_FaceQ element, which is
+   * not stored in MatrixFree. The local matrices are set up by a function
+   * given to assemble_local_systems(), which gets the four matrices of a cell
+   * batch in interleaved form, with rows and columns in the order of
+   * DoFCellAccessor::get_dof_indices() of the two DoFHandler objects. This
+   * is the ordering used by FEValuesBatch, which can be used for the
+   * integration, e.g.
+   * @code
+   * FEValuesBatch<dim> fe_batch(mapping, fe_interior, quadrature,
+   *                             update_values | update_gradients |
+   *                             update_JxW_values);
+   * condensation.assemble_local_systems(
+   *   [&](const unsigned int cell_batch, auto &A, auto &B, auto &C, auto &D) {
+   *     fe_batch.reinit(matrix_free, cell_batch);
+   *     // ... cell and face integrals of the local matrices
+   *   });
+   * @endcode
+   *
+   * The constraints of the trace unknowns may only contain constraints
+   * without couplings to other unknowns, such as boundary values set by
+   * VectorTools::interpolate_boundary_values(). The respective rows and
+   * columns of the trace operator are those of the identity matrix, and
+   * their values are included in the right hand side by condense_rhs().
+   */
+  template <int dim,
+            typename Number              = double,
+            typename VectorizedArrayType = VectorizedArray<Number>>
+  class StaticCondensation
+  {
+  public:
+    static_assert(
+      std::is_same_v<VectorizedArrayType,
+                     VectorizedArray<Number, VectorizedArrayType::size()>>,
+      "The local systems are stored in BatchedFullMatrix objects, which "
+      "work on VectorizedArray types only.");
+
+    /**
+     * The vector type used for the interior and the trace unknowns.
+     */
+    using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+    /**
+     * The type of the local matrices of a cell batch.
+     */
+    using LocalMatrixType = Table<2, VectorizedArrayType>;
+
+    /**
+     * The type of the function computing the local matrices $A$, $B$, $C$,
+     * and $D$, in this order, of the cell batch given as first argument.
+     */
+    using LocalAssemblerType = std::function<void(const unsigned int,
+                                                  LocalMatrixType &,
+                                                  LocalMatrixType &,
+                                                  LocalMatrixType &,
+                                                  LocalMatrixType &)>;
+
+    /**
+     * Constructor. Does nothing.
+     */
+    StaticCondensation();
+
+    /**
+     * Set up the index data for the cell batches of @p matrix_free, using
+     * the interior unknowns of the DoFHandler with index @p dof_no in
+     * @p matrix_free and the trace unknowns described by
+     * @p trace_dof_handler and @p trace_constraints.
+     */
+    void
+    reinit(
+      const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+      const DoFHandler<dim>                              &trace_dof_handler,
+      const AffineConstraints<Number>                    &trace_constraints,
+      const unsigned int                                  dof_no = 0);
+
+    /**
+     * Compute the local matrices of all cell batches with
+     * @p local_assembler, which gets zero matrices of the sizes $n_u \times
+     * n_u$, $n_u \times n_\lambda$, $n_\lambda \times n_u$, and $n_\lambda
+     * \times n_\lambda$ for $n_u$ interior and $n_\lambda$ trace unknowns
+     * per cell, and condense them. The lanes of a cell batch beyond
+     * MatrixFree::n_active_entries_per_cell_batch() are ignored.
+     */
+    void
+    assemble_local_systems(const LocalAssemblerType &local_assembler);
+
+    /**
+     * Initialize @p vec for the trace unknowns, including the ghost
+     * entries needed by the locally owned cells.
+     */
+    void
+    initialize_trace_vector(VectorType &vec) const;
+
+    /**
+     * Initialize @p vec for the interior unknowns.
+     */
+    void
+    initialize_interior_vector(VectorType &vec) const;
+
+    /**
+     * Return the global number of trace unknowns.
+     */
+    types::global_dof_index
+    m() const;
+
+    /**
+     * Add the condensed right hand side $-C A^{-1} f$ with the interior
+     * right hand side @p interior_rhs to the trace right hand side
+     * @p trace_rhs, which holds the global right hand side $g$ of the trace
+     * unknowns on entry, and include the values of the constrained trace
+     * unknowns.
+     */
+    void
+    condense_rhs(VectorType &trace_rhs, const VectorType &interior_rhs) const;
+
+    /**
+     * Apply the condensed trace operator, $dst = S\, src$.
+     */
+    void
+    vmult(VectorType &dst, const VectorType &src) const;
+
+    /**
+     * Compute the diagonal of the condensed trace operator.
+     */
+    void
+    compute_diagonal(VectorType &diagonal) const;
+
+    /**
+     * Compute the interior unknowns $u = A^{-1}(f - B \lambda)$ from the
+     * interior right hand side @p interior_rhs and the solution of the trace
+     * system @p trace_solution, including the values of the constrained
+     * trace unknowns.
+     */
+    void
+    reconstruct_interior(VectorType       &interior_solution,
+                         const VectorType &interior_rhs,
+                         const VectorType &trace_solution) const;
+
+    /**
+     * Determine an estimate for the memory consumption (in bytes) of this
+     * object.
+     */
+    std::size_t
+    memory_consumption() const;
+
+  private:
+    /**
+     * The BatchedFullMatrix type holding the local matrices.
+     */
+    using BatchedMatrixType =
+      BatchedFullMatrix<Number, VectorizedArrayType::size()>;
+
+    /**
+     * Read the entries of @p vec at the local indices @p indices of the
+     * cell batch @p cell_batch into @p values, with @p n_dofs entries per
+     * cell. If @p zero_constrained is true, the constrained trace unknowns
+     * are set to zero.
+     */
+    void
+    read_values(const unsigned int                  cell_batch,
+                const std::vector<unsigned int>    &indices,
+                const unsigned int                  n_dofs,
+                const VectorType                   &vec,
+                const bool                          zero_constrained,
+                AlignedVector<VectorizedArrayType> &values) const;
+
+    /**
+     * Add the entries of @p values of the unconstrained trace unknowns of
+     * the cell batch @p cell_batch into @p vec.
+     */
+    void
+    distribute_trace_values(
+      const unsigned int                        cell_batch,
+      const AlignedVector<VectorizedArrayType> &values,
+      VectorType                               &vec) const;
+
+    /**
+     * The MatrixFree object the cell batches are taken from.
+     */
+    ObserverPointer<const MatrixFree<dim, Number, VectorizedArrayType>>
+      matrix_free;
+
+    /**
+     * The index of the DoFHandler of the interior unknowns in matrix_free.
+     */
+    unsigned int dof_no;
+
+    /**
+     * The number of interior unknowns per cell.
+     */
+    unsigned int n_interior_dofs;
+
+    /**
+     * The number of trace unknowns per cell.
+     */
+    unsigned int n_trace_dofs;
+
+    /**
+     * The partitioner of the trace vectors.
+     */
+    std::shared_ptr<const Utilities::MPI::Partitioner> trace_partitioner;
+
+    /**
+     * The local indices of the interior unknowns of the cells, stored cell
+     * batch by cell batch and lane by lane.
+     */
+    std::vector<unsigned int> interior_indices;
+
+    /**
+     * The local indices of the trace unknowns of the cells in the vectors
+     * of trace_partitioner, in the same format as interior_indices.
+     */
+    std::vector<unsigned int> trace_indices;
+
+    /**
+     * Whether a trace unknown, given by its local index, is constrained.
+     */
+    std::vector<bool> trace_is_constrained;
+
+    /**
+     * The locally owned constrained trace unknowns, given by their local
+     * index, together with their inhomogeneity.
+     */
+    std::vector<std::pair<unsigned int, Number>> constrained_trace_dofs;
+
+    /**
+     * The LU factorizations of the interior matrices $A$.
+     */
+    BatchedMatrixType interior_matrices;
+
+    /**
+     * The negative trace-to-interior coupling matrices $-C$.
+     */
+    BatchedMatrixType negative_trace_interior_matrices;
+
+    /**
+     * The matrices $A^{-1} B$ to reconstruct the interior unknowns.
+     */
+    BatchedMatrixType interior_solution_matrices;
+
+    /**
+     * The condensed matrices $S = D - C A^{-1} B$.
+     */
+    BatchedMatrixType condensed_matrices;
+  };
+
+
+
+  /*----------------------- Inline functions ----------------------------*/
+
+#ifndef DOXYGEN
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  StaticCondensation<dim, Number, VectorizedArrayType>::StaticCondensation()
+    : dof_no(0)
+    , n_interior_dofs(0)
+    , n_trace_dofs(0)
+  {}
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  StaticCondensation<dim, Number, VectorizedArrayType>::reinit(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const DoFHandler<dim>                              &trace_dof_handler,
+    const AffineConstraints<Number>                    &trace_constraints,
+    const unsigned int                                  dof_no)
+  {
+    const DoFHandler<dim> &dof_handler = matrix_free.get_dof_handler(dof_no);
+    Assert(dof_handler.has_hp_capabilities() == false &&
+             trace_dof_handler.has_hp_capabilities() == false,
+           ExcNotImplemented());
+    Assert(&dof_handler.get_triangulation() ==
+             &trace_dof_handler.get_triangulation(),
+           ExcMessage("The interior and trace unknowns need to be defined "
+                      "on the same triangulation."));
+    Assert(dof_handler.get_fe().n_dofs_per_vertex() == 0,
+           ExcMessage("The interior unknowns need to be discontinuous."));
+
+    this->matrix_free = &matrix_free;
+    this->dof_no      = dof_no;
+    n_interior_dofs   = dof_handler.get_fe().n_dofs_per_cell();
+    n_trace_dofs      = trace_dof_handler.get_fe().n_dofs_per_cell();
+
+    constexpr unsigned int n_lanes   = VectorizedArrayType::size();
+    const unsigned int     n_batches = matrix_free.n_cell_batches();
+    const Utilities::MPI::Partitioner &interior_partitioner =
+      *matrix_free.get_vector_partitioner(dof_no);
+
+    // collect the indices of the cells, where the lanes beyond the filled
+    // ones get invalid indices
+    interior_indices.assign(n_batches * n_lanes * n_interior_dofs,
+                            numbers::invalid_unsigned_int);
+    std::vector<types::global_dof_index> global_trace_indices(
+      n_batches * n_lanes * n_trace_dofs, numbers::invalid_dof_index);
+    std::vector<types::global_dof_index> dof_indices(n_interior_dofs);
+    std::vector<types::global_dof_index> cell_trace_indices(n_trace_dofs);
+    for (unsigned int batch = 0; batch < n_batches; ++batch)
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_cell_batch(batch);
+           ++v)
+        {
+          const auto cell = matrix_free.get_cell_iterator(batch, v, dof_no);
+          cell->get_dof_indices(dof_indices);
+          const unsigned int cell_index = batch * n_lanes + v;
+          for (unsigned int i = 0; i < n_interior_dofs; ++i)
+            interior_indices[cell_index * n_interior_dofs + i] =
+              interior_partitioner.global_to_local(dof_indices[i]);
+
+          cell->as_dof_handler_iterator(trace_dof_handler)
+            ->get_dof_indices(cell_trace_indices);
+          std::copy(cell_trace_indices.begin(),
+                    cell_trace_indices.end(),
+                    global_trace_indices.begin() + cell_index * n_trace_dofs);
+        }
+
+    // the ghost entries of the trace vectors are the trace unknowns on the
+    // faces of the locally owned cells owned by other processes
+    const IndexSet &owned_trace_dofs = trace_dof_handler.locally_owned_dofs();
+    std::vector<types::global_dof_index> ghost_indices;
+    for (const types::global_dof_index index : global_trace_indices)
+      if (index != numbers::invalid_dof_index &&
+          owned_trace_dofs.is_element(index) == false)
+        ghost_indices.push_back(index);
+    std::sort(ghost_indices.begin(), ghost_indices.end());
+    ghost_indices.erase(std::unique(ghost_indices.begin(),
+                                    ghost_indices.end()),
+                        ghost_indices.end());
+    IndexSet ghost_trace_dofs(owned_trace_dofs.size());
+    ghost_trace_dofs.add_indices(ghost_indices.begin(), ghost_indices.end());
+    trace_partitioner = std::make_shared<Utilities::MPI::Partitioner>(
+      owned_trace_dofs,
+      ghost_trace_dofs,
+      trace_dof_handler.get_mpi_communicator());
+
+    trace_indices.resize(global_trace_indices.size());
+    for (unsigned int i = 0; i < global_trace_indices.size(); ++i)
+      trace_indices[i] =
+        global_trace_indices[i] == numbers::invalid_dof_index ?
+          numbers::invalid_unsigned_int :
+          trace_partitioner->global_to_local(global_trace_indices[i]);
+
+    const unsigned int n_local_trace_dofs =
+      trace_partitioner->locally_owned_size() +
+      trace_partitioner->n_ghost_indices();
+    trace_is_constrained.assign(n_local_trace_dofs, false);
+    constrained_trace_dofs.clear();
+    for (unsigned int i = 0; i < n_local_trace_dofs; ++i)
+      {
+        const types::global_dof_index index =
+          trace_partitioner->local_to_global(i);
+        if (trace_constraints.is_constrained(index))
+          {
+            const auto *entries =
+              trace_constraints.get_constraint_entries(index);
+            AssertThrow(entries == nullptr || entries->empty(),
+                        ExcMessage(
+                          "Only constraints without couplings to other "
+                          "unknowns, such as boundary values, are supported "
+                          "for the trace unknowns."));
+            (void)entries;
+            trace_is_constrained[i] = true;
+            if (i < trace_partitioner->locally_owned_size())
+              constrained_trace_dofs.emplace_back(
+                i, trace_constraints.get_inhomogeneity(index));
+          }
+      }
+
+    const unsigned int n_matrices = n_batches * n_lanes;
+    interior_matrices.reinit(n_matrices, n_interior_dofs, n_interior_dofs);
+    negative_trace_interior_matrices.reinit(n_matrices,
+                                            n_trace_dofs,
+                                            n_interior_dofs);
+    interior_solution_matrices.reinit(n_matrices,
+                                      n_interior_dofs,
+                                      n_trace_dofs);
+    condensed_matrices.reinit(n_matrices, n_trace_dofs, n_trace_dofs);
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  StaticCondensation<dim, Number, VectorizedArrayType>::assemble_local_systems(
+    const LocalAssemblerType &local_assembler)
+  {
+    Assert(matrix_free != nullptr, ExcNotInitialized());
+
+    constexpr unsigned int n_lanes   = VectorizedArrayType::size();
+    const unsigned int     n_batches = matrix_free->n_cell_batches();
+
+    // reset the matrices that have been factorized by a previous call
+    interior_matrices.reinit(n_batches * n_lanes,
+                             n_interior_dofs,
+                             n_interior_dofs);
+
+    // the user function may have state, so run it in serial and only
+    // parallelize the condensation below
+    LocalMatrixType A(n_interior_dofs, n_interior_dofs);
+    LocalMatrixType B(n_interior_dofs, n_trace_dofs);
+    LocalMatrixType C(n_trace_dofs, n_interior_dofs);
+    LocalMatrixType D(n_trace_dofs, n_trace_dofs);
+    for (unsigned int batch = 0; batch < n_batches; ++batch)
+      {
+        A.fill(VectorizedArrayType());
+        B.fill(VectorizedArrayType());
+        C.fill(VectorizedArrayType());
+        D.fill(VectorizedArrayType());
+        local_assembler(batch, A, B, C, D);
+
+        // replace the matrices in unused lanes by the identity matrix to
+        // keep the factorization well-defined
+        const unsigned int n_filled =
+          matrix_free->n_active_entries_per_cell_batch(batch);
+        for (unsigned int v = n_filled; v < n_lanes; ++v)
+          {
+            for (unsigned int i = 0; i < n_interior_dofs; ++i)
+              {
+                for (unsigned int j = 0; j < n_interior_dofs; ++j)
+                  A(i, j)[v] = Number(i == j);
+                for (unsigned int j = 0; j < n_trace_dofs; ++j)
+                  B(i, j)[v] = Number();
+              }
+            for (unsigned int i = 0; i < n_trace_dofs; ++i)
+              {
+                for (unsigned int j = 0; j < n_interior_dofs; ++j)
+                  C(i, j)[v] = Number();
+                for (unsigned int j = 0; j < n_trace_dofs; ++j)
+                  D(i, j)[v] = Number();
+              }
+          }
+
+        for (unsigned int i = 0; i < n_interior_dofs; ++i)
+          {
+            for (unsigned int j = 0; j < n_interior_dofs; ++j)
+              interior_matrices(batch, i, j) = A(i, j);
+            for (unsigned int j = 0; j < n_trace_dofs; ++j)
+              interior_solution_matrices(batch, i, j) = B(i, j);
+          }
+        for (unsigned int i = 0; i < n_trace_dofs; ++i)
+          {
+            for (unsigned int j = 0; j < n_interior_dofs; ++j)
+              negative_trace_interior_matrices(batch, i, j) = -C(i, j);
+            for (unsigned int j = 0; j < n_trace_dofs; ++j)
+              condensed_matrices(batch, i, j) = D(i, j);
+          }
+      }
+
+    interior_matrices.compute_lu_factorization();
+
+    // compute A^{-1} B column by column in place
+    parallel::apply_to_subranges(
+      0U,
+      n_batches,
+      [&](const unsigned int begin, const unsigned int end) {
+        AlignedVector<VectorizedArrayType> column(n_interior_dofs);
+        for (unsigned int batch = begin; batch < end; ++batch)
+          for (unsigned int j = 0; j < n_trace_dofs; ++j)
+            {
+              for (unsigned int i = 0; i < n_interior_dofs; ++i)
+                column[i] = interior_solution_matrices(batch, i, j);
+              interior_matrices.solve(batch, make_array_view(column));
+              for (unsigned int i = 0; i < n_interior_dofs; ++i)
+                interior_solution_matrices(batch, i, j) = column[i];
+            }
+      },
+      16);
+
+    // S = D + (-C) (A^{-1} B)
+    negative_trace_interior_matrices.mmult(condensed_matrices,
+                                           interior_solution_matrices,
+                                           true);
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  StaticCondensation<dim, Number, VectorizedArrayType>::initialize_trace_vector(
+    VectorType &vec) const
+  {
+    Assert(trace_partitioner.get() != nullptr, ExcNotInitialized());
+    vec.reinit(trace_partitioner);
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  StaticCondensation<dim, Number, VectorizedArrayType>::
+    initialize_interior_vector(VectorType &vec) const
+  {
+    Assert(matrix_free != nullptr, ExcNotInitialized());
+    matrix_free->initialize_dof_vector(vec, dof_no);
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  types::global_dof_index
+  StaticCondensation<dim, Number, VectorizedArrayType>::m() const
+  {
+    Assert(trace_partitioner.get() != nullptr, ExcNotInitialized());
+    return trace_partitioner->size();
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  StaticCondensation<dim, Number, VectorizedArrayType>::read_values(
+    const unsigned int                  cell_batch,
+    const std::vector<unsigned int>    &indices,
+    const unsigned int                  n_dofs,
+    const VectorType                   &vec,
+    const bool                          zero_constrained,
+    AlignedVector<VectorizedArrayType> &values) const
+  {
+    constexpr unsigned int n_lanes = VectorizedArrayType::size();
+    values.resize_fast(n_dofs);
+    values.fill(VectorizedArrayType());
+    const unsigned int *batch_indices =
+      indices.data() + cell_batch * n_lanes * n_dofs;
+    for (unsigned int v = 0;
+         v < matrix_free->n_active_entries_per_cell_batch(cell_batch);
+         ++v)
+      for (unsigned int i = 0; i < n_dofs; ++i)
+        {
+          const unsigned int index = batch_indices[v * n_dofs + i];
+          if (zero_constrained == false || trace_is_constrained[index] == false)
+            values[i][v] = vec.local_element(index);
+        }
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  StaticCondensation<dim, Number, VectorizedArrayType>::
+    distribute_trace_values(
+      const unsigned int                        cell_batch,
+      const AlignedVector<VectorizedArrayType> &values,
+      VectorType                               &vec) const
+  {
+    constexpr unsigned int n_lanes = VectorizedArrayType::size();
+    const unsigned int    *batch_indices =
+      trace_indices.data() + cell_batch * n_lanes * n_trace_dofs;
+    for (unsigned int v = 0;
+         v < matrix_free->n_active_entries_per_cell_batch(cell_batch);
+         ++v)
+      for (unsigned int i = 0; i < n_trace_dofs; ++i)
+        {
+          const unsigned int index = batch_indices[v * n_trace_dofs + i];
+          if (trace_is_constrained[index] == false)
+            vec.local_element(index) += values[i][v];
+        }
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  StaticCondensation<dim, Number, VectorizedArrayType>::condense_rhs(
+    VectorType       &trace_rhs,
+    const VectorType &interior_rhs) const
+  {
+    Assert(matrix_free != nullptr, ExcNotInitialized());
+    Assert(trace_rhs.get_partitioner()->is_compatible(*trace_partitioner),
+           ExcMessage("The trace vector has not been initialized by "
+                      "initialize_trace_vector()."));
+
+    // collect the values of the constrained unknowns to eliminate their
+    // columns from the trace system
+    VectorType constrained_values(trace_partitioner);
+    for (const auto &[index, value] : constrained_trace_dofs)
+      constrained_values.local_element(index) = value;
+    constrained_values.update_ghost_values();
+    const bool has_constrained_trace_dofs =
+      std::find(trace_is_constrained.begin(),
+                trace_is_constrained.end(),
+                true) != trace_is_constrained.end();
+
+    trace_rhs.zero_out_ghost_values();
+    AlignedVector<VectorizedArrayType> interior_values;
+    AlignedVector<VectorizedArrayType> trace_values;
+    AlignedVector<VectorizedArrayType> constrained_part;
+    AlignedVector<VectorizedArrayType> condensed_values(n_trace_dofs);
+    for (unsigned int batch = 0; batch < matrix_free->n_cell_batches();
+         ++batch)
+      {
+        read_values(batch,
+                    interior_indices,
+                    n_interior_dofs,
+                    interior_rhs,
+                    false,
+                    interior_values);
+        interior_matrices.solve(batch, make_array_view(interior_values));
+        negative_trace_interior_matrices.vmult(
+          batch,
+          make_array_view(condensed_values),
+          make_array_view(std::as_const(interior_values)));
+
+        if (has_constrained_trace_dofs)
+          {
+            read_values(batch,
+                        trace_indices,
+                        n_trace_dofs,
+                        constrained_values,
+                        false,
+                        trace_values);
+            constrained_part.resize_fast(n_trace_dofs);
+            condensed_matrices.vmult(batch,
+                                     make_array_view(constrained_part),
+                                     make_array_view(
+                                       std::as_const(trace_values)));
+            for (unsigned int i = 0; i < n_trace_dofs; ++i)
+              condensed_values[i] -= constrained_part[i];
+          }
+        distribute_trace_values(batch, condensed_values, trace_rhs);
+      }
+    trace_rhs.compress(VectorOperation::add);
+
+    for (const auto &[index, value] : constrained_trace_dofs)
+      trace_rhs.local_element(index) = value;
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  StaticCondensation<dim, Number, VectorizedArrayType>::vmult(
+    VectorType       &dst,
+    const VectorType &src) const
+  {
+    Assert(matrix_free != nullptr, ExcNotInitialized());
+    Assert(src.get_partitioner()->is_compatible(*trace_partitioner),
+           ExcMessage("The trace vector has not been initialized by "
+                      "initialize_trace_vector()."));
+
+    const bool src_has_ghosts = src.has_ghost_elements();
+    if (src_has_ghosts == false)
+      src.update_ghost_values();
+    dst.reinit(src, true);
+    dst = Number();
+
+    AlignedVector<VectorizedArrayType> src_values;
+    AlignedVector<VectorizedArrayType> dst_values(n_trace_dofs);
+    for (unsigned int batch = 0; batch < matrix_free->n_cell_batches();
+         ++batch)
+      {
+        read_values(
+          batch, trace_indices, n_trace_dofs, src, true, src_values);
+        condensed_matrices.vmult(batch,
+                                 make_array_view(dst_values),
+                                 make_array_view(std::as_const(src_values)));
+        distribute_trace_values(batch, dst_values, dst);
+      }
+    dst.compress(VectorOperation::add);
+
+    for (const auto &[index, value] : constrained_trace_dofs)
+      dst.local_element(index) = src.local_element(index);
+
+    if (src_has_ghosts == false)
+      src.zero_out_ghost_values();
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  StaticCondensation<dim, Number, VectorizedArrayType>::compute_diagonal(
+    VectorType &diagonal) const
+  {
+    initialize_trace_vector(diagonal);
+
+    AlignedVector<VectorizedArrayType> values(n_trace_dofs);
+    for (unsigned int batch = 0; batch < matrix_free->n_cell_batches();
+         ++batch)
+      {
+        for (unsigned int i = 0; i < n_trace_dofs; ++i)
+          values[i] = condensed_matrices(batch, i, i);
+        distribute_trace_values(batch, values, diagonal);
+      }
+    diagonal.compress(VectorOperation::add);
+
+    for (const auto &constrained : constrained_trace_dofs)
+      diagonal.local_element(constrained.first) = Number(1.);
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  StaticCondensation<dim, Number, VectorizedArrayType>::reconstruct_interior(
+    VectorType       &interior_solution,
+    const VectorType &interior_rhs,
+    const VectorType &trace_solution) const
+  {
+    Assert(matrix_free != nullptr, ExcNotInitialized());
+    Assert(trace_solution.get_partitioner()->is_compatible(
+             *trace_partitioner),
+           ExcMessage("The trace vector has not been initialized by "
+                      "initialize_trace_vector()."));
+
+    const bool trace_has_ghosts = trace_solution.has_ghost_elements();
+    if (trace_has_ghosts == false)
+      trace_solution.update_ghost_values();
+
+    constexpr unsigned int n_lanes = VectorizedArrayType::size();
+    parallel::apply_to_subranges(
+      0U,
+      matrix_free->n_cell_batches(),
+      [&](const unsigned int begin, const unsigned int end) {
+        AlignedVector<VectorizedArrayType> interior_values;
+        AlignedVector<VectorizedArrayType> trace_values;
+        AlignedVector<VectorizedArrayType> trace_part(n_interior_dofs);
+        for (unsigned int batch = begin; batch < end; ++batch)
+          {
+            read_values(batch,
+                        interior_indices,
+                        n_interior_dofs,
+                        interior_rhs,
+                        false,
+                        interior_values);
+            interior_matrices.solve(batch, make_array_view(interior_values));
+            read_values(batch,
+                        trace_indices,
+                        n_trace_dofs,
+                        trace_solution,
+                        false,
+                        trace_values);
+            interior_solution_matrices.vmult(batch,
+                                             make_array_view(trace_part),
+                                             make_array_view(
+                                               std::as_const(trace_values)));
+
+            // the interior unknowns of different cells are distinct, so
+            // the cell batches can be written concurrently
+            const unsigned int *batch_indices =
+              interior_indices.data() + batch * n_lanes * n_interior_dofs;
+            for (unsigned int v = 0;
+                 v < matrix_free->n_active_entries_per_cell_batch(batch);
+                 ++v)
+              for (unsigned int i = 0; i < n_interior_dofs; ++i)
+                interior_solution.local_element(
+                  batch_indices[v * n_interior_dofs + i]) =
+                  interior_values[i][v] - trace_part[i][v];
+          }
+      },
+      16);
+
+    if (trace_has_ghosts == false)
+      trace_solution.zero_out_ghost_values();
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  std::size_t
+  StaticCondensation<dim, Number, VectorizedArrayType>::memory_consumption()
+    const
+  {
+    return MemoryConsumption::memory_consumption(interior_indices) +
+           MemoryConsumption::memory_consumption(trace_indices) +
+           MemoryConsumption::memory_consumption(trace_is_constrained) +
+           MemoryConsumption::memory_consumption(constrained_trace_dofs) +
+           interior_matrices.memory_consumption() +
+           negative_trace_interior_matrices.memory_consumption() +
+           interior_solution_matrices.memory_consumption() +
+           condensed_matrices.memory_consumption();
+  }
+
+#endif // DOXYGEN
+
+} // namespace MatrixFreeTools
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -135,6 +135,40 @@ namespace internal
       void
       loop(MFWorkerInterface &worker) const;
 
+      /**
+       * Runs a cell-centric matrix-free loop, where the cell work of
+       * @p worker also contains the integrals over all faces of the cells
+       * and only writes into the entries of the cells it works on. For the
+       * threaded schemes, the partitions of the thread graph are scheduled
+       * without any face ranges, with the cells that depend on ghost data
+       * worked on after the import of the ghost data has completed.
+       */
+      void
+      loop_cell_centric(MFWorkerInterface &worker) const;
+
+      /**
+       * Runs two matrix-free loops in a single sweep over the cells, where
+       * the second loop reads the result of the first one. The range of
+       * cells with index `i` of the second loop is run as soon as the first
+       * loop has completed the range `stage[i]`, with a value equal to the
+       * number of ranges indicating that the range may only be run after the
+       * data exchange of the first loop, see
+       * DoFInfo::cell_loop_fused_stage. For the threaded schemes, the two
+       * loops are run one after the other.
+       */
+      void
+      loop(MFWorkerInterface               &first_worker,
+           MFWorkerInterface               &second_worker,
+           const std::vector<unsigned int> &stage) const;
+
+      /**
+       * Give the MPI library the chance to progress non-blocking messages
+       * posted by the data exchange of the loop, without completing any of
+       * the requests.
+       */
+      void
+      make_communication_progress() const;
+
       /**
        * Make the number of cells which can only be treated in the
        * communication overlap divisible by the vectorization length.
@@ -619,6 +653,14 @@ namespace internal
        */
       bool allow_ghosted_vectors_in_loops;
 
+      /**
+       * Number of cell batches after which the serial loop (scheme @p none)
+       * calls into MPI to progress the outstanding data exchange while
+       * working on the cells that do not depend on it. Zero disables the
+       * subdivision.
+       */
+      unsigned int communication_progress_interval;
+
       /**
        * Rank of MPI process
        */
@@ -17,14 +17,27 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/grid/tria.h>
 
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/vector.h>
+
 #include <deal.II/matrix_free/fe_evaluation.h>
 #include <deal.II/matrix_free/matrix_free.h>
 #include <deal.II/matrix_free/portable_fe_evaluation.h>
 #include <deal.II/matrix_free/portable_matrix_free.h>
 #include <deal.II/matrix_free/vector_access_internal.h>
 
+#include <deal.II/numerics/vector_tools_common.h>
+
+#include <functional>
+#include <numeric>
+#include <set>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -321,6 +334,44 @@ namespace MatrixFreeTools
     const unsigned int quad_no                  = 0,
     const unsigned int first_selected_component = 0);
 
+  /**
+   * Same as the first compute_matrix() function but for
+   * Portable::MatrixFree, with the cell operation given in terms of a
+   * @p quad_operation at each quadrature point and the evaluation and
+   * integration flags as in compute_diagonal(). The element
+   * matrices are computed on the device, where each team applies the
+   * operation to all unit vectors of a cell, including the resolution of
+   * hanging-node constraints. The element matrices are then copied to the
+   * host and added into @p matrix with @p constraints, which is meant to
+   * be the AffineConstraints object used to set up @p matrix_free.
+   * @p matrix needs to be initialized with a suitable sparsity pattern.
+   *
+   * If @p matrix provides an <tt>add_element_matrices()</tt> function
+   * working on device views, like
+   * LinearAlgebra::TpetraWrappers::SparseMatrix<Number,
+   * MemorySpace::Default>, the element matrices of all cells that have
+   * neither constrained degrees of freedom nor rows owned by another
+   * process are added directly on the device. Only the element matrices of
+   * the remaining cells are copied to the host.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename QuadOperation,
+            typename MatrixType>
+  void
+  compute_matrix(const Portable::MatrixFree<dim, Number> &matrix_free,
+                 const AffineConstraints<Number>         &constraints,
+                 MatrixType                              &matrix,
+                 const QuadOperation                     &quad_operation,
+                 EvaluationFlags::EvaluationFlags         evaluation_flags,
+                 EvaluationFlags::EvaluationFlags         integration_flags,
+                 const unsigned int                       dof_no  = 0,
+                 const unsigned int                       quad_no = 0,
+                 const unsigned int first_selected_component      = 0);
+
 
   namespace internal
   {
@@ -471,6 +522,179 @@ namespace MatrixFreeTools
 
 
 
+  /**
+   * Compute the error indicator of Kelly, Gago, Zienkiewicz and Babuska for
+   * the field given by @p solution on all locally owned active cells of the
+   * mesh underlying @p matrix_free, i.e., the quantity
+   * @f[
+   *   \eta_K^2 = \frac{h_K}{24} \sum_{F \in \partial K}
+   *              \int_F \left[\frac{\partial u_h}{\partial n}\right]^2,
+   * @f]
+   * summed over the components of the finite element. This is the same
+   * quantity that KellyErrorEstimator::estimate() computes with its default
+   * strategy KellyErrorEstimator::cell_diameter_over_24 and without a
+   * coefficient. Unlike KellyErrorEstimator, this function computes the jumps
+   * in the gradient with FEFaceEvaluation, i.e., via sum factorization on
+   * batches of faces. That makes it considerably faster for high polynomial
+   * degrees.
+   *
+   * Boundary faces do not contribute to the indicator, except for faces with a
+   * boundary id in @p neumann_boundary_ids. On those faces, the normal
+   * derivative itself is the jump, as for homogeneous Neumann conditions in
+   * KellyErrorEstimator.
+   *
+   * On return, @p error has one entry per active cell of the triangulation,
+   * indexed by CellAccessor::active_cell_index(). Its entries are zero on
+   * cells that are not locally owned.
+   *
+   * @p matrix_free must have been set up with at least the flags
+   * update_gradients and update_JxW_values for inner and boundary faces. On
+   * meshes distributed across several processes, it also needs
+   * MatrixFree::AdditionalData::hold_all_faces_to_owned_cells set, so that
+   * the faces between processes are present on both sides. Like
+   * KellyErrorEstimator, the function reads the entries of @p solution as
+   * they are, without resolving constraints. It hence expects that constraints
+   * have been distributed and that the ghost values of the vector have been
+   * updated.
+   *
+   * The parameters @p dof_no, @p quad_no, and @p first_selected_component are
+   * passed to the constructor of the FEFaceEvaluation objects set up
+   * internally. The quadrature formula selected by @p quad_no is used for the
+   * face integrals. It should be exact for polynomials of degree $2p$ for
+   * elements of degree $p$, such as a Gauss formula with $p+1$ points.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  estimate_error_kelly(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const VectorType                                   &solution,
+    Vector<float>                                      &error,
+    const std::set<types::boundary_id> &neumann_boundary_ids     = {},
+    const unsigned int                  dof_no                   = 0,
+    const unsigned int                  quad_no                  = 0,
+    const unsigned int                  first_selected_component = 0);
+
+
+
+  /**
+   * Compute the difference between the finite element field given by
+   * @p solution and a reference function on all locally owned active cells of
+   * the mesh underlying @p matrix_free, in the norm selected by @p norm. This
+   * is the matrix-free counterpart of VectorTools::integrate_difference(),
+   * with the same meaning of the output vector @p difference: it has one
+   * entry per active cell of the triangulation, indexed by
+   * CellAccessor::active_cell_index(), and its entries are zero on cells that
+   * are not locally owned. The global error can then be computed with
+   * VectorTools::compute_global_error().
+   *
+   * The field is evaluated with FEEvaluation, i.e., via sum factorization on
+   * batches of cells; the cell batches are worked on in parallel. The
+   * reference function is given by the function objects @p exact_value and
+   * @p exact_gradient, which are evaluated for all points of a batch at once
+   * on a Point<dim, VectorizedArrayType>. An empty function object represents
+   * a zero reference function, so that passing two empty objects computes the
+   * norm of @p solution itself. @p exact_gradient is only used for the norms
+   * that involve derivatives.
+   *
+   * The supported norms are VectorTools::mean, VectorTools::L1_norm,
+   * VectorTools::L2_norm, VectorTools::Linfty_norm, VectorTools::H1_seminorm,
+   * and VectorTools::H1_norm. The maximum norm is computed on the quadrature
+   * points only. For vector-valued elements, the norms are computed as in
+   * VectorTools::integrate_difference() without a weight function.
+   *
+   * @p matrix_free must have been set up with the flags update_gradients (for
+   * the norms with derivatives) and update_JxW_values on cells, plus
+   * update_quadrature_points if a reference function is given. Like
+   * VectorTools::integrate_difference(), the function reads the entries of
+   * @p solution as they are, without resolving constraints, and expects
+   * that the ghost values of the vector have been updated.
+   *
+   * The parameters @p dof_no, @p quad_no, and @p first_selected_component are
+   * passed to the constructor of the FEEvaluation object that is internally
+   * set up.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  integrate_difference(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const VectorType                                   &solution,
+    const std_cxx20::type_identity_t<std::function<
+      typename FEEvaluation<dim,
+                            fe_degree,
+                            n_q_points_1d,
+                            n_components,
+                            Number,
+                            VectorizedArrayType>::value_type(
+        const Point<dim, VectorizedArrayType> &)>> &exact_value,
+    const std_cxx20::type_identity_t<std::function<
+      typename FEEvaluation<dim,
+                            fe_degree,
+                            n_q_points_1d,
+                            n_components,
+                            Number,
+                            VectorizedArrayType>::gradient_type(
+        const Point<dim, VectorizedArrayType> &)>> &exact_gradient,
+    Vector<float>                                  &difference,
+    const VectorTools::NormType                     norm,
+    const unsigned int                              dof_no  = 0,
+    const unsigned int                              quad_no = 0,
+    const unsigned int first_selected_component             = 0);
+
+
+
+  /**
+   * Compute the $L_2$ projection of the function given by @p function onto
+   * the finite element space described by @p matrix_free and store it in
+   * @p vec. This is the counterpart of VectorTools::project() for
+   * Portable::MatrixFree: The right hand side is assembled by a cell loop on
+   * the device, and the mass matrix system is solved by a conjugate gradient
+   * method preconditioned by the inverse of the diagonal of the mass matrix,
+   * using the device vectors directly. No data is transferred between host
+   * and device except for the reductions of the solver.
+   *
+   * @p function must be a class that can be copied to the device and that
+   * provides the member function
+   * @code
+   *   DEAL_II_HOST_DEVICE Number
+   *   operator()(const Point<dim, Number> &p) const;
+   * @endcode
+   * returning the value of the function to be projected at the point @p p.
+   *
+   * @p matrix_free must have been set up for a scalar element of degree
+   * @p fe_degree with a quadrature formula of @p n_q_points_1d points per
+   * direction, with the flags update_values, update_JxW_values, and
+   * update_quadrature_points. As with all operators based on
+   * Portable::MatrixFree, only homogeneous constraints are supported, and on
+   * return the constrained entries of @p vec are zero. If (for example)
+   * hanging node constraints are present, the values of the constrained
+   * degrees of freedom can be computed by calling
+   * AffineConstraints::distribute() after copying the vector to the host.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            typename Number,
+            typename Functor>
+  void
+  project(
+    const Portable::MatrixFree<dim, Number> &matrix_free,
+    const Functor                           &function,
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Default> &vec);
+
+
+
   /**
    * A wrapper around MatrixFree to help users to deal with DoFHandler
    * objects involving cells without degrees of freedom, i.e.,
@@ -1467,6 +1691,110 @@ namespace MatrixFreeTools
   };
 
 
+
+  namespace internal
+  {
+    // a helper type-trait leveraging SFINAE to figure out if type T has
+    // void T::add_element_matrices(device view of element matrices,
+    //                              device view of dof indices)
+    template <typename T, typename Number>
+    using add_element_matrices_t =
+      decltype(std::declval<T>().add_element_matrices(
+        std::declval<
+          Kokkos::View<const Number ***, MemorySpace::Default::kokkos_space>>(),
+        std::declval<Kokkos::View<const types::global_dof_index **,
+                                  MemorySpace::Default::kokkos_space>>()));
+
+    template <typename T, typename Number>
+    constexpr bool has_add_element_matrices =
+      dealii::internal::is_supported_operation<add_element_matrices_t,
+                                               T,
+                                               Number>;
+  } // namespace internal
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            typename Number,
+            typename QuadOperation>
+  class CellMatrixAction
+  {
+  public:
+    CellMatrixAction(
+      const QuadOperation                   &quad_operation,
+      const EvaluationFlags::EvaluationFlags evaluation_flags,
+      const EvaluationFlags::EvaluationFlags integration_flags,
+      const Kokkos::View<Number ***, MemorySpace::Default::kokkos_space>
+        &cell_matrices)
+      : m_quad_operation(quad_operation)
+      , m_evaluation_flags(evaluation_flags)
+      , m_integration_flags(integration_flags)
+      , m_cell_matrices(cell_matrices)
+    {}
+
+    KOKKOS_FUNCTION void
+    operator()(const unsigned int                                      cell,
+               const typename Portable::MatrixFree<dim, Number>::Data *gpu_data,
+               Portable::SharedData<dim, Number> *shared_data,
+               const Number *,
+               Number *) const
+    {
+      Portable::FEEvaluation<dim, fe_degree, n_q_points_1d, 1, Number> fe_eval(
+        gpu_data, shared_data);
+      m_quad_operation.set_matrix_free_data(*gpu_data);
+      m_quad_operation.set_cell(cell);
+      constexpr int dofs_per_cell = decltype(fe_eval)::tensor_dofs_per_cell;
+
+      // index of the cell among the cells of all colors
+      const unsigned int cell_index =
+        gpu_data->row_start / gpu_data->padding_length + cell;
+
+      for (unsigned int j = 0; j < dofs_per_cell; ++j)
+        {
+          Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(shared_data->team_member, dofs_per_cell),
+            [&](int i) { fe_eval.submit_dof_value(i == j ? 1 : 0, i); });
+
+          Portable::internal::
+            resolve_hanging_nodes<dim, fe_degree, false, Number>(
+              shared_data->team_member,
+              gpu_data->constraint_weights,
+              gpu_data->constraint_mask(cell),
+              Kokkos::subview(shared_data->values, Kokkos::ALL, 0));
+
+          fe_eval.evaluate(m_evaluation_flags);
+          fe_eval.apply_for_each_quad_point(m_quad_operation);
+          fe_eval.integrate(m_integration_flags);
+
+          Portable::internal::
+            resolve_hanging_nodes<dim, fe_degree, true, Number>(
+              shared_data->team_member,
+              gpu_data->constraint_weights,
+              gpu_data->constraint_mask(cell),
+              Kokkos::subview(shared_data->values, Kokkos::ALL, 0));
+
+          Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(shared_data->team_member, dofs_per_cell),
+            [&](const int &i) {
+              m_cell_matrices(cell_index, i, j) = shared_data->values(i, 0);
+            });
+          shared_data->team_member.team_barrier();
+        }
+    };
+
+    static constexpr unsigned int n_local_dofs = QuadOperation::n_local_dofs;
+
+  private:
+    mutable QuadOperation                  m_quad_operation;
+    const EvaluationFlags::EvaluationFlags m_evaluation_flags;
+    const EvaluationFlags::EvaluationFlags m_integration_flags;
+    const Kokkos::View<Number ***, MemorySpace::Default::kokkos_space>
+      m_cell_matrices;
+  };
+
+
   template <int dim,
             int fe_degree,
             int n_q_points_1d,
@@ -1490,6 +1818,9 @@ namespace MatrixFreeTools
     Assert(quad_no == 0, ExcNotImplemented());
     Assert(first_selected_component == 0, ExcNotImplemented());
     Assert(first_vector_component == 0, ExcNotImplemented());
+    AssertThrow(matrix_free.get_cells_per_block() == 1,
+                ExcMessage("The diagonal can only be computed if each team "
+                           "processes a single cell."));
 
     matrix_free.initialize_dof_vector(diagonal_global);
 
@@ -1502,6 +1833,200 @@ namespace MatrixFreeTools
     matrix_free.set_constrained_values(Number(1.), diagonal_global);
   }
 
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename QuadOperation,
+            typename MatrixType>
+  void
+  compute_matrix(const Portable::MatrixFree<dim, Number> &matrix_free,
+                 const AffineConstraints<Number>         &constraints,
+                 MatrixType                              &matrix,
+                 const QuadOperation                     &quad_operation,
+                 EvaluationFlags::EvaluationFlags         evaluation_flags,
+                 EvaluationFlags::EvaluationFlags         integration_flags,
+                 const unsigned int                       dof_no,
+                 const unsigned int                       quad_no,
+                 const unsigned int first_selected_component)
+  {
+    Assert(dof_no == 0, ExcNotImplemented());
+    Assert(quad_no == 0, ExcNotImplemented());
+    Assert(first_selected_component == 0, ExcNotImplemented());
+    AssertThrow(matrix_free.get_cells_per_block() == 1,
+                ExcMessage("The matrix can only be computed if each team "
+                           "processes a single cell."));
+
+    constexpr unsigned int dofs_per_cell =
+      Utilities::pow(fe_degree + 1, dim);
+
+    const auto        &colored_graph = matrix_free.get_colored_graph();
+    const unsigned int n_colors      = colored_graph.size();
+
+    unsigned int n_cells = 0;
+    for (unsigned int color = 0; color < n_colors; ++color)
+      n_cells += matrix_free.get_data(color).n_cells;
+
+    // compute the element matrices of all cells on the device
+    Kokkos::View<Number ***, MemorySpace::Default::kokkos_space> cell_matrices(
+      Kokkos::view_alloc("cell_matrices", Kokkos::WithoutInitializing),
+      n_cells,
+      dofs_per_cell,
+      dofs_per_cell);
+
+    CellMatrixAction<dim, fe_degree, n_q_points_1d, Number, QuadOperation>
+      cell_action(quad_operation,
+                  evaluation_flags,
+                  integration_flags,
+                  cell_matrices);
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Default> dummy;
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Default> dst;
+    matrix_free.initialize_dof_vector(dst);
+    matrix_free.cell_loop(cell_action, dummy, dst);
+
+    // translate the indices of the local vector entries used by the device
+    // data structures to global indices
+    const auto partitioner = matrix_free.get_vector_partitioner();
+
+    std::vector<types::global_dof_index> dof_indices(n_cells * dofs_per_cell);
+    for (unsigned int color = 0; color < n_colors; ++color)
+      {
+        const auto data = matrix_free.get_data(color);
+        const auto local_to_global_host =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                              data.local_to_global);
+        const unsigned int first_cell = data.row_start / data.padding_length;
+
+        for (unsigned int cell = 0; cell < data.n_cells; ++cell)
+          for (unsigned int i = 0; i < dofs_per_cell; ++i)
+            dof_indices[(first_cell + cell) * dofs_per_cell + i] =
+              partitioner ?
+                partitioner->local_to_global(local_to_global_host(cell, i)) :
+                local_to_global_host(cell, i);
+      }
+
+    // If the matrix can add element matrices in device memory, the cells
+    // without constrained degrees of freedom whose rows are owned by the
+    // matrix are added without leaving the device. The remaining cells are
+    // condensed on the host.
+    std::vector<unsigned int> host_cells;
+    if constexpr (internal::has_add_element_matrices<MatrixType, Number>)
+      {
+        const IndexSet owned_rows = matrix.locally_owned_range_indices();
+
+        std::vector<unsigned int> device_cells;
+        for (unsigned int cell = 0; cell < n_cells; ++cell)
+          {
+            bool add_on_device = true;
+            for (unsigned int i = 0; i < dofs_per_cell; ++i)
+              {
+                const types::global_dof_index index =
+                  dof_indices[cell * dofs_per_cell + i];
+                if (constraints.is_constrained(index) ||
+                    owned_rows.is_element(index) == false)
+                  {
+                    add_on_device = false;
+                    break;
+                  }
+              }
+
+            if (add_on_device)
+              device_cells.push_back(cell);
+            else
+              host_cells.push_back(cell);
+          }
+
+        const unsigned int n_device_cells = device_cells.size();
+        if (n_device_cells > 0)
+          {
+            Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>
+              device_cell_ids(Kokkos::view_alloc("device_cell_ids",
+                                                 Kokkos::WithoutInitializing),
+                              n_device_cells);
+            Kokkos::View<types::global_dof_index **,
+                         MemorySpace::Default::kokkos_space>
+              device_dof_indices(Kokkos::view_alloc(
+                                   "device_dof_indices",
+                                   Kokkos::WithoutInitializing),
+                                 n_device_cells,
+                                 dofs_per_cell);
+            auto device_cell_ids_host =
+              Kokkos::create_mirror_view(device_cell_ids);
+            auto device_dof_indices_host =
+              Kokkos::create_mirror_view(device_dof_indices);
+            for (unsigned int c = 0; c < n_device_cells; ++c)
+              {
+                device_cell_ids_host(c) = device_cells[c];
+                for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                  device_dof_indices_host(c, i) =
+                    dof_indices[device_cells[c] * dofs_per_cell + i];
+              }
+            Kokkos::deep_copy(device_cell_ids, device_cell_ids_host);
+            Kokkos::deep_copy(device_dof_indices, device_dof_indices_host);
+
+            // gather the element matrices of the selected cells
+            Kokkos::View<Number ***, MemorySpace::Default::kokkos_space>
+              device_cell_matrices(
+                Kokkos::view_alloc("device_cell_matrices",
+                                   Kokkos::WithoutInitializing),
+                n_device_cells,
+                dofs_per_cell,
+                dofs_per_cell);
+            Kokkos::parallel_for(
+              "dealii::MatrixFreeTools::compute_matrix_gather",
+              Kokkos::MDRangePolicy<
+                MemorySpace::Default::kokkos_space::execution_space,
+                Kokkos::Rank<3>>({0, 0, 0},
+                                 {n_device_cells,
+                                  dofs_per_cell,
+                                  dofs_per_cell}),
+              KOKKOS_LAMBDA(const int c, const int i, const int j) {
+                device_cell_matrices(c, i, j) =
+                  cell_matrices(device_cell_ids(c), i, j);
+              });
+
+            matrix.add_element_matrices(device_cell_matrices,
+                                        device_dof_indices);
+          }
+      }
+    else
+      {
+        host_cells.resize(n_cells);
+        std::iota(host_cells.begin(), host_cells.end(), 0U);
+      }
+
+    // copy the remaining element matrices to the host and add them into the
+    // matrix
+    if (host_cells.size() > 0)
+      {
+        const auto cell_matrices_host =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                              cell_matrices);
+
+        FullMatrix<typename MatrixType::value_type> cell_matrix(
+          dofs_per_cell);
+        std::vector<types::global_dof_index> cell_dof_indices(dofs_per_cell);
+        for (const unsigned int cell : host_cells)
+          {
+            for (unsigned int i = 0; i < dofs_per_cell; ++i)
+              cell_dof_indices[i] = dof_indices[cell * dofs_per_cell + i];
+
+            for (unsigned int i = 0; i < dofs_per_cell; ++i)
+              for (unsigned int j = 0; j < dofs_per_cell; ++j)
+                cell_matrix(i, j) = cell_matrices_host(cell, i, j);
+
+            constraints.distribute_local_to_global(cell_matrix,
+                                                   cell_dof_indices,
+                                                   matrix);
+          }
+      }
+
+    matrix.compress(VectorOperation::add);
+  }
+
   template <int dim,
             int fe_degree,
             int n_q_points_1d,
@@ -2591,6 +3116,498 @@ namespace MatrixFreeTools
       first_selected_component);
   }
 
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  estimate_error_kelly(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const VectorType                                   &solution,
+    Vector<float>                                      &error,
+    const std::set<types::boundary_id>                 &neumann_boundary_ids,
+    const unsigned int                                  dof_no,
+    const unsigned int                                  quad_no,
+    const unsigned int first_selected_component)
+  {
+    using FEFaceIntegrator = FEFaceEvaluation<dim,
+                                              fe_degree,
+                                              n_q_points_1d,
+                                              n_components,
+                                              Number,
+                                              VectorizedArrayType>;
+
+    const unsigned int n_inner_faces = matrix_free.n_inner_face_batches();
+    const unsigned int n_faces =
+      n_inner_faces + matrix_free.n_boundary_face_batches();
+
+    // compute the integrals of the squared jumps in the normal derivative on
+    // all face batches; each face batch has its own slot, so the batches can
+    // be worked on in parallel
+    AlignedVector<VectorizedArrayType> face_integrals(n_faces);
+
+    const auto integrate_jumps = [&](const unsigned int begin,
+                                     const unsigned int end) {
+      FEFaceIntegrator phi_m(
+        matrix_free, true, dof_no, quad_no, first_selected_component);
+      FEFaceIntegrator phi_p(
+        matrix_free, false, dof_no, quad_no, first_selected_component);
+
+      for (unsigned int face = begin; face < end; ++face)
+        {
+          face_integrals[face] = VectorizedArrayType();
+
+          const bool is_inner_face = (face < n_inner_faces);
+          if (is_inner_face == false &&
+              neumann_boundary_ids.find(matrix_free.get_boundary_id(face)) ==
+                neumann_boundary_ids.end())
+            continue;
+
+          phi_m.reinit(face);
+          phi_m.read_dof_values_plain(solution);
+          phi_m.evaluate(EvaluationFlags::gradients);
+          if (is_inner_face)
+            {
+              phi_p.reinit(face);
+              phi_p.read_dof_values_plain(solution);
+              phi_p.evaluate(EvaluationFlags::gradients);
+            }
+
+          // both sides use their own outward normal vector, so the jump is
+          // the sum of the two normal derivatives
+          for (const unsigned int q : phi_m.quadrature_point_indices())
+            {
+              auto jump = phi_m.get_normal_derivative(q);
+              if (is_inner_face)
+                jump += phi_p.get_normal_derivative(q);
+
+              if constexpr (n_components == 1)
+                face_integrals[face] += jump * jump * phi_m.JxW(q);
+              else
+                face_integrals[face] += jump.norm_square() * phi_m.JxW(q);
+            }
+        }
+    };
+
+    parallel::apply_to_subranges(0U, n_faces, integrate_jumps, 32);
+
+    // then collect the contributions of the faces for each cell; a face
+    // between two processes is present on both of them, so it suffices to
+    // add to the locally owned cells
+    error.reinit(matrix_free.get_dof_handler(dof_no)
+                   .get_triangulation()
+                   .n_active_cells());
+
+    for (unsigned int face = 0; face < n_faces; ++face)
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_face_batch(face);
+           ++v)
+        for (const bool interior : {true, false})
+          {
+            if (interior == false && face >= n_inner_faces)
+              break;
+
+            const auto cell =
+              matrix_free.get_face_iterator(face, v, interior).first;
+            if (cell->is_locally_owned())
+              error[cell->active_cell_index()] +=
+                cell->diameter() / 24. * face_integrals[face][v];
+          }
+
+    for (auto &value : error)
+      value = std::sqrt(value);
+  }
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  integrate_difference(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const VectorType                                   &solution,
+    const std_cxx20::type_identity_t<std::function<
+      typename FEEvaluation<dim,
+                            fe_degree,
+                            n_q_points_1d,
+                            n_components,
+                            Number,
+                            VectorizedArrayType>::value_type(
+        const Point<dim, VectorizedArrayType> &)>> &exact_value,
+    const std_cxx20::type_identity_t<std::function<
+      typename FEEvaluation<dim,
+                            fe_degree,
+                            n_q_points_1d,
+                            n_components,
+                            Number,
+                            VectorizedArrayType>::gradient_type(
+        const Point<dim, VectorizedArrayType> &)>> &exact_gradient,
+    Vector<float>                                  &difference,
+    const VectorTools::NormType                     norm,
+    const unsigned int                              dof_no,
+    const unsigned int                              quad_no,
+    const unsigned int                              first_selected_component)
+  {
+    using FEEval = FEEvaluation<dim,
+                                fe_degree,
+                                n_q_points_1d,
+                                n_components,
+                                Number,
+                                VectorizedArrayType>;
+
+    bool need_values = false, need_gradients = false;
+    switch (norm)
+      {
+        case VectorTools::mean:
+        case VectorTools::L1_norm:
+        case VectorTools::L2_norm:
+        case VectorTools::Linfty_norm:
+          need_values = true;
+          break;
+        case VectorTools::H1_seminorm:
+          need_gradients = true;
+          break;
+        case VectorTools::H1_norm:
+          need_values    = true;
+          need_gradients = true;
+          break;
+        default:
+          AssertThrow(false,
+                      ExcMessage("This norm is not supported by the "
+                                 "matrix-free version of "
+                                 "integrate_difference()."));
+      }
+
+    const EvaluationFlags::EvaluationFlags evaluation_flags =
+      (need_values ? EvaluationFlags::values : EvaluationFlags::nothing) |
+      (need_gradients ? EvaluationFlags::gradients : EvaluationFlags::nothing);
+
+    difference.reinit(matrix_free.get_dof_handler(dof_no)
+                        .get_triangulation()
+                        .n_active_cells());
+
+    const bool need_points =
+      (need_values && exact_value) || (need_gradients && exact_gradient);
+
+    // each cell batch writes to the entries of its own cells, so the batches
+    // can be worked on in parallel
+    const auto integrate_on_cells = [&](const unsigned int begin,
+                                        const unsigned int end) {
+      FEEval phi(matrix_free, dof_no, quad_no, first_selected_component);
+
+      for (unsigned int cell = begin; cell < end; ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values_plain(solution);
+          phi.evaluate(evaluation_flags);
+
+          VectorizedArrayType cell_value = VectorizedArrayType();
+          for (const unsigned int q : phi.quadrature_point_indices())
+            {
+              const Point<dim, VectorizedArrayType> point =
+                need_points ? phi.quadrature_point(q) :
+                              Point<dim, VectorizedArrayType>();
+
+              VectorizedArrayType point_value = VectorizedArrayType();
+              if (need_values)
+                {
+                  typename FEEval::value_type value = phi.get_value(q);
+                  if (exact_value)
+                    value -= exact_value(point);
+
+                  if constexpr (n_components == 1)
+                    {
+                      if (norm == VectorTools::mean)
+                        point_value = value;
+                      else if (norm == VectorTools::L1_norm ||
+                               norm == VectorTools::Linfty_norm)
+                        point_value = std::abs(value);
+                      else
+                        point_value = value * value;
+                    }
+                  else
+                    for (unsigned int c = 0; c < n_components; ++c)
+                      {
+                        if (norm == VectorTools::mean)
+                          point_value += value[c];
+                        else if (norm == VectorTools::L1_norm)
+                          point_value += std::abs(value[c]);
+                        else if (norm == VectorTools::Linfty_norm)
+                          point_value =
+                            std::max(point_value, std::abs(value[c]));
+                        else
+                          point_value += value[c] * value[c];
+                      }
+                }
+
+              if (need_gradients)
+                {
+                  typename FEEval::gradient_type gradient =
+                    phi.get_gradient(q);
+                  if (exact_gradient)
+                    gradient -= exact_gradient(point);
+
+                  if constexpr (n_components == 1)
+                    point_value += gradient.norm_square();
+                  else
+                    for (unsigned int c = 0; c < n_components; ++c)
+                      for (unsigned int d = 0; d < dim; ++d)
+                        point_value += gradient[c][d] * gradient[c][d];
+                }
+
+              if (norm == VectorTools::Linfty_norm)
+                cell_value = std::max(cell_value, point_value);
+              else
+                cell_value += point_value * phi.JxW(q);
+            }
+
+          for (unsigned int v = 0;
+               v < matrix_free.n_active_entries_per_cell_batch(cell);
+               ++v)
+            {
+              const auto dof_cell =
+                matrix_free.get_cell_iterator(cell, v, dof_no);
+              switch (norm)
+                {
+                  case VectorTools::mean:
+                  case VectorTools::L1_norm:
+                  case VectorTools::Linfty_norm:
+                    difference[dof_cell->active_cell_index()] = cell_value[v];
+                    break;
+                  default:
+                    difference[dof_cell->active_cell_index()] =
+                      std::sqrt(cell_value[v]);
+                }
+            }
+        }
+    };
+
+    parallel::apply_to_subranges(0U,
+                                 matrix_free.n_cell_batches(),
+                                 integrate_on_cells,
+                                 16);
+  }
+
+
+  namespace internal
+  {
+    /**
+     * The quadrature point operation of a mass matrix, in the form expected
+     * by the Portable version of compute_diagonal().
+     */
+    template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+    class PortableMassOperatorQuad
+    {
+    public:
+      DEAL_II_HOST_DEVICE void
+      operator()(
+        Portable::FEEvaluation<dim, fe_degree, n_q_points_1d, 1, Number>
+                 *fe_eval,
+        const int q_point) const
+      {
+        fe_eval->submit_value(fe_eval->get_value(q_point), q_point);
+      }
+
+      DEAL_II_HOST_DEVICE void
+      set_matrix_free_data(
+        const typename Portable::MatrixFree<dim, Number>::Data &)
+      {}
+
+      DEAL_II_HOST_DEVICE void
+      set_cell(const int)
+      {}
+
+      static constexpr unsigned int n_q_points =
+        Utilities::pow(n_q_points_1d, dim);
+
+      static constexpr unsigned int n_local_dofs =
+        Utilities::pow(fe_degree + 1, dim);
+    };
+
+
+
+    /**
+     * The cell operation of a mass matrix for
+     * Portable::MatrixFree::cell_loop().
+     */
+    template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+    class PortableMassOperatorCell
+    {
+    public:
+      DEAL_II_HOST_DEVICE void
+      operator()(
+        const unsigned int,
+        const typename Portable::MatrixFree<dim, Number>::Data *gpu_data,
+        Portable::SharedData<dim, Number>                      *shared_data,
+        const Number                                           *src,
+        Number                                                 *dst) const
+      {
+        Portable::FEEvaluation<dim, fe_degree, n_q_points_1d, 1, Number>
+          fe_eval(gpu_data, shared_data);
+        fe_eval.read_dof_values(src);
+        fe_eval.evaluate(EvaluationFlags::values);
+        fe_eval.apply_for_each_quad_point(
+          PortableMassOperatorQuad<dim, fe_degree, n_q_points_1d, Number>());
+        fe_eval.integrate(EvaluationFlags::values);
+        fe_eval.distribute_local_to_global(dst);
+      }
+
+      static constexpr unsigned int n_dofs_1d = fe_degree + 1;
+      static constexpr unsigned int n_local_dofs =
+        Utilities::pow(fe_degree + 1, dim);
+      static constexpr unsigned int n_q_points =
+        Utilities::pow(n_q_points_1d, dim);
+    };
+
+
+
+    /**
+     * The cell operation that assembles the right hand side of the projection
+     * of the function given by @p Functor.
+     */
+    template <int dim,
+              int fe_degree,
+              int n_q_points_1d,
+              typename Number,
+              typename Functor>
+    class PortableProjectionRightHandSide
+    {
+    public:
+      PortableProjectionRightHandSide(const Functor &function)
+        : function(function)
+      {}
+
+      DEAL_II_HOST_DEVICE void
+      operator()(
+        const unsigned int                                      cell,
+        const typename Portable::MatrixFree<dim, Number>::Data *gpu_data,
+        Portable::SharedData<dim, Number>                      *shared_data,
+        const Number *,
+        Number *dst) const
+      {
+        Portable::FEEvaluation<dim, fe_degree, n_q_points_1d, 1, Number>
+          fe_eval(gpu_data, shared_data);
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(shared_data->team_member, n_q_points),
+          [&](const int &q) {
+            fe_eval.submit_value(
+              function(gpu_data->get_quadrature_point(cell, q)), q);
+          });
+        shared_data->team_member.team_barrier();
+        fe_eval.integrate(EvaluationFlags::values);
+        fe_eval.distribute_local_to_global(dst);
+      }
+
+      static constexpr unsigned int n_dofs_1d = fe_degree + 1;
+      static constexpr unsigned int n_local_dofs =
+        Utilities::pow(fe_degree + 1, dim);
+      static constexpr unsigned int n_q_points =
+        Utilities::pow(n_q_points_1d, dim);
+
+    private:
+      const Functor function;
+    };
+
+
+
+    /**
+     * A wrapper around PortableMassOperatorCell with the interface expected
+     * by SolverCG.
+     */
+    template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+    class PortableMassOperator
+    {
+    public:
+      using VectorType =
+        LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>;
+
+      PortableMassOperator(const Portable::MatrixFree<dim, Number> &matrix_free)
+        : matrix_free(matrix_free)
+      {}
+
+      void
+      vmult(VectorType &dst, const VectorType &src) const
+      {
+        dst = Number();
+        matrix_free.cell_loop(
+          PortableMassOperatorCell<dim, fe_degree, n_q_points_1d, Number>(),
+          src,
+          dst);
+        matrix_free.copy_constrained_values(src, dst);
+      }
+
+    private:
+      const Portable::MatrixFree<dim, Number> &matrix_free;
+    };
+  } // namespace internal
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            typename Number,
+            typename Functor>
+  void
+  project(
+    const Portable::MatrixFree<dim, Number> &matrix_free,
+    const Functor                           &function,
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Default> &vec)
+  {
+    using VectorType =
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>;
+
+    // assemble the right hand side on the device
+    VectorType rhs, dummy;
+    matrix_free.initialize_dof_vector(rhs);
+    matrix_free.cell_loop(
+      internal::PortableProjectionRightHandSide<dim,
+                                                fe_degree,
+                                                n_q_points_1d,
+                                                Number,
+                                                Functor>(function),
+      dummy,
+      rhs);
+    matrix_free.set_constrained_values(Number(), rhs);
+
+    // compute the inverse of the diagonal of the mass matrix as preconditioner
+    DiagonalMatrix<VectorType> preconditioner;
+    VectorType                &inverse_diagonal = preconditioner.get_vector();
+    compute_diagonal<dim, fe_degree, n_q_points_1d, 1, Number>(
+      matrix_free,
+      inverse_diagonal,
+      internal::
+        PortableMassOperatorQuad<dim, fe_degree, n_q_points_1d, Number>(),
+      EvaluationFlags::values,
+      EvaluationFlags::values);
+    Number *raw_diagonal = inverse_diagonal.get_values();
+    Kokkos::parallel_for(
+      inverse_diagonal.locally_owned_size(), KOKKOS_LAMBDA(int i) {
+        raw_diagonal[i] = Number(1.) / raw_diagonal[i];
+      });
+
+    // then solve the mass matrix system. As in VectorTools::project(), allow
+    // for more than n steps to reach the tolerance since roundoff errors may
+    // accumulate for badly conditioned matrices
+    const internal::PortableMassOperator<dim, fe_degree, n_q_points_1d, Number>
+      mass_operator(matrix_free);
+    matrix_free.initialize_dof_vector(vec);
+
+    ReductionControl     control(5 * rhs.size(), 0., 1e-12, false, false);
+    SolverCG<VectorType> cg(control);
+    cg.solve(mass_operator, vec, rhs, preconditioner);
+  }
+
+
+
 #endif // DOXYGEN
 
 } // namespace MatrixFreeTools
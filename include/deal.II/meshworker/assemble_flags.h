@@ -85,6 +85,14 @@ namespace MeshWorker
      */
     cells_after_faces = 0x0080,
 
+    /**
+     * Schedule every interior face as a work item of its own, rather than
+     * doing the work on faces along with the work on one of the adjacent
+     * cells. The work items are colored such that both the workers and the
+     * copier can run in parallel, see mesh_loop() for details.
+     */
+    schedule_faces_separately = 0x0100,
+
     /**
      * Combination of flags to determine if any work on cells is done.
      */
@@ -129,6 +137,8 @@ namespace MeshWorker
       s << "|ghost_faces_both";
     if (u & assemble_boundary_faces)
       s << "|boundary_faces";
+    if (u & schedule_faces_separately)
+      s << "|faces_separately";
     return s;
   }
 
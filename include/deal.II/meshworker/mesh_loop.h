@@ -18,6 +18,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/graph_coloring.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/types.h>
 #include <deal.II/base/work_stream.h>
@@ -33,6 +34,7 @@
 
 #include <functional>
 #include <type_traits>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -96,6 +98,26 @@ namespace MeshWorker
       // remove the template layers to retrieve the underlying iterator type.
       using type = typename CellIteratorBaseType<CellIteratorType>::type;
     };
+
+    /**
+     * A work item of mesh_loop() when the work on faces is scheduled
+     * separately from the work on cells, see
+     * AssembleFlags::schedule_faces_separately. If @p face_no is
+     * numbers::invalid_unsigned_int, the item represents the work on @p cell
+     * and its boundary faces. Otherwise, it represents the work on the
+     * interior face between @p cell and @p neighbor, and the members hold
+     * the arguments of the face worker.
+     */
+    template <typename CellIteratorBaseType>
+    struct MeshLoopWorkItem
+    {
+      CellIteratorBaseType cell;
+      unsigned int         face_no;
+      unsigned int         subface_no;
+      CellIteratorBaseType neighbor;
+      unsigned int         neighbor_face_no;
+      unsigned int         neighbor_subface_no;
+    };
   } // namespace internal
 
 #ifdef DOXYGEN
@@ -190,6 +212,27 @@ namespace MeshWorker
    * assumed to integrate all face terms at once (and add contributions to both
    * sides of the face in a discontinuous Galerkin setting).
    *
+   * By default, the work on the faces of a cell is part of the work item of
+   * that cell, i.e., the face workers are called on the same thread and with
+   * the same CopyData object as the cell worker of the cell they are visited
+   * from. If the flag AssembleFlags::schedule_faces_separately is given,
+   * every interior face becomes a work item of its own, with a freshly reset
+   * CopyData object that is passed to the copier after the face worker has
+   * run, and the cells, together with their boundary faces, form the
+   * remaining work items. All work items are then distributed into
+   * conflict-free colors with GraphColoring::make_graph_coloring(), where
+   * two work items are considered to be in conflict if their cells share a
+   * vertex, and passed to the colored version of WorkStream::run(). Within
+   * each color, both the workers and the copier run in parallel. This is in
+   * particular useful for discontinuous Galerkin methods with
+   * AssembleFlags::assemble_own_interior_faces_once, where the face terms
+   * would otherwise be assembled along with the cells, and all copier calls
+   * would be serialized. The copier needs to be written in such a way that
+   * it only writes into global entries associated with the vertices of the
+   * cells of a work item, which is the case for the usual assembly into
+   * matrices and vectors, possibly with hanging node constraints, but not
+   * for constraints coupling degrees of freedom across periodic boundaries.
+   *
    * This method is equivalent to the WorkStream::run() method when
    * AssembleFlags contains only @p assemble_own_cells, and can be used as a
    * drop-in replacement for that method.
@@ -397,13 +440,16 @@ namespace MeshWorker
         "cannot set the 'assemble_boundary_faces' flag. One of these two "
         "conditions is not satisfied."));
 
-    auto cell_action = [&](const CellIteratorBaseType &cell,
-                           ScratchData                &scratch,
-                           CopyData                   &copy) {
-      // First reset the CopyData class to the empty copy_data given by the
-      // user.
-      copy = sample_copy_data;
-
+    // Visit the cell and its faces, and determine the work to be done there.
+    // Rather than calling the user's workers directly, call @p do_cell for
+    // the work on the cell itself, @p do_boundary_face for every boundary
+    // face, and @p do_interior_face with the arguments of the face worker for
+    // every interior face. This allows to share the logic between the
+    // different ways of scheduling the work below.
+    const auto visit_cell = [&](const CellIteratorBaseType &cell,
+                                const auto                 &do_cell,
+                                const auto                 &do_boundary_face,
+                                const auto                 &do_interior_face) {
       // Store the dimension in which we are working for later use
       const auto dim = cell->get_triangulation().dimension;
 
@@ -427,7 +473,7 @@ namespace MeshWorker
       if (!(flags & (cells_after_faces)) &&
           (((flags & (assemble_own_cells)) && own_cell) ||
            ((flags & assemble_ghost_cells) && !own_cell)))
-        cell_worker(cell, scratch, copy);
+        do_cell();
 
       if (flags & (work_on_faces | work_on_boundary))
         for (const unsigned int face_no : cell->face_indices())
@@ -437,7 +483,7 @@ namespace MeshWorker
               {
                 // only integrate boundary faces of own cells
                 if ((flags & assemble_boundary_faces) && own_cell)
-                  boundary_worker(cell, face_no, scratch, copy);
+                  do_boundary_face(face_no);
               }
             else
               {
@@ -501,14 +547,12 @@ namespace MeshWorker
                             face_no) :
                           cell->neighbor_of_coarser_neighbor(face_no);
 
-                    face_worker(cell,
-                                face_no,
-                                numbers::invalid_unsigned_int,
-                                neighbor,
-                                neighbor_face_no.first,
-                                neighbor_face_no.second,
-                                scratch,
-                                copy);
+                    do_interior_face(cell,
+                                     face_no,
+                                     numbers::invalid_unsigned_int,
+                                     neighbor,
+                                     neighbor_face_no.first,
+                                     neighbor_face_no.second);
 
                     if (flags & assemble_own_interior_faces_both)
                       {
@@ -516,14 +560,12 @@ namespace MeshWorker
                         // call the faceworker again with swapped arguments.
                         // This is because we won't be looking at an adaptively
                         // refined edge coming from the other side.
-                        face_worker(neighbor,
-                                    neighbor_face_no.first,
-                                    neighbor_face_no.second,
-                                    cell,
-                                    face_no,
-                                    numbers::invalid_unsigned_int,
-                                    scratch,
-                                    copy);
+                        do_interior_face(neighbor,
+                                         neighbor_face_no.first,
+                                         neighbor_face_no.second,
+                                         cell,
+                                         face_no,
+                                         numbers::invalid_unsigned_int);
                       }
                   }
                 else if (dim == 1 && cell->level() > neighbor->level())
@@ -538,27 +580,23 @@ namespace MeshWorker
                                cell->face(face_no),
                            ExcInternalError());
 
-                    face_worker(cell,
-                                face_no,
-                                numbers::invalid_unsigned_int,
-                                neighbor,
-                                neighbor_face_no,
-                                numbers::invalid_unsigned_int,
-                                scratch,
-                                copy);
+                    do_interior_face(cell,
+                                     face_no,
+                                     numbers::invalid_unsigned_int,
+                                     neighbor,
+                                     neighbor_face_no,
+                                     numbers::invalid_unsigned_int);
 
                     if (flags & assemble_own_interior_faces_both)
                       {
                         // If own faces are to be assembled from both sides,
                         // call the faceworker again with swapped arguments.
-                        face_worker(neighbor,
-                                    neighbor_face_no,
-                                    numbers::invalid_unsigned_int,
-                                    cell,
-                                    face_no,
-                                    numbers::invalid_unsigned_int,
-                                    scratch,
-                                    copy);
+                        do_interior_face(neighbor,
+                                         neighbor_face_no,
+                                         numbers::invalid_unsigned_int,
+                                         cell,
+                                         face_no,
+                                         numbers::invalid_unsigned_int);
                       }
                   }
                 else
@@ -607,14 +645,12 @@ namespace MeshWorker
                                cell->face(face_no),
                            ExcInternalError());
 
-                    face_worker(cell,
-                                face_no,
-                                numbers::invalid_unsigned_int,
-                                neighbor,
-                                neighbor_face_no,
-                                numbers::invalid_unsigned_int,
-                                scratch,
-                                copy);
+                    do_interior_face(cell,
+                                     face_no,
+                                     numbers::invalid_unsigned_int,
+                                     neighbor,
+                                     neighbor_face_no,
+                                     numbers::invalid_unsigned_int);
                   }
               }
           } // faces
@@ -623,7 +659,136 @@ namespace MeshWorker
       if ((flags & cells_after_faces) &&
           (((flags & assemble_own_cells) && own_cell) ||
            ((flags & assemble_ghost_cells) && !own_cell)))
-        cell_worker(cell, scratch, copy);
+        do_cell();
+    };
+
+    if (flags & schedule_faces_separately)
+      {
+        using WorkItem     = internal::MeshLoopWorkItem<CellIteratorBaseType>;
+        using ItemIterator = typename std::vector<WorkItem>::const_iterator;
+
+        // Collect one work item for every cell with work on the cell or its
+        // boundary faces, and one for every interior face.
+        std::vector<WorkItem> work_items;
+        for (CellIteratorType it = begin; it != end; ++it)
+          {
+            const CellIteratorBaseType cell         = it;
+            bool                       work_on_cell = false;
+
+            visit_cell(
+              cell,
+              [&]() { work_on_cell = true; },
+              [&](const unsigned int) { work_on_cell = true; },
+              [&](const CellIteratorBaseType &cell_1,
+                  const unsigned int          face_no_1,
+                  const unsigned int          subface_no_1,
+                  const CellIteratorBaseType &cell_2,
+                  const unsigned int          face_no_2,
+                  const unsigned int          subface_no_2) {
+                work_items.push_back(WorkItem{cell_1,
+                                              face_no_1,
+                                              subface_no_1,
+                                              cell_2,
+                                              face_no_2,
+                                              subface_no_2});
+              });
+
+            if (work_on_cell)
+              work_items.push_back(WorkItem{cell,
+                                            numbers::invalid_unsigned_int,
+                                            numbers::invalid_unsigned_int,
+                                            cell,
+                                            numbers::invalid_unsigned_int,
+                                            numbers::invalid_unsigned_int});
+          }
+
+        if (work_items.empty())
+          return;
+
+        // Two work items conflict if any of their cells share a vertex, since
+        // the copier may then add their local contributions into the same
+        // global entries
+        const auto get_conflict_indices = [](const ItemIterator &item) {
+          std::vector<types::global_dof_index> conflict_indices;
+          for (const unsigned int v : item->cell->vertex_indices())
+            conflict_indices.push_back(item->cell->vertex_index(v));
+          if (item->face_no != numbers::invalid_unsigned_int)
+            for (const unsigned int v : item->neighbor->vertex_indices())
+              conflict_indices.push_back(item->neighbor->vertex_index(v));
+          return conflict_indices;
+        };
+
+        const std::vector<std::vector<ItemIterator>> colored_work_items =
+          GraphColoring::make_graph_coloring(work_items.cbegin(),
+                                             work_items.cend(),
+                                             get_conflict_indices);
+
+        const std::function<void(const ItemIterator &,
+                                 ScratchData &,
+                                 CopyData &)>
+          item_action = [&](const ItemIterator &item,
+                            ScratchData        &scratch,
+                            CopyData           &copy) {
+            copy = sample_copy_data;
+
+            if (item->face_no == numbers::invalid_unsigned_int)
+              visit_cell(
+                item->cell,
+                [&]() { cell_worker(item->cell, scratch, copy); },
+                [&](const unsigned int face_no) {
+                  boundary_worker(item->cell, face_no, scratch, copy);
+                },
+                // the interior faces are separate work items
+                [](const auto &...) {});
+            else
+              face_worker(item->cell,
+                          item->face_no,
+                          item->subface_no,
+                          item->neighbor,
+                          item->neighbor_face_no,
+                          item->neighbor_subface_no,
+                          scratch,
+                          copy);
+          };
+
+        WorkStream::run(colored_work_items,
+                        item_action,
+                        copier,
+                        sample_scratch_data,
+                        sample_copy_data,
+                        queue_length,
+                        chunk_size);
+        return;
+      }
+
+    const auto cell_action = [&](const CellIteratorBaseType &cell,
+                                 ScratchData                &scratch,
+                                 CopyData                   &copy) {
+      // First reset the CopyData class to the empty copy_data given by the
+      // user.
+      copy = sample_copy_data;
+
+      visit_cell(
+        cell,
+        [&]() { cell_worker(cell, scratch, copy); },
+        [&](const unsigned int face_no) {
+          boundary_worker(cell, face_no, scratch, copy);
+        },
+        [&](const auto        &cell_1,
+            const unsigned int face_no_1,
+            const unsigned int subface_no_1,
+            const auto        &cell_2,
+            const unsigned int face_no_2,
+            const unsigned int subface_no_2) {
+          face_worker(cell_1,
+                      face_no_1,
+                      subface_no_1,
+                      cell_2,
+                      face_no_2,
+                      subface_no_2,
+                      scratch,
+                      copy);
+        });
     };
 
     // Submit to workstream
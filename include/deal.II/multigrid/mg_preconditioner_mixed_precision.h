@@ -0,0 +1,378 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_mg_preconditioner_mixed_precision_h
+#define dealii_mg_preconditioner_mixed_precision_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/observer_pointer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+
+#include <deal.II/multigrid/mg_coarse.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/mg_smoother.h>
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include <memory>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup mg
+ * @{
+ */
+
+/**
+ * A multigrid V-cycle preconditioner whose level operators, smoothers,
+ * transfer, and coarse-grid solver work in the (typically reduced) precision
+ * of @p LevelMatrixType, and which can be applied to vectors of any other
+ * precision, typically within a Krylov solver running in double precision.
+ * The conversion of the residual into the precision of the multigrid levels
+ * and of the correction back into the precision of the outer solver happens
+ * in PreconditionMG, i.e., while the residual is copied to and from the
+ * finest level, so no additional vector passes are needed.
+ *
+ * Since the preconditioner is usually dominated by memory transfer,
+ * running it in single precision roughly halves its cost, whereas the outer
+ * Krylov solver retains the accuracy of double precision. Errors of the order
+ * of the single-precision roundoff only result in a slightly weaker
+ * preconditioner, see also the discussion in step-37.
+ *
+ * This class collects the setup of the multigrid components that most
+ * matrix-free applications use with global coarsening (see
+ * MGTransferGlobalCoarsening): Chebyshev smoothers around the inverse of the
+ * diagonal of the level operators on all levels, and a Chebyshev iteration
+ * with a degree chosen to reach a given tolerance on the coarse level. The
+ * level operators need to provide the usual functions `vmult()`, `Tvmult()`,
+ * and `m()`, as well as a function `get_matrix_diagonal_inverse()` that
+ * returns a `std::shared_ptr` to a DiagonalMatrix with the inverse of the
+ * matrix diagonal, as for example MatrixFreeOperators::Base does after
+ * `compute_diagonal()` has been called.
+ *
+ * A typical use is
+ * @code
+ * MGLevelObject<std::shared_ptr<LevelOperator>> operators(min_level,
+ *                                                          max_level);
+ * // ... set up the float level operators and compute their diagonals ...
+ * MGTransferGlobalCoarsening<dim, LinearAlgebra::distributed::Vector<float>>
+ *   transfer(transfers, [&](const auto l, auto &vec) {
+ *     operators[l]->initialize_dof_vector(vec);
+ *   });
+ *
+ * PreconditionMGMixedPrecision<dim, LevelOperator> preconditioner;
+ * preconditioner.initialize(dof_handler, operators, transfer);
+ *
+ * SolverCG<LinearAlgebra::distributed::Vector<double>> solver(control);
+ * solver.solve(system_matrix, solution, rhs, preconditioner);
+ * @endcode
+ *
+ * @tparam dim The space dimension of the DoFHandler.
+ * @tparam LevelMatrixType The type of the level operators, whose
+ * `value_type` determines the precision of the multigrid cycle.
+ * @tparam TransferType The multigrid transfer acting on level vectors of type
+ * LinearAlgebra::distributed::Vector<LevelMatrixType::value_type>.
+ */
+template <int dim,
+          typename LevelMatrixType,
+          typename TransferType = MGTransferMF<
+            dim,
+            typename LevelMatrixType::value_type>>
+class PreconditionMGMixedPrecision : public EnableObserverPointer
+{
+public:
+  /**
+   * The number type used within the multigrid cycle.
+   */
+  using level_number_type = typename LevelMatrixType::value_type;
+
+  /**
+   * The vector type used within the multigrid cycle.
+   */
+  using LevelVectorType = LinearAlgebra::distributed::Vector<level_number_type>;
+
+  /**
+   * The type of the smoothers on the levels.
+   */
+  using SmootherType = PreconditionChebyshev<LevelMatrixType,
+                                             LevelVectorType,
+                                             DiagonalMatrix<LevelVectorType>>;
+
+  /**
+   * Parameters of the smoothers and of the coarse-grid solver.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const unsigned int smoothing_degree               = 5,
+                   const double       smoothing_range                = 20.,
+                   const unsigned int smoothing_eig_cg_n_iterations  = 20,
+                   const double       coarse_grid_tolerance          = 1e-3,
+                   const unsigned int n_pre_and_post_smoothing_steps = 1)
+      : smoothing_degree(smoothing_degree)
+      , smoothing_range(smoothing_range)
+      , smoothing_eig_cg_n_iterations(smoothing_eig_cg_n_iterations)
+      , coarse_grid_tolerance(coarse_grid_tolerance)
+      , n_pre_and_post_smoothing_steps(n_pre_and_post_smoothing_steps)
+    {}
+
+    /**
+     * Degree of the Chebyshev polynomial used as smoother on all levels but
+     * the coarsest one.
+     */
+    unsigned int smoothing_degree;
+
+    /**
+     * Ratio between the largest eigenvalue and the smallest eigenvalue
+     * addressed by the Chebyshev smoother, see
+     * PreconditionChebyshev::AdditionalData::smoothing_range.
+     */
+    double smoothing_range;
+
+    /**
+     * Number of iterations of the eigenvalue estimation in the smoothers.
+     */
+    unsigned int smoothing_eig_cg_n_iterations;
+
+    /**
+     * Relative tolerance of the Chebyshev iteration on the coarse level,
+     * whose degree is determined from the estimated condition number. The
+     * eigenvalue estimate on the coarse level uses as many iterations as
+     * there are unknowns.
+     */
+    double coarse_grid_tolerance;
+
+    /**
+     * Number of pre- and post-smoothing steps.
+     */
+    unsigned int n_pre_and_post_smoothing_steps;
+  };
+
+  /**
+   * Default constructor. The object needs to be initialized with
+   * initialize() before it can be used.
+   */
+  PreconditionMGMixedPrecision() = default;
+
+  /**
+   * Set up the smoothers, the coarse-grid solver, and the multigrid cycle
+   * for the level operators @p operators and the transfer @p transfer. The
+   * objects passed to this function need to be kept alive as long as this
+   * class is used.
+   */
+  template <typename LevelMatrixPointerType>
+  void
+  initialize(const DoFHandler<dim>                       &dof_handler,
+             const MGLevelObject<LevelMatrixPointerType> &operators,
+             const TransferType                          &transfer,
+             const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Apply one V-cycle to @p src and write the result into @p dst. The
+   * vectors can use a different number type than the level vectors, in
+   * which case the conversion happens when the data is copied to the finest
+   * level and back.
+   */
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Same as vmult(), since the V-cycle is symmetric with the same number of
+   * pre- and post-smoothing steps.
+   */
+  template <typename VectorType>
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Return the multigrid object, e.g. to connect to its signals.
+   */
+  const Multigrid<LevelVectorType> &
+  get_multigrid() const;
+
+  /**
+   * Return the smoothers of all levels, e.g. to query the eigenvalue
+   * estimates.
+   */
+  const mg::SmootherRelaxation<SmootherType, LevelVectorType> &
+  get_smoother() const;
+
+private:
+  /**
+   * Wrapper of the level operators.
+   */
+  mg::Matrix<LevelVectorType> mg_matrix;
+
+  /**
+   * The Chebyshev smoothers on all levels.
+   */
+  mg::SmootherRelaxation<SmootherType, LevelVectorType> mg_smoother;
+
+  /**
+   * The coarse-grid solver, which applies the Chebyshev iteration of the
+   * coarse level.
+   */
+  MGCoarseGridApplySmoother<LevelVectorType> mg_coarse;
+
+  /**
+   * The multigrid cycle.
+   */
+  std::unique_ptr<Multigrid<LevelVectorType>> mg;
+
+  /**
+   * The preconditioner interface to an outer solver.
+   */
+  std::unique_ptr<PreconditionMG<dim, LevelVectorType, TransferType>>
+    preconditioner;
+};
+
+/** @} */
+
+
+/* ------------------------- Inline functions ------------------------------ */
+
+#ifndef DOXYGEN
+
+template <int dim, typename LevelMatrixType, typename TransferType>
+template <typename LevelMatrixPointerType>
+void
+PreconditionMGMixedPrecision<dim, LevelMatrixType, TransferType>::initialize(
+  const DoFHandler<dim>                       &dof_handler,
+  const MGLevelObject<LevelMatrixPointerType> &operators,
+  const TransferType                          &transfer,
+  const AdditionalData                        &additional_data)
+{
+  const unsigned int min_level = operators.min_level();
+  const unsigned int max_level = operators.max_level();
+
+  preconditioner.reset();
+  mg.reset();
+
+  MGLevelObject<typename SmootherType::AdditionalData> smoother_data(
+    min_level, max_level);
+  for (unsigned int level = min_level; level <= max_level; ++level)
+    {
+      const LevelMatrixType &level_operator =
+        Utilities::get_underlying_value(operators[level]);
+      if (level > min_level)
+        {
+          smoother_data[level].degree = additional_data.smoothing_degree;
+          smoother_data[level].smoothing_range =
+            additional_data.smoothing_range;
+          smoother_data[level].eig_cg_n_iterations =
+            additional_data.smoothing_eig_cg_n_iterations;
+        }
+      else
+        {
+          // With an invalid degree, the Chebyshev iteration selects the
+          // degree to reach the tolerance given by the smoothing range
+          smoother_data[level].degree = numbers::invalid_unsigned_int;
+          smoother_data[level].smoothing_range =
+            additional_data.coarse_grid_tolerance;
+          smoother_data[level].eig_cg_n_iterations = level_operator.m();
+        }
+      smoother_data[level].preconditioner =
+        level_operator.get_matrix_diagonal_inverse();
+      Assert(smoother_data[level].preconditioner.get() != nullptr,
+             ExcMessage("The level operators need to provide the inverse "
+                        "of their diagonal through "
+                        "get_matrix_diagonal_inverse()."));
+    }
+
+  mg_matrix.initialize(operators);
+  mg_smoother.initialize(operators, smoother_data);
+  mg_smoother.set_steps(additional_data.n_pre_and_post_smoothing_steps);
+  mg_coarse.initialize(mg_smoother);
+
+  mg = std::make_unique<Multigrid<LevelVectorType>>(mg_matrix,
+                                                    mg_coarse,
+                                                    transfer,
+                                                    mg_smoother,
+                                                    mg_smoother,
+                                                    min_level,
+                                                    max_level);
+
+  preconditioner =
+    std::make_unique<PreconditionMG<dim, LevelVectorType, TransferType>>(
+      dof_handler, *mg, transfer);
+}
+
+
+
+template <int dim, typename LevelMatrixType, typename TransferType>
+template <typename VectorType>
+void
+PreconditionMGMixedPrecision<dim, LevelMatrixType, TransferType>::vmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  Assert(preconditioner.get() != nullptr, ExcNotInitialized());
+  preconditioner->vmult(dst, src);
+}
+
+
+
+template <int dim, typename LevelMatrixType, typename TransferType>
+template <typename VectorType>
+void
+PreconditionMGMixedPrecision<dim, LevelMatrixType, TransferType>::Tvmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+template <int dim, typename LevelMatrixType, typename TransferType>
+const Multigrid<
+  typename PreconditionMGMixedPrecision<dim, LevelMatrixType, TransferType>::
+    LevelVectorType> &
+PreconditionMGMixedPrecision<dim, LevelMatrixType, TransferType>::
+  get_multigrid() const
+{
+  Assert(mg.get() != nullptr, ExcNotInitialized());
+  return *mg;
+}
+
+
+
+template <int dim, typename LevelMatrixType, typename TransferType>
+const mg::SmootherRelaxation<
+  typename PreconditionMGMixedPrecision<dim, LevelMatrixType, TransferType>::
+    SmootherType,
+  typename PreconditionMGMixedPrecision<dim, LevelMatrixType, TransferType>::
+    LevelVectorType> &
+PreconditionMGMixedPrecision<dim, LevelMatrixType, TransferType>::
+  get_smoother() const
+{
+  return mg_smoother;
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -22,6 +22,9 @@
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/dofs/dof_tools.h>
 
+#include <deal.II/grid/cell_status.h>
+
+#include <functional>
 #include <set>
 #include <vector>
 
@@ -388,6 +391,91 @@ namespace MGTools
     const std::vector<std::shared_ptr<const Triangulation<dim, spacedim>>>
       &trias);
 
+  /**
+   * Return the number of locally-owned cells on each multigrid level that
+   * local smoothing would see, predicted from the partition of the active
+   * cells. For a parallel::distributed::Triangulation, a cell on a
+   * multigrid level is owned by the owner of its active cell or of its
+   * first child, such that the level workload of a process is given by the
+   * locally owned active cells and all their ancestors reached through
+   * first children only. This function evaluates this rule and therefore
+   * does not require the multilevel hierarchy to be constructed, which
+   * allows to assess a partition before the level data structures are set
+   * up. For meshes with a constructed hierarchy, the result coincides with
+   * the one of local_workload().
+   */
+  template <int dim, int spacedim>
+  std::vector<types::global_dof_index>
+  predicted_local_workload(const Triangulation<dim, spacedim> &tria);
+
+  /**
+   * Return the imbalance of the multigrid level workload predicted by
+   * predicted_local_workload(), defined as in workload_imbalance().
+   *
+   * @note This function is a collective MPI call between all ranks of the
+   * Triangulation and therefore needs to be called from all ranks.
+   */
+  template <int dim, int spacedim>
+  double
+  predicted_workload_imbalance(const Triangulation<dim, spacedim> &tria);
+
+  /**
+   * Return whether a global-coarsening multigrid method, e.g., with
+   * MGTransferGlobalCoarsening and the triangulations from
+   * MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(),
+   * should be used instead of local smoothing because the predicted
+   * workload imbalance of the local-smoothing levels exceeds
+   * @p imbalance_threshold. Global coarsening repartitions every level
+   * and thus keeps the level workload balanced, at the cost of hanging
+   * node constraints on the levels. Since the result is the same on all
+   * processes, it can be used to select the multigrid method at run time:
+   * @code
+   * if (MGTools::use_global_coarsening(triangulation, 1.5))
+   *   ...; // set up global coarsening
+   * else
+   *   ...; // set up local smoothing with MGTransferMatrixFree
+   * @endcode
+   *
+   * @note This function is a collective MPI call between all ranks of the
+   * Triangulation and therefore needs to be called from all ranks.
+   */
+  template <int dim, int spacedim>
+  bool
+  use_global_coarsening(const Triangulation<dim, spacedim> &tria,
+                        const double imbalance_threshold);
+
+  /**
+   * Return a function that weights each active cell with the number of
+   * multigrid level cells that its owner owns because of this cell, i.e.,
+   * one for the cell itself plus the number of its ancestors reached
+   * through first children only, see predicted_local_workload(), times
+   * @p factor. Connected to the weight signal of a
+   * parallel::distributed::Triangulation, the weighted partition along the
+   * space-filling curve balances the combined workload of all multigrid
+   * levels instead of the number of active cells:
+   * @code
+   * triangulation.signals.weight.connect(
+   *   MGTools::level_workload_weighting<dim>());
+   * triangulation.repartition();
+   * @endcode
+   * The function evaluates the cells of the refined or coarsened mesh in
+   * the way the weight signal is called during
+   * Triangulation::execute_coarsening_and_refinement(). Since the weights
+   * of several functions connected to the signal are summed up, the level
+   * workload can be combined with weights of the active cells, e.g., from
+   * parallel::CellWeights.
+   *
+   * @note Only the sum of the workload over all levels is balanced, which
+   * does not guarantee that every single level is balanced. If the
+   * predicted_workload_imbalance() remains too large, global coarsening
+   * should be considered, see use_global_coarsening().
+   */
+  template <int dim, int spacedim = dim>
+  std::function<
+    unsigned int(const typename Triangulation<dim, spacedim>::cell_iterator &,
+                 const CellStatus)>
+  level_workload_weighting(const unsigned int factor = 1);
+
 
 } // namespace MGTools
 
@@ -33,6 +33,7 @@
 
 #include <deal.II/non_matching/mapping_info.h>
 
+#include <functional>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -158,6 +159,49 @@ namespace MGTransferGlobalCoarseningTools
     const unsigned int                      max_degree,
     const PolynomialCoarseningSequenceType &p_sequence);
 
+  /**
+   * For a DoFHandler @p fine_dof_handler with hp-capabilities, create the
+   * DoFHandler objects of a polynomial coarsening hierarchy on the same
+   * triangulation, sorted from the coarsest to the finest level. On each
+   * coarser level, the degree of every cell is lowered separately according
+   * to the function @p next_coarser_degree, which takes the degree of the
+   * cell on the finer level and returns the desired degree on the next
+   * coarser level, e.g., `degree - k` for a decrease by k. The hierarchy ends
+   * once no cell changes its element anymore, which in particular happens if
+   * all cells have arrived at the lowest degree.
+   *
+   * The elements of all levels are taken from the hp::FECollection of
+   * @p fine_dof_handler, which hence needs to contain the elements of the
+   * coarser degrees, e.g., FE_Q objects of degree one to the maximal degree.
+   * If no element of the desired degree is present, the element with the
+   * largest degree below it is selected, or the element with the smallest
+   * degree if there is none. Since the returned DoFHandler objects have the
+   * same hp::FECollection as @p fine_dof_handler, the transfer operators
+   * between two levels can directly be set up via MGTwoLevelTransfer::reinit(),
+   * which runs optimized kernels for each pair of coarse and fine degree.
+   *
+   * @note For convenience, a reference to the input DoFHandler is stored in
+   *   the last entry of the return vector.
+   * @note The returned DoFHandler objects only have dofs distributed on the
+   *   active cells.
+   */
+  template <int dim, int spacedim>
+  std::vector<std::shared_ptr<const DoFHandler<dim, spacedim>>>
+  create_polynomial_coarsening_sequence(
+    const DoFHandler<dim, spacedim>                       &fine_dof_handler,
+    const std::function<unsigned int(const unsigned int)> &next_coarser_degree);
+
+  /**
+   * Similar to the above function, but with the coarsening of the degree of
+   * each cell given by one of the common sequences in
+   * PolynomialCoarseningSequenceType.
+   */
+  template <int dim, int spacedim>
+  std::vector<std::shared_ptr<const DoFHandler<dim, spacedim>>>
+  create_polynomial_coarsening_sequence(
+    const DoFHandler<dim, spacedim>        &fine_dof_handler,
+    const PolynomialCoarseningSequenceType &p_sequence);
+
   /**
    * For a given triangulation @p tria, determine the geometric coarsening
    * sequence by repeated global coarsening of the provided triangulation.
@@ -209,6 +253,44 @@ namespace MGTransferGlobalCoarseningTools
     const RepartitioningPolicyTools::Base<dim, spacedim> &policy,
     const bool repartition_fine_triangulation = false);
 
+  /**
+   * Similar to the first function, but reusing the unchanged levels of a
+   * sequence @p previous_sequence created by one of these functions for an
+   * earlier state of @p tria, e.g., before the last adaptive refinement step.
+   * Every level of the new sequence that has the same active cells with the
+   * same owners as one of the levels of @p previous_sequence is replaced by
+   * the pointer to that previous level.
+   *
+   * This allows to detect cheaply, by comparing pointers, which levels have
+   * not changed. All data built on top of such levels can be kept, e.g., the
+   * DoFHandler, the constraints, and the matrix-free operator of a level, as
+   * well as the MGTwoLevelTransfer object between two unchanged levels, which
+   * can be passed to MGTransferMF via std::shared_ptr. Only the levels touched
+   * by the refinement then need to be set up again:
+   * @code
+   * const auto new_trias =
+   *   MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(
+   *     tria, trias);
+   * for (unsigned int l = 0; l < new_trias.size(); ++l)
+   *   if (l >= trias.size() || new_trias[l] != trias[l])
+   *     {
+   *       // set up the DoFHandler, constraints and operator of level l
+   *     }
+   * @endcode
+   *
+   * @note The coarsening itself is still done from scratch; only the
+   *   (typically much more expensive) data structures on the levels can be
+   *   reused.
+   * @note The finest level, i.e., the last entry of the returned vector,
+   *   always refers to @p tria and is never matched with a previous level.
+   */
+  template <int dim, int spacedim>
+  std::vector<std::shared_ptr<const Triangulation<dim, spacedim>>>
+  create_geometric_coarsening_sequence(
+    const Triangulation<dim, spacedim> &tria,
+    const std::vector<std::shared_ptr<const Triangulation<dim, spacedim>>>
+      &previous_sequence);
+
 } // namespace MGTransferGlobalCoarseningTools
 
 
@@ -560,6 +642,31 @@ public:
   std::size_t
   memory_consumption() const override;
 
+  /**
+   * Compute the matrix representation of the prolongation applied by
+   * prolongate_and_add(), including the constraints and the weights of the
+   * fine degrees of freedom. The rows of the matrix refer to the local
+   * indices of a vector set up with partitioner_fine and the columns to the
+   * local indices of a vector set up with partitioner_coarse, both including
+   * the ghost entries. The rows of ghost entries contain the contributions
+   * added to the entries of other processes by a subsequent call to
+   * compress(). The restriction applied by restrict_and_add() is the
+   * transpose of this matrix.
+   *
+   * The matrix is returned in compressed row storage: the column indices and
+   * values of row `i` are stored in the range from `row_starts[i]` to
+   * `row_starts[i+1]` of @p column_indices and @p values. This function is
+   * meant for setting up transfer operators in other memory spaces, see
+   * Portable::MGTwoLevelTransfer.
+   *
+   * @note This function is not implemented for transfer operators set up
+   *   with MatrixFree objects.
+   */
+  void
+  compute_prolongation_matrix(std::vector<unsigned int> &row_starts,
+                              std::vector<unsigned int> &column_indices,
+                              std::vector<Number>       &values) const;
+
 protected:
   void
   prolongate_and_add_internal(VectorType       &dst,
@@ -635,6 +742,19 @@ private:
    */
   std::vector<MGTransferScheme> schemes;
 
+  /**
+   * Interpolate the coarse-cell values of the cell batch with index
+   * @p batch_index in @p evaluation_data_coarse, after the hanging-node
+   * constraints have been applied, to the fine cells with @p scheme and
+   * weight the result in @p evaluation_data_fine.
+   */
+  void
+  prolongate_cell_batch(
+    const MGTransferScheme             &scheme,
+    const unsigned int                  batch_index,
+    AlignedVector<VectorizedArrayType> &evaluation_data_coarse,
+    AlignedVector<VectorizedArrayType> &evaluation_data_fine) const;
+
   /**
    * Helper class for reading from and writing to global coarse vectors and for
    * applying constraints.
@@ -2976,6 +2976,164 @@ namespace MGTransferGlobalCoarseningTools
       repartition_fine_triangulation);
   }
 
+
+
+  template <int dim, int spacedim>
+  std::vector<std::shared_ptr<const Triangulation<dim, spacedim>>>
+  create_geometric_coarsening_sequence(
+    const Triangulation<dim, spacedim> &fine_triangulation_in,
+    const std::vector<std::shared_ptr<const Triangulation<dim, spacedim>>>
+      &previous_sequence)
+  {
+    auto coarse_grid_triangulations =
+      create_geometric_coarsening_sequence(fine_triangulation_in);
+
+    // Two triangulations derived from the same coarse mesh are treated as
+    // equal if they have the same active cells with the same owners on all
+    // processes; the global number of cells is checked first, which is
+    // cheap and gives the same answer on all processes
+    const auto is_same_triangulation =
+      [](const Triangulation<dim, spacedim> &tria_0,
+         const Triangulation<dim, spacedim> &tria_1) {
+        if (tria_0.n_global_levels() != tria_1.n_global_levels() ||
+            tria_0.n_global_active_cells() != tria_1.n_global_active_cells())
+          return false;
+
+        bool is_different =
+          (tria_0.n_active_cells() != tria_1.n_active_cells());
+        if (is_different == false)
+          for (auto cell_0 = tria_0.begin_active(),
+                    cell_1 = tria_1.begin_active();
+               cell_0 != tria_0.end();
+               ++cell_0, ++cell_1)
+            if (cell_0->id() != cell_1->id() ||
+                cell_0->subdomain_id() != cell_1->subdomain_id())
+              {
+                is_different = true;
+                break;
+              }
+
+        return Utilities::MPI::logical_or(
+                 is_different, tria_0.get_mpi_communicator()) == false;
+      };
+
+    // The last entries of both sequences refer to the fine triangulation
+    // itself, which has been modified in between, and are never matched.
+    // Since both sequences are sorted from coarse to fine, the search for a
+    // match of the next level starts after the previous match.
+    unsigned int first_candidate = 0;
+    for (unsigned int l = 0; l + 1 < coarse_grid_triangulations.size(); ++l)
+      for (unsigned int p = first_candidate; p + 1 < previous_sequence.size();
+           ++p)
+        if (previous_sequence[p] != nullptr &&
+            is_same_triangulation(*coarse_grid_triangulations[l],
+                                  *previous_sequence[p]))
+          {
+            coarse_grid_triangulations[l] = previous_sequence[p];
+            first_candidate               = p + 1;
+            break;
+          }
+
+    return coarse_grid_triangulations;
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::vector<std::shared_ptr<const DoFHandler<dim, spacedim>>>
+  create_polynomial_coarsening_sequence(
+    const DoFHandler<dim, spacedim>                       &fine_dof_handler,
+    const std::function<unsigned int(const unsigned int)> &next_coarser_degree)
+  {
+    const hp::FECollection<dim, spacedim> &fe_collection =
+      fine_dof_handler.get_fe_collection();
+    const Triangulation<dim, spacedim> &tria =
+      fine_dof_handler.get_triangulation();
+
+    // for each element of the collection, determine the element on the next
+    // coarser level; an element is kept if the collection contains no
+    // element of lower degree matching the request
+    std::vector<types::fe_index> coarser_fe_index(fe_collection.size());
+    for (unsigned int i = 0; i < fe_collection.size(); ++i)
+      {
+        const unsigned int degree =
+          next_coarser_degree(fe_collection[i].degree);
+
+        unsigned int best_below = numbers::invalid_unsigned_int;
+        unsigned int lowest     = 0;
+        for (unsigned int j = 0; j < fe_collection.size(); ++j)
+          {
+            if (fe_collection[j].degree <= degree &&
+                (best_below == numbers::invalid_unsigned_int ||
+                 fe_collection[j].degree > fe_collection[best_below].degree))
+              best_below = j;
+            if (fe_collection[j].degree < fe_collection[lowest].degree)
+              lowest = j;
+          }
+
+        const unsigned int selected =
+          (best_below != numbers::invalid_unsigned_int) ? best_below : lowest;
+        if (fe_collection[selected].degree < fe_collection[i].degree)
+          coarser_fe_index[i] = selected;
+        else
+          coarser_fe_index[i] = i;
+      }
+
+    std::vector<std::shared_ptr<const DoFHandler<dim, spacedim>>> dof_handlers;
+
+    dof_handlers.emplace_back(&fine_dof_handler, [](auto *) {
+      // empty deleter, since fine_dof_handler is an external field
+      // and its destructor is called somewhere else
+    });
+
+    std::vector<types::fe_index> active_fe_indices =
+      fine_dof_handler.get_active_fe_indices();
+
+    while (true)
+      {
+        bool has_changed = false;
+        for (const auto &cell : tria.active_cell_iterators())
+          if (cell->is_locally_owned())
+            {
+              types::fe_index &fe_index =
+                active_fe_indices[cell->active_cell_index()];
+              if (coarser_fe_index[fe_index] != fe_index)
+                {
+                  fe_index    = coarser_fe_index[fe_index];
+                  has_changed = true;
+                }
+            }
+
+        if (Utilities::MPI::logical_or(has_changed,
+                                       tria.get_mpi_communicator()) == false)
+          break;
+
+        const auto dof_handler =
+          std::make_shared<DoFHandler<dim, spacedim>>(tria);
+        dof_handler->set_active_fe_indices(active_fe_indices);
+        dof_handler->distribute_dofs(fe_collection);
+        dof_handlers.push_back(dof_handler);
+      }
+
+    std::reverse(dof_handlers.begin(), dof_handlers.end());
+
+    return dof_handlers;
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::vector<std::shared_ptr<const DoFHandler<dim, spacedim>>>
+  create_polynomial_coarsening_sequence(
+    const DoFHandler<dim, spacedim>        &fine_dof_handler,
+    const PolynomialCoarseningSequenceType &p_sequence)
+  {
+    return create_polynomial_coarsening_sequence(
+      fine_dof_handler, [p_sequence](const unsigned int degree) {
+        return create_next_polynomial_coarsening_degree(degree, p_sequence);
+      });
+  }
+
 } // namespace MGTransferGlobalCoarseningTools
 
 
@@ -3172,9 +3330,6 @@ MGTwoLevelTransfer<dim, VectorType>::prolongate_and_add_internal(
           if (scheme.n_coarse_cells == 0)
             continue;
 
-          const bool needs_interpolation =
-            scheme.prolongation_matrix.empty() == false;
-
           evaluation_data_fine.clear();
           evaluation_data_coarse.clear();
 
@@ -3184,14 +3339,6 @@ MGTwoLevelTransfer<dim, VectorType>::prolongate_and_add_internal(
           evaluation_data_fine.resize(max_n_dofs_per_cell);
           evaluation_data_coarse.resize(max_n_dofs_per_cell);
 
-          CellTransferFactory cell_transfer(scheme.degree_fine,
-                                            scheme.degree_coarse);
-
-          const unsigned int n_scalar_dofs_fine =
-            scheme.n_dofs_per_cell_fine / n_components;
-          const unsigned int n_scalar_dofs_coarse =
-            scheme.n_dofs_per_cell_coarse / n_components;
-
           for (unsigned int cell = 0; cell < scheme.n_coarse_cells;
                cell += n_lanes, ++batch_counter)
             {
@@ -3214,45 +3361,10 @@ MGTwoLevelTransfer<dim, VectorType>::prolongate_and_add_internal(
               constraint_info_coarse.apply_hanging_node_constraints(
                 cell_counter, n_lanes_filled, false, evaluation_data_coarse);
 
-              // ---------------------------- coarse ---------------------------
-              if (needs_interpolation)
-                for (int c = n_components - 1; c >= 0; --c)
-                  {
-                    CellProlongator<dim, double, VectorizedArrayType>
-                      cell_prolongator(scheme.prolongation_matrix,
-                                       evaluation_data_coarse.begin() +
-                                         c * n_scalar_dofs_coarse,
-                                       evaluation_data_fine.begin() +
-                                         c * n_scalar_dofs_fine);
-
-                    if (scheme.prolongation_matrix.size() <
-                        n_scalar_dofs_fine * n_scalar_dofs_coarse)
-                      cell_transfer.run(cell_prolongator);
-                    else
-                      cell_prolongator.run_full(n_scalar_dofs_fine,
-                                                n_scalar_dofs_coarse);
-                  }
-              else
-                evaluation_data_fine = evaluation_data_coarse; // TODO
-              // ------------------------------ fine ---------------------------
-
-              // weight
-              if (weights.size() > 0)
-                {
-                  const VectorizedArrayType *cell_weights =
-                    weights.data() + weights_start[batch_counter];
-                  if (weights_are_compressed[batch_counter])
-                    internal::
-                      weight_fe_q_dofs_by_entity<dim, -1, VectorizedArrayType>(
-                        cell_weights,
-                        n_components,
-                        scheme.degree_fine + 1,
-                        evaluation_data_fine.begin());
-                  else
-                    for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine;
-                         ++i)
-                      evaluation_data_fine[i] *= cell_weights[i];
-                }
+              prolongate_cell_batch(scheme,
+                                    batch_counter,
+                                    evaluation_data_coarse,
+                                    evaluation_data_fine);
 
               // add into dst vector
               internal::VectorDistributorLocalToGlobal<Number,
@@ -3275,6 +3387,63 @@ MGTwoLevelTransfer<dim, VectorType>::prolongate_and_add_internal(
 
 
 
+template <int dim, typename VectorType>
+void
+MGTwoLevelTransfer<dim, VectorType>::prolongate_cell_batch(
+  const MGTransferScheme             &scheme,
+  const unsigned int                  batch_index,
+  AlignedVector<VectorizedArrayType> &evaluation_data_coarse,
+  AlignedVector<VectorizedArrayType> &evaluation_data_fine) const
+{
+  // ---------------------------- coarse ---------------------------
+  if (scheme.prolongation_matrix.empty() == false)
+    {
+      CellTransferFactory cell_transfer(scheme.degree_fine,
+                                        scheme.degree_coarse);
+
+      const unsigned int n_scalar_dofs_fine =
+        scheme.n_dofs_per_cell_fine / n_components;
+      const unsigned int n_scalar_dofs_coarse =
+        scheme.n_dofs_per_cell_coarse / n_components;
+
+      for (int c = n_components - 1; c >= 0; --c)
+        {
+          CellProlongator<dim, double, VectorizedArrayType> cell_prolongator(
+            scheme.prolongation_matrix,
+            evaluation_data_coarse.begin() + c * n_scalar_dofs_coarse,
+            evaluation_data_fine.begin() + c * n_scalar_dofs_fine);
+
+          if (scheme.prolongation_matrix.size() <
+              n_scalar_dofs_fine * n_scalar_dofs_coarse)
+            cell_transfer.run(cell_prolongator);
+          else
+            cell_prolongator.run_full(n_scalar_dofs_fine,
+                                      n_scalar_dofs_coarse);
+        }
+    }
+  else
+    evaluation_data_fine = evaluation_data_coarse; // TODO
+  // ------------------------------ fine ---------------------------
+
+  // weight
+  if (weights.size() > 0)
+    {
+      const VectorizedArrayType *cell_weights =
+        weights.data() + weights_start[batch_index];
+      if (weights_are_compressed[batch_index])
+        internal::weight_fe_q_dofs_by_entity<dim, -1, VectorizedArrayType>(
+          cell_weights,
+          n_components,
+          scheme.degree_fine + 1,
+          evaluation_data_fine.begin());
+      else
+        for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine; ++i)
+          evaluation_data_fine[i] *= cell_weights[i];
+    }
+}
+
+
+
 template <typename VectorType>
 void
 MGTwoLevelTransferBase<VectorType>::restrict_and_add(
@@ -3522,6 +3691,192 @@ MGTwoLevelTransfer<dim, VectorType>::restrict_and_add_internal(
 
 
 
+namespace internal
+{
+  namespace
+  {
+    // Operation for ConstraintInfo::read_write_operation() that does not
+    // access the vector, but records for each entry of the array of local
+    // values the local indices of the vector entries and the weights it is
+    // read from or written to
+    template <typename Number>
+    class DoFEntryRecorder
+    {
+    public:
+      DoFEntryRecorder(
+        const Number *local_values,
+        std::vector<std::vector<std::pair<unsigned int, Number>>> &entries)
+        : local_values(local_values)
+        , entries(entries)
+        , current_entry(0)
+      {}
+
+      template <typename VectorType>
+      void
+      process_dof(const unsigned int index,
+                  const VectorType &,
+                  const Number &local) const
+      {
+        entries[&local - local_values].emplace_back(index, Number(1.));
+      }
+
+      void
+      pre_constraints(const Number &local, Number &) const
+      {
+        current_entry = &local - local_values;
+      }
+
+      template <typename VectorType>
+      void
+      process_constraint(const unsigned int index,
+                         const Number       weight,
+                         const VectorType &,
+                         Number &) const
+      {
+        entries[current_entry].emplace_back(index, weight);
+      }
+
+      void
+      post_constraints(const Number &, const Number &) const
+      {}
+
+    private:
+      const Number                                              *local_values;
+      std::vector<std::vector<std::pair<unsigned int, Number>>> &entries;
+      mutable std::size_t                                        current_entry;
+    };
+  } // namespace
+} // namespace internal
+
+
+
+template <int dim, typename VectorType>
+void
+MGTwoLevelTransfer<dim, VectorType>::compute_prolongation_matrix(
+  std::vector<unsigned int> &row_starts,
+  std::vector<unsigned int> &column_indices,
+  std::vector<Number>       &values) const
+{
+  AssertThrow(matrix_free_data.get() == nullptr,
+              ExcNotImplemented("The prolongation matrix can not be computed "
+                                "for transfer operators set up with "
+                                "MatrixFree objects."));
+
+  const unsigned int n_lanes = VectorizedArrayType::size();
+
+  std::vector<std::vector<std::pair<unsigned int, Number>>> rows(
+    this->partitioner_fine->locally_owned_size() +
+    this->partitioner_fine->n_ghost_indices());
+
+  AlignedVector<VectorizedArrayType> evaluation_data_fine;
+  AlignedVector<VectorizedArrayType> evaluation_data_coarse;
+
+  std::vector<std::vector<std::pair<unsigned int, Number>>> entries_fine;
+  std::vector<std::vector<std::pair<unsigned int, Number>>> entries_coarse;
+
+  unsigned int cell_counter  = 0;
+  unsigned int batch_counter = 0;
+
+  for (const auto &scheme : schemes)
+    {
+      if (scheme.n_coarse_cells == 0)
+        continue;
+
+      const unsigned int max_n_dofs_per_cell =
+        std::max(scheme.n_dofs_per_cell_fine, scheme.n_dofs_per_cell_coarse);
+      evaluation_data_fine.resize(max_n_dofs_per_cell);
+      evaluation_data_coarse.resize(max_n_dofs_per_cell);
+
+      for (unsigned int cell = 0; cell < scheme.n_coarse_cells;
+           cell += n_lanes, ++batch_counter)
+        {
+          const unsigned int n_lanes_filled =
+            (cell + n_lanes > scheme.n_coarse_cells) ?
+              (scheme.n_coarse_cells - cell) :
+              n_lanes;
+
+          // collect the vector entries the local coarse values are read
+          // from and the local fine values are added into, in the same way
+          // as in prolongate_and_add_internal()
+          entries_coarse.assign(max_n_dofs_per_cell * n_lanes, {});
+          constraint_info_coarse.read_write_operation(
+            internal::DoFEntryRecorder<Number>(&evaluation_data_coarse[0][0],
+                                               entries_coarse),
+            this->vec_coarse,
+            evaluation_data_coarse.data(),
+            cell_counter,
+            n_lanes_filled,
+            scheme.n_dofs_per_cell_coarse,
+            true);
+          entries_fine.assign(max_n_dofs_per_cell * n_lanes, {});
+          constraint_info_fine.read_write_operation(
+            internal::DoFEntryRecorder<Number>(&evaluation_data_fine[0][0],
+                                               entries_fine),
+            this->vec_fine,
+            evaluation_data_fine.data(),
+            cell_counter,
+            n_lanes_filled,
+            scheme.n_dofs_per_cell_fine,
+            false);
+
+          // apply the cell operation to the unit vectors of the coarse cell
+          for (unsigned int j = 0; j < scheme.n_dofs_per_cell_coarse; ++j)
+            {
+              for (auto &value : evaluation_data_coarse)
+                value = Number(0.);
+              evaluation_data_coarse[j] = Number(1.);
+
+              constraint_info_coarse.apply_hanging_node_constraints(
+                cell_counter, n_lanes_filled, false, evaluation_data_coarse);
+
+              prolongate_cell_batch(scheme,
+                                    batch_counter,
+                                    evaluation_data_coarse,
+                                    evaluation_data_fine);
+
+              for (unsigned int v = 0; v < n_lanes_filled; ++v)
+                for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine; ++i)
+                  if (evaluation_data_fine[i][v] != Number(0.))
+                    for (const auto &[row, weight_fine] :
+                         entries_fine[i * n_lanes + v])
+                      for (const auto &[column, weight_coarse] :
+                           entries_coarse[j * n_lanes + v])
+                        rows[row].emplace_back(column,
+                                               weight_fine *
+                                                 evaluation_data_fine[i][v] *
+                                                 weight_coarse);
+            }
+
+          cell_counter += n_lanes_filled;
+        }
+    }
+
+  // sort the entries of each row and sum up duplicates, which appear for
+  // fine degrees of freedom shared between cells
+  row_starts.resize(rows.size() + 1);
+  row_starts[0] = 0;
+  column_indices.clear();
+  values.clear();
+  for (unsigned int i = 0; i < rows.size(); ++i)
+    {
+      std::sort(rows[i].begin(),
+                rows[i].end(),
+                [](const auto &a, const auto &b) { return a.first < b.first; });
+      for (const auto &[column, value] : rows[i])
+        if (column_indices.size() > row_starts[i] &&
+            column_indices.back() == column)
+          values.back() += value;
+        else
+          {
+            column_indices.push_back(column);
+            values.push_back(value);
+          }
+      row_starts[i + 1] = column_indices.size();
+    }
+}
+
+
+
 template <int dim, typename VectorType>
 void
 MGTwoLevelTransfer<dim, VectorType>::interpolate(VectorType       &dst,
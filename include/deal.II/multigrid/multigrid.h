@@ -150,7 +150,8 @@ namespace mg
  * The function which starts a multigrid cycle on the finest level is cycle().
  * Depending on the cycle type chosen with the constructor (see enum Cycle),
  * this function triggers one of the cycles level_v_step() or level_step(),
- * where the latter one can do different types of cycles.
+ * where the latter one can do different types of cycles, or the additive
+ * variant additive_step().
  *
  * Using this class, it is expected that the right hand side has been
  * converted from a vector living on the locally finest level to a multilevel
@@ -172,7 +173,9 @@ public:
     /// The W-cycle
     w_cycle,
     /// The F-cycle
-    f_cycle
+    f_cycle,
+    /// Additive multigrid, see additive_step()
+    additive_cycle
   };
 
   using vector_type       = VectorType;
@@ -380,6 +383,29 @@ private:
   void
   level_step(const unsigned int level, Cycle cycle);
 
+  /**
+   * The additive multigrid method in the spirit of the BPX preconditioner.
+   * Rather than visiting the levels one after the other as in the
+   * multiplicative cycles above, the defect is first restricted through all
+   * levels, starting from #maxlevel. Then, the pre-smoother is applied to the
+   * restricted defect on each level above #minlevel and the coarse grid
+   * solver on #minlevel, independently of each other. Finally, the
+   * corrections of all levels are summed up by prolongating them from
+   * #minlevel to #maxlevel. The post-smoother and the edge matrices, which
+   * only correct the defect for the post-smoothing, are not used.
+   *
+   * Since the work on the levels does not depend on the results of the other
+   * levels, no level waits for the smoothing on the coarser levels, and the
+   * operations on the coarse levels, where communication latency often
+   * dominates, are not on the critical path of the finer levels. The
+   * resulting preconditioner is symmetric if the smoothers and the coarse
+   * grid solver are. As usual for additive methods, it typically needs more
+   * iterations of the outer solver than a V-cycle, and it should only be
+   * used within a Krylov method like SolverCG.
+   */
+  void
+  additive_step();
+
   /**
    * Cycle type performed by the method cycle().
    */
@@ -414,7 +440,8 @@ private:
   MGLevelObject<VectorType> t;
 
   /**
-   * Auxiliary vector for W- and F-cycles. Left uninitialized in V-cycle.
+   * Auxiliary vector for W- and F-cycles and additive multigrid. Left
+   * uninitialized in V-cycle.
    */
   MGLevelObject<VectorType> defect2;
 
@@ -262,6 +262,48 @@ Multigrid<VectorType>::level_step(const unsigned int level, Cycle cycle)
 
 
 
+template <typename VectorType>
+void
+Multigrid<VectorType>::additive_step()
+{
+  // Restrict the defect through all levels, adding the contribution from the
+  // finer level to the part of the defect that is already present on the
+  // level due to copy_to_mg. All level vectors of the solution are zero at
+  // this point, so there are no contributions from the edge matrices.
+  defect2[maxlevel] = defect[maxlevel];
+  for (unsigned int level = maxlevel; level > minlevel; --level)
+    {
+      defect2[level - 1] = defect[level - 1];
+
+      this->signals.restriction(true, level);
+      transfer->restrict_and_add(level, defect2[level - 1], defect2[level]);
+      this->signals.restriction(false, level);
+    }
+
+  // Compute the corrections of the levels, which are independent of each
+  // other
+  this->signals.coarse_solve(true, minlevel);
+  (*coarse)(minlevel, solution[minlevel], defect2[minlevel]);
+  this->signals.coarse_solve(false, minlevel);
+
+  for (unsigned int level = minlevel + 1; level <= maxlevel; ++level)
+    {
+      this->signals.pre_smoother_step(true, level);
+      pre_smooth->apply(level, solution[level], defect2[level]);
+      this->signals.pre_smoother_step(false, level);
+    }
+
+  // Sum up the corrections from the coarsest to the finest level
+  for (unsigned int level = minlevel + 1; level <= maxlevel; ++level)
+    {
+      this->signals.prolongation(true, level);
+      transfer->prolongate_and_add(level, solution[level], solution[level - 1]);
+      this->signals.prolongation(false, level);
+    }
+}
+
+
+
 template <typename VectorType>
 void
 Multigrid<VectorType>::cycle()
@@ -290,6 +332,8 @@ Multigrid<VectorType>::cycle()
 
   if (cycle_type == v_cycle)
     level_v_step(maxlevel);
+  else if (cycle_type == additive_cycle)
+    additive_step();
   else
     level_step(maxlevel, cycle_type);
 }
@@ -0,0 +1,612 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_portable_mg_transfer_h
+#define dealii_portable_mg_transfer_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/multigrid/mg_base.h>
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Portable
+{
+  /**
+   * Class for the transfer between two multigrid levels for vectors in the
+   * MemorySpace::Default memory space, i.e., for multigrid methods whose
+   * level operators are implemented with Portable::MatrixFree and whose
+   * vectors reside on the @ref GlossDevice "device".
+   *
+   * The transfer operator is set up from a dealii::MGTwoLevelTransfer object
+   * on the host, which supports both geometric and polynomial global
+   * coarsening including hanging-node constraints. Its prolongation matrix,
+   * including the constraints and the weights of the fine degrees of
+   * freedom, is extracted with
+   * dealii::MGTwoLevelTransfer::compute_prolongation_matrix() and copied to
+   * the device, together with its transpose for the restriction. Both
+   * operations are then performed by a single sparse matrix-vector product
+   * on the device that assigns one thread to each row, without atomic
+   * operations, followed by the communication of the ghost entries of the
+   * distributed vectors. In contrast to the cell-wise evaluation on the host,
+   * this approach stores the entries of the transfer matrix explicitly,
+   * which is cheap compared to the level operators for the low and moderate
+   * polynomial degrees typically used on the device.
+   *
+   * The host object only needs to be alive during reinit().
+   */
+  template <int dim, typename Number>
+  class MGTwoLevelTransfer : public EnableObserverPointer
+  {
+  public:
+    /**
+     * The vector type the transfer operates on.
+     */
+    using VectorType =
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>;
+
+    /**
+     * The type of the transfer operator on the host the present object is
+     * set up from.
+     */
+    using HostTransferType =
+      dealii::MGTwoLevelTransfer<dim,
+                                 LinearAlgebra::distributed::Vector<Number>>;
+
+    /**
+     * Set up the transfer operator from the transfer operator @p transfer
+     * on the host, see the class documentation.
+     */
+    void
+    reinit(const HostTransferType &transfer);
+
+    /**
+     * Perform prolongation of the coarse vector @p src and add the result
+     * to the fine vector @p dst.
+     */
+    void
+    prolongate_and_add(VectorType &dst, const VectorType &src) const;
+
+    /**
+     * Perform restriction of the fine vector @p src and add the result to
+     * the coarse vector @p dst.
+     */
+    void
+    restrict_and_add(VectorType &dst, const VectorType &src) const;
+
+    /**
+     * Return the memory consumption of the allocated memory in this class.
+     */
+    std::size_t
+    memory_consumption() const;
+
+  private:
+    /**
+     * A sparse matrix in compressed row storage on the device, working on
+     * the raw arrays of the local (owned and ghost) entries of distributed
+     * vectors.
+     */
+    struct SparseMatrix
+    {
+      /**
+       * Copy the matrix given in compressed row storage to the device.
+       */
+      void
+      reinit(const std::vector<unsigned int> &row_starts,
+             const std::vector<unsigned int> &column_indices,
+             const std::vector<Number>       &values);
+
+      /**
+       * Add the product of the matrix with @p src to @p dst.
+       */
+      void
+      vmult_add(Number *dst, const Number *src) const;
+
+      /**
+       * Return the memory consumption of the allocated memory.
+       */
+      std::size_t
+      memory_consumption() const;
+
+      /**
+       * Number of rows.
+       */
+      unsigned int n_rows = 0;
+
+      /**
+       * Start of the entries of each row within column_indices and values.
+       */
+      Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>
+        row_starts;
+
+      /**
+       * Column indices of the entries.
+       */
+      Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>
+        column_indices;
+
+      /**
+       * Values of the entries.
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space> values;
+    };
+
+    /**
+     * Prolongation matrix from the local entries of vec_coarse to the local
+     * entries of vec_fine.
+     */
+    SparseMatrix prolongation_matrix;
+
+    /**
+     * Restriction matrix, i.e., the transpose of prolongation_matrix.
+     */
+    SparseMatrix restriction_matrix;
+
+    /**
+     * Internal vector with the parallel layout of the coarse side of the
+     * transfer operator on the host, including the ghost entries needed
+     * for reading.
+     */
+    mutable VectorType vec_coarse;
+
+    /**
+     * Internal vector with the parallel layout of the fine side of the
+     * transfer operator on the host, including the ghost entries needed
+     * for writing.
+     */
+    mutable VectorType vec_fine;
+  };
+
+
+
+  /**
+   * Implementation of the MGTransferBase interface for the transfer between
+   * the levels of a multigrid method with vectors in the
+   * MemorySpace::Default memory space, using a collection of
+   * Portable::MGTwoLevelTransfer objects, one for each level but
+   * the coarsest. Like dealii::MGTransferMF with global coarsening, the
+   * finest level is assumed to share the degrees of freedom with the
+   * DoFHandler used outside of the multigrid method, so that copy_to_mg()
+   * and copy_from_mg() only copy vectors on the device.
+   *
+   * Together with Portable::MatrixFree for the level operators and
+   * PreconditionChebyshev with a DiagonalMatrix as inner preconditioner as
+   * smoother, this class allows to run all operations of a multigrid cycle
+   * (except the coarse-grid solver, if chosen so) on the device.
+   */
+  template <int dim, typename Number>
+  class MGTransferMF
+    : public MGTransferBase<
+        LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>>
+  {
+  public:
+    /**
+     * The vector type the transfer operates on.
+     */
+    using VectorType =
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>;
+
+    /**
+     * Constructor taking a collection of transfer operators (with the
+     * coarsest level kept empty in @p transfer) and a function that
+     * initializes the level vectors with the parallel layout of the level
+     * operators within the function call copy_to_mg(), e.g., by calling
+     * Portable::MatrixFree::initialize_dof_vector().
+     */
+    MGTransferMF(
+      const MGLevelObject<MGTwoLevelTransfer<dim, Number>> &transfer,
+      const std::function<void(const unsigned int, VectorType &)>
+        &initialize_dof_vector);
+
+    /**
+     * Perform prolongation.
+     */
+    void
+    prolongate(const unsigned int to_level,
+               VectorType        &dst,
+               const VectorType  &src) const override;
+
+    /**
+     * Perform prolongation.
+     */
+    void
+    prolongate_and_add(const unsigned int to_level,
+                       VectorType        &dst,
+                       const VectorType  &src) const override;
+
+    /**
+     * Perform restriction.
+     */
+    void
+    restrict_and_add(const unsigned int from_level,
+                     VectorType        &dst,
+                     const VectorType  &src) const override;
+
+    /**
+     * Initialize the level vectors and copy @p src to the finest multigrid
+     * level.
+     */
+    void
+    copy_to_mg(const DoFHandler<dim> &dof_handler,
+               MGLevelObject<VectorType> &dst,
+               const VectorType          &src) const;
+
+    /**
+     * Copy the values on the finest multigrid level to @p dst.
+     */
+    void
+    copy_from_mg(const DoFHandler<dim>           &dof_handler,
+                 VectorType                      &dst,
+                 const MGLevelObject<VectorType> &src) const;
+
+    /**
+     * Add the values on the finest multigrid level to @p dst.
+     */
+    void
+    copy_from_mg_add(const DoFHandler<dim>           &dof_handler,
+                     VectorType                      &dst,
+                     const MGLevelObject<VectorType> &src) const;
+
+    /**
+     * Minimum level.
+     */
+    unsigned int
+    min_level() const;
+
+    /**
+     * Maximum level.
+     */
+    unsigned int
+    max_level() const;
+
+    /**
+     * Return the memory consumption of the allocated memory in this class,
+     * including the one of the underlying two-level transfer operators.
+     */
+    std::size_t
+    memory_consumption() const;
+
+  private:
+    /**
+     * Collection of the two-level transfer operators.
+     */
+    MGLevelObject<ObserverPointer<const MGTwoLevelTransfer<dim, Number>>>
+      transfer;
+
+    /**
+     * Function to initialize the level vectors.
+     */
+    std::function<void(const unsigned int, VectorType &)>
+      initialize_dof_vector;
+  };
+
+
+
+#ifndef DOXYGEN
+  /* ---------------------- Template functions ---------------------------- */
+
+  template <int dim, typename Number>
+  void
+  MGTwoLevelTransfer<dim, Number>::SparseMatrix::reinit(
+    const std::vector<unsigned int> &row_starts_host,
+    const std::vector<unsigned int> &column_indices_host,
+    const std::vector<Number>       &values_host)
+  {
+    Assert(row_starts_host.empty() == false, ExcInternalError());
+    AssertDimension(column_indices_host.size(), values_host.size());
+
+    n_rows = row_starts_host.size() - 1;
+
+    const auto copy_to_device = [](const auto &host_data, auto &view) {
+      using ViewType = std::remove_reference_t<decltype(view)>;
+      using HostViewType =
+        Kokkos::View<const typename ViewType::value_type *,
+                     Kokkos::HostSpace,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+      view = ViewType(Kokkos::view_alloc("portable_mg_transfer",
+                                         Kokkos::WithoutInitializing),
+                      host_data.size());
+      Kokkos::deep_copy(view,
+                        HostViewType(host_data.data(), host_data.size()));
+    };
+
+    copy_to_device(row_starts_host, row_starts);
+    copy_to_device(column_indices_host, column_indices);
+    copy_to_device(values_host, values);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTwoLevelTransfer<dim, Number>::SparseMatrix::vmult_add(
+    Number       *dst,
+    const Number *src) const
+  {
+    // copy the views into local variables to make them available on the
+    // device
+    const auto row_starts     = this->row_starts;
+    const auto column_indices = this->column_indices;
+    const auto values         = this->values;
+
+    Kokkos::parallel_for(
+      "dealii::Portable::MGTwoLevelTransfer::vmult_add",
+      Kokkos::RangePolicy<MemorySpace::Default::kokkos_space::execution_space>(
+        0, n_rows),
+      KOKKOS_LAMBDA(const unsigned int row) {
+        Number sum = 0;
+        for (unsigned int k = row_starts(row); k < row_starts(row + 1); ++k)
+          sum += values(k) * src[column_indices(k)];
+        dst[row] += sum;
+      });
+  }
+
+
+
+  template <int dim, typename Number>
+  std::size_t
+  MGTwoLevelTransfer<dim, Number>::SparseMatrix::memory_consumption() const
+  {
+    return row_starts.span() * sizeof(unsigned int) +
+           column_indices.span() * sizeof(unsigned int) +
+           values.span() * sizeof(Number);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTwoLevelTransfer<dim, Number>::reinit(const HostTransferType &transfer)
+  {
+    std::vector<unsigned int> row_starts;
+    std::vector<unsigned int> column_indices;
+    std::vector<Number>       values;
+    transfer.compute_prolongation_matrix(row_starts, column_indices, values);
+    prolongation_matrix.reinit(row_starts, column_indices, values);
+
+    // compute the transpose for the restriction, such that also the
+    // restriction can be done without atomic operations
+    const unsigned int n_rows_coarse =
+      transfer.partitioner_coarse->locally_owned_size() +
+      transfer.partitioner_coarse->n_ghost_indices();
+    std::vector<unsigned int> row_starts_t(n_rows_coarse + 1, 0);
+    for (const unsigned int column : column_indices)
+      {
+        AssertIndexRange(column, n_rows_coarse);
+        ++row_starts_t[column + 1];
+      }
+    for (unsigned int i = 0; i < n_rows_coarse; ++i)
+      row_starts_t[i + 1] += row_starts_t[i];
+
+    std::vector<unsigned int> column_indices_t(column_indices.size());
+    std::vector<Number>       values_t(values.size());
+    std::vector<unsigned int> position(row_starts_t.begin(),
+                                       row_starts_t.end() - 1);
+    for (unsigned int row = 0; row + 1 < row_starts.size(); ++row)
+      for (unsigned int k = row_starts[row]; k < row_starts[row + 1]; ++k)
+        {
+          const unsigned int index = position[column_indices[k]]++;
+          column_indices_t[index]  = row;
+          values_t[index]          = values[k];
+        }
+    restriction_matrix.reinit(row_starts_t, column_indices_t, values_t);
+
+    vec_coarse.reinit(transfer.partitioner_coarse);
+    vec_fine.reinit(transfer.partitioner_fine);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTwoLevelTransfer<dim, Number>::prolongate_and_add(
+    VectorType       &dst,
+    const VectorType &src) const
+  {
+    vec_coarse.copy_locally_owned_data_from(src);
+    vec_coarse.update_ghost_values();
+
+    vec_fine = Number(0.);
+    vec_fine.zero_out_ghost_values();
+    prolongation_matrix.vmult_add(vec_fine.get_values(),
+                                  vec_coarse.get_values());
+    vec_fine.compress(VectorOperation::add);
+
+    dst += vec_fine;
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTwoLevelTransfer<dim, Number>::restrict_and_add(
+    VectorType       &dst,
+    const VectorType &src) const
+  {
+    vec_fine.copy_locally_owned_data_from(src);
+    vec_fine.update_ghost_values();
+
+    vec_coarse = Number(0.);
+    vec_coarse.zero_out_ghost_values();
+    restriction_matrix.vmult_add(vec_coarse.get_values(),
+                                 vec_fine.get_values());
+    vec_coarse.compress(VectorOperation::add);
+
+    dst += vec_coarse;
+  }
+
+
+
+  template <int dim, typename Number>
+  std::size_t
+  MGTwoLevelTransfer<dim, Number>::memory_consumption() const
+  {
+    return prolongation_matrix.memory_consumption() +
+           restriction_matrix.memory_consumption() +
+           vec_coarse.memory_consumption() + vec_fine.memory_consumption();
+  }
+
+
+
+  template <int dim, typename Number>
+  MGTransferMF<dim, Number>::MGTransferMF(
+    const MGLevelObject<MGTwoLevelTransfer<dim, Number>> &transfer,
+    const std::function<void(const unsigned int, VectorType &)>
+      &initialize_dof_vector)
+    : transfer(transfer.min_level(), transfer.max_level())
+    , initialize_dof_vector(initialize_dof_vector)
+  {
+    Assert(initialize_dof_vector, ExcNotInitialized());
+
+    for (unsigned int l = transfer.min_level() + 1; l <= transfer.max_level();
+         ++l)
+      this->transfer[l] = &transfer[l];
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMF<dim, Number>::prolongate(const unsigned int to_level,
+                                        VectorType        &dst,
+                                        const VectorType  &src) const
+  {
+    dst = Number(0.);
+    prolongate_and_add(to_level, dst, src);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMF<dim, Number>::prolongate_and_add(const unsigned int to_level,
+                                                VectorType        &dst,
+                                                const VectorType  &src) const
+  {
+    Assert(to_level > min_level() && to_level <= max_level(),
+           ExcIndexRange(to_level, min_level() + 1, max_level() + 1));
+
+    this->transfer[to_level]->prolongate_and_add(dst, src);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMF<dim, Number>::restrict_and_add(const unsigned int from_level,
+                                              VectorType        &dst,
+                                              const VectorType  &src) const
+  {
+    Assert(from_level > min_level() && from_level <= max_level(),
+           ExcIndexRange(from_level, min_level() + 1, max_level() + 1));
+
+    this->transfer[from_level]->restrict_and_add(dst, src);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMF<dim, Number>::copy_to_mg(const DoFHandler<dim> &,
+                                        MGLevelObject<VectorType> &dst,
+                                        const VectorType          &src) const
+  {
+    for (unsigned int level = dst.min_level(); level <= dst.max_level();
+         ++level)
+      initialize_dof_vector(level, dst[level]);
+
+    dst[dst.max_level()].copy_locally_owned_data_from(src);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMF<dim, Number>::copy_from_mg(
+    const DoFHandler<dim> &,
+    VectorType                      &dst,
+    const MGLevelObject<VectorType> &src) const
+  {
+    dst.zero_out_ghost_values();
+    dst.copy_locally_owned_data_from(src[src.max_level()]);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMF<dim, Number>::copy_from_mg_add(
+    const DoFHandler<dim> &,
+    VectorType                      &dst,
+    const MGLevelObject<VectorType> &src) const
+  {
+    dst.zero_out_ghost_values();
+    dst += src[src.max_level()];
+  }
+
+
+
+  template <int dim, typename Number>
+  unsigned int
+  MGTransferMF<dim, Number>::min_level() const
+  {
+    return transfer.min_level();
+  }
+
+
+
+  template <int dim, typename Number>
+  unsigned int
+  MGTransferMF<dim, Number>::max_level() const
+  {
+    return transfer.max_level();
+  }
+
+
+
+  template <int dim, typename Number>
+  std::size_t
+  MGTransferMF<dim, Number>::memory_consumption() const
+  {
+    std::size_t size = 0;
+
+    for (unsigned int l = min_level() + 1; l <= max_level(); ++l)
+      size += transfer[l]->memory_consumption();
+
+    return size;
+  }
+
+#endif // DOXYGEN
+
+} // namespace Portable
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -78,6 +78,136 @@ namespace NonMatching
   };
 
 
+
+  /**
+   * A class that generates and stores the immersed quadrature rules of all
+   * intersected cells of a triangulation, as classified by a MeshClassifier,
+   * for a given discrete level set function.
+   *
+   * Generating the immersed quadrature rules with the
+   * DiscreteQuadratureGenerator involves root finding and is by far the most
+   * expensive part of NonMatching::FEValues::reinit(). If the level set
+   * function does not change between several assembly passes, e.g., for a
+   * stationary domain in a time-dependent problem, the quadrature rules can
+   * be generated once by an object of this class and then be handed to
+   * NonMatching::FEValues via NonMatching::FEValues::set_quadrature_cache(),
+   * which then uses the stored quadrature rules instead of generating them
+   * anew on every call of reinit(). The quadratures for the different cells
+   * are generated in parallel with the usual task-based parallelism.
+   *
+   * Only the inside, outside, and surface quadratures of intersected cells
+   * are stored. The object needs to be reinitialized whenever the level set
+   * function, the mesh classification, or the triangulation changes.
+   */
+  template <int dim>
+  class ImmersedQuadratureCache : public EnableObserverPointer
+  {
+  public:
+    using AdditionalData = typename QuadratureGenerator<dim>::AdditionalData;
+
+    /**
+     * Generate and store the immersed quadrature rules for all intersected,
+     * non-artificial active cells of the triangulation of @p dof_handler.
+     * The arguments have the same meaning as the ones of the constructors of
+     * DiscreteQuadratureGenerator and NonMatching::FEValues. On each cell,
+     * the rule in @p q_collection_1D with index
+     * <code>cell-@>active_fe_index()</code> is used as the base of the
+     * immersed quadratures, unless the collection only contains a single
+     * rule.
+     */
+    template <typename Number>
+    void
+    reinit(const hp::QCollection<1>  &q_collection_1D,
+           const MeshClassifier<dim> &mesh_classifier,
+           const DoFHandler<dim>     &dof_handler,
+           const ReadVector<Number>  &level_set,
+           const AdditionalData      &additional_data = AdditionalData());
+
+    /**
+     * Release all stored quadrature rules.
+     */
+    void
+    clear();
+
+    /**
+     * Return whether quadrature rules are stored for the given @p cell that
+     * were generated with the 1d quadrature rule with index @p q_index_1D.
+     */
+    bool
+    has_quadratures(const typename Triangulation<dim>::cell_iterator &cell,
+                    const unsigned int q_index_1D) const;
+
+    /**
+     * Return the stored quadrature rule for the inside region of @p cell.
+     */
+    const Quadrature<dim> &
+    get_inside_quadrature(
+      const typename Triangulation<dim>::cell_iterator &cell) const;
+
+    /**
+     * Return the stored quadrature rule for the outside region of @p cell.
+     */
+    const Quadrature<dim> &
+    get_outside_quadrature(
+      const typename Triangulation<dim>::cell_iterator &cell) const;
+
+    /**
+     * Return the stored quadrature rule for the surface region of @p cell.
+     */
+    const ImmersedSurfaceQuadrature<dim> &
+    get_surface_quadrature(
+      const typename Triangulation<dim>::cell_iterator &cell) const;
+
+    /**
+     * Return an estimate for the memory consumption, in bytes, of this object.
+     */
+    std::size_t
+    memory_consumption() const;
+
+  private:
+    /**
+     * Return the position in the vectors below at which the quadratures of
+     * the given @p cell are stored.
+     */
+    unsigned int
+    get_slot(const typename Triangulation<dim>::cell_iterator &cell) const;
+
+    /**
+     * The triangulation for which the quadratures have been generated.
+     */
+    ObserverPointer<const Triangulation<dim>> triangulation;
+
+    /**
+     * For each active cell, the position in the vectors below at which its
+     * quadratures are stored, or numbers::invalid_unsigned_int if the cell
+     * is not intersected.
+     */
+    std::vector<unsigned int> cell_to_slot;
+
+    /**
+     * The index of the 1d quadrature rule each of the stored quadratures has
+     * been generated with.
+     */
+    std::vector<unsigned int> q_indices_1D;
+
+    /**
+     * The quadrature rules for the inside regions of the intersected cells.
+     */
+    std::vector<Quadrature<dim>> inside_quadratures;
+
+    /**
+     * The quadrature rules for the outside regions of the intersected cells.
+     */
+    std::vector<Quadrature<dim>> outside_quadratures;
+
+    /**
+     * The quadrature rules for the surface regions of the intersected cells.
+     */
+    std::vector<ImmersedSurfaceQuadrature<dim>> surface_quadratures;
+  };
+
+
+
   /**
    * This class is intended to facilitate assembling in immersed (in the sense
    * of cut) finite element methods when the domain is described by a level set
@@ -300,6 +430,18 @@ namespace NonMatching
     const std::optional<FEImmersedSurfaceValues<dim>> &
     get_surface_fe_values() const;
 
+    /**
+     * Use the immersed quadrature rules stored in @p quadrature_cache on the
+     * intersected cells instead of generating them in every call to
+     * reinit(). For cells for which no quadrature rules are stored in the
+     * cache, they are generated as usual. The cache is stored by pointer,
+     * so it needs to have a longer life span than this object, or needs to
+     * be detached by calling this function with a `nullptr`.
+     */
+    void
+    set_quadrature_cache(
+      const ImmersedQuadratureCache<dim> *quadrature_cache);
+
   private:
     /**
      * Internal function called by the reinit() functions.
@@ -418,6 +560,12 @@ namespace NonMatching
      * Object that generates the immersed quadrature rules.
      */
     DiscreteQuadratureGenerator<dim> quadrature_generator;
+
+    /**
+     * Pointer to the cache of immersed quadrature rules set by
+     * set_quadrature_cache(), if any.
+     */
+    ObserverPointer<const ImmersedQuadratureCache<dim>> quadrature_cache;
   };
 
 
@@ -22,6 +22,8 @@
 #include "deal.II/base/floating_point_comparator.h"
 #include <deal.II/base/aligned_vector.h>
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/ndarray.h>
+#include <deal.II/base/polynomial.h>
 #include <deal.II/base/vectorization.h>
 
 #include <deal.II/fe/fe_dgq.h>
@@ -32,6 +34,7 @@
 #include <deal.II/fe/mapping_related_data.h>
 
 #include <deal.II/matrix_free/mapping_info_storage.h>
+#include <deal.II/matrix_free/tensor_product_point_kernels.h>
 
 #include <memory>
 
@@ -373,6 +376,36 @@ namespace NonMatching
                    &face_iterator_range_interior,
                  const std::vector<Quadrature<dim - 1>> &quadrature_vector);
 
+    /**
+     * Evaluate the one-dimensional polynomials @p polynomials and their first
+     * derivatives at all unit points set up by the last call to
+     * reinit_cells() or reinit_surface() and store them in this object.
+     * FEPointEvaluation objects using this MappingInfo object with a tensor
+     * product element described by the same polynomials then take the shape
+     * values from here instead of computing them in each call to
+     * FEPointEvaluation::reinit(). This pays off if the points are evaluated
+     * several times, e.g., for several vectors or in every time step of a
+     * particle method with fixed particle positions. Use
+     * FEPointEvaluation::precompute_shape_values() to select the polynomials
+     * of a particular finite element.
+     *
+     * The data is discarded by the next call to one of the reinit functions.
+     */
+    void
+    precompute_shape_values(
+      const std::vector<Polynomials::Polynomial<double>> &polynomials);
+
+    /**
+     * Getter function for the shape values computed by
+     * precompute_shape_values(). The offset can be obtained with
+     * compute_unit_point_index_offset(). Returns `nullptr` if no shape values
+     * have been computed for @p polynomials.
+     */
+    const dealii::ndarray<VectorizedArrayType, 2, dim> *
+    get_shape_values(
+      const unsigned int                                  offset,
+      const std::vector<Polynomials::Polynomial<double>> &polynomials) const;
+
     /**
      * Return if this MappingInfo object is reinitialized for faces (by
      * reinit_faces()) or not.
@@ -628,6 +661,19 @@ namespace NonMatching
      */
     AlignedVector<Point<dim - 1, VectorizedArrayType>> unit_points_faces;
 
+    /**
+     * The polynomials passed to precompute_shape_values().
+     */
+    std::vector<Polynomials::Polynomial<double>> shape_polynomials;
+
+    /**
+     * The values and first derivatives of @p shape_polynomials at the unit
+     * points, stored with @p shape_polynomials.size() entries per unit point.
+     *
+     * Indexed by @p unit_points_index.
+     */
+    AlignedVector<dealii::ndarray<VectorizedArrayType, 2, dim>> shape_values;
+
     /**
      * Offset to point to the first unit point of a cell/face.
      */
@@ -829,6 +875,8 @@ namespace NonMatching
     data_index_offsets.clear();
     compressed_data_index_offsets.clear();
     cell_type.clear();
+    shape_polynomials.clear();
+    shape_values.clear();
   }
 
 
@@ -865,6 +913,9 @@ namespace NonMatching
     n_q_points_unvectorized.resize(1);
     n_q_points_unvectorized[0] = quadrature.size();
 
+    shape_polynomials.clear();
+    shape_values.clear();
+
     const unsigned int n_q_points =
       compute_n_q_points<VectorizedArrayType>(n_q_points_unvectorized[0]);
 
@@ -2039,6 +2090,45 @@ namespace NonMatching
 
 
 
+  template <int dim, int spacedim, typename Number>
+  void
+  MappingInfo<dim, spacedim, Number>::precompute_shape_values(
+    const std::vector<Polynomials::Polynomial<double>> &polynomials)
+  {
+    Assert(state == State::cell_vector,
+           ExcMessage("Shape values can only be precomputed after a call to "
+                      "reinit_cells() or reinit_surface()."));
+
+    shape_polynomials = polynomials;
+
+    const std::size_t n_shapes = polynomials.size();
+    shape_values.resize_fast(unit_points.size() * n_shapes);
+    for (unsigned int q = 0; q < unit_points.size(); ++q)
+      dealii::internal::compute_values_of_array(shape_values.data() +
+                                                  q * n_shapes,
+                                                polynomials,
+                                                unit_points[q],
+                                                1);
+  }
+
+
+
+  template <int dim, int spacedim, typename Number>
+  inline const dealii::ndarray<
+    typename MappingInfo<dim, spacedim, Number>::VectorizedArrayType,
+    2,
+    dim> *
+  MappingInfo<dim, spacedim, Number>::get_shape_values(
+    const unsigned int                                  offset,
+    const std::vector<Polynomials::Polynomial<double>> &polynomials) const
+  {
+    if (shape_values.empty() || shape_polynomials != polynomials)
+      return nullptr;
+    return shape_values.data() + offset * shape_polynomials.size();
+  }
+
+
+
   template <int dim, int spacedim, typename Number>
   inline const Point<
     dim - 1,
@@ -2163,6 +2253,7 @@ namespace NonMatching
   {
     std::size_t memory = MemoryConsumption::memory_consumption(unit_points);
     memory += MemoryConsumption::memory_consumption(unit_points_faces);
+    memory += MemoryConsumption::memory_consumption(shape_values);
     memory += MemoryConsumption::memory_consumption(unit_points_index);
     memory += cell_type.capacity() *
               sizeof(dealii::internal::MatrixFreeFunctions::GeometryType);
@@ -152,6 +152,41 @@ namespace NonMatching
       const typename Triangulation<dim>::cell_iterator &cell,
       const unsigned int                                face_index) const;
 
+    /**
+     * Return a vector that contains, for each active cell of the
+     * triangulation and indexed by its active cell index, how the cell is
+     * located relative to the level set function, converted to an unsigned
+     * integer.
+     *
+     * The returned vector can be used as
+     * MatrixFree::AdditionalData::cell_vectorization_category in order to
+     * run matrix-free loops for cut finite element methods. Together with
+     * MatrixFree::AdditionalData::cell_vectorization_categories_strict set
+     * to true, the cell batches then only contain cells with the same
+     * location, such that MatrixFree::get_cell_range_category() tells for a
+     * given range of cell batches whether it contains intersected cells.
+     * The cells inside and outside of the domain can then be handled with
+     * the usual vectorized FEEvaluation kernels, whereas the lanes of the
+     * intersected cell batches are worked on with FEPointEvaluation and the
+     * quadrature points and mapping data precomputed in
+     * NonMatching::MappingInfo:
+     * @code
+     * typename MatrixFree<dim, double>::AdditionalData additional_data;
+     * additional_data.cell_vectorization_category =
+     *   classifier.get_cell_vectorization_categories();
+     * additional_data.cell_vectorization_categories_strict = true;
+     * ...
+     * const unsigned int category = matrix_free.get_cell_range_category(range);
+     * if (category == static_cast<unsigned int>(LocationToLevelSet::inside))
+     *   // regular FEEvaluation
+     * else if (category ==
+     *          static_cast<unsigned int>(LocationToLevelSet::intersected))
+     *   // FEPointEvaluation on each lane of the batch
+     * @endcode
+     */
+    std::vector<unsigned int>
+    get_cell_vectorization_categories() const;
+
   private:
     /**
      * For each element in the hp::FECollection returned by
@@ -140,6 +140,23 @@ namespace internal
  * will simply take interpolated values of the solution instead of the exact
  * values on these cells children for output).
  *
+ * Once the patches have been built, the amount of data that is written can
+ * be reduced further by the functions clip_patches(), which only keeps the
+ * patches in a region of interest, coarsen_patches(), which reduces the
+ * number of subdivisions of patches on cells where a criterion such as an
+ * error indicator is small, and reduce_precision(), which rounds the values
+ * of selected data sets to fewer significant digits so that they compress
+ * better. These functions operate on the patches only and can be combined
+ * freely; for example, after building the patches with a large number of
+ * subdivisions, one may call
+ * @code
+ *   data_out.build_patches(mapping, 8);
+ *   data_out.clip_patches(region_of_interest);
+ *   data_out.coarsen_patches(estimated_error_per_cell, threshold, 1);
+ *   data_out.reduce_precision({"pressure"}, 10);
+ *   data_out.write_vtu_in_parallel("solution.vtu", mpi_communicator);
+ * @endcode
+ *
  * @ingroup output
  */
 template <int dim, int spacedim = dim>
@@ -415,6 +432,42 @@ public:
   std::pair<FirstCellFunctionType, NextCellFunctionType>
   get_cell_selection() const;
 
+  /**
+   * Remove the patches built by the last call to build_patches() that lie
+   * entirely outside of @p bounding_box, see DataOutBase::clip_patches().
+   */
+  void
+  clip_patches(const BoundingBox<spacedim> &bounding_box);
+
+  /**
+   * Reduce the number of subdivisions to @p n_subdivisions on the patches of
+   * all cells for which the value of @p criterion is less than
+   * @p threshold, see DataOutBase::coarsen_patch(). The vector
+   * @p criterion is indexed by the active_cell_index() of the cells, like
+   * the error indicators computed by KellyErrorEstimator and like cell data
+   * added through add_data_vector(). The number of subdivisions used in
+   * build_patches() needs to be a multiple of @p n_subdivisions.
+   *
+   * This function can only be used if build_patches() generated output on
+   * @ref GlossActive "active"
+   * cells.
+   */
+  void
+  coarsen_patches(const Vector<float> &criterion,
+                  const float          threshold,
+                  const unsigned int   n_subdivisions = 1);
+
+  /**
+   * Round the values of the data sets with the given @p names to
+   * @p n_mantissa_bits significant bits, see DataOutBase::reduce_precision().
+   * The names are the ones returned by get_dataset_names(), i.e., the
+   * individual components of vector-valued data sets need to be listed if
+   * they were not given a common name.
+   */
+  void
+  reduce_precision(const std::vector<std::string> &names,
+                   const unsigned int              n_mantissa_bits);
+
 private:
   /**
    * A function object that is used to select what the first cell is going to
@@ -433,6 +486,13 @@ private:
                               const cell_iterator &)>
     next_cell_function;
 
+  /**
+   * For each patch built by the last call to build_patches(), the index of
+   * the cell data associated with the cell the patch was built on, i.e., the
+   * active_cell_index() of active cells.
+   */
+  std::vector<unsigned int> active_index_of_patch;
+
   /**
    * Build one patch. This function is called in a WorkStream context.
    *
@@ -22,6 +22,7 @@
 #include <deal.II/base/numbers.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/signaling_nan.h>
+#include <deal.II/base/tensor_product_polynomials.h>
 #include <deal.II/base/work_stream.h>
 
 #include <deal.II/dofs/dof_accessor.h>
@@ -29,6 +30,7 @@
 #include <deal.II/dofs/dof_tools.h>
 
 #include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_poly.h>
 #include <deal.II/fe/fe_pyramid_p.h>
 #include <deal.II/fe/fe_simplex_p.h>
 #include <deal.II/fe/fe_values.h>
@@ -1017,6 +1019,107 @@ namespace internal
 
         dst.update_ghost_values();
       }
+
+
+
+      /**
+       * Return the one-dimensional polynomials of a scalar element whose
+       * shape functions are tensor products of these polynomials, such as
+       * FE_Q and FE_DGQ, or an empty vector for all other elements.
+       */
+      template <int dim, int spacedim>
+      std::vector<Polynomials::Polynomial<double>>
+      get_tensor_product_polynomials(const FiniteElement<dim, spacedim> &fe)
+      {
+        if (fe.n_components() == 1)
+          if (const auto *fe_poly =
+                dynamic_cast<const FE_Poly<dim, spacedim> *>(&fe))
+            if (const auto *poly_space =
+                  dynamic_cast<const TensorProductPolynomials<dim> *>(
+                    &fe_poly->get_poly_space()))
+              return poly_space->get_underlying_polynomials();
+
+        return {};
+      }
+
+
+
+      /**
+       * Evaluate a scalar finite element function, given by its local
+       * @p dof_values on a cell, at the points of the tensor-product
+       * quadrature @p quadrature, for an element whose shape functions are
+       * tensor products of the one-dimensional @p polynomials with the
+       * given @p numbering of the shape functions relative to the
+       * lexicographic order.
+       *
+       * Rather than summing up the contributions of all shape functions in
+       * all points as FEValuesBase::get_function_values() does, the
+       * evaluation is done one direction after the other by sum
+       * factorization. For $k+1$ polynomials and $n$ points per direction,
+       * this reduces the cost from ${\cal O}((k+1)^d n^d)$ to
+       * ${\cal O}(d (k+1) n^d)$, which matters for output of high-order
+       * solutions on many subdivisions.
+       */
+      template <int dim, typename Number>
+      void
+      evaluate_values_by_sum_factorization(
+        const std::vector<Polynomials::Polynomial<double>> &polynomials,
+        const std::vector<unsigned int>                    &numbering,
+        const Quadrature<dim>                              &quadrature,
+        const Vector<Number>                               &dof_values,
+        std::vector<Number>                                &values)
+      {
+        Assert(quadrature.is_tensor_product(), ExcInternalError());
+        AssertDimension(dof_values.size(), numbering.size());
+
+        const unsigned int n_polynomials = polynomials.size();
+
+        // bring the coefficients into lexicographic order
+        std::vector<Number> in(dof_values.size());
+        for (unsigned int i = 0; i < dof_values.size(); ++i)
+          in[numbering[i]] = dof_values[i];
+
+        // then interpolate to the points one direction after the other. At
+        // the beginning of step d, the directions before d already index
+        // points, whereas the direction d and the ones after it still index
+        // polynomials
+        const auto         &tensor_basis = quadrature.get_tensor_basis();
+        std::vector<Number> out;
+        unsigned int        n_points_before = 1;
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            const std::vector<Point<1>> &points = tensor_basis[d].get_points();
+            const unsigned int           n_points = points.size();
+
+            std::vector<double> shape_values(n_points * n_polynomials);
+            for (unsigned int q = 0; q < n_points; ++q)
+              for (unsigned int i = 0; i < n_polynomials; ++i)
+                shape_values[q * n_polynomials + i] =
+                  polynomials[i].value(points[q][0]);
+
+            const unsigned int n_after =
+              in.size() / (n_points_before * n_polynomials);
+            out.assign(n_points_before * n_points * n_after, Number());
+            for (unsigned int a = 0; a < n_after; ++a)
+              for (unsigned int q = 0; q < n_points; ++q)
+                for (unsigned int i = 0; i < n_polynomials; ++i)
+                  {
+                    const double shape = shape_values[q * n_polynomials + i];
+                    const Number *in_ptr =
+                      in.data() + (a * n_polynomials + i) * n_points_before;
+                    Number *out_ptr =
+                      out.data() + (a * n_points + q) * n_points_before;
+                    for (unsigned int b = 0; b < n_points_before; ++b)
+                      out_ptr[b] += shape * in_ptr[b];
+                  }
+
+            in.swap(out);
+            n_points_before *= n_points;
+          }
+
+        AssertDimension(in.size(), values.size());
+        std::copy(in.begin(), in.end(), values.begin());
+      }
     } // namespace
 
 
@@ -1265,6 +1368,43 @@ namespace internal
                  ExcMessage("You cannot extract anything other than the real "
                             "part from a real number."));
 
+          // for elements of higher degree with tensor-product shape
+          // functions evaluated on the usual tensor-product patch points,
+          // use sum factorization instead of the generic evaluation
+          if (const auto *fe_values =
+                dynamic_cast<const dealii::FEValues<dim, spacedim> *>(
+                  &fe_patch_values))
+            if (fe_values->get_fe().degree >= 2 &&
+                fe_values->get_quadrature().is_tensor_product())
+              {
+                const std::vector<Polynomials::Polynomial<double>>
+                  polynomials =
+                    get_tensor_product_polynomials(fe_values->get_fe());
+                if (polynomials.size() > 0)
+                  {
+                    const auto &fe_poly =
+                      dynamic_cast<const FE_Poly<dim, spacedim> &>(
+                        fe_values->get_fe());
+
+                    const typename DoFHandler<dim, spacedim>::cell_iterator
+                      cell(&fe_values->get_cell()->get_triangulation(),
+                           fe_values->get_cell()->level(),
+                           fe_values->get_cell()->index(),
+                           this->dof_handler);
+
+                    Vector<double> dof_values(
+                      fe_values->get_fe().n_dofs_per_cell());
+                    cell->get_interpolated_dof_values(vector, dof_values);
+                    evaluate_values_by_sum_factorization(
+                      polynomials,
+                      fe_poly.get_poly_space_numbering(),
+                      fe_values->get_quadrature(),
+                      dof_values,
+                      patch_values);
+                    return;
+                  }
+              }
+
           fe_patch_values.get_function_values(vector, patch_values);
         }
       else
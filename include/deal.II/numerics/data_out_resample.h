@@ -53,6 +53,21 @@ DEAL_II_NAMESPACE_OPEN
  * data_out.build_patches(mapping);
  * @endcode
  *
+ * The expensive part of the setup, i.e., the search of the cells around the
+ * evaluation points and the setup of the communication pattern, is done in
+ * update_mapping(). The result is kept across calls of the build_patches()
+ * function without a mapping argument, e.g., for the output of several time
+ * steps, until the triangulation changes. In each call of build_patches(), up
+ * to eight scalar components of the attached data vectors are evaluated
+ * together, with a single communication between the processes.
+ *
+ * Output at a lower resolution than the one of the original mesh, e.g., for
+ * monitoring purposes, is obtained by a coarse patch triangulation, such as a
+ * Cartesian mesh created by GridGenerator::subdivided_hyper_rectangle(),
+ * combined with a small value of @p n_subdivisions. The cost of the output
+ * is then determined by the number of points of the patch triangulation
+ * rather than by the size of the original mesh.
+ *
  * @note While the dimension of the two triangulations might differ, their
  *   space dimension need to coincide.
  */
@@ -21,7 +21,9 @@
 
 #include <deal.II/base/enable_observer_pointer.h>
 #include <deal.II/base/point.h>
+#include <deal.II/base/table.h>
 #include <deal.II/base/tensor.h>
+#include <deal.II/base/thread_local_storage.h>
 
 #include <deal.II/dofs/dof_handler.h>
 
@@ -448,6 +450,119 @@ namespace DataPostprocessorInputs
     std::vector<std::vector<Tensor<2, spacedim>>> solution_hessians;
   };
 
+
+  /**
+   * A structure that is used to pass the values and derivatives of a
+   * (scalar or vector-valued) solution to
+   * DataPostprocessor::evaluate_field_on_arrays(). It contains the same
+   * information as the Scalar and Vector classes, but stores it in a
+   * "structure of arrays" layout: For each solution component (and, for
+   * derivatives, each coordinate direction), the values at all evaluation
+   * points of the current cell are stored contiguously in memory. This
+   * allows a postprocessor to compute derived quantities with loops over
+   * the evaluation points that the compiler can vectorize, or that load
+   * several evaluation points at a time into a VectorizedArray, rather than
+   * working on one Tensor or Vector object per evaluation point.
+   *
+   * The number of components and the arrangement of real and imaginary parts
+   * for complex-valued solutions is the same as for the Vector class.
+   *
+   * Through the fields in the CommonInputs base class, this class also
+   * makes available access to the locations of evaluations points,
+   * normal vectors (if appropriate), and which cell data is currently
+   * being evaluated on (also if appropriate).
+   */
+  template <int spacedim>
+  struct Arrays : public CommonInputs<spacedim>
+  {
+    /**
+     * The number of evaluation points on the current cell, face, or other
+     * object.
+     */
+    unsigned int n_evaluation_points = 0;
+
+    /**
+     * The number of solution components at each evaluation point.
+     */
+    unsigned int n_components = 0;
+
+    /**
+     * The values of the solution. The value of component $c$ at evaluation
+     * point $q$ is stored at index <code>c*n_evaluation_points+q</code>.
+     *
+     * This array is only filled if the
+     * DataPostprocessor::get_needed_update_flags() function returns (possibly
+     * among other flags) UpdateFlags::update_values.
+     */
+    std::vector<double> solution_values;
+
+    /**
+     * The gradients of the solution. The derivative of component $c$ in
+     * direction $d$ at evaluation point $q$ is stored at index
+     * <code>(c*spacedim+d)*n_evaluation_points+q</code>.
+     *
+     * This array is only filled if the
+     * DataPostprocessor::get_needed_update_flags() function returns (possibly
+     * among other flags) UpdateFlags::update_gradients.
+     */
+    std::vector<double> solution_gradients;
+
+    /**
+     * The second derivatives of the solution. The derivative of component $c$
+     * in directions $d_1,d_2$ at evaluation point $q$ is stored at index
+     * <code>((c*spacedim+d1)*spacedim+d2)*n_evaluation_points+q</code>.
+     *
+     * This array is only filled if the
+     * DataPostprocessor::get_needed_update_flags() function returns (possibly
+     * among other flags) UpdateFlags::update_hessians.
+     */
+    std::vector<double> solution_hessians;
+
+    /**
+     * Return a pointer to the n_evaluation_points values of the given
+     * solution component.
+     */
+    const double *
+    get_values(const unsigned int component) const;
+
+    /**
+     * Return a pointer to the n_evaluation_points values of the derivative of
+     * the given solution component in the given coordinate direction.
+     */
+    const double *
+    get_gradients(const unsigned int component,
+                  const unsigned int direction) const;
+
+    /**
+     * Return a pointer to the n_evaluation_points values of the second
+     * derivative of the given solution component in the given pair of
+     * coordinate directions.
+     */
+    const double *
+    get_hessians(const unsigned int component,
+                 const unsigned int direction_1,
+                 const unsigned int direction_2) const;
+
+    /**
+     * Copy the data of the given input object, which contains data at
+     * @p n_points evaluation points, into the current object, converting the
+     * layout. Only those arrays are filled for which the corresponding flag
+     * is set in @p update_flags.
+     */
+    void
+    reinit(const Scalar<spacedim> &input_data,
+           const unsigned int      n_points,
+           const UpdateFlags       update_flags);
+
+    /**
+     * Same as above, for vector-valued input data.
+     */
+    void
+    reinit(const Vector<spacedim> &input_data,
+           const unsigned int      n_points,
+           const UpdateFlags       update_flags);
+  };
+
 } // namespace DataPostprocessorInputs
 
 
@@ -576,6 +691,46 @@ namespace DataPostprocessorInputs
  * step-58 provides an example of how this class (or, rather, the derived
  * DataPostprocessorScalar class) is used in a complex-valued situation.
  *
+ *
+ * <h3>Vectorized evaluation</h3>
+ *
+ * The DataPostprocessorInputs::Scalar and DataPostprocessorInputs::Vector
+ * objects passed to evaluate_scalar_field() and evaluate_vector_field()
+ * store one Tensor or Vector object per evaluation point. Computing a
+ * derived quantity from them leads to loops that the compiler can not
+ * vectorize. Derived classes can instead implement the
+ * evaluate_field_on_arrays() function, which receives all values at the
+ * evaluation points of a cell contiguously for each component and
+ * coordinate direction, and which writes the computed quantities for one
+ * output component at all evaluation points contiguously as well. For
+ * example, the vorticity of a two-dimensional velocity field can be
+ * computed as follows:
+ * @code
+ *   template <int dim>
+ *   class Vorticity : public DataPostprocessorScalar<dim>
+ *   {
+ *   public:
+ *     Vorticity()
+ *       : DataPostprocessorScalar<dim>("vorticity", update_gradients)
+ *     {}
+ *
+ *     virtual void
+ *     evaluate_field_on_arrays(
+ *       const DataPostprocessorInputs::Arrays<dim> &input_data,
+ *       Table<2, double> &computed_quantities) const override
+ *     {
+ *       const double *du_dy = input_data.get_gradients(0, 1);
+ *       const double *dv_dx = input_data.get_gradients(1, 0);
+ *       for (unsigned int q = 0; q < input_data.n_evaluation_points; ++q)
+ *         computed_quantities(0, q) = dv_dx[q] - du_dy[q];
+ *     }
+ *   };
+ * @endcode
+ * More complicated expressions can be evaluated for several evaluation
+ * points at once by loading the data into VectorizedArray objects via
+ * VectorizedArray::load() and writing the results back via
+ * VectorizedArray::store().
+ *
  * @ingroup output
  */
 template <int dim>
@@ -607,6 +762,10 @@ public:
    * converted into graphical data by DataOut or similar classes represents
    * scalar data, i.e., if the finite element in use has only a single
    * real-valued vector component.
+   *
+   * The default implementation of this function converts the input data
+   * into the layout of DataPostprocessorInputs::Arrays and calls
+   * evaluate_field_on_arrays().
    */
   virtual void
   evaluate_scalar_field(const DataPostprocessorInputs::Scalar<dim> &input_data,
@@ -621,11 +780,37 @@ public:
    * is complex-valued (whether scalar or not), then the input data contains
    * first all real parts of the solution vector at each evaluation point, and
    * then all imaginary parts.
+   *
+   * As for evaluate_scalar_field(), the default implementation of this
+   * function calls evaluate_field_on_arrays().
    */
   virtual void
   evaluate_vector_field(const DataPostprocessorInputs::Vector<dim> &input_data,
                         std::vector<Vector<double>> &computed_quantities) const;
 
+  /**
+   * An alternative to the evaluate_scalar_field() and
+   * evaluate_vector_field() functions that receives the solution data in a
+   * "structure of arrays" layout, see DataPostprocessorInputs::Arrays, and
+   * that has to write the computed quantities into the second argument,
+   * a table that has already been sized to the number of computed
+   * quantities times the number of evaluation points. The loops over the
+   * evaluation points of such an implementation work on contiguous arrays
+   * and can be vectorized. Derived classes that implement this function do
+   * not need to implement evaluate_scalar_field() or
+   * evaluate_vector_field(); the default implementations of these functions
+   * forward to the current one for all classes producing graphical output,
+   * as well as for the PointValueHistory class.
+   *
+   * The function is called for both scalar and vector-valued data; the
+   * number of solution components can be queried through
+   * DataPostprocessorInputs::Arrays::n_components.
+   */
+  virtual void
+  evaluate_field_on_arrays(
+    const DataPostprocessorInputs::Arrays<dim> &input_data,
+    Table<2, double>                           &computed_quantities) const;
+
   /**
    * Return the vector of strings describing the names of the computed
    * quantities.
@@ -678,6 +863,18 @@ public:
    */
   virtual UpdateFlags
   get_needed_update_flags() const = 0;
+
+private:
+  /**
+   * Scratch objects used by the default implementations of
+   * evaluate_scalar_field() and evaluate_vector_field() to convert their
+   * arguments into the form expected by evaluate_field_on_arrays(). They
+   * are stored per thread since DataOut calls the postprocessor from
+   * several threads at once.
+   */
+  mutable Threads::ThreadLocalStorage<
+    std::pair<DataPostprocessorInputs::Arrays<dim>, Table<2, double>>>
+    array_scratch_data;
 };
 
 
@@ -1424,6 +1621,45 @@ namespace DataPostprocessorInputs
     return std::any_cast<typename DoFHandler<dim, spacedim>::cell_iterator>(
       cell);
   }
+
+
+  template <int spacedim>
+  inline const double *
+  Arrays<spacedim>::get_values(const unsigned int component) const
+  {
+    AssertIndexRange(component, n_components);
+    return solution_values.data() + component * n_evaluation_points;
+  }
+
+
+
+  template <int spacedim>
+  inline const double *
+  Arrays<spacedim>::get_gradients(const unsigned int component,
+                                  const unsigned int direction) const
+  {
+    AssertIndexRange(component, n_components);
+    AssertIndexRange(direction, spacedim);
+    return solution_gradients.data() +
+           (component * spacedim + direction) * n_evaluation_points;
+  }
+
+
+
+  template <int spacedim>
+  inline const double *
+  Arrays<spacedim>::get_hessians(const unsigned int component,
+                                 const unsigned int direction_1,
+                                 const unsigned int direction_2) const
+  {
+    AssertIndexRange(component, n_components);
+    AssertIndexRange(direction_1, spacedim);
+    AssertIndexRange(direction_2, spacedim);
+    return solution_hessians.data() +
+           ((component * spacedim + direction_1) * spacedim + direction_2) *
+             n_evaluation_points;
+  }
+
 } // namespace DataPostprocessorInputs
 
 #endif
@@ -0,0 +1,948 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_jacobian_free_newton_krylov_h
+#define dealii_jacobian_free_newton_krylov_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/enable_observer_pointer.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/numbers.h>
+
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+
+#include <deal.II/numerics/nonlinear.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+DEAL_II_NAMESPACE_OPEN
+
+// Forward declaration
+#ifndef DOXYGEN
+template <int dim, typename Number, typename VectorizedArrayType>
+class MatrixFree;
+#endif
+
+/**
+ * A contiguous storage of data at the quadrature points of all cell batches
+ * of a MatrixFree object, such as the solution values or gradients at the
+ * linearization point of a nonlinear operator. The data of the quadrature
+ * points of a cell batch are stored consecutively, and the cell batches
+ * follow each other in the order of MatrixFree::cell_loop(), such that the
+ * data is accessed with unit stride when the linearized operator is
+ * applied. Compared to CellDataStorage, which stores objects per cell of
+ * the triangulation, this class has no indirection and the data can be
+ * vectorized types like VectorizedArray or Tensor<1, dim,
+ * VectorizedArray<double>>.
+ *
+ * A typical use fills the data in a cell loop at the linearization point
+ * and reads it in the cell loop of the linearized operator:
+ * @code
+ * LinearizationPointCache<Tensor<1, dim, VectorizedArray<double>>> cache;
+ * cache.reinit(matrix_free);
+ *
+ * // in the cell loop at the linearization point u:
+ * phi.reinit(cell);
+ * phi.gather_evaluate(u, EvaluationFlags::gradients);
+ * for (const unsigned int q : phi.quadrature_point_indices())
+ *   cache(cell, q) = phi.get_gradient(q);
+ * @endcode
+ *
+ * This class is constructed for a constant number of quadrature points per
+ * cell batch, i.e., it does not support different quadrature formulas in
+ * the hp-case.
+ */
+template <typename T>
+class LinearizationPointCache
+{
+public:
+  /**
+   * Constructor. Creates an empty cache.
+   */
+  LinearizationPointCache();
+
+  /**
+   * Set up the cache for @p n_cell_batches cell batches that each have
+   * @p n_q_points quadrature points.
+   */
+  void
+  reinit(const unsigned int n_cell_batches, const unsigned int n_q_points);
+
+  /**
+   * Set up the cache for the cell batches of @p matrix_free and the
+   * quadrature formula with index @p quad_index.
+   */
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  reinit(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+         const unsigned int                                  quad_index = 0);
+
+  /**
+   * Return the number of cell batches the cache has been set up for.
+   */
+  unsigned int
+  n_cell_batches() const;
+
+  /**
+   * Return the number of quadrature points per cell batch.
+   */
+  unsigned int
+  n_q_points() const;
+
+  /**
+   * Return a reference to the data of the quadrature point @p q of the
+   * cell batch @p cell.
+   */
+  T &
+  operator()(const unsigned int cell, const unsigned int q);
+
+  /**
+   * Return a reference to the data of the quadrature point @p q of the
+   * cell batch @p cell.
+   */
+  const T &
+  operator()(const unsigned int cell, const unsigned int q) const;
+
+  /**
+   * Return a view to the data of all quadrature points of the cell batch
+   * @p cell.
+   */
+  ArrayView<T>
+  operator[](const unsigned int cell);
+
+  /**
+   * Return a view to the data of all quadrature points of the cell batch
+   * @p cell.
+   */
+  ArrayView<const T>
+  operator[](const unsigned int cell) const;
+
+  /**
+   * Return an estimate for the memory consumption, in bytes, of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The number of quadrature points per cell batch.
+   */
+  unsigned int n_q_points_per_cell;
+
+  /**
+   * The data of all quadrature points.
+   */
+  AlignedVector<T> data;
+};
+
+
+
+/**
+ * A Jacobian-free Newton-Krylov (JFNK) solver for the linear systems of
+ * Newton's method, to be used with NonlinearSolverSelector or directly with
+ * the nonlinear solvers SUNDIALS::KINSOL and TrilinosWrappers::NOXSolver.
+ * The class provides the functions setup_jacobian() and
+ * solve_with_jacobian() expected by these classes, solving the linear
+ * systems with the Jacobian by GMRES, for which only the action of the
+ * Jacobian on a vector is needed. This action is either given by
+ * - a finite difference of the residual,
+ *   @f[
+ *     J(u) v \approx \frac{F(u + h v) - F(u)}{h}, \qquad
+ *     h = \frac{\epsilon \sqrt{1 + \|u\|}}{\|v\|},
+ *   @f]
+ *   which only needs the function residual, or by
+ * - an analytic linearization of the residual provided by the user through
+ *   the functions setup_linearization() and apply_linearization(). For
+ *   operators evaluated with MatrixFree, setup_linearization() typically
+ *   evaluates the data needed at the quadrature points of the
+ *   linearization point and stores it in a LinearizationPointCache, from
+ *   which apply_linearization() reads it in its cell loop. This avoids the
+ *   recomputation of these data in every iteration of the linear solver,
+ *   and saves one residual evaluation per iteration compared to the finite
+ *   difference.
+ *
+ * <h3>Preconditioner reuse</h3>
+ * The preconditioner, e.g., a geometric multigrid method for the
+ * linearized operator, is set up through setup_preconditioner() and
+ * applied through apply_preconditioner(). As the setup of such a
+ * preconditioner is often more expensive than a few additional linear
+ * iterations, the preconditioner is only rebuilt in setup_jacobian() if
+ * the number of linear iterations has grown by more than the factor
+ * AdditionalData::rebuild_iteration_factor compared to the first solve
+ * after the last setup, or if it has been used for more than
+ * AdditionalData::maximum_preconditioner_age Newton steps. Otherwise,
+ * the preconditioner of an earlier linearization point is used.
+ *
+ * <h3>Forcing terms</h3>
+ * The linear systems need not be solved accurately far from the
+ * solution. With AdditionalData::forcing_term set to one of the
+ * Eisenstat-Walker choices, the linear system in Newton step $k$ is solved
+ * to the relative tolerance $\eta_k$ with respect to the norm of the right
+ * hand side $-F(u_k)$, where $\eta_k$ is computed from the decrease of the
+ * nonlinear residual (S. C. Eisenstat, H. F. Walker, Choosing the forcing
+ * terms in an inexact Newton method, SIAM J. Sci. Comput. 17 (1996)):
+ * - Choice 1:
+ *   $\eta_k = \frac{\left|\|F(u_k)\| - \|F(u_{k-1}) + J(u_{k-1})
+ *   s_{k-1}\|\right|}{\|F(u_{k-1})\|}$,
+ * - Choice 2:
+ *   $\eta_k = \gamma \left(\frac{\|F(u_k)\|}{\|F(u_{k-1})\|}
+ *   \right)^\alpha$,
+ *
+ * both with the safeguards proposed in that paper and bounded by
+ * AdditionalData::maximum_forcing_term.
+ *
+ * <h3>Usage</h3>
+ * @code
+ * JacobianFreeNewtonKrylov<VectorType> jfnk;
+ * jfnk.residual = [&](const VectorType &u, VectorType &f) {...};
+ * jfnk.setup_preconditioner = [&](const VectorType &u) {...};
+ * jfnk.apply_preconditioner = [&](const VectorType &src,
+ *                                 VectorType       &dst) {...};
+ *
+ * NonlinearSolverSelector<VectorType> nonlinear_solver(additional_data,
+ *                                                      mpi_communicator);
+ * nonlinear_solver.reinit_vector = [&](VectorType &x) {...};
+ * jfnk.connect(nonlinear_solver);
+ * nonlinear_solver.solve(solution);
+ * @endcode
+ *
+ * @note The finite difference and the Eisenstat-Walker forcing terms
+ * assume that the right hand side handed to solve_with_jacobian() is the
+ * negative residual at the point of the last call to setup_jacobian(),
+ * which is the case for the Newton and line search strategies of the
+ * nonlinear solvers. Solvers that do not call setup_jacobian() in every
+ * Newton step, such as KINSOL with its default settings, use the
+ * linearization at the last point handed to setup_jacobian(), resulting
+ * in a modified Newton method.
+ */
+template <typename VectorType>
+class JacobianFreeNewtonKrylov : public EnableObserverPointer
+{
+public:
+  /**
+   * The way the action of the Jacobian on a vector is computed.
+   */
+  enum class Linearization
+  {
+    /**
+     * Finite difference of the residual.
+     */
+    finite_difference,
+    /**
+     * Use the functions setup_linearization() and apply_linearization().
+     */
+    analytic
+  };
+
+  /**
+   * The tolerance with which the linear systems are solved.
+   */
+  enum class ForcingTerm
+  {
+    /**
+     * Use the tolerance handed to solve_with_jacobian() by the nonlinear
+     * solver.
+     */
+    nonlinear_solver,
+    /**
+     * Eisenstat-Walker choice 1, based on the agreement between the
+     * nonlinear residual and its linear model in the previous step.
+     */
+    eisenstat_walker_1,
+    /**
+     * Eisenstat-Walker choice 2, based on the decrease of the nonlinear
+     * residual.
+     */
+    eisenstat_walker_2
+  };
+
+  /**
+   * Collects the options of this class.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor which sets the default arguments.
+     */
+    AdditionalData(
+      const Linearization linearization = Linearization::finite_difference,
+      const ForcingTerm   forcing_term  = ForcingTerm::eisenstat_walker_2,
+      const unsigned int  max_linear_iterations    = 200,
+      const unsigned int  max_basis_size           = 30,
+      const double        rebuild_iteration_factor = 1.5,
+      const unsigned int  maximum_preconditioner_age =
+        numbers::invalid_unsigned_int)
+      : linearization(linearization)
+      , forcing_term(forcing_term)
+      , max_linear_iterations(max_linear_iterations)
+      , max_basis_size(max_basis_size)
+      , finite_difference_epsilon(
+          std::sqrt(std::numeric_limits<double>::epsilon()))
+      , initial_forcing_term(0.5)
+      , maximum_forcing_term(0.9)
+      , eisenstat_walker_gamma(0.9)
+      , eisenstat_walker_alpha(2.)
+      , rebuild_iteration_factor(rebuild_iteration_factor)
+      , maximum_preconditioner_age(maximum_preconditioner_age)
+    {}
+
+    /**
+     * The way the action of the Jacobian is computed.
+     */
+    Linearization linearization;
+
+    /**
+     * The tolerance with which the linear systems are solved.
+     */
+    ForcingTerm forcing_term;
+
+    /**
+     * The maximal number of GMRES iterations per linear system.
+     */
+    unsigned int max_linear_iterations;
+
+    /**
+     * The maximal size of the Krylov space before GMRES restarts.
+     */
+    unsigned int max_basis_size;
+
+    /**
+     * The relative size $\epsilon$ of the finite difference step, which
+     * defaults to the square root of the machine precision.
+     */
+    double finite_difference_epsilon;
+
+    /**
+     * The forcing term $\eta_0$ of the first Newton step in case of the
+     * Eisenstat-Walker forcing terms.
+     */
+    double initial_forcing_term;
+
+    /**
+     * The upper bound $\eta_{\max}$ of the Eisenstat-Walker forcing terms.
+     */
+    double maximum_forcing_term;
+
+    /**
+     * The parameter $\gamma$ of Eisenstat-Walker choice 2.
+     */
+    double eisenstat_walker_gamma;
+
+    /**
+     * The parameter $\alpha$ of Eisenstat-Walker choice 2.
+     */
+    double eisenstat_walker_alpha;
+
+    /**
+     * The preconditioner is rebuilt in the next call to setup_jacobian()
+     * once a linear solve takes more than this factor times the number of
+     * iterations of the first solve after the last setup. A value of zero
+     * rebuilds the preconditioner in every call to setup_jacobian().
+     */
+    double rebuild_iteration_factor;
+
+    /**
+     * The maximal number of calls to setup_jacobian() for which the same
+     * preconditioner is used.
+     */
+    unsigned int maximum_preconditioner_age;
+  };
+
+  /**
+   * Constructor.
+   */
+  JacobianFreeNewtonKrylov(const AdditionalData &additional_data = {});
+
+  /**
+   * Set the options of this class.
+   */
+  void
+  set_data(const AdditionalData &additional_data);
+
+  /**
+   * Set the functions NonlinearSolverSelector::residual,
+   * NonlinearSolverSelector::setup_jacobian, and
+   * NonlinearSolverSelector::solve_with_jacobian of @p nonlinear_solver
+   * to the ones of this object, which needs to live as long as
+   * @p nonlinear_solver is used.
+   */
+  void
+  connect(NonlinearSolverSelector<VectorType> &nonlinear_solver);
+
+  /**
+   * Store the linearization point @p current_u for the subsequent calls to
+   * solve_with_jacobian(), and set up the linearization and, if needed,
+   * the preconditioner.
+   */
+  void
+  setup_jacobian(const VectorType &current_u);
+
+  /**
+   * Solve the linear system $J(u) \, \texttt{dst} = \texttt{rhs}$ at the
+   * linearization point $u$ of the last call to setup_jacobian() with
+   * GMRES. Depending on AdditionalData::forcing_term, the linear system is
+   * solved to the absolute tolerance @p tolerance or to a tolerance given
+   * by the Eisenstat-Walker forcing terms.
+   */
+  void
+  solve_with_jacobian(const VectorType &rhs,
+                      VectorType       &dst,
+                      const double      tolerance);
+
+  /**
+   * Compute the action of the Jacobian at the linearization point of the
+   * last call to setup_jacobian() on @p src.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Return the total number of linear iterations since the construction
+   * of this object.
+   */
+  unsigned int
+  n_linear_iterations() const;
+
+  /**
+   * Return the number of setups of the preconditioner since the
+   * construction of this object.
+   */
+  unsigned int
+  n_preconditioner_setups() const;
+
+  /**
+   * A function object that users need to supply and that is intended to
+   * compute the residual `dst = F(src)`.
+   */
+  std::function<void(const VectorType &src, VectorType &dst)> residual;
+
+  /**
+   * A function object that users need to supply for
+   * Linearization::analytic and that is intended to prepare the
+   * application of the Jacobian at @p linearization_point, e.g., by
+   * computing the data at the quadrature points needed by
+   * apply_linearization().
+   */
+  std::function<void(const VectorType &linearization_point)>
+    setup_linearization;
+
+  /**
+   * A function object that users need to supply for
+   * Linearization::analytic and that is intended to compute
+   * `dst = J(u) src` at the linearization point $u$ of the last call to
+   * setup_linearization().
+   */
+  std::function<void(const VectorType &src, VectorType &dst)>
+    apply_linearization;
+
+  /**
+   * A function object that users may supply and that is intended to set up
+   * a preconditioner for the Jacobian at @p linearization_point. It is
+   * only called when the preconditioner needs to be rebuilt, see the
+   * general documentation of this class.
+   */
+  std::function<void(const VectorType &linearization_point)>
+    setup_preconditioner;
+
+  /**
+   * A function object that users may supply and that is intended to apply
+   * the inverse of the preconditioner, `dst = P^{-1} src`. If not supplied,
+   * no preconditioner is used.
+   */
+  std::function<void(const VectorType &src, VectorType &dst)>
+    apply_preconditioner;
+
+private:
+  /**
+   * A wrapper around apply_preconditioner() providing the vmult() function
+   * used by the linear solver.
+   */
+  class Preconditioner
+  {
+  public:
+    Preconditioner(const JacobianFreeNewtonKrylov &solver);
+
+    void
+    vmult(VectorType &dst, const VectorType &src) const;
+
+  private:
+    const JacobianFreeNewtonKrylov &solver;
+  };
+
+  /**
+   * Compute the forcing term of the current Newton step with the norm
+   * @p residual_norm of the current residual.
+   */
+  double
+  compute_forcing_term(const double residual_norm) const;
+
+  /**
+   * The options of this class.
+   */
+  AdditionalData additional_data;
+
+  /**
+   * The linearization point of the last call to setup_jacobian().
+   */
+  VectorType linearization_point;
+
+  /**
+   * The residual at the linearization point, only used for the finite
+   * difference.
+   */
+  VectorType residual_at_linearization_point;
+
+  /**
+   * A temporary vector for the perturbed linearization point of the finite
+   * difference.
+   */
+  mutable VectorType perturbed_point;
+
+  /**
+   * The norm of the linearization point.
+   */
+  double linearization_point_norm;
+
+  /**
+   * The norm of the right hand side of the previous linear solve, i.e.,
+   * of the nonlinear residual of the previous Newton step, or a negative
+   * number before the first solve.
+   */
+  double last_residual_norm;
+
+  /**
+   * The norm of the final linear residual of the previous linear solve.
+   */
+  double last_linear_residual_norm;
+
+  /**
+   * The forcing term of the previous linear solve.
+   */
+  double last_forcing_term;
+
+  /**
+   * Whether the preconditioner has been set up.
+   */
+  bool preconditioner_is_set_up;
+
+  /**
+   * Whether the preconditioner needs to be set up in the next call to
+   * setup_jacobian().
+   */
+  bool rebuild_preconditioner;
+
+  /**
+   * The number of calls to setup_jacobian() since the last setup of the
+   * preconditioner.
+   */
+  unsigned int preconditioner_age;
+
+  /**
+   * The number of linear iterations of the first solve after the last
+   * setup of the preconditioner, or numbers::invalid_unsigned_int if no
+   * solve has been done since.
+   */
+  unsigned int n_iterations_after_setup;
+
+  /**
+   * The total number of linear iterations.
+   */
+  unsigned int n_total_linear_iterations;
+
+  /**
+   * The number of setups of the preconditioner.
+   */
+  unsigned int n_total_preconditioner_setups;
+};
+
+
+
+#ifndef DOXYGEN
+
+/* ------------------- LinearizationPointCache ------------------- */
+
+template <typename T>
+inline LinearizationPointCache<T>::LinearizationPointCache()
+  : n_q_points_per_cell(0)
+{}
+
+
+
+template <typename T>
+inline void
+LinearizationPointCache<T>::reinit(const unsigned int n_cell_batches,
+                                   const unsigned int n_q_points)
+{
+  n_q_points_per_cell = n_q_points;
+  data.resize_fast(static_cast<std::size_t>(n_cell_batches) * n_q_points);
+}
+
+
+
+template <typename T>
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+LinearizationPointCache<T>::reinit(
+  const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+  const unsigned int                                  quad_index)
+{
+  reinit(matrix_free.n_cell_batches(), matrix_free.get_n_q_points(quad_index));
+}
+
+
+
+template <typename T>
+inline unsigned int
+LinearizationPointCache<T>::n_cell_batches() const
+{
+  return n_q_points_per_cell > 0 ? data.size() / n_q_points_per_cell : 0;
+}
+
+
+
+template <typename T>
+inline unsigned int
+LinearizationPointCache<T>::n_q_points() const
+{
+  return n_q_points_per_cell;
+}
+
+
+
+template <typename T>
+inline T &
+LinearizationPointCache<T>::operator()(const unsigned int cell,
+                                       const unsigned int q)
+{
+  AssertIndexRange(q, n_q_points_per_cell);
+  AssertIndexRange(static_cast<std::size_t>(cell) * n_q_points_per_cell + q,
+                   data.size());
+  return data[static_cast<std::size_t>(cell) * n_q_points_per_cell + q];
+}
+
+
+
+template <typename T>
+inline const T &
+LinearizationPointCache<T>::operator()(const unsigned int cell,
+                                       const unsigned int q) const
+{
+  AssertIndexRange(q, n_q_points_per_cell);
+  AssertIndexRange(static_cast<std::size_t>(cell) * n_q_points_per_cell + q,
+                   data.size());
+  return data[static_cast<std::size_t>(cell) * n_q_points_per_cell + q];
+}
+
+
+
+template <typename T>
+inline ArrayView<T>
+LinearizationPointCache<T>::operator[](const unsigned int cell)
+{
+  AssertIndexRange(cell, n_cell_batches());
+  return make_array_view(data.begin() + static_cast<std::size_t>(cell) *
+                                          n_q_points_per_cell,
+                         data.begin() + static_cast<std::size_t>(cell + 1) *
+                                          n_q_points_per_cell);
+}
+
+
+
+template <typename T>
+inline ArrayView<const T>
+LinearizationPointCache<T>::operator[](const unsigned int cell) const
+{
+  AssertIndexRange(cell, n_cell_batches());
+  return make_array_view(data.begin() + static_cast<std::size_t>(cell) *
+                                          n_q_points_per_cell,
+                         data.begin() + static_cast<std::size_t>(cell + 1) *
+                                          n_q_points_per_cell);
+}
+
+
+
+template <typename T>
+inline std::size_t
+LinearizationPointCache<T>::memory_consumption() const
+{
+  return sizeof(*this) + data.memory_consumption();
+}
+
+
+
+/* ------------------- JacobianFreeNewtonKrylov ------------------- */
+
+template <typename VectorType>
+JacobianFreeNewtonKrylov<VectorType>::JacobianFreeNewtonKrylov(
+  const AdditionalData &additional_data)
+  : additional_data(additional_data)
+  , linearization_point_norm(0.)
+  , last_residual_norm(-1.)
+  , last_linear_residual_norm(0.)
+  , last_forcing_term(additional_data.initial_forcing_term)
+  , preconditioner_is_set_up(false)
+  , rebuild_preconditioner(true)
+  , preconditioner_age(0)
+  , n_iterations_after_setup(numbers::invalid_unsigned_int)
+  , n_total_linear_iterations(0)
+  , n_total_preconditioner_setups(0)
+{}
+
+
+
+template <typename VectorType>
+void
+JacobianFreeNewtonKrylov<VectorType>::set_data(
+  const AdditionalData &additional_data)
+{
+  this->additional_data = additional_data;
+}
+
+
+
+template <typename VectorType>
+void
+JacobianFreeNewtonKrylov<VectorType>::connect(
+  NonlinearSolverSelector<VectorType> &nonlinear_solver)
+{
+  Assert(residual, ExcMessage("The residual function needs to be set."));
+
+  nonlinear_solver.residual       = residual;
+  nonlinear_solver.setup_jacobian = [this](const VectorType &current_u) {
+    setup_jacobian(current_u);
+  };
+  nonlinear_solver.solve_with_jacobian =
+    [this](const VectorType &rhs, VectorType &dst, const double tolerance) {
+      solve_with_jacobian(rhs, dst, tolerance);
+    };
+}
+
+
+
+template <typename VectorType>
+void
+JacobianFreeNewtonKrylov<VectorType>::setup_jacobian(
+  const VectorType &current_u)
+{
+  linearization_point = current_u;
+
+  if (additional_data.linearization == Linearization::finite_difference)
+    {
+      Assert(residual, ExcMessage("The residual function needs to be set."));
+      residual_at_linearization_point.reinit(current_u, true);
+      residual(linearization_point, residual_at_linearization_point);
+      linearization_point_norm = linearization_point.l2_norm();
+    }
+  else
+    {
+      Assert(setup_linearization && apply_linearization,
+             ExcMessage("The analytic linearization needs the functions "
+                        "setup_linearization and apply_linearization."));
+      setup_linearization(linearization_point);
+    }
+
+  // rebuild the preconditioner only when the linear iterations have grown
+  // too much with the old one, or when it has become too old
+  ++preconditioner_age;
+  if (rebuild_preconditioner || preconditioner_is_set_up == false ||
+      preconditioner_age > additional_data.maximum_preconditioner_age ||
+      additional_data.rebuild_iteration_factor == 0.)
+    {
+      if (setup_preconditioner)
+        setup_preconditioner(linearization_point);
+
+      preconditioner_is_set_up = true;
+      rebuild_preconditioner   = false;
+      preconditioner_age       = 1;
+      n_iterations_after_setup = numbers::invalid_unsigned_int;
+      ++n_total_preconditioner_setups;
+    }
+}
+
+
+
+template <typename VectorType>
+double
+JacobianFreeNewtonKrylov<VectorType>::compute_forcing_term(
+  const double residual_norm) const
+{
+  if (last_residual_norm <= 0.)
+    return additional_data.initial_forcing_term;
+
+  double forcing_term = additional_data.maximum_forcing_term;
+  if (additional_data.forcing_term == ForcingTerm::eisenstat_walker_1)
+    {
+      const double alpha = 0.5 * (1. + std::sqrt(5.));
+      forcing_term = std::abs(residual_norm - last_linear_residual_norm) /
+                     last_residual_norm;
+
+      const double safeguard = std::pow(last_forcing_term, alpha);
+      if (safeguard > 0.1)
+        forcing_term = std::max(forcing_term, safeguard);
+    }
+  else if (additional_data.forcing_term == ForcingTerm::eisenstat_walker_2)
+    {
+      const double gamma = additional_data.eisenstat_walker_gamma;
+      const double alpha = additional_data.eisenstat_walker_alpha;
+      forcing_term =
+        gamma * std::pow(residual_norm / last_residual_norm, alpha);
+
+      const double safeguard = gamma * std::pow(last_forcing_term, alpha);
+      if (safeguard > 0.1)
+        forcing_term = std::max(forcing_term, safeguard);
+    }
+  else
+    DEAL_II_NOT_IMPLEMENTED();
+
+  return std::min(forcing_term, additional_data.maximum_forcing_term);
+}
+
+
+
+template <typename VectorType>
+void
+JacobianFreeNewtonKrylov<VectorType>::solve_with_jacobian(
+  const VectorType &rhs,
+  VectorType       &dst,
+  const double      tolerance)
+{
+  const double residual_norm = rhs.l2_norm();
+
+  double linear_tolerance = tolerance;
+  double forcing_term     = 0.;
+  if (additional_data.forcing_term != ForcingTerm::nonlinear_solver)
+    {
+      forcing_term     = compute_forcing_term(residual_norm);
+      linear_tolerance = forcing_term * residual_norm;
+    }
+
+  SolverControl solver_control(additional_data.max_linear_iterations,
+                               linear_tolerance,
+                               false,
+                               false);
+
+  // right preconditioning, such that the residual monitored by the solver
+  // is the one of the unpreconditioned system needed by the forcing terms
+  typename SolverGMRES<VectorType>::AdditionalData gmres_data(
+    additional_data.max_basis_size, true);
+  SolverGMRES<VectorType> solver(solver_control, gmres_data);
+
+  dst.reinit(rhs);
+  try
+    {
+      if (apply_preconditioner)
+        solver.solve(*this, dst, rhs, Preconditioner(*this));
+      else
+        solver.solve(*this, dst, rhs, PreconditionIdentity());
+    }
+  catch (const SolverControl::NoConvergence &)
+    {
+      // an inexact Newton method can continue with an inaccurate step, the
+      // nonlinear solver decides whether the step is acceptable
+    }
+
+  const unsigned int n_iterations = solver_control.last_step();
+  n_total_linear_iterations += n_iterations;
+
+  if (n_iterations_after_setup == numbers::invalid_unsigned_int)
+    n_iterations_after_setup = n_iterations;
+  else if (n_iterations > additional_data.rebuild_iteration_factor *
+                            std::max(n_iterations_after_setup, 1U))
+    rebuild_preconditioner = true;
+
+  last_residual_norm        = residual_norm;
+  last_linear_residual_norm = solver_control.last_value();
+  last_forcing_term         = forcing_term;
+}
+
+
+
+template <typename VectorType>
+void
+JacobianFreeNewtonKrylov<VectorType>::vmult(VectorType       &dst,
+                                            const VectorType &src) const
+{
+  if (additional_data.linearization == Linearization::analytic)
+    {
+      apply_linearization(src, dst);
+      return;
+    }
+
+  const double src_norm = src.l2_norm();
+  if (src_norm == 0.)
+    {
+      dst = 0.;
+      return;
+    }
+
+  const double step = additional_data.finite_difference_epsilon *
+                      std::sqrt(1. + linearization_point_norm) / src_norm;
+
+  perturbed_point = linearization_point;
+  perturbed_point.add(step, src);
+  residual(perturbed_point, dst);
+  dst.sadd(1. / step, -1. / step, residual_at_linearization_point);
+}
+
+
+
+template <typename VectorType>
+inline unsigned int
+JacobianFreeNewtonKrylov<VectorType>::n_linear_iterations() const
+{
+  return n_total_linear_iterations;
+}
+
+
+
+template <typename VectorType>
+inline unsigned int
+JacobianFreeNewtonKrylov<VectorType>::n_preconditioner_setups() const
+{
+  return n_total_preconditioner_setups;
+}
+
+
+
+template <typename VectorType>
+JacobianFreeNewtonKrylov<VectorType>::Preconditioner::Preconditioner(
+  const JacobianFreeNewtonKrylov &solver)
+  : solver(solver)
+{}
+
+
+
+template <typename VectorType>
+void
+JacobianFreeNewtonKrylov<VectorType>::Preconditioner::vmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  solver.apply_preconditioner(src, dst);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -12,6 +12,9 @@
 //
 // ------------------------------------------------------------------------
 
+#ifndef dealii_nonlinear_h
+#define dealii_nonlinear_h
+
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/exceptions.h>
@@ -69,7 +72,11 @@ DEAL_II_NAMESPACE_OPEN
  *
  * // Calling the @p solve function with an initial guess.
  * nonlinear_solver.solve(current_solution);
- * @endcode
+ * @endcode *
+ * For operators evaluated without a matrix, e.g. with MatrixFree, the
+ * functions setup_jacobian() and solve_with_jacobian() can be provided by
+ * the JacobianFreeNewtonKrylov class, which solves the linear systems with
+ * a finite difference or analytic linearization of the residual, see there.
  */
 template <typename VectorType = Vector<double>>
 class NonlinearSolverSelector
@@ -710,3 +717,5 @@ NonlinearSolverSelector<VectorType>::solve(
 }
 
 DEAL_II_NAMESPACE_CLOSE
+
+#endif
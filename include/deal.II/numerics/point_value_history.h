@@ -19,6 +19,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi_remote_point_evaluation.h>
 #include <deal.II/base/observer_pointer.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/quadrature_lib.h>
@@ -114,11 +115,17 @@ namespace internal
  * point will most likely change slightly, making the interpretation of the
  * data difficult, hence this is not implemented currently.)
  *
- * <li> Secondly, @p evaluate_field_at_requested_location calls @p
- * VectorTools::point_value to compute values at the specific point requested.
- * This method is valid for any FE that is supported by @p
+ * <li> Secondly, @p evaluate_field_at_requested_location computes values at
+ * the specific point requested, in the same way as @p
+ * VectorTools::point_value. The cells around the requested points and the
+ * values of the shape functions in these points are determined on the first
+ * call and re-used for all further calls until the triangulation changes, so
+ * that each evaluation only needs to gather the degrees of freedom of one cell
+ * per point. This method is valid for any FE that is supported by @p
  * VectorTools::point_value. Specifically, this method can be called by codes
- * using adaptive mesh refinement.
+ * using adaptive mesh refinement. A variant of this function taking a
+ * Utilities::MPI::RemotePointEvaluation object also works on distributed
+ * triangulations, where the points can be located on any process.
  *
  * <li>Finally, the class offers a function @p evaluate_field that takes a @p
  * DataPostprocessor object. This method allows the deal.II data postprocessor
@@ -377,19 +384,52 @@ public:
    * Extract values at the points actually requested from the VectorType
    * supplied and add them to the new dataset in vector_name. Unlike the other
    * evaluate_field methods this method does not care if the dof_handler has
-   * been modified because it uses calls to @p VectorTools::point_value to
-   * extract there data. Therefore, if only this method is used, the class is
+   * been modified because it evaluates the finite element field at the
+   * requested points in the same way as @p VectorTools::point_value does,
+   * locating the points again after each change of the triangulation.
+   * Therefore, if only this method is used, the class is
    * fully compatible with adaptive refinement. The component_mask supplied
    * when the field was added is used to select components to extract. If a @p
    * DoFHandler is used, one (and only one) evaluate_field method must be
    * called for each dataset (time step, iteration, etc) for each vector_name,
    * otherwise a @p ExcDataLostSync error can occur.
+   *
+   * The cells in which the points are located and the values of the shape
+   * functions in these points are computed on the first call of this
+   * function and kept until the triangulation changes. All points must be
+   * located in locally owned cells.
    */
   template <typename VectorType>
   void
   evaluate_field_at_requested_location(const std::string &name,
                                        const VectorType  &solution);
 
+  /**
+   * Same as the function above, but for points that may be located in cells
+   * owned by any process of a distributed triangulation. The evaluation is
+   * done on the processes owning the respective cells, and the results are
+   * communicated to the processes that requested them via
+   * @p remote_point_evaluation. If this object has not been set up yet, or if
+   * it has been invalidated by a change of the triangulation, it is
+   * initialized with the requested locations of all points (in the order
+   * they were added) and the default linear mapping of the triangulation.
+   * Alternatively, the object can be set up beforehand with the same points
+   * and a different mapping. The values of the shape functions in the points
+   * located on the current process are cached between calls.
+   *
+   * The vector @p solution needs to provide access to all degrees of freedom
+   * of the locally owned cells, i.e., it must have its ghost values updated.
+   *
+   * @warning This is a collective call that needs to be executed by all
+   *   processes in the communicator of the triangulation.
+   */
+  template <typename VectorType>
+  void
+  evaluate_field_at_requested_location(
+    const std::string                          &name,
+    const VectorType                           &solution,
+    Utilities::MPI::RemotePointEvaluation<dim> &remote_point_evaluation);
+
 
   /**
    * Add the key for the current dataset to the dataset. Although calling this
@@ -619,6 +659,41 @@ private:
     point_geometry_data;
 
 
+  /**
+   * Cell around a requested location and the reference coordinates of the
+   * location in it, together with the values of all shape functions of the
+   * element @p fe on that cell at the location, stored as
+   * `shape_values[i * n_components + c]` for shape function `i` and vector
+   * component `c`.
+   */
+  struct RequestedLocationData
+  {
+    typename DoFHandler<dim>::active_cell_iterator cell;
+    Point<dim>                                     unit_point;
+    const FiniteElement<dim>                      *fe;
+    std::vector<double>                            shape_values;
+  };
+
+  /**
+   * Cached cells and shape function values for the requested locations,
+   * filled by update_requested_location_data() and cleared when the
+   * triangulation changes.
+   */
+  std::vector<RequestedLocationData> requested_location_data;
+
+  /**
+   * Cells and reference points handled on the current process by the
+   * RemotePointEvaluation object most recently passed to
+   * evaluate_field_at_requested_location(), together with the values of the
+   * shape functions in these points. The values for the j-th reference
+   * point start at `remote_shape_values[remote_shape_value_ptrs[j]]` and are
+   * laid out as in RequestedLocationData.
+   */
+  std::vector<std::pair<int, int>> remote_cells;
+  std::vector<Point<dim>>          remote_unit_points;
+  std::vector<unsigned int>        remote_shape_value_ptrs;
+  std::vector<double>              remote_shape_values;
+
   /**
    * Used to enforce @p closed state for some methods.
    */
@@ -670,6 +745,14 @@ private:
    */
   void
   tria_change_listener();
+
+  /**
+   * Locate the cells around the requested locations and compute the values
+   * of the shape functions in these points, unless this has already been
+   * done for the current triangulation.
+   */
+  void
+  update_requested_location_data();
 };
 
 
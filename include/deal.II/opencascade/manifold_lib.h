@@ -20,6 +20,8 @@
 
 #ifdef DEAL_II_WITH_OPENCASCADE
 
+#  include <deal.II/base/table.h>
+
 #  include <deal.II/grid/manifold.h>
 
 #  include <deal.II/opencascade/utilities.h>
@@ -33,6 +35,8 @@
 #  include <BRepAdaptor_Curve.hxx>
 #  undef HAVE_CONFIG_H
 
+#  include <memory>
+
 DEAL_II_NAMESPACE_OPEN
 
 /**
@@ -95,6 +99,16 @@ namespace OpenCASCADE
       const ArrayView<const Point<spacedim>> &surrounding_points,
       const Point<spacedim>                  &candidate) const override;
 
+    /**
+     * Compute a new set of points as in FlatManifold::get_new_points() and
+     * project them onto the shape. The projections of the individual points
+     * are independent of each other and are computed in parallel.
+     */
+    virtual void
+    get_new_points(const ArrayView<const Point<spacedim>> &surrounding_points,
+                   const Table<2, double>                 &weights,
+                   ArrayView<Point<spacedim>> new_points) const override;
+
 
   protected:
     /**
@@ -109,6 +123,13 @@ namespace OpenCASCADE
      * Relative tolerance used by this class to compute distances.
      */
     const double tolerance;
+
+    /**
+     * The object used for the projections onto the shape, which keeps the
+     * decomposition of the shape and the OpenCASCADE projection objects
+     * between calls.
+     */
+    std::shared_ptr<const ShapeProjector> projector;
   };
 
   /**
@@ -162,6 +183,16 @@ namespace OpenCASCADE
       const ArrayView<const Point<spacedim>> &surrounding_points,
       const Point<spacedim>                  &candidate) const override;
 
+    /**
+     * Compute a new set of points as in FlatManifold::get_new_points() and
+     * project them onto the shape. The projections of the individual points
+     * are independent of each other and are computed in parallel.
+     */
+    virtual void
+    get_new_points(const ArrayView<const Point<spacedim>> &surrounding_points,
+                   const Table<2, double>                 &weights,
+                   ArrayView<Point<spacedim>> new_points) const override;
+
   protected:
     /**
      * The topological shape which is used internally to project points. You
@@ -180,6 +211,13 @@ namespace OpenCASCADE
      * Relative tolerance used by this class to compute distances.
      */
     const double tolerance;
+
+    /**
+     * The object used for the projections onto the shape, which keeps the
+     * decomposition of the shape and the OpenCASCADE projection objects
+     * between calls.
+     */
+    std::shared_ptr<const ShapeProjector> projector;
   };
 
 
@@ -254,6 +292,16 @@ namespace OpenCASCADE
       const ArrayView<const Point<spacedim>> &surrounding_points,
       const Point<spacedim>                  &candidate) const override;
 
+    /**
+     * Compute a new set of points as in FlatManifold::get_new_points() and
+     * project them onto the shape. The projections of the individual points
+     * are independent of each other and are computed in parallel.
+     */
+    virtual void
+    get_new_points(const ArrayView<const Point<spacedim>> &surrounding_points,
+                   const Table<2, double>                 &weights,
+                   ArrayView<Point<spacedim>> new_points) const override;
+
   protected:
     /**
      * The topological shape which is used internally to project points. You
@@ -267,6 +315,13 @@ namespace OpenCASCADE
      * Relative tolerance used by this class to compute distances.
      */
     const double tolerance;
+
+    /**
+     * The object used for the projections onto the shape, which keeps the
+     * decomposition of the shape and the OpenCASCADE projection objects
+     * between calls.
+     */
+    std::shared_ptr<const ShapeProjector> projector;
   };
 
   /**
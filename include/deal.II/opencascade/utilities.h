@@ -21,16 +21,24 @@
 #ifdef DEAL_II_WITH_OPENCASCADE
 
 #  include <deal.II/base/point.h>
+#  include <deal.II/base/thread_local_storage.h>
 
 #  include <deal.II/fe/mapping_q1.h>
 
 #  include <deal.II/grid/tria.h>
 
+#  include <array>
+#  include <memory>
 #  include <string>
+#  include <vector>
 
 // opencascade needs "HAVE_CONFIG_H" to be exported...
 #  define HAVE_CONFIG_H
+#  include <Geom_Curve.hxx>
+#  include <Geom_Surface.hxx>
 #  include <IFSelect_ReturnStatus.hxx>
+#  include <IntCurvesFace_ShapeIntersector.hxx>
+#  include <ShapeAnalysis_Surface.hxx>
 #  include <TopoDS_CompSolid.hxx>
 #  include <TopoDS_Compound.hxx>
 #  include <TopoDS_Edge.hxx>
@@ -426,6 +434,136 @@ namespace OpenCASCADE
                 const double          tolerance = 1e-10);
 
 
+  /**
+   * A class for repeated projections of points onto the same TopoDS_Shape,
+   * as needed by the projection manifolds of this namespace during mesh
+   * refinement. The functions closest_point() and line_intersection() of this
+   * namespace set up all OpenCASCADE projection and intersection objects
+   * anew in every call, and test every face of the shape. This class instead
+   * does the following:
+   * - The faces and edges of the shape, their underlying surfaces and
+   *   curves, and their bounding boxes are extracted once upon construction.
+   * - Faces and edges are tested in the order of the distance of their
+   *   bounding boxes to the point. The search stops at the first box that
+   *   is farther away than the closest point found so far.
+   * - The ShapeAnalysis_Surface objects for the faces are kept between
+   *   calls. They store a sampling of the parameter space of each surface,
+   *   which provides the initial guesses for the projection.
+   * - The IntCurvesFace_ShapeIntersector, which classifies the faces of the
+   *   shape, is loaded only once.
+   *
+   * Since the OpenCASCADE projection and intersection objects are not
+   * thread-safe, they are kept separately for each thread. All member
+   * functions can therefore be called concurrently.
+   *
+   * In contrast to closest_point(), which projects onto the untrimmed
+   * surfaces underlying the faces, faces whose bounding box is farther away
+   * than the closest point found so far are skipped. The result can
+   * therefore differ if the closest point lies on the extension of a
+   * surface beyond the boundary of its face.
+   */
+  class ShapeProjector
+  {
+  public:
+    /**
+     * Constructor. The @p tolerance is used as in the function
+     * closest_point().
+     */
+    ShapeProjector(const TopoDS_Shape &shape, const double tolerance = 1e-7);
+
+    /**
+     * Same as the function OpenCASCADE::project_point_and_pull_back().
+     */
+    template <int spacedim>
+    std::tuple<Point<spacedim>, TopoDS_Shape, double, double>
+    project_point_and_pull_back(const Point<spacedim> &origin) const;
+
+    /**
+     * Same as the function OpenCASCADE::closest_point().
+     */
+    template <int spacedim>
+    Point<spacedim>
+    closest_point(const Point<spacedim> &origin) const;
+
+    /**
+     * Same as the function OpenCASCADE::line_intersection().
+     */
+    template <int spacedim>
+    Point<spacedim>
+    line_intersection(const Point<spacedim>     &origin,
+                      const Tensor<1, spacedim> &direction) const;
+
+  private:
+    /**
+     * A face of the shape together with its underlying surface and its
+     * bounding box, stored as minimum and maximum coordinates.
+     */
+    struct FaceData
+    {
+      TopoDS_Face           face;
+      Handle(Geom_Surface)  surface;
+      std::array<double, 6> box;
+    };
+
+    /**
+     * A non-degenerate edge of the shape together with its underlying
+     * curve and its bounding box.
+     */
+    struct EdgeData
+    {
+      TopoDS_Edge           edge;
+      Handle(Geom_Curve)    curve;
+      std::array<double, 6> box;
+    };
+
+    /**
+     * Return the indices of the objects with the given bounding boxes,
+     * sorted by the distance of the boxes to @p p, together with these
+     * distances.
+     */
+    template <typename ObjectType>
+    static std::vector<std::pair<double, unsigned int>>
+    sort_by_box_distance(const std::vector<ObjectType> &objects,
+                         const gp_Pnt                  &p);
+
+    /**
+     * The shape.
+     */
+    const TopoDS_Shape shape;
+
+    /**
+     * Tolerance used for the projections.
+     */
+    const double tolerance;
+
+    /**
+     * The faces of the shape.
+     */
+    std::vector<FaceData> faces;
+
+    /**
+     * The edges of the shape. Like in project_point_and_pull_back(), they
+     * are only used if the shape does not contain any faces.
+     */
+    std::vector<EdgeData> edges;
+
+    /**
+     * The projection objects of the faces for each thread, created on first
+     * use.
+     */
+    mutable Threads::ThreadLocalStorage<
+      std::vector<Handle(ShapeAnalysis_Surface)>>
+      surface_projectors;
+
+    /**
+     * The intersection object for each thread, created on first use.
+     */
+    mutable Threads::ThreadLocalStorage<
+      std::shared_ptr<IntCurvesFace_ShapeIntersector>>
+      intersectors;
+  };
+
+
   /**
    * Exception thrown when the point specified as argument does not lie
    * between @p tolerance from the given TopoDS_Shape.
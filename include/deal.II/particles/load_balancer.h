@@ -0,0 +1,200 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_particles_load_balancer_h
+#define dealii_particles_load_balancer_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/observer_pointer.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <boost/signals2/connection.hpp>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  /**
+   * A class that balances the work of a particle simulation between the
+   * processes of a parallel::distributed::Triangulation.
+   *
+   * The work associated with a cell is modeled as a constant weight for the
+   * cell itself plus a weight per particle in the cell. An object of this
+   * class connects a function computing these weights to the
+   * Triangulation::Signals::weight signal of the triangulation, so that the
+   * weights are taken into account in every repartitioning of the mesh,
+   * including the one during
+   * parallel::distributed::Triangulation::execute_coarsening_and_refinement().
+   * Since the particles move between cells, a mesh that was balanced at one
+   * point in time becomes imbalanced over time. The function
+   * repartition_if_needed() therefore measures the imbalance of the current
+   * partitioning, which only requires a single reduction over all
+   * processes, and repartitions the mesh and transfers the particles if the
+   * imbalance exceeds a given threshold. A typical time loop then reads:
+   * @code
+   * Particles::LoadBalancer<dim> balancer(triangulation, particle_handler);
+   * for (...)
+   *   {
+   *     // move particles
+   *     ...
+   *     particle_handler.sort_particles_into_subdomains_and_cells();
+   *     balancer.repartition_if_needed();
+   *   }
+   * @endcode
+   *
+   * This is the approach of step-68, where the weight function and the
+   * calls to repartition the triangulation are written by hand.
+   *
+   * @note Since the weight function is summed with all other functions
+   * connected to Triangulation::Signals::weight, the weights need to be
+   * chosen relative to the weights returned by other connected functions,
+   * e.g., those of a parallel::CellWeights object.
+   *
+   * @ingroup distributed
+   */
+  template <int dim, int spacedim = dim>
+  class LoadBalancer
+  {
+  public:
+    /**
+     * Collects the options of this class.
+     */
+    struct AdditionalData
+    {
+      /**
+       * Constructor which sets the default arguments.
+       */
+      AdditionalData(const unsigned int cell_weight         = 1,
+                     const unsigned int particle_weight     = 10,
+                     const double       imbalance_threshold = 1.2)
+        : cell_weight(cell_weight)
+        , particle_weight(particle_weight)
+        , imbalance_threshold(imbalance_threshold)
+      {}
+
+      /**
+       * The weight of every cell, independent of the particles in it.
+       */
+      unsigned int cell_weight;
+
+      /**
+       * The weight of every particle, which is multiplied by the number of
+       * particles in a cell and added to @p cell_weight.
+       */
+      unsigned int particle_weight;
+
+      /**
+       * The ratio between the maximal and the average work of all processes
+       * above which repartition_if_needed() repartitions the mesh.
+       */
+      double imbalance_threshold;
+    };
+
+    /**
+     * Constructor. Connects the weight function to the signal of
+     * @p triangulation, which needs to be the triangulation of
+     * @p particle_handler. Both objects need to live at least as long as
+     * this object.
+     */
+    LoadBalancer(
+      parallel::distributed::Triangulation<dim, spacedim> &triangulation,
+      ParticleHandler<dim, spacedim>                       &particle_handler,
+      const AdditionalData &additional_data = AdditionalData());
+
+    /**
+     * Destructor. Disconnects the weight function from the signal of the
+     * triangulation.
+     */
+    ~LoadBalancer();
+
+    /**
+     * Return the ratio between the maximal and the average work of all
+     * processes measured with the weights of this class. A value of one
+     * indicates a perfectly balanced partitioning. This function is
+     * collective over the MPI communicator of the triangulation.
+     */
+    double
+    compute_imbalance() const;
+
+    /**
+     * Repartition the mesh with repartition() if compute_imbalance() exceeds
+     * AdditionalData::imbalance_threshold. Returns whether the mesh was
+     * repartitioned. This function is collective over the MPI communicator
+     * of the triangulation.
+     */
+    bool
+    repartition_if_needed();
+
+    /**
+     * Repartition the mesh with the weights of this class and transfer the
+     * particles to their new owners, by calls to
+     * ParticleHandler::prepare_for_coarsening_and_refinement(),
+     * parallel::distributed::Triangulation::repartition(), and
+     * ParticleHandler::unpack_after_coarsening_and_refinement().
+     */
+    void
+    repartition();
+
+    /**
+     * Return the number of times the mesh has been repartitioned by this
+     * object.
+     */
+    unsigned int
+    n_repartitions() const;
+
+    /**
+     * Return the weight of @p cell with the CellStatus @p status, which is
+     * the function connected to Triangulation::Signals::weight.
+     */
+    unsigned int
+    cell_weight(
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+      const CellStatus                                            status) const;
+
+  private:
+    /**
+     * The triangulation to be repartitioned.
+     */
+    ObserverPointer<parallel::distributed::Triangulation<dim, spacedim>>
+      triangulation;
+
+    /**
+     * The particles whose cells are weighted.
+     */
+    ObserverPointer<ParticleHandler<dim, spacedim>> particle_handler;
+
+    /**
+     * The options given to the constructor.
+     */
+    const AdditionalData additional_data;
+
+    /**
+     * The number of calls to repartition().
+     */
+    unsigned int repartition_counter;
+
+    /**
+     * The connection to the weight signal of the triangulation.
+     */
+    boost::signals2::connection weight_connection;
+  };
+} // namespace Particles
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,325 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_particles_neighbor_list_h
+#define dealii_particles_neighbor_list_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/point.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  /**
+   * A list of the neighbors of all locally owned particles of a
+   * ParticleHandler, i.e., of all particles within a given cutoff radius,
+   * as needed for particle-particle interactions in discrete element or
+   * smoothed particle hydrodynamics methods.
+   *
+   * The neighbors are found with a cell list: The particles are sorted into
+   * the bins of a uniform Cartesian grid whose bin size is at least the
+   * search radius, such that all neighbors of a particle are located in its
+   * own bin or in the bins sharing at least a vertex with it. The search is
+   * independent of the cells of the triangulation, which is advantageous
+   * for meshes whose cells are much larger or smaller than the cutoff
+   * radius, and it works on a contiguous copy of the particle locations
+   * sorted by bin. The sorting is linear in the number of particles, and the
+   * search over the locally owned particles runs in parallel with the
+   * functions in the parallel namespace.
+   *
+   * To avoid a new search in every time step, the list is a Verlet list:
+   * it contains all particles within the cutoff radius plus a skin
+   * distance, see AdditionalData. As long as no particle has moved by more
+   * than half the skin distance since the list was built, every pair of
+   * particles closer than the cutoff radius is still contained in the list,
+   * and a rebuild is only needed once needs_rebuild() returns true. A
+   * typical time loop then reads:
+   * @code
+   * Particles::NeighborList<dim> neighbor_list;
+   * neighbor_list.reinit(particle_handler,
+   *                      Particles::NeighborList<dim>::AdditionalData(
+   *                        cutoff_radius, skin));
+   * for (...)
+   *   {
+   *     if (neighbor_list.update())
+   *       ...; // the list has been rebuilt
+   *
+   *     for (unsigned int i = 0;
+   *          i < neighbor_list.n_locally_owned_particles();
+   *          ++i)
+   *       {
+   *         const auto &particle = neighbor_list.get_particle(i);
+   *         for (const unsigned int j : neighbor_list.get_neighbors(i))
+   *           if (particle->get_location().distance(
+   *                 neighbor_list.get_particle(j)->get_location()) <
+   *               cutoff_radius)
+   *             ...; // compute the interaction
+   *       }
+   *
+   *     // move the particles and update the ghost particles
+   *     ...
+   *   }
+   * @endcode
+   *
+   * The particles are identified by an index, where the locally owned
+   * particles are numbered from zero to n_locally_owned_particles() in the
+   * order of iteration through the ParticleHandler, followed by the ghost
+   * particles if AdditionalData::include_ghost_particles is set. The list is
+   * symmetric, i.e., each pair of locally owned particles appears in the
+   * neighbor lists of both particles, such that interactions can be
+   * accumulated for each particle independently, e.g., in parallel.
+   *
+   * The list stores iterators to the particles and is therefore only valid
+   * as long as these are. Moving particles with
+   * ParticleAccessor::set_location() and updating the ghost particles with
+   * ParticleHandler::update_ghost_particles() keep the iterators valid,
+   * whereas ParticleHandler::sort_particles_into_subdomains_and_cells(),
+   * ParticleHandler::exchange_ghost_particles() and the insertion or
+   * removal of particles do not, and need to be followed by a call to
+   * reinit().
+   *
+   * @note The decision in update() whether to rebuild the list is made
+   * locally on each process without communication. The displacement of the
+   * ghost particles is measured from their locations as last received by
+   * ParticleHandler::update_ghost_particles().
+   */
+  template <int dim, int spacedim = dim>
+  class NeighborList
+  {
+  public:
+    /**
+     * A type that can be used to iterate over all particles in the domain.
+     */
+    using particle_iterator =
+      typename ParticleHandler<dim, spacedim>::particle_iterator;
+
+    /**
+     * Collects the options of this class.
+     */
+    struct AdditionalData
+    {
+      /**
+       * Constructor which sets the default arguments.
+       */
+      AdditionalData(const double cutoff_radius           = 0.,
+                     const double skin                    = 0.,
+                     const bool   include_ghost_particles = true)
+        : cutoff_radius(cutoff_radius)
+        , skin(skin)
+        , include_ghost_particles(include_ghost_particles)
+      {}
+
+      /**
+       * The radius within which two particles interact.
+       */
+      double cutoff_radius;
+
+      /**
+       * The additional distance by which the search radius exceeds the
+       * cutoff radius. A larger skin reduces the number of rebuilds of
+       * the list at the cost of longer lists.
+       */
+      double skin;
+
+      /**
+       * Whether the ghost particles are searched as neighbors of the
+       * locally owned particles.
+       */
+      bool include_ghost_particles;
+    };
+
+    /**
+     * Constructor. Creates an empty list, to be filled by reinit().
+     */
+    NeighborList();
+
+    /**
+     * Build the neighbor list of the particles of @p particle_handler with
+     * the options @p additional_data. The particle handler needs to live at
+     * least as long as this object.
+     */
+    void
+    reinit(const ParticleHandler<dim, spacedim> &particle_handler,
+           const AdditionalData                 &additional_data);
+
+    /**
+     * Return whether the list needs to be rebuilt because a particle has
+     * moved by more than half the skin distance since the last build, or
+     * because the number of locally owned particles has changed.
+     */
+    bool
+    needs_rebuild() const;
+
+    /**
+     * Rebuild the list if needs_rebuild() returns true. Returns whether the
+     * list has been rebuilt.
+     */
+    bool
+    update();
+
+    /**
+     * Return the number of locally owned particles, whose neighbors are
+     * stored.
+     */
+    unsigned int
+    n_locally_owned_particles() const;
+
+    /**
+     * Return the number of all particles in the list, i.e., the locally
+     * owned and the ghost particles.
+     */
+    unsigned int
+    n_particles() const;
+
+    /**
+     * Return the number of neighbor pairs stored in this object.
+     */
+    std::size_t
+    n_neighbor_pairs() const;
+
+    /**
+     * Return an iterator to the particle with index @p index, which is less
+     * than n_particles().
+     */
+    const particle_iterator &
+    get_particle(const unsigned int index) const;
+
+    /**
+     * Return the indices of all particles within the cutoff radius plus the
+     * skin distance from the locally owned particle @p index at the time
+     * the list was built. The particle itself is not contained in the list.
+     */
+    ArrayView<const unsigned int>
+    get_neighbors(const unsigned int index) const;
+
+    /**
+     * Return an estimate for the memory consumption, in bytes, of this
+     * object.
+     */
+    std::size_t
+    memory_consumption() const;
+
+  private:
+    /**
+     * Fill the list for the current locations of the particles.
+     */
+    void
+    build();
+
+    /**
+     * The particle handler whose particles are searched.
+     */
+    ObserverPointer<const ParticleHandler<dim, spacedim>> particle_handler;
+
+    /**
+     * The options given to reinit().
+     */
+    AdditionalData additional_data;
+
+    /**
+     * The number of locally owned particles at the time of the last build.
+     */
+    unsigned int n_owned_particles;
+
+    /**
+     * Iterators to all particles in the list, with the locally owned
+     * particles first.
+     */
+    std::vector<particle_iterator> particles;
+
+    /**
+     * The locations of the particles at the time of the last build, used
+     * to measure the displacement in needs_rebuild().
+     */
+    std::vector<Point<spacedim>> build_locations;
+
+    /**
+     * The start of the neighbors of each locally owned particle in
+     * @p neighbor_indices, with one additional entry for the end of the
+     * last particle.
+     */
+    std::vector<std::size_t> neighbor_pointers;
+
+    /**
+     * The indices of the neighbors of all locally owned particles.
+     */
+    std::vector<unsigned int> neighbor_indices;
+  };
+
+
+
+#ifndef DOXYGEN
+
+  template <int dim, int spacedim>
+  inline unsigned int
+  NeighborList<dim, spacedim>::n_locally_owned_particles() const
+  {
+    return n_owned_particles;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline unsigned int
+  NeighborList<dim, spacedim>::n_particles() const
+  {
+    return particles.size();
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline std::size_t
+  NeighborList<dim, spacedim>::n_neighbor_pairs() const
+  {
+    return neighbor_indices.size();
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline const typename NeighborList<dim, spacedim>::particle_iterator &
+  NeighborList<dim, spacedim>::get_particle(const unsigned int index) const
+  {
+    AssertIndexRange(index, particles.size());
+    return particles[index];
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline ArrayView<const unsigned int>
+  NeighborList<dim, spacedim>::get_neighbors(const unsigned int index) const
+  {
+    AssertIndexRange(index, n_owned_particles);
+    return make_array_view(neighbor_indices.data() + neighbor_pointers[index],
+                           neighbor_indices.data() +
+                             neighbor_pointers[index + 1]);
+  }
+
+#endif // DOXYGEN
+
+} // namespace Particles
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -350,6 +350,24 @@ namespace Particles
     ArrayView<const double>
     get_properties() const;
 
+    /**
+     * Get read- and write-access to the components of the compact property
+     * field @p field of this particle, see CompactPropertyField. The type
+     * @p T must correspond to the type of the field, e.g., @p float for
+     * CompactPropertyType::float32.
+     */
+    template <typename T>
+    ArrayView<T>
+    get_compact_properties(const unsigned int field);
+
+    /**
+     * Get read-access to the components of the compact property field
+     * @p field of this particle.
+     */
+    template <typename T>
+    ArrayView<const T>
+    get_compact_properties(const unsigned int field) const;
+
     /**
      * Return the size in bytes this particle occupies if all of its data is
      * serialized (i.e. the number of bytes that is written by the write_data
@@ -595,7 +613,7 @@ namespace Particles
           particle_properties[i] = *pdata++;
       }
 
-    return static_cast<const void *>(pdata);
+    return property_pool->read_compact_properties(get_handle(), pdata);
   }
 
 
@@ -629,7 +647,7 @@ namespace Particles
           *pdata = particle_properties[i];
       }
 
-    return static_cast<void *>(pdata);
+    return property_pool->write_compact_properties(get_handle(), pdata);
   }
 
 
@@ -811,6 +829,34 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  template <typename T>
+  inline ArrayView<T>
+  ParticleAccessor<dim, spacedim>::get_compact_properties(
+    const unsigned int field)
+  {
+    Assert(state() == IteratorState::valid, ExcInternalError());
+
+    return property_pool->template get_compact_properties<T>(get_handle(),
+                                                             field);
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename T>
+  inline ArrayView<const T>
+  ParticleAccessor<dim, spacedim>::get_compact_properties(
+    const unsigned int field) const
+  {
+    Assert(state() == IteratorState::valid, ExcInternalError());
+
+    return static_cast<const PropertyPool<dim, spacedim> &>(*property_pool)
+      .template get_compact_properties<T>(get_handle(), field);
+  }
+
+
+
   template <int dim, int spacedim>
   inline const typename Triangulation<dim, spacedim>::cell_iterator &
   ParticleAccessor<dim, spacedim>::get_surrounding_cell() const
@@ -844,6 +890,7 @@ namespace Particles
       {
         size += sizeof(double) * get_properties().size();
       }
+    size += property_pool->serialized_compact_size_in_bytes();
     return size;
   }
 
@@ -78,6 +78,35 @@ namespace Particles
     using particle_container =
       typename ParticleAccessor<dim, spacedim>::particle_container;
 
+    /**
+     * Views into the data of all particles in one cell, as returned by
+     * get_particle_data_in_cell(). All views have one entry per particle,
+     * except for @p properties, which holds the n_properties_per_particle()
+     * properties of each particle next to each other.
+     */
+    struct ParticleDataInCell
+    {
+      /**
+       * The locations of the particles.
+       */
+      ArrayView<Point<spacedim>> locations;
+
+      /**
+       * The reference locations of the particles.
+       */
+      ArrayView<Point<dim>> reference_locations;
+
+      /**
+       * The ID numbers of the particles.
+       */
+      ArrayView<const types::particle_index> ids;
+
+      /**
+       * The properties of the particles.
+       */
+      ArrayView<double> properties;
+    };
+
     /**
      * Default constructor.
      */
@@ -91,9 +120,11 @@ namespace Particles
      * This constructor is equivalent to calling the default constructor and
      * the initialize function.
      */
-    ParticleHandler(const Triangulation<dim, spacedim> &tria,
-                    const Mapping<dim, spacedim>       &mapping,
-                    const unsigned int                  n_properties = 0);
+    ParticleHandler(
+      const Triangulation<dim, spacedim>      &tria,
+      const Mapping<dim, spacedim>            &mapping,
+      const unsigned int                       n_properties = 0,
+      const std::vector<CompactPropertyField> &compact_property_fields = {});
 
     /**
      * Destructor.
@@ -104,11 +135,19 @@ namespace Particles
      * Initialize the particle handler. This function clears the
      * internal data structures, and sets the triangulation and the
      * mapping to be used.
+     *
+     * Each particle stores @p n_properties properties of type @p double,
+     * plus the fields of compact properties, e.g., of type @p float or
+     * @p int32, given by @p compact_property_fields. The latter are accessed
+     * through ParticleAccessor::get_compact_properties() and are transferred
+     * and serialized in their own type, see PropertyPool.
      */
     void
-    initialize(const Triangulation<dim, spacedim> &tria,
-               const Mapping<dim, spacedim>       &mapping,
-               const unsigned int                  n_properties = 0);
+    initialize(
+      const Triangulation<dim, spacedim>      &tria,
+      const Mapping<dim, spacedim>            &mapping,
+      const unsigned int                       n_properties = 0,
+      const std::vector<CompactPropertyField> &compact_property_fields = {});
 
     /**
      * Copy the state of particle handler @p particle_handler into the
@@ -256,6 +295,23 @@ namespace Particles
       const typename Triangulation<dim, spacedim>::active_cell_iterator &cell)
       const;
 
+    /**
+     * Return views into the storage of the PropertyPool for the data of all
+     * particles in the given cell, in the order of particles_in_cell(). In
+     * contrast to iterating over the particles, this gives direct access to
+     * contiguous arrays, which allows to process the particles of a cell in
+     * loops the compiler can vectorize.
+     *
+     * This function requires that the data of the particles in the cell is
+     * stored contiguously, which is the case after calls to
+     * sort_particles_into_subdomains_and_cells() and sort_particle_data()
+     * until particles are inserted, removed, or exchanged with other
+     * processes.
+     */
+    ParticleDataInCell
+    get_particle_data_in_cell(
+      const typename Triangulation<dim, spacedim>::active_cell_iterator &cell);
+
     /**
      * Remove a particle pointed to by the iterator. Note that @p particle
      * and all iterators that point to other particles in the same cell
@@ -714,6 +770,22 @@ namespace Particles
     void
     sort_particles_into_subdomains_and_cells();
 
+    /**
+     * Reorder the data of all particles stored in the PropertyPool such that
+     * it is laid out in the order of iteration over the particles, i.e., the
+     * data of the particles in one cell is contiguous and the cells follow
+     * each other in the order of the particle iterators. The handles of the
+     * particles are renumbered accordingly, so iterators to particles remain
+     * valid. Afterwards, get_particle_data_in_cell() can be used.
+     *
+     * This function is called at the end of
+     * sort_particles_into_subdomains_and_cells(). It can be called
+     * explicitly after inserting or removing particles, or after
+     * exchange_ghost_particles(), to restore a contiguous layout.
+     */
+    void
+    sort_particle_data();
+
     /**
      * Exchange all particles that live in cells that are ghost cells to
      * other processes. Clears and re-populates the ghost_neighbors
@@ -732,6 +804,31 @@ namespace Particles
     void
     update_ghost_particles();
 
+    /**
+     * Start the update of the ghost particles done by
+     * update_ghost_particles() with non-blocking communication. This
+     * function writes the locations and properties of the locally owned
+     * particles that are ghosts on other processes into a buffer and starts
+     * sending it, but does not wait for the transfer to finish. This allows
+     * to do other work, e.g., to compute interactions between locally owned
+     * particles, while the data is in flight.
+     *
+     * The function must be followed by a call to
+     * update_ghost_particles_finish(), and the data of the ghost particles
+     * is only valid after that call. Since the data is copied into the
+     * buffer here, the locally owned particles may be modified in between,
+     * but particles must not be inserted, removed, or sorted into cells.
+     */
+    void
+    update_ghost_particles_start();
+
+    /**
+     * Wait for the communication started by update_ghost_particles_start()
+     * to finish and write the received data into the ghost particles.
+     */
+    void
+    update_ghost_particles_finish();
+
     /**
      * This function prepares the particle handler for a coarsening and
      * refinement cycle, by storing the necessary information to transfer
@@ -1061,6 +1158,24 @@ namespace Particles
       const std::map<types::subdomain_id, std::vector<particle_iterator>>
         &particles_to_send);
 
+    /**
+     * The first part of send_recv_particles_properties_and_location(),
+     * which fills the send buffer and starts the non-blocking
+     * communication.
+     */
+    void
+    send_recv_particles_properties_and_location_start(
+      const std::map<types::subdomain_id, std::vector<particle_iterator>>
+        &particles_to_send);
+
+    /**
+     * The second part of send_recv_particles_properties_and_location(),
+     * which waits for the communication to finish and updates the ghost
+     * particles with the received data.
+     */
+    void
+    send_recv_particles_properties_and_location_finish();
+
 #endif
 
     /**
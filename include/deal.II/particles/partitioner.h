@@ -17,6 +17,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mpi_stub.h>
+
 #include <deal.II/particles/particle_iterator.h>
 
 DEAL_II_NAMESPACE_OPEN
@@ -110,6 +112,13 @@ namespace Particles
        * send_recv_particles_properties_and_location()
        */
       std::vector<char> recv_data;
+
+      /**
+       * The MPI requests of an update of the ghost particles started by
+       * ParticleHandler::update_ghost_particles_start() that have not been
+       * completed by ParticleHandler::update_ghost_particles_finish() yet.
+       */
+      std::vector<MPI_Request> requests;
     };
   } // namespace internal
 
@@ -0,0 +1,512 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_particles_portable_particle_data_h
+#define dealii_particles_portable_particle_data_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/tensor.h>
+
+#include <deal.II/grid/grid_tools_geometry.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  /**
+   * A copy of the locally owned particles of a ParticleHandler that lives
+   * in MemorySpace::Default, i.e., on the device if deal.II is configured
+   * with a device-enabled Kokkos. The locations, reference locations and
+   * properties of the particles are stored in Kokkos views, one entry per
+   * particle, which allows particle codes to advance their particles on the
+   * device without keeping a second copy of the particle data around and
+   * synchronizing it with the host in every time step.
+   *
+   * The particles are numbered in the order of iteration through the
+   * ParticleHandler, i.e., cell by cell. This is the same numbering of points
+   * as used by Portable::FEPointEvaluation when its reinit() function is
+   * called with the cells and reference locations of the particles of the
+   * same ParticleHandler, so that a velocity field evaluated there can be
+   * directly passed to advect():
+   * @code
+   * Particles::PortableParticleData<dim> particle_data;
+   * particle_data.reinit(particle_handler);
+   * for (...)
+   *   {
+   *     // evaluate the velocity at the particles on the device, with
+   *     // point_evaluation set up for the particles of particle_handler
+   *     point_evaluation.evaluate(velocity, EvaluationFlags::values, ...);
+   *
+   *     particle_data.advect(velocities, time_step);
+   *     if (particle_data.update_reference_locations() > 0)
+   *       {
+   *         // some particles left their cells: move them on the host
+   *         particle_data.copy_to_particle_handler(particle_handler);
+   *         particle_handler.sort_particles_into_subdomains_and_cells();
+   *         particle_data.reinit(particle_handler);
+   *         ...; // also set up point_evaluation again
+   *       }
+   *   }
+   * @endcode
+   *
+   * The relocation within the cells in update_reference_locations() uses
+   * the affine approximation of each cell given by
+   * GridTools::affine_cell_approximation(), which is exact for Cartesian and
+   * parallelogram cells. Only particles that leave their cell, and in
+   * particular those that move to another process, need to be transferred
+   * back to the ParticleHandler, where they are sorted into their new cells
+   * with the full mapping.
+   *
+   * @tparam dim The dimension of the triangulation, which is also the
+   * dimension of the space the particles live in.
+   *
+   * @tparam Number The number type of the data on the device, @p double or
+   * @p float.
+   */
+  template <int dim, typename Number = double>
+  class PortableParticleData
+  {
+  public:
+    /**
+     * The Kokkos memory space the data of this class lives in.
+     */
+    using memory_space = MemorySpace::Default::kokkos_space;
+
+    /**
+     * View holding one point per particle.
+     */
+    using PointView = Kokkos::View<Number *[dim], memory_space>;
+
+    /**
+     * View holding the properties of each particle.
+     */
+    using PropertyView = Kokkos::View<Number **, memory_space>;
+
+    /**
+     * Copy the data of the locally owned particles of @p particle_handler
+     * to the device, and set up the affine approximation of all cells
+     * containing particles.
+     */
+    void
+    reinit(const ParticleHandler<dim> &particle_handler);
+
+    /**
+     * Copy the locations, reference locations and properties of the
+     * particles back to @p particle_handler, which must contain the same
+     * particles as during the last call to reinit().
+     */
+    void
+    copy_to_particle_handler(ParticleHandler<dim> &particle_handler) const;
+
+    /**
+     * Return the number of particles.
+     */
+    unsigned int
+    n_particles() const;
+
+    /**
+     * Return the cells containing particles, in the order of the particles.
+     */
+    const std::vector<typename Triangulation<dim>::active_cell_iterator> &
+    get_cells() const;
+
+    /**
+     * Return the locations of the particles.
+     */
+    const PointView &
+    get_locations() const;
+
+    /**
+     * Return the reference locations of the particles in their cells.
+     */
+    const PointView &
+    get_reference_locations() const;
+
+    /**
+     * Return the properties of the particles, where entry <code>(p,
+     * i)</code> is the property @p i of particle @p p.
+     */
+    const PropertyView &
+    get_properties() const;
+
+    /**
+     * Return the index into get_cells() of the cell of each particle.
+     */
+    const Kokkos::View<unsigned int *, memory_space> &
+    get_cell_indices() const;
+
+    /**
+     * Return, for each particle, whether it was outside its cell in the
+     * last call to update_reference_locations().
+     */
+    const Kokkos::View<bool *, memory_space> &
+    get_outside_flags() const;
+
+    /**
+     * Move all particles by @p time_step times @p velocities on the device,
+     * where @p velocities holds one vector per particle.
+     */
+    void
+    advect(const PointView &velocities, const Number time_step);
+
+    /**
+     * Compute the reference locations of all particles in their cells from
+     * their current locations on the device, and mark the particles that
+     * are outside their cell by more than @p tolerance in reference
+     * coordinates. Returns the number of these particles.
+     */
+    unsigned int
+    update_reference_locations(const Number tolerance = 1e-10);
+
+  private:
+    /**
+     * The cells containing particles.
+     */
+    std::vector<typename Triangulation<dim>::active_cell_iterator> cells;
+
+    /**
+     * The locations of the particles.
+     */
+    PointView locations;
+
+    /**
+     * The reference locations of the particles.
+     */
+    PointView reference_locations;
+
+    /**
+     * The properties of the particles.
+     */
+    PropertyView properties;
+
+    /**
+     * The index of the cell of each particle.
+     */
+    Kokkos::View<unsigned int *, memory_space> cell_indices;
+
+    /**
+     * Whether a particle was outside its cell.
+     */
+    Kokkos::View<bool *, memory_space> outside_flags;
+
+    /**
+     * The inverse of the matrix <i>A</i> of the affine approximation
+     * $\mathbf x = A \hat{\mathbf x} + \mathbf b$ of each cell.
+     */
+    Kokkos::View<Number *[dim][dim], memory_space> inverse_affine_matrices;
+
+    /**
+     * The vector <i>b</i> of the affine approximation of each cell.
+     */
+    Kokkos::View<Number *[dim], memory_space> affine_shifts;
+  };
+
+
+
+#ifndef DOXYGEN
+
+  template <int dim, typename Number>
+  void
+  PortableParticleData<dim, Number>::reinit(
+    const ParticleHandler<dim> &particle_handler)
+  {
+    const unsigned int n_particles =
+      particle_handler.n_locally_owned_particles();
+    const unsigned int n_properties =
+      particle_handler.n_properties_per_particle();
+
+    cells.clear();
+
+    locations = PointView(Kokkos::view_alloc("particle_locations",
+                                             Kokkos::WithoutInitializing),
+                          n_particles);
+    reference_locations =
+      PointView(Kokkos::view_alloc("particle_reference_locations",
+                                   Kokkos::WithoutInitializing),
+                n_particles);
+    properties = PropertyView(Kokkos::view_alloc("particle_properties",
+                                                 Kokkos::WithoutInitializing),
+                              n_particles,
+                              n_properties);
+    cell_indices = Kokkos::View<unsigned int *, memory_space>(
+      Kokkos::view_alloc("particle_cell_indices", Kokkos::WithoutInitializing),
+      n_particles);
+    outside_flags =
+      Kokkos::View<bool *, memory_space>("particle_outside_flags",
+                                         n_particles);
+
+    auto locations_host           = Kokkos::create_mirror_view(locations);
+    auto reference_locations_host = Kokkos::create_mirror_view(
+      reference_locations);
+    auto properties_host   = Kokkos::create_mirror_view(properties);
+    auto cell_indices_host = Kokkos::create_mirror_view(cell_indices);
+
+    // the particles are sorted by cells, so a new cell starts whenever the
+    // surrounding cell changes
+    unsigned int p = 0;
+    for (auto particle = particle_handler.begin();
+         particle != particle_handler.end();
+         ++particle, ++p)
+      {
+        const auto cell = particle->get_surrounding_cell();
+        if (cells.empty() || cells.back() != cell)
+          cells.push_back(cell);
+        cell_indices_host(p) = cells.size() - 1;
+
+        const Point<dim> &location = particle->get_location();
+        const Point<dim> &reference_location =
+          particle->get_reference_location();
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            locations_host(p, d)           = location[d];
+            reference_locations_host(p, d) = reference_location[d];
+          }
+
+        const ArrayView<const double> particle_properties =
+          particle->get_properties();
+        for (unsigned int i = 0; i < n_properties; ++i)
+          properties_host(p, i) = particle_properties[i];
+      }
+    Assert(p == n_particles, ExcInternalError());
+
+    inverse_affine_matrices = Kokkos::View<Number *[dim][dim], memory_space>(
+      Kokkos::view_alloc("inverse_affine_matrices",
+                         Kokkos::WithoutInitializing),
+      cells.size());
+    affine_shifts = Kokkos::View<Number *[dim], memory_space>(
+      Kokkos::view_alloc("affine_shifts", Kokkos::WithoutInitializing),
+      cells.size());
+    auto inverse_affine_matrices_host =
+      Kokkos::create_mirror_view(inverse_affine_matrices);
+    auto affine_shifts_host = Kokkos::create_mirror_view(affine_shifts);
+
+    std::vector<Point<dim>> vertices;
+    for (unsigned int c = 0; c < cells.size(); ++c)
+      {
+        vertices.clear();
+        for (const unsigned int v : cells[c]->vertex_indices())
+          vertices.push_back(cells[c]->vertex(v));
+
+        const auto affine = GridTools::affine_cell_approximation<dim, dim>(
+          make_array_view(vertices));
+        const Tensor<2, dim> inverse_matrix =
+          invert(Tensor<2, dim>(affine.first));
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            for (unsigned int e = 0; e < dim; ++e)
+              inverse_affine_matrices_host(c, d, e) = inverse_matrix[d][e];
+            affine_shifts_host(c, d) = affine.second[d];
+          }
+      }
+
+    Kokkos::deep_copy(locations, locations_host);
+    Kokkos::deep_copy(reference_locations, reference_locations_host);
+    Kokkos::deep_copy(properties, properties_host);
+    Kokkos::deep_copy(cell_indices, cell_indices_host);
+    Kokkos::deep_copy(inverse_affine_matrices, inverse_affine_matrices_host);
+    Kokkos::deep_copy(affine_shifts, affine_shifts_host);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  PortableParticleData<dim, Number>::copy_to_particle_handler(
+    ParticleHandler<dim> &particle_handler) const
+  {
+    AssertDimension(particle_handler.n_locally_owned_particles(),
+                    n_particles());
+    AssertDimension(particle_handler.n_properties_per_particle(),
+                    properties.extent(1));
+
+    const auto locations_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), locations);
+    const auto reference_locations_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                          reference_locations);
+    const auto properties_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), properties);
+
+    std::vector<double> particle_properties(properties.extent(1));
+    unsigned int        p = 0;
+    for (auto particle = particle_handler.begin();
+         particle != particle_handler.end();
+         ++particle, ++p)
+      {
+        Point<dim> location, reference_location;
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            location[d]           = locations_host(p, d);
+            reference_location[d] = reference_locations_host(p, d);
+          }
+        particle->set_location(location);
+        particle->set_reference_location(reference_location);
+
+        for (unsigned int i = 0; i < particle_properties.size(); ++i)
+          particle_properties[i] = properties_host(p, i);
+        if (particle_properties.size() > 0)
+          particle->set_properties(make_array_view(particle_properties));
+      }
+  }
+
+
+
+  template <int dim, typename Number>
+  inline unsigned int
+  PortableParticleData<dim, Number>::n_particles() const
+  {
+    return locations.extent(0);
+  }
+
+
+
+  template <int dim, typename Number>
+  inline const std::vector<typename Triangulation<dim>::active_cell_iterator> &
+  PortableParticleData<dim, Number>::get_cells() const
+  {
+    return cells;
+  }
+
+
+
+  template <int dim, typename Number>
+  inline const typename PortableParticleData<dim, Number>::PointView &
+  PortableParticleData<dim, Number>::get_locations() const
+  {
+    return locations;
+  }
+
+
+
+  template <int dim, typename Number>
+  inline const typename PortableParticleData<dim, Number>::PointView &
+  PortableParticleData<dim, Number>::get_reference_locations() const
+  {
+    return reference_locations;
+  }
+
+
+
+  template <int dim, typename Number>
+  inline const typename PortableParticleData<dim, Number>::PropertyView &
+  PortableParticleData<dim, Number>::get_properties() const
+  {
+    return properties;
+  }
+
+
+
+  template <int dim, typename Number>
+  inline const Kokkos::View<
+    unsigned int *,
+    typename PortableParticleData<dim, Number>::memory_space> &
+  PortableParticleData<dim, Number>::get_cell_indices() const
+  {
+    return cell_indices;
+  }
+
+
+
+  template <int dim, typename Number>
+  inline const Kokkos::
+    View<bool *, typename PortableParticleData<dim, Number>::memory_space> &
+    PortableParticleData<dim, Number>::get_outside_flags() const
+  {
+    return outside_flags;
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  PortableParticleData<dim, Number>::advect(const PointView &velocities,
+                                            const Number     time_step)
+  {
+    AssertDimension(velocities.extent(0), n_particles());
+
+    // Copy the members into local variables so that the lambda captures
+    // the views by value rather than the this pointer
+    const auto x = locations;
+
+    Kokkos::parallel_for(
+      "dealii::Particles::PortableParticleData::advect",
+      Kokkos::RangePolicy<memory_space::execution_space>(0, n_particles()),
+      KOKKOS_LAMBDA(const int p) {
+        for (int d = 0; d < dim; ++d)
+          x(p, d) += time_step * velocities(p, d);
+      });
+  }
+
+
+
+  template <int dim, typename Number>
+  unsigned int
+  PortableParticleData<dim, Number>::update_reference_locations(
+    const Number tolerance)
+  {
+    const auto x       = locations;
+    const auto x_ref   = reference_locations;
+    const auto cell_of = cell_indices;
+    const auto outside = outside_flags;
+    const auto inv_A   = inverse_affine_matrices;
+    const auto b       = affine_shifts;
+
+    unsigned int n_outside = 0;
+    Kokkos::parallel_reduce(
+      "dealii::Particles::PortableParticleData::update_reference_locations",
+      Kokkos::RangePolicy<memory_space::execution_space>(0, n_particles()),
+      KOKKOS_LAMBDA(const int p, unsigned int &count) {
+        const unsigned int cell = cell_of(p);
+
+        bool is_outside = false;
+        for (int d = 0; d < dim; ++d)
+          {
+            Number reference_coordinate = 0;
+            for (int e = 0; e < dim; ++e)
+              reference_coordinate +=
+                inv_A(cell, d, e) * (x(p, e) - b(cell, e));
+            x_ref(p, d) = reference_coordinate;
+            if (reference_coordinate < -tolerance ||
+                reference_coordinate > Number(1) + tolerance)
+              is_outside = true;
+          }
+
+        outside(p) = is_outside;
+        if (is_outside)
+          ++count;
+      },
+      n_outside);
+
+    return n_outside;
+  }
+
+#endif // DOXYGEN
+
+} // namespace Particles
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
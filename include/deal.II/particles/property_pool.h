@@ -20,6 +20,11 @@
 #include <deal.II/base/array_view.h>
 #include <deal.II/base/point.h>
 
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -75,6 +80,104 @@ namespace types
 
 namespace Particles
 {
+  /**
+   * The number types in which compact particle properties can be stored,
+   * see CompactPropertyField.
+   */
+  enum class CompactPropertyType : unsigned char
+  {
+    /**
+     * Single precision floating point numbers, stored as @p float.
+     */
+    float32,
+
+    /**
+     * Signed 32-bit integers, stored as @p std::int32_t.
+     */
+    int32,
+
+    /**
+     * Unsigned 8-bit integers, stored as @p std::uint8_t, e.g., for tags.
+     */
+    uint8
+  };
+
+
+
+  /**
+   * The description of one field of compact particle properties, i.e., of
+   * properties that are stored in a number type that is smaller than the
+   * @p double of the regular properties. Each field consists of a fixed
+   * number of components of the same type for every particle, e.g., one
+   * @p int32 for a tag or three @p float32 for a small vector.
+   */
+  struct CompactPropertyField
+  {
+    /**
+     * Constructor.
+     */
+    CompactPropertyField(const CompactPropertyType type,
+                         const unsigned int        n_components = 1)
+      : type(type)
+      , n_components(n_components)
+    {}
+
+    /**
+     * Return the size of one component in bytes.
+     */
+    std::size_t
+    component_size() const
+    {
+      return type == CompactPropertyType::uint8 ? 1 : 4;
+    }
+
+    /**
+     * Return the size of all components of one particle in bytes.
+     */
+    std::size_t
+    n_bytes() const
+    {
+      return n_components * component_size();
+    }
+
+    /**
+     * The number type of the field.
+     */
+    CompactPropertyType type;
+
+    /**
+     * The number of components per particle.
+     */
+    unsigned int n_components;
+  };
+
+
+
+  namespace internal
+  {
+    /**
+     * Return the CompactPropertyType corresponding to the C++ type @p T.
+     */
+    template <typename T>
+    constexpr CompactPropertyType
+    compact_property_type()
+    {
+      static_assert(std::is_same_v<T, float> ||
+                      std::is_same_v<T, std::int32_t> ||
+                      std::is_same_v<T, std::uint8_t>,
+                    "Compact properties can only be accessed as float, "
+                    "std::int32_t, or std::uint8_t.");
+      if constexpr (std::is_same_v<T, float>)
+        return CompactPropertyType::float32;
+      else if constexpr (std::is_same_v<T, std::int32_t>)
+        return CompactPropertyType::int32;
+      else
+        return CompactPropertyType::uint8;
+    }
+  } // namespace internal
+
+
+
   /**
    * This class manages a memory space in which all particles associated with
    * a ParticleHandler store their properties. It also stores the locations
@@ -96,6 +199,17 @@ namespace Particles
    * course the PropertyType could contain a pointer to dynamically allocated
    * memory with varying sizes per particle (this memory would not be managed by
    * this class).
+   *
+   * In addition to the @p double properties, the pool can store any number
+   * of fields of compact properties described by CompactPropertyField
+   * objects, e.g., tags, ages, or small vectors that do not need double
+   * precision. Each field is stored in its own array, indexed by handles
+   * like the other arrays, and accessed through get_compact_properties().
+   * For a large number of particles, storing such data as @p float or @p
+   * int32 rather than @p double halves the memory for these properties, and
+   * since the compact properties are serialized in their own type, the same
+   * saving applies to the data communicated between processes and written
+   * into checkpoints.
    */
   template <int dim, int spacedim = dim>
   class PropertyPool
@@ -114,9 +228,13 @@ namespace Particles
     static const Handle invalid_handle;
 
     /**
-     * Constructor. Stores the number of properties per reserved slot.
+     * Constructor. Stores the number of properties per reserved slot, and
+     * the fields of compact properties that are stored in addition to the
+     * regular properties.
      */
-    PropertyPool(const unsigned int n_properties_per_slot);
+    PropertyPool(
+      const unsigned int                        n_properties_per_slot,
+      const std::vector<CompactPropertyField> &compact_property_fields = {});
 
     /**
      * Destructor. This function ensures that all memory that had
@@ -232,6 +350,103 @@ namespace Particles
       return ArrayView<double>(properties.data() + data_index, n_properties);
     }
 
+    /**
+     * Return a writeable view to the locations of the @p n_particles
+     * particles with the consecutive handles starting at @p first_handle.
+     * Consecutive handles are obtained for the particles of each cell by
+     * ParticleHandler::sort_particle_data().
+     */
+    ArrayView<Point<spacedim>>
+    get_locations(const Handle first_handle, const unsigned int n_particles);
+
+    /**
+     * Return a read-only view to the locations of the @p n_particles
+     * particles with the consecutive handles starting at @p first_handle.
+     */
+    ArrayView<const Point<spacedim>>
+    get_locations(const Handle       first_handle,
+                  const unsigned int n_particles) const;
+
+    /**
+     * Return a writeable view to the reference locations of the
+     * @p n_particles particles with the consecutive handles starting at
+     * @p first_handle.
+     */
+    ArrayView<Point<dim>>
+    get_reference_locations(const Handle       first_handle,
+                            const unsigned int n_particles);
+
+    /**
+     * Return a read-only view to the ID numbers of the @p n_particles
+     * particles with the consecutive handles starting at @p first_handle.
+     */
+    ArrayView<const types::particle_index>
+    get_ids(const Handle first_handle, const unsigned int n_particles) const;
+
+    /**
+     * Return a view to the properties of the @p n_particles particles with
+     * the consecutive handles starting at @p first_handle. The properties of
+     * each particle are stored next to each other, i.e., the view has
+     * `n_particles * n_properties_per_slot()` entries.
+     */
+    ArrayView<double>
+    get_properties(const Handle first_handle, const unsigned int n_particles);
+
+
+    /**
+     * Return a view to the components of the compact property field
+     * @p field of the particle with handle @p handle. The type @p T must
+     * correspond to the CompactPropertyType of the field.
+     */
+    template <typename T>
+    ArrayView<T>
+    get_compact_properties(const Handle handle, const unsigned int field);
+
+    /**
+     * Return a read-only view to the components of the compact property
+     * field @p field of the particle with handle @p handle.
+     */
+    template <typename T>
+    ArrayView<const T>
+    get_compact_properties(const Handle       handle,
+                           const unsigned int field) const;
+
+    /**
+     * Return the fields of compact properties stored in this pool.
+     */
+    const std::vector<CompactPropertyField> &
+    get_compact_property_fields() const;
+
+    /**
+     * Return the number of bytes that write_compact_properties() writes
+     * per particle, which is the size of all compact properties of a
+     * particle rounded up to a multiple of the size of @p double, such that
+     * data following the compact properties in a buffer stays aligned.
+     */
+    std::size_t
+    serialized_compact_size_in_bytes() const;
+
+    /**
+     * Write the compact properties of the particle with handle @p handle
+     * into @p data, and return a pointer behind the written data.
+     */
+    void *
+    write_compact_properties(const Handle handle, void *data) const;
+
+    /**
+     * Read the compact properties of the particle with handle @p handle
+     * from @p data, as written by write_compact_properties(), and return a
+     * pointer behind the read data.
+     */
+    const void *
+    read_compact_properties(const Handle handle, const void *data);
+
+    /**
+     * Copy the compact properties of the particle with handle @p source to
+     * the particle with handle @p destination.
+     */
+    void
+    copy_compact_properties(const Handle source, const Handle destination);
 
     /**
      * Reserve the dynamic memory needed for storing the properties of
@@ -304,6 +519,18 @@ namespace Particles
      */
     std::vector<double> properties;
 
+    /**
+     * The fields of compact properties.
+     */
+    const std::vector<CompactPropertyField> compact_property_fields;
+
+    /**
+     * The currently allocated compact properties, with one array per field
+     * that is indexed by handles, holding the raw bytes of the components
+     * of all particles.
+     */
+    std::vector<std::vector<unsigned char>> compact_properties;
+
     /**
      * A collection of handles that have been created by
      * allocate_properties_array() and have been destroyed by
@@ -489,6 +716,213 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  inline ArrayView<Point<spacedim>>
+  PropertyPool<dim, spacedim>::get_locations(const Handle       first_handle,
+                                             const unsigned int n_particles)
+  {
+    if (n_particles == 0)
+      return {};
+
+    AssertIndexRange(first_handle + n_particles, locations.size() + 1);
+    return {locations.data() + first_handle, n_particles};
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline ArrayView<const Point<spacedim>>
+  PropertyPool<dim, spacedim>::get_locations(
+    const Handle       first_handle,
+    const unsigned int n_particles) const
+  {
+    if (n_particles == 0)
+      return {};
+
+    AssertIndexRange(first_handle + n_particles, locations.size() + 1);
+    return {locations.data() + first_handle, n_particles};
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline ArrayView<Point<dim>>
+  PropertyPool<dim, spacedim>::get_reference_locations(
+    const Handle       first_handle,
+    const unsigned int n_particles)
+  {
+    if (n_particles == 0)
+      return {};
+
+    AssertIndexRange(first_handle + n_particles,
+                     reference_locations.size() + 1);
+    return {reference_locations.data() + first_handle, n_particles};
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline ArrayView<const types::particle_index>
+  PropertyPool<dim, spacedim>::get_ids(const Handle       first_handle,
+                                       const unsigned int n_particles) const
+  {
+    if (n_particles == 0)
+      return {};
+
+    AssertIndexRange(first_handle + n_particles, ids.size() + 1);
+    return {ids.data() + first_handle, n_particles};
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline ArrayView<double>
+  PropertyPool<dim, spacedim>::get_properties(const Handle       first_handle,
+                                              const unsigned int n_particles)
+  {
+    if (n_particles == 0 || n_properties == 0)
+      return {};
+
+    AssertIndexRange((first_handle + n_particles) * n_properties,
+                     properties.size() + 1);
+    return {properties.data() +
+              static_cast<std::size_t>(first_handle) * n_properties,
+            static_cast<std::size_t>(n_particles) * n_properties};
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename T>
+  inline ArrayView<T>
+  PropertyPool<dim, spacedim>::get_compact_properties(const Handle handle,
+                                                      const unsigned int field)
+  {
+    AssertIndexRange(field, compact_property_fields.size());
+    Assert(compact_property_fields[field].type ==
+             internal::compact_property_type<T>(),
+           ExcMessage("The type used to access the compact property field "
+                      "does not match the type of the field."));
+
+    const unsigned int n_components =
+      compact_property_fields[field].n_components;
+    AssertIndexRange((static_cast<std::size_t>(handle) + 1) * n_components *
+                       sizeof(T),
+                     compact_properties[field].size() + 1);
+    return {reinterpret_cast<T *>(compact_properties[field].data()) +
+              static_cast<std::size_t>(handle) * n_components,
+            n_components};
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename T>
+  inline ArrayView<const T>
+  PropertyPool<dim, spacedim>::get_compact_properties(
+    const Handle       handle,
+    const unsigned int field) const
+  {
+    return const_cast<PropertyPool<dim, spacedim> *>(this)
+      ->template get_compact_properties<T>(handle, field);
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline const std::vector<CompactPropertyField> &
+  PropertyPool<dim, spacedim>::get_compact_property_fields() const
+  {
+    return compact_property_fields;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline std::size_t
+  PropertyPool<dim, spacedim>::serialized_compact_size_in_bytes() const
+  {
+    std::size_t size = 0;
+    for (const CompactPropertyField &field : compact_property_fields)
+      size += field.n_bytes();
+    return (size + sizeof(double) - 1) / sizeof(double) * sizeof(double);
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline void *
+  PropertyPool<dim, spacedim>::write_compact_properties(const Handle handle,
+                                                        void *data) const
+  {
+    if (compact_property_fields.empty())
+      return data;
+
+    char *bytes = static_cast<char *>(data);
+    char *end   = bytes + serialized_compact_size_in_bytes();
+    for (unsigned int f = 0; f < compact_property_fields.size(); ++f)
+      {
+        const std::size_t size = compact_property_fields[f].n_bytes();
+        std::memcpy(bytes,
+                    compact_properties[f].data() +
+                      static_cast<std::size_t>(handle) * size,
+                    size);
+        bytes += size;
+      }
+
+    // zero the padding to get reproducible buffers, e.g., for checkpoints
+    std::memset(bytes, 0, end - bytes);
+    return end;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline const void *
+  PropertyPool<dim, spacedim>::read_compact_properties(const Handle handle,
+                                                       const void  *data)
+  {
+    if (compact_property_fields.empty())
+      return data;
+
+    const char *bytes = static_cast<const char *>(data);
+    const char *end   = bytes + serialized_compact_size_in_bytes();
+    for (unsigned int f = 0; f < compact_property_fields.size(); ++f)
+      {
+        const std::size_t size = compact_property_fields[f].n_bytes();
+        std::memcpy(compact_properties[f].data() +
+                      static_cast<std::size_t>(handle) * size,
+                    bytes,
+                    size);
+        bytes += size;
+      }
+    return end;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline void
+  PropertyPool<dim, spacedim>::copy_compact_properties(
+    const Handle source,
+    const Handle destination)
+  {
+    if (source == destination)
+      return;
+
+    for (unsigned int f = 0; f < compact_property_fields.size(); ++f)
+      {
+        const std::size_t size = compact_property_fields[f].n_bytes();
+        std::memcpy(compact_properties[f].data() +
+                      static_cast<std::size_t>(destination) * size,
+                    compact_properties[f].data() +
+                      static_cast<std::size_t>(source) * size,
+                    size);
+      }
+  }
+
+
+
   template <int dim, int spacedim>
   inline unsigned int
   PropertyPool<dim, spacedim>::n_slots() const
@@ -287,9 +287,10 @@ template <int dim, typename Number>
 inline Tensor<2, dim, Number>
 Physics::Elasticity::Kinematics::F_iso(const Tensor<2, dim, Number> &F)
 {
-  // Make things work with AD types
+  // Make things work with AD types and VectorizedArray
   using std::pow;
-  return internal::NumberType<Number>::value(pow(determinant(F), -1.0 / dim)) *
+  const Number exponent = -1.0 / dim;
+  return internal::NumberType<Number>::value(pow(determinant(F), exponent)) *
          F;
 }
 
@@ -299,9 +300,10 @@ template <int dim, typename Number>
 inline SymmetricTensor<2, dim, Number>
 Physics::Elasticity::Kinematics::F_vol(const Tensor<2, dim, Number> &F)
 {
-  // Make things work with AD types
+  // Make things work with AD types and VectorizedArray
   using std::pow;
-  return internal::NumberType<Number>::value(pow(determinant(F), 1.0 / dim)) *
+  const Number exponent = 1.0 / dim;
+  return internal::NumberType<Number>::value(pow(determinant(F), exponent)) *
          static_cast<SymmetricTensor<2, dim, Number>>(
            unit_symmetric_tensor<dim>());
 }
@@ -35,6 +35,8 @@
 #  include <deal.II/lac/trilinos_vector.h>
 #  include <deal.II/lac/vector_memory.h>
 
+#  include <Kokkos_Core.hpp>
+
 #  include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -183,7 +185,24 @@ namespace SUNDIALS
                                            MemorySpace::Host>> ||
       std::is_same_v<VectorType,
                      LinearAlgebra::distributed::BlockVector<
-                       typename VectorType::value_type>>;
+                       typename VectorType::value_type>> ||
+      std::is_same_v<
+        VectorType,
+        LinearAlgebra::distributed::Vector<typename VectorType::value_type,
+                                           MemorySpace::Default>>;
+
+    /**
+     * Variable template that is true for distributed deal.II vectors that
+     * store their elements in MemorySpace::Default and false otherwise. The
+     * operations on these vectors that access individual elements are
+     * implemented by Kokkos kernels in the memory space of the vector, such
+     * that the data never needs to be copied to the host.
+     */
+    template <typename VectorType>
+    constexpr bool is_dealii_compatible_device_vector = std::is_same_v<
+      VectorType,
+      LinearAlgebra::distributed::Vector<typename VectorType::value_type,
+                                         MemorySpace::Default>>;
 
     template <typename VectorType,
               std::enable_if_t<!IsBlockVector<VectorType>::value> * = nullptr>
@@ -649,6 +668,234 @@ namespace SUNDIALS
 
 
 
+    /**
+     * Kokkos kernels for the operations on vectors that store their elements
+     * in MemorySpace::Default, see is_dealii_compatible_device_vector. All
+     * functions only work on the locally owned elements.
+     */
+    namespace DeviceKernels
+    {
+      using ExecutionSpace =
+        ::dealii::MemorySpace::Default::kokkos_space::execution_space;
+
+      using size_type = types::global_dof_index;
+
+      /**
+       * The number of vectors the fused operations process in a single
+       * kernel. Larger numbers of vectors are processed in groups of this
+       * size.
+       */
+      constexpr int n_vectors_per_kernel = 8;
+
+
+
+      /**
+       * Functor computing the local dot products of a vector with up to
+       * n_vectors_per_kernel other vectors in a single pass through memory.
+       */
+      template <typename Number>
+      struct DotProductMulti
+      {
+        using value_type = realtype[];
+
+        unsigned int value_count;
+
+        const Number *x;
+
+        Kokkos::Array<const Number *, n_vectors_per_kernel> y;
+
+        KOKKOS_INLINE_FUNCTION void
+        operator()(const size_type j, value_type d) const
+        {
+          for (unsigned int i = 0; i < value_count; ++i)
+            d[i] += x[j] * y[i][j];
+        }
+
+        KOKKOS_INLINE_FUNCTION void
+        init(value_type d) const
+        {
+          for (unsigned int i = 0; i < value_count; ++i)
+            d[i] = 0.;
+        }
+
+        KOKKOS_INLINE_FUNCTION void
+        join(value_type dst, const value_type src) const
+        {
+          for (unsigned int i = 0; i < value_count; ++i)
+            dst[i] += src[i];
+        }
+      };
+
+
+
+      template <typename VectorType>
+      void
+      linear_combination(int nv, realtype *c, N_Vector *x, N_Vector z)
+      {
+        using Number = typename VectorType::value_type;
+
+        auto           *z_dealii = unwrap_nvector<VectorType>(z);
+        Number         *z_values = z_dealii->get_values();
+        const size_type size     = z_dealii->locally_owned_size();
+
+        ExecutionSpace exec;
+        for (int start = 0; start < nv; start += n_vectors_per_kernel)
+          {
+            const int n = std::min(nv - start, n_vectors_per_kernel);
+            Kokkos::Array<const Number *, n_vectors_per_kernel> x_values;
+            Kokkos::Array<Number, n_vectors_per_kernel>         factors;
+            for (int i = 0; i < n; ++i)
+              {
+                x_values[i] =
+                  unwrap_nvector_const<VectorType>(x[start + i])->get_values();
+                factors[i] = c[start + i];
+              }
+
+            // N.B. The first vector may alias with z, which is fine since
+            // every entry of z is only written after all reads of that
+            // entry. For all but the first group, we add to z.
+            const bool add = (start > 0);
+            Kokkos::parallel_for(
+              "dealii::SUNDIALS::linear_combination",
+              Kokkos::RangePolicy<ExecutionSpace>(exec, 0, size),
+              KOKKOS_LAMBDA(size_type j) {
+                Number temp = add ? z_values[j] : Number();
+                for (int i = 0; i < n; ++i)
+                  temp += factors[i] * x_values[i][j];
+                z_values[j] = temp;
+              });
+          }
+        exec.fence();
+      }
+
+
+
+      template <typename VectorType>
+      void
+      dot_product_multi_local(int nv, N_Vector x, N_Vector *y, realtype *d)
+      {
+        using Number = typename VectorType::value_type;
+
+        const VectorType *x_dealii = unwrap_nvector_const<VectorType>(x);
+
+        DotProductMulti<Number> functor;
+        functor.x = x_dealii->get_values();
+
+        ExecutionSpace exec;
+        for (int start = 0; start < nv; start += n_vectors_per_kernel)
+          {
+            const int n = std::min(nv - start, n_vectors_per_kernel);
+            functor.value_count = n;
+            for (int i = 0; i < n; ++i)
+              functor.y[i] =
+                unwrap_nvector_const<VectorType>(y[start + i])->get_values();
+
+            Kokkos::View<realtype *,
+                         Kokkos::HostSpace,
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+              result(d + start, n);
+            Kokkos::parallel_reduce(
+              "dealii::SUNDIALS::dot_product_multi_local",
+              Kokkos::RangePolicy<ExecutionSpace>(
+                exec, 0, x_dealii->locally_owned_size()),
+              functor,
+              result);
+          }
+        exec.fence();
+      }
+
+
+
+      template <typename VectorType>
+      typename VectorType::value_type
+      min_element_local(const VectorType &x)
+      {
+        using Number = typename VectorType::value_type;
+
+        const Number *x_values = x.get_values();
+        Number        result;
+
+        ExecutionSpace exec;
+        Kokkos::parallel_reduce(
+          "dealii::SUNDIALS::min_element",
+          Kokkos::RangePolicy<ExecutionSpace>(exec, 0, x.locally_owned_size()),
+          KOKKOS_LAMBDA(size_type j, Number & update) {
+            if (x_values[j] < update)
+              update = x_values[j];
+          },
+          Kokkos::Min<Number>(result));
+        exec.fence();
+
+        return result;
+      }
+
+
+
+      template <typename VectorType>
+      void
+      elementwise_div(const VectorType &x, const VectorType &y, VectorType &z)
+      {
+        using Number = typename VectorType::value_type;
+
+        const Number *x_values = x.get_values();
+        const Number *y_values = y.get_values();
+        Number       *z_values = z.get_values();
+
+        ExecutionSpace exec;
+        Kokkos::parallel_for(
+          "dealii::SUNDIALS::elementwise_div",
+          Kokkos::RangePolicy<ExecutionSpace>(exec, 0, z.locally_owned_size()),
+          KOKKOS_LAMBDA(size_type j) {
+            z_values[j] = x_values[j] / y_values[j];
+          });
+        exec.fence();
+      }
+
+
+
+      template <typename VectorType>
+      void
+      elementwise_inv(const VectorType &x, VectorType &z)
+      {
+        using Number = typename VectorType::value_type;
+
+        const Number *x_values = x.get_values();
+        Number       *z_values = z.get_values();
+
+        ExecutionSpace exec;
+        Kokkos::parallel_for(
+          "dealii::SUNDIALS::elementwise_inv",
+          Kokkos::RangePolicy<ExecutionSpace>(exec, 0, z.locally_owned_size()),
+          KOKKOS_LAMBDA(size_type j) {
+            z_values[j] = Number(1.) / x_values[j];
+          });
+        exec.fence();
+      }
+
+
+
+      template <typename VectorType>
+      void
+      elementwise_abs(const VectorType &x, VectorType &z)
+      {
+        using Number = typename VectorType::value_type;
+
+        const Number *x_values = x.get_values();
+        Number       *z_values = z.get_values();
+
+        ExecutionSpace exec;
+        Kokkos::parallel_for(
+          "dealii::SUNDIALS::elementwise_abs",
+          Kokkos::RangePolicy<ExecutionSpace>(exec, 0, z.locally_owned_size()),
+          KOKKOS_LAMBDA(size_type j) {
+            z_values[j] = (x_values[j] < Number()) ? -x_values[j] : x_values[j];
+          });
+        exec.fence();
+      }
+    } // namespace DeviceKernels
+
+
+
     namespace NVectorOperations
     {
       N_Vector_ID
@@ -819,6 +1066,12 @@ namespace SUNDIALS
       int
       linear_combination(int nv, realtype *c, N_Vector *x, N_Vector z)
       {
+        if constexpr (is_dealii_compatible_device_vector<VectorType>)
+          {
+            DeviceKernels::linear_combination<VectorType>(nv, c, x, z);
+            return 0;
+          }
+
         std::vector<const VectorType *> unwrapped_vectors(nv);
         for (int i = 0; i < nv; ++i)
           unwrapped_vectors[i] = unwrap_nvector_const<VectorType>(x[i]);
@@ -871,6 +1124,12 @@ namespace SUNDIALS
       int
       dot_product_multi_local(int nv, N_Vector x, N_Vector *y, realtype *d)
       {
+        if constexpr (is_dealii_compatible_device_vector<VectorType>)
+          {
+            DeviceKernels::dot_product_multi_local<VectorType>(nv, x, y, d);
+            return 0;
+          }
+
         std::vector<const VectorType *> unwrapped_vectors(nv);
         for (int i = 0; i < nv; ++i)
           unwrapped_vectors[i] = unwrap_nvector_const<VectorType>(y[i]);
@@ -1035,6 +1294,9 @@ namespace SUNDIALS
       {
         auto *vector = unwrap_nvector_const<VectorType>(x);
 
+        if constexpr (is_dealii_compatible_device_vector<VectorType>)
+          return Utilities::MPI::min(DeviceKernels::min_element_local(*vector),
+                                     get_mpi_communicator<VectorType>(x));
 
         const auto indexed_less_than = [&](const IndexSet::size_type idxa,
                                            const IndexSet::size_type idxb) {
@@ -1119,6 +1381,12 @@ namespace SUNDIALS
         AssertDimension(x_dealii->size(), z_dealii->size());
         AssertDimension(x_dealii->size(), y_dealii->size());
 
+        if constexpr (is_dealii_compatible_device_vector<VectorType>)
+          {
+            DeviceKernels::elementwise_div(*x_dealii, *y_dealii, *z_dealii);
+            return;
+          }
+
         auto x_ele = x_dealii->locally_owned_elements();
         for (const auto idx : x_ele)
           {
@@ -1167,6 +1435,12 @@ namespace SUNDIALS
 
         AssertDimension(x_dealii->size(), z_dealii->size());
 
+        if constexpr (is_dealii_compatible_device_vector<VectorType>)
+          {
+            DeviceKernels::elementwise_inv(*x_dealii, *z_dealii);
+            return;
+          }
+
         auto x_ele = x_dealii->locally_owned_elements();
         for (const auto idx : x_ele)
           {
@@ -1212,6 +1486,12 @@ namespace SUNDIALS
 
         AssertDimension(x_dealii->size(), z_dealii->size());
 
+        if constexpr (is_dealii_compatible_device_vector<VectorType>)
+          {
+            DeviceKernels::elementwise_abs(*x_dealii, *z_dealii);
+            return;
+          }
+
         auto x_ele = x_dealii->locally_owned_elements();
         for (const auto idx : x_ele)
           {
@@ -17,6 +17,7 @@
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi_large_count.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/parameter_handler.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
@@ -30,6 +31,7 @@
 #include <ctime>
 #include <fstream>
 #include <iomanip>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <set>
@@ -44,6 +46,13 @@
 #  include <hdf5.h>
 #endif
 
+#ifdef DEAL_II_HAVE_UNISTD_H
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
 #include <boost/iostreams/copy.hpp>
 #include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
@@ -123,9 +132,25 @@ namespace
 #    endif
 #  endif
 
+  /**
+   * The size of the blocks, in bytes, into which compress_array() splits its
+   * input. The blocks are compressed independently and in parallel, and VTK
+   * readers decompress them one after the other. Arrays smaller than this
+   * size end up in a single block.
+   */
+  constexpr std::size_t vtu_compression_block_size = std::size_t(1) << 20;
+
+
+
   /**
    * Do a zlib compression followed by a base64 encoding of the given data. The
    * result is then returned as a string object.
+   *
+   * The data is split into blocks of size vtu_compression_block_size that are
+   * compressed in parallel, using the multi-block layout of the
+   * vtkZLibDataCompressor: the compression header contains the number of
+   * blocks, the uncompressed size of a block and of the last block, and the
+   * compressed size of each block, followed by the compressed blocks.
    */
   template <typename T>
   std::string
@@ -136,49 +161,84 @@ namespace
     if (data.size() != 0)
       {
         const std::size_t uncompressed_size = (data.size() * sizeof(T));
+        const std::size_t n_blocks =
+          (uncompressed_size + vtu_compression_block_size - 1) /
+          vtu_compression_block_size;
 
-        // While zlib's compress2 uses unsigned long (which is 64bits
-        // on Linux), the vtu compression header stores the block size
-        // as an std::uint32_t (see below). While we could implement
-        // writing several smaller blocks, we haven't done that. Let's
-        // trigger an error for the user instead:
-        AssertThrow(uncompressed_size <=
-                      std::numeric_limits<std::uint32_t>::max(),
+        // The vtu compression header stores all sizes as std::uint32_t,
+        // which limits the number of blocks but not the size of the array
+        AssertThrow(n_blocks <= std::numeric_limits<std::uint32_t>::max(),
                     ExcNotImplemented());
 
-        // allocate a buffer for compressing data and do so
-        auto compressed_data_length = compressBound(uncompressed_size);
-        AssertThrow(compressed_data_length <=
-                      std::numeric_limits<std::uint32_t>::max(),
-                    ExcNotImplemented());
-
-        std::vector<unsigned char> compressed_data(compressed_data_length);
-
-        int err = compress2(&compressed_data[0],
-                            &compressed_data_length,
-                            reinterpret_cast<const Bytef *>(data.data()),
-                            uncompressed_size,
-                            get_zlib_compression_level(compression_level));
-        (void)err;
-        Assert(err == Z_OK, ExcInternalError());
-
-        // Discard the unnecessary bytes
-        compressed_data.resize(compressed_data_length);
-
-        // now encode the compression header
-        const std::uint32_t compression_header[4] = {
-          1,                                             /* number of blocks */
-          static_cast<std::uint32_t>(uncompressed_size), /* size of block */
-          static_cast<std::uint32_t>(
-            uncompressed_size), /* size of last block */
-          static_cast<std::uint32_t>(
-            compressed_data_length)}; /* list of compressed sizes of blocks */
+        const auto *const uncompressed_data =
+          reinterpret_cast<const Bytef *>(data.data());
+        const int zlib_compression_level =
+          get_zlib_compression_level(compression_level);
+
+        // compress the blocks into separate buffers, each one sized to hold
+        // the worst case of a block
+        std::vector<std::vector<unsigned char>> compressed_blocks(n_blocks);
+        parallel::apply_to_subranges(
+          std::size_t(0),
+          n_blocks,
+          [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t b = begin; b < end; ++b)
+              {
+                const std::size_t offset = b * vtu_compression_block_size;
+                const std::size_t block_size =
+                  std::min(vtu_compression_block_size,
+                           uncompressed_size - offset);
+
+                auto compressed_data_length = compressBound(block_size);
+                compressed_blocks[b].resize(compressed_data_length);
+
+                int err = compress2(compressed_blocks[b].data(),
+                                    &compressed_data_length,
+                                    uncompressed_data + offset,
+                                    block_size,
+                                    zlib_compression_level);
+                (void)err;
+                Assert(err == Z_OK, ExcInternalError());
+
+                // Discard the unnecessary bytes
+                compressed_blocks[b].resize(compressed_data_length);
+              }
+          },
+          1);
+
+        // now encode the compression header: the number of blocks, the size
+        // of a block, the size of the last block, and the list of compressed
+        // sizes of the blocks
+        std::vector<std::uint32_t> compression_header(3 + n_blocks);
+        compression_header[0] = static_cast<std::uint32_t>(n_blocks);
+        compression_header[1] = static_cast<std::uint32_t>(
+          std::min(vtu_compression_block_size, uncompressed_size));
+        compression_header[2] = static_cast<std::uint32_t>(
+          uncompressed_size - (n_blocks - 1) * vtu_compression_block_size);
+        std::size_t total_compressed_size = 0;
+        for (std::size_t b = 0; b < n_blocks; ++b)
+          {
+            compression_header[3 + b] =
+              static_cast<std::uint32_t>(compressed_blocks[b].size());
+            total_compressed_size += compressed_blocks[b].size();
+          }
 
         const auto *const header_start =
-          reinterpret_cast<const unsigned char *>(&compression_header[0]);
+          reinterpret_cast<const unsigned char *>(compression_header.data());
+
+        // base64 encodes groups of three bytes, so the compressed blocks
+        // need to be concatenated before encoding them
+        std::vector<unsigned char> compressed_data;
+        compressed_data.reserve(total_compressed_size);
+        for (const auto &block : compressed_blocks)
+          compressed_data.insert(compressed_data.end(),
+                                 block.begin(),
+                                 block.end());
 
         return (Utilities::encode_base64(
-                  {header_start, header_start + 4 * sizeof(std::uint32_t)}) +
+                  {header_start,
+                   header_start +
+                     compression_header.size() * sizeof(std::uint32_t)}) +
                 Utilities::encode_base64(compressed_data));
       }
     else
@@ -226,6 +286,63 @@ namespace
   }
 
 
+  /**
+   * Round the values in @p data such that the error of each value is
+   * bounded by the given tolerance, and such that the trailing bits of the
+   * binary representation are zero. The result is still a regular array of
+   * floating point numbers, but one that zlib compresses much better.
+   */
+  void
+  apply_lossy_compression(
+    std::vector<float>                           &data,
+    const DataOutBase::LossyCompressionTolerance &tolerance)
+  {
+    if (!(tolerance.tolerance > 0.))
+      return;
+
+    if (tolerance.type ==
+        DataOutBase::LossyCompressionTolerance::Type::absolute)
+      {
+        // round to multiples of the largest power of two not exceeding
+        // twice the tolerance, which leaves the low bits unused
+        const double quantum =
+          std::exp2(std::floor(std::log2(2. * tolerance.tolerance)));
+        const double inverse_quantum = 1. / quantum;
+        for (float &value : data)
+          if (std::isfinite(value))
+            value = static_cast<float>(
+              std::round(static_cast<double>(value) * inverse_quantum) *
+              quantum);
+      }
+    else
+      {
+        // keep only as many bits of the mantissa as are needed for the
+        // relative tolerance, rounding to nearest with ties to even; with k
+        // bits kept the relative error is at most 2^{-(k+1)}
+        const int needed_bits =
+          static_cast<int>(
+            std::ceil(-std::log2(std::min(tolerance.tolerance, 1.)))) -
+          1;
+        const unsigned int dropped_bits =
+          23 - std::min(std::max(needed_bits, 0), 23);
+        if (dropped_bits == 0)
+          return;
+
+        const std::uint32_t mask = (std::uint32_t(1) << dropped_bits) - 1;
+        for (float &value : data)
+          if (std::isfinite(value))
+            {
+              std::uint32_t bits;
+              std::memcpy(&bits, &value, sizeof(float));
+              bits += (mask >> 1) + ((bits >> dropped_bits) & 1);
+              bits &= ~mask;
+              std::memcpy(&value, &bits, sizeof(float));
+            }
+      }
+  }
+
+
+
   /**
    * The header in binary format that the parallel intermediate files
    * start with.
@@ -244,6 +361,337 @@ namespace
     std::uint64_t n_ranks;
     std::uint64_t n_patches;
   };
+
+
+
+  /**
+   * The header that files in binary intermediate format start with. The
+   * offsets are counted in bytes from the start of the file, the size of
+   * the data section in floats.
+   */
+  struct BinaryIntermediateHeader
+  {
+    std::uint64_t magic;
+    std::uint64_t version;
+    std::uint64_t dimension;
+    std::uint64_t space_dimension;
+    std::uint64_t n_patches;
+    std::uint64_t names_offset;
+    std::uint64_t patches_offset;
+    std::uint64_t data_offset;
+    std::uint64_t n_data_values;
+  };
+
+  /**
+   * The characters "d2binary" read as an integer on a little-endian machine.
+   * As the first character can not start a number, files in binary format
+   * are easily told apart from the ones in text format.
+   */
+  constexpr std::uint64_t binary_intermediate_magic = 0x7972616e69623264;
+
+  /**
+   * The version of the binary intermediate format, to be incremented
+   * whenever its layout changes.
+   */
+  constexpr std::uint64_t binary_intermediate_version = 1;
+
+  /**
+   * Return the size in bytes of the record that describes one patch in the
+   * binary intermediate format: the offset of the patch's values in the data
+   * section, six 32-bit integers (patch index, number of subdivisions,
+   * reference cell, whether points are available, and the number of rows and
+   * columns of the data), the neighbors, and the vertices. All of these
+   * sizes are multiples of eight bytes.
+   */
+  std::size_t
+  binary_patch_record_size(const unsigned int dim, const unsigned int spacedim)
+  {
+    return sizeof(std::uint64_t) + 6 * sizeof(std::uint32_t) +
+           2 * dim * sizeof(std::uint32_t) +
+           (1U << dim) * spacedim * sizeof(double);
+  }
+
+
+
+  /**
+   * Write the string @p s preceded by its length and padded with zeros to a
+   * multiple of eight bytes.
+   */
+  void
+  write_binary_string(std::ostream &out, const std::string &s)
+  {
+    const std::uint64_t size = s.size();
+    out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    out.write(s.data(), s.size());
+    const char padding[8] = {};
+    out.write(padding, (8 - s.size() % 8) % 8);
+  }
+
+
+
+  /**
+   * A class that gives access to the contents of a file as one block of
+   * memory. If possible, the file is mapped into memory rather than read.
+   */
+  class MappedFile
+  {
+  public:
+    explicit MappedFile(const std::string &filename)
+    {
+#  ifdef DEAL_II_HAVE_UNISTD_H
+      const int fd = open(filename.c_str(), O_RDONLY);
+      AssertThrow(fd != -1, ExcFileNotOpen(filename));
+
+      struct stat file_status;
+      const int   ierr = fstat(fd, &file_status);
+      if (ierr != 0)
+        close(fd);
+      AssertThrow(ierr == 0, ExcIO());
+      file_size = file_status.st_size;
+
+      if (file_size > 0)
+        {
+          void *const mapped_file =
+            mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+          close(fd);
+          AssertThrow(mapped_file != MAP_FAILED,
+                      ExcMessage("The file <" + filename +
+                                 "> could not be mapped into memory."));
+          madvise(mapped_file, file_size, MADV_SEQUENTIAL);
+          contents = static_cast<const char *>(mapped_file);
+        }
+      else
+        close(fd);
+#  else
+      std::ifstream in(filename, std::ios::binary);
+      AssertThrow(in.good(), ExcFileNotOpen(filename));
+      buffer.assign(std::istreambuf_iterator<char>(in),
+                    std::istreambuf_iterator<char>());
+      contents  = buffer.data();
+      file_size = buffer.size();
+#  endif
+    }
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile &
+    operator=(const MappedFile &) = delete;
+
+    ~MappedFile()
+    {
+#  ifdef DEAL_II_HAVE_UNISTD_H
+      if (contents != nullptr)
+        munmap(const_cast<char *>(contents), file_size);
+#  endif
+    }
+
+    const char *
+    data() const
+    {
+      return contents;
+    }
+
+    std::size_t
+    size() const
+    {
+      return file_size;
+    }
+
+  private:
+    const char *contents  = nullptr;
+    std::size_t file_size = 0;
+#  ifndef DEAL_II_HAVE_UNISTD_H
+    std::vector<char> buffer;
+#  endif
+  };
+
+
+
+  /**
+   * Check the header of a file in binary intermediate format of @p size
+   * bytes starting at @p contents and return it. @p source_name is used in
+   * error messages.
+   */
+  BinaryIntermediateHeader
+  read_binary_intermediate_header(const char        *contents,
+                                  const std::size_t  size,
+                                  const std::string &source_name)
+  {
+    BinaryIntermediateHeader header;
+    AssertThrow(size >= sizeof(header),
+                ExcMessage("<" + source_name +
+                           "> is too short for a file in binary deal.II "
+                           "intermediate format."));
+    std::memcpy(&header, contents, sizeof(header));
+    AssertThrow(header.magic == binary_intermediate_magic,
+                ExcMessage("<" + source_name +
+                           "> is not in binary deal.II intermediate format."));
+    AssertThrow(header.version == binary_intermediate_version,
+                ExcMessage("<" + source_name +
+                           "> uses an unsupported version of the binary "
+                           "deal.II intermediate format."));
+    AssertThrow(header.names_offset <= header.patches_offset &&
+                  header.patches_offset +
+                      header.n_patches *
+                        binary_patch_record_size(header.dimension,
+                                                 header.space_dimension) <=
+                    header.data_offset &&
+                  header.data_offset + header.n_data_values * sizeof(float) <=
+                    size,
+                ExcMessage("<" + source_name +
+                           "> is truncated or has an invalid header."));
+    return header;
+  }
+
+
+
+  /**
+   * A class to read the values and strings of the names section of a file in
+   * binary intermediate format.
+   */
+  class BinaryNamesReader
+  {
+  public:
+    BinaryNamesReader(const char        *begin,
+                      const char        *end,
+                      const std::string &source_name)
+      : position(begin)
+      , end(end)
+      , source_name(source_name)
+    {}
+
+    std::uint64_t
+    read_value()
+    {
+      std::uint64_t value;
+      check_available(sizeof(value));
+      std::memcpy(&value, position, sizeof(value));
+      position += sizeof(value);
+      return value;
+    }
+
+    std::string
+    read_string()
+    {
+      const std::uint64_t size = read_value();
+      check_available(size + (8 - size % 8) % 8);
+      std::string s(position, size);
+      position += size + (8 - size % 8) % 8;
+      return s;
+    }
+
+  private:
+    void
+    check_available(const std::size_t n_bytes) const
+    {
+      AssertThrow(n_bytes <= static_cast<std::size_t>(end - position),
+                  ExcMessage("The names of the data sets in <" + source_name +
+                             "> are incomplete."));
+    }
+
+    const char        *position;
+    const char *const  end;
+    const std::string &source_name;
+  };
+
+
+
+  /**
+   * Decode a file in binary intermediate format of @p size bytes starting at
+   * @p contents into the given arrays.
+   */
+  template <int dim, int spacedim>
+  void
+  read_binary_intermediate(
+    const char                                     *contents,
+    const std::size_t                               size,
+    const std::string                              &source_name,
+    std::vector<DataOutBase::Patch<dim, spacedim>> &patches,
+    std::vector<std::string>                       &data_names,
+    std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>
+      &nonscalar_data_ranges)
+  {
+    const BinaryIntermediateHeader header =
+      read_binary_intermediate_header(contents, size, source_name);
+    AssertThrow(header.dimension == dim && header.space_dimension == spacedim,
+                ExcMessage("<" + source_name + "> contains patches of " +
+                           "dimensions " + std::to_string(header.dimension) +
+                           " and " + std::to_string(header.space_dimension) +
+                           ", but dimensions " + std::to_string(dim) +
+                           " and " + std::to_string(spacedim) +
+                           " were requested."));
+
+    BinaryNamesReader names(contents + header.names_offset,
+                            contents + header.patches_offset,
+                            source_name);
+    data_names.resize(names.read_value());
+    for (std::string &name : data_names)
+      name = names.read_string();
+    nonscalar_data_ranges.resize(names.read_value());
+    for (auto &range : nonscalar_data_ranges)
+      {
+        std::get<0>(range) = names.read_value();
+        std::get<1>(range) = names.read_value();
+        std::get<3>(range) = static_cast<
+          DataComponentInterpretation::DataComponentInterpretation>(
+          names.read_value());
+        std::get<2>(range) = names.read_string();
+      }
+
+    const std::size_t record_size = binary_patch_record_size(dim, spacedim);
+    const char *const data        = contents + header.data_offset;
+    patches.resize(header.n_patches);
+    for (unsigned int p = 0; p < patches.size(); ++p)
+      {
+        const char *const record =
+          contents + header.patches_offset + p * record_size;
+        DataOutBase::Patch<dim, spacedim> &patch = patches[p];
+
+        std::uint64_t data_offset;
+        std::memcpy(&data_offset, record, sizeof(data_offset));
+        std::uint32_t fields[6];
+        std::memcpy(fields, record + sizeof(data_offset), sizeof(fields));
+        const char *position = record + sizeof(data_offset) + sizeof(fields);
+
+        patch.patch_index = fields[0];
+        if constexpr (dim > 1)
+          patch.n_subdivisions = fields[1];
+        if constexpr (dim > 0)
+          patch.reference_cell =
+            internal::make_reference_cell_from_int(fields[2]);
+        patch.points_are_available = (fields[3] != 0);
+
+        for (unsigned int f = 0; f < GeometryInfo<dim>::faces_per_cell; ++f)
+          {
+            std::uint32_t neighbor;
+            std::memcpy(&neighbor, position, sizeof(neighbor));
+            patch.neighbors[f] = neighbor;
+            position += sizeof(neighbor);
+          }
+        for (unsigned int v = 0; v < GeometryInfo<dim>::vertices_per_cell; ++v)
+          for (unsigned int d = 0; d < spacedim; ++d)
+            {
+              std::memcpy(&patch.vertices[v][d], position, sizeof(double));
+              position += sizeof(double);
+            }
+
+        const std::uint64_t n_values =
+          static_cast<std::uint64_t>(fields[4]) * fields[5];
+        AssertThrow(data_offset + n_values <= header.n_data_values,
+                    ExcMessage("The patch table of <" + source_name +
+                               "> refers to values beyond the end of the "
+                               "data section."));
+        patch.data.reinit(fields[4], fields[5]);
+        if (n_values > 0)
+          std::memcpy(&patch.data(0, 0),
+                      data + data_offset * sizeof(float),
+                      n_values * sizeof(float));
+      }
+  }
 } // namespace
 #endif
 
@@ -2405,8 +2853,12 @@ namespace DataOutBase
   }
 
 
-  Hdf5Flags::Hdf5Flags(const CompressionLevel compression_level)
+  Hdf5Flags::Hdf5Flags(const CompressionLevel compression_level,
+                       const unsigned int     n_aggregators_per_node,
+                       const std::size_t      stripe_size)
     : compression_level(compression_level)
+    , n_aggregators_per_node(n_aggregators_per_node)
+    , stripe_size(stripe_size)
   {}
 
 
@@ -2430,13 +2882,25 @@ namespace DataOutBase
                      const bool             print_date_and_time,
                      const CompressionLevel compression_level,
                      const bool             write_higher_order_cells,
-                     const std::map<std::string, std::string> &physical_units)
+                     const std::map<std::string, std::string> &physical_units,
+                     const unsigned int n_aggregators_per_node,
+                     const std::size_t  stripe_size)
     : time(time)
     , cycle(cycle)
     , print_date_and_time(print_date_and_time)
     , compression_level(compression_level)
     , write_higher_order_cells(write_higher_order_cells)
     , physical_units(physical_units)
+    , n_aggregators_per_node(n_aggregators_per_node)
+    , stripe_size(stripe_size)
+  {}
+
+
+
+  LossyCompressionTolerance::LossyCompressionTolerance(const double tolerance,
+                                                       const Type   type)
+    : tolerance(tolerance)
+    , type(type)
   {}
 
 
@@ -2536,6 +3000,222 @@ namespace DataOutBase
   }
 
 
+
+  AsynchronousWrite::AsynchronousWrite(Threads::Task<void>  &&task,
+                                       std::function<void()> &&finalize)
+    : task(std::move(task))
+    , finalize(std::move(finalize))
+  {}
+
+
+
+  AsynchronousWrite &
+  AsynchronousWrite::operator=(AsynchronousWrite &&other)
+  {
+    if (this != &other)
+      {
+        wait();
+        task     = std::move(other.task);
+        finalize = std::move(other.finalize);
+      }
+    return *this;
+  }
+
+
+
+  AsynchronousWrite::~AsynchronousWrite()
+  {
+    if (std::uncaught_exceptions() > 0)
+      {
+        // do not run the finalization, which might involve collective
+        // operations, but make sure that the task does not outlive us
+        if (task.joinable())
+          try
+            {
+              task.join();
+            }
+          catch (...)
+            {}
+      }
+    else
+      wait();
+  }
+
+
+
+  void
+  AsynchronousWrite::wait()
+  {
+    // reset the state first, so that the object does not refer to the
+    // operation any more if the task or the finalization throws
+    const Threads::Task<void>   my_task     = std::move(task);
+    const std::function<void()> my_finalize = std::move(finalize);
+    task     = Threads::Task<void>();
+    finalize = std::function<void()>();
+
+    if (my_task.joinable())
+      my_task.join();
+    if (my_finalize)
+      my_finalize();
+  }
+
+
+
+  bool
+  AsynchronousWrite::is_pending() const
+  {
+    return task.joinable() || finalize;
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::vector<unsigned int>
+  filter_patches(
+    std::vector<Patch<dim, spacedim>>                        &patches,
+    const std::function<bool(const Patch<dim, spacedim> &)> &predicate)
+  {
+    std::vector<unsigned int> kept_patches;
+    std::vector<unsigned int> new_patch_index(
+      patches.size(), Patch<dim, spacedim>::no_neighbor);
+    for (unsigned int i = 0; i < patches.size(); ++i)
+      if (predicate(patches[i]))
+        {
+          new_patch_index[i] = kept_patches.size();
+          kept_patches.push_back(i);
+        }
+
+    if (kept_patches.size() == patches.size())
+      return kept_patches;
+
+    // move the remaining patches to the front, then fix up the indices that
+    // refer to positions in the array
+    for (unsigned int i = 0; i < kept_patches.size(); ++i)
+      if (kept_patches[i] != i)
+        patches[i].swap(patches[kept_patches[i]]);
+    patches.resize(kept_patches.size());
+
+    for (auto &patch : patches)
+      {
+        patch.patch_index = new_patch_index[patch.patch_index];
+        if constexpr (dim > 0)
+          for (unsigned int &neighbor : patch.neighbors)
+            if (neighbor != Patch<dim, spacedim>::no_neighbor)
+              neighbor = new_patch_index[neighbor];
+      }
+
+    return kept_patches;
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::vector<unsigned int>
+  clip_patches(std::vector<Patch<dim, spacedim>> &patches,
+               const BoundingBox<spacedim>       &bounding_box)
+  {
+    return filter_patches<dim, spacedim>(
+      patches, [&bounding_box](const Patch<dim, spacedim> &patch) {
+        std::vector<Point<spacedim>> points;
+        if (patch.points_are_available)
+          for (unsigned int i = 0; i < patch.data.n_cols(); ++i)
+            points.push_back(get_node_location(patch, i));
+        else if constexpr (dim > 0)
+          points.insert(points.end(),
+                        patch.vertices.begin(),
+                        patch.vertices.begin() +
+                          patch.reference_cell.n_vertices());
+        else
+          points.push_back(patch.vertices[0]);
+
+        return BoundingBox<spacedim>(points).get_neighbor_type(
+                 bounding_box) != NeighborType::not_neighbors;
+      });
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  coarsen_patch(Patch<dim, spacedim> &patch, const unsigned int n_subdivisions)
+  {
+    Assert(n_subdivisions >= 1,
+           ExcMessage("The number of subdivisions must be at least one."));
+
+    if constexpr (dim > 0)
+      {
+        if (patch.reference_cell != ReferenceCells::get_hypercube<dim>() ||
+            n_subdivisions >= patch.n_subdivisions)
+          return;
+
+        Assert(patch.n_subdivisions % n_subdivisions == 0,
+               ExcMessage("The new number of subdivisions " +
+                          std::to_string(n_subdivisions) +
+                          " does not divide the number of subdivisions " +
+                          std::to_string(patch.n_subdivisions) +
+                          " of the patch."));
+
+        const unsigned int step  = patch.n_subdivisions / n_subdivisions;
+        const unsigned int n_old = patch.n_subdivisions + 1;
+        const unsigned int n_new = n_subdivisions + 1;
+
+        unsigned int n_new_points = 1;
+        for (unsigned int d = 0; d < dim; ++d)
+          n_new_points *= n_new;
+
+        Table<2, float> new_data(patch.data.n_rows(), n_new_points);
+        for (unsigned int q = 0; q < n_new_points; ++q)
+          {
+            // the points are numbered lexicographically in both patches
+            unsigned int old_q = 0, stride = 1;
+            for (unsigned int d = 0, index = q; d < dim; ++d, index /= n_new)
+              {
+                old_q += (index % n_new) * step * stride;
+                stride *= n_old;
+              }
+
+            for (unsigned int r = 0; r < patch.data.n_rows(); ++r)
+              new_data(r, q) = patch.data(r, old_q);
+          }
+
+        patch.data.swap(new_data);
+        patch.n_subdivisions = n_subdivisions;
+      }
+    else
+      (void)patch;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  reduce_precision(std::vector<Patch<dim, spacedim>> &patches,
+                   const unsigned int                 component,
+                   const unsigned int                 n_mantissa_bits)
+  {
+    // a float has 23 bits of mantissa besides the implicit leading one
+    if (n_mantissa_bits >= std::numeric_limits<float>::digits - 1)
+      return;
+
+    for (auto &patch : patches)
+      {
+        AssertIndexRange(component, patch.data.n_rows());
+        for (unsigned int q = 0; q < patch.data.n_cols(); ++q)
+          {
+            float &value = patch.data(component, q);
+            if (std::isfinite(value) && value != 0.f)
+              {
+                int         exponent;
+                const float mantissa = std::frexp(value, &exponent);
+                value                = std::ldexp(
+                  std::round(std::ldexp(mantissa, n_mantissa_bits + 1)),
+                  exponent - static_cast<int>(n_mantissa_bits) - 1);
+              }
+          }
+      }
+  }
+
+
   //----------------------------------------------------------------------//
 
 
@@ -5989,6 +6669,16 @@ namespace DataOutBase
               }
           } // loop over nodes
 
+        // If requested, round the data before compressing it. Like the
+        // physical units, look up the tolerance for either the name of the
+        // whole vector/tensor, or if that isn't listed, its first component.
+        auto tolerance = flags.lossy_compression_tolerances.find(name);
+        if (tolerance == flags.lossy_compression_tolerances.end())
+          tolerance = flags.lossy_compression_tolerances.find(
+            data_names[first_component]);
+        if (tolerance != flags.lossy_compression_tolerances.end())
+          apply_lossy_compression(data, tolerance->second);
+
         o << vtu_stringize_array(data,
                                  flags.compression_level,
                                  output_precision);
@@ -6016,8 +6706,15 @@ namespace DataOutBase
 
         o << ">\n";
 
-        const std::vector<float> data(data_vectors[data_set].begin(),
-                                      data_vectors[data_set].end());
+        std::vector<float> data(data_vectors[data_set].begin(),
+                                data_vectors[data_set].end());
+
+        // If requested, round the data before compressing it.
+        const auto tolerance =
+          flags.lossy_compression_tolerances.find(data_names[data_set]);
+        if (tolerance != flags.lossy_compression_tolerances.end())
+          apply_lossy_compression(data, tolerance->second);
+
         o << vtu_stringize_array(data,
                                  flags.compression_level,
                                  output_precision);
@@ -7401,9 +8098,10 @@ namespace DataOutBase
   }
 
 
+
   template <int dim, int spacedim>
   void
-  write_deal_II_intermediate_in_parallel(
+  write_deal_II_intermediate_binary(
     const std::vector<Patch<dim, spacedim>> &patches,
     const std::vector<std::string>          &data_names,
     const std::vector<
@@ -7411,11 +8109,116 @@ namespace DataOutBase
                  unsigned int,
                  std::string,
                  DataComponentInterpretation::DataComponentInterpretation>>
-                                    &nonscalar_data_ranges,
-    const Deal_II_IntermediateFlags &flags,
-    const std::string               &filename,
-    const MPI_Comm                   comm,
-    const CompressionLevel           compression)
+      &nonscalar_data_ranges,
+    const Deal_II_IntermediateFlags & /*flags*/,
+    std::ostream &out)
+  {
+    AssertThrow(out.fail() == false, ExcIO());
+
+    // Collect the names section first, as its size determines the offsets
+    // of the following sections
+    std::ostringstream names;
+    const auto write_value = [&names](const std::uint64_t value) {
+      names.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    };
+    write_value(data_names.size());
+    for (const std::string &name : data_names)
+      write_binary_string(names, name);
+    write_value(nonscalar_data_ranges.size());
+    for (const auto &range : nonscalar_data_ranges)
+      {
+        write_value(std::get<0>(range));
+        write_value(std::get<1>(range));
+        write_value(static_cast<std::uint64_t>(std::get<3>(range)));
+        write_binary_string(names, std::get<2>(range));
+      }
+    const std::string names_section = names.str();
+
+    const std::size_t record_size = binary_patch_record_size(dim, spacedim);
+
+    BinaryIntermediateHeader header;
+    header.magic           = binary_intermediate_magic;
+    header.version         = binary_intermediate_version;
+    header.dimension       = dim;
+    header.space_dimension = spacedim;
+    header.n_patches       = patches.size();
+    header.names_offset    = sizeof(header);
+    header.patches_offset  = header.names_offset + names_section.size();
+    header.data_offset = header.patches_offset + patches.size() * record_size;
+    header.n_data_values = 0;
+    for (const auto &patch : patches)
+      header.n_data_values +=
+        static_cast<std::uint64_t>(patch.data.n_rows()) * patch.data.n_cols();
+
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(names_section.data(), names_section.size());
+
+    // Then the table with one record per patch
+    std::vector<char> record(record_size);
+    std::uint64_t     data_offset = 0;
+    for (const auto &patch : patches)
+      {
+        const std::uint32_t fields[6] = {
+          patch.patch_index,
+          patch.n_subdivisions,
+          static_cast<std::uint8_t>(patch.reference_cell),
+          patch.points_are_available,
+          static_cast<std::uint32_t>(patch.data.n_rows()),
+          static_cast<std::uint32_t>(patch.data.n_cols())};
+        std::memcpy(record.data(), &data_offset, sizeof(data_offset));
+        std::memcpy(record.data() + sizeof(data_offset),
+                    fields,
+                    sizeof(fields));
+        char *position = record.data() + sizeof(data_offset) + sizeof(fields);
+        for (unsigned int f = 0; f < GeometryInfo<dim>::faces_per_cell; ++f)
+          {
+            const std::uint32_t neighbor = patch.neighbors[f];
+            std::memcpy(position, &neighbor, sizeof(neighbor));
+            position += sizeof(neighbor);
+          }
+        for (unsigned int v = 0; v < GeometryInfo<dim>::vertices_per_cell; ++v)
+          for (unsigned int d = 0; d < spacedim; ++d)
+            {
+              const double coordinate = patch.vertices[v][d];
+              std::memcpy(position, &coordinate, sizeof(coordinate));
+              position += sizeof(coordinate);
+            }
+        out.write(record.data(), record.size());
+
+        data_offset +=
+          static_cast<std::uint64_t>(patch.data.n_rows()) * patch.data.n_cols();
+      }
+
+    // And finally the data values of all patches, padded to a multiple of
+    // eight bytes
+    for (const auto &patch : patches)
+      if (patch.data.n_elements() > 0)
+        out.write(reinterpret_cast<const char *>(&patch.data(0, 0)),
+                  patch.data.n_elements() * sizeof(float));
+    const char padding[8] = {};
+    out.write(padding, (8 - (header.n_data_values * sizeof(float)) % 8) % 8);
+
+    out.flush();
+    AssertThrow(out.fail() == false, ExcIO());
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  write_deal_II_intermediate_in_parallel(
+    const std::vector<Patch<dim, spacedim>> &patches,
+    const std::vector<std::string>          &data_names,
+    const std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>
+                                    &nonscalar_data_ranges,
+    const Deal_II_IntermediateFlags &flags,
+    const std::string               &filename,
+    const MPI_Comm                   comm,
+    const CompressionLevel           compression)
   {
 #ifndef DEAL_II_WITH_MPI
     (void)patches;
@@ -7571,11 +8374,139 @@ namespace DataOutBase
   {
     AssertThrow(input.fail() == false, ExcIO());
 
+    // files in binary format start with a magic number rather than the
+    // dimensions
+    if (input.peek() == static_cast<int>(binary_intermediate_magic & 0xff))
+      {
+        BinaryIntermediateHeader header;
+        input.read(reinterpret_cast<char *>(&header), sizeof(header));
+        AssertThrow(input.fail() == false &&
+                      header.magic == binary_intermediate_magic,
+                    ExcMessage("Invalid header of binary deal.II "
+                               "intermediate format encountered."));
+        return std::make_pair(static_cast<unsigned int>(header.dimension),
+                              static_cast<unsigned int>(
+                                header.space_dimension));
+      }
+
     unsigned int dim, spacedim;
     input >> dim >> spacedim;
 
     return std::make_pair(dim, spacedim);
   }
+
+
+
+  void
+  merge_deal_II_intermediate_binary(
+    const std::vector<std::string> &input_filenames,
+    const std::string              &output_filename)
+  {
+    AssertThrow(input_filenames.size() > 0,
+                ExcMessage("At least one input file is required."));
+
+    std::vector<std::unique_ptr<MappedFile>> inputs;
+    std::vector<BinaryIntermediateHeader>    headers;
+    for (const std::string &filename : input_filenames)
+      {
+        inputs.emplace_back(std::make_unique<MappedFile>(filename));
+        headers.push_back(read_binary_intermediate_header(
+          inputs.back()->data(), inputs.back()->size(), filename));
+
+        // The inputs need to agree in their dimensions and data sets, which
+        // can be checked by comparing the raw names sections
+        const BinaryIntermediateHeader &first = headers.front();
+        const BinaryIntermediateHeader &last  = headers.back();
+        AssertThrow(last.dimension == first.dimension &&
+                      last.space_dimension == first.space_dimension,
+                    ExcMessage("The file <" + filename +
+                               "> contains patches of other dimensions than <" +
+                               input_filenames[0] + ">."));
+        const std::size_t names_size = last.patches_offset - last.names_offset;
+        AssertThrow(names_size == first.patches_offset - first.names_offset &&
+                      std::memcmp(inputs.back()->data() + last.names_offset,
+                                  inputs.front()->data() + first.names_offset,
+                                  names_size) == 0,
+                    ExcMessage("The file <" + filename +
+                               "> declares other data sets than <" +
+                               input_filenames[0] + ">."));
+      }
+
+    const unsigned int dim         = headers[0].dimension;
+    const std::size_t  record_size = binary_patch_record_size(
+      headers[0].dimension, headers[0].space_dimension);
+    const std::size_t names_size =
+      headers[0].patches_offset - headers[0].names_offset;
+
+    BinaryIntermediateHeader header = headers[0];
+    header.n_patches                = 0;
+    header.n_data_values            = 0;
+    for (const BinaryIntermediateHeader &h : headers)
+      {
+        header.n_patches += h.n_patches;
+        header.n_data_values += h.n_data_values;
+      }
+    header.names_offset   = sizeof(header);
+    header.patches_offset = header.names_offset + names_size;
+    header.data_offset = header.patches_offset + header.n_patches * record_size;
+
+    std::ofstream out(output_filename, std::ios::binary);
+    AssertThrow(out.good(), ExcFileNotOpen(output_filename));
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(inputs[0]->data() + headers[0].names_offset, names_size);
+
+    // Copy the patch tables, shifting patch indices, neighbors and the
+    // offsets into the data section by what the previous files contributed
+    std::vector<char> record(record_size);
+    std::uint32_t     patch_shift = 0;
+    std::uint64_t     data_shift  = 0;
+    for (unsigned int i = 0; i < inputs.size(); ++i)
+      {
+        for (std::uint64_t p = 0; p < headers[i].n_patches; ++p)
+          {
+            std::memcpy(record.data(),
+                        inputs[i]->data() + headers[i].patches_offset +
+                          p * record_size,
+                        record_size);
+
+            std::uint64_t data_offset;
+            std::memcpy(&data_offset, record.data(), sizeof(data_offset));
+            data_offset += data_shift;
+            std::memcpy(record.data(), &data_offset, sizeof(data_offset));
+
+            char         *position = record.data() + sizeof(data_offset);
+            std::uint32_t patch_index;
+            std::memcpy(&patch_index, position, sizeof(patch_index));
+            patch_index += patch_shift;
+            std::memcpy(position, &patch_index, sizeof(patch_index));
+
+            position += 6 * sizeof(std::uint32_t);
+            for (unsigned int f = 0; f < 2 * dim; ++f)
+              {
+                std::uint32_t neighbor;
+                std::memcpy(&neighbor, position, sizeof(neighbor));
+                if (neighbor != numbers::invalid_unsigned_int)
+                  neighbor += patch_shift;
+                std::memcpy(position, &neighbor, sizeof(neighbor));
+                position += sizeof(neighbor);
+              }
+
+            out.write(record.data(), record.size());
+          }
+        patch_shift += headers[i].n_patches;
+        data_shift += headers[i].n_data_values;
+      }
+
+    // The data sections can simply be concatenated
+    for (unsigned int i = 0; i < inputs.size(); ++i)
+      out.write(inputs[i]->data() + headers[i].data_offset,
+                headers[i].n_data_values * sizeof(float));
+    const char padding[8] = {};
+    out.write(padding, (8 - (header.n_data_values * sizeof(float)) % 8) % 8);
+
+    out.close();
+    AssertThrow(out.good(), ExcIO());
+  }
 } // namespace DataOutBase
 
 
@@ -7716,6 +8647,359 @@ DataOutInterface<dim, spacedim>::write_svg(std::ostream &out) const
 }
 
 
+namespace internal
+{
+  namespace DataOutBaseImplementation
+  {
+    /**
+     * The parts of a .vtu file that one process contributes when the file is
+     * written in parallel: the header is only written by the first process,
+     * the footer only by the last one.
+     */
+    struct VtuPiece
+    {
+      std::string header;
+      std::string data;
+      std::string footer;
+    };
+
+
+
+    /**
+     * Encode the part of a .vtu file written by one process into a VtuPiece.
+     * This function does not communicate and can therefore run on a
+     * background task.
+     */
+    template <int dim, int spacedim>
+    VtuPiece
+    encode_vtu_piece(
+      const std::vector<DataOutBase::Patch<dim, spacedim>> &patches,
+      const std::vector<std::string>                       &data_names,
+      const std::vector<
+        std::tuple<unsigned int,
+                   unsigned int,
+                   std::string,
+                   DataComponentInterpretation::DataComponentInterpretation>>
+                                  &nonscalar_data_ranges,
+      const DataOutBase::VtkFlags &flags,
+      const bool                   write_header,
+      const bool                   write_data,
+      const bool                   write_footer)
+    {
+      VtuPiece piece;
+      if (write_header)
+        {
+          std::stringstream ss;
+          DataOutBase::write_vtu_header(ss, flags);
+          piece.header = ss.str();
+        }
+
+      // Do not write pieces with 0 cells as this will crash paraview if this
+      // is the first piece written, see the caller.
+      if (write_data)
+        {
+          std::stringstream ss;
+          DataOutBase::write_vtu_main(
+            patches, data_names, nonscalar_data_ranges, flags, ss);
+          piece.data = ss.str();
+        }
+
+      if (write_footer)
+        {
+          std::stringstream ss;
+          DataOutBase::write_vtu_footer(ss);
+          piece.footer = ss.str();
+        }
+      return piece;
+    }
+
+
+
+#ifdef DEAL_II_WITH_MPI
+    /**
+     * Write the pieces of all processes in @p comm into the file @p filename,
+     * letting only @p n_aggregators_per_node ranks per shared-memory node
+     * access the file. The other ranks send their piece to the first rank of
+     * their group, which writes the concatenated block with MPI I/O. If
+     * @p stripe_size is nonzero, all blocks but the last one are padded with
+     * whitespace to a multiple of it.
+     */
+    void
+    write_vtu_pieces_aggregated(const std::string &filename,
+                                const MPI_Comm     comm,
+                                const VtuPiece    &piece,
+                                const unsigned int n_aggregators_per_node,
+                                const std::size_t  stripe_size)
+    {
+      const unsigned int myrank  = Utilities::MPI::this_mpi_process(comm);
+      const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
+
+      // Split the ranks of each node into groups of consecutive ranks. As
+      // the ranks keep their relative order, the first group on the node of
+      // rank 0 starts with rank 0 and the last rank is the last member of
+      // its group.
+      MPI_Comm node_comm;
+      int      ierr = MPI_Comm_split_type(
+        comm, MPI_COMM_TYPE_SHARED, myrank, MPI_INFO_NULL, &node_comm);
+      AssertThrowMPI(ierr);
+      const unsigned int node_rank =
+        Utilities::MPI::this_mpi_process(node_comm);
+      const unsigned int node_size =
+        Utilities::MPI::n_mpi_processes(node_comm);
+      const unsigned int n_groups = std::min(n_aggregators_per_node, node_size);
+      const unsigned int group    = static_cast<unsigned int>(
+        (static_cast<std::uint64_t>(node_rank) * n_groups) / node_size);
+
+      MPI_Comm group_comm;
+      ierr = MPI_Comm_split(node_comm, group, node_rank, &group_comm);
+      AssertThrowMPI(ierr);
+      Utilities::MPI::free_communicator(node_comm);
+      const unsigned int group_rank =
+        Utilities::MPI::this_mpi_process(group_comm);
+      const unsigned int group_size =
+        Utilities::MPI::n_mpi_processes(group_comm);
+
+      // Only rank 0 has a header and only the last rank has a footer, so
+      // the contribution of each rank can simply be concatenated.
+      std::string        joined_piece;
+      const std::string *my_data = &piece.data;
+      if (!piece.header.empty() || !piece.footer.empty())
+        {
+          joined_piece = piece.header + piece.data + piece.footer;
+          my_data      = &joined_piece;
+        }
+
+      const std::uint64_t        my_size = my_data->size();
+      std::vector<std::uint64_t> sizes(group_rank == 0 ? group_size : 0);
+      ierr = MPI_Gather(&my_size,
+                        1,
+                        MPI_UINT64_T,
+                        static_cast<std::uint64_t *>(sizes.data()),
+                        1,
+                        MPI_UINT64_T,
+                        0,
+                        group_comm);
+      AssertThrowMPI(ierr);
+
+      // The block containing the last rank must be written last, all other
+      // blocks are ordered by the rank of their aggregator.
+      const unsigned int last_rank_in_group =
+        Utilities::MPI::max(myrank, group_comm);
+
+      const int tag = Utilities::MPI::internal::Tags::
+        data_out_aggregate_vtu_pieces;
+      std::string block;
+      if (group_rank == 0)
+        {
+          std::uint64_t total_size = 0;
+          for (const std::uint64_t size : sizes)
+            total_size += size;
+          std::uint64_t padded_size = total_size;
+          if (stripe_size > 0 && last_rank_in_group != n_ranks - 1)
+            padded_size =
+              (total_size + stripe_size - 1) / stripe_size * stripe_size;
+          block.resize(padded_size, ' ');
+
+          std::copy(my_data->begin(), my_data->end(), block.begin());
+          std::uint64_t offset = my_size;
+          for (unsigned int i = 1; i < group_size; ++i)
+            {
+              ierr = Utilities::MPI::LargeCount::Recv_c(block.data() + offset,
+                                                        sizes[i],
+                                                        MPI_CHAR,
+                                                        i,
+                                                        tag,
+                                                        group_comm,
+                                                        MPI_STATUS_IGNORE);
+              AssertThrowMPI(ierr);
+              offset += sizes[i];
+            }
+        }
+      else
+        {
+          ierr = Utilities::MPI::LargeCount::Send_c(
+            my_data->data(), my_size, MPI_CHAR, 0, tag, group_comm);
+          AssertThrowMPI(ierr);
+        }
+      Utilities::MPI::free_communicator(group_comm);
+
+      MPI_Comm aggregator_comm;
+      ierr = MPI_Comm_split(comm,
+                            group_rank == 0 ? 0 : MPI_UNDEFINED,
+                            last_rank_in_group == n_ranks - 1 ? n_ranks :
+                                                                myrank,
+                            &aggregator_comm);
+      AssertThrowMPI(ierr);
+      if (group_rank != 0)
+        return;
+
+      MPI_Info info;
+      ierr = MPI_Info_create(&info);
+      AssertThrowMPI(ierr);
+      if (stripe_size > 0)
+        {
+          ierr = MPI_Info_set(info,
+                              "striping_unit",
+                              std::to_string(stripe_size).c_str());
+          AssertThrowMPI(ierr);
+        }
+      MPI_File fh;
+      ierr = MPI_File_open(aggregator_comm,
+                           filename.c_str(),
+                           MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                           info,
+                           &fh);
+      AssertThrow(ierr == MPI_SUCCESS, ExcFileNotOpen(filename));
+      ierr = MPI_Info_free(&info);
+      AssertThrowMPI(ierr);
+
+      ierr = MPI_File_set_size(fh, 0); // delete the file contents
+      AssertThrowMPI(ierr);
+      ierr = MPI_Barrier(aggregator_comm);
+      AssertThrowMPI(ierr);
+
+      const std::uint64_t block_size = block.size();
+      std::uint64_t       prefix_sum = 0;
+      ierr                           = MPI_Exscan(
+        &block_size, &prefix_sum, 1, MPI_UINT64_T, MPI_SUM, aggregator_comm);
+      AssertThrowMPI(ierr);
+      // MPI_Exscan leaves the result on the first rank undefined
+      if (Utilities::MPI::this_mpi_process(aggregator_comm) == 0)
+        prefix_sum = 0;
+
+      ierr = Utilities::MPI::LargeCount::File_write_at_all_c(
+        fh,
+        static_cast<MPI_Offset>(prefix_sum),
+        block.data(),
+        block.size(),
+        MPI_CHAR,
+        MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      // See write_vtu_pieces_in_parallel() for the reason of the sync.
+      ierr = MPI_File_sync(fh);
+      AssertThrowMPI(ierr);
+      ierr = MPI_File_close(&fh);
+      AssertThrowMPI(ierr);
+      Utilities::MPI::free_communicator(aggregator_comm);
+    }
+
+
+
+    /**
+     * Collectively write the pieces of all processes in @p comm into the
+     * file @p filename with MPI I/O. If @p n_aggregators_per_node is
+     * positive, the work is delegated to write_vtu_pieces_aggregated().
+     */
+    void
+    write_vtu_pieces_in_parallel(const std::string &filename,
+                                 const MPI_Comm     comm,
+                                 const VtuPiece    &piece,
+                                 const unsigned int n_aggregators_per_node = 0,
+                                 const std::size_t  stripe_size            = 0)
+    {
+      if (n_aggregators_per_node > 0)
+        {
+          write_vtu_pieces_aggregated(
+            filename, comm, piece, n_aggregators_per_node, stripe_size);
+          return;
+        }
+
+      const unsigned int myrank  = Utilities::MPI::this_mpi_process(comm);
+      const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
+      MPI_Info           info;
+      int                ierr = MPI_Info_create(&info);
+      AssertThrowMPI(ierr);
+      MPI_File fh;
+      ierr = MPI_File_open(
+        comm, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, info, &fh);
+      AssertThrow(ierr == MPI_SUCCESS, ExcFileNotOpen(filename));
+
+      ierr = MPI_File_set_size(fh, 0); // delete the file contents
+      AssertThrowMPI(ierr);
+      // this barrier is necessary, because otherwise others might already write
+      // while one core is still setting the size to zero.
+      ierr = MPI_Barrier(comm);
+      AssertThrowMPI(ierr);
+      ierr = MPI_Info_free(&info);
+      AssertThrowMPI(ierr);
+
+      // Define header size so we can broadcast later.
+      unsigned int header_size;
+
+      // write header
+      if (myrank == 0)
+        {
+          header_size = piece.header.size();
+          // Write the header on rank 0 at the start of a file, i.e., offset 0.
+          ierr =
+            Utilities::MPI::LargeCount::File_write_at_c(fh,
+                                                        0,
+                                                        piece.header.c_str(),
+                                                        header_size,
+                                                        MPI_CHAR,
+                                                        MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+
+      ierr = MPI_Bcast(&header_size, 1, MPI_UNSIGNED, 0, comm);
+      AssertThrowMPI(ierr);
+
+      {
+        // Use prefix sum to find specific offset to write at.
+        const std::uint64_t size_on_proc = piece.data.size();
+        std::uint64_t       prefix_sum   = 0;
+        ierr = MPI_Exscan(
+          &size_on_proc, &prefix_sum, 1, MPI_UINT64_T, MPI_SUM, comm);
+        AssertThrowMPI(ierr);
+
+        // Locate specific offset for each processor.
+        const MPI_Offset offset =
+          static_cast<MPI_Offset>(header_size) + prefix_sum;
+
+        ierr =
+          Utilities::MPI::LargeCount::File_write_at_all_c(fh,
+                                                          offset,
+                                                          piece.data.c_str(),
+                                                          piece.data.size(),
+                                                          MPI_CHAR,
+                                                          MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+
+        if (myrank == n_ranks - 1)
+          {
+            // Locating Footer with offset on last rank.
+            const std::uint64_t footer_offset = size_on_proc + offset;
+
+            // Writing footer:
+            ierr =
+              Utilities::MPI::LargeCount::File_write_at_c(fh,
+                                                          footer_offset,
+                                                          piece.footer.c_str(),
+                                                          piece.footer.size(),
+                                                          MPI_CHAR,
+                                                          MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+          }
+      }
+
+      // Make sure we sync to disk. As written in the standard,
+      // MPI_File_close() actually already implies a sync but there seems
+      // to be a bug on at least one configuration (running with multiple
+      // nodes using OpenMPI 4.1) that requires it. Without this call, the
+      // footer is sometimes missing.
+      ierr = MPI_File_sync(fh);
+      AssertThrowMPI(ierr);
+
+      ierr = MPI_File_close(&fh);
+      AssertThrowMPI(ierr);
+    }
+#endif
+  } // namespace DataOutBaseImplementation
+} // namespace internal
+
+
+
 template <int dim, int spacedim>
 void
 DataOutInterface<dim, spacedim>::write_vtu_in_parallel(
@@ -7733,108 +9017,144 @@ DataOutInterface<dim, spacedim>::write_vtu_in_parallel(
 
   const unsigned int myrank  = Utilities::MPI::this_mpi_process(comm);
   const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
-  MPI_Info           info;
-  int                ierr = MPI_Info_create(&info);
-  AssertThrowMPI(ierr);
-  MPI_File fh;
-  ierr = MPI_File_open(
-    comm, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, info, &fh);
-  AssertThrow(ierr == MPI_SUCCESS, ExcFileNotOpen(filename));
-
-  ierr = MPI_File_set_size(fh, 0); // delete the file contents
-  AssertThrowMPI(ierr);
-  // this barrier is necessary, because otherwise others might already write
-  // while one core is still setting the size to zero.
-  ierr = MPI_Barrier(comm);
-  AssertThrowMPI(ierr);
-  ierr = MPI_Info_free(&info);
-  AssertThrowMPI(ierr);
-
-  // Define header size so we can broadcast later.
-  unsigned int  header_size;
-  std::uint64_t footer_offset;
 
-  // write header
-  if (myrank == 0)
-    {
-      std::stringstream ss;
-      DataOutBase::write_vtu_header(ss, vtk_flags);
-      header_size = ss.str().size();
-      // Write the header on rank 0 at the start of a file, i.e., offset 0.
-      ierr = Utilities::MPI::LargeCount::File_write_at_c(
-        fh, 0, ss.str().c_str(), header_size, MPI_CHAR, MPI_STATUS_IGNORE);
-      AssertThrowMPI(ierr);
-    }
+  const auto                   &patches      = get_patches();
+  const types::global_dof_index my_n_patches = patches.size();
+  const types::global_dof_index global_n_patches =
+    Utilities::MPI::sum(my_n_patches, comm);
+
+  // Do not write pieces with 0 cells as this will crash paraview if this is
+  // the first piece written. But if nobody has any pieces to write (file is
+  // empty), let processor 0 write their empty data, otherwise the vtk file is
+  // invalid.
+  const bool write_data =
+    my_n_patches > 0 || (global_n_patches == 0 && myrank == 0);
+
+  const internal::DataOutBaseImplementation::VtuPiece piece =
+    internal::DataOutBaseImplementation::encode_vtu_piece(
+      patches,
+      get_dataset_names(),
+      get_nonscalar_data_ranges(),
+      vtk_flags,
+      myrank == 0,
+      write_data,
+      myrank == n_ranks - 1);
+
+  internal::DataOutBaseImplementation::write_vtu_pieces_in_parallel(
+    filename,
+    comm,
+    piece,
+    vtk_flags.n_aggregators_per_node,
+    vtk_flags.stripe_size);
+#endif
+}
 
-  ierr = MPI_Bcast(&header_size, 1, MPI_UNSIGNED, 0, comm);
-  AssertThrowMPI(ierr);
 
-  {
-    const auto                   &patches      = get_patches();
-    const types::global_dof_index my_n_patches = patches.size();
-    const types::global_dof_index global_n_patches =
-      Utilities::MPI::sum(my_n_patches, comm);
-
-    // Do not write pieces with 0 cells as this will crash paraview if this is
-    // the first piece written. But if nobody has any pieces to write (file is
-    // empty), let processor 0 write their empty data, otherwise the vtk file is
-    // invalid.
-    std::stringstream ss;
-    if (my_n_patches > 0 || (global_n_patches == 0 && myrank == 0))
-      DataOutBase::write_vtu_main(patches,
-                                  get_dataset_names(),
-                                  get_nonscalar_data_ranges(),
-                                  vtk_flags,
-                                  ss);
-
-    // Use prefix sum to find specific offset to write at.
-    const std::uint64_t size_on_proc = ss.str().size();
-    std::uint64_t       prefix_sum   = 0;
-    ierr =
-      MPI_Exscan(&size_on_proc, &prefix_sum, 1, MPI_UINT64_T, MPI_SUM, comm);
-    AssertThrowMPI(ierr);
 
-    // Locate specific offset for each processor.
-    const MPI_Offset offset = static_cast<MPI_Offset>(header_size) + prefix_sum;
+template <int dim, int spacedim>
+DataOutBase::AsynchronousWrite
+DataOutInterface<dim, spacedim>::write_vtu_in_parallel_async(
+  const std::string &filename,
+  const MPI_Comm     comm) const
+{
+  // Copy everything the background task needs, so that this object can be
+  // changed while the task is running. The task is in charge of the
+  // expensive part of the output, namely encoding and compressing the data.
+  auto patches =
+    std::make_shared<std::vector<DataOutBase::Patch<dim, spacedim>>>(
+      get_patches());
+  auto data_names =
+    std::make_shared<std::vector<std::string>>(get_dataset_names());
+  auto nonscalar_data_ranges = std::make_shared<std::vector<
+    std::tuple<unsigned int,
+               unsigned int,
+               std::string,
+               DataComponentInterpretation::DataComponentInterpretation>>>(
+    get_nonscalar_data_ranges());
+  const DataOutBase::VtkFlags flags = vtk_flags;
 
-    ierr = Utilities::MPI::LargeCount::File_write_at_all_c(fh,
-                                                           offset,
-                                                           ss.str().c_str(),
-                                                           ss.str().size(),
-                                                           MPI_CHAR,
-                                                           MPI_STATUS_IGNORE);
-    AssertThrowMPI(ierr);
+#ifndef DEAL_II_WITH_MPI
+  // without MPI, the task also writes the file
+  (void)comm;
+  return DataOutBase::AsynchronousWrite(
+    Threads::new_task(
+      [filename, patches, data_names, nonscalar_data_ranges, flags]() {
+        std::ofstream f(filename);
+        AssertThrow(f, ExcFileNotOpen(filename));
+        DataOutBase::write_vtu(
+          *patches, *data_names, *nonscalar_data_ranges, flags, f);
+      }),
+    std::function<void()>());
+#else
+  const unsigned int myrank  = Utilities::MPI::this_mpi_process(comm);
+  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
 
-    if (myrank == n_ranks - 1)
-      {
-        // Locating Footer with offset on last rank.
-        footer_offset = size_on_proc + offset;
-
-        std::stringstream ss;
-        DataOutBase::write_vtu_footer(ss);
-        const unsigned int footer_size = ss.str().size();
-
-        // Writing footer:
-        ierr = Utilities::MPI::LargeCount::File_write_at_c(fh,
-                                                           footer_offset,
-                                                           ss.str().c_str(),
-                                                           footer_size,
-                                                           MPI_CHAR,
-                                                           MPI_STATUS_IGNORE);
-        AssertThrowMPI(ierr);
-      }
-  }
+  const types::global_dof_index my_n_patches = patches->size();
+  const types::global_dof_index global_n_patches =
+    Utilities::MPI::sum(my_n_patches, comm);
+  const bool write_data =
+    my_n_patches > 0 || (global_n_patches == 0 && myrank == 0);
+
+  auto piece =
+    std::make_shared<internal::DataOutBaseImplementation::VtuPiece>();
+  const auto encode = [piece,
+                       patches,
+                       data_names,
+                       nonscalar_data_ranges,
+                       flags,
+                       myrank,
+                       n_ranks,
+                       write_data]() {
+    *piece = internal::DataOutBaseImplementation::encode_vtu_piece(
+      *patches,
+      *data_names,
+      *nonscalar_data_ranges,
+      flags,
+      myrank == 0,
+      write_data,
+      myrank == n_ranks - 1);
+
+    // release the memory of the copied patches as soon as possible
+    patches->clear();
+    patches->shrink_to_fit();
+  };
 
-  // Make sure we sync to disk. As written in the standard,
-  // MPI_File_close() actually already implies a sync but there seems
-  // to be a bug on at least one configuration (running with multiple
-  // nodes using OpenMPI 4.1) that requires it. Without this call, the
-  // footer is sometimes missing.
-  ierr = MPI_File_sync(fh);
+  // The collective MPI I/O can only run on the task if MPI allows several
+  // threads to communicate at the same time. Otherwise, it is deferred to
+  // the call of AsynchronousWrite::wait() on the calling thread.
+  int       provided_thread_level;
+  const int ierr = MPI_Query_thread(&provided_thread_level);
   AssertThrowMPI(ierr);
 
-  ierr = MPI_File_close(&fh);
-  AssertThrowMPI(ierr);
+  if (provided_thread_level == MPI_THREAD_MULTIPLE)
+    {
+      // the task communicates on a communicator of its own, so that its
+      // messages can not be mixed up with the ones of the caller
+      auto task_comm = std::make_shared<MPI_Comm>(
+        Utilities::MPI::duplicate_communicator(comm));
+      return DataOutBase::AsynchronousWrite(
+        Threads::new_task([encode, piece, filename, task_comm, flags]() {
+          encode();
+          internal::DataOutBaseImplementation::write_vtu_pieces_in_parallel(
+            filename,
+            *task_comm,
+            *piece,
+            flags.n_aggregators_per_node,
+            flags.stripe_size);
+          Utilities::MPI::free_communicator(*task_comm);
+        }),
+        std::function<void()>());
+    }
+  else
+    return DataOutBase::AsynchronousWrite(
+      Threads::new_task(encode), [piece, filename, comm, flags]() {
+        internal::DataOutBaseImplementation::write_vtu_pieces_in_parallel(
+          filename,
+          comm,
+          *piece,
+          flags.n_aggregators_per_node,
+          flags.stripe_size);
+      });
 #endif
 }
 
@@ -7950,6 +9270,20 @@ DataOutInterface<dim, spacedim>::write_deal_II_intermediate(
 
 
 
+template <int dim, int spacedim>
+void
+DataOutInterface<dim, spacedim>::write_deal_II_intermediate_binary(
+  std::ostream &out) const
+{
+  DataOutBase::write_deal_II_intermediate_binary(get_patches(),
+                                                 get_dataset_names(),
+                                                 get_nonscalar_data_ranges(),
+                                                 deal_II_intermediate_flags,
+                                                 out);
+}
+
+
+
 template <int dim, int spacedim>
 void
 DataOutInterface<dim, spacedim>::write_deal_II_intermediate_in_parallel(
@@ -7983,6 +9317,29 @@ DataOutInterface<dim, spacedim>::create_xdmf_entry(
 
 
 
+template <int dim, int spacedim>
+XDMFEntry
+DataOutInterface<dim, spacedim>::create_xdmf_entry(
+  const DataOutBase::DataOutFilter &data_filter,
+  const std::string                &h5_filename,
+  const unsigned int                mesh_time_step,
+  const unsigned int                time_step,
+  const double                      cur_time,
+  const MPI_Comm                    comm) const
+{
+  Assert(mesh_time_step <= time_step,
+         ExcMessage("The mesh needs to be written before the step that "
+                    "refers to it."));
+
+  XDMFEntry entry =
+    create_xdmf_entry(data_filter, h5_filename, h5_filename, cur_time, comm);
+  entry.set_hdf5_groups("mesh_" + std::to_string(mesh_time_step),
+                        "step_" + std::to_string(time_step));
+  return entry;
+}
+
+
+
 template <int dim, int spacedim>
 XDMFEntry
 DataOutInterface<dim, spacedim>::create_xdmf_entry(
@@ -8122,6 +9479,29 @@ DataOutInterface<dim, spacedim>::create_xdmf_entry(
 #endif
 }
 
+namespace
+{
+  /**
+   * The lines of an XDMF file written before the entries.
+   */
+  const std::string xdmf_file_header =
+    "<?xml version=\"1.0\" ?>\n"
+    "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+    "<Xdmf Version=\"2.0\">\n"
+    "  <Domain>\n"
+    "    <Grid Name=\"CellTime\" GridType=\"Collection\" "
+    "CollectionType=\"Temporal\">\n";
+
+  /**
+   * The lines of an XDMF file written after the entries.
+   */
+  const std::string xdmf_file_footer = "    </Grid>\n"
+                                       "  </Domain>\n"
+                                       "</Xdmf>\n";
+} // namespace
+
+
+
 template <int dim, int spacedim>
 void
 DataOutInterface<dim, spacedim>::write_xdmf_file(
@@ -8141,21 +9521,14 @@ DataOutInterface<dim, spacedim>::write_xdmf_file(
     {
       std::ofstream xdmf_file(filename);
 
-      xdmf_file << "<?xml version=\"1.0\" ?>\n";
-      xdmf_file << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n";
-      xdmf_file << "<Xdmf Version=\"2.0\">\n";
-      xdmf_file << "  <Domain>\n";
-      xdmf_file
-        << "    <Grid Name=\"CellTime\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+      xdmf_file << xdmf_file_header;
 
       for (const auto &entry : entries)
         {
           xdmf_file << entry.get_xdmf_content(3);
         }
 
-      xdmf_file << "    </Grid>\n";
-      xdmf_file << "  </Domain>\n";
-      xdmf_file << "</Xdmf>\n";
+      xdmf_file << xdmf_file_footer;
 
       xdmf_file.close();
     }
@@ -8163,6 +9536,60 @@ DataOutInterface<dim, spacedim>::write_xdmf_file(
 
 
 
+template <int dim, int spacedim>
+void
+DataOutInterface<dim, spacedim>::append_xdmf_entry(
+  const XDMFEntry   &entry,
+  const std::string &filename,
+  const MPI_Comm     comm) const
+{
+#ifdef DEAL_II_WITH_MPI
+  const int myrank = Utilities::MPI::this_mpi_process(comm);
+#else
+  (void)comm;
+  const int myrank = 0;
+#endif
+
+  // Only rank 0 process writes the XDMF file
+  if (myrank == 0)
+    {
+      std::fstream xdmf_file(filename,
+                             std::ios::in | std::ios::out | std::ios::binary);
+
+      // Start a new file if there is none yet
+      if (!xdmf_file.is_open())
+        {
+          std::ofstream new_xdmf_file(filename);
+          new_xdmf_file << xdmf_file_header << entry.get_xdmf_content(3)
+                        << xdmf_file_footer;
+          AssertThrow(new_xdmf_file.good(), ExcIO());
+          return;
+        }
+
+      // Otherwise, check that the file ends with the closing tags we write
+      // and overwrite them with the new entry, followed by the closing tags
+      xdmf_file.seekg(0, std::ios::end);
+      const std::streamoff file_size   = xdmf_file.tellg();
+      const std::streamoff footer_size = xdmf_file_footer.size();
+      AssertThrow(file_size >= footer_size,
+                  ExcMessage("The file <" + filename +
+                             "> is not an XDMF file written by deal.II."));
+
+      std::string file_end(footer_size, ' ');
+      xdmf_file.seekg(file_size - footer_size);
+      xdmf_file.read(file_end.data(), footer_size);
+      AssertThrow(file_end == xdmf_file_footer,
+                  ExcMessage("The file <" + filename +
+                             "> is not an XDMF file written by deal.II."));
+
+      xdmf_file.seekp(file_size - footer_size);
+      xdmf_file << entry.get_xdmf_content(3) << xdmf_file_footer;
+      AssertThrow(xdmf_file.good(), ExcIO());
+    }
+}
+
+
+
 /*
  * Write the data in this DataOutInterface to a DataOutFilter object. Filtering
  * is performed based on the DataOutFilter flags.
@@ -8193,7 +9620,8 @@ namespace
                 const bool                        write_mesh_file,
                 const std::string                &mesh_filename,
                 const std::string                &solution_filename,
-                const MPI_Comm                    comm)
+                const MPI_Comm                    comm,
+                const unsigned int time_step = numbers::invalid_unsigned_int)
   {
     hid_t h5_mesh_file_id = -1, h5_solution_file_id, file_plist_id, plist_id;
     hid_t node_dataspace, node_dataset, node_file_dataspace,
@@ -8220,10 +9648,49 @@ namespace
 #  ifdef DEAL_II_WITH_MPI
 #    ifdef H5_HAVE_PARALLEL
     // Set the access to use the specified MPI_Comm object
-    status = H5Pset_fapl_mpio(file_plist_id, comm, MPI_INFO_NULL);
-    AssertThrow(status >= 0, ExcIO());
+    {
+      // Pass the aggregation and striping settings to the MPI-IO layer as
+      // hints for its two-phase collective buffering
+      MPI_Info info = MPI_INFO_NULL;
+      if (flags.n_aggregators_per_node > 0 || flags.stripe_size > 0)
+        {
+          int ierr = MPI_Info_create(&info);
+          AssertThrowMPI(ierr);
+          if (flags.n_aggregators_per_node > 0)
+            {
+              const std::string config_list =
+                "*:" + std::to_string(flags.n_aggregators_per_node);
+              ierr = MPI_Info_set(info, "cb_config_list", config_list.c_str());
+              AssertThrowMPI(ierr);
+              ierr = MPI_Info_set(info, "romio_cb_write", "enable");
+              AssertThrowMPI(ierr);
+            }
+          if (flags.stripe_size > 0)
+            {
+              ierr = MPI_Info_set(info,
+                                  "striping_unit",
+                                  std::to_string(flags.stripe_size).c_str());
+              AssertThrowMPI(ierr);
+            }
+        }
+      status = H5Pset_fapl_mpio(file_plist_id, comm, info);
+      AssertThrow(status >= 0, ExcIO());
+      // HDF5 duplicates the info object, so we can release ours
+      if (info != MPI_INFO_NULL)
+        {
+          const int ierr = MPI_Info_free(&info);
+          AssertThrowMPI(ierr);
+        }
+    }
 #    endif
 #  endif
+    if (flags.stripe_size > 0)
+      {
+        status = H5Pset_alignment(file_plist_id,
+                                  flags.stripe_size,
+                                  flags.stripe_size);
+        AssertThrow(status >= 0, ExcIO());
+      }
     // if zlib support is disabled flags are unused
 #  ifndef DEAL_II_WITH_ZLIB
     (void)flags;
@@ -8256,6 +9723,44 @@ namespace
     global_node_cell_offsets[0] = global_node_cell_offsets[1] = 0;
 #  endif
 
+    // Files are created and existing files overwritten (change this to an
+    // option?), except when a step is appended to a time series, in which
+    // case the mesh and the solution of the step are put into their own
+    // groups of the file.
+    const bool is_time_series = (time_step != numbers::invalid_unsigned_int);
+
+    const auto open_file = [&](const std::string &filename) {
+      hid_t file_id;
+      if (is_time_series && time_step > 0)
+        file_id = H5Fopen(filename.c_str(), H5F_ACC_RDWR, file_plist_id);
+      else
+        file_id = H5Fcreate(filename.c_str(),
+                            H5F_ACC_TRUNC,
+                            H5P_DEFAULT,
+                            file_plist_id);
+      AssertThrow(file_id >= 0, ExcIO());
+      return file_id;
+    };
+    const auto create_group = [&](const hid_t        file_id,
+                                  const std::string &group_name) {
+      if (group_name.empty())
+        return std::string();
+#  if H5Gcreate_vers == 1
+      const hid_t group_id = H5Gcreate(file_id, group_name.c_str(), 0);
+#  else
+      const hid_t group_id = H5Gcreate(
+        file_id, group_name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+#  endif
+      AssertThrow(group_id >= 0, ExcIO());
+      const herr_t status = H5Gclose(group_id);
+      AssertThrow(status >= 0, ExcIO());
+      return group_name + "/";
+    };
+    const std::string mesh_group =
+      is_time_series ? "mesh_" + std::to_string(time_step) : "";
+    const std::string solution_group =
+      is_time_series ? "step_" + std::to_string(time_step) : "";
+
     // Create the property list for a collective write
     plist_id = H5Pcreate(H5P_DATASET_XFER);
     AssertThrow(plist_id >= 0, ExcIO());
@@ -8268,12 +9773,9 @@ namespace
 
     if (write_mesh_file)
       {
-        // Overwrite any existing files (change this to an option?)
-        h5_mesh_file_id = H5Fcreate(mesh_filename.c_str(),
-                                    H5F_ACC_TRUNC,
-                                    H5P_DEFAULT,
-                                    file_plist_id);
-        AssertThrow(h5_mesh_file_id >= 0, ExcIO());
+        h5_mesh_file_id = open_file(mesh_filename);
+        const std::string mesh_prefix =
+          create_group(h5_mesh_file_id, mesh_group);
 
         // Create the dataspace for the nodes and cells. HDF5 only supports 2-
         // or 3-dimensional coordinates
@@ -8290,7 +9792,7 @@ namespace
         // Create the dataset for the nodes and cells
 #  if H5Gcreate_vers == 1
         node_dataset = H5Dcreate(h5_mesh_file_id,
-                                 "nodes",
+                                 (mesh_prefix + "nodes").c_str(),
                                  H5T_NATIVE_DOUBLE,
                                  node_dataspace,
                                  H5P_DEFAULT);
@@ -8302,7 +9804,7 @@ namespace
         H5Pset_chunk(node_dataset_id, 2, node_ds_dim);
 #    endif
         node_dataset = H5Dcreate(h5_mesh_file_id,
-                                 "nodes",
+                                 (mesh_prefix + "nodes").c_str(),
                                  H5T_NATIVE_DOUBLE,
                                  node_dataspace,
                                  H5P_DEFAULT,
@@ -8313,7 +9815,7 @@ namespace
         AssertThrow(node_dataset >= 0, ExcIO());
 #  if H5Gcreate_vers == 1
         cell_dataset = H5Dcreate(h5_mesh_file_id,
-                                 "cells",
+                                 (mesh_prefix + "cells").c_str(),
                                  H5T_NATIVE_UINT,
                                  cell_dataspace,
                                  H5P_DEFAULT);
@@ -8325,7 +9827,7 @@ namespace
         H5Pset_chunk(node_dataset_id, 2, cell_ds_dim);
 #    endif
         cell_dataset = H5Dcreate(h5_mesh_file_id,
-                                 "cells",
+                                 (mesh_prefix + "cells").c_str(),
                                  H5T_NATIVE_UINT,
                                  cell_dataspace,
                                  H5P_DEFAULT,
@@ -8429,12 +9931,10 @@ namespace
     else
       {
         // Otherwise we need to open a new file
-        h5_solution_file_id = H5Fcreate(solution_filename.c_str(),
-                                        H5F_ACC_TRUNC,
-                                        H5P_DEFAULT,
-                                        file_plist_id);
-        AssertThrow(h5_solution_file_id >= 0, ExcIO());
+        h5_solution_file_id = open_file(solution_filename);
       }
+    const std::string solution_prefix =
+      create_group(h5_solution_file_id, solution_group);
 
     // when writing, first write out all vector data, then handle the scalar
     // data sets that have been left over
@@ -8445,7 +9945,7 @@ namespace
         // Allocate space for the point data
         // Must be either 1d or 3d
         const unsigned int pt_data_vector_dim = data_filter.get_data_set_dim(i);
-        vector_name = data_filter.get_data_set_name(i);
+        vector_name = solution_prefix + data_filter.get_data_set_name(i);
 
         // Create the dataspace for the point data
         node_ds_dim[0]    = global_node_cell_count[0];
@@ -8529,6 +10029,74 @@ namespace
     status = H5Fclose(h5_solution_file_id);
     AssertThrow(status >= 0, ExcIO());
   }
+
+
+
+  /**
+   * Perform the HDF5 output on the processes that have patches.
+   */
+  template <int dim, int spacedim>
+  void
+  write_hdf5_on_ranks_with_patches(
+    const std::vector<DataOutBase::Patch<dim, spacedim>> &patches,
+    const DataOutBase::DataOutFilter                     &data_filter,
+    const DataOutBase::Hdf5Flags                         &flags,
+    const bool                                            write_mesh_file,
+    const std::string                                    &mesh_filename,
+    const std::string                                    &solution_filename,
+    const MPI_Comm                                        comm,
+    const unsigned int time_step = numbers::invalid_unsigned_int)
+  {
+    const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
+    (void)n_ranks;
+
+    // If HDF5 is not parallel and we're using multiple processes, abort:
+#  ifndef H5_HAVE_PARALLEL
+    AssertThrow(
+      n_ranks <= 1,
+      ExcMessage(
+        "Serial HDF5 output on multiple processes is not yet supported."));
+#  endif
+
+    // Verify that there are indeed patches to be written out. most of
+    // the times, people just forget to call build_patches when there
+    // are no patches, so a warning is in order. That said, the
+    // assertion is disabled if we run with more than one MPI rank,
+    // since then it can happen that, on coarse meshes, a processor
+    // simply has no cells it actually owns, and in that case it is
+    // legit if there are no patches.
+    Assert((patches.size() > 0) || (n_ranks > 1),
+           DataOutBase::ExcNoPatches());
+
+    // The HDF5 routines perform a bunch of collective calls that expect all
+    // ranks to participate. One ranks without any patches we are missing
+    // critical information, so rather than broadcasting that information,
+    // just create a new communicator that only contains ranks with cells and
+    // use that to perform the write operations:
+    const bool have_patches = (patches.size() > 0);
+    MPI_Comm   split_comm;
+    {
+      const int key   = Utilities::MPI::this_mpi_process(comm);
+      const int color = (have_patches ? 1 : 0);
+      const int ierr  = MPI_Comm_split(comm, color, key, &split_comm);
+      AssertThrowMPI(ierr);
+    }
+
+    if (have_patches)
+      {
+        do_write_hdf5<dim, spacedim>(patches,
+                                     data_filter,
+                                     flags,
+                                     write_mesh_file,
+                                     mesh_filename,
+                                     solution_filename,
+                                     split_comm,
+                                     time_step);
+      }
+
+    const int ierr = MPI_Comm_free(&split_comm);
+    AssertThrowMPI(ierr);
+  }
 #endif
 } // namespace
 
@@ -8690,6 +10258,26 @@ DataOutInterface<dim, spacedim>::write_hdf5_parallel(
 
 
 
+template <int dim, int spacedim>
+void
+DataOutInterface<dim, spacedim>::write_hdf5_time_step(
+  const DataOutBase::DataOutFilter &data_filter,
+  const std::string                &filename,
+  const unsigned int                time_step,
+  const bool                        write_mesh,
+  const MPI_Comm                    comm) const
+{
+  DataOutBase::write_hdf5_time_step(get_patches(),
+                                    data_filter,
+                                    hdf5_flags,
+                                    filename,
+                                    time_step,
+                                    write_mesh,
+                                    comm);
+}
+
+
+
 template <int dim, int spacedim>
 void
 DataOutBase::write_hdf5_parallel(
@@ -8734,55 +10322,58 @@ DataOutBase::write_hdf5_parallel(
   (void)comm;
   AssertThrow(false, ExcNeedsHDF5());
 #else
-
-  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
-  (void)n_ranks;
-
-  // If HDF5 is not parallel and we're using multiple processes, abort:
-#  ifndef H5_HAVE_PARALLEL
-  AssertThrow(
-    n_ranks <= 1,
-    ExcMessage(
-      "Serial HDF5 output on multiple processes is not yet supported."));
-#  endif
-
-  // Verify that there are indeed patches to be written out. most of
-  // the times, people just forget to call build_patches when there
-  // are no patches, so a warning is in order. That said, the
-  // assertion is disabled if we run with more than one MPI rank,
-  // since then it can happen that, on coarse meshes, a processor
-  // simply has no cells it actually owns, and in that case it is
-  // legit if there are no patches.
-  Assert((patches.size() > 0) || (n_ranks > 1), ExcNoPatches());
-
-  // The HDF5 routines perform a bunch of collective calls that expect all
-  // ranks to participate. One ranks without any patches we are missing
-  // critical information, so rather than broadcasting that information, just
-  // create a new communicator that only contains ranks with cells and
-  // use that to perform the write operations:
-  const bool have_patches = (patches.size() > 0);
-  MPI_Comm   split_comm;
-  {
-    const int key   = Utilities::MPI::this_mpi_process(comm);
-    const int color = (have_patches ? 1 : 0);
-    const int ierr  = MPI_Comm_split(comm, color, key, &split_comm);
-    AssertThrowMPI(ierr);
-  }
-
-  if (have_patches)
-    {
-      do_write_hdf5<dim, spacedim>(patches,
+  write_hdf5_on_ranks_with_patches(patches,
                                    data_filter,
                                    flags,
                                    write_mesh_file,
                                    mesh_filename,
                                    solution_filename,
-                                   split_comm);
-    }
+                                   comm);
+#endif
+}
+
 
-  const int ierr = MPI_Comm_free(&split_comm);
-  AssertThrowMPI(ierr);
 
+template <int dim, int spacedim>
+void
+DataOutBase::write_hdf5_time_step(
+  const std::vector<Patch<dim, spacedim>> &patches,
+  const DataOutBase::DataOutFilter        &data_filter,
+  const DataOutBase::Hdf5Flags            &flags,
+  const std::string                       &filename,
+  const unsigned int                       time_step,
+  const bool                               write_mesh,
+  const MPI_Comm                           comm)
+{
+  AssertThrow(
+    spacedim >= 2,
+    ExcMessage(
+      "DataOutBase was asked to write HDF5 output for a space dimension of 1. "
+      "HDF5 only supports datasets that live in 2 or 3 dimensions."));
+  AssertThrow(time_step != numbers::invalid_unsigned_int,
+              ExcMessage("The number of the time step is invalid."));
+  AssertThrow(write_mesh || time_step > 0,
+              ExcMessage("The first step of a time series has to write the "
+                         "mesh."));
+
+#ifndef DEAL_II_WITH_HDF5
+  // throw an exception, but first make sure the compiler does not warn about
+  // the now unused function arguments
+  (void)patches;
+  (void)data_filter;
+  (void)flags;
+  (void)filename;
+  (void)comm;
+  AssertThrow(false, ExcNeedsHDF5());
+#else
+  write_hdf5_on_ranks_with_patches(patches,
+                                   data_filter,
+                                   flags,
+                                   write_mesh,
+                                   filename,
+                                   filename,
+                                   comm,
+                                   time_step);
 #endif
 }
 
@@ -9135,6 +10726,20 @@ DataOutReader<dim, spacedim>::read(std::istream &in)
     tmp.swap(nonscalar_data_ranges);
   }
 
+  // files in binary format are read as a whole and then decoded
+  if (in.peek() == static_cast<int>(binary_intermediate_magic & 0xff))
+    {
+      const std::vector<char> buffer((std::istreambuf_iterator<char>(in)),
+                                     std::istreambuf_iterator<char>());
+      read_binary_intermediate(buffer.data(),
+                               buffer.size(),
+                               "input stream",
+                               patches,
+                               dataset_names,
+                               nonscalar_data_ranges);
+      return;
+    }
+
   // then check that we have the correct header of this file. both the first and
   // second real lines have to match, as well as the dimension information
   // written before that and the Version information written in the third line
@@ -9221,6 +10826,21 @@ DataOutReader<dim, spacedim>::read(std::istream &in)
 
 
 
+template <int dim, int spacedim>
+void
+DataOutReader<dim, spacedim>::read_binary(const std::string &filename)
+{
+  const MappedFile file(filename);
+  read_binary_intermediate(file.data(),
+                           file.size(),
+                           filename,
+                           patches,
+                           dataset_names,
+                           nonscalar_data_ranges);
+}
+
+
+
 template <int dim, int spacedim>
 void
 DataOutReader<dim, spacedim>::read_whole_parallel_file(std::istream &in)
@@ -9394,6 +11014,8 @@ XDMFEntry::XDMFEntry()
   , dimension(numbers::invalid_unsigned_int)
   , space_dimension(numbers::invalid_unsigned_int)
   , cell_type()
+  , h5_mesh_group("")
+  , h5_sol_group("")
 {}
 
 
@@ -9491,6 +11113,16 @@ XDMFEntry::add_attribute(const std::string &attr_name,
 
 
 
+void
+XDMFEntry::set_hdf5_groups(const std::string &mesh_group,
+                           const std::string &solution_group)
+{
+  h5_mesh_group = mesh_group;
+  h5_sol_group  = solution_group;
+}
+
+
+
 namespace
 {
   /**
@@ -9514,6 +11146,14 @@ XDMFEntry::get_xdmf_content(const unsigned int indent_level) const
   if (!valid)
     return "";
 
+  // The paths of the datasets within the HDF5 files
+  const std::string mesh_path =
+    h5_mesh_filename + ":/" +
+    (h5_mesh_group.empty() ? std::string() : h5_mesh_group + "/");
+  const std::string sol_path =
+    h5_sol_filename + ":/" +
+    (h5_sol_group.empty() ? std::string() : h5_sol_group + "/");
+
   std::stringstream ss;
   ss.precision(12);
   ss << indent(indent_level + 0)
@@ -9524,7 +11164,7 @@ XDMFEntry::get_xdmf_content(const unsigned int indent_level) const
   ss << indent(indent_level + 2) << "<DataItem Dimensions=\"" << num_nodes
      << " " << (space_dimension <= 2 ? 2 : space_dimension)
      << "\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">\n";
-  ss << indent(indent_level + 3) << h5_mesh_filename << ":/nodes\n";
+  ss << indent(indent_level + 3) << mesh_path << "nodes\n";
   ss << indent(indent_level + 2) << "</DataItem>\n";
   ss << indent(indent_level + 1) << "</Geometry>\n";
 
@@ -9585,7 +11225,7 @@ XDMFEntry::get_xdmf_content(const unsigned int indent_level) const
          << " " << cell_type.n_vertices()
          << "\" NumberType=\"UInt\" Format=\"HDF\">\n";
 
-      ss << indent(indent_level + 3) << h5_mesh_filename << ":/cells\n";
+      ss << indent(indent_level + 3) << mesh_path << "cells\n";
       ss << indent(indent_level + 2) << "</DataItem>\n";
       ss << indent(indent_level + 1) << "</Topology>\n";
     }
@@ -9609,8 +11249,8 @@ XDMFEntry::get_xdmf_content(const unsigned int indent_level) const
       ss << indent(indent_level + 2) << "<DataItem Dimensions=\"" << num_nodes
          << " " << (attribute_dim.second > 1 ? 3 : 1)
          << "\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">\n";
-      ss << indent(indent_level + 3) << h5_sol_filename << ":/"
-         << attribute_dim.first << '\n';
+      ss << indent(indent_level + 3) << sol_path << attribute_dim.first
+         << '\n';
       ss << indent(indent_level + 2) << "</DataItem>\n";
       ss << indent(indent_level + 1) << "</Attribute>\n";
     }
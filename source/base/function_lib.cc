@@ -14,6 +14,7 @@
 
 #include <deal.II/base/function_bessel.h>
 #include <deal.II/base/function_lib.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/numbers.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/std_cxx17/cmath.h>
@@ -21,6 +22,8 @@
 
 #include <deal.II/lac/vector.h>
 
+#include <boost/serialization/utility.hpp>
+
 #include <cmath>
 
 DEAL_II_NAMESPACE_OPEN
@@ -2468,6 +2471,49 @@ namespace Functions
 
       return grad;
     }
+
+
+    // Replicate a data table across the processes of a communicator, see
+    // TableBase::replicate_across_communicator(), and return it for
+    // moving it into a member variable.
+    template <int dim>
+    Table<dim, double>
+    replicate_table(Table<dim, double> &&data_values,
+                    const MPI_Comm       communicator,
+                    const unsigned int   root_process)
+    {
+      data_values.replicate_across_communicator(communicator, root_process);
+      return std::move(data_values);
+    }
+
+
+    // Return the index of the interval of the strictly ascending
+    // coordinate values x that contains the coordinate p, i.e., the largest
+    // index i with x[i] < p <= x[i+1]. Coordinates to the left of x[0] are
+    // associated with the first and those to the right of the last value
+    // with the last interval.
+    unsigned int
+    interval_index(const std::vector<double> &x, const double p)
+    {
+      // get the index of the first element of the coordinate arrays that is
+      // larger than p
+      const unsigned int index =
+        std::lower_bound(x.begin(), x.end(), p) - x.begin();
+
+      // the one we want is the index of the coordinate to the left, however,
+      // so decrease it by one (unless we have a point to the left of all, in
+      // which case we stay where we are; the formulas below are made in a way
+      // that allow us to extend the function by a constant value)
+      //
+      // to make this work, if we got x.end(), we actually have to consider
+      // the last box which has index size()-2
+      if (index == x.size())
+        return x.size() - 2;
+      else if (index > 0)
+        return index - 1;
+      else
+        return 0;
+    }
   } // namespace
 
 
@@ -2526,6 +2572,21 @@ namespace Functions
 
 
 
+  template <int dim>
+  InterpolatedTensorProductGridData<dim>::InterpolatedTensorProductGridData(
+    std::array<std::vector<double>, dim> &&coordinate_values,
+    Table<dim, double>                   &&data_values,
+    const MPI_Comm                         communicator,
+    const unsigned int                     root_process)
+    : InterpolatedTensorProductGridData(
+        Utilities::MPI::broadcast(communicator,
+                                  coordinate_values,
+                                  root_process),
+        replicate_table(std::move(data_values), communicator, root_process))
+  {}
+
+
+
   template <int dim>
   TableIndices<dim>
   InterpolatedTensorProductGridData<dim>::table_index_of_point(
@@ -2537,26 +2598,7 @@ namespace Functions
     // intervals, starting at x.size()-2 and going to x.size()-1.
     TableIndices<dim> ix;
     for (unsigned int d = 0; d < dim; ++d)
-      {
-        // get the index of the first element of the coordinate arrays that is
-        // larger than p[d]
-        ix[d] = (std::lower_bound(coordinate_values[d].begin(),
-                                  coordinate_values[d].end(),
-                                  p[d]) -
-                 coordinate_values[d].begin());
-
-        // the one we want is the index of the coordinate to the left, however,
-        // so decrease it by one (unless we have a point to the left of all, in
-        // which case we stay where we are; the formulas below are made in a way
-        // that allow us to extend the function by a constant value)
-        //
-        // to make this work, if we got coordinate_values[d].end(), we actually
-        // have to consider the last box which has index size()-2
-        if (ix[d] == coordinate_values[d].size())
-          ix[d] = coordinate_values[d].size() - 2;
-        else if (ix[d] > 0)
-          --ix[d];
-      }
+      ix[d] = interval_index(coordinate_values[d], p[d]);
 
     return ix;
   }
@@ -2615,6 +2657,47 @@ namespace Functions
 
 
 
+  template <int dim>
+  void
+  InterpolatedTensorProductGridData<dim>::value_list(
+    const std::vector<Point<dim>> &points,
+    std::vector<double>           &values,
+    const unsigned int             component) const
+  {
+    Assert(
+      component == 0,
+      ExcMessage(
+        "This is a scalar function object, the component can only be zero."));
+    AssertDimension(points.size(), values.size());
+
+    if (points.empty())
+      return;
+
+    // start from the intervals of the first point, and only search the
+    // coordinate arrays again for those directions in which a point leaves
+    // the interval of its predecessor
+    TableIndices<dim> ix = table_index_of_point(points[0]);
+    for (unsigned int q = 0; q < points.size(); ++q)
+      {
+        const Point<dim> &p = points[q];
+
+        Point<dim> p_unit;
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            const std::vector<double> &x = coordinate_values[d];
+            if (!(x[ix[d]] < p[d] && p[d] <= x[ix[d] + 1]))
+              ix[d] = interval_index(x, p[d]);
+
+            p_unit[d] = std::max(
+              std::min((p[d] - x[ix[d]]) / (x[ix[d] + 1] - x[ix[d]]), 1.), 0.);
+          }
+
+        values[q] = interpolate(data_values, ix, p_unit);
+      }
+  }
+
+
+
   template <int dim>
   Tensor<1, dim>
   InterpolatedTensorProductGridData<dim>::gradient(
@@ -2693,6 +2776,23 @@ namespace Functions
 
 
 
+  template <int dim>
+  InterpolatedUniformGridData<dim>::InterpolatedUniformGridData(
+    std::array<std::pair<double, double>, dim> &&interval_endpoints,
+    std::array<unsigned int, dim>              &&n_subintervals,
+    Table<dim, double>                         &&data_values,
+    const MPI_Comm                               communicator,
+    const unsigned int                           root_process)
+    : InterpolatedUniformGridData(
+        Utilities::MPI::broadcast(communicator,
+                                  interval_endpoints,
+                                  root_process),
+        Utilities::MPI::broadcast(communicator, n_subintervals, root_process),
+        replicate_table(std::move(data_values), communicator, root_process))
+  {}
+
+
+
   template <int dim>
   double
   InterpolatedUniformGridData<dim>::value(const Point<dim>  &p,
@@ -2741,6 +2841,56 @@ namespace Functions
 
 
 
+  template <int dim>
+  void
+  InterpolatedUniformGridData<dim>::value_list(
+    const std::vector<Point<dim>> &points,
+    std::vector<double>           &values,
+    const unsigned int             component) const
+  {
+    Assert(
+      component == 0,
+      ExcMessage(
+        "This is a scalar function object, the component can only be zero."));
+    AssertDimension(points.size(), values.size());
+
+    // compute the size of the subintervals once for all points, and then
+    // proceed as in value()
+    Point<dim> delta_x;
+    for (unsigned int d = 0; d < dim; ++d)
+      delta_x[d] =
+        ((interval_endpoints[d].second - interval_endpoints[d].first) /
+         n_subintervals[d]);
+
+    for (unsigned int q = 0; q < points.size(); ++q)
+      {
+        const Point<dim> &p = points[q];
+
+        TableIndices<dim> ix;
+        Point<dim>        p_unit;
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            if (p[d] <= interval_endpoints[d].first)
+              ix[d] = 0;
+            else if (p[d] >= interval_endpoints[d].second - delta_x[d])
+              ix[d] = n_subintervals[d] - 1;
+            else
+              ix[d] = static_cast<unsigned int>(
+                (p[d] - interval_endpoints[d].first) / delta_x[d]);
+
+            p_unit[d] = std::max(std::min((p[d] - interval_endpoints[d].first -
+                                           ix[d] * delta_x[d]) /
+                                            delta_x[d],
+                                          1.),
+                                 0.);
+          }
+
+        values[q] = interpolate(data_values, ix, p_unit);
+      }
+  }
+
+
+
   template <int dim>
   Tensor<1, dim>
   InterpolatedUniformGridData<dim>::gradient(const Point<dim>  &p,
@@ -106,6 +106,53 @@ FunctionParser<dim>::value(const Point<dim>  &p,
   return this->do_value(p, this->get_time(), component);
 }
 
+
+
+template <int dim>
+void
+FunctionParser<dim>::value_list(const std::vector<Point<dim>> &points,
+                                std::vector<double>           &values,
+                                const unsigned int             component) const
+{
+  AssertDimension(values.size(), points.size());
+  AssertIndexRange(component, this->n_components);
+
+  this->do_value_list(make_array_view(points),
+                      this->get_time(),
+                      component,
+                      1,
+                      make_array_view(values));
+}
+
+
+
+template <int dim>
+void
+FunctionParser<dim>::vector_value_list(
+  const std::vector<Point<dim>> &points,
+  std::vector<Vector<double>>   &values) const
+{
+  AssertDimension(values.size(), points.size());
+
+  // evaluate all components into a contiguous array first, with the values
+  // of one component at all points next to each other, and then distribute
+  // them
+  const unsigned int  n_points = points.size();
+  std::vector<double> component_values(this->n_components * n_points);
+  this->do_value_list(make_array_view(points),
+                      this->get_time(),
+                      0,
+                      this->n_components,
+                      make_array_view(component_values));
+
+  for (unsigned int q = 0; q < n_points; ++q)
+    {
+      AssertDimension(values[q].size(), this->n_components);
+      for (unsigned int c = 0; c < this->n_components; ++c)
+        values[q][c] = component_values[c * n_points + q];
+    }
+}
+
 // Explicit Instantiations.
 
 template class FunctionParser<1>;
@@ -20,6 +20,7 @@
 
 #  include <hdf5.h>
 
+#  include <algorithm>
 #  include <iostream>
 
 DEAL_II_NAMESPACE_OPEN
@@ -139,7 +140,8 @@ namespace HDF5
                    const hid_t                  &parent_group_id,
                    const std::vector<hsize_t>   &dimensions,
                    const std::shared_ptr<hid_t> &t_type,
-                   const bool                    mpi)
+                   const bool                    mpi,
+                   const std::vector<hsize_t>   &chunk_dimensions)
     : HDF5Object(name, mpi)
     , rank(dimensions.size())
     , dimensions(dimensions)
@@ -170,15 +172,43 @@ namespace HDF5
     *dataspace = H5Screate_simple(rank, dimensions.data(), nullptr);
     Assert(*dataspace >= 0, ExcMessage("Error at H5Screate_simple"));
 
+    // Chunks can not be larger than the dataset and a dataset with a zero
+    // dimension can not be chunked, so fall back to the contiguous layout
+    // in that case
+    hid_t  plist = H5P_DEFAULT;
+    herr_t ret;
+    if (chunk_dimensions.size() > 0 &&
+        std::find(dimensions.begin(), dimensions.end(), hsize_t(0)) ==
+          dimensions.end())
+      {
+        AssertDimension(chunk_dimensions.size(), rank);
+        std::vector<hsize_t> chunks(rank);
+        for (unsigned int d = 0; d < rank; ++d)
+          chunks[d] = std::max<hsize_t>(
+            std::min(chunk_dimensions[d], dimensions[d]), 1);
+
+        plist = H5Pcreate(H5P_DATASET_CREATE);
+        Assert(plist >= 0, ExcMessage("Error at H5Pcreate"));
+        ret = H5Pset_chunk(plist, rank, chunks.data());
+        Assert(ret >= 0, ExcMessage("Error at H5Pset_chunk"));
+      }
+
     *hdf5_reference = H5Dcreate2(parent_group_id,
                                  name.data(),
                                  *t_type,
                                  *dataspace,
                                  H5P_DEFAULT,
-                                 H5P_DEFAULT,
+                                 plist,
                                  H5P_DEFAULT);
     Assert(*hdf5_reference >= 0, ExcMessage("Error at H5Dcreate2"));
 
+    if (plist != H5P_DEFAULT)
+      {
+        ret = H5Pclose(plist);
+        Assert(ret >= 0, ExcMessage("Error at H5Pclose"));
+      }
+    (void)ret;
+
     size = 1;
     for (const auto &dimension : dimensions)
       {
@@ -15,10 +15,13 @@
 #include <deal.II/base/index_set.h>
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/mpi.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/lac/exceptions.h>
 #include <deal.II/lac/trilinos_tpetra_types.h>
 
+#include <algorithm>
 #include <vector>
 
 #ifdef DEAL_II_WITH_TRILINOS
@@ -648,6 +651,58 @@ IndexSet::add_ranges_internal(
 
 
 
+void
+IndexSet::add_unsorted_indices(std::vector<size_type> &&indices)
+{
+  if (indices.empty())
+    return;
+
+  // Split the indices into chunks that are sorted independently on the
+  // threads, and compress each sorted chunk into ranges of consecutive
+  // indices right away, skipping duplicates. Chunks should be large enough
+  // to make the parallel overhead negligible.
+  const std::size_t  minimal_chunk_size = 32768;
+  const unsigned int n_chunks           = std::max<std::size_t>(
+    1,
+    std::min<std::size_t>(MultithreadInfo::n_threads(),
+                          indices.size() / minimal_chunk_size));
+
+  std::vector<std::vector<std::pair<size_type, size_type>>> chunk_ranges(
+    n_chunks);
+  parallel::apply_to_subranges(
+    0U,
+    n_chunks,
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int chunk = begin; chunk < end; ++chunk)
+        {
+          const auto first =
+            indices.begin() + indices.size() * chunk / n_chunks;
+          const auto last =
+            indices.begin() + indices.size() * (chunk + 1) / n_chunks;
+          std::sort(first, last);
+
+          auto &ranges_of_chunk = chunk_ranges[chunk];
+          for (auto p = first; p != last; ++p)
+            if (ranges_of_chunk.empty() || *p > ranges_of_chunk.back().second)
+              ranges_of_chunk.emplace_back(*p, *p + 1);
+            else if (*p == ranges_of_chunk.back().second)
+              ++ranges_of_chunk.back().second;
+        }
+    },
+    1);
+
+  boost::container::small_vector<std::pair<size_type, size_type>, 200>
+    tmp_ranges;
+  for (const auto &ranges_of_chunk : chunk_ranges)
+    tmp_ranges.insert(tmp_ranges.end(),
+                      ranges_of_chunk.begin(),
+                      ranges_of_chunk.end());
+
+  add_ranges_internal(tmp_ranges, n_chunks == 1);
+}
+
+
+
 void
 IndexSet::add_indices(const IndexSet &other, const size_type offset)
 {
@@ -872,6 +927,46 @@ IndexSet::index_within_set_binary_search(const size_type n) const
 
 
 
+std::vector<IndexSet::size_type>
+IndexSet::index_within_set(const IndexSet &other) const
+{
+  AssertDimension(size(), other.size());
+  compress();
+  other.compress();
+
+  std::vector<size_type> local_indices;
+  local_indices.reserve(other.n_elements());
+
+  // the elements of the other set are sorted, so we only need to move
+  // forward through the ranges of the current set. in the common case that
+  // a range ends, the element is in the next range or not in the set at
+  // all; otherwise we skip the ranges in between with a binary search
+  std::vector<Range>::const_iterator range = ranges.cbegin();
+  for (const Range &other_range : other.ranges)
+    for (size_type index = other_range.begin; index < other_range.end; ++index)
+      {
+        if (range != ranges.end() && range->end <= index)
+          {
+            ++range;
+            if (range != ranges.end() && range->end <= index)
+              range = Utilities::lower_bound(range,
+                                             ranges.cend(),
+                                             Range(index + 1, index + 1),
+                                             Range::end_compare);
+          }
+
+        if (range != ranges.end() && range->begin <= index)
+          local_indices.push_back((index - range->begin) +
+                                  range->nth_index_in_set);
+        else
+          local_indices.push_back(numbers::invalid_dof_index);
+      }
+
+  return local_indices;
+}
+
+
+
 IndexSet::ElementIterator
 IndexSet::at(const size_type global_index) const
 {
@@ -14,6 +14,7 @@
 // ---------------------------------------------------------------------
 
 #include <deal.II/base/init_finalize.h>
+#include <deal.II/base/instrumentation_region.h>
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/multithread_info.h>
 
@@ -293,6 +294,9 @@ InitFinalize::InitFinalize([[maybe_unused]] int    &argc,
       Kokkos::initialize(argc_new, argv_new.data());
     }
 
+  // Initialize the libraries for performance instrumentation, if any
+  InstrumentationRegion::initialize();
+
   // As a final step call the at_mpi_init() signal handler.
   signals.at_mpi_init();
 }
@@ -403,6 +407,9 @@ InitFinalize::finalize()
 #endif
 
 
+      // Let the performance instrumentation libraries write their results
+      InstrumentationRegion::finalize();
+
       // Finalize Kokkos
       if (static_cast<bool>(libraries & InitializeLibrary::Kokkos))
         Kokkos::finalize();
@@ -0,0 +1,85 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/instrumentation_region.h>
+
+#ifdef DEAL_II_WITH_LIKWID
+#  ifndef LIKWID_PERFMON
+#    define LIKWID_PERFMON
+#  endif
+#  include <likwid-marker.h>
+#endif
+
+#ifdef DEAL_II_WITH_CALIPER
+#  include <caliper/cali.h>
+#endif
+
+DEAL_II_NAMESPACE_OPEN
+
+
+void
+InstrumentationRegion::begin([[maybe_unused]] const char *name)
+{
+#ifdef DEAL_II_WITH_LIKWID
+  // LIKWID needs to know about every thread that starts a region; threads
+  // of the task scheduler are created on demand, so register them lazily
+  thread_local bool thread_is_registered = false;
+  if (thread_is_registered == false)
+    {
+      LIKWID_MARKER_THREADINIT;
+      thread_is_registered = true;
+    }
+  LIKWID_MARKER_START(name);
+#endif
+
+#ifdef DEAL_II_WITH_CALIPER
+  cali_begin_region(name);
+#endif
+}
+
+
+
+void
+InstrumentationRegion::end([[maybe_unused]] const char *name)
+{
+#ifdef DEAL_II_WITH_CALIPER
+  cali_end_region(name);
+#endif
+
+#ifdef DEAL_II_WITH_LIKWID
+  LIKWID_MARKER_STOP(name);
+#endif
+}
+
+
+
+void
+InstrumentationRegion::initialize()
+{
+#ifdef DEAL_II_WITH_LIKWID
+  LIKWID_MARKER_INIT;
+#endif
+}
+
+
+
+void
+InstrumentationRegion::finalize()
+{
+#ifdef DEAL_II_WITH_LIKWID
+  LIKWID_MARKER_CLOSE;
+#endif
+}
+
+DEAL_II_NAMESPACE_CLOSE
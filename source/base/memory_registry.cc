@@ -0,0 +1,419 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_registry.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/utilities.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+std::atomic<bool> MemoryRegistry::enabled(false);
+
+
+namespace
+{
+  /**
+   * An object registered with MemoryRegistry::add().
+   */
+  struct ObjectEntry
+  {
+    std::string                  name;
+    std::function<std::size_t()> memory_consumption;
+  };
+
+  /**
+   * The information recorded for all calls to a stage of a given name.
+   */
+  struct StageStatistics
+  {
+    unsigned int n_calls       = 0;
+    double       peak_increase = 0.;
+  };
+
+  /**
+   * A stage that has been entered but not yet left, with the resident set
+   * size at the start and the highest resident set size seen so far, both
+   * in kB.
+   */
+  struct ActiveStage
+  {
+    const char       *name;
+    unsigned long int start_size;
+    unsigned long int peak_size;
+  };
+
+  /**
+   * All data of the registry, protected by a mutex.
+   */
+  struct RegistryData
+  {
+    std::mutex                             mutex;
+    std::vector<ObjectEntry>               objects;
+    std::map<std::string, std::size_t>     object_peaks;
+    std::map<std::string, StageStatistics> stages;
+    std::vector<ActiveStage>               active_stages;
+  };
+
+
+
+  RegistryData &
+  get_registry_data()
+  {
+    static RegistryData data;
+    return data;
+  }
+
+
+
+  // Return the high water mark of the resident set size in kB
+  unsigned long int
+  get_peak_resident_size()
+  {
+    Utilities::System::MemoryStats stats;
+    Utilities::System::get_memory_stats(stats);
+    return stats.VmHWM;
+  }
+
+
+
+  // Reset the high water mark of the resident set size to the current size
+  // of the process, which is supported by Linux kernels since version 4.0
+  void
+  reset_peak_resident_size()
+  {
+#ifdef __linux__
+    std::ofstream file("/proc/self/clear_refs");
+    if (file)
+      file << "5" << std::endl;
+#endif
+  }
+
+
+
+  // Query the current memory consumption of all registered objects,
+  // accumulated by name, and update the peak values. Must be called with
+  // the mutex held.
+  std::map<std::string, std::size_t>
+  update_objects(RegistryData &data)
+  {
+    std::map<std::string, std::size_t> current;
+    for (const ObjectEntry &entry : data.objects)
+      if (entry.memory_consumption)
+        current[entry.name] += entry.memory_consumption();
+
+    for (const auto &[name, bytes] : current)
+      data.object_peaks[name] = std::max(data.object_peaks[name], bytes);
+
+    return current;
+  }
+} // namespace
+
+
+
+MemoryRegistry::Handle::Handle(const unsigned int index)
+  : index(index)
+{}
+
+
+
+MemoryRegistry::Handle::Handle(Handle &&other) noexcept
+  : index(other.index)
+{
+  other.index = static_cast<unsigned int>(-1);
+}
+
+
+
+MemoryRegistry::Handle &
+MemoryRegistry::Handle::operator=(Handle &&other) noexcept
+{
+  if (this != &other)
+    {
+      reset();
+      index       = other.index;
+      other.index = static_cast<unsigned int>(-1);
+    }
+  return *this;
+}
+
+
+
+MemoryRegistry::Handle::~Handle()
+{
+  reset();
+}
+
+
+
+void
+MemoryRegistry::Handle::reset()
+{
+  if (index != static_cast<unsigned int>(-1))
+    MemoryRegistry::remove(index);
+  index = static_cast<unsigned int>(-1);
+}
+
+
+
+void
+MemoryRegistry::enable()
+{
+  enabled = true;
+}
+
+
+
+void
+MemoryRegistry::disable()
+{
+  enabled = false;
+}
+
+
+
+MemoryRegistry::Handle
+MemoryRegistry::add(const std::string                  &name,
+                    const std::function<std::size_t()> &memory_consumption)
+{
+  Assert(memory_consumption,
+         ExcMessage("The function to compute the memory consumption of '" +
+                    name + "' must not be empty."));
+
+  RegistryData               &data = get_registry_data();
+  std::lock_guard<std::mutex> lock(data.mutex);
+
+  // reuse the slot of a removed object if possible
+  for (unsigned int i = 0; i < data.objects.size(); ++i)
+    if (!data.objects[i].memory_consumption)
+      {
+        data.objects[i] = {name, memory_consumption};
+        return Handle(i);
+      }
+
+  data.objects.push_back({name, memory_consumption});
+  return Handle(data.objects.size() - 1);
+}
+
+
+
+void
+MemoryRegistry::remove(const unsigned int index)
+{
+  RegistryData               &data = get_registry_data();
+  std::lock_guard<std::mutex> lock(data.mutex);
+
+  AssertIndexRange(index, data.objects.size());
+
+  // record the final size of the object in the peak values
+  if (is_enabled() && data.objects[index].memory_consumption)
+    {
+      std::size_t &peak = data.object_peaks[data.objects[index].name];
+      peak = std::max(peak, data.objects[index].memory_consumption());
+    }
+
+  data.objects[index] = ObjectEntry();
+}
+
+
+
+void
+MemoryRegistry::update()
+{
+  if (!is_enabled())
+    return;
+
+  RegistryData               &data = get_registry_data();
+  std::lock_guard<std::mutex> lock(data.mutex);
+  update_objects(data);
+}
+
+
+
+void
+MemoryRegistry::clear()
+{
+  RegistryData               &data = get_registry_data();
+  std::lock_guard<std::mutex> lock(data.mutex);
+  data.object_peaks.clear();
+  data.stages.clear();
+}
+
+
+
+void
+MemoryRegistry::enter_stage(const char *name)
+{
+  RegistryData               &data = get_registry_data();
+  std::lock_guard<std::mutex> lock(data.mutex);
+
+  // the high water mark is reset below, so account for the peak reached so
+  // far in the enclosing stages
+  const unsigned long int peak = get_peak_resident_size();
+  for (ActiveStage &stage : data.active_stages)
+    stage.peak_size = std::max(stage.peak_size, peak);
+
+  reset_peak_resident_size();
+
+  Utilities::System::MemoryStats stats;
+  Utilities::System::get_memory_stats(stats);
+  data.active_stages.push_back({name, stats.VmRSS, stats.VmRSS});
+}
+
+
+
+void
+MemoryRegistry::leave_stage()
+{
+  RegistryData               &data = get_registry_data();
+  std::lock_guard<std::mutex> lock(data.mutex);
+
+  Assert(!data.active_stages.empty(),
+         ExcMessage("There is no active stage to leave."));
+
+  const unsigned long int peak = get_peak_resident_size();
+  for (ActiveStage &stage : data.active_stages)
+    stage.peak_size = std::max(stage.peak_size, peak);
+
+  const ActiveStage stage = data.active_stages.back();
+  data.active_stages.pop_back();
+
+  StageStatistics &statistics = data.stages[stage.name];
+  ++statistics.n_calls;
+  statistics.peak_increase =
+    std::max(statistics.peak_increase,
+             1024. * (stage.peak_size - std::min(stage.start_size,
+                                                 stage.peak_size)));
+}
+
+
+
+void
+MemoryRegistry::print_summary(std::ostream &out, const MPI_Comm mpi_comm)
+{
+  // collect the local information
+  std::map<std::string, std::size_t>     current_objects;
+  std::map<std::string, std::size_t>     object_peaks;
+  std::map<std::string, StageStatistics> stages;
+  {
+    RegistryData               &data = get_registry_data();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    current_objects = update_objects(data);
+    object_peaks    = data.object_peaks;
+    stages          = data.stages;
+  }
+
+  // objects and stages might only be present on some of the processes, so
+  // compute the union of all names
+  const auto collect_names = [&mpi_comm](const auto &map) {
+    std::vector<std::string> names;
+    for (const auto &entry : map)
+      names.push_back(entry.first);
+
+    std::set<std::string> all_names;
+    for (const std::vector<std::string> &names_on_process :
+         Utilities::MPI::all_gather(mpi_comm, names))
+      all_names.insert(names_on_process.begin(), names_on_process.end());
+    return std::vector<std::string>(all_names.begin(), all_names.end());
+  };
+  const std::vector<std::string> object_names = collect_names(object_peaks);
+  const std::vector<std::string> stage_names  = collect_names(stages);
+
+  // arrange all values in MB in one array to compute the statistics with a
+  // single collective operation
+  Utilities::System::MemoryStats stats;
+  Utilities::System::get_memory_stats(stats);
+
+  std::vector<std::string> labels;
+  std::vector<double>      values;
+  labels.emplace_back("  Process resident set size");
+  values.push_back(stats.VmRSS / 1024.);
+  labels.emplace_back("  Process peak resident set size");
+  values.push_back(stats.VmHWM / 1024.);
+  labels.emplace_back("  Process virtual memory size");
+  values.push_back(stats.VmSize / 1024.);
+  for (const std::string &name : object_names)
+    {
+      const auto current = current_objects.find(name);
+      const auto peak    = object_peaks.find(name);
+      labels.push_back("  " + name);
+      values.push_back(
+        current != current_objects.end() ? 1e-6 * current->second : 0.);
+      labels.push_back("  " + name + " (peak)");
+      values.push_back(peak != object_peaks.end() ? 1e-6 * peak->second : 0.);
+    }
+  for (const std::string &name : stage_names)
+    {
+      const auto stage = stages.find(name);
+      labels.push_back("  " + name);
+      values.push_back(stage != stages.end() ?
+                         1e-6 * stage->second.peak_increase :
+                         0.);
+    }
+
+  const std::vector<Utilities::MPI::MinMaxAvg> statistics =
+    Utilities::MPI::min_max_avg(values, mpi_comm);
+
+  if (Utilities::MPI::this_mpi_process(mpi_comm) != 0)
+    return;
+
+  unsigned int label_width = 40;
+  for (const std::string &label : labels)
+    label_width = std::max<unsigned int>(label_width, label.size() + 2);
+
+  const auto print_line = [&](const unsigned int i) {
+    out << std::left << std::setw(label_width) << labels[i] << std::right
+        << std::fixed << std::setprecision(1) << std::setw(12)
+        << statistics[i].min << std::setw(12) << statistics[i].avg
+        << std::setw(12) << statistics[i].max << std::setw(12)
+        << statistics[i].max_index << std::endl;
+  };
+
+  const std::ios_base::fmtflags flags = out.flags();
+
+  out << std::left << std::setw(label_width) << "Memory consumption in MB"
+      << std::right << std::setw(12) << "min" << std::setw(12) << "avg"
+      << std::setw(12) << "max" << std::setw(12) << "max rank" << std::endl;
+  out << "Process (" << Utilities::MPI::n_mpi_processes(mpi_comm)
+      << " MPI processes)" << std::endl;
+  for (unsigned int i = 0; i < 3; ++i)
+    print_line(i);
+
+  unsigned int index = 3;
+  if (!object_names.empty())
+    {
+      out << "Registered objects" << std::endl;
+      for (unsigned int i = 0; i < 2 * object_names.size(); ++i, ++index)
+        print_line(index);
+    }
+  if (!stage_names.empty())
+    {
+      out << "Stages (peak increase of the resident set size)" << std::endl;
+      for (unsigned int i = 0; i < stage_names.size(); ++i, ++index)
+        print_line(index);
+    }
+
+  out.flags(flags);
+}
+
+DEAL_II_NAMESPACE_CLOSE
@@ -2083,6 +2083,10 @@ namespace Utilities
                      const ArrayView<bool> &);
 
 
+    template Future<bool>
+    ilogical_or<bool>(const bool &, const MPI_Comm);
+
+
     template std::vector<unsigned int>
     compute_set_union(const std::vector<unsigned int> &vec,
                       const MPI_Comm                   comm);
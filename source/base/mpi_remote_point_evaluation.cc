@@ -39,11 +39,13 @@ namespace Utilities
       const double                              tolerance,
       const bool                                enforce_unique_mapping,
       const unsigned int                        rtree_level,
-      const std::function<std::vector<bool>()> &marked_vertices)
+      const std::function<std::vector<bool>()> &marked_vertices,
+      const bool                                reuse_point_locations)
       : tolerance(tolerance)
       , enforce_unique_mapping(enforce_unique_mapping)
       , rtree_level(rtree_level)
       , marked_vertices(marked_vertices)
+      , reuse_point_locations(reuse_point_locations)
     {}
 
 
@@ -106,6 +108,22 @@ namespace Utilities
       (void)cache;
       (void)points;
 #else
+      // if the points have been searched on the same mesh before, only
+      // search again the points that have left their cells
+      const bool can_reuse_point_locations =
+        point_locations && this->ready_flag &&
+        this->tria == &cache.get_triangulation() &&
+        this->mapping == &cache.get_mapping() &&
+        points.size() == point_locations->n_searched_points;
+      if (additional_data.reuse_point_locations &&
+          Utilities::MPI::min(can_reuse_point_locations ? 1U : 0U,
+                              cache.get_triangulation()
+                                .get_mpi_communicator()) == 1U)
+        {
+          update_point_locations(cache, points);
+          return;
+        }
+
       if (tria_signal.connected())
         tria_signal.disconnect();
 
@@ -118,10 +136,164 @@ namespace Utilities
         extract_rtree_level(cache.get_locally_owned_cell_bounding_boxes_rtree(),
                             additional_data.rtree_level));
 
-      const auto data =
+      auto data = GridTools::internal::distributed_compute_point_locations(
+        cache,
+        points,
+        global_bboxes,
+        additional_data.marked_vertices ? additional_data.marked_vertices() :
+                                          std::vector<bool>(),
+        additional_data.tolerance,
+        true,
+        additional_data.enforce_unique_mapping);
+
+      this->reinit(data, cache.get_triangulation(), cache.get_mapping());
+
+      if (additional_data.reuse_point_locations)
+        point_locations = std::make_unique<
+          GridTools::internal::DistributedComputePointLocationsInternal<
+            dim,
+            spacedim>>(std::move(data));
+#endif
+    }
+
+
+
+    template <int dim, int spacedim>
+    void
+    RemotePointEvaluation<dim, spacedim>::update_point_locations(
+      const GridTools::Cache<dim, spacedim> &cache,
+      const std::vector<Point<spacedim>>    &points)
+    {
+#ifndef DEAL_II_WITH_MPI
+      Assert(false, ExcNeedsMPI());
+      (void)cache;
+      (void)points;
+#else
+      const Triangulation<dim, spacedim> &tria    = cache.get_triangulation();
+      const Mapping<dim, spacedim>       &mapping = cache.get_mapping();
+
+      const MPI_Comm comm = tria.get_mpi_communicator();
+
+      auto &data = *point_locations;
+
+      // step 1: send the new positions of the points to the processes that
+      // own the cells the points have been found in. The received components
+      // are sorted by the index of the point, so the positions sent to each
+      // process are sorted as well.
+      std::map<unsigned int,
+               std::vector<std::pair<unsigned int, Point<spacedim>>>>
+        positions_to_send;
+      for (const auto &[rank, index, enumeration] : data.recv_components)
+        {
+          (void)enumeration;
+          auto &positions = positions_to_send[rank];
+          if (positions.empty() || positions.back().first != index)
+            positions.emplace_back(index, points[index]);
+        }
+      const auto received_positions =
+        Utilities::MPI::some_to_some(comm, positions_to_send);
+
+      // step 2: check if the points are still inside their cells and update
+      // their reference positions. Collect the points that have left a cell
+      // to tell the requesting processes about it.
+      std::map<unsigned int, std::vector<unsigned int>> lost_points;
+      {
+        const auto compare_index = [](const auto &a, const unsigned int b) {
+          return a.first < b;
+        };
+
+        auto kept_end = data.send_components.begin();
+        for (auto &component : data.send_components)
+          {
+            const unsigned int rank  = std::get<1>(component);
+            const unsigned int index = std::get<2>(component);
+
+            const auto positions = received_positions.find(rank);
+            Assert(positions != received_positions.end(), ExcInternalError());
+            const auto position = std::lower_bound(positions->second.begin(),
+                                                   positions->second.end(),
+                                                   index,
+                                                   compare_index);
+            Assert(position != positions->second.end() &&
+                     position->first == index,
+                   ExcInternalError());
+
+            const typename Triangulation<dim, spacedim>::active_cell_iterator
+              cell(&tria,
+                   std::get<0>(component).first,
+                   std::get<0>(component).second);
+
+            bool is_inside = false;
+            try
+              {
+                const Point<dim> reference_point =
+                  mapping.transform_real_to_unit_cell(cell, position->second);
+                if (cell->reference_cell().contains_point(
+                      reference_point, additional_data.tolerance))
+                  {
+                    std::get<3>(component) = reference_point;
+                    std::get<4>(component) = position->second;
+                    is_inside              = true;
+                  }
+              }
+            catch (typename Mapping<dim, spacedim>::ExcTransformationFailed &)
+              {}
+
+            if (is_inside)
+              *kept_end++ = std::move(component);
+            else
+              lost_points[rank].push_back(index);
+          }
+        data.send_components.erase(kept_end, data.send_components.end());
+      }
+      const auto received_lost_points =
+        Utilities::MPI::some_to_some(comm, lost_points);
+
+      // step 3: remove the cells that have been left from the received
+      // components, and search the points that are not inside any cell any
+      // more, as well as the ones that have not been found before
+      {
+        std::map<std::pair<unsigned int, unsigned int>, unsigned int>
+          n_lost_components;
+        for (const auto &[rank, indices] : received_lost_points)
+          for (const unsigned int index : indices)
+            ++n_lost_components[{rank, index}];
+
+        auto kept_end = data.recv_components.begin();
+        for (const auto &component : data.recv_components)
+          {
+            const auto n_lost = n_lost_components.find(
+              {std::get<0>(component), std::get<1>(component)});
+            if (n_lost != n_lost_components.end() && n_lost->second > 0)
+              --n_lost->second;
+            else
+              *kept_end++ = component;
+          }
+        data.recv_components.erase(kept_end, data.recv_components.end());
+      }
+
+      std::vector<bool> point_is_found(points.size(), false);
+      for (const auto &component : data.recv_components)
+        point_is_found[std::get<1>(component)] = true;
+
+      std::vector<unsigned int>    indices_to_search;
+      std::vector<Point<spacedim>> points_to_search;
+      for (unsigned int i = 0; i < points.size(); ++i)
+        if (point_is_found[i] == false)
+          {
+            indices_to_search.push_back(i);
+            points_to_search.push_back(points[i]);
+          }
+
+      std::vector<std::vector<BoundingBox<spacedim>>> global_bboxes;
+      global_bboxes.emplace_back(
+        extract_rtree_level(cache.get_locally_owned_cell_bounding_boxes_rtree(),
+                            additional_data.rtree_level));
+
+      const auto new_data =
         GridTools::internal::distributed_compute_point_locations(
           cache,
-          points,
+          points_to_search,
           global_bboxes,
           additional_data.marked_vertices ? additional_data.marked_vertices() :
                                             std::vector<bool>(),
@@ -129,7 +301,44 @@ namespace Utilities
           true,
           additional_data.enforce_unique_mapping);
 
-      this->reinit(data, cache.get_triangulation(), cache.get_mapping());
+      // step 4: the processes owning the cells of the newly found points
+      // only know the index of the points within the searched subset, so
+      // send them the indices of these points among all points
+      std::map<unsigned int, std::vector<std::pair<unsigned int, unsigned int>>>
+        indices_to_send;
+      for (const auto &[rank, index, enumeration] : new_data.recv_components)
+        {
+          (void)enumeration;
+          auto &indices = indices_to_send[rank];
+          if (indices.empty() || indices.back().first != index)
+            indices.emplace_back(index, indices_to_search[index]);
+
+          data.recv_components.emplace_back(rank,
+                                            indices_to_search[index],
+                                            numbers::invalid_unsigned_int);
+        }
+      const auto received_indices =
+        Utilities::MPI::some_to_some(comm, indices_to_send);
+
+      for (auto component : new_data.send_components)
+        {
+          const auto indices = received_indices.find(std::get<1>(component));
+          Assert(indices != received_indices.end(), ExcInternalError());
+          const auto index = std::lower_bound(
+            indices->second.begin(),
+            indices->second.end(),
+            std::get<2>(component),
+            [](const auto &a, const unsigned int b) { return a.first < b; });
+          Assert(index != indices->second.end() &&
+                   index->first == std::get<2>(component),
+                 ExcInternalError());
+          std::get<2>(component) = index->second;
+          data.send_components.push_back(component);
+        }
+
+      data.finalize_setup();
+
+      this->reinit(data, tria, mapping);
 #endif
     }
 
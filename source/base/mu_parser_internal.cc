@@ -16,12 +16,18 @@
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
+#include <algorithm>
+#include <array>
+#include <cctype>
 #include <cmath>
+#include <cstring>
 #include <ctime>
 #include <limits>
+#include <locale>
 #include <map>
 #include <mutex>
 #include <random>
+#include <sstream>
 #include <vector>
 
 #ifdef DEAL_II_WITH_MUPARSER
@@ -252,10 +258,797 @@ namespace internal
     protected:
       mu::Parser parser;
     };
+
+
+
+    namespace
+    {
+      /**
+       * Define the constants, variables, and functions of the given muParser
+       * object and set its expression. The variable with index @p iv is read
+       * from <code>vars[iv*vars_stride]</code>.
+       */
+      void
+      setup_muparser(mu::Parser                          &parser,
+                     const std::string                   &expression,
+                     const std::map<std::string, double> &constants,
+                     const std::vector<std::string>      &var_names,
+                     double                              *vars,
+                     const unsigned int                   vars_stride)
+      {
+        for (const auto &constant : constants)
+          parser.DefineConst(constant.first, constant.second);
+
+        for (unsigned int iv = 0; iv < var_names.size(); ++iv)
+          parser.DefineVar(var_names[iv], vars + iv * vars_stride);
+
+        // define some compatibility functions:
+        parser.DefineFun("if", mu_if, true);
+        parser.DefineOprt("|", mu_or, 1);
+        parser.DefineOprt("&", mu_and, 2);
+        parser.DefineFun("int", mu_int, true);
+        parser.DefineFun("ceil", mu_ceil, true);
+        parser.DefineFun("cot", mu_cot, true);
+        parser.DefineFun("csc", mu_csc, true);
+        parser.DefineFun("floor", mu_floor, true);
+        parser.DefineFun("sec", mu_sec, true);
+        parser.DefineFun("log", mu_log, true);
+        parser.DefineFun("pow", mu_pow, true);
+        parser.DefineFun("erfc", mu_erfc, true);
+        // Disable optimizations (by passing false) that assume the functions
+        // will always return the same value:
+        parser.DefineFun("rand_seed", mu_rand_seed, false);
+        parser.DefineFun("rand", mu_rand, false);
+
+        try
+          {
+            // muparser expects that functions have no
+            // space between the name of the function and the opening
+            // parenthesis. this is awkward because it is not backward
+            // compatible to the library we used to use before muparser
+            // (the fparser library) but also makes no real sense.
+            // consequently, in the expressions we set, remove any space
+            // we may find after function names
+            std::string transformed_expression = expression;
+
+            for (const auto &current_function_name : get_function_names())
+              {
+                const unsigned int function_name_length =
+                  current_function_name.size();
+
+                std::string::size_type pos = 0;
+                while (true)
+                  {
+                    // try to find any occurrences of the function name
+                    pos =
+                      transformed_expression.find(current_function_name, pos);
+                    if (pos == std::string::npos)
+                      break;
+
+                    // replace whitespace until there no longer is any
+                    while (
+                      (pos + function_name_length <
+                       transformed_expression.size()) &&
+                      ((transformed_expression[pos + function_name_length] ==
+                        ' ') ||
+                       (transformed_expression[pos + function_name_length] ==
+                        '\t')))
+                      transformed_expression.erase(
+                        transformed_expression.begin() + pos +
+                        function_name_length);
+
+                    // move the current search position by the size of the
+                    // actual function name
+                    pos += function_name_length;
+                  }
+              }
+
+            // now use the transformed expression
+            parser.SetExpr(transformed_expression);
+          }
+        catch (mu::ParserError &e)
+          {
+            std::cerr << "Message:  <" << e.GetMsg() << ">\n";
+            std::cerr << "Formula:  <" << e.GetExpr() << ">\n";
+            std::cerr << "Token:    <" << e.GetToken() << ">\n";
+            std::cerr << "Position: <" << e.GetPos() << ">\n";
+            std::cerr << "Errc:     <" << e.GetCode() << ">" << std::endl;
+            AssertThrow(false, ExcParseError(e.GetCode(), e.GetMsg()));
+          }
+      }
+    } // namespace
 #endif
 
 
 
+    class CompiledExpression
+    {
+    public:
+      /**
+       * Translate the given expression. Return a null pointer if the
+       * expression uses features this class does not support, independently
+       * of whether the expression is valid for muParser or not.
+       */
+      static std::unique_ptr<const CompiledExpression>
+      create(const std::string                   &expression,
+             const std::map<std::string, double> &constants,
+             const std::vector<std::string>      &var_names);
+
+      /**
+       * Evaluate the expression for @p n_points points. The values of the
+       * variable with index @p i are read from
+       * <code>vars[i*ParserData::bulk_size+q]</code>, and @p stack provides
+       * the space for the operand stack, see stack_size().
+       */
+      void
+      evaluate(const double      *vars,
+               const unsigned int n_points,
+               double            *stack,
+               double            *results) const;
+
+      /**
+       * Return the number of values required for the operand stack passed to
+       * evaluate().
+       */
+      unsigned int
+      stack_size() const;
+
+    private:
+      /**
+       * The operations of the stack machine.
+       */
+      enum class Opcode
+      {
+        constant,
+        variable,
+        negate,
+        add,
+        subtract,
+        multiply,
+        divide,
+        unary_function,
+        binary_function,
+        ternary_function
+      };
+
+      /**
+       * An instruction of the program, with the operand used by the
+       * respective operation.
+       */
+      struct Instruction
+      {
+        Opcode       opcode;
+        double       value;
+        unsigned int variable;
+        double (*unary_function)(double);
+        double (*binary_function)(double, double);
+        double (*ternary_function)(double, double, double);
+      };
+
+      /**
+       * A recursive-descent parser following the operator precedences and
+       * associativities of muParser. Each function appends the instructions
+       * for the respective subexpression to the program and returns false if
+       * it encounters anything not supported.
+       */
+      class Compiler;
+
+      std::vector<Instruction> program;
+
+      unsigned int max_stack_depth = 0;
+    };
+
+
+
+    class CompiledExpression::Compiler
+    {
+    public:
+      Compiler(const std::string                   &expression,
+               const std::map<std::string, double> &constants,
+               const std::vector<std::string>      &var_names,
+               CompiledExpression                  &result)
+        : expression(expression)
+        , constants(constants)
+        , var_names(var_names)
+        , result(result)
+        , position(0)
+        , stack_depth(0)
+      {}
+
+      bool
+      compile()
+      {
+        return parse_ternary() && (skip_whitespace(), at_end());
+      }
+
+    private:
+      const std::string                   &expression;
+      const std::map<std::string, double> &constants;
+      const std::vector<std::string>      &var_names;
+      CompiledExpression                  &result;
+      std::string::size_type               position;
+      unsigned int                         stack_depth;
+
+      using Instruction = CompiledExpression::Instruction;
+      using Opcode      = CompiledExpression::Opcode;
+
+      void
+      emit(const Instruction &instruction, const int stack_change)
+      {
+        result.program.push_back(instruction);
+        stack_depth += stack_change;
+        result.max_stack_depth =
+          std::max(result.max_stack_depth, stack_depth);
+      }
+
+      void
+      emit(const Opcode opcode)
+      {
+        emit({opcode, 0., 0, nullptr, nullptr, nullptr},
+             opcode == Opcode::negate ? 0 : -1);
+      }
+
+      void
+      emit(double (*function)(double))
+      {
+        emit({Opcode::unary_function, 0., 0, function, nullptr, nullptr}, 0);
+      }
+
+      void
+      emit(double (*function)(double, double))
+      {
+        emit({Opcode::binary_function, 0., 0, nullptr, function, nullptr}, -1);
+      }
+
+      void
+      emit(double (*function)(double, double, double))
+      {
+        emit({Opcode::ternary_function, 0., 0, nullptr, nullptr, function},
+             -2);
+      }
+
+      void
+      skip_whitespace()
+      {
+        while (position < expression.size() &&
+               std::isspace(static_cast<unsigned char>(expression[position])))
+          ++position;
+      }
+
+      bool
+      at_end() const
+      {
+        return position == expression.size();
+      }
+
+      // skip whitespace and consume the given token if it comes next
+      bool
+      accept(const char *token)
+      {
+        skip_whitespace();
+        if (expression.compare(position, std::strlen(token), token) == 0)
+          {
+            position += std::strlen(token);
+            return true;
+          }
+        return false;
+      }
+
+      // ternary := lor ['?' ternary ':' ternary]
+      bool
+      parse_ternary()
+      {
+        if (!parse_binary(0))
+          return false;
+        if (accept("?"))
+          {
+            if (!parse_ternary() || !accept(":") || !parse_ternary())
+              return false;
+            emit([](const double c, const double a, const double b) {
+              return (c != 0.) ? a : b;
+            });
+          }
+        return true;
+      }
+
+      // the binary operators of muParser with equal precedence, from the
+      // lowest precedence to the highest one. the longer operators need to
+      // come first among the operators with the same first character.
+      bool
+      parse_binary(const unsigned int level)
+      {
+        if (level == 4)
+          return parse_unary();
+
+        if (!parse_binary(level + 1))
+          return false;
+        while (true)
+          {
+            skip_whitespace();
+            if (level == 0 && accept("||"))
+              {
+                if (!parse_binary(level + 1))
+                  return false;
+                emit([](const double a, const double b) -> double {
+                  return (a != 0.) || (b != 0.);
+                });
+              }
+            else if (level == 0 && accept("|"))
+              {
+                if (!parse_binary(level + 1))
+                  return false;
+                emit(&mu_or);
+              }
+            else if (level == 1 && accept("&&"))
+              {
+                if (!parse_binary(level + 1))
+                  return false;
+                emit([](const double a, const double b) -> double {
+                  return (a != 0.) && (b != 0.);
+                });
+              }
+            else if (level == 1 && accept("&"))
+              {
+                if (!parse_binary(level + 1))
+                  return false;
+                emit(&mu_and);
+              }
+            else if (level == 2 &&
+                     (expression.compare(position, 2, "<=") == 0 ||
+                      expression.compare(position, 2, ">=") == 0 ||
+                      expression.compare(position, 2, "==") == 0 ||
+                      expression.compare(position, 2, "!=") == 0))
+              {
+                const std::string op = expression.substr(position, 2);
+                position += 2;
+                if (!parse_binary(level + 1))
+                  return false;
+                if (op == "<=")
+                  emit([](const double a, const double b) -> double {
+                    return a <= b;
+                  });
+                else if (op == ">=")
+                  emit([](const double a, const double b) -> double {
+                    return a >= b;
+                  });
+                else if (op == "==")
+                  emit([](const double a, const double b) -> double {
+                    return a == b;
+                  });
+                else
+                  emit([](const double a, const double b) -> double {
+                    return a != b;
+                  });
+              }
+            else if (level == 2 && (accept("<") || accept(">")))
+              {
+                const bool less = (expression[position - 1] == '<');
+                if (!parse_binary(level + 1))
+                  return false;
+                if (less)
+                  emit([](const double a, const double b) -> double {
+                    return a < b;
+                  });
+                else
+                  emit([](const double a, const double b) -> double {
+                    return a > b;
+                  });
+              }
+            else if (level == 3 && (accept("+") || accept("-")))
+              {
+                const bool plus = (expression[position - 1] == '+');
+                if (!parse_binary(level + 1))
+                  return false;
+                emit(plus ? Opcode::add : Opcode::subtract);
+              }
+            else
+              return true;
+          }
+      }
+
+      // unary := ('-' | '+') unary | product
+      bool
+      parse_unary()
+      {
+        if (accept("-"))
+          {
+            if (!parse_unary())
+              return false;
+            emit(Opcode::negate);
+            return true;
+          }
+        else if (accept("+"))
+          return parse_unary();
+        else
+          return parse_product();
+      }
+
+      // product := power {('*' | '/') unary}
+      bool
+      parse_product()
+      {
+        if (!parse_power())
+          return false;
+        while (accept("*") || accept("/"))
+          {
+            const bool multiply = (expression[position - 1] == '*');
+            if (!parse_unary_power())
+              return false;
+            emit(multiply ? Opcode::multiply : Opcode::divide);
+          }
+        return true;
+      }
+
+      // the right operand of '*' and '/', where a sign applies to the
+      // following power only
+      bool
+      parse_unary_power()
+      {
+        if (accept("-"))
+          {
+            if (!parse_unary_power())
+              return false;
+            emit(Opcode::negate);
+            return true;
+          }
+        else if (accept("+"))
+          return parse_unary_power();
+        else
+          return parse_power();
+      }
+
+      // power := primary ['^' unary_power], which is right-associative
+      bool
+      parse_power()
+      {
+        if (!parse_primary())
+          return false;
+        if (accept("^"))
+          {
+            if (!parse_unary_power())
+              return false;
+            emit(&mu_pow);
+          }
+        return true;
+      }
+
+      // primary := number | '(' ternary ')' | function '(' arguments ')'
+      //          | variable | constant
+      bool
+      parse_primary()
+      {
+        skip_whitespace();
+        if (at_end())
+          return false;
+
+        if (accept("("))
+          return parse_ternary() && accept(")");
+
+        const char first = expression[position];
+        if (std::isdigit(static_cast<unsigned char>(first)) || first == '.')
+          return parse_number();
+
+        if (!std::isalpha(static_cast<unsigned char>(first)) && first != '_')
+          return false;
+        const std::string::size_type begin = position;
+        while (
+          position < expression.size() &&
+          (std::isalnum(static_cast<unsigned char>(expression[position])) ||
+           expression[position] == '_'))
+          ++position;
+        const std::string name = expression.substr(begin, position - begin);
+
+        if (accept("("))
+          return parse_function(name);
+
+        for (unsigned int i = 0; i < var_names.size(); ++i)
+          if (var_names[i] == name)
+            {
+              emit({Opcode::variable, 0., i, nullptr, nullptr, nullptr}, 1);
+              return true;
+            }
+
+        // the constants predefined by muParser (_pi and _e) are left to
+        // muParser, whose value of _pi depends on the compiler
+        const auto constant = constants.find(name);
+        if (constant == constants.end())
+          return false;
+        emit(
+          {Opcode::constant, constant->second, 0, nullptr, nullptr, nullptr},
+          1);
+        return true;
+      }
+
+      bool
+      parse_number()
+      {
+        const std::string::size_type begin = position;
+        while (position < expression.size() &&
+               std::isdigit(static_cast<unsigned char>(expression[position])))
+          ++position;
+        if (position < expression.size() && expression[position] == '.')
+          ++position;
+        while (position < expression.size() &&
+               std::isdigit(static_cast<unsigned char>(expression[position])))
+          ++position;
+        if (position < expression.size() &&
+            (expression[position] == 'e' || expression[position] == 'E'))
+          {
+            ++position;
+            if (position < expression.size() &&
+                (expression[position] == '+' || expression[position] == '-'))
+              ++position;
+            if (position == expression.size() ||
+                !std::isdigit(static_cast<unsigned char>(expression[position])))
+              return false;
+            while (position < expression.size() &&
+                   std::isdigit(
+                     static_cast<unsigned char>(expression[position])))
+              ++position;
+          }
+
+        // leave numbers directly followed by a name to muParser
+        if (position < expression.size() &&
+            (std::isalpha(static_cast<unsigned char>(expression[position])) ||
+             expression[position] == '_' || expression[position] == '.'))
+          return false;
+
+        std::istringstream stream(
+          expression.substr(begin, position - begin));
+        stream.imbue(std::locale::classic());
+        double value;
+        stream >> value;
+        if (stream.fail())
+          return false;
+
+        emit({Opcode::constant, value, 0, nullptr, nullptr, nullptr}, 1);
+        return true;
+      }
+
+      // parse the arguments of a function, whose opening parenthesis has
+      // already been consumed, and emit the function call
+      bool
+      parse_function(const std::string &name)
+      {
+        unsigned int n_arguments = 0;
+        if (!accept(")"))
+          {
+            do
+              {
+                if (!parse_ternary())
+                  return false;
+                ++n_arguments;
+              }
+            while (accept(","));
+            if (!accept(")"))
+              return false;
+          }
+
+        using unary_function = double (*)(double);
+        static const std::map<std::string, unary_function> unary_functions = {
+          {"sin", [](const double x) { return std::sin(x); }},
+          {"cos", [](const double x) { return std::cos(x); }},
+          {"tan", [](const double x) { return std::tan(x); }},
+          {"asin", [](const double x) { return std::asin(x); }},
+          {"acos", [](const double x) { return std::acos(x); }},
+          {"atan", [](const double x) { return std::atan(x); }},
+          {"sinh", [](const double x) { return std::sinh(x); }},
+          {"cosh", [](const double x) { return std::cosh(x); }},
+          {"tanh", [](const double x) { return std::tanh(x); }},
+          {"asinh", [](const double x) { return std::asinh(x); }},
+          {"acosh", [](const double x) { return std::acosh(x); }},
+          {"atanh", [](const double x) { return std::atanh(x); }},
+          {"log2", [](const double x) { return std::log(x) / std::log(2.); }},
+          {"log10", [](const double x) { return std::log10(x); }},
+          {"log", &mu_log},
+          {"ln", [](const double x) { return std::log(x); }},
+          {"exp", [](const double x) { return std::exp(x); }},
+          {"sqrt", [](const double x) { return std::sqrt(x); }},
+          {"sign",
+           [](const double x) { return (x < 0) ? -1. : (x > 0) ? 1. : 0.; }},
+          {"rint", [](const double x) { return std::floor(x + 0.5); }},
+          {"abs", [](const double x) { return std::abs(x); }},
+          {"int", &mu_int},
+          {"ceil", &mu_ceil},
+          {"floor", &mu_floor},
+          {"cot", &mu_cot},
+          {"csc", &mu_csc},
+          {"sec", &mu_sec},
+          {"erfc", &mu_erfc}};
+
+        if (const auto f = unary_functions.find(name);
+            f != unary_functions.end())
+          {
+            if (n_arguments != 1)
+              return false;
+            emit(f->second);
+          }
+        else if (name == "atan2" || name == "pow")
+          {
+            if (n_arguments != 2)
+              return false;
+            if (name == "pow")
+              emit(&mu_pow);
+            else
+              emit([](const double y, const double x) {
+                return std::atan2(y, x);
+              });
+          }
+        else if (name == "if")
+          {
+            if (n_arguments != 3)
+              return false;
+            emit(&mu_if);
+          }
+        else if (name == "min" || name == "max" || name == "sum" ||
+                 name == "avg")
+          {
+            // like muParser, accumulate the arguments from left to right
+            if (n_arguments == 0)
+              return false;
+            for (unsigned int i = 1; i < n_arguments; ++i)
+              if (name == "min")
+                emit([](const double a, const double b) {
+                  return std::min(a, b);
+                });
+              else if (name == "max")
+                emit([](const double a, const double b) {
+                  return std::max(a, b);
+                });
+              else
+                emit(Opcode::add);
+            if (name == "avg")
+              {
+                emit({Opcode::constant,
+                      static_cast<double>(n_arguments),
+                      0,
+                      nullptr,
+                      nullptr,
+                      nullptr},
+                     1);
+                emit(Opcode::divide);
+              }
+          }
+        else
+          return false;
+
+        return true;
+      }
+    };
+
+
+
+    std::unique_ptr<const CompiledExpression>
+    CompiledExpression::create(
+      const std::string                   &expression,
+      const std::map<std::string, double> &constants,
+      const std::vector<std::string>      &var_names)
+    {
+      auto     compiled_expression = std::make_unique<CompiledExpression>();
+      Compiler compiler(expression, constants, var_names, *compiled_expression);
+      if (compiler.compile() == false)
+        return nullptr;
+      return compiled_expression;
+    }
+
+
+
+    unsigned int
+    CompiledExpression::stack_size() const
+    {
+      return max_stack_depth * ParserData::bulk_size;
+    }
+
+
+
+    void
+    CompiledExpression::evaluate(const double      *vars,
+                                 const unsigned int n_points,
+                                 double            *stack,
+                                 double            *results) const
+    {
+      constexpr unsigned int bulk_size = ParserData::bulk_size;
+      AssertIndexRange(n_points, bulk_size + 1);
+
+      // pointer to the entry one past the top of the stack
+      double *top = stack;
+      for (const Instruction &instruction : program)
+        switch (instruction.opcode)
+          {
+            case Opcode::constant:
+              std::fill_n(top, n_points, instruction.value);
+              top += bulk_size;
+              break;
+            case Opcode::variable:
+              std::copy_n(vars + instruction.variable * bulk_size,
+                          n_points,
+                          top);
+              top += bulk_size;
+              break;
+            case Opcode::negate:
+              {
+                double *a = top - bulk_size;
+                DEAL_II_OPENMP_SIMD_PRAGMA
+                for (unsigned int q = 0; q < n_points; ++q)
+                  a[q] = -a[q];
+                break;
+              }
+            case Opcode::add:
+              {
+                top -= bulk_size;
+                double       *a = top - bulk_size;
+                const double *b = top;
+                DEAL_II_OPENMP_SIMD_PRAGMA
+                for (unsigned int q = 0; q < n_points; ++q)
+                  a[q] += b[q];
+                break;
+              }
+            case Opcode::subtract:
+              {
+                top -= bulk_size;
+                double       *a = top - bulk_size;
+                const double *b = top;
+                DEAL_II_OPENMP_SIMD_PRAGMA
+                for (unsigned int q = 0; q < n_points; ++q)
+                  a[q] -= b[q];
+                break;
+              }
+            case Opcode::multiply:
+              {
+                top -= bulk_size;
+                double       *a = top - bulk_size;
+                const double *b = top;
+                DEAL_II_OPENMP_SIMD_PRAGMA
+                for (unsigned int q = 0; q < n_points; ++q)
+                  a[q] *= b[q];
+                break;
+              }
+            case Opcode::divide:
+              {
+                top -= bulk_size;
+                double       *a = top - bulk_size;
+                const double *b = top;
+                DEAL_II_OPENMP_SIMD_PRAGMA
+                for (unsigned int q = 0; q < n_points; ++q)
+                  a[q] /= b[q];
+                break;
+              }
+            case Opcode::unary_function:
+              {
+                double *a = top - bulk_size;
+                for (unsigned int q = 0; q < n_points; ++q)
+                  a[q] = instruction.unary_function(a[q]);
+                break;
+              }
+            case Opcode::binary_function:
+              {
+                top -= bulk_size;
+                double       *a = top - bulk_size;
+                const double *b = top;
+                for (unsigned int q = 0; q < n_points; ++q)
+                  a[q] = instruction.binary_function(a[q], b[q]);
+                break;
+              }
+            case Opcode::ternary_function:
+              {
+                top -= 2 * bulk_size;
+                double       *a = top - bulk_size;
+                const double *b = top;
+                const double *c = top + bulk_size;
+                for (unsigned int q = 0; q < n_points; ++q)
+                  a[q] = instruction.ternary_function(a[q], b[q], c[q]);
+                break;
+              }
+            default:
+              DEAL_II_ASSERT_UNREACHABLE();
+          }
+      Assert(top == stack + bulk_size, ExcInternalError());
+
+      std::copy_n(stack, n_points, results);
+    }
+
+
+
     template <int dim, typename Number>
     ParserImplementation<dim, Number>::ParserImplementation()
       : initialized(false)
@@ -296,6 +1089,14 @@ namespace internal
       // user may never call these functions on the current thread, but it gets
       // us error messages about wrong formulas right away
       this->init_muparser();
+
+      // translate the expressions for the evaluation in batches, which does
+      // not depend on the thread
+      this->compiled_expressions.clear();
+      for (const std::string &expression : this->expressions)
+        this->compiled_expressions.emplace_back(
+          CompiledExpression::create(expression, constants, this->var_names));
+
       this->initialized = true;
     }
 
@@ -319,87 +1120,12 @@ namespace internal
       for (unsigned int component = 0; component < n_components; ++component)
         {
           data.parsers.emplace_back(std::make_unique<Parser>());
-          mu::Parser &parser = dynamic_cast<Parser &>(*data.parsers.back());
-
-          for (const auto &constant : this->constants)
-            parser.DefineConst(constant.first, constant.second);
-
-          for (unsigned int iv = 0; iv < this->var_names.size(); ++iv)
-            parser.DefineVar(this->var_names[iv], &data.vars[iv]);
-
-          // define some compatibility functions:
-          parser.DefineFun("if", mu_if, true);
-          parser.DefineOprt("|", mu_or, 1);
-          parser.DefineOprt("&", mu_and, 2);
-          parser.DefineFun("int", mu_int, true);
-          parser.DefineFun("ceil", mu_ceil, true);
-          parser.DefineFun("cot", mu_cot, true);
-          parser.DefineFun("csc", mu_csc, true);
-          parser.DefineFun("floor", mu_floor, true);
-          parser.DefineFun("sec", mu_sec, true);
-          parser.DefineFun("log", mu_log, true);
-          parser.DefineFun("pow", mu_pow, true);
-          parser.DefineFun("erfc", mu_erfc, true);
-          // Disable optimizations (by passing false) that assume the functions
-          // will always return the same value:
-          parser.DefineFun("rand_seed", mu_rand_seed, false);
-          parser.DefineFun("rand", mu_rand, false);
-
-          try
-            {
-              // muparser expects that functions have no
-              // space between the name of the function and the opening
-              // parenthesis. this is awkward because it is not backward
-              // compatible to the library we used to use before muparser
-              // (the fparser library) but also makes no real sense.
-              // consequently, in the expressions we set, remove any space
-              // we may find after function names
-              std::string transformed_expression = this->expressions[component];
-
-              for (const auto &current_function_name : get_function_names())
-                {
-                  const unsigned int function_name_length =
-                    current_function_name.size();
-
-                  std::string::size_type pos = 0;
-                  while (true)
-                    {
-                      // try to find any occurrences of the function name
-                      pos =
-                        transformed_expression.find(current_function_name, pos);
-                      if (pos == std::string::npos)
-                        break;
-
-                      // replace whitespace until there no longer is any
-                      while (
-                        (pos + function_name_length <
-                         transformed_expression.size()) &&
-                        ((transformed_expression[pos + function_name_length] ==
-                          ' ') ||
-                         (transformed_expression[pos + function_name_length] ==
-                          '\t')))
-                        transformed_expression.erase(
-                          transformed_expression.begin() + pos +
-                          function_name_length);
-
-                      // move the current search position by the size of the
-                      // actual function name
-                      pos += function_name_length;
-                    }
-                }
-
-              // now use the transformed expression
-              parser.SetExpr(transformed_expression);
-            }
-          catch (mu::ParserError &e)
-            {
-              std::cerr << "Message:  <" << e.GetMsg() << ">\n";
-              std::cerr << "Formula:  <" << e.GetExpr() << ">\n";
-              std::cerr << "Token:    <" << e.GetToken() << ">\n";
-              std::cerr << "Position: <" << e.GetPos() << ">\n";
-              std::cerr << "Errc:     <" << e.GetCode() << ">" << std::endl;
-              AssertThrow(false, ExcParseError(e.GetCode(), e.GetMsg()));
-            }
+          setup_muparser(dynamic_cast<Parser &>(*data.parsers.back()),
+                         this->expressions[component],
+                         this->constants,
+                         this->var_names,
+                         data.vars.data(),
+                         1);
         }
 #else
       AssertThrow(false, ExcNeedsFunctionparser());
@@ -506,6 +1232,81 @@ namespace internal
 #endif
     }
 
+
+
+    template <int dim, typename Number>
+    void
+    ParserImplementation<dim, Number>::do_value_list(
+      const ArrayView<const Point<dim>> &points,
+      const double                       time,
+      const unsigned int                 first_component,
+      const unsigned int                 n_components,
+      const ArrayView<Number>           &values) const
+    {
+#ifdef DEAL_II_WITH_MUPARSER
+      Assert(this->initialized == true, ExcNotInitialized());
+      AssertIndexRange(first_component + n_components,
+                       this->expressions.size() + 1);
+      AssertDimension(values.size(), n_components * points.size());
+
+      // initialize the parser if that hasn't happened yet on the current
+      // thread
+      internal::FunctionParser::ParserData &data = this->parser_data.get();
+      if (data.vars.empty())
+        init_muparser();
+
+      constexpr unsigned int bulk_size = ParserData::bulk_size;
+      data.bulk_vars.resize(this->n_vars * bulk_size);
+      for (unsigned int c = 0; c < n_components; ++c)
+        if (compiled_expressions[first_component + c] != nullptr)
+          data.bulk_stack.resize(
+            std::max<std::size_t>(
+              data.bulk_stack.size(),
+              compiled_expressions[first_component + c]->stack_size()));
+      std::array<double, bulk_size> results;
+
+      const unsigned int n_points = points.size();
+      for (unsigned int begin = 0; begin < n_points; begin += bulk_size)
+        {
+          const unsigned int n = std::min(n_points - begin, bulk_size);
+
+          // set the variables of all points in the current batch
+          for (unsigned int q = 0; q < n; ++q)
+            for (unsigned int i = 0; i < dim; ++i)
+              data.bulk_vars[i * bulk_size + q] = points[begin + q][i];
+          if (dim != this->n_vars)
+            std::fill_n(data.bulk_vars.begin() + dim * bulk_size, n, time);
+
+          for (unsigned int c = 0; c < n_components; ++c)
+            {
+              const unsigned int component = first_component + c;
+              if (compiled_expressions[component] != nullptr)
+                {
+                  compiled_expressions[component]->evaluate(
+                    data.bulk_vars.data(),
+                    n,
+                    data.bulk_stack.data(),
+                    results.data());
+                  std::copy_n(results.begin(),
+                              n,
+                              values.begin() + c * n_points + begin);
+                }
+              else
+                for (unsigned int q = 0; q < n; ++q)
+                  values[c * n_points + begin + q] =
+                    do_value(points[begin + q], time, component);
+            }
+        }
+#else
+      (void)points;
+      (void)time;
+      (void)first_component;
+      (void)n_components;
+      (void)values;
+      AssertThrow(false, ExcNeedsFunctionparser());
+#endif
+    }
+
 // explicit instantiations
 #include "mu_parser_internal.inst"
 
@@ -19,6 +19,7 @@
 
 #include <boost/serialization/utility.hpp>
 
+#include <algorithm>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -151,6 +152,10 @@ namespace Utilities
     void
     Partitioner::set_owned_indices(const IndexSet &locally_owned_indices)
     {
+#  ifdef DEAL_II_WITH_MPI
+      persistent_request_cache.clear();
+#  endif
+
       my_pid  = Utilities::MPI::this_mpi_process(communicator);
       n_procs = Utilities::MPI::n_mpi_processes(communicator);
 
@@ -185,6 +190,12 @@ namespace Utilities
     Partitioner::set_ghost_indices(const IndexSet &ghost_indices_in,
                                    const IndexSet &larger_ghost_index_set)
     {
+#  ifdef DEAL_II_WITH_MPI
+      // the communication pattern changes, so the persistent requests set up
+      // for the old pattern cannot be used any more
+      persistent_request_cache.clear();
+#  endif
+
       // Set ghost indices from input. To be sure that no entries from the
       // locally owned range are present, subtract the locally owned indices
       // in any case.
@@ -396,20 +407,21 @@ namespace Utilities
 
           // first translate tight ghost indices into indices within the large
           // set:
+          const std::vector<types::global_dof_index> indices_in_larger_set =
+            larger_ghost_index_set.index_within_set(ghost_indices_data);
           std::vector<unsigned int> expanded_numbering;
-          for (const dealii::IndexSet::size_type index : ghost_indices_data)
+          expanded_numbering.reserve(indices_in_larger_set.size());
+          for (const types::global_dof_index index : indices_in_larger_set)
             {
-              Assert(larger_ghost_index_set.is_element(index),
+              Assert(index != numbers::invalid_dof_index,
                      ExcMessage("The given larger ghost index set must contain "
                                 "all indices in the actual index set."));
               Assert(
-                larger_ghost_index_set.index_within_set(index) <
-                  static_cast<types::global_dof_index>(
-                    std::numeric_limits<unsigned int>::max()),
+                index < static_cast<types::global_dof_index>(
+                          std::numeric_limits<unsigned int>::max()),
                 ExcMessage(
                   "Index overflow: This class supports at most 2^32-1 ghost elements"));
-              expanded_numbering.push_back(
-                larger_ghost_index_set.index_within_set(index));
+              expanded_numbering.push_back(index);
             }
 
           // now rework expanded_numbering into ranges and store in:
@@ -482,6 +494,59 @@ namespace Utilities
 
 
 
+    void
+    Partitioner::global_to_local(
+      const ArrayView<const types::global_dof_index> &global_indices,
+      const ArrayView<unsigned int>                  &local_indices) const
+    {
+      AssertDimension(global_indices.size(), local_indices.size());
+
+      if (std::is_sorted(global_indices.begin(), global_indices.end()) ==
+          false)
+        {
+          for (std::size_t i = 0; i < global_indices.size(); ++i)
+            local_indices[i] = global_to_local(global_indices[i]);
+          return;
+        }
+
+      // the indices are sorted, so we only need to move forward through the
+      // intervals of the ghost index set, keeping track of the number of
+      // ghost indices in the intervals we have passed
+      IndexSet::IntervalIterator interval =
+        ghost_indices_data.begin_intervals();
+      const IndexSet::IntervalIterator end_interval =
+        ghost_indices_data.end_intervals();
+      unsigned int n_ghosts_before_interval = 0;
+      for (std::size_t i = 0; i < global_indices.size(); ++i)
+        {
+          const types::global_dof_index global_index = global_indices[i];
+          if (in_local_range(global_index))
+            {
+              local_indices[i] = static_cast<unsigned int>(
+                global_index - local_range_data.first);
+              continue;
+            }
+
+          while (interval != end_interval && interval->last() < global_index)
+            {
+              n_ghosts_before_interval += interval->n_elements();
+              ++interval;
+            }
+
+          const bool is_ghost =
+            interval != end_interval && *interval->begin() <= global_index;
+          Assert(is_ghost, ExcIndexNotPresent(global_index, my_pid));
+          if (is_ghost)
+            local_indices[i] =
+              locally_owned_size() + n_ghosts_before_interval +
+              static_cast<unsigned int>(global_index - *interval->begin());
+          else
+            local_indices[i] = numbers::invalid_unsigned_int;
+        }
+    }
+
+
+
     std::size_t
     Partitioner::memory_consumption() const
     {
@@ -509,6 +574,10 @@ namespace Utilities
       memory += MemoryConsumption::memory_consumption(n_procs);
       memory += MemoryConsumption::memory_consumption(communicator);
       memory += MemoryConsumption::memory_consumption(have_ghost_indices);
+#  ifdef DEAL_II_WITH_MPI
+      for (const auto &entry : persistent_request_cache.entries)
+        memory += sizeof(entry) + sizeof(MPI_Request) * entry.requests.size();
+#  endif
       return memory;
     }
 
@@ -547,6 +616,141 @@ namespace Utilities
         }
     }
 
+
+
+    void
+    Partitioner::set_use_persistent_requests(
+      const bool use_persistent_requests) const
+    {
+      this->use_persistent_requests = use_persistent_requests;
+#  ifdef DEAL_II_WITH_MPI
+      if (use_persistent_requests == false)
+        persistent_request_cache.clear();
+#  endif
+    }
+
+
+
+#  ifdef DEAL_II_WITH_MPI
+    std::vector<MPI_Request> *
+    Partitioner::get_persistent_requests(const void        *send_buffer,
+                                         const void        *receive_buffer,
+                                         const std::size_t  size_of_number,
+                                         const unsigned int mpi_tag,
+                                         const bool         is_export) const
+    {
+      if (use_persistent_requests == false)
+        return nullptr;
+
+      for (auto &entry : persistent_request_cache.entries)
+        if (entry.send_buffer == send_buffer &&
+            entry.receive_buffer == receive_buffer &&
+            entry.size_of_number == size_of_number && entry.mpi_tag == mpi_tag)
+          return &entry.requests;
+
+      // limit the number of buffer pairs we keep requests for, such that
+      // temporary vectors that are re-created all the time do not let the
+      // cache grow without bound; those are then handled by ordinary
+      // non-blocking communication
+      constexpr unsigned int max_n_entries = 32;
+      if (persistent_request_cache.entries.size() >= max_n_entries)
+        return nullptr;
+
+      // for an export, we receive into the ghost array from the owners of
+      // our ghost indices and send to the processes that import from us,
+      // and the other way around for an import
+      const std::vector<std::pair<unsigned int, unsigned int>>
+        &receive_targets = is_export ? ghost_targets_data : import_targets_data;
+      const std::vector<std::pair<unsigned int, unsigned int>> &send_targets =
+        is_export ? import_targets_data : ghost_targets_data;
+
+      PersistentRequestCache::Entry entry;
+      entry.send_buffer    = send_buffer;
+      entry.receive_buffer = receive_buffer;
+      entry.size_of_number = size_of_number;
+      entry.mpi_tag        = mpi_tag;
+      entry.requests.resize(receive_targets.size() + send_targets.size(),
+                            MPI_REQUEST_NULL);
+
+      // the receive buffer is only written to once the requests get started
+      // in the data exchange functions, whose callers own the buffers
+      char *receive_ptr =
+        static_cast<char *>(const_cast<void *>(receive_buffer));
+      for (unsigned int i = 0; i < receive_targets.size(); ++i)
+        {
+          const int ierr =
+            MPI_Recv_init(receive_ptr,
+                          receive_targets[i].second * size_of_number,
+                          MPI_BYTE,
+                          receive_targets[i].first,
+                          mpi_tag,
+                          communicator,
+                          &entry.requests[i]);
+          AssertThrowMPI(ierr);
+          receive_ptr += receive_targets[i].second * size_of_number;
+        }
+
+      char *send_ptr = static_cast<char *>(const_cast<void *>(send_buffer));
+      for (unsigned int i = 0; i < send_targets.size(); ++i)
+        {
+          const int ierr =
+            MPI_Send_init(send_ptr,
+                          send_targets[i].second * size_of_number,
+                          MPI_BYTE,
+                          send_targets[i].first,
+                          mpi_tag,
+                          communicator,
+                          &entry.requests[receive_targets.size() + i]);
+          AssertThrowMPI(ierr);
+          send_ptr += send_targets[i].second * size_of_number;
+        }
+
+      persistent_request_cache.entries.push_back(std::move(entry));
+      return &persistent_request_cache.entries.back().requests;
+    }
+
+
+
+    Partitioner::PersistentRequestCache::PersistentRequestCache(
+      const PersistentRequestCache &)
+    {}
+
+
+
+    Partitioner::PersistentRequestCache &
+    Partitioner::PersistentRequestCache::operator=(
+      const PersistentRequestCache &)
+    {
+      clear();
+      return *this;
+    }
+
+
+
+    Partitioner::PersistentRequestCache::~PersistentRequestCache()
+    {
+      clear();
+    }
+
+
+
+    void
+    Partitioner::PersistentRequestCache::clear()
+    {
+      // do not throw from here, as this function is called from the
+      // destructor; requests of partitioners that outlive MPI are released
+      // by MPI_Finalize anyway
+      int finalized = 0;
+      MPI_Finalized(&finalized);
+      if (finalized == 0)
+        for (Entry &entry : entries)
+          for (MPI_Request &request : entry.requests)
+            if (request != MPI_REQUEST_NULL)
+              MPI_Request_free(&request);
+      entries.clear();
+    }
+#  endif
+
   } // namespace MPI
 
 } // end of namespace Utilities
@@ -13,6 +13,7 @@
 // ------------------------------------------------------------------------
 
 #include <deal.II/base/polynomials_barycentric.h>
+#include <deal.II/base/vectorization.h>
 
 #include <deal.II/grid/reference_cell.h>
 
@@ -251,6 +252,131 @@ BarycentricPolynomials<dim>::evaluate(
 
 
 
+template <int dim>
+void
+BarycentricPolynomials<dim>::evaluate_at_points(
+  const ArrayView<const Point<dim>> &unit_points,
+  Table<2, double>                  &values,
+  Table<2, Tensor<1, dim>>          &grads,
+  Table<2, Tensor<2, dim>>          &grad_grads,
+  Table<2, Tensor<3, dim>>          &third_derivatives,
+  Table<2, Tensor<4, dim>>          &fourth_derivatives) const
+{
+  using VectorizedArrayType = VectorizedArray<double>;
+  constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  const std::size_t  n_polys  = polys.size();
+  const unsigned int n_points = unit_points.size();
+  const auto         check_size = [&](const auto &table) {
+    (void)table;
+    Assert(table.empty() ||
+             (table.n_rows() == n_polys && table.n_cols() == n_points),
+           ExcMessage("The output tables must either be empty or of size "
+                      "n() times the number of points."));
+    return !table.empty();
+  };
+
+  const bool need_values             = check_size(values);
+  const bool need_grads              = check_size(grads);
+  const bool need_grad_grads         = check_size(grad_grads);
+  const bool need_third_derivatives  = check_size(third_derivatives);
+  const bool need_fourth_derivatives = check_size(fourth_derivatives);
+
+  // The derivatives have lower degrees than the polynomials themselves, so
+  // the exponents of the latter determine how many powers we need
+  std::size_t max_exponent = 0;
+  for (const auto &poly : polys)
+    {
+      const TableIndices<dim + 1> degrees = poly.degrees();
+      for (unsigned int d = 0; d < dim + 1; ++d)
+        max_exponent = std::max(max_exponent, degrees[d]);
+    }
+
+  Table<2, VectorizedArrayType> powers(dim + 1, max_exponent + 1);
+  for (unsigned int q0 = 0; q0 < n_points; q0 += n_lanes)
+    {
+      const unsigned int n_filled = std::min(n_points - q0, n_lanes);
+
+      // Convert the points to barycentric coordinates and compute all powers
+      // of them we need. Unused lanes are filled by repeating the last point.
+      for (unsigned int d = 0; d < dim + 1; ++d)
+        powers(d, 0) = 1.;
+      if (max_exponent > 0)
+        {
+          for (unsigned int v = 0; v < n_lanes; ++v)
+            {
+              const Point<dim> &p = unit_points[q0 + std::min(v, n_filled - 1)];
+              double            b_0 = 1.;
+              for (unsigned int d = 0; d < dim; ++d)
+                {
+                  b_0 -= p[d];
+                  powers(d + 1, 1)[v] = p[d];
+                }
+              powers(0, 1)[v] = b_0;
+            }
+          for (unsigned int d = 0; d < dim + 1; ++d)
+            for (unsigned int k = 2; k <= max_exponent; ++k)
+              powers(d, k) = powers(d, k - 1) * powers(d, 1);
+        }
+
+      for (std::size_t i = 0; i < n_polys; ++i)
+        {
+          if (need_values)
+            {
+              const VectorizedArrayType value = polys[i].value(powers);
+              for (unsigned int v = 0; v < n_filled; ++v)
+                values(i, q0 + v) = value[v];
+            }
+
+          if (need_grads)
+            for (unsigned int d = 0; d < dim; ++d)
+              {
+                const VectorizedArrayType value =
+                  poly_grads[i][d].value(powers);
+                for (unsigned int v = 0; v < n_filled; ++v)
+                  grads(i, q0 + v)[d] = value[v];
+              }
+
+          if (need_grad_grads)
+            for (unsigned int d0 = 0; d0 < dim; ++d0)
+              for (unsigned int d1 = 0; d1 < dim; ++d1)
+                {
+                  const VectorizedArrayType value =
+                    poly_hessians[i][d0][d1].value(powers);
+                  for (unsigned int v = 0; v < n_filled; ++v)
+                    grad_grads(i, q0 + v)[d0][d1] = value[v];
+                }
+
+          if (need_third_derivatives)
+            for (unsigned int d0 = 0; d0 < dim; ++d0)
+              for (unsigned int d1 = 0; d1 < dim; ++d1)
+                for (unsigned int d2 = 0; d2 < dim; ++d2)
+                  {
+                    const VectorizedArrayType value =
+                      poly_third_derivatives[i][d0][d1][d2].value(powers);
+                    for (unsigned int v = 0; v < n_filled; ++v)
+                      third_derivatives(i, q0 + v)[d0][d1][d2] = value[v];
+                  }
+
+          if (need_fourth_derivatives)
+            for (unsigned int d0 = 0; d0 < dim; ++d0)
+              for (unsigned int d1 = 0; d1 < dim; ++d1)
+                for (unsigned int d2 = 0; d2 < dim; ++d2)
+                  for (unsigned int d3 = 0; d3 < dim; ++d3)
+                    {
+                      const VectorizedArrayType value =
+                        poly_fourth_derivatives[i][d0][d1][d2][d3].value(
+                          powers);
+                      for (unsigned int v = 0; v < n_filled; ++v)
+                        fourth_derivatives(i, q0 + v)[d0][d1][d2][d3] =
+                          value[v];
+                    }
+        }
+    }
+}
+
+
+
 template <int dim>
 double
 BarycentricPolynomials<dim>::compute_value(const unsigned int i,
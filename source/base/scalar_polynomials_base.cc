@@ -33,6 +33,64 @@ ScalarPolynomialsBase<dim>::ScalarPolynomialsBase(
 
 
 
+template <int dim>
+void
+ScalarPolynomialsBase<dim>::evaluate_at_points(
+  const ArrayView<const Point<dim>> &unit_points,
+  Table<2, double>                  &values,
+  Table<2, Tensor<1, dim>>          &grads,
+  Table<2, Tensor<2, dim>>          &grad_grads,
+  Table<2, Tensor<3, dim>>          &third_derivatives,
+  Table<2, Tensor<4, dim>>          &fourth_derivatives) const
+{
+  const unsigned int n_points = unit_points.size();
+  const auto         check_size = [&](const auto &table) {
+    (void)table;
+    Assert(table.empty() ||
+             (table.n_rows() == n_pols && table.n_cols() == n_points),
+           ExcMessage("The output tables must either be empty or of size "
+                      "n() times the number of points."));
+    return !table.empty();
+  };
+
+  const bool need_values             = check_size(values);
+  const bool need_grads              = check_size(grads);
+  const bool need_grad_grads         = check_size(grad_grads);
+  const bool need_third_derivatives  = check_size(third_derivatives);
+  const bool need_fourth_derivatives = check_size(fourth_derivatives);
+
+  std::vector<double>         point_values(need_values ? n_pols : 0);
+  std::vector<Tensor<1, dim>> point_grads(need_grads ? n_pols : 0);
+  std::vector<Tensor<2, dim>> point_grad_grads(need_grad_grads ? n_pols : 0);
+  std::vector<Tensor<3, dim>> point_third_derivatives(
+    need_third_derivatives ? n_pols : 0);
+  std::vector<Tensor<4, dim>> point_fourth_derivatives(
+    need_fourth_derivatives ? n_pols : 0);
+
+  for (unsigned int q = 0; q < n_points; ++q)
+    {
+      evaluate(unit_points[q],
+               point_values,
+               point_grads,
+               point_grad_grads,
+               point_third_derivatives,
+               point_fourth_derivatives);
+
+      for (unsigned int i = 0; i < point_values.size(); ++i)
+        values(i, q) = point_values[i];
+      for (unsigned int i = 0; i < point_grads.size(); ++i)
+        grads(i, q) = point_grads[i];
+      for (unsigned int i = 0; i < point_grad_grads.size(); ++i)
+        grad_grads(i, q) = point_grad_grads[i];
+      for (unsigned int i = 0; i < point_third_derivatives.size(); ++i)
+        third_derivatives(i, q) = point_third_derivatives[i];
+      for (unsigned int i = 0; i < point_fourth_derivatives.size(); ++i)
+        fourth_derivatives(i, q) = point_fourth_derivatives[i];
+    }
+}
+
+
+
 template <int dim>
 std::size_t
 ScalarPolynomialsBase<dim>::memory_consumption() const
@@ -304,6 +304,8 @@ TimerOutput::TimerOutput(std::ostream         &stream,
   , out_stream(stream, true)
   , output_is_enabled(true)
   , mpi_communicator(MPI_COMM_SELF)
+  , tracing_enabled(false)
+  , n_trace_events_per_thread(0)
 {}
 
 
@@ -316,6 +318,8 @@ TimerOutput::TimerOutput(ConditionalOStream   &stream,
   , out_stream(stream)
   , output_is_enabled(true)
   , mpi_communicator(MPI_COMM_SELF)
+  , tracing_enabled(false)
+  , n_trace_events_per_thread(0)
 {}
 
 
@@ -329,6 +333,8 @@ TimerOutput::TimerOutput(const MPI_Comm        mpi_communicator,
   , out_stream(stream, true)
   , output_is_enabled(true)
   , mpi_communicator(mpi_communicator)
+  , tracing_enabled(false)
+  , n_trace_events_per_thread(0)
 {}
 
 
@@ -342,6 +348,8 @@ TimerOutput::TimerOutput(const MPI_Comm        mpi_communicator,
   , out_stream(stream)
   , output_is_enabled(true)
   , mpi_communicator(mpi_communicator)
+  , tracing_enabled(false)
+  , n_trace_events_per_thread(0)
 {}
 
 
@@ -405,31 +413,89 @@ TimerOutput::enter_subsection(const std::string &section_name)
          ExcMessage("Cannot enter the already active section <" + section_name +
                     ">."));
 
-  if (sections.find(section_name) == sections.end())
-    {
-      if (mpi_communicator != MPI_COMM_SELF)
-        {
-          // create a new timer for this section. the second argument
-          // will ensure that we have an MPI barrier before starting
-          // and stopping a timer, and this ensures that we get the
-          // maximum run time for this section over all processors.
-          // The mpi_communicator from TimerOutput is passed to the
-          // Timer here, so this Timer will collect timing information
-          // among all processes inside mpi_communicator.
-          sections[section_name].timer = Timer(mpi_communicator, true);
-        }
+  auto section = sections.find(section_name);
+  if (section == sections.end())
+    section = create_section(section_name);
+
+  enter_section(section);
+}
+
+
+
+TimerOutput::SectionHandle
+TimerOutput::register_section(const std::string &section_name)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Assert(section_name.empty() == false, ExcMessage("Section string is empty."));
+
+  auto section = sections.find(section_name);
+  if (section == sections.end())
+    section = create_section(section_name);
+
+  return SectionHandle(section->second.index);
+}
 
 
-      sections[section_name].total_cpu_time  = 0;
-      sections[section_name].total_wall_time = 0;
-      sections[section_name].n_calls         = 0;
+
+void
+TimerOutput::enter_subsection(const SectionHandle &section_handle)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Assert(section_handle.is_valid(), ExcMessage("Invalid section handle."));
+  AssertIndexRange(section_handle.index, section_list.size());
+
+  const auto &section = section_list[section_handle.index];
+  Assert(std::find(active_sections.begin(),
+                   active_sections.end(),
+                   section->first) == active_sections.end(),
+         ExcMessage("Cannot enter the already active section <" +
+                    section->first + ">."));
+
+  enter_section(section);
+}
+
+
+
+std::map<std::string, TimerOutput::Section>::iterator
+TimerOutput::create_section(const std::string &section_name)
+{
+  Section &section = sections[section_name];
+  if (mpi_communicator != MPI_COMM_SELF)
+    {
+      // create a new timer for this section. the second argument
+      // will ensure that we have an MPI barrier before starting
+      // and stopping a timer, and this ensures that we get the
+      // maximum run time for this section over all processors.
+      // The mpi_communicator from TimerOutput is passed to the
+      // Timer here, so this Timer will collect timing information
+      // among all processes inside mpi_communicator.
+      section.timer = Timer(mpi_communicator, true);
     }
 
-  sections[section_name].timer.reset();
-  sections[section_name].timer.start();
-  ++sections[section_name].n_calls;
+  section.total_cpu_time  = 0;
+  section.total_wall_time = 0;
+  section.n_calls         = 0;
+  section.index           = section_list.size();
+
+  section_list.push_back(sections.find(section_name));
+  return section_list.back();
+}
+
+
+
+void
+TimerOutput::enter_section(
+  const std::map<std::string, Section>::iterator &section)
+{
+  section->second.timer.reset();
+  section->second.timer.start();
+  ++section->second.n_calls;
+
+  active_sections.push_back(section->first);
 
-  active_sections.push_back(section_name);
+  record_trace_event(section->second.index, true);
 }
 
 
@@ -454,19 +520,50 @@ TimerOutput::leave_subsection(const std::string &section_name)
 
   // if no string is given, exit the last
   // active section.
-  const std::string actual_section_name =
-    (section_name.empty() ? active_sections.back() : section_name);
+  leave_section(sections.find(section_name.empty() ? active_sections.back() :
+                                                     section_name));
+}
+
+
+
+void
+TimerOutput::leave_subsection(const SectionHandle &section_handle)
+{
+  Assert(!active_sections.empty(),
+         ExcMessage("Cannot exit any section because none has been entered!"));
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Assert(section_handle.is_valid(), ExcMessage("Invalid section handle."));
+  AssertIndexRange(section_handle.index, section_list.size());
+  Assert(std::find(active_sections.begin(),
+                   active_sections.end(),
+                   section_list[section_handle.index]->first) !=
+           active_sections.end(),
+         ExcMessage("Cannot delete a section that has not been entered."));
+
+  leave_section(section_list[section_handle.index]);
+}
+
 
-  sections[actual_section_name].timer.stop();
-  sections[actual_section_name].total_wall_time +=
-    sections[actual_section_name].timer.last_wall_time();
+
+void
+TimerOutput::leave_section(
+  const std::map<std::string, Section>::iterator &section)
+{
+  const std::string &actual_section_name = section->first;
+
+  section->second.timer.stop();
+  section->second.total_wall_time += section->second.timer.last_wall_time();
+
+  record_trace_event(section->second.index, false);
 
   // Get cpu time. On MPI systems, if constructed with an mpi_communicator
   // like MPI_COMM_WORLD, then the Timer will sum up the CPU time between
   // processors among the provided mpi_communicator. Therefore, no
   // communication is needed here.
-  const double cpu_time = sections[actual_section_name].timer.last_cpu_time();
-  sections[actual_section_name].total_cpu_time += cpu_time;
+  const double cpu_time = section->second.timer.last_cpu_time();
+  section->second.total_cpu_time += cpu_time;
 
   // in case we have to print out something, do that here...
   if ((output_frequency == every_call ||
@@ -477,7 +574,7 @@ TimerOutput::leave_subsection(const std::string &section_name)
       std::ostringstream cpu;
       cpu << cpu_time << "s";
       std::ostringstream wall;
-      wall << sections[actual_section_name].timer.last_wall_time() << "s";
+      wall << section->second.timer.last_wall_time() << "s";
       if (output_type == cpu_times)
         output_time = ", CPU time: " + cpu.str();
       else if (output_type == wall_times)
@@ -490,10 +587,152 @@ TimerOutput::leave_subsection(const std::string &section_name)
     }
 
   // delete the index from the list of
-  // active ones
-  active_sections.erase(std::find(active_sections.begin(),
-                                  active_sections.end(),
-                                  actual_section_name));
+  // active ones, which is usually the last one
+  if (active_sections.back() == actual_section_name)
+    active_sections.pop_back();
+  else
+    active_sections.erase(std::find(active_sections.begin(),
+                                    active_sections.end(),
+                                    actual_section_name));
+}
+
+
+
+void
+TimerOutput::record_trace_event(const unsigned int section,
+                                const bool         is_begin)
+{
+  if (tracing_enabled == false)
+    return;
+
+  const std::int64_t time =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - trace_start_time)
+      .count();
+
+  TraceBuffer &buffer = trace_buffers[std::this_thread::get_id()];
+  if (buffer.events.empty())
+    {
+      buffer.events.resize(n_trace_events_per_thread);
+      buffer.n_recorded   = 0;
+      buffer.thread_index = trace_buffers.size() - 1;
+    }
+
+  buffer.events[buffer.n_recorded % buffer.events.size()] = {section,
+                                                             is_begin,
+                                                             time};
+  ++buffer.n_recorded;
+}
+
+
+
+void
+TimerOutput::enable_tracing(const unsigned int n_events_per_thread,
+                            const MPI_Comm     mpi_comm)
+{
+  Assert(n_events_per_thread > 0,
+         ExcMessage("The trace buffers need to hold at least one event."));
+
+  // synchronize the processes, so that the times measured relative to
+  // trace_start_time can be compared between them
+#ifdef DEAL_II_WITH_MPI
+  const int ierr = MPI_Barrier(mpi_comm);
+  AssertThrowMPI(ierr);
+#else
+  (void)mpi_comm;
+#endif
+
+  std::lock_guard<std::mutex> lock(mutex);
+  trace_buffers.clear();
+  n_trace_events_per_thread = n_events_per_thread;
+  trace_start_time          = std::chrono::steady_clock::now();
+  tracing_enabled           = true;
+}
+
+
+
+void
+TimerOutput::disable_tracing()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  tracing_enabled = false;
+}
+
+
+
+void
+TimerOutput::write_chrome_trace(std::ostream  &out,
+                                const MPI_Comm mpi_comm) const
+{
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(mpi_comm);
+
+  const auto escape = [](const std::string &name) {
+    std::string escaped;
+    for (const char c : name)
+      {
+        if (c == '"' || c == '\\')
+          escaped += '\\';
+        if (static_cast<unsigned char>(c) >= 0x20)
+          escaped += c;
+      }
+    return escaped;
+  };
+
+  // collect the events of this process as text, which is then collected on
+  // the root process
+  std::ostringstream events;
+  events << std::fixed << std::setprecision(3);
+
+  std::vector<std::string> names(section_list.size());
+  for (unsigned int i = 0; i < section_list.size(); ++i)
+    names[i] = escape(section_list[i]->first);
+
+  for (const auto &[thread_id, buffer] : trace_buffers)
+    {
+      (void)thread_id;
+
+      // if the ring buffer has overflown, start at the oldest event still
+      // available and skip exits of sections whose entry has been
+      // overwritten
+      const std::uint64_t n_events = buffer.events.size();
+      const std::uint64_t first =
+        (buffer.n_recorded > n_events ? buffer.n_recorded - n_events : 0);
+      unsigned int open_count = 0;
+      for (std::uint64_t e = first; e < buffer.n_recorded; ++e)
+        {
+          const TraceEvent &event = buffer.events[e % n_events];
+          if (event.is_begin)
+            ++open_count;
+          else if (open_count == 0)
+            continue;
+          else
+            --open_count;
+
+          events << "{\"name\":\"" << names[event.section]
+                 << "\",\"cat\":\"TimerOutput\",\"ph\":\""
+                 << (event.is_begin ? 'B' : 'E')
+                 << "\",\"ts\":" << 1e-3 * event.time
+                 << ",\"pid\":" << my_rank
+                 << ",\"tid\":" << buffer.thread_index << "},\n";
+        }
+    }
+
+  const std::vector<std::string> all_events =
+    Utilities::MPI::gather(mpi_comm, events.str());
+
+  if (my_rank == 0)
+    {
+      std::string trace;
+      for (const std::string &rank_events : all_events)
+        trace += rank_events;
+
+      // remove the separator after the last event
+      if (trace.size() >= 2)
+        trace.erase(trace.size() - 2);
+
+      out << "{\"traceEvents\":[\n" << trace << "\n],\n"
+          << "\"displayTimeUnit\":\"ms\"}" << std::endl;
+    }
 }
 
 
@@ -1031,7 +1270,9 @@ TimerOutput::reset()
 {
   std::lock_guard<std::mutex> lock(mutex);
   sections.clear();
+  section_list.clear();
   active_sections.clear();
+  trace_buffers.clear();
   timer_all.restart();
 }
 
@@ -42,6 +42,7 @@
 #include <cerrno>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <ctime>
 #include <fstream>
@@ -59,6 +60,15 @@
 #  include <cstdlib>
 #endif
 
+#ifdef __linux__
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  ifdef DEAL_II_HAVE_LINUX_MEMPOLICY_H
+#    include <linux/mempolicy.h>
+#  endif
+#endif
+
 
 #ifdef DEAL_II_WITH_TRILINOS
 #  ifdef DEAL_II_WITH_MPI
@@ -1070,6 +1080,133 @@ namespace Utilities
 
 
 
+    bool
+    MemoryAllocationPolicy::is_default() const
+    {
+      return use_huge_pages == false &&
+             numa_placement == NumaPlacement::first_touch;
+    }
+
+
+
+    namespace
+    {
+      MemoryAllocationPolicy default_memory_allocation_policy;
+
+      // the size of the transparent huge pages on x86-64 and the common
+      // configurations of ARM systems
+      constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+    } // namespace
+
+
+
+    void
+    set_default_memory_allocation_policy(const MemoryAllocationPolicy &policy)
+    {
+      default_memory_allocation_policy = policy;
+    }
+
+
+
+    const MemoryAllocationPolicy &
+    get_default_memory_allocation_policy()
+    {
+      return default_memory_allocation_policy;
+    }
+
+
+
+    std::size_t
+    get_memory_allocation_alignment(const MemoryAllocationPolicy &policy,
+                                    const std::size_t min_alignment,
+                                    const std::size_t size)
+    {
+#ifdef __linux__
+      if (policy.use_huge_pages && size >= huge_page_size)
+        return std::max(min_alignment, huge_page_size);
+      else if (policy.numa_placement !=
+                 MemoryAllocationPolicy::NumaPlacement::first_touch &&
+               size >= static_cast<std::size_t>(sysconf(_SC_PAGESIZE)))
+        return std::max(min_alignment,
+                        static_cast<std::size_t>(sysconf(_SC_PAGESIZE)));
+#else
+      (void)policy;
+      (void)size;
+#endif
+      return min_alignment;
+    }
+
+
+
+    void
+    apply_memory_allocation_policy(void                         *ptr,
+                                   const std::size_t             size,
+                                   const MemoryAllocationPolicy &policy)
+    {
+#ifdef __linux__
+      if (policy.is_default() || ptr == nullptr)
+        return;
+
+      // the system calls only act on whole pages, so restrict the region to
+      // the pages that are completely contained in it
+      const std::uintptr_t page_size = sysconf(_SC_PAGESIZE);
+      const std::uintptr_t begin =
+        (reinterpret_cast<std::uintptr_t>(ptr) + page_size - 1) /
+        page_size * page_size;
+      const std::uintptr_t end =
+        (reinterpret_cast<std::uintptr_t>(ptr) + size) / page_size *
+        page_size;
+      if (end <= begin)
+        return;
+
+      void *const       region      = reinterpret_cast<void *>(begin);
+      const std::size_t region_size = end - begin;
+
+#  ifdef MADV_HUGEPAGE
+      if (policy.use_huge_pages && region_size >= huge_page_size)
+        madvise(region, region_size, MADV_HUGEPAGE);
+#  endif
+
+#  if defined(SYS_mbind) && defined(DEAL_II_HAVE_LINUX_MEMPOLICY_H)
+      if (policy.numa_placement !=
+          MemoryAllocationPolicy::NumaPlacement::first_touch)
+        {
+          // set up the mask of NUMA domains: all domains in case of
+          // interleaving (the kernel restricts the mask to the domains that
+          // exist and that the process is allowed to use), or the given one
+          constexpr unsigned int    bits_per_word = 8 * sizeof(unsigned long);
+          std::vector<unsigned long> node_mask;
+          int                        mode;
+          if (policy.numa_placement ==
+              MemoryAllocationPolicy::NumaPlacement::interleave)
+            {
+              node_mask.resize(1, ~0UL);
+              mode = MPOL_INTERLEAVE;
+            }
+          else
+            {
+              node_mask.resize(policy.numa_node / bits_per_word + 1, 0UL);
+              node_mask.back() |= 1UL << (policy.numa_node % bits_per_word);
+              mode = MPOL_BIND;
+            }
+          syscall(SYS_mbind,
+                  region,
+                  region_size,
+                  mode,
+                  node_mask.data(),
+                  node_mask.size() * bits_per_word + 1,
+                  0U);
+        }
+#  endif
+#else
+      (void)ptr;
+      (void)size;
+      (void)policy;
+#endif
+    }
+
+
+
     bool
     job_supports_mpi()
     {
@@ -16,12 +16,22 @@
 
 #ifdef DEAL_II_WITH_SYMENGINE
 
+#  include <deal.II/base/mpi.h>
+
 #  include <deal.II/differentiation/sd/symengine_optimizer.h>
 #  include <deal.II/differentiation/sd/symengine_utilities.h>
 
+#  include <boost/archive/binary_iarchive.hpp>
+#  include <boost/archive/binary_oarchive.hpp>
 #  include <boost/archive/text_iarchive.hpp>
 #  include <boost/archive/text_oarchive.hpp>
 
+#  include <cstdio>
+#  include <fstream>
+#  include <functional>
+#  include <iterator>
+#  include <sstream>
+#  include <typeinfo>
 #  include <utility>
 
 DEAL_II_NAMESPACE_OPEN
@@ -389,6 +399,110 @@ namespace Differentiation
 
 
 
+    template <typename ReturnType>
+    void
+    BatchOptimizer<ReturnType>::optimize(const MPI_Comm     mpi_communicator,
+                                         const std::string &cache_directory)
+    {
+      Assert(optimized() == false,
+             ExcMessage("Cannot call optimize() more than once."));
+
+      // The lambda optimizer is rebuilt from scratch upon deserialization,
+      // so there is nothing to be gained from sharing its state.
+      if (optimization_method() == OptimizerType::lambda)
+        {
+          optimize();
+          return;
+        }
+
+      const bool is_root =
+        (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0);
+
+      // Identify the problem by a hash of everything that determines the
+      // result of the optimization.
+      std::string cache_file;
+      if (is_root && !cache_directory.empty())
+        {
+          std::ostringstream key;
+          key << DEAL_II_PACKAGE_VERSION << ' ' << typeid(ReturnType).name()
+              << ' '
+              << static_cast<std::underlying_type_t<OptimizerType>>(method)
+              << ' '
+              << static_cast<std::underlying_type_t<OptimizationFlags>>(flags);
+          for (const auto &entry : independent_variables_symbols)
+            key << ' ' << entry.first;
+          for (const auto &function : dependent_variables_functions)
+            key << ' ' << function;
+
+          cache_file = cache_directory + "/batch_optimizer_" +
+                       std::to_string(std::hash<std::string>()(key.str())) +
+                       ".bin";
+        }
+
+      std::string buffer;
+      if (is_root)
+        {
+          if (!cache_file.empty())
+            {
+              std::ifstream in(cache_file, std::ios::binary);
+              if (in)
+                buffer.assign(std::istreambuf_iterator<char>(in),
+                              std::istreambuf_iterator<char>());
+            }
+
+          if (buffer.empty())
+            {
+              optimize();
+
+              std::ostringstream out;
+              {
+                boost::archive::binary_oarchive archive(out);
+                archive << *this;
+              }
+              buffer = out.str();
+
+              // Write to a temporary file first and then rename it, so that
+              // other programs sharing the directory never see an
+              // incomplete file.
+              if (!cache_file.empty())
+                {
+                  const std::string tmp_file =
+                    cache_file + '.' +
+                    dealii::Utilities::System::get_hostname() + '.' +
+                    std::to_string(dealii::Utilities::MPI::this_mpi_process(
+                      MPI_COMM_WORLD));
+                  {
+                    std::ofstream file(tmp_file, std::ios::binary);
+                    file.write(buffer.data(), buffer.size());
+                  }
+                  if (std::rename(tmp_file.c_str(), cache_file.c_str()) != 0)
+                    std::remove(tmp_file.c_str());
+                }
+            }
+        }
+
+      buffer =
+        dealii::Utilities::MPI::broadcast(mpi_communicator, buffer, 0);
+
+      // Unless this is the process that has just performed the optimization,
+      // replace the registered data by the serialized optimized state.
+      if (optimized() == false)
+        {
+          independent_variables_symbols.clear();
+          dependent_variables_functions.clear();
+          dependent_variables_output.clear();
+          map_dep_expr_vec_entry.clear();
+          optimizer.reset();
+          ready_for_value_extraction = false;
+
+          std::istringstream in(buffer);
+          boost::archive::binary_iarchive archive(in);
+          archive >> *this;
+        }
+    }
+
+
+
     template <typename ReturnType>
     void
     BatchOptimizer<ReturnType>::substitute(
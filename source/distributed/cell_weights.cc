@@ -17,6 +17,9 @@
 
 #include <deal.II/dofs/dof_accessor.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -122,6 +125,78 @@ namespace parallel
 
 
 
+  template <int dim, int spacedim>
+  typename CellWeights<dim, spacedim>::WeightingFunction
+  CellWeights<dim, spacedim>::fe_index_weighting(
+    const std::vector<double> &costs,
+    const unsigned int         factor)
+  {
+    Assert(costs.size() > 0, ExcMessage("No costs have been provided."));
+
+    const double max_cost = *std::max_element(costs.begin(), costs.end());
+    Assert(max_cost > 0., ExcMessage("The costs need to be positive."));
+
+    return [costs, factor, max_cost](
+             const typename DoFHandler<dim, spacedim>::cell_iterator &cell,
+             const FiniteElement<dim, spacedim> &future_fe) -> unsigned int {
+      // find the index of the future finite element in the collection
+      const hp::FECollection<dim, spacedim> &fe_collection =
+        cell->get_dof_handler().get_fe_collection();
+      unsigned int fe_index = 0;
+      while (fe_index < fe_collection.size() &&
+             &fe_collection[fe_index] != &future_fe)
+        ++fe_index;
+
+      AssertIndexRange(fe_index, fe_collection.size());
+      AssertIndexRange(fe_index, costs.size());
+
+      const double result = std::round(factor * costs[fe_index] / max_cost);
+
+      Assert(result >= 0. &&
+               result <=
+                 static_cast<double>(std::numeric_limits<unsigned int>::max()),
+             ExcMessage(
+               "Cannot cast determined weight for this cell to unsigned int!"));
+
+      return static_cast<unsigned int>(result);
+    };
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::vector<double>
+  CellWeights<dim, spacedim>::measure_cost_per_fe_index(
+    const unsigned int                             n_fe_indices,
+    const std::function<void(const unsigned int)> &kernel,
+    const MPI_Comm                                 mpi_communicator,
+    const unsigned int                             n_repetitions)
+  {
+    Assert(n_repetitions > 0,
+           ExcMessage("The kernel needs to be run at least once."));
+
+    std::vector<double> costs(n_fe_indices,
+                              std::numeric_limits<double>::max());
+    for (unsigned int fe_index = 0; fe_index < n_fe_indices; ++fe_index)
+      {
+        // warm up caches and let the kernel set up its data structures
+        kernel(fe_index);
+
+        for (unsigned int r = 0; r < n_repetitions; ++r)
+          {
+            const auto start = std::chrono::steady_clock::now();
+            kernel(fe_index);
+            const std::chrono::duration<double> elapsed =
+              std::chrono::steady_clock::now() - start;
+            costs[fe_index] = std::min(costs[fe_index], elapsed.count());
+          }
+      }
+
+    return Utilities::MPI::max(costs, mpi_communicator);
+  }
+
+
+
   // ---------- handling callback functions ----------
 
   template <int dim, int spacedim>
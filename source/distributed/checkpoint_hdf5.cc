@@ -0,0 +1,521 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/config.h>
+
+#ifdef DEAL_II_WITH_HDF5
+
+#  include <deal.II/base/mpi.h>
+
+#  include <deal.II/distributed/checkpoint_hdf5.h>
+
+#  include <deal.II/dofs/dof_accessor.h>
+
+#  include <deal.II/fe/fe.h>
+
+#  include <deal.II/grid/cell_id.h>
+#  include <deal.II/grid/tria_accessor.h>
+#  include <deal.II/grid/tria_iterator.h>
+
+#  include <deal.II/lac/block_vector.h>
+#  include <deal.II/lac/la_parallel_block_vector.h>
+#  include <deal.II/lac/la_parallel_vector.h>
+#  include <deal.II/lac/petsc_block_vector.h>
+#  include <deal.II/lac/petsc_vector.h>
+#  include <deal.II/lac/trilinos_epetra_vector.h>
+#  include <deal.II/lac/trilinos_parallel_block_vector.h>
+#  include <deal.II/lac/trilinos_tpetra_vector.h>
+#  include <deal.II/lac/trilinos_vector.h>
+
+#  include <algorithm>
+#  include <tuple>
+#  include <utility>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace parallel
+{
+  namespace
+  {
+    /**
+     * The number of unsigned integers in the binary representation of a
+     * CellId, i.e., the number of columns of the dataset `cells`.
+     */
+    constexpr unsigned int cell_id_width =
+      std::tuple_size_v<CellId::binary_type>;
+
+
+
+    /**
+     * Return the locally owned active cells of @p triangulation sorted by
+     * their CellId, which is the order of the rows of all datasets.
+     */
+    template <int dim, int spacedim>
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+    get_sorted_locally_owned_cells(
+      const Triangulation<dim, spacedim> &triangulation)
+    {
+      std::vector<std::pair<
+        CellId,
+        typename Triangulation<dim, spacedim>::active_cell_iterator>>
+        cells_with_id;
+      cells_with_id.reserve(triangulation.n_active_cells());
+      for (const auto &cell : triangulation.active_cell_iterators())
+        if (cell->is_locally_owned())
+          cells_with_id.emplace_back(cell->id(), cell);
+
+      std::sort(cells_with_id.begin(),
+                cells_with_id.end(),
+                [](const auto &a, const auto &b) { return a.first < b.first; });
+
+      std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+        cells;
+      cells.reserve(cells_with_id.size());
+      for (const auto &cell : cells_with_id)
+        cells.push_back(cell.second);
+      return cells;
+    }
+
+
+
+    /**
+     * Return the index of the first row of the datasets owned by the
+     * current process, given the number of rows of this process.
+     */
+    types::global_cell_index
+    get_first_row(const MPI_Comm                 mpi_communicator,
+                  const types::global_cell_index n_local_rows)
+    {
+      types::global_cell_index first_row = 0;
+#  ifdef DEAL_II_WITH_MPI
+      const int ierr =
+        MPI_Exscan(&n_local_rows,
+                   &first_row,
+                   1,
+                   Utilities::MPI::mpi_type_id_for_type<decltype(first_row)>,
+                   MPI_SUM,
+                   mpi_communicator);
+      AssertThrowMPI(ierr);
+
+      if (Utilities::MPI::this_mpi_process(mpi_communicator) == 0)
+        first_row = 0;
+#  else
+      (void)mpi_communicator;
+      (void)n_local_rows;
+#  endif
+      return first_row;
+    }
+
+
+
+    /**
+     * Return the number of rows of a chunk for a dataset with @p row_size
+     * bytes per row. The chunks are about one megabyte large, which is a
+     * good compromise between the overhead of the chunk index and the
+     * alignment with the stripes of parallel file systems.
+     */
+    hsize_t
+    get_chunk_rows(const std::size_t row_size)
+    {
+      return std::max<hsize_t>(1, (hsize_t(1) << 20) / std::max<std::size_t>(
+                                                         row_size, 1));
+    }
+
+
+
+    /**
+     * Write the @p n_local_rows rows in @p data, which has @p width columns,
+     * at row @p first_row of @p dataset. All processes need to call this
+     * function, also those without rows.
+     */
+    template <typename Number>
+    void
+    write_rows(HDF5::DataSet             &dataset,
+               const std::vector<Number> &data,
+               const hsize_t              first_row,
+               const hsize_t              n_local_rows,
+               const hsize_t              width)
+    {
+      if (n_local_rows > 0)
+        dataset.write_hyperslab(data, {first_row, 0}, {n_local_rows, width});
+      else
+        dataset.write_none<Number>();
+    }
+
+
+
+    /**
+     * Counterpart of write_rows().
+     */
+    template <typename Number>
+    std::vector<Number>
+    read_rows(HDF5::DataSet &dataset,
+              const hsize_t  first_row,
+              const hsize_t  n_local_rows,
+              const hsize_t  width)
+    {
+      if (n_local_rows > 0)
+        return dataset.read_hyperslab<std::vector<Number>>(
+          {first_row, 0}, {n_local_rows, width});
+
+      dataset.read_none<Number>();
+      return {};
+    }
+
+
+
+    /**
+     * Return the first row of the sorted dataset @p cells with @p n_rows rows
+     * whose CellId is not less than @p key by a binary search. The HDF5 reads
+     * are collective, so all processes perform the same number of steps; if
+     * @p has_key is false, the current process only takes part in the reads.
+     */
+    types::global_cell_index
+    lower_bound_in_dataset(HDF5::DataSet                 &cells,
+                           const types::global_cell_index n_rows,
+                           const CellId                  &key,
+                           const bool                     has_key)
+    {
+      unsigned int n_steps = 0;
+      for (types::global_cell_index c = n_rows; c > 0; c /= 2)
+        ++n_steps;
+
+      types::global_cell_index first = 0;
+      types::global_cell_index count = has_key ? n_rows : 0;
+      for (unsigned int step = 0; step < n_steps; ++step)
+        if (count > 0)
+          {
+            const types::global_cell_index half   = count / 2;
+            const types::global_cell_index middle = first + half;
+
+            const std::vector<unsigned int> row =
+              read_rows<unsigned int>(cells, middle, 1, cell_id_width);
+            CellId::binary_type binary;
+            std::copy(row.begin(), row.end(), binary.begin());
+
+            if (CellId(binary) < key)
+              {
+                first = middle + 1;
+                count -= half + 1;
+              }
+            else
+              count = half;
+          }
+        else
+          cells.read_none<unsigned int>();
+      Assert(count == 0, ExcInternalError());
+
+      return has_key ? first : n_rows;
+    }
+  } // namespace
+
+
+
+  template <int dim, int spacedim>
+  CheckpointHDF5<dim, spacedim>::CheckpointHDF5(const HDF5::Group &group)
+    : group(group)
+  {}
+
+
+
+  template <int dim, int spacedim>
+  void
+  CheckpointHDF5<dim, spacedim>::save(
+    const Triangulation<dim, spacedim> &triangulation)
+  {
+    const auto cells = get_sorted_locally_owned_cells(triangulation);
+    const types::global_cell_index first_row =
+      get_first_row(triangulation.get_mpi_communicator(), cells.size());
+    const types::global_cell_index n_rows =
+      triangulation.n_global_active_cells();
+
+    std::vector<unsigned int> data;
+    data.reserve(cells.size() * cell_id_width);
+    for (const auto &cell : cells)
+      {
+        const CellId::binary_type binary = cell->id().template to_binary<dim>();
+        data.insert(data.end(), binary.begin(), binary.end());
+      }
+
+#  ifdef DEBUG
+    // the rows of all processes have to form one sorted sequence, which is
+    // what allows load() to find the rows of a process by a binary search
+    std::pair<CellId, CellId> my_range;
+    if (cells.empty() == false)
+      my_range = {cells.front()->id(), cells.back()->id()};
+    const std::vector<std::pair<CellId, CellId>> process_ranges =
+      Utilities::MPI::all_gather(triangulation.get_mpi_communicator(),
+                                 my_range);
+    const CellId *last_id = nullptr;
+    for (const auto &range : process_ranges)
+      if (range.first != CellId())
+        {
+          Assert(last_id == nullptr || *last_id < range.first,
+                 ExcMessage("The locally owned cells of the processes do not "
+                            "form contiguous ranges in the order of CellId."));
+          last_id = &range.second;
+        }
+#  endif
+
+    group.set_attribute("dim", dim);
+    group.set_attribute("spacedim", spacedim);
+    group.set_attribute("n_coarse_cells",
+                        static_cast<unsigned int>(
+                          triangulation.n_global_coarse_cells()));
+
+    HDF5::DataSet dataset = group.create_dataset<unsigned int>(
+      "cells",
+      {n_rows, cell_id_width},
+      {get_chunk_rows(cell_id_width * sizeof(unsigned int)), cell_id_width});
+    write_rows(dataset, data, first_row, cells.size(), cell_id_width);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  CheckpointHDF5<dim, spacedim>::load(
+    Triangulation<dim, spacedim> &triangulation) const
+  {
+    AssertThrow(triangulation.n_global_levels() == 1,
+                ExcMessage("The triangulation must only consist of the coarse "
+                           "mesh when loading a checkpoint."));
+    AssertThrow(group.get_attribute<int>("dim") == dim &&
+                  group.get_attribute<int>("spacedim") == spacedim &&
+                  group.get_attribute<unsigned int>("n_coarse_cells") ==
+                    triangulation.n_global_coarse_cells(),
+                ExcCheckpointMismatch());
+
+    const MPI_Comm mpi_communicator = triangulation.get_mpi_communicator();
+    const unsigned int my_rank =
+      Utilities::MPI::this_mpi_process(mpi_communicator);
+
+    HDF5::DataSet              dataset    = group.open_dataset("cells");
+    const std::vector<hsize_t> dimensions = dataset.get_dimensions();
+    AssertThrow(dimensions.size() == 2 && dimensions[1] == cell_id_width,
+                ExcCheckpointMismatch());
+    const types::global_cell_index n_rows = dimensions[0];
+
+    // Refine the cells level by level: a locally owned active cell that is
+    // not stored in the checkpoint must be an ancestor of stored cells. The
+    // locally owned cells form a contiguous range of the sorted rows, so we
+    // only need to read the rows between the first locally owned cell and
+    // the first cell of the next process.
+    while (true)
+      {
+        const auto cells = get_sorted_locally_owned_cells(triangulation);
+
+        const types::global_cell_index my_begin =
+          lower_bound_in_dataset(dataset,
+                                 n_rows,
+                                 cells.empty() ? CellId() :
+                                                 cells.front()->id(),
+                                 cells.empty() == false);
+        const std::vector<types::global_cell_index> begins =
+          Utilities::MPI::all_gather(mpi_communicator, my_begin);
+        types::global_cell_index my_end = n_rows;
+        for (unsigned int p = my_rank + 1; p < begins.size(); ++p)
+          my_end = std::min(my_end, begins[p]);
+        const types::global_cell_index first_row = std::min(my_begin, my_end);
+
+        const std::vector<unsigned int> data =
+          read_rows<unsigned int>(dataset,
+                                  first_row,
+                                  my_end - first_row,
+                                  cell_id_width);
+        std::vector<CellId> stored_ids(my_end - first_row);
+        for (std::size_t i = 0; i < stored_ids.size(); ++i)
+          {
+            CellId::binary_type binary;
+            std::copy_n(data.begin() + i * cell_id_width,
+                        cell_id_width,
+                        binary.begin());
+            stored_ids[i] = CellId(binary);
+          }
+
+        bool any_cell_flagged = false;
+        for (const auto &cell : cells)
+          {
+            const CellId id = cell->id();
+            const auto   position =
+              std::lower_bound(stored_ids.begin(), stored_ids.end(), id);
+            if (position != stored_ids.end() && *position == id)
+              continue;
+
+            AssertThrow(position != stored_ids.end() &&
+                          id.is_ancestor_of(*position),
+                        ExcCheckpointMismatch());
+            cell->set_refine_flag();
+            any_cell_flagged = true;
+          }
+
+        if (Utilities::MPI::logical_or(any_cell_flagged, mpi_communicator) ==
+            false)
+          break;
+
+        triangulation.execute_coarsening_and_refinement();
+      }
+
+    AssertThrow(triangulation.n_global_active_cells() == n_rows,
+                ExcCheckpointMismatch());
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename VectorType>
+  void
+  CheckpointHDF5<dim, spacedim>::save_vector(
+    const std::string               &name,
+    const DoFHandler<dim, spacedim> &dof_handler,
+    const VectorType                &vector)
+  {
+    using Number = typename VectorType::value_type;
+    Assert(dof_handler.has_hp_capabilities() == false, ExcNotImplemented());
+
+    const auto cells =
+      get_sorted_locally_owned_cells(dof_handler.get_triangulation());
+    const types::global_cell_index first_row = get_first_row(
+      dof_handler.get_triangulation().get_mpi_communicator(), cells.size());
+    const types::global_cell_index n_rows =
+      dof_handler.get_triangulation().n_global_active_cells();
+
+    const FiniteElement<dim, spacedim> &fe    = dof_handler.get_fe();
+    const hsize_t                       width = fe.n_dofs_per_cell();
+
+    std::vector<Number> data(cells.size() * width);
+    Vector<Number>      local_values(width);
+    for (std::size_t i = 0; i < cells.size(); ++i)
+      {
+        cells[i]->as_dof_handler_iterator(dof_handler)->get_dof_values(
+          vector, local_values);
+        std::copy(local_values.begin(),
+                  local_values.end(),
+                  data.begin() + i * width);
+      }
+
+    HDF5::DataSet dataset = group.create_dataset<Number>(
+      name, {n_rows, width}, {get_chunk_rows(width * sizeof(Number)), width});
+    dataset.set_attribute("fe", fe.get_name());
+    write_rows(dataset, data, first_row, cells.size(), width);
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename VectorType>
+  void
+  CheckpointHDF5<dim, spacedim>::load_vector(
+    const std::string               &name,
+    const DoFHandler<dim, spacedim> &dof_handler,
+    VectorType                      &vector) const
+  {
+    using Number = typename VectorType::value_type;
+    Assert(dof_handler.has_hp_capabilities() == false, ExcNotImplemented());
+
+    const auto cells =
+      get_sorted_locally_owned_cells(dof_handler.get_triangulation());
+    const types::global_cell_index first_row = get_first_row(
+      dof_handler.get_triangulation().get_mpi_communicator(), cells.size());
+
+    const FiniteElement<dim, spacedim> &fe    = dof_handler.get_fe();
+    const hsize_t                       width = fe.n_dofs_per_cell();
+
+    HDF5::DataSet dataset = group.open_dataset(name);
+    AssertThrow(dataset.get_dimensions() ==
+                    std::vector<hsize_t>(
+                      {dof_handler.get_triangulation().n_global_active_cells(),
+                       width}) &&
+                  dataset.get_attribute<std::string>("fe") == fe.get_name(),
+                ExcCheckpointMismatch());
+
+    const std::vector<Number> data =
+      read_rows<Number>(dataset, first_row, cells.size(), width);
+
+    Vector<Number> local_values(width);
+    for (std::size_t i = 0; i < cells.size(); ++i)
+      {
+        std::copy_n(data.begin() + i * width, width, local_values.begin());
+        cells[i]->as_dof_handler_iterator(dof_handler)->set_dof_values(
+          local_values, vector);
+      }
+
+    vector.compress(VectorOperation::insert);
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename Number>
+  void
+  CheckpointHDF5<dim, spacedim>::save_cell_data(
+    const std::string                  &name,
+    const Triangulation<dim, spacedim> &triangulation,
+    const Vector<Number>               &cell_data)
+  {
+    AssertDimension(cell_data.size(), triangulation.n_active_cells());
+
+    const auto cells = get_sorted_locally_owned_cells(triangulation);
+    const types::global_cell_index first_row =
+      get_first_row(triangulation.get_mpi_communicator(), cells.size());
+    const types::global_cell_index n_rows =
+      triangulation.n_global_active_cells();
+
+    std::vector<Number> data;
+    data.reserve(cells.size());
+    for (const auto &cell : cells)
+      data.push_back(cell_data[cell->active_cell_index()]);
+
+    HDF5::DataSet dataset = group.create_dataset<Number>(
+      name, {n_rows, 1}, {get_chunk_rows(sizeof(Number)), 1});
+    write_rows(dataset, data, first_row, cells.size(), 1);
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename Number>
+  void
+  CheckpointHDF5<dim, spacedim>::load_cell_data(
+    const std::string                  &name,
+    const Triangulation<dim, spacedim> &triangulation,
+    Vector<Number>                     &cell_data) const
+  {
+    const auto cells = get_sorted_locally_owned_cells(triangulation);
+    const types::global_cell_index first_row =
+      get_first_row(triangulation.get_mpi_communicator(), cells.size());
+
+    HDF5::DataSet dataset = group.open_dataset(name);
+    AssertThrow(dataset.get_dimensions() ==
+                  std::vector<hsize_t>(
+                    {triangulation.n_global_active_cells(), 1}),
+                ExcCheckpointMismatch());
+
+    const std::vector<Number> data =
+      read_rows<Number>(dataset, first_row, cells.size(), 1);
+
+    cell_data.reinit(triangulation.n_active_cells());
+    for (std::size_t i = 0; i < cells.size(); ++i)
+      cell_data[cells[i]->active_cell_index()] = data[i];
+  }
+} // namespace parallel
+
+
+// explicit instantiations
+#  include "checkpoint_hdf5.inst"
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif // DEAL_II_WITH_HDF5
@@ -18,9 +18,17 @@
 #include <deal.II/distributed/repartitioning_policy_tools.h>
 #include <deal.II/distributed/tria_base.h>
 
+#include <deal.II/fe/fe.h>
+
 #include <deal.II/grid/cell_id_translator.h>
 #include <deal.II/grid/filtered_iterator.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -175,6 +183,42 @@ namespace RepartitioningPolicyTools
 
 
 
+  template <int dim, int spacedim>
+  MinimalGranularityPolicy<dim, spacedim>::MinimalGranularityPolicy(
+    const FiniteElement<dim, spacedim> &fe,
+    const types::global_dof_index       n_min_dofs)
+    : n_min_cells([&]() {
+      AssertThrow(fe.reference_cell() == ReferenceCells::get_hypercube<dim>(),
+                  ExcNotImplemented(
+                    "The estimate of the number of degrees of freedom per "
+                    "cell is only implemented for hypercube cells."));
+
+      // count the degrees of freedom of each object of a cell, divided by
+      // the number of cells sharing this object on a structured mesh
+      const std::array<unsigned int, 4> n_dofs_per_object = {
+        {fe.n_dofs_per_vertex(),
+         fe.n_dofs_per_line(),
+         fe.n_dofs_per_quad(),
+         fe.n_dofs_per_hex()}};
+      const std::array<unsigned int, 4> n_objects_per_cell = {
+        {GeometryInfo<dim>::vertices_per_cell,
+         GeometryInfo<dim>::lines_per_cell,
+         GeometryInfo<dim>::quads_per_cell,
+         GeometryInfo<dim>::hexes_per_cell}};
+
+      double n_dofs_per_cell = 0.;
+      for (unsigned int d = 0; d <= dim; ++d)
+        n_dofs_per_cell += n_dofs_per_object[d] *
+                           static_cast<double>(n_objects_per_cell[d]) /
+                           Utilities::pow(2, dim - d);
+
+      return static_cast<unsigned int>(std::max(
+        1., std::ceil(n_min_dofs / std::max(n_dofs_per_cell, 1.))));
+    }())
+  {}
+
+
+
   template <int dim, int spacedim>
   LinearAlgebra::distributed::Vector<double>
   MinimalGranularityPolicy<dim, spacedim>::partition(
@@ -308,6 +352,214 @@ namespace RepartitioningPolicyTools
   }
 
 
+
+  template <int dim, int spacedim>
+  GraphPartitioningPolicy<dim, spacedim>::GraphPartitioningPolicy(
+    const std::function<
+      unsigned int(const typename Triangulation<dim, spacedim>::cell_iterator &,
+                   const CellStatus)> &weighting_function,
+    const double                        imbalance_tolerance,
+    const unsigned int                  n_refinement_steps)
+    : weighting_function(
+        weighting_function ?
+          weighting_function :
+          [](const typename Triangulation<dim, spacedim>::cell_iterator &,
+             const CellStatus) { return 1U; })
+    , imbalance_tolerance(imbalance_tolerance)
+    , n_refinement_steps(n_refinement_steps)
+  {
+    Assert(imbalance_tolerance >= 0,
+           ExcMessage("The imbalance tolerance must not be negative."));
+  }
+
+
+
+  template <int dim, int spacedim>
+  LinearAlgebra::distributed::Vector<double>
+  GraphPartitioningPolicy<dim, spacedim>::partition(
+    const Triangulation<dim, spacedim> &tria_in) const
+  {
+#ifndef DEAL_II_WITH_MPI
+    (void)tria_in;
+    return {};
+#else
+
+    const auto tria =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &tria_in);
+
+    Assert(tria, ExcNotImplemented());
+
+    // start from the partition along the space-filling curve
+    LinearAlgebra::distributed::Vector<double> partition =
+      CellWeightPolicy<dim, spacedim>(weighting_function).partition(tria_in);
+
+    const auto mpi_communicator = tria_in.get_mpi_communicator();
+    const auto n_subdomains = Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+    // collect the locally owned cells with their weights and the global
+    // active cell indices of their face neighbors
+    std::vector<types::global_cell_index> cell_indices;
+    std::vector<double>                   weights;
+    std::vector<std::vector<types::global_cell_index>> neighbors;
+    for (const auto &cell :
+         tria->active_cell_iterators() | IteratorFilters::LocallyOwnedCell())
+      {
+        cell_indices.push_back(cell->global_active_cell_index());
+        weights.push_back(
+          weighting_function(cell, CellStatus::cell_will_persist));
+
+        std::vector<types::global_cell_index> cell_neighbors;
+        for (const unsigned int f : cell->face_indices())
+          if (cell->at_boundary(f) == false)
+            {
+              const auto neighbor = cell->neighbor(f);
+              if (neighbor->has_children() && dim == 1)
+                {
+                  auto child = neighbor;
+                  while (child->has_children())
+                    child = child->child(1 - f);
+                  if (child->is_artificial() == false)
+                    cell_neighbors.push_back(child->global_active_cell_index());
+                }
+              else if (neighbor->has_children())
+                {
+                  for (unsigned int sf = 0;
+                       sf < cell->face(f)->n_active_descendants();
+                       ++sf)
+                    {
+                      const auto child =
+                        cell->neighbor_child_on_subface(f, sf);
+                      if (child->is_artificial() == false)
+                        cell_neighbors.push_back(
+                          child->global_active_cell_index());
+                    }
+                }
+              else if (neighbor->is_artificial() == false)
+                cell_neighbors.push_back(neighbor->global_active_cell_index());
+            }
+        neighbors.push_back(std::move(cell_neighbors));
+      }
+
+    const double total_weight =
+      Utilities::MPI::sum(std::accumulate(weights.begin(), weights.end(), 0.),
+                          mpi_communicator);
+    const double max_weight =
+      (1. + imbalance_tolerance) * total_weight / n_subdomains;
+
+    std::vector<double> partition_weights(n_subdomains);
+    std::vector<double> requested_weights(n_subdomains);
+    std::vector<double> global_requested_weights(n_subdomains);
+    std::vector<double> n_connections(n_subdomains);
+
+    unsigned int n_steps_without_moves = 0;
+    for (unsigned int step = 0;
+         step < n_refinement_steps && n_steps_without_moves < 2;
+         ++step)
+      {
+        partition.update_ghost_values();
+
+        std::fill(partition_weights.begin(), partition_weights.end(), 0.);
+        for (unsigned int i = 0; i < cell_indices.size(); ++i)
+          partition_weights[static_cast<unsigned int>(
+            partition[cell_indices[i]])] += weights[i];
+        Utilities::MPI::sum(partition_weights,
+                            mpi_communicator,
+                            partition_weights);
+
+        // determine the best move for each cell at an interface in the
+        // direction allowed in this step, as a tuple (gain, cell, target)
+        const bool move_up = (step % 2 == 0);
+        std::vector<std::tuple<double, unsigned int, unsigned int>> moves;
+        std::fill(requested_weights.begin(), requested_weights.end(), 0.);
+        for (unsigned int i = 0; i < cell_indices.size(); ++i)
+          {
+            const unsigned int current =
+              static_cast<unsigned int>(partition[cell_indices[i]]);
+
+            bool at_interface = false;
+            for (const auto neighbor : neighbors[i])
+              {
+                const unsigned int p =
+                  static_cast<unsigned int>(partition[neighbor]);
+                n_connections[p] += 1;
+                at_interface = at_interface || (p != current);
+              }
+            if (at_interface == false)
+              {
+                for (const auto neighbor : neighbors[i])
+                  n_connections[static_cast<unsigned int>(
+                    partition[neighbor])] = 0;
+                continue;
+              }
+
+            unsigned int best_target = current;
+            double       best_gain   = 0;
+            for (const auto neighbor : neighbors[i])
+              {
+                const unsigned int p =
+                  static_cast<unsigned int>(partition[neighbor]);
+                const double gain = n_connections[p] - n_connections[current];
+                if ((move_up ? p > current : p < current) && gain > best_gain)
+                  {
+                    best_target = p;
+                    best_gain   = gain;
+                  }
+              }
+            for (const auto neighbor : neighbors[i])
+              n_connections[static_cast<unsigned int>(partition[neighbor])] =
+                0;
+
+            if (best_target != current)
+              {
+                moves.emplace_back(best_gain, i, best_target);
+                requested_weights[best_target] += weights[i];
+              }
+          }
+
+        // limit the moves such that no partition grows beyond the maximal
+        // weight: every process may fill the same fraction of the remaining
+        // capacity of a partition as it requested of the total requests,
+        // starting with the moves of largest gain
+        Utilities::MPI::sum(requested_weights,
+                            mpi_communicator,
+                            global_requested_weights);
+        for (unsigned int p = 0; p < n_subdomains; ++p)
+          if (global_requested_weights[p] > 0)
+            requested_weights[p] *=
+              std::clamp((max_weight - partition_weights[p]) /
+                           global_requested_weights[p],
+                         0.,
+                         1.);
+
+        std::stable_sort(moves.begin(),
+                         moves.end(),
+                         [](const auto &a, const auto &b) {
+                           return std::get<0>(a) > std::get<0>(b);
+                         });
+
+        unsigned int n_moves = 0;
+        for (const auto &[gain, i, target] : moves)
+          if (weights[i] <= requested_weights[target])
+            {
+              requested_weights[target] -= weights[i];
+              partition[cell_indices[i]] = target;
+              ++n_moves;
+            }
+
+        partition.zero_out_ghost_values();
+
+        if (Utilities::MPI::sum(n_moves, mpi_communicator) == 0)
+          ++n_steps_without_moves;
+        else
+          n_steps_without_moves = 0;
+      }
+
+    return partition;
+#endif
+  }
+
+
 } // namespace RepartitioningPolicyTools
 
 
@@ -112,6 +112,58 @@ namespace parallel
         partition_settings = partition_zorder;
 #  endif
 
+      // Partition the graph of the active cells with one of the graph
+      // partitioners. If requested, only the root process runs the
+      // partitioner and sends the subdomain ids to all other processes.
+      // The weights of the cells have to be collected before, since this
+      // requires all processes to take part.
+      const auto partition_with_graph_partitioner =
+        [this](const SparsityTools::Partitioner partitioner) {
+          const MPI_Comm mpi_communicator = this->get_mpi_communicator();
+          if (!(settings & partition_on_root_process) ||
+              Utilities::MPI::n_mpi_processes(mpi_communicator) == 1)
+            {
+              GridTools::partition_triangulation(this->n_subdomains,
+                                                 *this,
+                                                 partitioner);
+              return;
+            }
+
+          std::vector<unsigned int> cell_weights;
+          if (!this->signals.weight.empty())
+            {
+              cell_weights.resize(this->n_active_cells(), 0U);
+              for (const auto &cell : this->active_cell_iterators() |
+                                        IteratorFilters::LocallyOwnedCell())
+                cell_weights[cell->active_cell_index()] =
+                  this->signals.weight(cell, CellStatus::cell_will_persist);
+              Utilities::MPI::sum(cell_weights, mpi_communicator, cell_weights);
+            }
+
+          std::vector<unsigned int> partition_indices(this->n_active_cells());
+          if (Utilities::MPI::this_mpi_process(mpi_communicator) == 0)
+            {
+              GridTools::partition_triangulation(this->n_subdomains,
+                                                 cell_weights,
+                                                 *this,
+                                                 partitioner);
+              for (const auto &cell : this->active_cell_iterators())
+                partition_indices[cell->active_cell_index()] =
+                  cell->subdomain_id();
+            }
+          else
+            this->signals.pre_partition();
+
+          Utilities::MPI::broadcast(partition_indices.data(),
+                                    partition_indices.size(),
+                                    0,
+                                    mpi_communicator);
+          for (const auto &cell : this->active_cell_iterators())
+            cell->set_subdomain_id(
+              partition_indices[cell->active_cell_index()]);
+        };
+      (void)partition_with_graph_partitioner;
+
       if (partition_settings == partition_zoltan)
         {
 #  ifndef DEAL_II_TRILINOS_WITH_ZOLTAN
@@ -123,8 +175,7 @@ namespace parallel
                         "a partitioning algorithm that is supported "
                         "by your current configuration."));
 #  else
-          GridTools::partition_triangulation(
-            this->n_subdomains, *this, SparsityTools::Partitioner::zoltan);
+          partition_with_graph_partitioner(SparsityTools::Partitioner::zoltan);
 #  endif
         }
       else if (partition_settings == partition_metis)
@@ -138,9 +189,7 @@ namespace parallel
                         "a partitioning algorithm that is supported "
                         "by your current configuration."));
 #  else
-          GridTools::partition_triangulation(this->n_subdomains,
-                                             *this,
-                                             SparsityTools::Partitioner::metis);
+          partition_with_graph_partitioner(SparsityTools::Partitioner::metis);
 #  endif
         }
       else if (partition_settings == partition_zorder)
@@ -15,6 +15,7 @@
 
 #include <deal.II/base/logstream.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/memory_registry.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/utilities.h>
 
@@ -1766,6 +1767,13 @@ namespace parallel
       , connectivity(nullptr)
       , parallel_forest(nullptr)
     {
+      Assert(!((settings & construct_multigrid_hierarchy) &&
+               (settings & face_neighbor_ghost_layer_only)),
+             ExcMessage("The multigrid hierarchy requires a layer of ghost "
+                        "cells that includes all vertex neighbors, so the "
+                        "flags construct_multigrid_hierarchy and "
+                        "face_neighbor_ghost_layer_only cannot be combined."));
+
       parallel_ghost = nullptr;
     }
 
@@ -2863,12 +2871,18 @@ namespace parallel
             parallel_ghost);
           parallel_ghost = nullptr;
         }
+      // unless requested otherwise, the ghost layer consists of all cells
+      // that share at least a vertex with one of our cells
+      const bool face_neighbors_only =
+        (settings & face_neighbor_ghost_layer_only);
       parallel_ghost = dealii::internal::p4est::functions<dim>::ghost_new(
         parallel_forest,
         (dim == 2 ? typename dealii::internal::p4est::types<dim>::balance_type(
-                      P4EST_CONNECT_CORNER) :
+                      face_neighbors_only ? P4EST_CONNECT_FACE :
+                                            P4EST_CONNECT_CORNER) :
                     typename dealii::internal::p4est::types<dim>::balance_type(
-                      P8EST_CONNECT_CORNER)));
+                      face_neighbors_only ? P8EST_CONNECT_FACE :
+                                            P8EST_CONNECT_CORNER)));
 
       Assert(parallel_ghost, ExcInternalError());
 
@@ -3281,6 +3295,10 @@ namespace parallel
     DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
     void Triangulation<dim, spacedim>::execute_coarsening_and_refinement()
     {
+      MemoryRegistry::Stage memory_stage(
+        "parallel::distributed::Triangulation::"
+        "execute_coarsening_and_refinement");
+
       // do not allow anisotropic refinement
 #  ifdef DEBUG
       for (const auto &cell : this->active_cell_iterators())
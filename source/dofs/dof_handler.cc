@@ -16,6 +16,7 @@
 
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/memory_registry.h>
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/thread_management.h>
 
@@ -2145,6 +2146,8 @@ DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void DoFHandler<dim, spacedim>::distribute_dofs(
   const hp::FECollection<dim, spacedim> &ff)
 {
+  MemoryRegistry::Stage memory_stage("DoFHandler::distribute_dofs");
+
   Assert(this->tria != nullptr,
          ExcMessage(
            "You need to set the Triangulation in the DoFHandler using reinit() "
@@ -2283,6 +2286,8 @@ template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void DoFHandler<dim, spacedim>::distribute_mg_dofs()
 {
+  MemoryRegistry::Stage memory_stage("DoFHandler::distribute_mg_dofs");
+
   AssertThrow(hp_capability_enabled == false, ExcNotImplementedWithHP());
 
   Assert(
@@ -15,6 +15,7 @@
 
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/partitioner.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/types.h>
@@ -1796,6 +1797,45 @@ namespace internal
         /* --------------------- renumber_dofs functionality ---------------- */
 
 
+        /**
+         * Apply the renumbering given by @p new_numbers to all valid entries
+         * of @p dof_indices, which is one of the arrays of DoF indices stored
+         * in DoFHandler::object_dof_indices in the non-hp case. Since every
+         * entry is treated independently of all others, the work is split
+         * into chunks of entries that are processed in parallel; the result
+         * does not depend on the number of threads.
+         *
+         * See renumber_dofs() for the meaning of the other arguments.
+         */
+        static void
+        renumber_dof_indices_in_array(
+          std::vector<types::global_dof_index>       &dof_indices,
+          const std::vector<types::global_dof_index> &new_numbers,
+          const IndexSet                             &indices_we_care_about)
+        {
+          // make sure the index set is compressed before accessing it from
+          // several threads concurrently
+          indices_we_care_about.compress();
+
+          dealii::parallel::apply_to_subranges(
+            std::size_t(0),
+            dof_indices.size(),
+            [&](const std::size_t begin, const std::size_t end) {
+              for (std::size_t k = begin; k < end; ++k)
+                {
+                  types::global_dof_index &i = dof_indices[k];
+                  if (i != numbers::invalid_dof_index)
+                    i = ((indices_we_care_about.size() == 0) ?
+                           new_numbers[i] :
+                           new_numbers[indices_we_care_about.index_within_set(
+                             i)]);
+                }
+            },
+            /* grainsize = */ 4096);
+        }
+
+
+
         /**
          * The part of the renumber_dofs() functionality that operates on faces.
          * This part is dimension dependent and so needs to be implemented in
@@ -1811,11 +1851,9 @@ namespace internal
           DoFHandler<dim, spacedim>                  &dof_handler)
         {
           for (unsigned int d = 1; d < dim; ++d)
-            for (auto &i : dof_handler.object_dof_indices[0][d])
-              if (i != numbers::invalid_dof_index)
-                i = ((indices_we_care_about.size() == 0) ?
-                       new_numbers[i] :
-                       new_numbers[indices_we_care_about.index_within_set(i)]);
+            renumber_dof_indices_in_array(dof_handler.object_dof_indices[0][d],
+                                          new_numbers,
+                                          indices_we_care_about);
         }
 
 
@@ -1836,22 +1874,26 @@ namespace internal
               // correct but also faster; note, however, that dof numbers
               // may be invalid_dof_index, namely when the appropriate
               // vertex/line/etc is unused
-              for (std::vector<types::global_dof_index>::iterator i =
-                     dof_handler.object_dof_indices[0][0].begin();
-                   i != dof_handler.object_dof_indices[0][0].end();
-                   ++i)
-                if (*i != numbers::invalid_dof_index)
-                  *i =
-                    (indices_we_care_about.size() == 0) ?
-                      (new_numbers[*i]) :
-                      (new_numbers[indices_we_care_about.index_within_set(*i)]);
-                else if (check_validity)
+#ifdef DEBUG
+              if (check_validity)
+                for (std::vector<types::global_dof_index>::iterator i =
+                       dof_handler.object_dof_indices[0][0].begin();
+                     i != dof_handler.object_dof_indices[0][0].end();
+                     ++i)
                   // if index is invalid_dof_index: check if this one
                   // really is unused
-                  Assert(dof_handler.get_triangulation().vertex_used(
-                           (i - dof_handler.object_dof_indices[0][0].begin()) /
-                           dof_handler.get_fe().n_dofs_per_vertex()) == false,
-                         ExcInternalError());
+                  if (*i == numbers::invalid_dof_index)
+                    Assert(
+                      dof_handler.get_triangulation().vertex_used(
+                        (i - dof_handler.object_dof_indices[0][0].begin()) /
+                        dof_handler.get_fe().n_dofs_per_vertex()) == false,
+                      ExcInternalError());
+#endif
+
+              renumber_dof_indices_in_array(
+                dof_handler.object_dof_indices[0][0],
+                new_numbers,
+                indices_we_care_about);
               return;
             }
 
@@ -1989,12 +2031,10 @@ namespace internal
               for (unsigned int level = 0;
                    level < dof_handler.object_dof_indices.size();
                    ++level)
-                for (auto &i : dof_handler.object_dof_indices[level][dim])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_dof_indices_in_array(
+                  dof_handler.object_dof_indices[level][dim],
+                  new_numbers,
+                  indices_we_care_about);
               return;
             }
 
@@ -2075,12 +2115,10 @@ namespace internal
           if (dof_handler.hp_capability_enabled == false)
             {
               for (unsigned int d = 1; d < dim; ++d)
-                for (auto &i : dof_handler.object_dof_indices[0][d])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_dof_indices_in_array(
+                  dof_handler.object_dof_indices[0][d],
+                  new_numbers,
+                  indices_we_care_about);
               return;
             }
 
@@ -2170,12 +2208,10 @@ namespace internal
           if (dof_handler.hp_capability_enabled == false)
             {
               for (unsigned int d = 1; d < dim; ++d)
-                for (auto &i : dof_handler.object_dof_indices[0][d])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_dof_indices_in_array(
+                  dof_handler.object_dof_indices[0][d],
+                  new_numbers,
+                  indices_we_care_about);
               return;
             }
 
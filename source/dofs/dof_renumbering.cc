@@ -40,6 +40,8 @@
 #include <deal.II/lac/sparsity_tools.h>
 
 #include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/portable_matrix_free.h>
+#include <deal.II/matrix_free/shape_info.h>
 
 #include <deal.II/multigrid/mg_constrained_dofs.h>
 #include <deal.II/multigrid/mg_tools.h>
@@ -61,6 +63,7 @@
 #include <cmath>
 #include <functional>
 #include <map>
+#include <numeric>
 #include <vector>
 
 
@@ -2437,6 +2440,159 @@ namespace DoFRenumbering
 
 
 
+  template <int dim, int spacedim>
+  std::map<CellId, std::vector<types::global_dof_index>>
+  extract_cell_dof_indices(const DoFHandler<dim, spacedim> &dof_handler)
+  {
+    Assert(dof_handler.has_hp_capabilities() == false, ExcNotImplemented());
+
+    std::map<CellId, std::vector<types::global_dof_index>> cell_dof_indices;
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (cell->is_locally_owned())
+        {
+          std::vector<types::global_dof_index> dof_indices(
+            cell->get_fe().n_dofs_per_cell());
+          cell->get_dof_indices(dof_indices);
+          cell_dof_indices.emplace_hint(cell_dof_indices.end(),
+                                        cell->id(),
+                                        std::move(dof_indices));
+        }
+    return cell_dof_indices;
+  }
+
+
+
+  template <int dim, int spacedim>
+  IndexSet
+  incremental(DoFHandler<dim, spacedim> &dof_handler,
+              const std::map<CellId, std::vector<types::global_dof_index>>
+                &old_cell_dof_indices)
+  {
+    std::vector<types::global_dof_index> renumbering(
+      dof_handler.n_locally_owned_dofs(), numbers::invalid_dof_index);
+    const IndexSet changed_dofs =
+      compute_incremental(renumbering, dof_handler, old_cell_dof_indices);
+
+    if (Utilities::MPI::max(renumbering.size(),
+                            dof_handler.get_mpi_communicator()) > 0)
+      dof_handler.renumber_dofs(renumbering);
+
+    return changed_dofs;
+  }
+
+
+
+  template <int dim, int spacedim>
+  IndexSet
+  compute_incremental(
+    std::vector<types::global_dof_index> &new_dof_indices,
+    const DoFHandler<dim, spacedim>      &dof_handler,
+    const std::map<CellId, std::vector<types::global_dof_index>>
+      &old_cell_dof_indices)
+  {
+    Assert(dof_handler.has_hp_capabilities() == false, ExcNotImplemented());
+
+    const IndexSet &locally_owned = dof_handler.locally_owned_dofs();
+    const types::global_dof_index n_owned_dofs = locally_owned.n_elements();
+    AssertDimension(new_dof_indices.size(), n_owned_dofs);
+
+    // every locally owned DoF gets a key by which the DoFs are sorted. DoFs
+    // on unchanged cells use their old index, all others the smallest old
+    // index of the cell they were created from, together with a running
+    // number that keeps them behind the unchanged DoFs with that index and
+    // in the order in which the cells are traversed
+    using Key = std::pair<types::global_dof_index, types::global_dof_index>;
+    std::vector<Key> keys(n_owned_dofs,
+                          Key(numbers::invalid_dof_index,
+                              numbers::invalid_dof_index));
+
+    std::vector<types::global_dof_index> dof_indices;
+
+    // in a first step, go through the unchanged cells
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (cell->is_locally_owned())
+        {
+          const auto entry = old_cell_dof_indices.find(cell->id());
+          if (entry == old_cell_dof_indices.end() ||
+              entry->second.size() != cell->get_fe().n_dofs_per_cell())
+            continue;
+
+          dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+          cell->get_dof_indices(dof_indices);
+          for (unsigned int i = 0; i < dof_indices.size(); ++i)
+            if (locally_owned.is_element(dof_indices[i]))
+              {
+                Key &key = keys[locally_owned.index_within_set(dof_indices[i])];
+                key      = std::min(key, Key(entry->second[i], 0));
+              }
+        }
+
+    // then, assign the remaining DoFs. the cell they were created from is
+    // found by its position in the sorted list of old cells: the children
+    // of a coarsened cell directly follow the cell itself, and the parent
+    // of a refined cell directly precedes it. if a cell is not related to
+    // any old cell, e.g., because it was owned by another process, the
+    // preceding old cell is the closest one along the space filling curve
+    types::global_dof_index next_position = 1;
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (cell->is_locally_owned())
+        {
+          const CellId id    = cell->id();
+          auto         entry = old_cell_dof_indices.lower_bound(id);
+          if (entry != old_cell_dof_indices.end() && entry->first == id &&
+              entry->second.size() == cell->get_fe().n_dofs_per_cell())
+            continue;
+
+          if ((entry == old_cell_dof_indices.end() ||
+               (entry->first != id && !id.is_ancestor_of(entry->first))) &&
+              entry != old_cell_dof_indices.begin())
+            --entry;
+
+          types::global_dof_index anchor = 0;
+          if (entry != old_cell_dof_indices.end() && !entry->second.empty())
+            anchor = *std::min_element(entry->second.begin(),
+                                       entry->second.end());
+
+          dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+          cell->get_dof_indices(dof_indices);
+          for (const types::global_dof_index dof_index : dof_indices)
+            if (locally_owned.is_element(dof_index))
+              {
+                Key &key = keys[locally_owned.index_within_set(dof_index)];
+                if (key.first == numbers::invalid_dof_index)
+                  key = Key(anchor, next_position++);
+              }
+        }
+
+    // sort the DoFs by their keys and hand out the locally owned indices in
+    // that order
+    std::vector<types::global_dof_index> order(n_owned_dofs);
+    std::iota(order.begin(), order.end(), types::global_dof_index(0));
+    std::sort(order.begin(),
+              order.end(),
+              [&](const types::global_dof_index a,
+                  const types::global_dof_index b) {
+                return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+              });
+
+    IndexSet changed_dofs(dof_handler.n_dofs());
+    std::vector<types::global_dof_index> changed_indices;
+    for (types::global_dof_index i = 0; i < n_owned_dofs; ++i)
+      {
+        Assert(keys[order[i]].first != numbers::invalid_dof_index,
+               ExcInternalError());
+        new_dof_indices[order[i]] = locally_owned.nth_index_in_set(i);
+        if (keys[order[i]].second != 0)
+          changed_indices.push_back(new_dof_indices[order[i]]);
+      }
+    changed_dofs.add_indices(changed_indices.begin(), changed_indices.end());
+    changed_dofs.compress();
+
+    return changed_dofs;
+  }
+
+
+
   template <int dim,
             int spacedim,
             typename Number,
@@ -2900,6 +3056,77 @@ namespace DoFRenumbering
     return new_global_numbers;
   }
 
+
+
+  template <int dim, typename Number>
+  void
+  portable_matrix_free_data_locality(
+    DoFHandler<dim>                         &dof_handler,
+    const Portable::MatrixFree<dim, Number> &matrix_free)
+  {
+    const std::vector<types::global_dof_index> new_global_numbers =
+      compute_portable_matrix_free_data_locality(dof_handler, matrix_free);
+    dof_handler.renumber_dofs(new_global_numbers);
+  }
+
+
+
+  template <int dim, typename Number>
+  std::vector<types::global_dof_index>
+  compute_portable_matrix_free_data_locality(
+    const DoFHandler<dim>                   &dof_handler,
+    const Portable::MatrixFree<dim, Number> &matrix_free)
+  {
+    Assert(&matrix_free.get_dof_handler() == &dof_handler,
+           ExcMessage("The Portable::MatrixFree object needs to be set up "
+                      "with the given DoFHandler to compute a renumbering!"));
+
+    // the threads of a team access the unknowns of a cell in lexicographic
+    // order, as described by the shape info of the device kernels
+    const dealii::internal::MatrixFreeFunctions::ShapeInfo<double>
+      shape_info(QGauss<1>(2), dof_handler.get_fe(), 0);
+    const std::vector<unsigned int> &lexicographic =
+      shape_info.lexicographic_numbering;
+
+    const IndexSet &owned_dofs = dof_handler.locally_owned_dofs();
+    const types::global_dof_index locally_owned_size = owned_dofs.n_elements();
+
+    // number the locally owned unknowns in the order they are first touched
+    // by the teams of the cell loop, color by color
+    std::vector<unsigned int> local_numbering(locally_owned_size,
+                                              numbers::invalid_unsigned_int);
+    unsigned int              counter = 0;
+
+    std::vector<types::global_dof_index> dof_indices(
+      dof_handler.get_fe().n_dofs_per_cell());
+    for (const auto &color : matrix_free.get_colored_graph())
+      for (const auto &cell : color)
+        {
+          cell->get_dof_indices(dof_indices);
+          for (const unsigned int i : lexicographic)
+            if (owned_dofs.is_element(dof_indices[i]))
+              {
+                const types::global_dof_index index =
+                  owned_dofs.index_within_set(dof_indices[i]);
+                if (local_numbering[index] == numbers::invalid_unsigned_int)
+                  local_numbering[index] = counter++;
+              }
+        }
+
+    // unknowns not touched by any cell are placed at the end
+    for (unsigned int &index : local_numbering)
+      if (index == numbers::invalid_unsigned_int)
+        index = counter++;
+    AssertDimension(counter, locally_owned_size);
+
+    std::vector<types::global_dof_index> new_global_numbers(
+      locally_owned_size);
+    for (unsigned int i = 0; i < locally_owned_size; ++i)
+      new_global_numbers[i] = owned_dofs.nth_index_in_set(local_numbering[i]);
+
+    return new_global_numbers;
+  }
+
 } // namespace DoFRenumbering
 
 
@@ -12,6 +12,7 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/graph_coloring.h>
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/quadrature.h>
 #include <deal.II/base/table.h>
@@ -1077,10 +1078,11 @@ namespace DoFTools
     IndexSet dof_set = dof_handler.locally_owned_dofs();
 
     // add the DoF on the adjacent ghost cells to the IndexSet, cache them
-    // in a set. need to check each dof manually because we can't be sure
-    // that the dof range of locally_owned_dofs is really contiguous.
+    // in a vector that is sorted by the index set. need to check each dof
+    // manually because we can't be sure that the dof range of
+    // locally_owned_dofs is really contiguous.
     std::vector<types::global_dof_index> dof_indices;
-    std::set<types::global_dof_index>    global_dof_indices;
+    std::vector<types::global_dof_index> global_dof_indices;
 
     for (const auto &cell : dof_handler.active_cell_iterators() |
                               IteratorFilters::LocallyOwnedCell())
@@ -1090,10 +1092,10 @@ namespace DoFTools
 
         for (const types::global_dof_index dof_index : dof_indices)
           if (!dof_set.is_element(dof_index))
-            global_dof_indices.insert(dof_index);
+            global_dof_indices.push_back(dof_index);
       }
 
-    dof_set.add_indices(global_dof_indices.begin(), global_dof_indices.end());
+    dof_set.add_unsorted_indices(std::move(global_dof_indices));
 
     dof_set.compress();
 
@@ -1122,10 +1124,11 @@ namespace DoFTools
     IndexSet dof_set = dof_handler.locally_owned_mg_dofs(level);
 
     // add the DoF on the adjacent ghost cells to the IndexSet, cache them
-    // in a set. need to check each dof manually because we can't be sure
-    // that the dof range of locally_owned_dofs is really contiguous.
+    // in a vector that is sorted by the index set. need to check each dof
+    // manually because we can't be sure that the dof range of
+    // locally_owned_dofs is really contiguous.
     std::vector<types::global_dof_index> dof_indices;
-    std::set<types::global_dof_index>    global_dof_indices;
+    std::vector<types::global_dof_index> global_dof_indices;
 
     const auto filtered_iterators_range =
       filter_iterators(dof_handler.cell_iterators_on_level(level),
@@ -1137,10 +1140,10 @@ namespace DoFTools
 
         for (const types::global_dof_index dof_index : dof_indices)
           if (!dof_set.is_element(dof_index))
-            global_dof_indices.insert(dof_index);
+            global_dof_indices.push_back(dof_index);
       }
 
-    dof_set.add_indices(global_dof_indices.begin(), global_dof_indices.end());
+    dof_set.add_unsorted_indices(std::move(global_dof_indices));
 
     dof_set.compress();
 
@@ -1190,8 +1193,7 @@ namespace DoFTools
         }
 
     // sort and put into an index set
-    std::sort(dofs_on_ghosts.begin(), dofs_on_ghosts.end());
-    dof_set.add_indices(dofs_on_ghosts.begin(), dofs_on_ghosts.end());
+    dof_set.add_unsorted_indices(std::move(dofs_on_ghosts));
     dof_set.compress();
 
     return dof_set;
@@ -1245,9 +1247,8 @@ namespace DoFTools
             dofs_on_ghosts.push_back(dof_index);
       }
 
-    // sort and fill into an index set
-    std::sort(dofs_on_ghosts.begin(), dofs_on_ghosts.end());
-    dof_set.add_indices(dofs_on_ghosts.begin(), dofs_on_ghosts.end());
+    // sort and put into an index set
+    dof_set.add_unsorted_indices(std::move(dofs_on_ghosts));
     dof_set.compress();
 
     return dof_set;
@@ -2016,6 +2017,55 @@ namespace DoFTools
 
 
 
+  template <int dim, int spacedim, typename number>
+  std::vector<
+    std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>>
+  make_cell_coloring_for_assembly(const DoFHandler<dim, spacedim> &dof_handler,
+                                  const AffineConstraints<number> &constraints)
+  {
+    using CellIterator =
+      typename DoFHandler<dim, spacedim>::active_cell_iterator;
+
+    const CellIterator begin = dof_handler.begin_active();
+    const CellIterator end   = dof_handler.end();
+    if (begin == end)
+      return {};
+
+    // cells that are not locally owned get no conflict indices. they all end
+    // up in the first color and are removed again below
+    const auto get_conflict_indices = [&constraints](const CellIterator &cell) {
+      std::vector<types::global_dof_index> conflict_indices;
+      if (cell->is_locally_owned())
+        {
+          conflict_indices.resize(cell->get_fe().n_dofs_per_cell());
+          cell->get_dof_indices(conflict_indices);
+          constraints.resolve_indices(conflict_indices);
+        }
+      return conflict_indices;
+    };
+
+    std::vector<std::vector<CellIterator>> coloring =
+      GraphColoring::make_graph_coloring(begin, end, get_conflict_indices);
+
+    for (auto &color : coloring)
+      color.erase(std::remove_if(color.begin(),
+                                 color.end(),
+                                 [](const CellIterator &cell) {
+                                   return !cell->is_locally_owned();
+                                 }),
+                  color.end());
+    coloring.erase(std::remove_if(coloring.begin(),
+                                  coloring.end(),
+                                  [](const std::vector<CellIterator> &color) {
+                                    return color.empty();
+                                  }),
+                   coloring.end());
+
+    return coloring;
+  }
+
+
+
   template <int dim, int spacedim>
   void
   count_dofs_with_subdomain_association(
@@ -337,27 +337,28 @@ namespace DoFTools
       /**
        * Make sure that the given @p face_interpolation_matrix pointer points
        * to a valid matrix. If the pointer is zero beforehand, create an entry
-       * with the correct data. If it is nonzero, don't touch it.
+       * with the correct data, taken from the cache of interpolation matrices
+       * in @p fe_collection. If it is nonzero, don't touch it.
        */
       template <int dim, int spacedim>
       void
       ensure_existence_of_face_matrix(
-        const FiniteElement<dim, spacedim>  &fe1,
-        const FiniteElement<dim, spacedim>  &fe2,
-        std::unique_ptr<FullMatrix<double>> &matrix)
+        const hp::FECollection<dim, spacedim> &fe_collection,
+        const unsigned int                     fe_index_1,
+        const unsigned int                     fe_index_2,
+        std::unique_ptr<FullMatrix<double>>   &matrix)
       {
         // TODO: the implementation makes the assumption that all faces have the
         // same number of dofs
-        AssertDimension(fe1.n_unique_faces(), 1);
-        AssertDimension(fe2.n_unique_faces(), 1);
+        AssertDimension(fe_collection[fe_index_1].n_unique_faces(), 1);
+        AssertDimension(fe_collection[fe_index_2].n_unique_faces(), 1);
         const unsigned int face_no = 0;
 
         if (matrix == nullptr)
-          {
-            matrix = std::make_unique<FullMatrix<double>>(
-              fe2.n_dofs_per_face(face_no), fe1.n_dofs_per_face(face_no));
-            fe1.get_face_interpolation_matrix(fe2, *matrix, face_no);
-          }
+          matrix = std::make_unique<FullMatrix<double>>(
+            fe_collection.get_face_interpolation_matrix(fe_index_1,
+                                                        fe_index_2,
+                                                        face_no));
       }
 
 
@@ -368,26 +369,24 @@ namespace DoFTools
       template <int dim, int spacedim>
       void
       ensure_existence_of_subface_matrix(
-        const FiniteElement<dim, spacedim>  &fe1,
-        const FiniteElement<dim, spacedim>  &fe2,
-        const unsigned int                   subface,
-        std::unique_ptr<FullMatrix<double>> &matrix)
+        const hp::FECollection<dim, spacedim> &fe_collection,
+        const unsigned int                     fe_index_1,
+        const unsigned int                     fe_index_2,
+        const unsigned int                     subface,
+        std::unique_ptr<FullMatrix<double>>   &matrix)
       {
         // TODO: the implementation makes the assumption that all faces have the
         // same number of dofs
-        AssertDimension(fe1.n_unique_faces(), 1);
-        AssertDimension(fe2.n_unique_faces(), 1);
+        AssertDimension(fe_collection[fe_index_1].n_unique_faces(), 1);
+        AssertDimension(fe_collection[fe_index_2].n_unique_faces(), 1);
         const unsigned int face_no = 0;
 
         if (matrix == nullptr)
-          {
-            matrix = std::make_unique<FullMatrix<double>>(
-              fe2.n_dofs_per_face(face_no), fe1.n_dofs_per_face(face_no));
-            fe1.get_subface_interpolation_matrix(fe2,
-                                                 subface,
-                                                 *matrix,
-                                                 face_no);
-          }
+          matrix = std::make_unique<FullMatrix<double>>(
+            fe_collection.get_subface_interpolation_matrix(fe_index_1,
+                                                           fe_index_2,
+                                                           subface,
+                                                           face_no));
       }
 
 
@@ -2533,8 +2532,9 @@ namespace DoFTools
                             // result of projection verifies the approximation
                             // properties of a finite element onto that mesh
                             ensure_existence_of_subface_matrix(
-                              cell->get_fe(),
-                              subface->get_fe(subface_fe_index),
+                              dof_handler.get_fe_collection(),
+                              cell->active_fe_index(),
+                              subface_fe_index,
                               c,
                               subface_interpolation_matrices
                                 [cell->active_fe_index()][subface_fe_index][c]);
@@ -2614,8 +2614,9 @@ namespace DoFTools
                                ExcInternalError());
 
                         ensure_existence_of_face_matrix(
-                          dominating_fe,
-                          cell->get_fe(),
+                          fe_collection,
+                          dominating_fe_index,
+                          cell->active_fe_index(),
                           face_interpolation_matrices[dominating_fe_index]
                                                      [cell->active_fe_index()]);
 
@@ -2725,8 +2726,9 @@ namespace DoFTools
                                      subface_fe.n_dofs_per_face(face),
                                    ExcInternalError());
                             ensure_existence_of_subface_matrix(
-                              dominating_fe,
-                              subface_fe,
+                              fe_collection,
+                              dominating_fe_index,
+                              subface_fe_index,
                               sf,
                               subface_interpolation_matrices
                                 [dominating_fe_index][subface_fe_index][sf]);
@@ -2825,8 +2827,9 @@ namespace DoFTools
                             // make sure the element constraints for this face
                             // are available
                             ensure_existence_of_face_matrix(
-                              cell->get_fe(),
-                              neighbor->get_fe(),
+                              dof_handler.get_fe_collection(),
+                              cell->active_fe_index(),
+                              neighbor->active_fe_index(),
                               face_interpolation_matrices
                                 [cell->active_fe_index()]
                                 [neighbor->active_fe_index()]);
@@ -2930,8 +2933,9 @@ namespace DoFTools
                                    ExcInternalError());
 
                             ensure_existence_of_face_matrix(
-                              dominating_fe,
-                              cell->get_fe(),
+                              fe_collection,
+                              dominating_fe_index,
+                              cell->active_fe_index(),
                               face_interpolation_matrices
                                 [dominating_fe_index][cell->active_fe_index()]);
 
@@ -3017,8 +3021,9 @@ namespace DoFTools
                                    ExcInternalError());
 
                             ensure_existence_of_face_matrix(
-                              dominating_fe,
-                              neighbor->get_fe(),
+                              fe_collection,
+                              dominating_fe_index,
+                              neighbor->active_fe_index(),
                               face_interpolation_matrices
                                 [dominating_fe_index]
                                 [neighbor->active_fe_index()]);
@@ -12,10 +12,13 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/memory_registry.h>
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/table.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/utilities.h>
+#include <deal.II/base/work_stream.h>
 
 #include <deal.II/distributed/shared_tria.h>
 #include <deal.II/distributed/tria_base.h>
@@ -51,6 +54,154 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace DoFTools
 {
+  namespace internal
+  {
+    namespace
+    {
+      /**
+       * A class that records all the entries added to it through the
+       * interface of SparsityPatternBase, in the order in which they are
+       * added, so that they can later be added to another sparsity pattern.
+       * This allows to run the (thread-safe) generation of the entries of
+       * several cells in parallel and to only add them to the actual
+       * sparsity pattern, which is not thread-safe, sequentially.
+       */
+      class SparsityPatternEntryBuffer : public SparsityPatternBase
+      {
+      public:
+        SparsityPatternEntryBuffer(const size_type rows, const size_type cols)
+          : SparsityPatternBase(rows, cols)
+        {}
+
+        virtual void
+        add_row_entries(const size_type                  &row,
+                        const ArrayView<const size_type> &columns,
+                        const bool indices_are_sorted = false) override
+        {
+          row_indices.push_back(row);
+          row_is_sorted.push_back(indices_are_sorted);
+          column_indices.insert(column_indices.end(),
+                                columns.begin(),
+                                columns.end());
+          row_ends.push_back(column_indices.size());
+        }
+
+        using SparsityPatternBase::add_entries;
+
+        /**
+         * Add all recorded entries to @p sparsity, in the same order and
+         * with the same granularity as they were added to this object.
+         */
+        void
+        flush(SparsityPatternBase &sparsity) const
+        {
+          std::size_t row_begin = 0;
+          for (unsigned int r = 0; r < row_indices.size(); ++r)
+            {
+              sparsity.add_row_entries(
+                row_indices[r],
+                make_array_view(column_indices.data() + row_begin,
+                                column_indices.data() + row_ends[r]),
+                row_is_sorted[r]);
+              row_begin = row_ends[r];
+            }
+        }
+
+        void
+        clear()
+        {
+          row_indices.clear();
+          row_is_sorted.clear();
+          row_ends.clear();
+          column_indices.clear();
+        }
+
+      private:
+        std::vector<size_type>   row_indices;
+        std::vector<bool>        row_is_sorted;
+        std::vector<std::size_t> row_ends;
+        std::vector<size_type>   column_indices;
+      };
+
+
+
+      /**
+       * Scratch arrays for the DoF indices of a cell and one of its
+       * neighbors used by the functions generating sparsity patterns.
+       */
+      struct SparsityScratchData
+      {
+        std::vector<types::global_dof_index> dofs_on_this_cell;
+        std::vector<types::global_dof_index> dofs_on_other_cell;
+      };
+
+
+
+      /**
+       * Call @p cell_function for all locally owned active cells of @p dof
+       * with the given @p subdomain_id, passing the cell, scratch arrays,
+       * and a sparsity pattern into which @p cell_function adds its entries.
+       *
+       * If more than one thread is available, the cells are processed in
+       * parallel with WorkStream::run(). The entries of every cell are then
+       * first recorded in a SparsityPatternEntryBuffer and added to
+       * @p sparsity sequentially in the order of the cells, so that the
+       * result is the same as with a single thread.
+       */
+      template <int dim, int spacedim, typename CellFunction>
+      void
+      loop_over_locally_owned_cells(const DoFHandler<dim, spacedim> &dof,
+                                    const types::subdomain_id subdomain_id,
+                                    SparsityPatternBase      &sparsity,
+                                    const CellFunction       &cell_function)
+      {
+        using CellIterator =
+          typename DoFHandler<dim, spacedim>::active_cell_iterator;
+
+        // In case we work with a distributed sparsity pattern of Trilinos
+        // type, we only have to do the work if the current cell is owned by
+        // the calling processor. Otherwise, just continue.
+        const auto cell_is_relevant = [subdomain_id](const CellIterator &cell) {
+          return ((subdomain_id == numbers::invalid_subdomain_id) ||
+                  (subdomain_id == cell->subdomain_id())) &&
+                 cell->is_locally_owned();
+        };
+
+        SparsityScratchData sample_scratch_data;
+        sample_scratch_data.dofs_on_this_cell.reserve(
+          dof.get_fe_collection().max_dofs_per_cell());
+        sample_scratch_data.dofs_on_other_cell.reserve(
+          dof.get_fe_collection().max_dofs_per_cell());
+
+        if (MultithreadInfo::n_threads() == 1)
+          {
+            for (const auto &cell : dof.active_cell_iterators())
+              if (cell_is_relevant(cell))
+                cell_function(cell, sample_scratch_data, sparsity);
+            return;
+          }
+
+        WorkStream::run(
+          dof.begin_active(),
+          dof.end(),
+          [&](const CellIterator         &cell,
+              SparsityScratchData        &scratch_data,
+              SparsityPatternEntryBuffer &entries) {
+            entries.clear();
+            if (cell_is_relevant(cell))
+              cell_function(cell, scratch_data, entries);
+          },
+          [&](const SparsityPatternEntryBuffer &entries) {
+            entries.flush(sparsity);
+          },
+          sample_scratch_data,
+          SparsityPatternEntryBuffer(sparsity.n_rows(), sparsity.n_cols()));
+      }
+    } // namespace
+  }   // namespace internal
+
+
+
   template <int dim, int spacedim, typename number>
   void
   make_sparsity_pattern(const DoFHandler<dim, spacedim> &dof,
@@ -59,6 +210,8 @@ namespace DoFTools
                         const bool                       keep_constrained_dofs,
                         const types::subdomain_id        subdomain_id)
   {
+    MemoryRegistry::Stage memory_stage("DoFTools::make_sparsity_pattern");
+
     const types::global_dof_index n_dofs = dof.n_dofs();
     (void)n_dofs;
 
@@ -82,28 +235,26 @@ namespace DoFTools
                  "locally owned one does not make sense."));
       }
 
-    std::vector<types::global_dof_index> dofs_on_this_cell;
-    dofs_on_this_cell.reserve(dof.get_fe_collection().max_dofs_per_cell());
-
-    // In case we work with a distributed sparsity pattern of Trilinos
-    // type, we only have to do the work if the current cell is owned by
-    // the calling processor. Otherwise, just continue.
-    for (const auto &cell : dof.active_cell_iterators())
-      if (((subdomain_id == numbers::invalid_subdomain_id) ||
-           (subdomain_id == cell->subdomain_id())) &&
-          cell->is_locally_owned())
-        {
-          const unsigned int dofs_per_cell = cell->get_fe().n_dofs_per_cell();
-          dofs_on_this_cell.resize(dofs_per_cell);
-          cell->get_dof_indices(dofs_on_this_cell);
-
-          // make sparsity pattern for this cell. if no constraints pattern
-          // was given, then the following call acts as if simply no
-          // constraints existed
-          constraints.add_entries_local_to_global(dofs_on_this_cell,
-                                                  sparsity,
-                                                  keep_constrained_dofs);
-        }
+    internal::loop_over_locally_owned_cells(
+      dof,
+      subdomain_id,
+      sparsity,
+      [&](const typename DoFHandler<dim, spacedim>::active_cell_iterator &cell,
+          internal::SparsityScratchData &scratch_data,
+          SparsityPatternBase           &cell_sparsity) {
+        std::vector<types::global_dof_index> &dofs_on_this_cell =
+          scratch_data.dofs_on_this_cell;
+        const unsigned int dofs_per_cell = cell->get_fe().n_dofs_per_cell();
+        dofs_on_this_cell.resize(dofs_per_cell);
+        cell->get_dof_indices(dofs_on_this_cell);
+
+        // make sparsity pattern for this cell. if no constraints pattern
+        // was given, then the following call acts as if simply no
+        // constraints existed
+        constraints.add_entries_local_to_global(dofs_on_this_cell,
+                                                cell_sparsity,
+                                                keep_constrained_dofs);
+      });
   }
 
 
@@ -167,33 +318,31 @@ namespace DoFTools
               bool_dof_mask[f](i, j) = true;
       }
 
-    std::vector<types::global_dof_index> dofs_on_this_cell(
-      fe_collection.max_dofs_per_cell());
-
-    // In case we work with a distributed sparsity pattern of Trilinos
-    // type, we only have to do the work if the current cell is owned by
-    // the calling processor. Otherwise, just continue.
-    for (const auto &cell : dof.active_cell_iterators())
-      if (((subdomain_id == numbers::invalid_subdomain_id) ||
-           (subdomain_id == cell->subdomain_id())) &&
-          cell->is_locally_owned())
-        {
-          const types::fe_index fe_index = cell->active_fe_index();
-          const unsigned int    dofs_per_cell =
-            fe_collection[fe_index].n_dofs_per_cell();
-
-          dofs_on_this_cell.resize(dofs_per_cell);
-          cell->get_dof_indices(dofs_on_this_cell);
-
-
-          // make sparsity pattern for this cell. if no constraints pattern
-          // was given, then the following call acts as if simply no
-          // constraints existed
-          constraints.add_entries_local_to_global(dofs_on_this_cell,
-                                                  sparsity,
-                                                  keep_constrained_dofs,
-                                                  bool_dof_mask[fe_index]);
-        }
+    internal::loop_over_locally_owned_cells(
+      dof,
+      subdomain_id,
+      sparsity,
+      [&](const typename DoFHandler<dim, spacedim>::active_cell_iterator &cell,
+          internal::SparsityScratchData &scratch_data,
+          SparsityPatternBase           &cell_sparsity) {
+        std::vector<types::global_dof_index> &dofs_on_this_cell =
+          scratch_data.dofs_on_this_cell;
+        const types::fe_index fe_index = cell->active_fe_index();
+        const unsigned int    dofs_per_cell =
+          fe_collection[fe_index].n_dofs_per_cell();
+
+        dofs_on_this_cell.resize(dofs_per_cell);
+        cell->get_dof_indices(dofs_on_this_cell);
+
+
+        // make sparsity pattern for this cell. if no constraints pattern
+        // was given, then the following call acts as if simply no
+        // constraints existed
+        constraints.add_entries_local_to_global(dofs_on_this_cell,
+                                                cell_sparsity,
+                                                keep_constrained_dofs,
+                                                bool_dof_mask[fe_index]);
+      });
   }
 
 
@@ -555,139 +704,138 @@ namespace DoFTools
                  "locally owned one does not make sense."));
       }
 
-    std::vector<types::global_dof_index> dofs_on_this_cell;
-    std::vector<types::global_dof_index> dofs_on_other_cell;
-    dofs_on_this_cell.reserve(dof.get_fe_collection().max_dofs_per_cell());
-    dofs_on_other_cell.reserve(dof.get_fe_collection().max_dofs_per_cell());
-
     // TODO: in an old implementation, we used user flags before to tag
     // faces that were already touched. this way, we could reduce the work
     // a little bit. now, we instead add only data from one side. this
     // should be OK, but we need to actually verify it.
 
-    // In case we work with a distributed sparsity pattern of Trilinos
-    // type, we only have to do the work if the current cell is owned by
-    // the calling processor. Otherwise, just continue.
-    for (const auto &cell : dof.active_cell_iterators())
-      if (((subdomain_id == numbers::invalid_subdomain_id) ||
-           (subdomain_id == cell->subdomain_id())) &&
-          cell->is_locally_owned())
-        {
-          const unsigned int n_dofs_on_this_cell =
-            cell->get_fe().n_dofs_per_cell();
-          dofs_on_this_cell.resize(n_dofs_on_this_cell);
-          cell->get_dof_indices(dofs_on_this_cell);
-
-          // make sparsity pattern for this cell. if no constraints pattern
-          // was given, then the following call acts as if simply no
-          // constraints existed
-          constraints.add_entries_local_to_global(dofs_on_this_cell,
-                                                  sparsity,
-                                                  keep_constrained_dofs);
-
-          for (const unsigned int face : cell->face_indices())
-            {
-              typename DoFHandler<dim, spacedim>::face_iterator cell_face =
-                cell->face(face);
-              const bool periodic_neighbor = cell->has_periodic_neighbor(face);
-              if (!cell->at_boundary(face) || periodic_neighbor)
-                {
-                  typename DoFHandler<dim, spacedim>::level_cell_iterator
-                    neighbor = cell->neighbor_or_periodic_neighbor(face);
-
-                  // in 1d, we do not need to worry whether the neighbor
-                  // might have children and then loop over those children.
-                  // rather, we may as well go straight to the cell behind
-                  // this particular cell's most terminal child
-                  if (dim == 1)
-                    while (neighbor->has_children())
-                      neighbor = neighbor->child(face == 0 ? 1 : 0);
-
-                  if (neighbor->has_children())
-                    {
-                      for (unsigned int sub_nr = 0;
-                           sub_nr != cell_face->n_active_descendants();
-                           ++sub_nr)
-                        {
-                          const typename DoFHandler<dim, spacedim>::
-                            level_cell_iterator sub_neighbor =
-                              periodic_neighbor ?
-                                cell->periodic_neighbor_child_on_subface(
-                                  face, sub_nr) :
-                                cell->neighbor_child_on_subface(face, sub_nr);
-
-                          const unsigned int n_dofs_on_neighbor =
-                            sub_neighbor->get_fe().n_dofs_per_cell();
-                          dofs_on_other_cell.resize(n_dofs_on_neighbor);
-                          sub_neighbor->get_dof_indices(dofs_on_other_cell);
-
-                          constraints.add_entries_local_to_global(
-                            dofs_on_this_cell,
-                            dofs_on_other_cell,
-                            sparsity,
-                            keep_constrained_dofs);
+    internal::loop_over_locally_owned_cells(
+      dof,
+      subdomain_id,
+      sparsity,
+      [&](const typename DoFHandler<dim, spacedim>::active_cell_iterator &cell,
+          internal::SparsityScratchData &scratch_data,
+          SparsityPatternBase           &cell_sparsity) {
+        std::vector<types::global_dof_index> &dofs_on_this_cell =
+          scratch_data.dofs_on_this_cell;
+        std::vector<types::global_dof_index> &dofs_on_other_cell =
+          scratch_data.dofs_on_other_cell;
+
+        const unsigned int n_dofs_on_this_cell =
+          cell->get_fe().n_dofs_per_cell();
+        dofs_on_this_cell.resize(n_dofs_on_this_cell);
+        cell->get_dof_indices(dofs_on_this_cell);
+
+        // make sparsity pattern for this cell. if no constraints pattern
+        // was given, then the following call acts as if simply no
+        // constraints existed
+        constraints.add_entries_local_to_global(dofs_on_this_cell,
+                                                cell_sparsity,
+                                                keep_constrained_dofs);
+
+        for (const unsigned int face : cell->face_indices())
+          {
+            typename DoFHandler<dim, spacedim>::face_iterator cell_face =
+              cell->face(face);
+            const bool periodic_neighbor = cell->has_periodic_neighbor(face);
+            if (!cell->at_boundary(face) || periodic_neighbor)
+              {
+                typename DoFHandler<dim, spacedim>::level_cell_iterator
+                  neighbor = cell->neighbor_or_periodic_neighbor(face);
+
+                // in 1d, we do not need to worry whether the neighbor
+                // might have children and then loop over those children.
+                // rather, we may as well go straight to the cell behind
+                // this particular cell's most terminal child
+                if (dim == 1)
+                  while (neighbor->has_children())
+                    neighbor = neighbor->child(face == 0 ? 1 : 0);
+
+                if (neighbor->has_children())
+                  {
+                    for (unsigned int sub_nr = 0;
+                         sub_nr != cell_face->n_active_descendants();
+                         ++sub_nr)
+                      {
+                        const typename DoFHandler<dim, spacedim>::
+                          level_cell_iterator sub_neighbor =
+                            periodic_neighbor ?
+                              cell->periodic_neighbor_child_on_subface(
+                                face, sub_nr) :
+                              cell->neighbor_child_on_subface(face, sub_nr);
+
+                        const unsigned int n_dofs_on_neighbor =
+                          sub_neighbor->get_fe().n_dofs_per_cell();
+                        dofs_on_other_cell.resize(n_dofs_on_neighbor);
+                        sub_neighbor->get_dof_indices(dofs_on_other_cell);
+
+                        constraints.add_entries_local_to_global(
+                          dofs_on_this_cell,
+                          dofs_on_other_cell,
+                          cell_sparsity,
+                          keep_constrained_dofs);
+                        constraints.add_entries_local_to_global(
+                          dofs_on_other_cell,
+                          dofs_on_this_cell,
+                          cell_sparsity,
+                          keep_constrained_dofs);
+                        // only need to add this when the neighbor is not
+                        // owned by the current processor, otherwise we add
+                        // the entries for the neighbor there
+                        if (sub_neighbor->subdomain_id() !=
+                            cell->subdomain_id())
                           constraints.add_entries_local_to_global(
                             dofs_on_other_cell,
-                            dofs_on_this_cell,
-                            sparsity,
+                            cell_sparsity,
                             keep_constrained_dofs);
-                          // only need to add this when the neighbor is not
-                          // owned by the current processor, otherwise we add
-                          // the entries for the neighbor there
-                          if (sub_neighbor->subdomain_id() !=
-                              cell->subdomain_id())
-                            constraints.add_entries_local_to_global(
-                              dofs_on_other_cell,
-                              sparsity,
-                              keep_constrained_dofs);
-                        }
-                    }
-                  else
-                    {
-                      // Refinement edges are taken care of by coarser
-                      // cells
-                      if ((!periodic_neighbor &&
-                           cell->neighbor_is_coarser(face)) ||
-                          (periodic_neighbor &&
-                           cell->periodic_neighbor_is_coarser(face)))
-                        if (neighbor->subdomain_id() == cell->subdomain_id())
-                          continue;
-
-                      const unsigned int n_dofs_on_neighbor =
-                        neighbor->get_fe().n_dofs_per_cell();
-                      dofs_on_other_cell.resize(n_dofs_on_neighbor);
-
-                      neighbor->get_dof_indices(dofs_on_other_cell);
-
-                      constraints.add_entries_local_to_global(
-                        dofs_on_this_cell,
-                        dofs_on_other_cell,
-                        sparsity,
-                        keep_constrained_dofs);
-
-                      // only need to add these in case the neighbor cell
-                      // is not locally owned - otherwise, we touch each
-                      // face twice and hence put the indices the other way
-                      // around
-                      if (!cell->neighbor_or_periodic_neighbor(face)
-                             ->is_active() ||
-                          (neighbor->subdomain_id() != cell->subdomain_id()))
-                        {
+                      }
+                  }
+                else
+                  {
+                    // Refinement edges are taken care of by coarser
+                    // cells
+                    if ((!periodic_neighbor &&
+                         cell->neighbor_is_coarser(face)) ||
+                        (periodic_neighbor &&
+                         cell->periodic_neighbor_is_coarser(face)))
+                      if (neighbor->subdomain_id() == cell->subdomain_id())
+                        continue;
+
+                    const unsigned int n_dofs_on_neighbor =
+                      neighbor->get_fe().n_dofs_per_cell();
+                    dofs_on_other_cell.resize(n_dofs_on_neighbor);
+
+                    neighbor->get_dof_indices(dofs_on_other_cell);
+
+                    constraints.add_entries_local_to_global(
+                      dofs_on_this_cell,
+                      dofs_on_other_cell,
+                      cell_sparsity,
+                      keep_constrained_dofs);
+
+                    // only need to add these in case the neighbor cell
+                    // is not locally owned - otherwise, we touch each
+                    // face twice and hence put the indices the other way
+                    // around
+                    if (!cell->neighbor_or_periodic_neighbor(face)
+                           ->is_active() ||
+                        (neighbor->subdomain_id() != cell->subdomain_id()))
+                      {
+                        constraints.add_entries_local_to_global(
+                          dofs_on_other_cell,
+                          dofs_on_this_cell,
+                          cell_sparsity,
+                          keep_constrained_dofs);
+                        if (neighbor->subdomain_id() != cell->subdomain_id())
                           constraints.add_entries_local_to_global(
                             dofs_on_other_cell,
-                            dofs_on_this_cell,
-                            sparsity,
+                            cell_sparsity,
                             keep_constrained_dofs);
-                          if (neighbor->subdomain_id() != cell->subdomain_id())
-                            constraints.add_entries_local_to_global(
-                              dofs_on_other_cell,
-                              sparsity,
-                              keep_constrained_dofs);
-                        }
-                    }
-                }
-            }
-        }
+                      }
+                  }
+              }
+          }
+      });
   }
 
 
@@ -44,6 +44,15 @@ FiniteElement<dim, spacedim>::InternalDataBase::InternalDataBase()
 
 
 
+template <int dim, int spacedim>
+std::unique_ptr<typename FiniteElement<dim, spacedim>::InternalDataBase>
+FiniteElement<dim, spacedim>::InternalDataBase::clone() const
+{
+  return nullptr;
+}
+
+
+
 template <int dim, int spacedim>
 std::size_t
 FiniteElement<dim, spacedim>::InternalDataBase::memory_consumption() const
@@ -709,17 +718,13 @@ FiniteElement<dim, spacedim>::prolongation_is_implemented() const
            ++c)
         {
           // make sure also the lazily initialized matrices are created
-          get_prolongation_matrix(c, RefinementCase<dim>(ref_case));
-          Assert((prolongation[ref_case - 1][c].m() ==
-                  this->n_dofs_per_cell()) ||
-                   (prolongation[ref_case - 1][c].m() == 0),
+          const FullMatrix<double> &matrix =
+            get_prolongation_matrix(c, RefinementCase<dim>(ref_case));
+          Assert((matrix.m() == this->n_dofs_per_cell()) || (matrix.m() == 0),
                  ExcInternalError());
-          Assert((prolongation[ref_case - 1][c].n() ==
-                  this->n_dofs_per_cell()) ||
-                   (prolongation[ref_case - 1][c].n() == 0),
+          Assert((matrix.n() == this->n_dofs_per_cell()) || (matrix.n() == 0),
                  ExcInternalError());
-          if ((prolongation[ref_case - 1][c].m() == 0) ||
-              (prolongation[ref_case - 1][c].n() == 0))
+          if ((matrix.m() == 0) || (matrix.n() == 0))
             return false;
         }
   return true;
@@ -739,17 +744,13 @@ FiniteElement<dim, spacedim>::restriction_is_implemented() const
            ++c)
         {
           // make sure also the lazily initialized matrices are created
-          get_restriction_matrix(c, RefinementCase<dim>(ref_case));
-          Assert((restriction[ref_case - 1][c].m() ==
-                  this->n_dofs_per_cell()) ||
-                   (restriction[ref_case - 1][c].m() == 0),
+          const FullMatrix<double> &matrix =
+            get_restriction_matrix(c, RefinementCase<dim>(ref_case));
+          Assert((matrix.m() == this->n_dofs_per_cell()) || (matrix.m() == 0),
                  ExcInternalError());
-          Assert((restriction[ref_case - 1][c].n() ==
-                  this->n_dofs_per_cell()) ||
-                   (restriction[ref_case - 1][c].n() == 0),
+          Assert((matrix.n() == this->n_dofs_per_cell()) || (matrix.n() == 0),
                  ExcInternalError());
-          if ((restriction[ref_case - 1][c].m() == 0) ||
-              (restriction[ref_case - 1][c].n() == 0))
+          if ((matrix.m() == 0) || (matrix.n() == 0))
             return false;
         }
   return true;
@@ -769,15 +770,13 @@ FiniteElement<dim, spacedim>::isotropic_prolongation_is_implemented() const
        ++c)
     {
       // make sure also the lazily initialized matrices are created
-      get_prolongation_matrix(c, RefinementCase<dim>(ref_case));
-      Assert((prolongation[ref_case - 1][c].m() == this->n_dofs_per_cell()) ||
-               (prolongation[ref_case - 1][c].m() == 0),
+      const FullMatrix<double> &matrix =
+        get_prolongation_matrix(c, RefinementCase<dim>(ref_case));
+      Assert((matrix.m() == this->n_dofs_per_cell()) || (matrix.m() == 0),
              ExcInternalError());
-      Assert((prolongation[ref_case - 1][c].n() == this->n_dofs_per_cell()) ||
-               (prolongation[ref_case - 1][c].n() == 0),
+      Assert((matrix.n() == this->n_dofs_per_cell()) || (matrix.n() == 0),
              ExcInternalError());
-      if ((prolongation[ref_case - 1][c].m() == 0) ||
-          (prolongation[ref_case - 1][c].n() == 0))
+      if ((matrix.m() == 0) || (matrix.n() == 0))
         return false;
     }
   return true;
@@ -797,15 +796,13 @@ FiniteElement<dim, spacedim>::isotropic_restriction_is_implemented() const
        ++c)
     {
       // make sure also the lazily initialized matrices are created
-      get_restriction_matrix(c, RefinementCase<dim>(ref_case));
-      Assert((restriction[ref_case - 1][c].m() == this->n_dofs_per_cell()) ||
-               (restriction[ref_case - 1][c].m() == 0),
+      const FullMatrix<double> &matrix =
+        get_restriction_matrix(c, RefinementCase<dim>(ref_case));
+      Assert((matrix.m() == this->n_dofs_per_cell()) || (matrix.m() == 0),
              ExcInternalError());
-      Assert((restriction[ref_case - 1][c].n() == this->n_dofs_per_cell()) ||
-               (restriction[ref_case - 1][c].n() == 0),
+      Assert((matrix.n() == this->n_dofs_per_cell()) || (matrix.n() == 0),
              ExcInternalError());
-      if ((restriction[ref_case - 1][c].m() == 0) ||
-          (restriction[ref_case - 1][c].n() == 0))
+      if ((matrix.m() == 0) || (matrix.n() == 0))
         return false;
     }
   return true;
@@ -422,7 +422,21 @@ FE_Q_Base<dim, spacedim>::FE_Q_Base(
                &poly_space) != nullptr ?
                this->degree - 1 :
                this->degree)
-{}
+{
+  // set up the storage for the restriction and embedding matrices that are
+  // computed upon first request
+  lazy_restriction_matrices.resize(RefinementCase<dim>::isotropic_refinement);
+  lazy_prolongation_matrices.resize(RefinementCase<dim>::isotropic_refinement);
+  for (const unsigned int ref_case :
+       RefinementCase<dim>::all_refinement_cases())
+    if (ref_case != RefinementCase<dim>::no_refinement)
+      {
+        lazy_restriction_matrices[ref_case - 1].resize(
+          this->reference_cell().n_children(RefinementCase<dim>(ref_case)));
+        lazy_prolongation_matrices[ref_case - 1].resize(
+          this->reference_cell().n_children(RefinementCase<dim>(ref_case)));
+      }
+}
 
 
 
@@ -1248,16 +1262,13 @@ FE_Q_Base<dim, spacedim>::get_prolongation_matrix(
            "Prolongation matrices are only available for refined cells!"));
   AssertIndexRange(child, GeometryInfo<dim>::n_children(refinement_case));
 
-  // initialization upon first request
-  if (this->prolongation[refinement_case - 1][child].n() == 0)
-    {
-      std::lock_guard<std::mutex> lock(prolongation_matrix_mutex);
-
-      // if matrix got updated while waiting for the lock
-      if (this->prolongation[refinement_case - 1][child].n() ==
-          this->n_dofs_per_cell())
-        return this->prolongation[refinement_case - 1][child];
+  // matrices set by derived classes in their constructors take precedence
+  if (this->prolongation[refinement_case - 1][child].n() != 0)
+    return this->prolongation[refinement_case - 1][child];
 
+  // otherwise compute the matrix upon first request
+  return lazy_prolongation_matrices[refinement_case - 1][child]
+    .value_or_initialize([&]() {
       // distinguish q/q_dg0 case: only treat Q dofs first
       const unsigned int q_dofs_per_cell =
         Utilities::fixed_power<dim>(q_degree + 1);
@@ -1423,13 +1434,8 @@ FE_Q_Base<dim, spacedim>::get_prolongation_matrix(
         }
 #  endif
 
-      // move result into place
-      const_cast<FullMatrix<double> &>(
-        this->prolongation[refinement_case - 1][child]) = std::move(prolongate);
-    }
-
-  // finally return the matrix
-  return this->prolongation[refinement_case - 1][child];
+      return prolongate;
+    });
 }
 
 
@@ -1447,16 +1453,13 @@ FE_Q_Base<dim, spacedim>::get_restriction_matrix(
            "Restriction matrices are only available for refined cells!"));
   AssertIndexRange(child, GeometryInfo<dim>::n_children(refinement_case));
 
-  // initialization upon first request
-  if (this->restriction[refinement_case - 1][child].n() == 0)
-    {
-      std::lock_guard<std::mutex> lock(restriction_matrix_mutex);
-
-      // if matrix got updated while waiting for the lock...
-      if (this->restriction[refinement_case - 1][child].n() ==
-          this->n_dofs_per_cell())
-        return this->restriction[refinement_case - 1][child];
+  // matrices set by derived classes in their constructors take precedence
+  if (this->restriction[refinement_case - 1][child].n() != 0)
+    return this->restriction[refinement_case - 1][child];
 
+  // otherwise compute the matrix upon first request
+  return lazy_restriction_matrices[refinement_case - 1][child]
+    .value_or_initialize([&]() {
       FullMatrix<double> my_restriction(this->n_dofs_per_cell(),
                                         this->n_dofs_per_cell());
       // distinguish q/q_dg0 case
@@ -1563,13 +1566,8 @@ FE_Q_Base<dim, spacedim>::get_restriction_matrix(
                      RefinementCase<dim>(refinement_case));
         }
 
-      // move result into place
-      const_cast<FullMatrix<double> &>(
-        this->restriction[refinement_case - 1][child]) =
-        std::move(my_restriction);
-    }
-
-  return this->restriction[refinement_case - 1][child];
+      return my_restriction;
+    });
 }
 
 
@@ -311,6 +311,64 @@ namespace FESeries
 
     fourier_coefficients.fill(unrolled_coefficients.begin());
   }
+
+
+
+  template <int dim, int spacedim>
+  template <typename Number>
+  void
+  Fourier<dim, spacedim>::calculate(
+    const FullMatrix<Number>    &local_dof_values,
+    const unsigned int           cell_active_fe_index,
+    FullMatrix<CoefficientType> &coefficients)
+  {
+    ensure_existence(n_coefficients_per_direction,
+                     *fe_collection,
+                     q_collection,
+                     k_vectors,
+                     cell_active_fe_index,
+                     component,
+                     fourier_transform_matrices);
+
+    const FullMatrix<CoefficientType> &matrix =
+      fourier_transform_matrices[cell_active_fe_index];
+
+    Assert(local_dof_values.n() == matrix.n(),
+           ExcDimensionMismatch(local_dof_values.n(), matrix.n()));
+
+    coefficients.reinit(local_dof_values.m(), matrix.m());
+    if (local_dof_values.m() == 0)
+      return;
+
+    // with one cell per row, all coefficients are given by the product
+    // U M^T of the dof values and the transformation matrix. Since the dof
+    // values are real, we multiply by the real and the imaginary part of the
+    // transformation matrix separately, which allows to use BLAS for both
+    // products.
+    using RealType = typename CoefficientType::value_type;
+
+    FullMatrix<RealType> dof_values;
+    dof_values.copy_from(local_dof_values);
+
+    FullMatrix<RealType> matrix_part(matrix.m(), matrix.n());
+    FullMatrix<RealType> coefficients_real(coefficients.m(), coefficients.n());
+    FullMatrix<RealType> coefficients_imag(coefficients.m(), coefficients.n());
+
+    for (unsigned int i = 0; i < matrix.m(); ++i)
+      for (unsigned int j = 0; j < matrix.n(); ++j)
+        matrix_part(i, j) = matrix(i, j).real();
+    dof_values.mTmult(coefficients_real, matrix_part);
+
+    for (unsigned int i = 0; i < matrix.m(); ++i)
+      for (unsigned int j = 0; j < matrix.n(); ++j)
+        matrix_part(i, j) = matrix(i, j).imag();
+    dof_values.mTmult(coefficients_imag, matrix_part);
+
+    for (unsigned int c = 0; c < coefficients.m(); ++c)
+      for (unsigned int i = 0; i < coefficients.n(); ++i)
+        coefficients(c, i) =
+          CoefficientType(coefficients_real(c, i), coefficients_imag(c, i));
+  }
 } // namespace FESeries
 
 
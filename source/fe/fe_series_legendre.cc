@@ -20,6 +20,7 @@
 #include <deal.II/fe/fe_series.h>
 
 #include <iostream>
+#include <type_traits>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -314,6 +315,46 @@ namespace FESeries
 
     legendre_coefficients.fill(unrolled_coefficients.begin());
   }
+
+
+
+  template <int dim, int spacedim>
+  template <typename Number>
+  void
+  Legendre<dim, spacedim>::calculate(
+    const FullMatrix<Number>    &local_dof_values,
+    const unsigned int           cell_active_fe_index,
+    FullMatrix<CoefficientType> &coefficients)
+  {
+    ensure_existence(n_coefficients_per_direction,
+                     *fe_collection,
+                     q_collection,
+                     cell_active_fe_index,
+                     component,
+                     legendre_transform_matrices);
+
+    const FullMatrix<CoefficientType> &matrix =
+      legendre_transform_matrices[cell_active_fe_index];
+
+    Assert(local_dof_values.n() == matrix.n(),
+           ExcDimensionMismatch(local_dof_values.n(), matrix.n()));
+
+    coefficients.reinit(local_dof_values.m(), matrix.m());
+    if (local_dof_values.m() == 0)
+      return;
+
+    // with one cell per row, all coefficients are given by the product
+    // U M^T of the dof values and the transformation matrix; use the same
+    // number type for both factors such that BLAS can be used
+    if constexpr (std::is_same_v<Number, CoefficientType>)
+      local_dof_values.mTmult(coefficients, matrix);
+    else
+      {
+        FullMatrix<CoefficientType> dof_values;
+        dof_values.copy_from(local_dof_values);
+        dof_values.mTmult(coefficients, matrix);
+      }
+  }
 } // namespace FESeries
 
 
@@ -249,6 +249,24 @@ FESystem<dim, spacedim>::InternalData::~InternalData()
 }
 
 
+template <int dim, int spacedim>
+std::unique_ptr<typename FiniteElement<dim, spacedim>::InternalDataBase>
+FESystem<dim, spacedim>::InternalData::clone() const
+{
+  auto copy         = std::make_unique<InternalData>(base_fe_datas.size());
+  copy->update_each = this->update_each;
+  for (unsigned int base_no = 0; base_no < base_fe_datas.size(); ++base_no)
+    {
+      copy->base_fe_datas[base_no] = base_fe_datas[base_no]->clone();
+      if (copy->base_fe_datas[base_no] == nullptr)
+        return nullptr;
+    }
+  copy->base_fe_output_objects = base_fe_output_objects;
+  return copy;
+}
+
+
+
 template <int dim, int spacedim>
 typename FiniteElement<dim, spacedim>::InternalDataBase &
 FESystem<dim, spacedim>::InternalData::get_fe_data(
@@ -850,15 +868,8 @@ FESystem<dim, spacedim>::get_restriction_matrix(
 
 
   // initialization upon first request
-  if (this->restriction[refinement_case - 1][child].n() == 0)
-    {
-      std::lock_guard<std::mutex> lock(restriction_matrix_mutex);
-
-      // check if updated while waiting for lock
-      if (this->restriction[refinement_case - 1][child].n() ==
-          this->n_dofs_per_cell())
-        return this->restriction[refinement_case - 1][child];
-
+  return lazy_restriction_matrices[refinement_case - 1][child]
+    .value_or_initialize([&]() {
       // shortcut for accessing local restrictions further down
       std::vector<const FullMatrix<double> *> base_matrices(
         this->n_base_elements());
@@ -909,11 +920,8 @@ FESystem<dim, spacedim>::get_restriction_matrix(
               (*base_matrices[base])(base_index_i, base_index_j);
           }
 
-      const_cast<FullMatrix<double> &>(
-        this->restriction[refinement_case - 1][child]) = std::move(restriction);
-    }
-
-  return this->restriction[refinement_case - 1][child];
+      return restriction;
+    });
 }
 
 
@@ -933,14 +941,8 @@ FESystem<dim, spacedim>::get_prolongation_matrix(
 
   // initialization upon first request, construction completely analogous to
   // restriction matrix
-  if (this->prolongation[refinement_case - 1][child].n() == 0)
-    {
-      std::lock_guard<std::mutex> lock(prolongation_matrix_mutex);
-
-      if (this->prolongation[refinement_case - 1][child].n() ==
-          this->n_dofs_per_cell())
-        return this->prolongation[refinement_case - 1][child];
-
+  return lazy_prolongation_matrices[refinement_case - 1][child]
+    .value_or_initialize([&]() {
       std::vector<const FullMatrix<double> *> base_matrices(
         this->n_base_elements());
       for (unsigned int i = 0; i < this->n_base_elements(); ++i)
@@ -971,11 +973,8 @@ FESystem<dim, spacedim>::get_prolongation_matrix(
               (*base_matrices[base])(base_index_i, base_index_j);
           }
 
-      const_cast<FullMatrix<double> &>(
-        this->prolongation[refinement_case - 1][child]) = std::move(prolongate);
-    }
-
-  return this->prolongation[refinement_case - 1][child];
+      return prolongate;
+    });
 }
 
 
@@ -1725,6 +1724,20 @@ FESystem<dim, spacedim>::initialize(
     if (multiplicities[i] > 0)
       this->base_to_block_indices.push_back(multiplicities[i]);
 
+  // set up the storage for the restriction and embedding matrices that are
+  // computed upon first request
+  lazy_restriction_matrices.resize(RefinementCase<dim>::isotropic_refinement);
+  lazy_prolongation_matrices.resize(RefinementCase<dim>::isotropic_refinement);
+  for (const unsigned int ref_case :
+       RefinementCase<dim>::all_refinement_cases())
+    if (ref_case != RefinementCase<dim>::no_refinement)
+      {
+        lazy_restriction_matrices[ref_case - 1].resize(
+          this->reference_cell().n_children(RefinementCase<dim>(ref_case)));
+        lazy_prolongation_matrices[ref_case - 1].resize(
+          this->reference_cell().n_children(RefinementCase<dim>(ref_case)));
+      }
+
   {
     Threads::TaskGroup<> clone_base_elements;
 
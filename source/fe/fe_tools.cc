@@ -26,7 +26,38 @@ namespace FETools
     {
       std::shared_mutex fe_name_map_lock;
     }
-  } // namespace internal
+
+    namespace FEToolsEmbeddingMatrixCache
+    {
+      std::atomic<bool> cache_enabled(false);
+      std::string       cache_directory;
+      std::mutex        cache_lock;
+    } // namespace FEToolsEmbeddingMatrixCache
+  }   // namespace internal
+
+
+
+  void
+  enable_embedding_matrix_cache(const std::string &directory)
+  {
+    std::lock_guard<std::mutex> lock(
+      internal::FEToolsEmbeddingMatrixCache::cache_lock);
+    internal::FEToolsEmbeddingMatrixCache::cache_directory = directory;
+    internal::FEToolsEmbeddingMatrixCache::cache_enabled   = true;
+  }
+
+
+
+  void
+  disable_embedding_matrix_cache()
+  {
+    std::lock_guard<std::mutex> lock(
+      internal::FEToolsEmbeddingMatrixCache::cache_lock);
+    internal::FEToolsEmbeddingMatrixCache::cache_enabled = false;
+    internal::FEToolsEmbeddingMatrixCache::cache_directory.clear();
+    internal::FEToolsEmbeddingMatrixCache::get_memory_cache<double>().clear();
+    internal::FEToolsEmbeddingMatrixCache::get_memory_cache<float>().clear();
+  }
 } // namespace FETools
 
 
@@ -168,6 +168,9 @@ FEValues<dim, spacedim>::FEValues(const Mapping<dim, spacedim>       &mapping,
                                 mapping,
                                 fe)
   , quadrature(q)
+  , similarity_cache_size(0)
+  , next_similarity_cache_entry(0)
+  , mapping_data_is_stale(false)
 {
   initialize(update_flags);
 }
@@ -197,6 +200,9 @@ FEValues<dim, spacedim>::FEValues(const FiniteElement<dim, spacedim> &fe,
       fe.reference_cell().template get_default_linear_mapping<dim, spacedim>(),
       fe)
   , quadrature(q)
+  , similarity_cache_size(0)
+  , next_similarity_cache_entry(0)
+  , mapping_data_is_stale(false)
 {
   initialize(update_flags);
 }
@@ -214,9 +220,28 @@ FEValues<dim, spacedim>::FEValues(const FiniteElement<dim, spacedim> &fe,
 
 
 
+template <int dim, int spacedim>
+FEValues<dim, spacedim>::FEValues(const FEValues<dim, spacedim> &other)
+  : FEValuesBase<dim, spacedim>(other.n_quadrature_points,
+                                other.dofs_per_cell,
+                                update_default,
+                                *other.mapping,
+                                *other.fe)
+  , quadrature(other.quadrature)
+  , similarity_cache_size(0)
+  , next_similarity_cache_entry(0)
+  , mapping_data_is_stale(false)
+{
+  initialize(other.update_flags, &other);
+}
+
+
+
 template <int dim, int spacedim>
 void
-FEValues<dim, spacedim>::initialize(const UpdateFlags update_flags)
+FEValues<dim, spacedim>::initialize(
+  const UpdateFlags                  update_flags,
+  const FEValuesBase<dim, spacedim> *other)
 {
   // You can compute normal vectors to the cells only in the
   // codimension one case.
@@ -233,14 +258,21 @@ FEValues<dim, spacedim>::initialize(const UpdateFlags update_flags)
   // initialize the base classes
   if (flags & update_mapping)
     this->mapping_output.initialize(this->max_n_quadrature_points, flags);
-  this->finite_element_output.initialize(this->max_n_quadrature_points,
-                                         *this->fe,
-                                         flags);
+  // if we copy another object, try to share the data its finite element
+  // has precomputed rather than computing it again
+  const bool fe_data_is_shared =
+    (other != nullptr) && this->share_fe_data_with(*other);
+  if (!fe_data_is_shared)
+    this->finite_element_output.initialize(this->max_n_quadrature_points,
+                                           *this->fe,
+                                           flags);
 
   // then get objects into which the FE and the Mapping can store
   // intermediate data used across calls to reinit. we can do this in parallel
   Threads::Task<
     std::unique_ptr<typename FiniteElement<dim, spacedim>::InternalDataBase>>
+    fe_get_data;
+  if (!fe_data_is_shared)
     fe_get_data = Threads::new_task([&]() {
       return this->fe->get_data(flags,
                                 *this->mapping,
@@ -258,7 +290,8 @@ FEValues<dim, spacedim>::initialize(const UpdateFlags update_flags)
   this->update_flags = flags;
 
   // then collect answers from the two task above
-  this->fe_data = std::move(fe_get_data.return_value());
+  if (!fe_data_is_shared)
+    this->fe_data = std::move(fe_get_data.return_value());
   if (flags & update_mapping)
     this->mapping_data = std::move(mapping_get_data.return_value());
   else
@@ -327,10 +360,106 @@ FEValues<dim, spacedim>::reinit(
 
 
 
+template <int dim, int spacedim>
+void
+FEValues<dim, spacedim>::set_cell_similarity_cache_size(
+  const unsigned int n_entries)
+{
+  similarity_cache_size = n_entries;
+  similarity_cache.clear();
+  next_similarity_cache_entry = 0;
+}
+
+
+
+template <int dim, int spacedim>
+unsigned int
+FEValues<dim, spacedim>::find_similar_cached_cell() const
+{
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell =
+    this->present_cell;
+
+  for (unsigned int e = 0; e < similarity_cache.size(); ++e)
+    {
+      const SimilarityCacheEntry &entry = similarity_cache[e];
+      if (entry.vertex_offsets.size() + 1 != cell->n_vertices() ||
+          entry.direction_flag != cell->direction_flag())
+        continue;
+
+      // use the same tolerance as TriaAccessor::is_translation_of()
+      const Point<spacedim> vertex_0 = cell->vertex(0);
+      const double          tol_square =
+        1e-24 * (vertex_0 - entry.vertex_0).norm_square();
+      bool is_translation = true;
+      for (unsigned int i = 1; i < cell->n_vertices(); ++i)
+        if (((cell->vertex(i) - vertex_0) - entry.vertex_offsets[i - 1])
+              .norm_square() > tol_square)
+          {
+            is_translation = false;
+            break;
+          }
+      if (is_translation)
+        return e;
+    }
+
+  return numbers::invalid_unsigned_int;
+}
+
+
+
+template <int dim, int spacedim>
+void
+FEValues<dim, spacedim>::store_in_similarity_cache()
+{
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell =
+    this->present_cell;
+
+  // once the cache is full, replace the entries in the order they were
+  // stored
+  SimilarityCacheEntry *entry;
+  if (similarity_cache.size() < similarity_cache_size)
+    entry = &similarity_cache.emplace_back();
+  else
+    {
+      entry = &similarity_cache[next_similarity_cache_entry];
+      next_similarity_cache_entry =
+        (next_similarity_cache_entry + 1) % similarity_cache_size;
+    }
+
+  entry->vertex_0 = cell->vertex(0);
+  entry->vertex_offsets.resize(cell->n_vertices() - 1);
+  for (unsigned int i = 1; i < cell->n_vertices(); ++i)
+    entry->vertex_offsets[i - 1] = cell->vertex(i) - entry->vertex_0;
+  entry->direction_flag        = cell->direction_flag();
+  entry->mapping_output        = this->mapping_output;
+  entry->finite_element_output = this->finite_element_output;
+}
+
+
+
 template <int dim, int spacedim>
 void
 FEValues<dim, spacedim>::do_reinit()
 {
+  // if the present cell is not a translation of the previous one, or if the
+  // data of the previous cell was taken from the cache, look for a
+  // translated cell in the cache and start from its data
+  unsigned int cache_entry = numbers::invalid_unsigned_int;
+  if (similarity_cache_size > 0 && this->check_for_cell_similarity_allowed &&
+      (this->cell_similarity == CellSimilarity::none || mapping_data_is_stale))
+    {
+      cache_entry = find_similar_cached_cell();
+      if (cache_entry != numbers::invalid_unsigned_int)
+        {
+          this->mapping_output = similarity_cache[cache_entry].mapping_output;
+          this->finite_element_output =
+            similarity_cache[cache_entry].finite_element_output;
+          this->cell_similarity = CellSimilarity::translation;
+        }
+      else
+        this->cell_similarity = CellSimilarity::none;
+    }
+
   // first call the mapping and let it generate the data
   // specific to the mapping. also let it inspect the
   // cell similarity flag and, if necessary, update
@@ -345,6 +474,35 @@ FEValues<dim, spacedim>::do_reinit()
                                            this->mapping_output);
     }
 
+  if (cache_entry != numbers::invalid_unsigned_int)
+    {
+      if (this->cell_similarity == CellSimilarity::translation)
+        {
+          // the internal data of the mapping does not describe the cached
+          // cell, so translate the quadrature points of the cached cell
+          // rather than relying on those computed by the mapping
+          if (this->update_flags & update_quadrature_points)
+            {
+              const Tensor<1, spacedim> shift =
+                static_cast<
+                  const typename Triangulation<dim, spacedim>::cell_iterator &>(
+                  this->present_cell)
+                  ->vertex(0) -
+                similarity_cache[cache_entry].vertex_0;
+              const auto &cached_points =
+                similarity_cache[cache_entry].mapping_output.quadrature_points;
+              for (unsigned int q = 0; q < cached_points.size(); ++q)
+                this->mapping_output.quadrature_points[q] =
+                  cached_points[q] + shift;
+            }
+          mapping_data_is_stale = true;
+        }
+      else
+        // the mapping has recomputed all data because it can not reuse
+        // data on translated cells, so the cache is of no use
+        set_cell_similarity_cache_size(0);
+    }
+
   // then call the finite element and, with the data
   // already filled by the mapping, let it compute the
   // data for the mapped shape function values, gradients,
@@ -357,6 +515,13 @@ FEValues<dim, spacedim>::do_reinit()
                                 this->mapping_output,
                                 *this->fe_data,
                                 this->finite_element_output);
+
+  if (this->cell_similarity == CellSimilarity::none)
+    {
+      mapping_data_is_stale = false;
+      if (similarity_cache_size > 0 && this->check_for_cell_similarity_allowed)
+        store_in_similarity_cache();
+    }
 }
 
 
@@ -365,8 +530,13 @@ template <int dim, int spacedim>
 std::size_t
 FEValues<dim, spacedim>::memory_consumption() const
 {
-  return (FEValuesBase<dim, spacedim>::memory_consumption() +
-          MemoryConsumption::memory_consumption(quadrature));
+  std::size_t memory = FEValuesBase<dim, spacedim>::memory_consumption() +
+                       MemoryConsumption::memory_consumption(quadrature);
+  for (const SimilarityCacheEntry &entry : similarity_cache)
+    memory += MemoryConsumption::memory_consumption(entry.vertex_offsets) +
+              entry.mapping_output.memory_consumption() +
+              entry.finite_element_output.memory_consumption();
+  return memory;
 }
 
 #endif
@@ -506,18 +676,39 @@ FEFaceValues<dim, spacedim>::FEFaceValues(
 
 
 
+template <int dim, int spacedim>
+FEFaceValues<dim, spacedim>::FEFaceValues(
+  const FEFaceValues<dim, spacedim> &other)
+  : FEFaceValuesBase<dim, spacedim>(other.dofs_per_cell,
+                                    other.update_flags,
+                                    *other.mapping,
+                                    *other.fe,
+                                    other.quadrature)
+{
+  initialize(other.update_flags, &other);
+}
+
+
+
 template <int dim, int spacedim>
 void
-FEFaceValues<dim, spacedim>::initialize(const UpdateFlags update_flags)
+FEFaceValues<dim, spacedim>::initialize(
+  const UpdateFlags                  update_flags,
+  const FEValuesBase<dim, spacedim> *other)
 {
   const UpdateFlags flags = this->compute_update_flags(update_flags);
 
   // initialize the base classes
   if (flags & update_mapping)
     this->mapping_output.initialize(this->max_n_quadrature_points, flags);
-  this->finite_element_output.initialize(this->max_n_quadrature_points,
-                                         *this->fe,
-                                         flags);
+  // if we copy another object, try to share the data its finite element
+  // has precomputed rather than computing it again
+  const bool fe_data_is_shared =
+    (other != nullptr) && this->share_fe_data_with(*other);
+  if (!fe_data_is_shared)
+    this->finite_element_output.initialize(this->max_n_quadrature_points,
+                                           *this->fe,
+                                           flags);
 
   // then get objects into which the FE and the Mapping can store
   // intermediate data used across calls to reinit. this can be done in parallel
@@ -539,6 +730,8 @@ FEFaceValues<dim, spacedim>::initialize(const UpdateFlags update_flags)
 
   Threads::Task<
     std::unique_ptr<typename FiniteElement<dim, spacedim>::InternalDataBase>>
+    fe_get_data;
+  if (!fe_data_is_shared)
     fe_get_data = Threads::new_task(finite_element_get_face_data,
                                     *this->fe,
                                     flags,
@@ -557,7 +750,8 @@ FEFaceValues<dim, spacedim>::initialize(const UpdateFlags update_flags)
   this->update_flags = flags;
 
   // then collect answers from the two task above
-  this->fe_data = std::move(fe_get_data.return_value());
+  if (!fe_data_is_shared)
+    this->fe_data = std::move(fe_get_data.return_value());
   if (flags & update_mapping)
     this->mapping_data = std::move(mapping_get_data.return_value());
   else
@@ -744,24 +938,47 @@ FESubfaceValues<dim, spacedim>::FESubfaceValues(
 
 
 
+template <int dim, int spacedim>
+FESubfaceValues<dim, spacedim>::FESubfaceValues(
+  const FESubfaceValues<dim, spacedim> &other)
+  : FEFaceValuesBase<dim, spacedim>(other.dofs_per_cell,
+                                    other.update_flags,
+                                    *other.mapping,
+                                    *other.fe,
+                                    other.quadrature)
+{
+  initialize(other.update_flags, &other);
+}
+
+
+
 template <int dim, int spacedim>
 void
-FESubfaceValues<dim, spacedim>::initialize(const UpdateFlags update_flags)
+FESubfaceValues<dim, spacedim>::initialize(
+  const UpdateFlags                  update_flags,
+  const FEValuesBase<dim, spacedim> *other)
 {
   const UpdateFlags flags = this->compute_update_flags(update_flags);
 
   // initialize the base classes
   if (flags & update_mapping)
     this->mapping_output.initialize(this->max_n_quadrature_points, flags);
-  this->finite_element_output.initialize(this->max_n_quadrature_points,
-                                         *this->fe,
-                                         flags);
+  // if we copy another object, try to share the data its finite element
+  // has precomputed rather than computing it again
+  const bool fe_data_is_shared =
+    (other != nullptr) && this->share_fe_data_with(*other);
+  if (!fe_data_is_shared)
+    this->finite_element_output.initialize(this->max_n_quadrature_points,
+                                           *this->fe,
+                                           flags);
 
   // then get objects into which the FE and the Mapping can store
   // intermediate data used across calls to reinit. this can be done
   // in parallel
   Threads::Task<
     std::unique_ptr<typename FiniteElement<dim, spacedim>::InternalDataBase>>
+    fe_get_data;
+  if (!fe_data_is_shared)
     fe_get_data =
       Threads::new_task(&FiniteElement<dim, spacedim>::get_subface_data,
                         *this->fe,
@@ -782,7 +999,8 @@ FESubfaceValues<dim, spacedim>::initialize(const UpdateFlags update_flags)
   this->update_flags = flags;
 
   // then collect answers from the two task above
-  this->fe_data = std::move(fe_get_data.return_value());
+  if (!fe_data_is_shared)
+    this->fe_data = std::move(fe_get_data.return_value());
   if (flags & update_mapping)
     this->mapping_data = std::move(mapping_get_data.return_value());
   else
@@ -1346,6 +1346,30 @@ FEValuesBase<dim, spacedim>::compute_update_flags(
 
 
 
+template <int dim, int spacedim>
+bool
+FEValuesBase<dim, spacedim>::share_fe_data_with(
+  const FEValuesBase<dim, spacedim> &other)
+{
+  Assert(&*fe == &*other.fe, ExcInternalError());
+
+  if (other.fe_data == nullptr)
+    return false;
+
+  std::unique_ptr<typename FiniteElement<dim, spacedim>::InternalDataBase>
+    copy = other.fe_data->clone();
+  if (copy == nullptr)
+    return false;
+
+  // some elements already fill parts of the output object in get_data(),
+  // so we have to copy it along with the internal data
+  fe_data               = std::move(copy);
+  finite_element_output = other.finite_element_output;
+  return true;
+}
+
+
+
 template <int dim, int spacedim>
 void
 FEValuesBase<dim, spacedim>::invalidate_present_cell()
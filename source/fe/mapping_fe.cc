@@ -186,43 +186,46 @@ MappingFE<dim, spacedim>::InternalData::compute_shape_function_values(
   const unsigned int n_shape_functions = fe.n_dofs_per_cell();
   const unsigned int n_points          = unit_points.size();
 
-  std::vector<double>         values;
-  std::vector<Tensor<1, dim>> grads;
+  // evaluate all shape functions at all points at once, which is
+  // considerably faster than doing it point by point for some polynomial
+  // spaces, and then copy the results into our own (point-major) arrays
+  Table<2, double>         values;
+  Table<2, Tensor<1, dim>> grads;
   if (shape_values.size() != 0)
     {
       Assert(shape_values.size() == n_shape_functions * n_points,
              ExcInternalError());
-      values.resize(n_shape_functions);
+      values.reinit(n_shape_functions, n_points);
     }
   if (shape_derivatives.size() != 0)
     {
       Assert(shape_derivatives.size() == n_shape_functions * n_points,
              ExcInternalError());
-      grads.resize(n_shape_functions);
+      grads.reinit(n_shape_functions, n_points);
     }
 
-  std::vector<Tensor<2, dim>> grad2;
+  Table<2, Tensor<2, dim>> grad2;
   if (shape_second_derivatives.size() != 0)
     {
       Assert(shape_second_derivatives.size() == n_shape_functions * n_points,
              ExcInternalError());
-      grad2.resize(n_shape_functions);
+      grad2.reinit(n_shape_functions, n_points);
     }
 
-  std::vector<Tensor<3, dim>> grad3;
+  Table<2, Tensor<3, dim>> grad3;
   if (shape_third_derivatives.size() != 0)
     {
       Assert(shape_third_derivatives.size() == n_shape_functions * n_points,
              ExcInternalError());
-      grad3.resize(n_shape_functions);
+      grad3.reinit(n_shape_functions, n_points);
     }
 
-  std::vector<Tensor<4, dim>> grad4;
+  Table<2, Tensor<4, dim>> grad4;
   if (shape_fourth_derivatives.size() != 0)
     {
       Assert(shape_fourth_derivatives.size() == n_shape_functions * n_points,
              ExcInternalError());
-      grad4.resize(n_shape_functions);
+      grad4.reinit(n_shape_functions, n_points);
     }
 
 
@@ -230,31 +233,33 @@ MappingFE<dim, spacedim>::InternalData::compute_shape_function_values(
       shape_second_derivatives.size() != 0 ||
       shape_third_derivatives.size() != 0 ||
       shape_fourth_derivatives.size() != 0)
-    for (unsigned int point = 0; point < n_points; ++point)
-      {
-        tensor_pols.evaluate(
-          unit_points[point], values, grads, grad2, grad3, grad4);
+    {
+      tensor_pols.evaluate_at_points(
+        unit_points, values, grads, grad2, grad3, grad4);
 
-        if (shape_values.size() != 0)
-          for (unsigned int i = 0; i < n_shape_functions; ++i)
-            shape(point, i) = values[i];
+      for (unsigned int point = 0; point < n_points; ++point)
+        {
+          if (shape_values.size() != 0)
+            for (unsigned int i = 0; i < n_shape_functions; ++i)
+              shape(point, i) = values(i, point);
 
-        if (shape_derivatives.size() != 0)
-          for (unsigned int i = 0; i < n_shape_functions; ++i)
-            derivative(point, i) = grads[i];
+          if (shape_derivatives.size() != 0)
+            for (unsigned int i = 0; i < n_shape_functions; ++i)
+              derivative(point, i) = grads(i, point);
 
-        if (shape_second_derivatives.size() != 0)
-          for (unsigned int i = 0; i < n_shape_functions; ++i)
-            second_derivative(point, i) = grad2[i];
+          if (shape_second_derivatives.size() != 0)
+            for (unsigned int i = 0; i < n_shape_functions; ++i)
+              second_derivative(point, i) = grad2(i, point);
 
-        if (shape_third_derivatives.size() != 0)
-          for (unsigned int i = 0; i < n_shape_functions; ++i)
-            third_derivative(point, i) = grad3[i];
+          if (shape_third_derivatives.size() != 0)
+            for (unsigned int i = 0; i < n_shape_functions; ++i)
+              third_derivative(point, i) = grad3(i, point);
 
-        if (shape_fourth_derivatives.size() != 0)
-          for (unsigned int i = 0; i < n_shape_functions; ++i)
-            fourth_derivative(point, i) = grad4[i];
-      }
+          if (shape_fourth_derivatives.size() != 0)
+            for (unsigned int i = 0; i < n_shape_functions; ++i)
+              fourth_derivative(point, i) = grad4(i, point);
+        }
+    }
 }
 
 
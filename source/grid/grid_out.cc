@@ -23,6 +23,7 @@
 
 #include <deal.II/fe/mapping.h>
 
+#include <deal.II/grid/filtered_iterator.h>
 #include <deal.II/grid/grid_out.h>
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_accessor.h>
@@ -3170,6 +3171,43 @@ namespace
     return v;
   }
 
+
+
+  /**
+   * A minimal implementation of DataOutInterface that simply hands out a
+   * given set of patches and data set names. This allows using the parallel
+   * output functions of DataOutInterface for the patches generated from a
+   * triangulation.
+   */
+  template <int dim, int spacedim>
+  class TriangulationPatchOutput : public DataOutInterface<dim, spacedim>
+  {
+  public:
+    TriangulationPatchOutput(
+      std::vector<DataOutBase::Patch<dim, spacedim>> &&patches,
+      const std::vector<std::string>                  &dataset_names)
+      : patches(std::move(patches))
+      , dataset_names(dataset_names)
+    {}
+
+  protected:
+    virtual const std::vector<DataOutBase::Patch<dim, spacedim>> &
+    get_patches() const override
+    {
+      return patches;
+    }
+
+    virtual std::vector<std::string>
+    get_dataset_names() const override
+    {
+      return dataset_names;
+    }
+
+  private:
+    const std::vector<DataOutBase::Patch<dim, spacedim>> patches;
+    const std::vector<std::string>                       dataset_names;
+  };
+
   /**
    * Return all boundary lines of non-internal faces in three dimension.
    */
@@ -3586,6 +3624,43 @@ GridOut::write_vtu(const Triangulation<dim, spacedim> &tria,
 
 
 
+template <int dim, int spacedim>
+void
+GridOut::write_vtu_in_parallel(const Triangulation<dim, spacedim> &tria,
+                               const std::string                  &filename,
+                               const MPI_Comm                      comm) const
+{
+  AssertThrow(vtu_flags.serialize_triangulation == false,
+              ExcMessage("Serializing the triangulation into the output file "
+                         "is not supported when writing in parallel."));
+
+  // only convert the locally owned cells into patches: every process then
+  // writes its own share of the cells into the common file. for serial
+  // triangulations, all active cells are locally owned
+  using active_cell_iterator =
+    typename Triangulation<dim, spacedim>::active_cell_iterator;
+  const FilteredIterator<active_cell_iterator> begin(
+    IteratorFilters::LocallyOwnedCell(), tria.begin_active());
+  const FilteredIterator<active_cell_iterator> end(
+    IteratorFilters::LocallyOwnedCell(), tria.end());
+
+  std::vector<DataOutBase::Patch<dim, spacedim>> patches;
+  if (const auto *parallel_tria =
+        dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+          &tria))
+    patches.reserve(parallel_tria->n_locally_owned_active_cells());
+  else
+    patches.reserve(tria.n_active_cells());
+  generate_triangulation_patches(patches, begin, end);
+
+  TriangulationPatchOutput<dim, spacedim> output(
+    std::move(patches), triangulation_patch_data_names());
+  output.set_flags(static_cast<const DataOutBase::VtkFlags &>(vtu_flags));
+  output.write_vtu_in_parallel(filename, comm);
+}
+
+
+
 template <int dim, int spacedim>
 void
 GridOut::write_mesh_per_processor_as_vtu(
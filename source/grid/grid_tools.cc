@@ -16,6 +16,7 @@
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_consensus_algorithms.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/thread_management.h>
 
@@ -3442,15 +3443,37 @@ namespace GridTools
       check_all_points_within_box(
         std::make_pair(mapping.get_bounding_box(cell_hint), cell_hint));
 
+#ifdef DEAL_II_WITH_ARBORX
+    // With ArborX, find the closest cell bounding box of all points in a
+    // single batched query that runs in parallel, rather than one query per
+    // point in the loop below
+    (void)b_tree;
+    const auto      &boxes_and_cells = cache.get_cell_bounding_boxes();
+    std::vector<int> closest_box(np, -1);
+    {
+      const ArborXWrappers::PointNearestPredicate nearest(points, 1);
+      const auto [indices, offsets] =
+        cache.get_cell_bounding_boxes_bvh().query(nearest);
+      for (unsigned int i = 0; i < np; ++i)
+        if (offsets[i + 1] > offsets[i])
+          closest_box[i] = indices[offsets[i]];
+    }
+#endif
+
     // Now loop over all points that have not been found yet
     for (unsigned int i = 0; i < np; ++i)
       if (found_points[i] == false)
         {
-          // Get the closest cell to this point
+          // Get the closest cell to this point and check all points that
+          // fall within its box
+#ifdef DEAL_II_WITH_ARBORX
+          if (closest_box[i] >= 0)
+            check_all_points_within_box(boxes_and_cells[closest_box[i]]);
+#else
           const auto leaf = b_tree.qbegin(bgi::nearest(points[i], 1));
-          // Now checks all points that fall within this box
           if (leaf != b_tree.qend())
             check_all_points_within_box(*leaf);
+#endif
           else
             {
               // We should not get here. Throw an error.
@@ -4597,6 +4620,162 @@ namespace GridTools
                                          tolerance);
   }
 
+
+
+  template <int dim, int spacedim>
+  std::pair<
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>,
+    std::vector<Point<dim>>>
+  find_active_cells_around_points(const Cache<dim, spacedim>         &cache,
+                                  const std::vector<Point<spacedim>> &points,
+                                  const double tolerance)
+  {
+    namespace bgi = boost::geometry::index;
+
+    using active_cell_iterator =
+      typename Triangulation<dim, spacedim>::active_cell_iterator;
+
+    const unsigned int n_points = points.size();
+
+    std::vector<active_cell_iterator> cells(n_points);
+    std::vector<Point<dim>>           reference_points(n_points);
+    if (n_points == 0)
+      return {std::move(cells), std::move(reference_points)};
+
+    // Set up all objects of the cache used below before starting the
+    // parallel sections, such that the threads only read from them.
+    const auto &mesh            = cache.get_triangulation();
+    const auto &mapping         = cache.get_mapping();
+    const auto &b_tree          = cache.get_cell_bounding_boxes_rtree();
+    const auto &vertex_to_cells = cache.get_vertex_to_cell_map();
+    const auto &vertex_to_cell_centers =
+      cache.get_vertex_to_cell_centers_directions();
+    const auto &used_vertices_rtree = cache.get_used_vertices_rtree();
+
+    // 1) Find a candidate cell for each point, namely the first
+    // non-artificial cell whose bounding box contains the point. With
+    // ArborX, all points are searched for in a single batched query.
+    std::vector<active_cell_iterator> candidate_cells(n_points);
+#ifdef DEAL_II_WITH_ARBORX
+    {
+      const auto &boxes_and_cells = cache.get_cell_bounding_boxes();
+      const ArborXWrappers::PointIntersectPredicate intersect(points);
+      const auto [indices, offsets] =
+        cache.get_cell_bounding_boxes_bvh().query(intersect);
+      for (unsigned int i = 0; i < n_points; ++i)
+        for (int j = offsets[i]; j < offsets[i + 1]; ++j)
+          if (boxes_and_cells[indices[j]].second->is_artificial() == false)
+            {
+              candidate_cells[i] = boxes_and_cells[indices[j]].second;
+              break;
+            }
+    }
+    (void)b_tree;
+#else
+    parallel::apply_to_subranges(
+      0U,
+      n_points,
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
+          for (const auto &box_and_cell :
+               b_tree | bgi::adaptors::queried(bgi::intersects(points[i])))
+            if (box_and_cell.second->is_artificial() == false)
+              {
+                candidate_cells[i] = box_and_cell.second;
+                break;
+              }
+      },
+      256);
+#endif
+
+    // 2) Group the points with a candidate cell by that cell and compute
+    // their reference coordinates for each group at once.
+    std::vector<unsigned int> point_order;
+    point_order.reserve(n_points);
+    for (unsigned int i = 0; i < n_points; ++i)
+      if (candidate_cells[i].state() == IteratorState::valid)
+        point_order.push_back(i);
+    std::stable_sort(point_order.begin(),
+                     point_order.end(),
+                     [&](const unsigned int a, const unsigned int b) {
+                       return candidate_cells[a]->active_cell_index() <
+                              candidate_cells[b]->active_cell_index();
+                     });
+
+    std::vector<unsigned int> group_starts;
+    for (unsigned int j = 0; j < point_order.size(); ++j)
+      if (j == 0 || candidate_cells[point_order[j]] !=
+                      candidate_cells[point_order[j - 1]])
+        group_starts.push_back(j);
+    group_starts.push_back(point_order.size());
+
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(group_starts.size() - 1),
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<Point<spacedim>> real_points;
+        std::vector<Point<dim>>      unit_points;
+        for (unsigned int g = begin; g < end; ++g)
+          {
+            const unsigned int *group = &point_order[group_starts[g]];
+            const unsigned int  n_group_points =
+              group_starts[g + 1] - group_starts[g];
+            const active_cell_iterator &cell = candidate_cells[group[0]];
+
+            real_points.resize(n_group_points);
+            unit_points.resize(n_group_points);
+            for (unsigned int q = 0; q < n_group_points; ++q)
+              real_points[q] = points[group[q]];
+
+            mapping.transform_points_real_to_unit_cell(cell,
+                                                       real_points,
+                                                       unit_points);
+
+            // points for which the transformation failed or that lie outside
+            // of the candidate cell are left to the fallback below
+            for (unsigned int q = 0; q < n_group_points; ++q)
+              if (unit_points[q][0] !=
+                    std::numeric_limits<double>::infinity() &&
+                  cell->reference_cell().contains_point(unit_points[q],
+                                                        tolerance))
+                {
+                  cells[group[q]]            = cell;
+                  reference_points[group[q]] = unit_points[q];
+                }
+          }
+      },
+      16);
+
+    // 3) Search for the remaining points with the function for a single
+    // point, using the candidate cell, if any, as a hint.
+    parallel::apply_to_subranges(
+      0U,
+      n_points,
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
+          if (cells[i].state() != IteratorState::valid)
+            {
+              const auto cell_and_reference_point =
+                find_active_cell_around_point(mapping,
+                                              mesh,
+                                              points[i],
+                                              vertex_to_cells,
+                                              vertex_to_cell_centers,
+                                              candidate_cells[i],
+                                              {},
+                                              used_vertices_rtree,
+                                              tolerance);
+              cells[i]            = cell_and_reference_point.first;
+              reference_points[i] = cell_and_reference_point.second;
+            }
+      },
+      64);
+
+    return {std::move(cells), std::move(reference_points)};
+  }
+
+
+
   template <int spacedim>
   std::vector<std::vector<BoundingBox<spacedim>>>
   exchange_local_bounding_boxes(
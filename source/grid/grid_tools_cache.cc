@@ -27,11 +27,15 @@ namespace GridTools
   Cache<dim, spacedim>::Cache(const Triangulation<dim, spacedim> &tria,
                               const Mapping<dim, spacedim>       &mapping)
     : update_flags(update_all)
+    , topology_version(0)
+    , mesh_movement_in_progress(false)
     , tria(&tria)
     , mapping(&mapping)
+    , cell_bounding_boxes_topology_version(numbers::invalid_unsigned_int)
+    , locally_owned_cell_bounding_boxes_topology_version(
+        numbers::invalid_unsigned_int)
   {
-    tria_change_signal =
-      tria.signals.any_change.connect([&]() { mark_for_update(update_all); });
+    connect_to_triangulation();
   }
 
 
@@ -39,10 +43,14 @@ namespace GridTools
   template <int dim, int spacedim>
   Cache<dim, spacedim>::Cache(const Triangulation<dim, spacedim> &tria)
     : update_flags(update_all)
+    , topology_version(0)
+    , mesh_movement_in_progress(false)
     , tria(&tria)
+    , cell_bounding_boxes_topology_version(numbers::invalid_unsigned_int)
+    , locally_owned_cell_bounding_boxes_topology_version(
+        numbers::invalid_unsigned_int)
   {
-    tria_change_signal =
-      tria.signals.any_change.connect([&]() { mark_for_update(update_all); });
+    connect_to_triangulation();
 
     // Allow users to set this class up with an empty Triangulation and no
     // Mapping argument by deferring Mapping assignment until after the
@@ -64,21 +72,49 @@ namespace GridTools
       }
   }
 
+
+
   template <int dim, int spacedim>
   Cache<dim, spacedim>::~Cache()
   {
     if (tria_change_signal.connected())
       tria_change_signal.disconnect();
+    if (tria_mesh_movement_signal.connected())
+      tria_mesh_movement_signal.disconnect();
     if (tria_create_signal.connected())
       tria_create_signal.disconnect();
   }
 
 
 
+  template <int dim, int spacedim>
+  void
+  Cache<dim, spacedim>::connect_to_triangulation()
+  {
+    // The mesh_movement signal also triggers the any_change signal. Connect
+    // to it at the front, so that we know whether a subsequent any_change
+    // signal is only due to moved vertices and we can keep the objects that
+    // only depend on the topology of the triangulation.
+    tria_mesh_movement_signal = tria->signals.mesh_movement.connect(
+      [&]() { mesh_movement_in_progress = true; }, boost::signals2::at_front);
+
+    tria_change_signal = tria->signals.any_change.connect([&]() {
+      if (mesh_movement_in_progress.exchange(false))
+        mark_for_update(update_vertex_locations);
+      else
+        mark_for_update(update_all);
+    });
+  }
+
+
+
   template <int dim, int spacedim>
   void
   Cache<dim, spacedim>::mark_for_update(const CacheUpdateFlags &flags)
   {
+    if ((flags & ~update_vertex_locations) != update_nothing)
+      ++topology_version;
+
     update_flags |= flags;
   }
 
@@ -203,15 +239,25 @@ namespace GridTools
 
     if (update_flags & update_cell_bounding_boxes_rtree)
       {
-        std::vector<std::pair<
-          BoundingBox<spacedim>,
-          typename Triangulation<dim, spacedim>::active_cell_iterator>>
-          boxes;
-        boxes.reserve(tria->n_active_cells());
-        for (const auto &cell : tria->active_cell_iterators())
-          boxes.emplace_back(mapping->get_bounding_box(cell), cell);
+        const unsigned int current_topology_version = topology_version;
+        if (cell_bounding_boxes_topology_version == current_topology_version)
+          {
+            // the cells have not changed, so only recompute their bounding
+            // boxes
+            for (auto &[box, cell] : cell_bounding_boxes)
+              box = mapping->get_bounding_box(cell);
+          }
+        else
+          {
+            cell_bounding_boxes.clear();
+            cell_bounding_boxes.reserve(tria->n_active_cells());
+            for (const auto &cell : tria->active_cell_iterators())
+              cell_bounding_boxes.emplace_back(mapping->get_bounding_box(cell),
+                                               cell);
+            cell_bounding_boxes_topology_version = current_topology_version;
+          }
 
-        cell_bounding_boxes_rtree = pack_rtree(boxes);
+        cell_bounding_boxes_rtree = pack_rtree(cell_bounding_boxes);
 
         // Atomically clear the flag that indicates that this data member
         // needs to be updated:
@@ -222,6 +268,47 @@ namespace GridTools
 
 
 
+  template <int dim, int spacedim>
+  const std::vector<
+    std::pair<BoundingBox<spacedim>,
+              typename Triangulation<dim, spacedim>::active_cell_iterator>> &
+  Cache<dim, spacedim>::get_cell_bounding_boxes() const
+  {
+    // the boxes are collected together with the RTree, so make sure the
+    // latter is up to date
+    get_cell_bounding_boxes_rtree();
+    return cell_bounding_boxes;
+  }
+
+
+
+#ifdef DEAL_II_WITH_ARBORX
+  template <int dim, int spacedim>
+  ArborXWrappers::BVH &
+  Cache<dim, spacedim>::get_cell_bounding_boxes_bvh() const
+  {
+    std::lock_guard<std::mutex> lock(cell_bounding_boxes_bvh_mutex);
+
+    if (update_flags & update_cell_bounding_boxes_bvh)
+      {
+        const auto &boxes_and_cells = get_cell_bounding_boxes();
+
+        std::vector<BoundingBox<spacedim>> boxes;
+        boxes.reserve(boxes_and_cells.size());
+        for (const auto &box_and_cell : boxes_and_cells)
+          boxes.push_back(box_and_cell.first);
+        cell_bounding_boxes_bvh = std::make_unique<ArborXWrappers::BVH>(boxes);
+
+        // Atomically clear the flag that indicates that this data member
+        // needs to be updated:
+        update_flags &= ~update_cell_bounding_boxes_bvh;
+      }
+    return *cell_bounding_boxes_bvh;
+  }
+#endif
+
+
+
   template <int dim, int spacedim>
   const RTree<
     std::pair<BoundingBox<spacedim>,
@@ -238,19 +325,31 @@ namespace GridTools
 
     if (update_flags & update_locally_owned_cell_bounding_boxes_rtree)
       {
-        std::vector<std::pair<
-          BoundingBox<spacedim>,
-          typename Triangulation<dim, spacedim>::active_cell_iterator>>
-          boxes;
-        if (const parallel::TriangulationBase<dim, spacedim> *parallel_tria =
-              dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
-                &*tria))
-          boxes.reserve(parallel_tria->n_locally_owned_active_cells());
+        auto              &boxes = locally_owned_cell_bounding_boxes;
+        const unsigned int current_topology_version = topology_version;
+        if (locally_owned_cell_bounding_boxes_topology_version ==
+            current_topology_version)
+          {
+            // the cells have not changed, so only recompute their bounding
+            // boxes
+            for (auto &[box, cell] : boxes)
+              box = mapping->get_bounding_box(cell);
+          }
         else
-          boxes.reserve(tria->n_active_cells());
-        for (const auto &cell : tria->active_cell_iterators() |
-                                  IteratorFilters::LocallyOwnedCell())
-          boxes.emplace_back(mapping->get_bounding_box(cell), cell);
+          {
+            boxes.clear();
+            if (const parallel::TriangulationBase<dim, spacedim>
+                  *parallel_tria = dynamic_cast<
+                    const parallel::TriangulationBase<dim, spacedim> *>(&*tria))
+              boxes.reserve(parallel_tria->n_locally_owned_active_cells());
+            else
+              boxes.reserve(tria->n_active_cells());
+            for (const auto &cell : tria->active_cell_iterators() |
+                                      IteratorFilters::LocallyOwnedCell())
+              boxes.emplace_back(mapping->get_bounding_box(cell), cell);
+            locally_owned_cell_bounding_boxes_topology_version =
+              current_topology_version;
+          }
 
         locally_owned_cell_bounding_boxes_rtree = pack_rtree(boxes);
 
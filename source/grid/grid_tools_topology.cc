@@ -15,6 +15,7 @@
 #include <deal.II/base/bounding_box.h>
 #include <deal.II/base/floating_point_comparator.h>
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/utilities.h>
 
 #include <deal.II/grid/grid_tools_geometry.h>
@@ -22,6 +23,7 @@
 
 #include <algorithm>
 #include <map>
+#include <mutex>
 #include <set>
 #include <vector>
 
@@ -1821,30 +1823,75 @@ namespace GridTools
     const Triangulation<dim, spacedim> &triangulation,
     DynamicSparsityPattern             &cell_connectivity)
   {
-    cell_connectivity.reinit(triangulation.n_active_cells(),
-                             triangulation.n_active_cells());
+    const unsigned int n_active_cells = triangulation.n_active_cells();
+    cell_connectivity.reinit(n_active_cells, n_active_cells);
+    if (n_active_cells == 0)
+      return;
+
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      cells;
+    cells.reserve(n_active_cells);
+    for (const auto &cell : triangulation.active_cell_iterators())
+      cells.push_back(cell);
+
+    // make sure the sparsity pattern knows that it has entries before
+    // writing into the rows in parallel, as this flag is shared by all rows
+    cell_connectivity.add(0, 0);
 
     // loop over all cells and their neighbors to build the sparsity
     // pattern. note that it's a bit hard to enter all the connections when a
     // neighbor has children since we would need to find out which of its
     // children is adjacent to the current cell. this problem can be omitted
     // if we only do something if the neighbor has no children -- in that case
-    // it is either on the same or a coarser level than we are. in return, we
-    // have to add entries in both directions for both cells
-    for (const auto &cell : triangulation.active_cell_iterators())
-      {
-        const unsigned int index = cell->active_cell_index();
-        cell_connectivity.add(index, index);
-        for (auto f : cell->face_indices())
-          if ((cell->at_boundary(f) == false) &&
-              (cell->neighbor(f)->has_children() == false))
-            {
-              const unsigned int other_index =
-                cell->neighbor(f)->active_cell_index();
-              cell_connectivity.add(index, other_index);
-              cell_connectivity.add(other_index, index);
-            }
-      }
+    // it is either on the same or a coarser level than we are. a neighbor on
+    // the same level enters the connection into its own row, whereas for a
+    // coarser neighbor we have to add the entry to its row ourselves. since
+    // every row is only written by the cell it belongs to, the rows can be
+    // built in parallel, with the entries for coarser neighbors collected
+    // separately and added at the end
+    std::vector<std::pair<unsigned int, unsigned int>> coarser_entries;
+    std::mutex                                         mutex;
+    parallel::apply_to_subranges(
+      0U,
+      n_active_cells,
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<types::global_dof_index>               neighbors;
+        std::vector<std::pair<unsigned int, unsigned int>> my_coarser_entries;
+        for (unsigned int index = begin; index < end; ++index)
+          {
+            const auto &cell = cells[index];
+            neighbors.clear();
+            neighbors.push_back(index);
+            for (const auto f : cell->face_indices())
+              if ((cell->at_boundary(f) == false) &&
+                  (cell->neighbor(f)->has_children() == false))
+                {
+                  const unsigned int other_index =
+                    cell->neighbor(f)->active_cell_index();
+                  neighbors.push_back(other_index);
+                  if (cell->neighbor_is_coarser(f))
+                    my_coarser_entries.emplace_back(other_index, index);
+                }
+            std::sort(neighbors.begin(), neighbors.end());
+            cell_connectivity.add_entries(index,
+                                          neighbors.begin(),
+                                          std::unique(neighbors.begin(),
+                                                      neighbors.end()),
+                                          true);
+          }
+
+        if (!my_coarser_entries.empty())
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            coarser_entries.insert(coarser_entries.end(),
+                                   my_coarser_entries.begin(),
+                                   my_coarser_entries.end());
+          }
+      },
+      256);
+
+    for (const auto &[row, column] : coarser_entries)
+      cell_connectivity.add(row, column);
   }
 
 
@@ -1865,23 +1912,43 @@ namespace GridTools
             cell->active_cell_index());
       }
 
-    cell_connectivity.reinit(triangulation.n_active_cells(),
-                             triangulation.n_active_cells());
-    std::vector<types::global_dof_index> neighbors;
+    const unsigned int n_active_cells = triangulation.n_active_cells();
+    cell_connectivity.reinit(n_active_cells, n_active_cells);
+    if (n_active_cells == 0)
+      return;
+
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      cells;
+    cells.reserve(n_active_cells);
     for (const auto &cell : triangulation.active_cell_iterators())
-      {
-        neighbors.clear();
-        for (const unsigned int v : cell->vertex_indices())
-          neighbors.insert(neighbors.end(),
-                           vertex_to_cell[cell->vertex_index(v)].begin(),
-                           vertex_to_cell[cell->vertex_index(v)].end());
-        std::sort(neighbors.begin(), neighbors.end());
-        cell_connectivity.add_entries(cell->active_cell_index(),
-                                      neighbors.begin(),
-                                      std::unique(neighbors.begin(),
-                                                  neighbors.end()),
-                                      true);
-      }
+      cells.push_back(cell);
+
+    // every row only depends on the vertices of its own cell, so the rows
+    // can be filled in parallel once the sparsity pattern has been told
+    // that it has entries
+    cell_connectivity.add(0, 0);
+    parallel::apply_to_subranges(
+      0U,
+      n_active_cells,
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<types::global_dof_index> neighbors;
+        for (unsigned int index = begin; index < end; ++index)
+          {
+            const auto &cell = cells[index];
+            neighbors.clear();
+            for (const unsigned int v : cell->vertex_indices())
+              neighbors.insert(neighbors.end(),
+                               vertex_to_cell[cell->vertex_index(v)].begin(),
+                               vertex_to_cell[cell->vertex_index(v)].end());
+            std::sort(neighbors.begin(), neighbors.end());
+            cell_connectivity.add_entries(index,
+                                          neighbors.begin(),
+                                          std::unique(neighbors.begin(),
+                                                      neighbors.end()),
+                                          true);
+          }
+      },
+      256);
   }
 
 
@@ -1903,23 +1970,36 @@ namespace GridTools
           vertex_to_cell[cell->vertex_index(v)].push_back(cell->index());
       }
 
-    cell_connectivity.reinit(triangulation.n_cells(level),
-                             triangulation.n_cells(level));
-    std::vector<types::global_dof_index> neighbors;
-    for (const auto &cell : triangulation.cell_iterators_on_level(level))
-      {
-        neighbors.clear();
-        for (const unsigned int v : cell->vertex_indices())
-          neighbors.insert(neighbors.end(),
-                           vertex_to_cell[cell->vertex_index(v)].begin(),
-                           vertex_to_cell[cell->vertex_index(v)].end());
-        std::sort(neighbors.begin(), neighbors.end());
-        cell_connectivity.add_entries(cell->index(),
-                                      neighbors.begin(),
-                                      std::unique(neighbors.begin(),
-                                                  neighbors.end()),
-                                      true);
-      }
+    const unsigned int n_cells = triangulation.n_cells(level);
+    cell_connectivity.reinit(n_cells, n_cells);
+    if (n_cells == 0)
+      return;
+
+    // fill the rows in parallel as in get_vertex_connectivity_of_cells()
+    cell_connectivity.add(0, 0);
+    parallel::apply_to_subranges(
+      0U,
+      n_cells,
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<types::global_dof_index> neighbors;
+        for (unsigned int index = begin; index < end; ++index)
+          {
+            const typename Triangulation<dim, spacedim>::cell_iterator cell(
+              &triangulation, level, index);
+            neighbors.clear();
+            for (const unsigned int v : cell->vertex_indices())
+              neighbors.insert(neighbors.end(),
+                               vertex_to_cell[cell->vertex_index(v)].begin(),
+                               vertex_to_cell[cell->vertex_index(v)].end());
+            std::sort(neighbors.begin(), neighbors.end());
+            cell_connectivity.add_entries(index,
+                                          neighbors.begin(),
+                                          std::unique(neighbors.begin(),
+                                                      neighbors.end()),
+                                          true);
+          }
+      },
+      256);
   }
 } /* namespace GridTools */
 
@@ -1632,6 +1632,8 @@ TransfiniteInterpolationManifold<dim,
 {
   if (clear_signal.connected())
     clear_signal.disconnect();
+  if (mesh_movement_signal.connected())
+    mesh_movement_signal.disconnect();
 }
 
 
@@ -1660,6 +1662,19 @@ TransfiniteInterpolationManifold<dim, spacedim>::initialize(
     this->triangulation = nullptr;
     this->level_coarse  = -1;
   });
+  // The cached chart points are only valid as long as the mesh is not moved
+  mesh_movement_signal.disconnect();
+  mesh_movement_signal =
+    triangulation.signals.mesh_movement.connect([&]() -> void {
+      std::unique_lock<std::shared_mutex> lock(chart_point_cache_mutex);
+      for (auto &generation : chart_point_cache)
+        generation.clear();
+    });
+  {
+    std::unique_lock<std::shared_mutex> lock(chart_point_cache_mutex);
+    for (auto &generation : chart_point_cache)
+      generation.clear();
+  }
   level_coarse = triangulation.last()->level();
   coarse_cell_is_flat.resize(triangulation.n_cells(level_coarse), false);
   quadratic_approximation.clear();
@@ -2212,6 +2227,58 @@ TransfiniteInterpolationManifold<dim, spacedim>::pull_back(
 
 
 
+template <int dim, int spacedim>
+bool
+TransfiniteInterpolationManifold<dim, spacedim>::find_cached_chart_point(
+  const unsigned int     coarse_cell_index,
+  const Point<spacedim> &p,
+  Point<dim>            &chart_point) const
+{
+  ChartPointCacheKey key;
+  key.first = coarse_cell_index;
+  for (unsigned int d = 0; d < spacedim; ++d)
+    key.second[d] = p[d];
+
+  std::shared_lock<std::shared_mutex> lock(chart_point_cache_mutex);
+  for (const auto &generation : chart_point_cache)
+    if (const auto entry = generation.find(key); entry != generation.end())
+      {
+        chart_point = entry->second;
+        return true;
+      }
+  return false;
+}
+
+
+
+template <int dim, int spacedim>
+void
+TransfiniteInterpolationManifold<dim, spacedim>::cache_chart_points(
+  const unsigned int                      coarse_cell_index,
+  const ArrayView<const Point<spacedim>> &points,
+  const ArrayView<const Point<dim>>      &chart_points) const
+{
+  AssertDimension(points.size(), chart_points.size());
+
+  std::unique_lock<std::shared_mutex> lock(chart_point_cache_mutex);
+  for (unsigned int i = 0; i < points.size(); ++i)
+    {
+      if (chart_point_cache[0].size() >= max_cached_chart_points)
+        {
+          chart_point_cache[1] = std::move(chart_point_cache[0]);
+          chart_point_cache[0].clear();
+        }
+
+      ChartPointCacheKey key;
+      key.first = coarse_cell_index;
+      for (unsigned int d = 0; d < spacedim; ++d)
+        key.second[d] = points[i][d];
+      chart_point_cache[0].emplace(key, chart_points[i]);
+    }
+}
+
+
+
 template <int dim, int spacedim>
 std::array<unsigned int, 20>
 TransfiniteInterpolationManifold<dim, spacedim>::
@@ -2429,6 +2496,13 @@ TransfiniteInterpolationManifold<dim, spacedim>::compute_chart_points(
   auto compute_chart_point =
     [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
         const unsigned int point_index) {
+      // the point may have been computed by this class, in which case we
+      // know its exact chart point and can skip the Newton iteration
+      if (find_cached_chart_point(cell->index(),
+                                  surrounding_points[point_index],
+                                  chart_points[point_index]))
+        return;
+
       Point<dim> guess;
       // an optimization: keep track of whether or not we used the quadratic
       // approximation so that we don't call pull_back with the same
@@ -2574,7 +2648,11 @@ TransfiniteInterpolationManifold<dim, spacedim>::get_new_point(
   const Point<dim> p_chart =
     chart_manifold.get_new_point(chart_points_view, weights);
 
-  return push_forward(cell, p_chart);
+  const Point<spacedim> new_point = push_forward(cell, p_chart);
+  cache_chart_points(cell->index(),
+                     make_array_view(&new_point, &new_point + 1),
+                     make_array_view(&p_chart, &p_chart + 1));
+  return new_point;
 }
 
 
@@ -2604,6 +2682,11 @@ TransfiniteInterpolationManifold<dim, spacedim>::get_new_points(
 
   for (unsigned int row = 0; row < weights.size(0); ++row)
     new_points[row] = push_forward(cell, new_points_on_chart[row]);
+
+  cache_chart_points(cell->index(),
+                     make_array_view(new_points.begin(), new_points.end()),
+                     make_array_view(new_points_on_chart.begin(),
+                                     new_points_on_chart.end()));
 }
 
 
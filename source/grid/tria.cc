@@ -15,9 +15,11 @@
 
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/memory_registry.h>
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_large_count.h>
 #include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
@@ -1640,6 +1642,34 @@ namespace
   }
 
 
+  /**
+   * Compute the locations of the new vertices created during refinement
+   * as the centers of the objects they are associated with. The vertex
+   * indices have been allocated beforehand in the order in which the
+   * objects were refined, and the location of each new vertex only depends
+   * on vertices that have been placed before. The locations can hence be
+   * computed in parallel, with a result that is independent of the number
+   * of threads.
+   */
+  template <int spacedim, typename Iterator>
+  void
+  compute_new_vertex_locations(
+    const std::vector<std::pair<unsigned int, Iterator>> &new_vertices,
+    const bool                    interpolate_from_surrounding,
+    std::vector<Point<spacedim>> &vertices)
+  {
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(new_vertices.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
+          vertices[new_vertices[i].first] =
+            new_vertices[i].second->center(true, interpolate_from_surrounding);
+      },
+      64);
+  }
+
+
   template <int dim, int spacedim>
   void
   update_periodic_face_map_recursively(
@@ -2128,11 +2158,16 @@ namespace internal
             total_cells - tria_level.level_subdomain_ids.size(),
             0);
 
-          tria_level.global_active_cell_indices.reserve(total_cells);
-          tria_level.global_active_cell_indices.insert(
-            tria_level.global_active_cell_indices.end(),
-            total_cells - tria_level.global_active_cell_indices.size(),
-            numbers::invalid_dof_index);
+          // the global active cell indices are only stored if they differ
+          // from the active cell indices, see TriaLevel
+          if (tria_level.global_active_cell_indices.empty() == false)
+            {
+              tria_level.global_active_cell_indices.reserve(total_cells);
+              tria_level.global_active_cell_indices.insert(
+                tria_level.global_active_cell_indices.end(),
+                total_cells - tria_level.global_active_cell_indices.size(),
+                numbers::invalid_dof_index);
+            }
 
           tria_level.global_level_cell_indices.reserve(total_cells);
           tria_level.global_level_cell_indices.insert(
@@ -3616,8 +3651,7 @@ namespace internal
           level.face_orientations.reinit(size * max_faces_per_cell);
 
 
-        level.global_active_cell_indices.assign(size,
-                                                numbers::invalid_dof_index);
+        level.global_active_cell_indices.clear();
         level.global_level_cell_indices.assign(size,
                                                numbers::invalid_dof_index);
       }
@@ -5029,6 +5063,12 @@ namespace internal
           typename Triangulation<dim, spacedim>::raw_line_iterator
             next_unused_line = triangulation.begin_raw_line();
 
+          // the new vertices on the lines, placed once all lines are refined
+          std::vector<std::pair<
+            unsigned int,
+            typename Triangulation<dim, spacedim>::active_line_iterator>>
+            new_line_vertices;
+
           for (; line != endl; ++line)
             if (line->user_flag_set())
               {
@@ -5044,7 +5084,7 @@ namespace internal
                          "enough."));
                 triangulation.vertices_used[next_unused_vertex] = true;
 
-                triangulation.vertices[next_unused_vertex] = line->center(true);
+                new_line_vertices.emplace_back(next_unused_vertex, line);
 
                 [[maybe_unused]] bool pair_found = false;
                 for (; next_unused_line != endl; ++next_unused_line)
@@ -5084,6 +5124,10 @@ namespace internal
 
                 line->clear_user_flag();
               }
+
+          compute_new_vertex_locations(new_line_vertices,
+                                       false,
+                                       triangulation.vertices);
         }
 
         reserve_space(triangulation.faces->lines, 0, n_single_lines);
@@ -5098,6 +5142,7 @@ namespace internal
                                         unsigned int &next_unused_vertex,
                                         auto         &next_unused_line,
                                         auto         &next_unused_cell,
+                                        auto         &new_cell_vertices,
                                         const auto   &cell) {
           const auto ref_case = cell->refine_flag_set();
           cell->clear_refine_flag();
@@ -5135,8 +5180,9 @@ namespace internal
 
               new_vertices[8] = next_unused_vertex;
 
-              triangulation.vertices[next_unused_vertex] =
-                cell->center(true, true);
+              // the location of the new vertex is computed once all cells
+              // on this level have been refined
+              new_cell_vertices.emplace_back(next_unused_vertex, cell);
             }
 
           std::array<typename Triangulation<dim, spacedim>::raw_line_iterator,
@@ -5342,6 +5388,17 @@ namespace internal
             typename Triangulation<dim, spacedim>::raw_cell_iterator
               next_unused_cell = triangulation.begin_raw(level + 1);
 
+            // first create the children of all cells on this level, then
+            // place the new vertices in the cell centers, and only then
+            // check the children and notify about the refinement, in the
+            // same order as the cells were refined
+            std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+              refined_cells;
+            std::vector<std::pair<
+              unsigned int,
+              typename Triangulation<dim, spacedim>::cell_iterator>>
+              new_cell_vertices;
+
             for (const auto &cell :
                  triangulation.active_cell_iterators_on_level(level))
               if (cell->refine_flag_set())
@@ -5350,16 +5407,25 @@ namespace internal
                                   next_unused_vertex,
                                   next_unused_line,
                                   next_unused_cell,
+                                  new_cell_vertices,
                                   cell);
+                  refined_cells.push_back(cell);
+                }
 
-                  if (cell->reference_cell() == ReferenceCells::Quadrilateral &&
-                      check_for_distorted_cells &&
-                      has_distorted_children<dim, spacedim>(cell))
-                    cells_with_distorted_children.distorted_cells.push_back(
-                      cell);
+            compute_new_vertex_locations(new_cell_vertices,
+                                         true,
+                                         triangulation.vertices);
 
-                  triangulation.signals.post_refinement_on_cell(cell);
-                }
+            for (const auto &cell : refined_cells)
+              {
+                if (cell->reference_cell() == ReferenceCells::Quadrilateral &&
+                    check_for_distorted_cells &&
+                    has_distorted_children<dim, spacedim>(cell))
+                  cells_with_distorted_children.distorted_cells.push_back(
+                    cell);
+
+                triangulation.signals.post_refinement_on_cell(cell);
+              }
           }
 
         return cells_with_distorted_children;
@@ -6149,6 +6215,12 @@ namespace internal
             endl = triangulation.end_line();
           raw_line_iterator next_unused_line = triangulation.begin_raw_line();
 
+          // the new vertices on the lines, placed once all lines are refined
+          std::vector<std::pair<
+            unsigned int,
+            typename Triangulation<dim, spacedim>::active_line_iterator>>
+            new_line_vertices;
+
           for (; line != endl; ++line)
             {
               if (line->user_flag_set() == false)
@@ -6174,7 +6246,7 @@ namespace internal
               current_vertex =
                 get_next_unused_vertex(current_vertex,
                                        triangulation.vertices_used);
-              triangulation.vertices[current_vertex] = line->center(true);
+              new_line_vertices.emplace_back(current_vertex, line);
 
               children[0]->set_bounding_object_indices(
                 {line->vertex_index(0), current_vertex});
@@ -6195,6 +6267,10 @@ namespace internal
 
               line->clear_user_flag();
             }
+
+          compute_new_vertex_locations(new_line_vertices,
+                                       false,
+                                       triangulation.vertices);
         }
 
         // QUADS
@@ -6203,6 +6279,13 @@ namespace internal
             quad = triangulation.begin_quad(),
             endq = triangulation.end_quad();
 
+          // the new vertices in the quad centers, placed once all quads are
+          // refined
+          std::vector<std::pair<
+            unsigned int,
+            typename Triangulation<dim, spacedim>::quad_iterator>>
+            new_quad_vertices;
+
           for (; quad != endq; ++quad)
             {
               if (quad->user_flag_set() == false)
@@ -6281,8 +6364,7 @@ namespace internal
                                            triangulation.vertices_used);
                   vertex_indices[k++] = current_vertex;
 
-                  triangulation.vertices[current_vertex] =
-                    quad->center(true, true);
+                  new_quad_vertices.emplace_back(current_vertex, quad);
                 }
 
               // 4) set new lines on quads and their properties
@@ -6470,6 +6552,10 @@ namespace internal
 
               quad->clear_user_flag();
             }
+
+          compute_new_vertex_locations(new_quad_vertices,
+                                       true,
+                                       triangulation.vertices);
         }
 
         typename Triangulation<3, spacedim>::DistortedCellList
@@ -6486,6 +6572,17 @@ namespace internal
                      hex->level() >= static_cast<int>(level),
                    ExcInternalError());
 
+            // as in the 2d case, first create the children of all cells on
+            // this level, then place the new vertices in the cell centers,
+            // and only then check the children and notify about the
+            // refinement
+            std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+              refined_cells;
+            std::vector<std::pair<
+              unsigned int,
+              typename Triangulation<dim, spacedim>::cell_iterator>>
+              new_hex_vertices;
+
             for (; hex != triangulation.end() &&
                    hex->level() == static_cast<int>(level);
                  ++hex)
@@ -6659,8 +6756,7 @@ namespace internal
                                                  triangulation.vertices_used);
                         vertex_indices[k++] = current_vertex;
 
-                        triangulation.vertices[current_vertex] =
-                          hex->center(true, true);
+                        new_hex_vertices.emplace_back(current_vertex, hex);
                       }
                   }
 
@@ -7089,11 +7185,21 @@ namespace internal
                   }
                 }
 
+                refined_cells.push_back(hex);
+              }
+
+            compute_new_vertex_locations(new_hex_vertices,
+                                         true,
+                                         triangulation.vertices);
+
+            for (const auto &cell : refined_cells)
+              {
                 if (check_for_distorted_cells &&
-                    has_distorted_children<dim, spacedim>(hex))
-                  cells_with_distorted_children.distorted_cells.push_back(hex);
+                    has_distorted_children<dim, spacedim>(cell))
+                  cells_with_distorted_children.distorted_cells.push_back(
+                    cell);
 
-                triangulation.signals.post_refinement_on_cell(hex);
+                triangulation.signals.post_refinement_on_cell(cell);
               }
           }
 
@@ -15799,6 +15905,9 @@ template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::execute_coarsening_and_refinement()
 {
+  MemoryRegistry::Stage memory_stage(
+    "Triangulation::execute_coarsening_and_refinement");
+
   // Call our version of prepare_coarsening_and_refinement() even if a derived
   // class like parallel::distributed::Triangulation overrides it. Their
   // function will be called in their execute_coarsening_and_refinement()
@@ -15923,11 +16032,14 @@ template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::reset_global_cell_indices()
 {
-  {
-    types::global_cell_index cell_index = 0;
-    for (const auto &cell : active_cell_iterators())
-      cell->set_global_active_cell_index(cell_index++);
-  }
+  // the global active cell indices of a triangulation that is not
+  // distributed coincide with the active cell indices, so we do not need to
+  // store them
+  for (const auto &level : levels)
+    {
+      level->global_active_cell_indices.clear();
+      level->global_active_cell_indices.shrink_to_fit();
+    }
 
   for (unsigned int l = 0; l < levels.size(); ++l)
     {
@@ -2305,8 +2305,20 @@ void
 CellAccessor<dim, spacedim>::set_global_active_cell_index(
   const types::global_cell_index index) const
 {
-  this->tria->levels[this->present_level]
-    ->global_active_cell_indices[this->present_index] = index;
+  auto &level = *this->tria->levels[this->present_level];
+
+  // the indices are not stored as long as they coincide with the active cell
+  // indices, so set up the field before setting the first index
+  if (level.global_active_cell_indices.empty())
+    {
+      level.global_active_cell_indices.resize(level.refine_flags.size(),
+                                              numbers::invalid_dof_index);
+      for (unsigned int i = 0; i < level.refine_flags.size(); ++i)
+        if (level.active_cell_indices[i] != numbers::invalid_unsigned_int)
+          level.global_active_cell_indices[i] = level.active_cell_indices[i];
+    }
+
+  level.global_active_cell_indices[this->present_index] = index;
 }
 
 
@@ -27,6 +27,27 @@
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_description.h>
 
+#include <boost/serialization/utility.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+
+#ifdef DEAL_II_HAVE_UNISTD_H
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -1164,6 +1185,1041 @@ namespace TriangulationDescription
                                         settings);
     }
 
+
+
+
+    template <int dim, int spacedim>
+    Description<dim, spacedim>
+    create_description_from_distributed_mesh(
+      const std::vector<Point<spacedim>>       &vertices,
+      const std::vector<dealii::CellData<dim>> &cells,
+      const MPI_Comm                            comm,
+      const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing,
+      const TriangulationDescription::Settings                   settings)
+    {
+      const unsigned int my_rank =
+        dealii::Utilities::MPI::this_mpi_process(comm);
+      const unsigned int n_ranks =
+        dealii::Utilities::MPI::n_mpi_processes(comm);
+
+      // 1) number vertices and cells globally by the ranges of the ranks
+      const auto get_offsets = [&](const std::uint64_t local_size) {
+        const std::vector<std::uint64_t> sizes =
+          dealii::Utilities::MPI::all_gather(comm, local_size);
+        std::vector<std::uint64_t> offsets(n_ranks + 1, 0);
+        std::partial_sum(sizes.begin(), sizes.end(), offsets.begin() + 1);
+        return offsets;
+      };
+      const std::vector<std::uint64_t> vertex_offsets =
+        get_offsets(vertices.size());
+      const std::uint64_t first_cell_id = get_offsets(cells.size())[my_rank];
+
+      // the process that holds the coordinates of a vertex
+      const auto home_of_vertex = [&](const std::uint64_t vertex) {
+        AssertIndexRange(vertex, vertex_offsets.back());
+        return static_cast<unsigned int>(
+          std::upper_bound(vertex_offsets.begin(),
+                           vertex_offsets.end(),
+                           vertex) -
+          vertex_offsets.begin() - 1);
+      };
+
+      // 2) get the coordinates of all vertices of the cells of this
+      // process. The sorted list of vertices is grouped by the home
+      // processes in increasing order, which is the order in which the
+      // answers are stored in the map below.
+      std::vector<std::uint64_t> cell_vertices;
+      for (const dealii::CellData<dim> &cell : cells)
+        cell_vertices.insert(cell_vertices.end(),
+                             cell.vertices.begin(),
+                             cell.vertices.end());
+      std::sort(cell_vertices.begin(), cell_vertices.end());
+      cell_vertices.erase(std::unique(cell_vertices.begin(),
+                                      cell_vertices.end()),
+                          cell_vertices.end());
+
+      std::vector<Point<spacedim>> cell_vertex_points;
+      cell_vertex_points.reserve(cell_vertices.size());
+      {
+        std::map<unsigned int, std::vector<std::uint64_t>> requests;
+        for (const std::uint64_t vertex : cell_vertices)
+          requests[home_of_vertex(vertex)].push_back(vertex);
+
+        std::map<unsigned int, std::vector<double>> answers;
+        for (const auto &[rank, requested_vertices] :
+             dealii::Utilities::MPI::some_to_some(comm, requests))
+          {
+            std::vector<double> &coordinates = answers[rank];
+            coordinates.reserve(requested_vertices.size() * spacedim);
+            for (const std::uint64_t vertex : requested_vertices)
+              for (unsigned int d = 0; d < spacedim; ++d)
+                coordinates.push_back(
+                  vertices[vertex - vertex_offsets[my_rank]][d]);
+          }
+
+        for (const auto &[rank, coordinates] :
+             dealii::Utilities::MPI::some_to_some(comm, answers))
+          for (unsigned int i = 0; i < coordinates.size(); i += spacedim)
+            {
+              Point<spacedim> point;
+              for (unsigned int d = 0; d < spacedim; ++d)
+                point[d] = coordinates[i + d];
+              cell_vertex_points.push_back(point);
+            }
+        AssertDimension(cell_vertex_points.size(), cell_vertices.size());
+      }
+
+      const auto get_vertex_point = [&](const std::uint64_t vertex) {
+        const auto position = std::lower_bound(cell_vertices.begin(),
+                                               cell_vertices.end(),
+                                               vertex);
+        return cell_vertex_points[position - cell_vertices.begin()];
+      };
+
+      // 3) compute the position of the cell centers along a Hilbert curve.
+      // Append the corners of the global bounding box of the mesh to the
+      // centers so that all processes use the same integer coordinates.
+      const int bits_per_dim = 63 / spacedim;
+
+      std::vector<std::uint64_t> keys;
+      {
+        std::vector<double> lower(spacedim,
+                                  std::numeric_limits<double>::max());
+        std::vector<double> upper(spacedim,
+                                  std::numeric_limits<double>::lowest());
+        for (const Point<spacedim> &point : cell_vertex_points)
+          for (unsigned int d = 0; d < spacedim; ++d)
+            {
+              lower[d] = std::min(lower[d], point[d]);
+              upper[d] = std::max(upper[d], point[d]);
+            }
+        dealii::Utilities::MPI::min(lower, comm, lower);
+        dealii::Utilities::MPI::max(upper, comm, upper);
+
+        std::vector<Point<spacedim>> centers;
+        centers.reserve(cells.size() + 2);
+        for (const dealii::CellData<dim> &cell : cells)
+          {
+            Point<spacedim> center;
+            for (const unsigned int vertex : cell.vertices)
+              center += get_vertex_point(vertex);
+            centers.push_back(center /
+                              static_cast<double>(cell.vertices.size()));
+          }
+
+        if (cells.size() > 0)
+          {
+            Point<spacedim> lower_corner, upper_corner;
+            for (unsigned int d = 0; d < spacedim; ++d)
+              {
+                lower_corner[d] = lower[d];
+                upper_corner[d] = upper[d];
+              }
+            centers.push_back(lower_corner);
+            centers.push_back(upper_corner);
+
+            const auto indices =
+              dealii::Utilities::inverse_Hilbert_space_filling_curve(
+                centers, bits_per_dim);
+            for (unsigned int c = 0; c < cells.size(); ++c)
+              keys.push_back(
+                dealii::Utilities::pack_integers<spacedim>(indices[c],
+                                                           bits_per_dim));
+          }
+      }
+
+      // 4) partition the curve: every process contributes a sample of its
+      // keys, weighted by the number of cells each sample represents, and
+      // the splitters between the processes are chosen such that they
+      // divide the total weight into equal parts
+      std::vector<unsigned int> owners(cells.size());
+      {
+        std::vector<std::uint64_t> sorted_keys(keys);
+        std::sort(sorted_keys.begin(), sorted_keys.end());
+
+        const unsigned int n_samples =
+          std::min<std::size_t>(sorted_keys.size(), 4 * n_ranks);
+        std::vector<std::pair<std::uint64_t, double>> samples;
+        for (unsigned int i = 0; i < n_samples; ++i)
+          samples.emplace_back(sorted_keys[i * sorted_keys.size() / n_samples],
+                               static_cast<double>(sorted_keys.size()) /
+                                 n_samples);
+
+        std::vector<std::pair<std::uint64_t, double>> all_samples;
+        for (const auto &samples_of_rank :
+             dealii::Utilities::MPI::all_gather(comm, samples))
+          all_samples.insert(all_samples.end(),
+                             samples_of_rank.begin(),
+                             samples_of_rank.end());
+        std::sort(all_samples.begin(), all_samples.end());
+
+        double total_weight = 0;
+        for (const auto &sample : all_samples)
+          total_weight += sample.second;
+
+        std::vector<std::uint64_t> splitters;
+        double                     weight = 0;
+        for (const auto &[key, sample_weight] : all_samples)
+          {
+            weight += sample_weight;
+            while (splitters.size() + 1 < n_ranks &&
+                   weight > total_weight * (splitters.size() + 1) / n_ranks)
+              splitters.push_back(key);
+          }
+
+        for (unsigned int c = 0; c < cells.size(); ++c)
+          owners[c] = std::upper_bound(splitters.begin(),
+                                       splitters.end(),
+                                       keys[c]) -
+                      splitters.begin();
+      }
+
+      // 5) find the processes that need to know about each cell, i.e., the
+      // owners of all cells that share a vertex with it. The home processes
+      // of the vertices collect the owners of the adjacent cells and send
+      // them back to the processes holding the cells.
+      std::vector<std::vector<unsigned int>> destinations(cells.size());
+      {
+        std::map<unsigned int, std::vector<std::uint64_t>> vertex_cells;
+        for (unsigned int c = 0; c < cells.size(); ++c)
+          for (const unsigned int vertex : cells[c].vertices)
+            {
+              std::vector<std::uint64_t> &message =
+                vertex_cells[home_of_vertex(vertex)];
+              message.push_back(vertex);
+              message.push_back(first_cell_id + c);
+              message.push_back(my_rank);
+              message.push_back(owners[c]);
+            }
+
+        // entries of the form (vertex, cell, rank of the cell, owner)
+        std::vector<std::array<std::uint64_t, 4>> entries;
+        for (const auto &[rank, message] :
+             dealii::Utilities::MPI::some_to_some(comm, vertex_cells))
+          for (unsigned int i = 0; i < message.size(); i += 4)
+            entries.push_back(
+              {{message[i], message[i + 1], message[i + 2], message[i + 3]}});
+        std::sort(entries.begin(), entries.end());
+
+        std::map<unsigned int, std::vector<std::uint64_t>> cell_destinations;
+        std::vector<unsigned int>                          vertex_owners;
+        for (auto begin = entries.begin(); begin != entries.end();)
+          {
+            const auto end =
+              std::find_if(begin, entries.end(), [&](const auto &entry) {
+                return entry[0] != (*begin)[0];
+              });
+
+            vertex_owners.clear();
+            for (auto entry = begin; entry != end; ++entry)
+              vertex_owners.push_back((*entry)[3]);
+            std::sort(vertex_owners.begin(), vertex_owners.end());
+            vertex_owners.erase(std::unique(vertex_owners.begin(),
+                                            vertex_owners.end()),
+                                vertex_owners.end());
+
+            for (auto entry = begin; entry != end; ++entry)
+              for (const unsigned int owner : vertex_owners)
+                if (owner != (*entry)[3])
+                  {
+                    std::vector<std::uint64_t> &message =
+                      cell_destinations[(*entry)[2]];
+                    message.push_back((*entry)[1]);
+                    message.push_back(owner);
+                  }
+
+            begin = end;
+          }
+
+        for (unsigned int c = 0; c < cells.size(); ++c)
+          destinations[c].push_back(owners[c]);
+        for (const auto &[rank, message] :
+             dealii::Utilities::MPI::some_to_some(comm, cell_destinations))
+          for (unsigned int i = 0; i < message.size(); i += 2)
+            destinations[message[i] - first_cell_id].push_back(message[i + 1]);
+        for (auto &ranks : destinations)
+          {
+            std::sort(ranks.begin(), ranks.end());
+            ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+          }
+      }
+
+      // 6) send the cells to the processes that need them. Each cell is
+      // encoded as (id, owner, material id, manifold id, number of
+      // vertices, vertex indices), with the coordinates of the vertices in
+      // a separate array
+      std::map<unsigned int,
+               std::pair<std::vector<std::uint64_t>, std::vector<double>>>
+        cell_data;
+      for (unsigned int c = 0; c < cells.size(); ++c)
+        for (const unsigned int rank : destinations[c])
+          {
+            auto &[indices, coordinates] = cell_data[rank];
+            indices.push_back(first_cell_id + c);
+            indices.push_back(owners[c]);
+            indices.push_back(cells[c].material_id);
+            indices.push_back(cells[c].manifold_id);
+            indices.push_back(cells[c].vertices.size());
+            for (const unsigned int vertex : cells[c].vertices)
+              {
+                indices.push_back(vertex);
+                const Point<spacedim> point = get_vertex_point(vertex);
+                for (unsigned int d = 0; d < spacedim; ++d)
+                  coordinates.push_back(point[d]);
+              }
+          }
+
+      // 7) set up the description from the received cells, sorted by their
+      // id. The local vertex numbering preserves the order of the global
+      // one, so that all processes agree on the orientation of shared
+      // faces and edges.
+      struct ReceivedCell
+      {
+        std::uint64_t                id;
+        unsigned int                 owner;
+        types::material_id           material_id;
+        types::manifold_id           manifold_id;
+        std::vector<std::uint64_t>   vertices;
+        std::vector<Point<spacedim>> points;
+      };
+      std::vector<ReceivedCell> received_cells;
+      for (const auto &[rank, data] :
+           dealii::Utilities::MPI::some_to_some(comm, cell_data))
+        {
+          const auto &[indices, coordinates] = data;
+          for (std::size_t i = 0, j = 0; i < indices.size();)
+            {
+              ReceivedCell cell;
+              cell.id          = indices[i];
+              cell.owner       = indices[i + 1];
+              cell.material_id = indices[i + 2];
+              cell.manifold_id = indices[i + 3];
+              cell.vertices.assign(indices.begin() + i + 5,
+                                   indices.begin() + i + 5 + indices[i + 4]);
+              for (unsigned int v = 0; v < cell.vertices.size(); ++v)
+                {
+                  Point<spacedim> point;
+                  for (unsigned int d = 0; d < spacedim; ++d, ++j)
+                    point[d] = coordinates[j];
+                  cell.points.push_back(point);
+                }
+              i += 5 + indices[i + 4];
+              received_cells.push_back(std::move(cell));
+            }
+        }
+      std::sort(received_cells.begin(),
+                received_cells.end(),
+                [](const ReceivedCell &a, const ReceivedCell &b) {
+                  return a.id < b.id;
+                });
+
+      std::vector<std::uint64_t> local_vertices;
+      for (const ReceivedCell &cell : received_cells)
+        local_vertices.insert(local_vertices.end(),
+                              cell.vertices.begin(),
+                              cell.vertices.end());
+      std::sort(local_vertices.begin(), local_vertices.end());
+      local_vertices.erase(std::unique(local_vertices.begin(),
+                                       local_vertices.end()),
+                           local_vertices.end());
+
+      Description<dim, spacedim> description;
+      description.comm      = comm;
+      description.smoothing = smoothing;
+      description.settings  = settings;
+      description.coarse_cell_vertices.resize(local_vertices.size());
+      description.cell_infos.resize(1);
+
+      for (const ReceivedCell &cell : received_cells)
+        {
+          dealii::CellData<dim> coarse_cell(cell.vertices.size());
+          for (unsigned int v = 0; v < cell.vertices.size(); ++v)
+            {
+              const unsigned int local_vertex =
+                std::lower_bound(local_vertices.begin(),
+                                 local_vertices.end(),
+                                 cell.vertices[v]) -
+                local_vertices.begin();
+              coarse_cell.vertices[v] = local_vertex;
+              description.coarse_cell_vertices[local_vertex] = cell.points[v];
+            }
+          coarse_cell.material_id = cell.material_id;
+          coarse_cell.manifold_id = cell.manifold_id;
+          description.coarse_cells.push_back(coarse_cell);
+          description.coarse_cell_index_to_coarse_cell_id.push_back(cell.id);
+
+          CellData<dim> cell_info;
+          cell_info.id = CellId(cell.id, {}).template to_binary<dim>();
+          cell_info.subdomain_id       = cell.owner;
+          cell_info.level_subdomain_id = cell.owner;
+          cell_info.manifold_id        = cell.manifold_id;
+          description.cell_infos[0].push_back(cell_info);
+        }
+
+      return description;
+    }
+
+
+
+    namespace
+    {
+      /**
+       * A Z-order (Morton) space-filling curve through the cells of a
+       * structured grid with @p n_cells[d] cells in coordinate direction
+       * <tt>d</tt>. The curve runs through the smallest box of $2^k$ cells
+       * per direction containing the grid and skips the cells outside of the
+       * grid, so that the position of a cell along the curve is the number
+       * of cells of the grid visited before it. All operations only visit
+       * the parts of the tree of boxes that are relevant for the result.
+       */
+      template <int dim>
+      class StructuredMortonCurve
+      {
+      public:
+        using CellIndex = std::array<std::uint64_t, dim>;
+
+        StructuredMortonCurve(const CellIndex &n_cells)
+          : n_cells(n_cells)
+          , root_size(1)
+        {
+          for (unsigned int d = 0; d < dim; ++d)
+            while (root_size < n_cells[d])
+              root_size *= 2;
+        }
+
+        /**
+         * Return the position of @p cell along the curve.
+         */
+        std::uint64_t
+        position(const CellIndex &cell) const
+        {
+          CellIndex     origin = {};
+          std::uint64_t result = 0;
+          for (std::uint64_t size = root_size; size > 1; size /= 2)
+            {
+              const std::uint64_t half  = size / 2;
+              unsigned int        child = 0;
+              for (unsigned int d = 0; d < dim; ++d)
+                if (cell[d] >= origin[d] + half)
+                  child |= (1u << d);
+
+              for (unsigned int c = 0; c < child; ++c)
+                result += n_cells_in_box(child_origin(origin, half, c), half);
+              origin = child_origin(origin, half, child);
+            }
+          return result;
+        }
+
+        /**
+         * Append the cells at the positions [begin, end) along the curve to
+         * @p cells, in the order of the curve.
+         */
+        void
+        collect_cells(const std::uint64_t     begin,
+                      const std::uint64_t     end,
+                      std::vector<CellIndex> &cells) const
+        {
+          collect_cells(CellIndex(), root_size, 0, begin, end, cells);
+        }
+
+      private:
+        CellIndex
+        child_origin(const CellIndex    &origin,
+                     const std::uint64_t half,
+                     const unsigned int  child) const
+        {
+          CellIndex result = origin;
+          for (unsigned int d = 0; d < dim; ++d)
+            if (child & (1u << d))
+              result[d] += half;
+          return result;
+        }
+
+        std::uint64_t
+        n_cells_in_box(const CellIndex &origin, const std::uint64_t size) const
+        {
+          std::uint64_t result = 1;
+          for (unsigned int d = 0; d < dim; ++d)
+            result *= (origin[d] < n_cells[d]) ?
+                        std::min(size, n_cells[d] - origin[d]) :
+                        0;
+          return result;
+        }
+
+        void
+        collect_cells(const CellIndex        &origin,
+                      const std::uint64_t     size,
+                      const std::uint64_t     first_position,
+                      const std::uint64_t     begin,
+                      const std::uint64_t     end,
+                      std::vector<CellIndex> &cells) const
+        {
+          const std::uint64_t n = n_cells_in_box(origin, size);
+          if (n == 0 || first_position >= end || first_position + n <= begin)
+            return;
+
+          if (size == 1)
+            {
+              cells.push_back(origin);
+              return;
+            }
+
+          std::uint64_t position = first_position;
+          for (unsigned int c = 0; c < (1u << dim); ++c)
+            {
+              const CellIndex child = child_origin(origin, size / 2, c);
+              collect_cells(child, size / 2, position, begin, end, cells);
+              position += n_cells_in_box(child, size / 2);
+            }
+        }
+
+        const CellIndex n_cells;
+        std::uint64_t   root_size;
+      };
+    } // namespace
+
+
+
+    template <int dim>
+    Description<dim, dim>
+    create_description_from_subdivided_hyper_rectangle(
+      const std::vector<unsigned int>                      &repetitions,
+      const Point<dim>                                     &p_1,
+      const Point<dim>                                     &p_2,
+      const MPI_Comm                                        comm,
+      const bool                                            colorize,
+      const typename Triangulation<dim, dim>::MeshSmoothing smoothing,
+      const TriangulationDescription::Settings              settings)
+    {
+      AssertDimension(repetitions.size(), dim);
+
+      using CellIndex = typename StructuredMortonCurve<dim>::CellIndex;
+
+      // normalize the corner points as in
+      // GridGenerator::subdivided_hyper_rectangle(), and compute the vertices
+      // in the same way so that the two meshes coincide exactly
+      Point<dim>                  p1;
+      std::array<Point<dim>, dim> delta;
+      CellIndex                   n_cells;
+      std::uint64_t               n_global_cells = 1;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          Assert(repetitions[d] >= 1,
+                 ExcMessage("The number of repetitions must be at least one."));
+          p1[d]       = std::min(p_1[d], p_2[d]);
+          delta[d][d] = (std::max(p_1[d], p_2[d]) - p1[d]) / repetitions[d];
+          Assert(delta[d][d] > 0.0,
+                 ExcMessage("The coordinates of p1 and p2 need to be "
+                            "different in every coordinate direction."));
+          n_cells[d] = repetitions[d];
+          n_global_cells *= repetitions[d];
+        }
+
+      const StructuredMortonCurve<dim> curve(n_cells);
+
+      // 1) partition the curve into contiguous pieces of equal size (up to
+      // one cell), without forming products that could overflow
+      const std::uint64_t n_ranks =
+        dealii::Utilities::MPI::n_mpi_processes(comm);
+      const std::uint64_t my_rank =
+        dealii::Utilities::MPI::this_mpi_process(comm);
+      const auto first_position_of_rank = [&](const std::uint64_t rank) {
+        return (n_global_cells / n_ranks) * rank +
+               (n_global_cells % n_ranks) * rank / n_ranks;
+      };
+      const auto owner_of_position = [&](const std::uint64_t position) {
+        std::uint64_t lower = 0, upper = n_ranks;
+        while (upper - lower > 1)
+          {
+            const std::uint64_t middle = (lower + upper) / 2;
+            if (first_position_of_rank(middle) <= position)
+              lower = middle;
+            else
+              upper = middle;
+          }
+        return static_cast<types::subdomain_id>(lower);
+      };
+
+      // 2) collect the locally owned cells and the cells sharing a vertex
+      // with them, sorted by their position along the curve
+      std::vector<CellIndex> owned_cells;
+      curve.collect_cells(first_position_of_rank(my_rank),
+                          first_position_of_rank(my_rank + 1),
+                          owned_cells);
+
+      std::vector<std::pair<std::uint64_t, CellIndex>> relevant_cells;
+      for (const CellIndex &cell : owned_cells)
+        for (unsigned int n = 0; n < dealii::Utilities::pow(3, dim); ++n)
+          {
+            CellIndex    neighbor = cell;
+            bool         is_valid = true;
+            unsigned int code     = n;
+            for (unsigned int d = 0; d < dim; ++d, code /= 3)
+              {
+                const unsigned int offset = code % 3;
+                if ((offset == 0 && cell[d] == 0) ||
+                    (offset == 2 && cell[d] + 1 == n_cells[d]))
+                  is_valid = false;
+                else
+                  neighbor[d] = cell[d] + offset - 1;
+              }
+            if (is_valid)
+              relevant_cells.emplace_back(curve.position(neighbor), neighbor);
+          }
+      std::sort(relevant_cells.begin(),
+                relevant_cells.end(),
+                [](const auto &a, const auto &b) { return a.first < b.first; });
+      relevant_cells.erase(std::unique(relevant_cells.begin(),
+                                       relevant_cells.end(),
+                                       [](const auto &a, const auto &b) {
+                                         return a.first == b.first;
+                                       }),
+                           relevant_cells.end());
+
+      // 3) number the vertices of the relevant cells locally, preserving the
+      // order of the lexicographic global numbering so that all processes
+      // agree on the orientation of shared faces and edges
+      const auto global_vertex_index = [&](const CellIndex   &cell,
+                                           const unsigned int v) {
+        std::uint64_t index = 0;
+        for (int d = dim - 1; d >= 0; --d)
+          index = index * (n_cells[d] + 1) + cell[d] + ((v >> d) & 1u);
+        return index;
+      };
+
+      std::vector<std::uint64_t> local_vertices;
+      for (const auto &position_and_cell : relevant_cells)
+        for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+          local_vertices.push_back(
+            global_vertex_index(position_and_cell.second, v));
+      std::sort(local_vertices.begin(), local_vertices.end());
+      local_vertices.erase(std::unique(local_vertices.begin(),
+                                       local_vertices.end()),
+                           local_vertices.end());
+
+      // 4) set up the description
+      Description<dim, dim> description;
+      description.comm      = comm;
+      description.smoothing = smoothing;
+      description.settings  = settings;
+      description.coarse_cell_vertices.resize(local_vertices.size());
+      description.cell_infos.resize(1);
+
+      for (const auto &[position, cell] : relevant_cells)
+        {
+          dealii::CellData<dim> coarse_cell;
+          for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+            {
+              const unsigned int local_vertex =
+                std::lower_bound(local_vertices.begin(),
+                                 local_vertices.end(),
+                                 global_vertex_index(cell, v)) -
+                local_vertices.begin();
+              coarse_cell.vertices[v] = local_vertex;
+
+              Point<dim> point = p1;
+              for (unsigned int d = 0; d < dim; ++d)
+                point += static_cast<double>(cell[d] + ((v >> d) & 1u)) *
+                         delta[d];
+              description.coarse_cell_vertices[local_vertex] = point;
+            }
+          coarse_cell.material_id = 0;
+          description.coarse_cells.push_back(coarse_cell);
+          description.coarse_cell_index_to_coarse_cell_id.push_back(position);
+
+          CellData<dim> cell_info;
+          cell_info.id = CellId(position, {}).template to_binary<dim>();
+          cell_info.subdomain_id       = owner_of_position(position);
+          cell_info.level_subdomain_id = cell_info.subdomain_id;
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              if (cell[d] == 0)
+                cell_info.boundary_ids.emplace_back(2 * d,
+                                                    colorize ? 2 * d : 0);
+              if (cell[d] + 1 == n_cells[d])
+                cell_info.boundary_ids.emplace_back(2 * d + 1,
+                                                    colorize ? 2 * d + 1 : 0);
+            }
+          description.cell_infos[0].push_back(cell_info);
+        }
+
+      return description;
+    }
+
+
+
+    namespace
+    {
+      /**
+       * Identifier at the start of the files written by save_description().
+       */
+      constexpr std::uint64_t description_file_magic = 0x6465616c2e494944;
+
+      /**
+       * Version of the file format written by save_description().
+       */
+      constexpr std::uint64_t description_file_version = 1;
+
+
+
+      /**
+       * Write the size of @p data followed by its contents to @p out, padded
+       * to a multiple of eight bytes so that all arrays in the file are
+       * aligned.
+       */
+      template <typename T>
+      void
+      write_array(std::ostream &out, const std::vector<T> &data)
+      {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Only trivially copyable types can be written.");
+
+        const std::uint64_t size = data.size();
+        out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+        out.write(reinterpret_cast<const char *>(data.data()),
+                  size * sizeof(T));
+
+        const char zeros[8] = {};
+        out.write(zeros, (8 - (size * sizeof(T)) % 8) % 8);
+      }
+
+
+
+      /**
+       * A class that reads the arrays written by write_array() from a
+       * contiguous block of memory, typically a memory-mapped file, and
+       * checks that they do not extend past its end.
+       */
+      class ArrayReader
+      {
+      public:
+        ArrayReader(const char        *begin,
+                    const std::size_t  size,
+                    const std::string &filename)
+          : position(begin)
+          , end(begin + size)
+          , filename(filename)
+        {}
+
+        template <typename T>
+        void
+        read(std::vector<T> &data)
+        {
+          std::uint64_t size;
+          check_available(sizeof(size));
+          std::memcpy(&size, position, sizeof(size));
+          position += sizeof(size);
+
+          const std::size_t n_bytes = size * sizeof(T);
+          check_available(n_bytes + (8 - n_bytes % 8) % 8);
+          data.resize(size);
+          if (n_bytes > 0)
+            std::memcpy(static_cast<void *>(data.data()), position, n_bytes);
+          position += n_bytes + (8 - n_bytes % 8) % 8;
+        }
+
+      private:
+        void
+        check_available(const std::size_t n_bytes) const
+        {
+          AssertThrow(n_bytes <= static_cast<std::size_t>(end - position),
+                      ExcMessage("The file <" + filename +
+                                 "> ends before all of the data of the "
+                                 "triangulation description was read."));
+        }
+
+        const char        *position;
+        const char *const  end;
+        const std::string &filename;
+      };
+    } // namespace
+
+
+
+    template <int dim, int spacedim>
+    void
+    save_description(const Description<dim, spacedim> &description,
+                     const std::string                &filename)
+    {
+      std::ofstream out(filename, std::ios::binary);
+      AssertThrow(out.good(), ExcFileNotOpen(filename));
+
+      write_array(out,
+                  std::vector<std::uint64_t>{description_file_magic,
+                                             description_file_version,
+                                             dim,
+                                             spacedim,
+                                             description.settings,
+                                             description.smoothing});
+
+      // the coarse mesh: vertices, and the cells as a compressed row format
+      // of their vertex indices together with their material and manifold
+      // ids
+      {
+        std::vector<double> coordinates;
+        coordinates.reserve(description.coarse_cell_vertices.size() *
+                            spacedim);
+        for (const Point<spacedim> &vertex : description.coarse_cell_vertices)
+          for (unsigned int d = 0; d < spacedim; ++d)
+            coordinates.push_back(vertex[d]);
+        write_array(out, coordinates);
+      }
+      {
+        const auto &cells = description.coarse_cells;
+
+        std::vector<std::uint64_t> vertex_offsets(1, 0);
+        std::vector<unsigned int>  vertex_indices;
+        std::vector<types::material_id> material_ids;
+        std::vector<types::manifold_id> manifold_ids;
+        vertex_offsets.reserve(cells.size() + 1);
+        material_ids.reserve(cells.size());
+        manifold_ids.reserve(cells.size());
+        for (const dealii::CellData<dim> &cell : cells)
+          {
+            vertex_indices.insert(vertex_indices.end(),
+                                  cell.vertices.begin(),
+                                  cell.vertices.end());
+            vertex_offsets.push_back(vertex_indices.size());
+            material_ids.push_back(cell.material_id);
+            manifold_ids.push_back(cell.manifold_id);
+          }
+        write_array(out, vertex_offsets);
+        write_array(out, vertex_indices);
+        write_array(out, material_ids);
+        write_array(out, manifold_ids);
+      }
+      write_array(out,
+                  std::vector<std::uint64_t>(
+                    description.coarse_cell_index_to_coarse_cell_id.begin(),
+                    description.coarse_cell_index_to_coarse_cell_id.end()));
+
+      // the cells on all levels, one array for each member of CellData
+      {
+        std::vector<std::uint64_t> n_cells_per_level;
+        for (const auto &cell_infos : description.cell_infos)
+          n_cells_per_level.push_back(cell_infos.size());
+        write_array(out, n_cells_per_level);
+      }
+      for (const auto &cell_infos : description.cell_infos)
+        {
+          std::vector<CellId::binary_type> ids;
+          std::vector<types::subdomain_id> subdomain_ids;
+          std::vector<types::subdomain_id> level_subdomain_ids;
+          std::vector<types::manifold_id>  manifold_ids;
+          std::vector<decltype(CellData<dim>::manifold_line_ids)>
+            manifold_line_ids;
+          std::vector<decltype(CellData<dim>::manifold_quad_ids)>
+            manifold_quad_ids;
+          std::vector<std::uint64_t>      boundary_offsets(1, 0);
+          std::vector<unsigned int>       boundary_faces;
+          std::vector<types::boundary_id> boundary_ids;
+          for (const CellData<dim> &cell_info : cell_infos)
+            {
+              ids.push_back(cell_info.id);
+              subdomain_ids.push_back(cell_info.subdomain_id);
+              level_subdomain_ids.push_back(cell_info.level_subdomain_id);
+              manifold_ids.push_back(cell_info.manifold_id);
+              manifold_line_ids.push_back(cell_info.manifold_line_ids);
+              manifold_quad_ids.push_back(cell_info.manifold_quad_ids);
+              for (const auto &[face, boundary_id] : cell_info.boundary_ids)
+                {
+                  boundary_faces.push_back(face);
+                  boundary_ids.push_back(boundary_id);
+                }
+              boundary_offsets.push_back(boundary_faces.size());
+            }
+          write_array(out, ids);
+          write_array(out, subdomain_ids);
+          write_array(out, level_subdomain_ids);
+          write_array(out, manifold_ids);
+          write_array(out, manifold_line_ids);
+          write_array(out, manifold_quad_ids);
+          write_array(out, boundary_offsets);
+          write_array(out, boundary_faces);
+          write_array(out, boundary_ids);
+        }
+
+      out.close();
+      AssertThrow(out.good(), ExcIO());
+    }
+
+
+
+    template <int dim, int spacedim>
+    Description<dim, spacedim>
+    load_description(const std::string &filename, const MPI_Comm comm)
+    {
+      // Get the contents of the file as one block of memory. If possible,
+      // map the file rather than reading it, so that the operating system
+      // can page in the data as we copy it into the description.
+#ifdef DEAL_II_HAVE_UNISTD_H
+      const int fd = open(filename.c_str(), O_RDONLY);
+      AssertThrow(fd != -1, ExcFileNotOpen(filename));
+
+      struct stat file_status;
+      const int   ierr = fstat(fd, &file_status);
+      if (ierr != 0)
+        close(fd);
+      AssertThrow(ierr == 0, ExcIO());
+      const std::size_t file_size = file_status.st_size;
+
+      void *mapped_file = MAP_FAILED;
+      if (file_size > 0)
+        mapped_file = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd);
+      AssertThrow(mapped_file != MAP_FAILED,
+                  ExcMessage("The file <" + filename +
+                             "> could not be mapped into memory."));
+      madvise(mapped_file, file_size, MADV_SEQUENTIAL);
+
+      const std::unique_ptr<void, std::function<void(void *)>> unmap_file(
+        mapped_file, [file_size](void *p) { munmap(p, file_size); });
+      const char *const file_contents = static_cast<const char *>(mapped_file);
+#else
+      std::ifstream in(filename, std::ios::binary);
+      AssertThrow(in.good(), ExcFileNotOpen(filename));
+      const std::vector<char> buffer((std::istreambuf_iterator<char>(in)),
+                                     std::istreambuf_iterator<char>());
+      const char *const       file_contents = buffer.data();
+      const std::size_t       file_size     = buffer.size();
+#endif
+
+      ArrayReader reader(file_contents, file_size, filename);
+
+      std::vector<std::uint64_t> header;
+      reader.read(header);
+      AssertThrow(header.size() == 6 && header[0] == description_file_magic,
+                  ExcMessage("The file <" + filename +
+                             "> was not written by save_description()."));
+      AssertThrow(header[1] == description_file_version,
+                  ExcMessage("The file <" + filename +
+                             "> uses an unsupported version of the file "
+                             "format."));
+      AssertThrow(header[2] == dim && header[3] == spacedim,
+                  ExcMessage("The file <" + filename +
+                             "> contains a triangulation description of "
+                             "dimensions " +
+                             std::to_string(header[2]) + " and " +
+                             std::to_string(header[3]) + ", but dimensions " +
+                             std::to_string(dim) + " and " +
+                             std::to_string(spacedim) + " were requested."));
+
+      Description<dim, spacedim> description;
+      description.comm     = comm;
+      description.settings = static_cast<Settings>(header[4]);
+      description.smoothing =
+        static_cast<typename Triangulation<dim, spacedim>::MeshSmoothing>(
+          header[5]);
+
+      {
+        std::vector<double> coordinates;
+        reader.read(coordinates);
+        AssertThrow(coordinates.size() % spacedim == 0, ExcIO());
+        description.coarse_cell_vertices.resize(coordinates.size() /
+                                                spacedim);
+        for (unsigned int v = 0; v < description.coarse_cell_vertices.size();
+             ++v)
+          for (unsigned int d = 0; d < spacedim; ++d)
+            description.coarse_cell_vertices[v][d] =
+              coordinates[v * spacedim + d];
+      }
+      {
+        std::vector<std::uint64_t>      vertex_offsets;
+        std::vector<unsigned int>       vertex_indices;
+        std::vector<types::material_id> material_ids;
+        std::vector<types::manifold_id> manifold_ids;
+        reader.read(vertex_offsets);
+        reader.read(vertex_indices);
+        reader.read(material_ids);
+        reader.read(manifold_ids);
+
+        const std::size_t n_cells = material_ids.size();
+        AssertThrow(vertex_offsets.size() == n_cells + 1 &&
+                      manifold_ids.size() == n_cells &&
+                      vertex_offsets.back() == vertex_indices.size(),
+                    ExcIO());
+
+        auto &cells = description.coarse_cells;
+        cells.resize(n_cells);
+        for (std::size_t c = 0; c < n_cells; ++c)
+          {
+            cells[c].vertices.assign(vertex_indices.begin() +
+                                       vertex_offsets[c],
+                                     vertex_indices.begin() +
+                                       vertex_offsets[c + 1]);
+            cells[c].material_id = material_ids[c];
+            cells[c].manifold_id = manifold_ids[c];
+          }
+      }
+      {
+        std::vector<std::uint64_t> coarse_cell_ids;
+        reader.read(coarse_cell_ids);
+        description.coarse_cell_index_to_coarse_cell_id.assign(
+          coarse_cell_ids.begin(), coarse_cell_ids.end());
+      }
+
+      std::vector<std::uint64_t> n_cells_per_level;
+      reader.read(n_cells_per_level);
+      description.cell_infos.resize(n_cells_per_level.size());
+      for (unsigned int level = 0; level < n_cells_per_level.size(); ++level)
+        {
+          std::vector<CellId::binary_type> ids;
+          std::vector<types::subdomain_id> subdomain_ids;
+          std::vector<types::subdomain_id> level_subdomain_ids;
+          std::vector<types::manifold_id>  manifold_ids;
+          std::vector<decltype(CellData<dim>::manifold_line_ids)>
+            manifold_line_ids;
+          std::vector<decltype(CellData<dim>::manifold_quad_ids)>
+            manifold_quad_ids;
+          std::vector<std::uint64_t>      boundary_offsets;
+          std::vector<unsigned int>       boundary_faces;
+          std::vector<types::boundary_id> boundary_ids;
+          reader.read(ids);
+          reader.read(subdomain_ids);
+          reader.read(level_subdomain_ids);
+          reader.read(manifold_ids);
+          reader.read(manifold_line_ids);
+          reader.read(manifold_quad_ids);
+          reader.read(boundary_offsets);
+          reader.read(boundary_faces);
+          reader.read(boundary_ids);
+
+          const std::size_t n_cells = n_cells_per_level[level];
+          AssertThrow(ids.size() == n_cells &&
+                        subdomain_ids.size() == n_cells &&
+                        level_subdomain_ids.size() == n_cells &&
+                        manifold_ids.size() == n_cells &&
+                        manifold_line_ids.size() == n_cells &&
+                        manifold_quad_ids.size() == n_cells &&
+                        boundary_offsets.size() == n_cells + 1 &&
+                        boundary_offsets.back() == boundary_faces.size() &&
+                        boundary_ids.size() == boundary_faces.size(),
+                      ExcIO());
+
+          auto &cell_infos = description.cell_infos[level];
+          cell_infos.resize(n_cells);
+          for (std::size_t c = 0; c < n_cells; ++c)
+            {
+              CellData<dim> &cell_info     = cell_infos[c];
+              cell_info.id                 = ids[c];
+              cell_info.subdomain_id       = subdomain_ids[c];
+              cell_info.level_subdomain_id = level_subdomain_ids[c];
+              cell_info.manifold_id        = manifold_ids[c];
+              cell_info.manifold_line_ids  = manifold_line_ids[c];
+              cell_info.manifold_quad_ids  = manifold_quad_ids[c];
+              cell_info.boundary_ids.reserve(boundary_offsets[c + 1] -
+                                             boundary_offsets[c]);
+              for (std::uint64_t b = boundary_offsets[c];
+                   b < boundary_offsets[c + 1];
+                   ++b)
+                cell_info.boundary_ids.emplace_back(boundary_faces[b],
+                                                    boundary_ids[b]);
+            }
+        }
+
+      return description;
+    }
+
   } // namespace Utilities
 } // namespace TriangulationDescription
 
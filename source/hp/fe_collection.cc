@@ -18,8 +18,12 @@
 #include <deal.II/hp/fe_collection.h>
 #include <deal.II/hp/mapping_collection.h>
 
+#include <array>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <set>
+#include <tuple>
 
 
 
@@ -27,6 +31,75 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace hp
 {
+  template <int dim, int spacedim>
+  struct FECollection<dim, spacedim>::InterfaceDataCache
+  {
+    /**
+     * The type of the identities between degrees of freedom.
+     */
+    using Identities = std::vector<std::map<unsigned int, unsigned int>>;
+
+    /**
+     * Mutex guarding all fields below.
+     */
+    std::mutex mutex;
+
+    /**
+     * The identities between degrees of freedom on vertices, lines and
+     * quads, indexed by the dimension of the object and keyed by the set of
+     * elements and the face number.
+     */
+    std::array<std::map<std::pair<std::set<unsigned int>, unsigned int>,
+                        Identities>,
+               3>
+      dof_identities;
+
+    /**
+     * The face interpolation matrices, keyed by the two element indices and
+     * the face number.
+     */
+    std::map<std::tuple<unsigned int, unsigned int, unsigned int>,
+             FullMatrix<double>>
+      face_interpolation_matrices;
+
+    /**
+     * The subface interpolation matrices, keyed by the two element indices,
+     * the subface and the face number.
+     */
+    std::map<std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>,
+             FullMatrix<double>>
+      subface_interpolation_matrices;
+
+    /**
+     * Return the entry for @p key in @p cache, computing it by @p compute
+     * if it is not present yet. The computation runs without holding the
+     * lock, such that different entries can be computed concurrently; if two
+     * threads compute the same entry, the first result is kept. Since
+     * std::map does not move its elements, the returned reference stays
+     * valid as long as the cache exists.
+     */
+    template <typename MapType, typename Function>
+    const typename MapType::mapped_type &
+    get_or_compute(MapType                        &cache,
+                   const typename MapType::key_type &key,
+                   const Function                 &compute)
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto                  entry = cache.find(key);
+        if (entry != cache.end())
+          return entry->second;
+      }
+
+      typename MapType::mapped_type value = compute();
+
+      std::lock_guard<std::mutex> lock(mutex);
+      return cache.emplace(key, std::move(value)).first->second;
+    }
+  };
+
+
+
   template <int dim, int spacedim>
   FECollection<dim, spacedim>::FECollection()
   {
@@ -73,6 +146,10 @@ namespace hp
                       "same number of vector components!"));
 
     Collection<FiniteElement<dim, spacedim>>::push_back(new_fe.clone());
+
+    // the cached interface data might be shared with copies of this object
+    // that do not contain the new element, so start with a new cache
+    interface_data_cache = std::make_shared<InterfaceDataCache>();
   }
 
 
@@ -527,11 +604,16 @@ namespace hp
   FECollection<dim, spacedim>::hp_vertex_dof_identities(
     const std::set<unsigned int> &fes) const
   {
+    Assert(interface_data_cache != nullptr, ExcNoFiniteElements());
+
     auto query_vertex_dof_identities = [this](const unsigned int fe_index_1,
                                               const unsigned int fe_index_2) {
       return (*this)[fe_index_1].hp_vertex_dof_identities((*this)[fe_index_2]);
     };
-    return compute_hp_dof_identities(fes, query_vertex_dof_identities);
+    return interface_data_cache->get_or_compute(
+      interface_data_cache->dof_identities[0], std::make_pair(fes, 0U), [&]() {
+        return compute_hp_dof_identities(fes, query_vertex_dof_identities);
+      });
   }
 
 
@@ -541,11 +623,16 @@ namespace hp
   FECollection<dim, spacedim>::hp_line_dof_identities(
     const std::set<unsigned int> &fes) const
   {
+    Assert(interface_data_cache != nullptr, ExcNoFiniteElements());
+
     auto query_line_dof_identities = [this](const unsigned int fe_index_1,
                                             const unsigned int fe_index_2) {
       return (*this)[fe_index_1].hp_line_dof_identities((*this)[fe_index_2]);
     };
-    return compute_hp_dof_identities(fes, query_line_dof_identities);
+    return interface_data_cache->get_or_compute(
+      interface_data_cache->dof_identities[1], std::make_pair(fes, 0U), [&]() {
+        return compute_hp_dof_identities(fes, query_line_dof_identities);
+      });
   }
 
 
@@ -562,7 +649,65 @@ namespace hp
       return (*this)[fe_index_1].hp_quad_dof_identities((*this)[fe_index_2],
                                                         face_no);
     };
-    return compute_hp_dof_identities(fes, query_quad_dof_identities);
+    return interface_data_cache->get_or_compute(
+      interface_data_cache->dof_identities[2],
+      std::make_pair(fes, face_no),
+      [&]() {
+        return compute_hp_dof_identities(fes, query_quad_dof_identities);
+      });
+  }
+
+
+
+  template <int dim, int spacedim>
+  const FullMatrix<double> &
+  FECollection<dim, spacedim>::get_face_interpolation_matrix(
+    const unsigned int fe_index_1,
+    const unsigned int fe_index_2,
+    const unsigned int face_no) const
+  {
+    AssertIndexRange(fe_index_1, this->size());
+    AssertIndexRange(fe_index_2, this->size());
+
+    return interface_data_cache->get_or_compute(
+      interface_data_cache->face_interpolation_matrices,
+      std::make_tuple(fe_index_1, fe_index_2, face_no),
+      [&]() {
+        const FiniteElement<dim, spacedim> &fe1 = (*this)[fe_index_1];
+        const FiniteElement<dim, spacedim> &fe2 = (*this)[fe_index_2];
+
+        FullMatrix<double> matrix(fe2.n_dofs_per_face(face_no),
+                                  fe1.n_dofs_per_face(face_no));
+        fe1.get_face_interpolation_matrix(fe2, matrix, face_no);
+        return matrix;
+      });
+  }
+
+
+
+  template <int dim, int spacedim>
+  const FullMatrix<double> &
+  FECollection<dim, spacedim>::get_subface_interpolation_matrix(
+    const unsigned int fe_index_1,
+    const unsigned int fe_index_2,
+    const unsigned int subface,
+    const unsigned int face_no) const
+  {
+    AssertIndexRange(fe_index_1, this->size());
+    AssertIndexRange(fe_index_2, this->size());
+
+    return interface_data_cache->get_or_compute(
+      interface_data_cache->subface_interpolation_matrices,
+      std::make_tuple(fe_index_1, fe_index_2, subface, face_no),
+      [&]() {
+        const FiniteElement<dim, spacedim> &fe1 = (*this)[fe_index_1];
+        const FiniteElement<dim, spacedim> &fe2 = (*this)[fe_index_2];
+
+        FullMatrix<double> matrix(fe2.n_dofs_per_face(face_no),
+                                  fe1.n_dofs_per_face(face_no));
+        fe1.get_subface_interpolation_matrix(fe2, subface, matrix, face_no);
+        return matrix;
+      });
   }
 
 
@@ -147,7 +147,8 @@ namespace hp
   {
     // We've already resized the `fe_values_table` correctly above, but right
     // now it just contains nullptrs. Create copies of the objects that
-    // `other.fe_values_table` stores
+    // `other.fe_values_table` stores; their copy constructors share the
+    // data the finite elements have precomputed where possible
     Threads::TaskGroup<> task_group;
     for (unsigned int fe_index = 0; fe_index < other.fe_values_table.size(0);
          ++fe_index)
@@ -159,10 +160,8 @@ namespace hp
               nullptr)
             task_group += Threads::new_task([&, fe_index, m_index, q_index]() {
               fe_values_table[fe_index][m_index][q_index] =
-                std::make_unique<FEValuesType>((*mapping_collection)[m_index],
-                                               (*fe_collection)[fe_index],
-                                               q_collections[q_index],
-                                               update_flags);
+                std::make_unique<FEValuesType>(
+                  *other.fe_values_table[fe_index][m_index][q_index]);
             });
 
     task_group.join_all();
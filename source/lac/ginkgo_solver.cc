@@ -86,40 +86,110 @@ namespace GinkgoWrappers
   void
   SolverBase<ValueType, IndexType>::apply(Vector<ValueType>       &solution,
                                           const Vector<ValueType> &rhs)
+  {
+    Assert(rhs.size() == solution.size(),
+           ExcDimensionMismatch(rhs.size(), solution.size()));
+
+    apply_on_arrays(executor->get_master(),
+                    solution.size(),
+                    solution.begin(),
+                    rhs.begin());
+  }
+
+
+
+  template <typename ValueType, typename IndexType>
+  void
+  SolverBase<ValueType, IndexType>::apply(
+    LinearAlgebra::distributed::Vector<ValueType, MemorySpace::Host> &solution,
+    const LinearAlgebra::distributed::Vector<ValueType, MemorySpace::Host>
+      &rhs)
+  {
+    Assert(rhs.size() == solution.size(),
+           ExcDimensionMismatch(rhs.size(), solution.size()));
+    AssertThrow(rhs.locally_owned_size() == rhs.size(),
+                ExcMessage("The Ginkgo solvers only work on vectors that "
+                           "are not distributed among several processes."));
+
+    apply_on_arrays(executor->get_master(),
+                    solution.locally_owned_size(),
+                    solution.get_values(),
+                    rhs.get_values());
+  }
+
+
+
+  template <typename ValueType, typename IndexType>
+  void
+  SolverBase<ValueType, IndexType>::apply(
+    LinearAlgebra::distributed::Vector<ValueType, MemorySpace::Default>
+      &solution,
+    const LinearAlgebra::distributed::Vector<ValueType, MemorySpace::Default>
+      &rhs)
+  {
+    Assert(rhs.size() == solution.size(),
+           ExcDimensionMismatch(rhs.size(), solution.size()));
+    AssertThrow(rhs.locally_owned_size() == rhs.size(),
+                ExcMessage("The Ginkgo solvers only work on vectors that "
+                           "are not distributed among several processes."));
+
+    // If the default memory space is the host memory, the data is treated as
+    // for the vectors in host memory. Otherwise, the data lives on the device
+    // the executor works on.
+    using DeviceSpace = MemorySpace::Default::kokkos_space;
+    constexpr bool data_on_host =
+      Kokkos::SpaceAccessibility<Kokkos::HostSpace, DeviceSpace>::accessible;
+    AssertThrow(data_on_host || executor != executor->get_master(),
+                ExcMessage("Vectors in device memory require a Ginkgo "
+                           "executor working on the device."));
+
+    apply_on_arrays(data_on_host ?
+                      std::shared_ptr<const gko::Executor>(
+                        executor->get_master()) :
+                      std::shared_ptr<const gko::Executor>(executor),
+                    solution.locally_owned_size(),
+                    solution.get_values(),
+                    rhs.get_values());
+  }
+
+
+
+  template <typename ValueType, typename IndexType>
+  void
+  SolverBase<ValueType, IndexType>::apply_on_arrays(
+    const std::shared_ptr<const gko::Executor> &data_executor,
+    const std::size_t                           size,
+    ValueType                                  *solution,
+    const ValueType                            *rhs)
   {
     // some shortcuts.
     using val_array = gko::Array<ValueType>;
     using vec       = gko::matrix::Dense<ValueType>;
 
     Assert(system_matrix, ExcNotInitialized());
+    Assert(solver, ExcNotInitialized());
     Assert(executor, ExcNotInitialized());
-    Assert(rhs.size() == solution.size(),
-           ExcDimensionMismatch(rhs.size(), solution.size()));
-
-    // Generate the solver from the solver using the system matrix.
-    auto solver = solver_gen->generate(system_matrix);
-
-    // Create the rhs vector in Ginkgo's format.
-    std::vector<ValueType> f(rhs.size());
-    std::copy(rhs.begin(), rhs.begin() + rhs.size(), f.begin());
-    auto b =
-      vec::create(executor,
-                  gko::dim<2>(rhs.size(), 1),
-                  val_array::view(executor->get_master(), rhs.size(), f.data()),
-                  1);
-
-    // Create the solution vector in Ginkgo's format.
-    std::vector<ValueType> u(solution.size());
-    std::copy(solution.begin(), solution.begin() + solution.size(), u.begin());
+    AssertDimension(size, system_matrix->get_size()[0]);
+
+    // Wrap the rhs and the solution in Ginkgo's format. Ginkgo's views do not
+    // distinguish constant data, but the solver does not modify the rhs. If
+    // the data is not in the memory of the executor, creating the vectors
+    // copies it over.
+    auto b = vec::create(
+      executor,
+      gko::dim<2>(size, 1),
+      val_array::view(data_executor, size, const_cast<ValueType *>(rhs)),
+      1);
     auto x = vec::create(executor,
-                         gko::dim<2>(solution.size(), 1),
-                         val_array::view(executor->get_master(),
-                                         solution.size(),
-                                         u.data()),
+                         gko::dim<2>(size, 1),
+                         val_array::view(data_executor, size, solution),
                          1);
 
     // Create the logger object to log some data from the solvers to confirm
-    // convergence.
+    // convergence. Remove the one of the previous solve such that the
+    // loggers do not pile up in the combined factory.
+    if (convergence_logger)
+      combined_factory->remove_logger(gko::lend(convergence_logger));
     initialize_ginkgo_log();
 
     Assert(convergence_logger, ExcNotInitialized());
@@ -150,32 +220,22 @@ namespace GinkgoWrappers
 
     // Ginkgo works with a relative residual norm through its
     // ResidualNormReduction criterion. Therefore, to get the normalized
-    // residual, we divide by the norm of the rhs.
-    auto b_norm = gko::matrix::Dense<ValueType>::create(executor->get_master(),
-                                                        gko::dim<2>{1, 1});
-    if (executor != executor->get_master())
-      {
-        auto b_master = vec::create(executor->get_master(),
-                                    gko::dim<2>(rhs.size(), 1),
-                                    val_array::view(executor->get_master(),
-                                                    rhs.size(),
-                                                    f.data()),
-                                    1);
-        b_master->compute_norm2(b_norm.get());
-      }
-    else
-      {
-        b->compute_norm2(b_norm.get());
-      }
-
-    Assert(b_norm.get()->at(0, 0) != 0.0, ExcDivideByZero());
+    // residual, we divide by the norm of the rhs, which is computed by the
+    // executor and then copied to the host.
+    auto b_norm = vec::create(executor, gko::dim<2>{1, 1});
+    b->compute_norm2(b_norm.get());
+    auto b_norm_parent = vec::create(executor->get_master(), gko::dim<2>{1, 1});
+    b_norm_parent->copy_from(b_norm.get());
+
+    Assert(b_norm_parent->at(0, 0) != 0.0, ExcDivideByZero());
     // Pass the number of iterations and residual norm to the solver_control
-    // object. As both `residual_norm_d_parent` and `b_norm` are seen as Dense
-    // matrices, we use the `at` function to get the first value here. In case
-    // of multiple right hand sides, this will need to be modified.
+    // object. As both `residual_norm_d_parent` and `b_norm_parent` are seen as
+    // Dense matrices, we use the `at` function to get the first value here. In
+    // case of multiple right hand sides, this will need to be modified.
     const SolverControl::State state =
       solver_control.check(num_iteration,
-                           residual_norm_d_parent->at(0, 0) / b_norm->at(0, 0));
+                           residual_norm_d_parent->at(0, 0) /
+                             b_norm_parent->at(0, 0));
 
     // in case of failure: throw exception
     if (state != SolverControl::success)
@@ -183,22 +243,13 @@ namespace GinkgoWrappers
                   SolverControl::NoConvergence(solver_control.last_step(),
                                                solver_control.last_value()));
 
-    // Check if the solution is on a CUDA device, if so, copy it over to the
-    // host.
-    if (executor != executor->get_master())
-      {
-        auto x_master = vec::create(executor->get_master(),
-                                    gko::dim<2>(solution.size(), 1),
-                                    val_array::view(executor,
-                                                    solution.size(),
-                                                    x->get_values()),
-                                    1);
-        x.reset(x_master.release());
-      }
-    // Finally copy over the solution vector to deal.II's solution vector.
-    std::copy(x->get_values(),
-              x->get_values() + solution.size(),
-              solution.begin());
+    // If the solution had to be copied to the executor, copy it back into the
+    // array it was taken from.
+    if (data_executor != executor)
+      data_executor->copy_from(executor.get(),
+                               size,
+                               x->get_const_values(),
+                               solution);
   }
 
 
@@ -282,6 +333,10 @@ namespace GinkgoWrappers
     system_matrix =
       mtx::create(executor, gko::dim<2>(N), matrix.n_nonzero_elements());
     system_matrix->copy_from(system_matrix_compute.get());
+
+    // Generate the solver, including the setup of the preconditioner, once
+    // for the new system matrix.
+    solver = solver_gen->generate(system_matrix);
   }
 
 
@@ -14,6 +14,7 @@
 
 #include <deal.II/base/mpi.h>
 
+#include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/petsc_vector.h>
 
 #ifdef DEAL_II_WITH_PETSC
@@ -360,6 +361,63 @@ namespace PETScWrappers
     }
 
 
+    void
+    Vector::reinit_as_view(
+      LinearAlgebra::distributed::Vector<PetscScalar, MemorySpace::Host> &v)
+    {
+      const Utilities::MPI::Partitioner &partitioner = *v.get_partitioner();
+      const MPI_Comm communicator = partitioner.get_mpi_communicator();
+
+      Assert(partitioner.locally_owned_range().is_ascending_and_one_to_one(
+               communicator),
+             ExcNotImplemented());
+      AssertThrowIntegerConversion(static_cast<PetscInt>(v.size()),
+                                   v.size());
+
+      const PetscInt n_locally_owned =
+        static_cast<PetscInt>(partitioner.locally_owned_size());
+
+      Vec            petsc_vector;
+      PetscErrorCode ierr;
+      if (partitioner.n_ghost_indices() > 0)
+        {
+          // the ghost elements of the deal.II vector are stored behind the
+          // locally owned ones in ascending order of their global index,
+          // which is the layout of the local form of a ghosted PETSc vector
+          // created with the same list of ghost indices
+          std::vector<PetscInt> petsc_ghost_indices;
+          petsc_ghost_indices.reserve(partitioner.n_ghost_indices());
+          for (const auto index : partitioner.ghost_indices())
+            petsc_ghost_indices.push_back(static_cast<PetscInt>(index));
+
+          ierr = VecCreateGhostWithArray(communicator,
+                                         n_locally_owned,
+                                         PETSC_DETERMINE,
+                                         petsc_ghost_indices.size(),
+                                         petsc_ghost_indices.data(),
+                                         v.begin(),
+                                         &petsc_vector);
+        }
+      else
+        ierr = VecCreateMPIWithArray(communicator,
+                                     1,
+                                     n_locally_owned,
+                                     PETSC_DETERMINE,
+                                     v.begin(),
+                                     &petsc_vector);
+      AssertThrow(ierr == 0, ExcPETScError(ierr));
+
+      // VectorBase::reinit() takes its own reference to the Vec, so release
+      // the one obtained on creation
+      VectorBase::reinit(petsc_vector);
+      ierr = VecDestroy(&petsc_vector);
+      AssertThrow(ierr == 0, ExcPETScError(ierr));
+
+      Assert(size() == v.size(), ExcDimensionMismatch(size(), v.size()));
+    }
+
+
+
     void
     Vector::print(std::ostream      &out,
                   const unsigned int precision,
@@ -23,10 +23,14 @@
 
 #  include <deal.II/lac/scalapack.templates.h>
 
+#  include <boost/serialization/utility.hpp>
+
 #  ifdef DEAL_II_WITH_HDF5
 #    include <hdf5.h>
 #  endif
 
+#  include <algorithm>
+#  include <iterator>
 #  include <limits>
 #  include <memory>
 
@@ -661,6 +665,326 @@ ScaLAPACKMatrix<NumberType>::copy_to(LAPACKFullMatrix<NumberType> &B,
 
 
 
+template <typename NumberType>
+void
+ScaLAPACKMatrix<NumberType>::compute_vector_exchange_pattern(
+  const std::pair<types::global_dof_index, types::global_dof_index>
+                                         &local_range,
+  std::vector<std::vector<unsigned int>> &vector_rows_on_process_row,
+  std::vector<std::vector<unsigned int>> &columns_on_process_column,
+  std::vector<std::vector<unsigned int>> &matrix_rows_on_process) const
+{
+  const types::global_dof_index n_process_rows    = grid->n_process_rows;
+  const types::global_dof_index n_process_columns = grid->n_process_columns;
+
+  // the process rows of the locally owned vector entries and the process
+  // columns of all columns in the block-cyclic distribution
+  vector_rows_on_process_row.assign(n_process_rows, {});
+  for (types::global_dof_index row = local_range.first;
+       row < local_range.second;
+       ++row)
+    vector_rows_on_process_row[(row / row_block_size + first_process_row) %
+                               n_process_rows]
+      .push_back(row - local_range.first);
+
+  columns_on_process_column.assign(n_process_columns, {});
+  for (int column = 0; column < n_columns; ++column)
+    columns_on_process_column[(column / column_block_size +
+                               first_process_column) %
+                              n_process_columns]
+      .push_back(column);
+
+  // the owners of the vector entries of the local matrix rows, found by
+  // bisection in the locally owned ranges sorted by their first index
+  const std::vector<std::pair<types::global_dof_index, types::global_dof_index>>
+    local_ranges =
+      Utilities::MPI::all_gather(grid->mpi_communicator, local_range);
+
+  matrix_rows_on_process.assign(local_ranges.size(), {});
+  if (grid->mpi_process_is_active)
+    {
+      std::vector<std::pair<types::global_dof_index, unsigned int>>
+        range_starts;
+      for (unsigned int p = 0; p < local_ranges.size(); ++p)
+        if (local_ranges[p].second > local_ranges[p].first)
+          range_starts.emplace_back(local_ranges[p].first, p);
+      std::sort(range_starts.begin(), range_starts.end());
+
+      for (int i = 0; i < n_local_rows; ++i)
+        {
+          const types::global_dof_index row = global_row(i);
+          const auto                    next_range = std::upper_bound(
+            range_starts.begin(),
+            range_starts.end(),
+            std::make_pair(row, numbers::invalid_unsigned_int));
+          Assert(next_range != range_starts.begin(), ExcInternalError());
+
+          const unsigned int owner = std::prev(next_range)->second;
+          Assert(row < local_ranges[owner].second,
+                 ExcMessage("The locally owned ranges of the vectors do not "
+                            "cover all rows of the matrix."));
+          matrix_rows_on_process[owner].push_back(i);
+        }
+    }
+}
+
+
+
+template <typename NumberType>
+void
+ScaLAPACKMatrix<NumberType>::copy_from(
+  const std::vector<LinearAlgebra::distributed::Vector<NumberType>> &vectors)
+{
+  Assert(static_cast<int>(vectors.size()) == n_columns,
+         ExcDimensionMismatch(vectors.size(), n_columns));
+  if (n_rows * n_columns == 0)
+    return;
+
+  const std::pair<types::global_dof_index, types::global_dof_index>
+    local_range = vectors[0].get_partitioner()->local_range();
+  for (const auto &vector : vectors)
+    {
+      Assert(vector.size() == static_cast<types::global_dof_index>(n_rows),
+             ExcDimensionMismatch(vector.size(), n_rows));
+      Assert(vector.get_partitioner()->local_range() == local_range,
+             ExcMessage("All vectors need to have the same locally owned "
+                        "range."));
+      (void)vector;
+    }
+  Assert(Utilities::MPI::n_mpi_processes(vectors[0].get_mpi_communicator()) ==
+           Utilities::MPI::n_mpi_processes(grid->mpi_communicator),
+         ExcMessage("The vectors need to be distributed over the MPI "
+                    "communicator of the process grid."));
+
+  std::vector<std::vector<unsigned int>> vector_rows_on_process_row;
+  std::vector<std::vector<unsigned int>> columns_on_process_column;
+  std::vector<std::vector<unsigned int>> matrix_rows_on_process;
+  compute_vector_exchange_pattern(local_range,
+                                  vector_rows_on_process_row,
+                                  columns_on_process_column,
+                                  matrix_rows_on_process);
+
+  const int mpi_tag =
+    Utilities::MPI::internal::Tags::scalapack_copy_from_vectors;
+
+  // post the receives of the local matrix entries from the owners of the
+  // vector entries
+  std::vector<unsigned int>            receive_ranks;
+  std::vector<std::vector<NumberType>> receive_buffers;
+  std::vector<MPI_Request>             receive_requests;
+  if (grid->mpi_process_is_active && n_local_columns > 0)
+    for (unsigned int p = 0; p < matrix_rows_on_process.size(); ++p)
+      if (matrix_rows_on_process[p].empty() == false)
+        receive_ranks.push_back(p);
+
+  receive_buffers.resize(receive_ranks.size());
+  receive_requests.resize(receive_ranks.size());
+  for (unsigned int i = 0; i < receive_ranks.size(); ++i)
+    {
+      receive_buffers[i].resize(
+        matrix_rows_on_process[receive_ranks[i]].size() * n_local_columns);
+      const int ierr =
+        MPI_Irecv(receive_buffers[i].data(),
+                  receive_buffers[i].size(),
+                  Utilities::MPI::mpi_type_id_for_type<NumberType>,
+                  receive_ranks[i],
+                  mpi_tag,
+                  grid->mpi_communicator,
+                  &receive_requests[i]);
+      AssertThrowMPI(ierr);
+    }
+
+  // pack and send the locally owned vector entries to the processes of the
+  // grid owning them, one message at a time such that the packing of the
+  // next message overlaps with the sending of the previous ones
+  std::vector<std::vector<NumberType>> send_buffers;
+  std::vector<MPI_Request>             send_requests;
+  send_buffers.reserve(grid->n_process_rows * grid->n_process_columns);
+  send_requests.reserve(grid->n_process_rows * grid->n_process_columns);
+  for (int r = 0; r < grid->n_process_rows; ++r)
+    for (int c = 0; c < grid->n_process_columns; ++c)
+      {
+        const std::vector<unsigned int> &rows = vector_rows_on_process_row[r];
+        const std::vector<unsigned int> &columns =
+          columns_on_process_column[c];
+        if (rows.empty() || columns.empty())
+          continue;
+
+        send_buffers.emplace_back();
+        std::vector<NumberType> &buffer = send_buffers.back();
+        buffer.reserve(rows.size() * columns.size());
+        for (const unsigned int column : columns)
+          for (const unsigned int row : rows)
+            buffer.push_back(vectors[column].local_element(row));
+
+        send_requests.emplace_back();
+        const int ierr =
+          MPI_Isend(buffer.data(),
+                    buffer.size(),
+                    Utilities::MPI::mpi_type_id_for_type<NumberType>,
+                    r * grid->n_process_columns + c,
+                    mpi_tag,
+                    grid->mpi_communicator,
+                    &send_requests.back());
+        AssertThrowMPI(ierr);
+      }
+
+  // unpack the messages in the order they arrive
+  for (unsigned int i = 0; i < receive_requests.size(); ++i)
+    {
+      int       index = 0;
+      const int ierr  = MPI_Waitany(receive_requests.size(),
+                                   receive_requests.data(),
+                                   &index,
+                                   MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      const std::vector<unsigned int> &rows =
+        matrix_rows_on_process[receive_ranks[index]];
+      const NumberType *buffer = receive_buffers[index].data();
+      for (int j = 0; j < n_local_columns; ++j)
+        for (const unsigned int row : rows)
+          local_el(row, j) = *buffer++;
+    }
+
+  const int ierr = MPI_Waitall(send_requests.size(),
+                               send_requests.data(),
+                               MPI_STATUSES_IGNORE);
+  AssertThrowMPI(ierr);
+
+  state = LAPACKSupport::matrix;
+}
+
+
+
+template <typename NumberType>
+void
+ScaLAPACKMatrix<NumberType>::copy_to(
+  std::vector<LinearAlgebra::distributed::Vector<NumberType>> &vectors) const
+{
+  Assert(static_cast<int>(vectors.size()) == n_columns,
+         ExcDimensionMismatch(vectors.size(), n_columns));
+  if (n_rows * n_columns == 0)
+    return;
+
+  const std::pair<types::global_dof_index, types::global_dof_index>
+    local_range = vectors[0].get_partitioner()->local_range();
+  for (const auto &vector : vectors)
+    {
+      Assert(vector.size() == static_cast<types::global_dof_index>(n_rows),
+             ExcDimensionMismatch(vector.size(), n_rows));
+      Assert(vector.get_partitioner()->local_range() == local_range,
+             ExcMessage("All vectors need to have the same locally owned "
+                        "range."));
+      Assert(vector.has_ghost_elements() == false,
+             ExcMessage("The vectors must not have ghost values set."));
+      (void)vector;
+    }
+  Assert(Utilities::MPI::n_mpi_processes(vectors[0].get_mpi_communicator()) ==
+           Utilities::MPI::n_mpi_processes(grid->mpi_communicator),
+         ExcMessage("The vectors need to be distributed over the MPI "
+                    "communicator of the process grid."));
+
+  std::vector<std::vector<unsigned int>> vector_rows_on_process_row;
+  std::vector<std::vector<unsigned int>> columns_on_process_column;
+  std::vector<std::vector<unsigned int>> matrix_rows_on_process;
+  compute_vector_exchange_pattern(local_range,
+                                  vector_rows_on_process_row,
+                                  columns_on_process_column,
+                                  matrix_rows_on_process);
+
+  const int mpi_tag = Utilities::MPI::internal::Tags::scalapack_copy_to_vectors;
+
+  // post the receives of the locally owned vector entries from the
+  // processes of the grid
+  std::vector<std::pair<int, int>>     receive_processes;
+  std::vector<std::vector<NumberType>> receive_buffers;
+  std::vector<MPI_Request>             receive_requests;
+  for (int r = 0; r < grid->n_process_rows; ++r)
+    for (int c = 0; c < grid->n_process_columns; ++c)
+      if (vector_rows_on_process_row[r].empty() == false &&
+          columns_on_process_column[c].empty() == false)
+        receive_processes.emplace_back(r, c);
+
+  receive_buffers.resize(receive_processes.size());
+  receive_requests.resize(receive_processes.size());
+  for (unsigned int i = 0; i < receive_processes.size(); ++i)
+    {
+      const auto [r, c] = receive_processes[i];
+      receive_buffers[i].resize(vector_rows_on_process_row[r].size() *
+                                columns_on_process_column[c].size());
+      const int ierr =
+        MPI_Irecv(receive_buffers[i].data(),
+                  receive_buffers[i].size(),
+                  Utilities::MPI::mpi_type_id_for_type<NumberType>,
+                  r * grid->n_process_columns + c,
+                  mpi_tag,
+                  grid->mpi_communicator,
+                  &receive_requests[i]);
+      AssertThrowMPI(ierr);
+    }
+
+  // pack and send the local matrix entries to the owners of the vector
+  // entries
+  std::vector<std::vector<NumberType>> send_buffers;
+  std::vector<MPI_Request>             send_requests;
+  send_buffers.reserve(matrix_rows_on_process.size());
+  send_requests.reserve(matrix_rows_on_process.size());
+  if (grid->mpi_process_is_active && n_local_columns > 0)
+    for (unsigned int p = 0; p < matrix_rows_on_process.size(); ++p)
+      {
+        const std::vector<unsigned int> &rows = matrix_rows_on_process[p];
+        if (rows.empty())
+          continue;
+
+        send_buffers.emplace_back();
+        std::vector<NumberType> &buffer = send_buffers.back();
+        buffer.reserve(rows.size() * n_local_columns);
+        for (int j = 0; j < n_local_columns; ++j)
+          for (const unsigned int row : rows)
+            buffer.push_back(local_el(row, j));
+
+        send_requests.emplace_back();
+        const int ierr =
+          MPI_Isend(buffer.data(),
+                    buffer.size(),
+                    Utilities::MPI::mpi_type_id_for_type<NumberType>,
+                    p,
+                    mpi_tag,
+                    grid->mpi_communicator,
+                    &send_requests.back());
+        AssertThrowMPI(ierr);
+      }
+
+  // unpack the messages in the order they arrive
+  for (unsigned int i = 0; i < receive_requests.size(); ++i)
+    {
+      int       index = 0;
+      const int ierr  = MPI_Waitany(receive_requests.size(),
+                                   receive_requests.data(),
+                                   &index,
+                                   MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      const auto [r, c] = receive_processes[index];
+      const NumberType *buffer = receive_buffers[index].data();
+      for (const unsigned int column : columns_on_process_column[c])
+        {
+          LinearAlgebra::distributed::Vector<NumberType> &vector =
+            vectors[column];
+          for (const unsigned int row : vector_rows_on_process_row[r])
+            vector.local_element(row) = *buffer++;
+        }
+    }
+
+  const int ierr = MPI_Waitall(send_requests.size(),
+                               send_requests.data(),
+                               MPI_STATUSES_IGNORE);
+  AssertThrowMPI(ierr);
+}
+
+
+
 template <typename NumberType>
 void
 ScaLAPACKMatrix<NumberType>::copy_to(FullMatrix<NumberType> &matrix) const
@@ -2138,6 +2462,177 @@ ScaLAPACKMatrix<NumberType>::compute_SVD(ScaLAPACKMatrix<NumberType> *U,
 
 
 
+template <typename NumberType>
+std::vector<NumberType>
+ScaLAPACKMatrix<NumberType>::compute_SVD_tall_skinny(
+  ScaLAPACKMatrix<NumberType> *U,
+  ScaLAPACKMatrix<NumberType> *VT)
+{
+  Assert(state == LAPACKSupport::matrix,
+         ExcMessage(
+           "Matrix has to be in Matrix state before calling this function."));
+  Assert(row_block_size == column_block_size,
+         ExcDimensionMismatch(row_block_size, column_block_size));
+  Assert(n_rows >= n_columns,
+         ExcMessage("The matrix needs to have at least as many rows as "
+                    "columns."));
+
+  const bool left_singular_vectors = (U != nullptr) ? true : false;
+
+  if (left_singular_vectors)
+    {
+      Assert(n_rows == U->n_rows, ExcDimensionMismatch(n_rows, U->n_rows));
+      Assert(n_columns == U->n_columns,
+             ExcDimensionMismatch(n_columns, U->n_columns));
+      Assert(row_block_size == U->row_block_size,
+             ExcDimensionMismatch(row_block_size, U->row_block_size));
+      Assert(column_block_size == U->column_block_size,
+             ExcDimensionMismatch(column_block_size, U->column_block_size));
+      Assert(grid->blacs_context == U->grid->blacs_context,
+             ExcDimensionMismatch(grid->blacs_context, U->grid->blacs_context));
+    }
+
+  // the triangular factor R of the QR factorization, which has the same
+  // block-cyclic distribution as the first rows of this matrix, such that
+  // it can be copied locally. The same holds for the left singular vectors
+  // of R and the first rows of U
+  ScaLAPACKMatrix<NumberType> R(
+    n_columns, n_columns, grid, row_block_size, column_block_size);
+  std::unique_ptr<ScaLAPACKMatrix<NumberType>> U_R;
+  if (left_singular_vectors)
+    U_R = std::make_unique<ScaLAPACKMatrix<NumberType>>(
+      n_columns, n_columns, grid, row_block_size, column_block_size);
+
+  std::vector<NumberType> tau;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (grid->mpi_process_is_active)
+      {
+        NumberType *A_loc = this->values.data();
+        tau.resize(std::max(1, n_local_columns));
+        int info = 0;
+        /*
+         * by setting lwork to -1 a workspace query for optimal length of work
+         * is performed
+         */
+        int lwork = -1;
+        work.resize(1);
+
+        pgeqrf(&n_rows,
+               &n_columns,
+               A_loc,
+               &submatrix_row,
+               &submatrix_column,
+               descriptor,
+               tau.data(),
+               work.data(),
+               &lwork,
+               &info);
+        AssertThrow(info == 0, LAPACKSupport::ExcErrorCode("pgeqrf", info));
+
+        lwork = static_cast<int>(work[0]);
+        work.resize(lwork);
+
+        pgeqrf(&n_rows,
+               &n_columns,
+               A_loc,
+               &submatrix_row,
+               &submatrix_column,
+               descriptor,
+               tau.data(),
+               work.data(),
+               &lwork,
+               &info);
+        AssertThrow(info == 0, LAPACKSupport::ExcErrorCode("pgeqrf", info));
+
+        for (int j = 0; j < R.n_local_columns; ++j)
+          {
+            const unsigned int glob_j = R.global_column(j);
+            for (int i = 0; i < R.n_local_rows; ++i)
+              R.local_el(i, j) =
+                (R.global_row(i) <= glob_j) ? local_el(i, j) : NumberType();
+          }
+      }
+  }
+
+  const std::vector<NumberType> sv = R.compute_SVD(U_R.get(), VT);
+
+  if (left_singular_vectors)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+
+      if (grid->mpi_process_is_active)
+        {
+          // U = Q * [U_R; 0]
+          for (int j = 0; j < U->n_local_columns; ++j)
+            for (int i = 0; i < U->n_local_rows; ++i)
+              U->local_el(i, j) =
+                (i < U_R->n_local_rows) ? U_R->local_el(i, j) : NumberType();
+
+          char        side  = 'L';
+          char        trans = 'N';
+          NumberType *A_loc = this->values.data();
+          NumberType *U_loc = U->values.data();
+          int         info  = 0;
+          int         lwork = -1;
+          work.resize(1);
+
+          pormqr(&side,
+                 &trans,
+                 &n_rows,
+                 &n_columns,
+                 &n_columns,
+                 A_loc,
+                 &submatrix_row,
+                 &submatrix_column,
+                 descriptor,
+                 tau.data(),
+                 U_loc,
+                 &U->submatrix_row,
+                 &U->submatrix_column,
+                 U->descriptor,
+                 work.data(),
+                 &lwork,
+                 &info);
+          AssertThrow(info == 0, LAPACKSupport::ExcErrorCode("pormqr", info));
+
+          lwork = static_cast<int>(work[0]);
+          work.resize(lwork);
+
+          pormqr(&side,
+                 &trans,
+                 &n_rows,
+                 &n_columns,
+                 &n_columns,
+                 A_loc,
+                 &submatrix_row,
+                 &submatrix_column,
+                 descriptor,
+                 tau.data(),
+                 U_loc,
+                 &U->submatrix_row,
+                 &U->submatrix_column,
+                 U->descriptor,
+                 work.data(),
+                 &lwork,
+                 &info);
+          AssertThrow(info == 0, LAPACKSupport::ExcErrorCode("pormqr", info));
+        }
+
+      U->state    = LAPACKSupport::State::matrix;
+      U->property = LAPACKSupport::Property::general;
+    }
+
+  property = LAPACKSupport::Property::general;
+  state    = LAPACKSupport::State::unusable;
+
+  return sv;
+}
+
+
+
 template <typename NumberType>
 void
 ScaLAPACKMatrix<NumberType>::least_squares(ScaLAPACKMatrix<NumberType> &B,
@@ -18,6 +18,7 @@
 
 #include <deal.II/lac/solver_control.h>
 
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 
@@ -41,6 +42,8 @@ SolverControl::SolverControl(const unsigned int maxiter,
   , failure_residual(0)
   , m_log_history(m_log_history)
   , m_log_frequency(1)
+  , m_check_frequency(1)
+  , m_predict_check_step(false)
   , m_log_result(m_log_result)
   , history_data_enabled(false)
 {}
@@ -143,6 +146,65 @@ SolverControl::log_frequency(unsigned int f)
 }
 
 
+unsigned int
+SolverControl::check_frequency(unsigned int f)
+{
+  if (f == 0)
+    f = 1;
+  unsigned int old  = m_check_frequency;
+  m_check_frequency = f;
+  return old;
+}
+
+
+void
+SolverControl::predict_check_step(const bool predict)
+{
+  m_predict_check_step = predict;
+}
+
+
+bool
+SolverControl::check_needed(const unsigned int step) const
+{
+  return check_needed(step, tol);
+}
+
+
+bool
+SolverControl::check_needed(const unsigned int step,
+                            const double       target_value) const
+{
+  // always check the first and the last step, when the history is recorded,
+  // and when the last check belongs to a different solve
+  if (step == 0 || step >= maxsteps || history_data_enabled ||
+      lstep == numbers::invalid_unsigned_int || step <= lstep)
+    return true;
+
+  const unsigned int steps_since_check = step - lstep;
+  if (steps_since_check >= m_check_frequency)
+    return true;
+
+  if (m_predict_check_step == false)
+    return false;
+
+  // predict the step in which the target is reached from the average
+  // convergence rate since the initial value, which needs at least one
+  // check after the initial one; without a reduction so far, we can only
+  // rely on the frequency
+  if (lstep == 0)
+    return true;
+  else if (target_value > 0. && lvalue > target_value && lvalue < initial_val)
+    {
+      const double log_rate        = std::log(lvalue / initial_val) / lstep;
+      const double predicted_steps = std::log(target_value / lvalue) / log_rate;
+      return steps_since_check >= predicted_steps;
+    }
+
+  return false;
+}
+
+
 void
 SolverControl::enable_history_data()
 {
@@ -210,6 +272,8 @@ SolverControl::declare_parameters(ParameterHandler &param)
   param.declare_entry("Log history", "false", Patterns::Bool());
   param.declare_entry("Log frequency", "1", Patterns::Integer());
   param.declare_entry("Log result", "true", Patterns::Bool());
+  param.declare_entry("Check frequency", "1", Patterns::Integer());
+  param.declare_entry("Predict check step", "false", Patterns::Bool());
 }
 
 
@@ -221,6 +285,8 @@ SolverControl::parse_parameters(ParameterHandler &param)
   log_history(param.get_bool("Log history"));
   log_result(param.get_bool("Log result"));
   log_frequency(param.get_integer("Log frequency"));
+  check_frequency(param.get_integer("Check frequency"));
+  predict_check_step(param.get_bool("Predict check step"));
 }
 
 /*----------------------- ReductionControl ---------------------------------*/
@@ -295,6 +361,16 @@ ReductionControl::check(const unsigned int step, const double check_value)
 
 
 
+bool
+ReductionControl::check_needed(const unsigned int step) const
+{
+  // the reduced tolerance is only set in the first check, but check_needed()
+  // returns true without looking at the target in that case
+  return SolverControl::check_needed(step, std::max(tol, reduced_tol));
+}
+
+
+
 void
 ReductionControl::declare_parameters(ParameterHandler &param)
 {
@@ -418,4 +494,12 @@ ConsecutiveControl::check(const unsigned int step, const double check_value)
     }
 }
 
+
+
+bool
+ConsecutiveControl::check_needed(const unsigned int) const
+{
+  return true;
+}
+
 DEAL_II_NAMESPACE_CLOSE
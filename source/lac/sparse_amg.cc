@@ -0,0 +1,578 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/thread_management.h>
+
+#include <deal.II/lac/sparse_amg.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace internal
+{
+  namespace SparseAMGImplementation
+  {
+    /**
+     * Compute the strong couplings of the rows of @p matrix, i.e., the
+     * off-diagonal entries with $|a_{ij}| > \theta \sqrt{|a_{ii} a_{jj}|}$,
+     * in compressed row storage. Besides the column, the value
+     * $|a_{ij}|$ of each coupling is stored.
+     */
+    template <typename number>
+    void
+    compute_strong_couplings(const SparseMatrix<number> &matrix,
+                             const double                threshold,
+                             std::vector<std::size_t>   &row_starts,
+                             std::vector<unsigned int>  &columns,
+                             std::vector<double>        &strengths)
+    {
+      const unsigned int n_rows = matrix.m();
+
+      const auto is_strong = [&](const unsigned int row,
+                                 const auto        &entry) {
+        return entry.column() != row &&
+               std::abs(entry.value()) >
+                 threshold *
+                   std::sqrt(std::abs(static_cast<double>(
+                     matrix.diag_element(row) *
+                     matrix.diag_element(entry.column()))));
+      };
+
+      // count the strong couplings of each row
+      row_starts.assign(n_rows + 1, 0);
+      parallel::apply_to_subranges(
+        0U,
+        n_rows,
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int row = begin; row < end; ++row)
+            for (auto entry = matrix.begin(row); entry != matrix.end(row);
+                 ++entry)
+              if (is_strong(row, *entry))
+                ++row_starts[row + 1];
+        },
+        1024);
+
+      std::partial_sum(row_starts.begin(),
+                       row_starts.end(),
+                       row_starts.begin());
+
+      // fill in the strong couplings
+      columns.resize(row_starts.back());
+      strengths.resize(row_starts.back());
+      parallel::apply_to_subranges(
+        0U,
+        n_rows,
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int row = begin; row < end; ++row)
+            {
+              std::size_t k = row_starts[row];
+              for (auto entry = matrix.begin(row); entry != matrix.end(row);
+                   ++entry)
+                if (is_strong(row, *entry))
+                  {
+                    columns[k]   = entry->column();
+                    strengths[k] = std::abs(entry->value());
+                    ++k;
+                  }
+            }
+        },
+        1024);
+    }
+
+
+
+    /**
+     * Aggregate the rows in the range [begin, end) with the classical
+     * three-phase greedy algorithm, only considering couplings within this
+     * range. The aggregates are numbered starting from zero and their number
+     * is returned. Rows without strong couplings are not aggregated.
+     */
+    inline unsigned int
+    aggregate_range(const unsigned int               begin,
+                    const unsigned int               end,
+                    const std::vector<std::size_t>  &row_starts,
+                    const std::vector<unsigned int> &columns,
+                    const std::vector<double>       &strengths,
+                    std::vector<unsigned int>       &aggregates)
+    {
+      const auto in_range = [&](const unsigned int j) {
+        return j >= begin && j < end;
+      };
+
+      unsigned int n_aggregates = 0;
+
+      // phase 1: form an aggregate of every row whose strongly coupled rows
+      // are all not yet aggregated
+      for (unsigned int i = begin; i < end; ++i)
+        {
+          if (aggregates[i] != numbers::invalid_unsigned_int ||
+              row_starts[i] == row_starts[i + 1])
+            continue;
+
+          bool all_free = true;
+          for (std::size_t k = row_starts[i]; k < row_starts[i + 1]; ++k)
+            if (in_range(columns[k]) &&
+                aggregates[columns[k]] != numbers::invalid_unsigned_int)
+              {
+                all_free = false;
+                break;
+              }
+
+          if (all_free == false)
+            continue;
+
+          aggregates[i] = n_aggregates;
+          for (std::size_t k = row_starts[i]; k < row_starts[i + 1]; ++k)
+            if (in_range(columns[k]))
+              aggregates[columns[k]] = n_aggregates;
+          ++n_aggregates;
+        }
+
+      // phase 2: attach the remaining rows to the aggregate of phase 1 they
+      // are most strongly coupled to
+      const std::vector<unsigned int> phase_one_aggregates(
+        aggregates.begin() + begin, aggregates.begin() + end);
+
+      for (unsigned int i = begin; i < end; ++i)
+        if (aggregates[i] == numbers::invalid_unsigned_int)
+          {
+            double max_strength = 0.;
+            for (std::size_t k = row_starts[i]; k < row_starts[i + 1]; ++k)
+              if (in_range(columns[k]) &&
+                  phase_one_aggregates[columns[k] - begin] !=
+                    numbers::invalid_unsigned_int &&
+                  (aggregates[i] == numbers::invalid_unsigned_int ||
+                   strengths[k] > max_strength))
+                {
+                  aggregates[i] = phase_one_aggregates[columns[k] - begin];
+                  max_strength  = strengths[k];
+                }
+          }
+
+      // phase 3: form new aggregates out of the rows that are still left,
+      // together with their strongly coupled rows that are not aggregated
+      for (unsigned int i = begin; i < end; ++i)
+        if (aggregates[i] == numbers::invalid_unsigned_int &&
+            row_starts[i] != row_starts[i + 1])
+          {
+            aggregates[i] = n_aggregates;
+            for (std::size_t k = row_starts[i]; k < row_starts[i + 1]; ++k)
+              if (in_range(columns[k]) &&
+                  aggregates[columns[k]] == numbers::invalid_unsigned_int)
+                aggregates[columns[k]] = n_aggregates;
+            ++n_aggregates;
+          }
+
+      return n_aggregates;
+    }
+
+
+
+    /**
+     * Compute the aggregates of the rows of @p matrix and return their
+     * number. Rows that are not part of any aggregate are marked by
+     * numbers::invalid_unsigned_int.
+     */
+    template <typename number>
+    unsigned int
+    compute_aggregates(const SparseMatrix<number> &matrix,
+                       const double                strong_threshold,
+                       const unsigned int          chunk_size,
+                       std::vector<unsigned int>  &aggregates)
+    {
+      const unsigned int n_rows = matrix.m();
+
+      std::vector<std::size_t>  row_starts;
+      std::vector<unsigned int> columns;
+      std::vector<double>       strengths;
+      compute_strong_couplings(
+        matrix, strong_threshold, row_starts, columns, strengths);
+
+      aggregates.assign(n_rows, numbers::invalid_unsigned_int);
+
+      // aggregate the chunks independently of each other and shift the
+      // aggregate numbers of each chunk afterwards. since the chunks do not
+      // depend on the number of threads, the result is deterministic.
+      const unsigned int n_chunks = (n_rows + chunk_size - 1) / chunk_size;
+      std::vector<unsigned int> offsets(n_chunks + 1, 0);
+
+      Threads::TaskGroup<> tasks;
+      for (unsigned int c = 0; c < n_chunks; ++c)
+        tasks += Threads::new_task([&, c]() {
+          offsets[c + 1] =
+            aggregate_range(c * chunk_size,
+                            std::min(n_rows, (c + 1) * chunk_size),
+                            row_starts,
+                            columns,
+                            strengths,
+                            aggregates);
+        });
+      tasks.join_all();
+
+      std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+      for (unsigned int c = 1; c < n_chunks; ++c)
+        for (unsigned int i = c * chunk_size;
+             i < std::min(n_rows, (c + 1) * chunk_size);
+             ++i)
+          if (aggregates[i] != numbers::invalid_unsigned_int)
+            aggregates[i] += offsets[c];
+
+      return offsets.back();
+    }
+  } // namespace SparseAMGImplementation
+} // namespace internal
+
+
+
+template <typename number>
+SparseAMG<number>::AdditionalData::AdditionalData(
+  const double       strong_threshold,
+  const unsigned int max_coarse_size,
+  const unsigned int max_n_levels,
+  const unsigned int smoother_degree,
+  const double       smoothing_range,
+  const unsigned int n_cycles,
+  const unsigned int aggregation_chunk_size)
+  : strong_threshold(strong_threshold)
+  , max_coarse_size(max_coarse_size)
+  , max_n_levels(max_n_levels)
+  , smoother_degree(smoother_degree)
+  , smoothing_range(smoothing_range)
+  , n_cycles(n_cycles)
+  , aggregation_chunk_size(aggregation_chunk_size)
+{}
+
+
+
+template <typename number>
+SparseAMG<number>::SparseAMG()
+  : n_cycles(1)
+{}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::initialize(const SparseMatrix<number> &matrix,
+                              const AdditionalData       &additional_data)
+{
+  Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
+  Assert(additional_data.max_n_levels > 0,
+         ExcMessage("At least one level is needed."));
+  Assert(additional_data.aggregation_chunk_size > 0,
+         ExcMessage("The aggregation chunk size needs to be positive."));
+
+  clear();
+
+  this->matrix = &matrix;
+  n_cycles     = additional_data.n_cycles;
+
+  levels.push_back(std::make_unique<Level>());
+
+  for (unsigned int level = 0;; ++level)
+    {
+      Level                      &current = *levels[level];
+      const SparseMatrix<number> &A       = level_matrix(level);
+      const unsigned int          n_rows  = A.m();
+
+      current.solution.reinit(n_rows);
+      current.rhs.reinit(n_rows);
+      current.residual.reinit(n_rows);
+
+      // invert the coarsest matrix exactly if it is small enough
+      if (n_rows <= additional_data.max_coarse_size)
+        {
+          if (n_rows > 0)
+            {
+              coarse_inverse.copy_from(A);
+              coarse_inverse.gauss_jordan();
+            }
+          break;
+        }
+
+      // set up the Chebyshev smoother around the point Jacobi method
+      using SmootherType = decltype(current.smoother);
+      typename SmootherType::AdditionalData smoother_data;
+      smoother_data.degree          = additional_data.smoother_degree;
+      smoother_data.smoothing_range = additional_data.smoothing_range;
+      smoother_data.preconditioner =
+        std::make_shared<DiagonalMatrix<Vector<number>>>();
+      Vector<number> &inverse_diagonal =
+        smoother_data.preconditioner->get_vector();
+      inverse_diagonal.reinit(n_rows);
+      for (unsigned int i = 0; i < n_rows; ++i)
+        inverse_diagonal(i) =
+          (A.diag_element(i) != number()) ? number(1.) / A.diag_element(i) :
+                                            number(1.);
+
+      current.smoother.initialize(A, smoother_data);
+      const auto eigenvalues =
+        current.smoother.estimate_eigenvalues(current.solution);
+
+      if (level + 1 == additional_data.max_n_levels)
+        break;
+
+      // aggregate the rows and stop if the coarsening stagnates
+      std::vector<unsigned int> aggregates;
+      const unsigned int        n_aggregates =
+        internal::SparseAMGImplementation::compute_aggregates(
+          A,
+          additional_data.strong_threshold,
+          additional_data.aggregation_chunk_size,
+          aggregates);
+
+      if (n_aggregates == 0 || n_aggregates > 0.9 * n_rows)
+        break;
+
+      // the tentative prolongator interpolates the constant on each aggregate
+      SparsityPattern      tentative_sparsity;
+      SparseMatrix<number> tentative;
+      {
+        std::vector<unsigned int> row_lengths(n_rows);
+        for (unsigned int i = 0; i < n_rows; ++i)
+          row_lengths[i] = (aggregates[i] != numbers::invalid_unsigned_int);
+        tentative_sparsity.reinit(n_rows, n_aggregates, row_lengths);
+        for (unsigned int i = 0; i < n_rows; ++i)
+          if (aggregates[i] != numbers::invalid_unsigned_int)
+            tentative_sparsity.add(i, aggregates[i]);
+        tentative_sparsity.compress();
+      }
+      tentative.reinit(tentative_sparsity);
+      for (unsigned int i = 0; i < n_rows; ++i)
+        if (aggregates[i] != numbers::invalid_unsigned_int)
+          tentative.set(i, aggregates[i], number(1.));
+
+      // smooth the tentative prolongator by a damped Jacobi step, i.e.,
+      // P = P_tent - omega D^{-1} A P_tent. The sparsity pattern of the
+      // product A P_tent contains the one of P_tent since the diagonal of A
+      // is always stored.
+      current.prolongation.reinit(current.prolongation_sparsity);
+      A.mmult(current.prolongation, tentative);
+
+      const double omega = 4. / (3. * eigenvalues.max_eigenvalue_estimate);
+      parallel::apply_to_subranges(
+        0U,
+        n_rows,
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int i = begin; i < end; ++i)
+            for (auto entry = current.prolongation.begin(i);
+                 entry != current.prolongation.end(i);
+                 ++entry)
+              entry->value() =
+                ((entry->column() == aggregates[i]) ? number(1.) : number()) -
+                number(omega) * inverse_diagonal(i) * entry->value();
+        },
+        1024);
+
+      // compute the Galerkin coarse matrix P^T A P
+      auto coarse = std::make_unique<Level>();
+      {
+        SparsityPattern      product_sparsity;
+        SparseMatrix<number> product;
+        product.reinit(product_sparsity);
+        A.mmult(product, current.prolongation);
+
+        coarse->matrix.reinit(coarse->sparsity);
+        current.prolongation.Tmmult(coarse->matrix, product);
+      }
+      levels.push_back(std::move(coarse));
+    }
+
+  if (n_cycles > 1)
+    {
+      defect.reinit(matrix.m());
+      correction.reinit(matrix.m());
+    }
+}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::clear()
+{
+  levels.clear();
+  coarse_inverse = FullMatrix<number>();
+  defect.reinit(0);
+  correction.reinit(0);
+  matrix = nullptr;
+}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::vmult(Vector<number> &dst, const Vector<number> &src) const
+{
+  Assert(matrix != nullptr, ExcNotInitialized());
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+
+  if (m() == 0)
+    return;
+
+  v_cycle(0, dst, src);
+
+  for (unsigned int c = 1; c < n_cycles; ++c)
+    {
+      matrix->vmult(defect, dst);
+      defect.sadd(-1., 1., src);
+      v_cycle(0, correction, defect);
+      dst += correction;
+    }
+}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::Tvmult(Vector<number>       &dst,
+                          const Vector<number> &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::v_cycle(const unsigned int    level,
+                           Vector<number>       &dst,
+                           const Vector<number> &src) const
+{
+  const Level &current = *levels[level];
+
+  if (level + 1 == levels.size())
+    {
+      if (coarse_inverse.m() > 0)
+        coarse_inverse.vmult(dst, src);
+      else
+        current.smoother.vmult(dst, src);
+      return;
+    }
+
+  const Level &coarse = *levels[level + 1];
+
+  current.smoother.vmult(dst, src);
+
+  level_matrix(level).vmult(current.residual, dst);
+  current.residual.sadd(-1., 1., src);
+
+  current.prolongation.Tvmult(coarse.rhs, current.residual);
+  v_cycle(level + 1, coarse.solution, coarse.rhs);
+  current.prolongation.vmult_add(dst, coarse.solution);
+
+  current.smoother.step(dst, src);
+}
+
+
+
+template <typename number>
+const SparseMatrix<number> &
+SparseAMG<number>::level_matrix(const unsigned int level) const
+{
+  return (level == 0) ? *matrix : levels[level]->matrix;
+}
+
+
+
+template <typename number>
+typename SparseAMG<number>::size_type
+SparseAMG<number>::m() const
+{
+  Assert(matrix != nullptr, ExcNotInitialized());
+  return matrix->m();
+}
+
+
+
+template <typename number>
+typename SparseAMG<number>::size_type
+SparseAMG<number>::n() const
+{
+  Assert(matrix != nullptr, ExcNotInitialized());
+  return matrix->n();
+}
+
+
+
+template <typename number>
+unsigned int
+SparseAMG<number>::n_levels() const
+{
+  return levels.size();
+}
+
+
+
+template <typename number>
+const SparseMatrix<number> &
+SparseAMG<number>::get_level_matrix(const unsigned int level) const
+{
+  AssertIndexRange(level, n_levels());
+  return level_matrix(level);
+}
+
+
+
+template <typename number>
+double
+SparseAMG<number>::operator_complexity() const
+{
+  Assert(matrix != nullptr, ExcNotInitialized());
+
+  std::size_t n_nonzero_elements = 0;
+  for (unsigned int level = 0; level < n_levels(); ++level)
+    n_nonzero_elements += level_matrix(level).n_nonzero_elements();
+
+  return static_cast<double>(n_nonzero_elements) /
+         std::max<std::size_t>(matrix->n_nonzero_elements(), 1);
+}
+
+
+
+template <typename number>
+std::size_t
+SparseAMG<number>::memory_consumption() const
+{
+  std::size_t memory = sizeof(*this) + coarse_inverse.memory_consumption() +
+                       defect.memory_consumption() +
+                       correction.memory_consumption();
+
+  for (const auto &level : levels)
+    memory += sizeof(Level) + level->sparsity.memory_consumption() +
+              level->matrix.memory_consumption() +
+              level->prolongation_sparsity.memory_consumption() +
+              level->prolongation.memory_consumption() +
+              level->solution.memory_consumption() +
+              level->rhs.memory_consumption() +
+              level->residual.memory_consumption();
+
+  return memory;
+}
+
+
+
+// explicit instantiations
+template class SparseAMG<double>;
+template class SparseAMG<float>;
+
+DEAL_II_NAMESPACE_CLOSE
@@ -249,17 +249,10 @@ SparseDirectUMFPACK::sort_arrays(const BlockSparseMatrix<number> &matrix)
 
 template <class Matrix>
 void
-SparseDirectUMFPACK::factorize(const Matrix &matrix)
+SparseDirectUMFPACK::copy_matrix_entries(const Matrix &matrix)
 {
-  Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
-
-  clear();
-
   using number = typename Matrix::value_type;
 
-  n_rows = matrix.m();
-  n_cols = matrix.n();
-
   const size_type N = matrix.m();
 
   // copy over the data from the matrix to the data structures UMFPACK
@@ -324,6 +317,56 @@ SparseDirectUMFPACK::factorize(const Matrix &matrix)
   // careful for block sparse matrices, so ship this task out to a
   // different function
   sort_arrays(matrix);
+}
+
+
+
+void
+SparseDirectUMFPACK::compute_numeric_factorization()
+{
+  Assert(symbolic_decomposition != nullptr, ExcNotInitialized());
+  Assert(numeric_decomposition == nullptr, ExcInternalError());
+
+  int status;
+  if (Az.empty())
+    status = umfpack_dl_numeric(Ap.data(),
+                                Ai.data(),
+                                Ax.data(),
+                                symbolic_decomposition,
+                                &numeric_decomposition,
+                                control.data(),
+                                nullptr);
+  else
+    status = umfpack_zl_numeric(Ap.data(),
+                                Ai.data(),
+                                Ax.data(),
+                                Az.data(),
+                                symbolic_decomposition,
+                                &numeric_decomposition,
+                                control.data(),
+                                nullptr);
+  AssertThrow(status == UMFPACK_OK,
+              ExcUMFPACKError("umfpack_dl_numeric", status));
+}
+
+
+
+template <class Matrix>
+void
+SparseDirectUMFPACK::factorize(const Matrix &matrix)
+{
+  Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
+
+  clear();
+
+  using number = typename Matrix::value_type;
+
+  n_rows = matrix.m();
+  n_cols = matrix.n();
+
+  const size_type N = matrix.m();
+
+  copy_matrix_entries(matrix);
 
   int status;
   if (numbers::NumberTraits<number>::is_complex == false)
@@ -348,27 +391,56 @@ SparseDirectUMFPACK::factorize(const Matrix &matrix)
   AssertThrow(status == UMFPACK_OK,
               ExcUMFPACKError("umfpack_dl_symbolic", status));
 
-  if (numbers::NumberTraits<number>::is_complex == false)
-    status = umfpack_dl_numeric(Ap.data(),
-                                Ai.data(),
-                                Ax.data(),
-                                symbolic_decomposition,
-                                &numeric_decomposition,
-                                control.data(),
-                                nullptr);
-  else
-    status = umfpack_zl_numeric(Ap.data(),
-                                Ai.data(),
-                                Ax.data(),
-                                Az.data(),
-                                symbolic_decomposition,
-                                &numeric_decomposition,
-                                control.data(),
-                                nullptr);
-  AssertThrow(status == UMFPACK_OK,
-              ExcUMFPACKError("umfpack_dl_numeric", status));
+  // the symbolic decomposition is kept around so that refactorize() can
+  // reuse it; it is released in clear()
+  compute_numeric_factorization();
+}
+
+
+
+template <class Matrix>
+void
+SparseDirectUMFPACK::refactorize(const Matrix &matrix)
+{
+  if (symbolic_decomposition == nullptr)
+    {
+      factorize(matrix);
+      return;
+    }
+
+  using number = typename Matrix::value_type;
+
+  AssertDimension(matrix.m(), n_rows);
+  AssertDimension(matrix.n(), n_cols);
+  AssertThrow(static_cast<std::size_t>(matrix.n_nonzero_elements()) ==
+                  Ai.size() &&
+                (numbers::NumberTraits<number>::is_complex == !Az.empty()),
+              ExcMessage("The matrix passed to refactorize() needs to have "
+                         "the same sparsity pattern and number type as the "
+                         "matrix passed to the last call of factorize(). "
+                         "Call factorize() instead."));
+
+#  ifdef DEBUG
+  const std::vector<types::suitesparse_index> old_Ap = Ap;
+  const std::vector<types::suitesparse_index> old_Ai = Ai;
+#  endif
 
-  umfpack_dl_free_symbolic(&symbolic_decomposition);
+  copy_matrix_entries(matrix);
+
+#  ifdef DEBUG
+  Assert(Ap == old_Ap && Ai == old_Ai,
+         ExcMessage("The sparsity pattern of the matrix passed to "
+                    "refactorize() differs from the one of the matrix "
+                    "passed to the last call of factorize()."));
+#  endif
+
+  if (numeric_decomposition != nullptr)
+    {
+      umfpack_dl_free_numeric(&numeric_decomposition);
+      numeric_decomposition = nullptr;
+    }
+
+  compute_numeric_factorization();
 }
 
 
@@ -568,6 +640,62 @@ SparseDirectUMFPACK::solve(BlockVector<std::complex<double>> &rhs_and_solution,
 
 
 
+void
+SparseDirectUMFPACK::solve(FullMatrix<double> &rhs_and_solution,
+                           const bool          transpose /*=false*/) const
+{
+  // make sure that some kind of factorize() call has happened before
+  Assert(Ap.size() != 0, ExcNotInitialized());
+  Assert(Ai.size() != 0, ExcNotInitialized());
+  Assert(Ai.size() == Ax.size(), ExcNotInitialized());
+  Assert(Az.empty(),
+         ExcMessage("You have previously factored a matrix using this class "
+                    "that had complex-valued entries. This then requires "
+                    "applying the factored matrix to complex-valued "
+                    "vectors, but you are only providing real-valued ones "
+                    "here."));
+  AssertDimension(rhs_and_solution.m(), n_rows);
+
+  const size_type N = rhs_and_solution.m();
+
+  // UMFPACK wants contiguous arrays, so copy each column into a vector. the
+  // workspace of the solve, which is otherwise allocated in every call to
+  // umfpack_dl_solve(), is allocated only once for all columns. its size
+  // accounts for iterative refinement.
+  Vector<double>                        rhs(N);
+  Vector<double>                        solution(N);
+  std::vector<types::suitesparse_index> Wi(N);
+  std::vector<double>                   W(5 * N);
+
+  for (size_type column = 0; column < rhs_and_solution.n(); ++column)
+    {
+      for (size_type row = 0; row < N; ++row)
+        rhs(row) = rhs_and_solution(row, column);
+
+      // see the solve() function for a single vector for the choice of the
+      // UMFPACK system
+      const int status = umfpack_dl_wsolve(transpose ? UMFPACK_A : UMFPACK_At,
+                                           Ap.data(),
+                                           Ai.data(),
+                                           Ax.data(),
+                                           solution.begin(),
+                                           rhs.begin(),
+                                           numeric_decomposition,
+                                           control.data(),
+                                           nullptr,
+                                           Wi.data(),
+                                           W.data());
+      AssertThrow(status == UMFPACK_OK,
+                  ExcUMFPACKError("umfpack_dl_wsolve", status));
+
+      for (size_type row = 0; row < N; ++row)
+        rhs_and_solution(row, column) = solution(row);
+    }
+}
+
+
+
+
 template <class Matrix>
 void
 SparseDirectUMFPACK::solve(const Matrix   &matrix,
@@ -669,6 +797,20 @@ SparseDirectUMFPACK::factorize(const Matrix &)
 }
 
 
+
+template <class Matrix>
+void
+SparseDirectUMFPACK::refactorize(const Matrix &)
+{
+  AssertThrow(
+    false,
+    ExcMessage(
+      "To call this function you need UMFPACK, but you configured deal.II "
+      "without passing the necessary switch to 'cmake'. Please consult the "
+      "installation instructions at https://dealii.org/current/readme.html"));
+}
+
+
 void
 SparseDirectUMFPACK::solve(Vector<double> &, const bool) const
 {
@@ -722,6 +864,19 @@ SparseDirectUMFPACK::solve(BlockVector<std::complex<double>> &,
 
 
 
+void
+SparseDirectUMFPACK::solve(FullMatrix<double> &, const bool) const
+{
+  AssertThrow(
+    false,
+    ExcMessage(
+      "To call this function you need UMFPACK, but you configured deal.II "
+      "without passing the necessary switch to 'cmake'. Please consult the "
+      "installation instructions at https://dealii.org/current/readme.html"));
+}
+
+
+
 template <class Matrix>
 void
 SparseDirectUMFPACK::solve(const Matrix &, Vector<double> &, const bool)
@@ -845,6 +1000,7 @@ SparseDirectUMFPACK::n() const
 // explicit instantiations for SparseMatrixUMFPACK
 #define InstantiateUMFPACK(MatrixType)                                     \
   template void SparseDirectUMFPACK::factorize(const MatrixType &);        \
+  template void SparseDirectUMFPACK::refactorize(const MatrixType &);      \
   template void SparseDirectUMFPACK::solve(const MatrixType &,             \
                                            Vector<double> &,               \
                                            const bool);                    \
@@ -14,18 +14,21 @@
 
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_registry.h>
 
 #include <deal.II/lac/exceptions.h>
 #include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/sparsity_tools.h>
 
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <memory>
 #include <set>
 
 #ifdef DEAL_II_WITH_MPI
 #  include <deal.II/base/mpi.h>
+#  include <deal.II/base/mpi_consensus_algorithms.h>
 #  include <deal.II/base/utilities.h>
 
 #  include <deal.II/lac/block_sparsity_pattern.h>
@@ -948,6 +951,112 @@ namespace SparsityTools
 
 #ifdef DEAL_II_WITH_MPI
 
+  namespace
+  {
+    /**
+     * Send the entries of the rows @p rows of @p dsp to the processes
+     * @p row_owners, where the two vectors are of the same length, and call
+     * @p add_row with the row index and the sorted range of column indices
+     * of every row received from other processes.
+     *
+     * The rows to be sent to a process are collected in a single array in
+     * compressed row format, i.e., the number of rows followed by the row
+     * indices, the number of entries of every row, and the concatenated
+     * column indices of all rows. The sizes of these arrays are computed
+     * first so that every array is allocated only once. The processes that
+     * send data to the current process are found with the NBX consensus
+     * algorithm, which processes every message as soon as it arrives.
+     */
+    template <typename SparsityPatternType, typename AddRowFunction>
+    void
+    exchange_rows(const SparsityPatternType                  &dsp,
+                  const std::vector<types::global_dof_index> &rows,
+                  const std::vector<unsigned int>            &row_owners,
+                  const MPI_Comm                              mpi_comm,
+                  const AddRowFunction                       &add_row)
+    {
+      using size_type = types::global_dof_index;
+      AssertDimension(rows.size(), row_owners.size());
+
+      // Compute the number of non-empty rows and of their entries per
+      // target process.
+      std::map<unsigned int, std::pair<size_type, size_type>> sizes;
+      std::vector<size_type> row_lengths(rows.size());
+      for (std::size_t i = 0; i < rows.size(); ++i)
+        {
+          row_lengths[i] = dsp.row_length(rows[i]);
+
+          // skip empty lines
+          if (row_lengths[i] == 0)
+            continue;
+
+          auto &target_sizes = sizes[row_owners[i]];
+          ++target_sizes.first;
+          target_sizes.second += row_lengths[i];
+        }
+
+      // Set up the arrays to be sent and keep track of the positions of the
+      // next row index, row length, and column index to be written.
+      std::map<unsigned int, std::vector<size_type>> send_data;
+      std::map<unsigned int, std::array<size_type, 3>> positions;
+      for (const auto &[target, target_sizes] : sizes)
+        {
+          std::vector<size_type> &buffer = send_data[target];
+          buffer.resize(1 + 2 * target_sizes.first + target_sizes.second);
+          buffer[0]         = target_sizes.first;
+          positions[target] = {{1,
+                                1 + target_sizes.first,
+                                1 + 2 * target_sizes.first}};
+        }
+
+      for (std::size_t i = 0; i < rows.size(); ++i)
+        if (row_lengths[i] > 0)
+          {
+            std::vector<size_type>   &buffer   = send_data[row_owners[i]];
+            std::array<size_type, 3> &position = positions[row_owners[i]];
+
+            buffer[position[0]++] = rows[i];
+            buffer[position[1]++] = row_lengths[i];
+            for (size_type c = 0; c < row_lengths[i]; ++c)
+              buffer[position[2]++] = dsp.column_number(rows[i], c);
+          }
+
+      std::vector<unsigned int> targets;
+      targets.reserve(send_data.size());
+      for (const auto &data : send_data)
+        targets.push_back(data.first);
+
+      Utilities::MPI::ConsensusAlgorithms::nbx<std::vector<size_type>>(
+        targets,
+        /* create_request = */
+        [&send_data](const unsigned int target) {
+          return std::move(send_data[target]);
+        },
+        /* process_request = */
+        [&add_row](const unsigned int /*source*/,
+                   const std::vector<size_type> &buffer) {
+          Assert(buffer.size() > 0, ExcInternalError());
+          const size_type n_rows = buffer[0];
+          Assert(buffer.size() >= 1 + 2 * n_rows, ExcInternalError());
+
+          const size_type *row_indices = buffer.data() + 1;
+          const size_type *n_entries   = row_indices + n_rows;
+          const size_type *columns     = n_entries + n_rows;
+          for (size_type r = 0; r < n_rows; ++r)
+            {
+              Assert(columns + n_entries[r] <= buffer.data() + buffer.size(),
+                     ExcInternalError());
+              add_row(row_indices[r], columns, columns + n_entries[r]);
+              columns += n_entries[r];
+            }
+          Assert(columns == buffer.data() + buffer.size(), ExcInternalError());
+        },
+        mpi_comm);
+    }
+  } // namespace
+
+
+
   void
   gather_sparsity_pattern(DynamicSparsityPattern &dsp,
                           const IndexSet         &locally_owned_rows,
@@ -983,59 +1092,29 @@ namespace SparsityTools
     const auto rows_data_received =
       Utilities::MPI::some_to_some(mpi_comm, rows_data);
 
-    // 4. now prepare data to be sent in the same format as in
-    // distribute_sparsity_pattern() below, i.e.
-    // rX,num_rX,cols_rX
-    map_vec_t send_data;
+    std::vector<DynamicSparsityPattern::size_type> rows_to_send;
+    std::vector<unsigned int>                      row_targets;
     for (const auto &data : rows_data_received)
-      {
-        for (const auto &row : data.second)
-          {
-            const auto rlen = dsp.row_length(row);
-
-            // skip empty lines
-            if (rlen == 0)
-              continue;
-
-            // save entries
-            send_data[data.first].push_back(row);  // row index
-            send_data[data.first].push_back(rlen); // number of entries
-            for (DynamicSparsityPattern::size_type c = 0; c < rlen; ++c)
-              send_data[data.first].push_back(
-                dsp.column_number(row, c)); // columns
-          }                                 // loop over rows
-      }                                     // loop over received data
-
-    // 5. communicate rows
-    const auto received_data =
-      Utilities::MPI::some_to_some(mpi_comm, send_data);
-
-    // 6. add result to our sparsity
-    for (const auto &data : received_data)
-      {
-        const auto &recv_buf = data.second;
-        auto        ptr      = recv_buf.begin();
-        const auto  end      = recv_buf.end();
-        while (ptr != end)
-          {
-            const auto row = *(ptr++);
-            Assert(ptr != end, ExcInternalError());
-
-            const auto n_entries = *(ptr++);
-            Assert(n_entries > 0, ExcInternalError());
-            Assert(ptr != end, ExcInternalError());
-
-            // make sure we clear whatever was previously stored
-            // in these rows. Otherwise we can't guarantee that the
-            // data is consistent across MPI communicator.
-            dsp.clear_row(row);
+      for (const auto &row : data.second)
+        {
+          rows_to_send.push_back(row);
+          row_targets.push_back(data.first);
+        }
 
-            Assert(ptr + (n_entries - 1) != end, ExcInternalError());
-            dsp.add_entries(row, ptr, ptr + n_entries, true);
-            ptr += n_entries;
-          }
-        Assert(ptr == end, ExcInternalError());
-      }
+    // 4. communicate rows and add result to our sparsity
+    exchange_rows(dsp,
+                  rows_to_send,
+                  row_targets,
+                  mpi_comm,
+                  [&dsp](const DynamicSparsityPattern::size_type  row,
+                         const DynamicSparsityPattern::size_type *begin,
+                         const DynamicSparsityPattern::size_type *end) {
+                    // make sure we clear whatever was previously stored
+                    // in these rows. Otherwise we can't guarantee that the
+                    // data is consistent across MPI communicator.
+                    dsp.clear_row(row);
+                    dsp.add_entries(row, begin, end, true);
+                  });
   }
 
 
@@ -1068,6 +1147,9 @@ namespace SparsityTools
                               const MPI_Comm          mpi_comm,
                               const IndexSet         &locally_relevant_rows)
   {
+    MemoryRegistry::Stage memory_stage(
+      "SparsityTools::distribute_sparsity_pattern");
+
     AssertThrow(
       dsp.row_index_set() == locally_relevant_rows,
       ExcMessage(
@@ -1076,60 +1158,20 @@ namespace SparsityTools
     IndexSet requested_rows(locally_relevant_rows);
     requested_rows.subtract_set(locally_owned_rows);
 
-    std::vector<unsigned int> index_owner =
+    const std::vector<unsigned int> index_owner =
       Utilities::MPI::compute_index_owner(locally_owned_rows,
                                           requested_rows,
                                           mpi_comm);
 
-    using map_vec_t =
-      std::map<unsigned int, std::vector<DynamicSparsityPattern::size_type>>;
-
-    map_vec_t send_data;
-
-    for (DynamicSparsityPattern::size_type i = 0;
-         i < requested_rows.n_elements();
-         ++i)
-      {
-        const DynamicSparsityPattern::size_type row =
-          requested_rows.nth_index_in_set(i);
-
-        const auto rlen = dsp.row_length(row);
-
-        // skip empty lines
-        if (rlen == 0)
-          continue;
-
-        // save entries
-        send_data[index_owner[i]].push_back(row);  // row index
-        send_data[index_owner[i]].push_back(rlen); // number of entries
-        for (DynamicSparsityPattern::size_type c = 0; c < rlen; ++c)
-          {
-            // columns
-            const auto column = dsp.column_number(row, c);
-            send_data[index_owner[i]].push_back(column);
-          }
-      }
-
-    const auto receive_data = Utilities::MPI::some_to_some(mpi_comm, send_data);
-
-    // add what we received
-    for (const auto &data : receive_data)
-      {
-        const auto &recv_buf = data.second;
-        auto        ptr      = recv_buf.begin();
-        const auto  end      = recv_buf.end();
-        while (ptr != end)
-          {
-            const auto row = *(ptr++);
-            Assert(ptr != end, ExcInternalError());
-            const auto n_entries = *(ptr++);
-
-            Assert(ptr + (n_entries - 1) != end, ExcInternalError());
-            dsp.add_entries(row, ptr, ptr + n_entries, true);
-            ptr += n_entries;
-          }
-        Assert(ptr == end, ExcInternalError());
-      }
+    exchange_rows(dsp,
+                  requested_rows.get_index_vector(),
+                  index_owner,
+                  mpi_comm,
+                  [&dsp](const DynamicSparsityPattern::size_type  row,
+                         const DynamicSparsityPattern::size_type *begin,
+                         const DynamicSparsityPattern::size_type *end) {
+                    dsp.add_entries(row, begin, end, true);
+                  });
   }
 
 
@@ -1155,135 +1197,23 @@ namespace SparsityTools
                               const MPI_Comm               mpi_comm,
                               const IndexSet &locally_relevant_rows)
   {
-    using map_vec_t =
-      std::map<BlockDynamicSparsityPattern::size_type,
-               std::vector<BlockDynamicSparsityPattern::size_type>>;
-    map_vec_t send_data;
-
     IndexSet requested_rows(locally_relevant_rows);
     requested_rows.subtract_set(locally_owned_rows);
 
-    std::vector<unsigned int> index_owner =
+    const std::vector<unsigned int> index_owner =
       Utilities::MPI::compute_index_owner(locally_owned_rows,
                                           requested_rows,
                                           mpi_comm);
 
-    for (DynamicSparsityPattern::size_type i = 0;
-         i < requested_rows.n_elements();
-         ++i)
-      {
-        const DynamicSparsityPattern::size_type row =
-          requested_rows.nth_index_in_set(i);
-
-        BlockDynamicSparsityPattern::size_type rlen = dsp.row_length(row);
-
-        // skip empty lines
-        if (rlen == 0)
-          continue;
-
-        // save entries
-        std::vector<BlockDynamicSparsityPattern::size_type> &dst =
-          send_data[index_owner[i]];
-
-        dst.push_back(rlen); // number of entries
-        dst.push_back(row);  // row index
-        for (BlockDynamicSparsityPattern::size_type c = 0; c < rlen; ++c)
-          {
-            // columns
-            BlockDynamicSparsityPattern::size_type column =
-              dsp.column_number(row, c);
-            dst.push_back(column);
-          }
-      }
-
-    unsigned int num_receive = 0;
-    {
-      std::vector<unsigned int> send_to;
-      send_to.reserve(send_data.size());
-      for (const auto &sparsity_line : send_data)
-        send_to.push_back(sparsity_line.first);
-
-      num_receive =
-        Utilities::MPI::compute_n_point_to_point_communications(mpi_comm,
-                                                                send_to);
-    }
-
-    std::vector<MPI_Request> requests(send_data.size());
-
-
-    // send data
-
-    static Utilities::MPI::CollectiveMutex      mutex;
-    Utilities::MPI::CollectiveMutex::ScopedLock lock(mutex, mpi_comm);
-
-    const int mpi_tag = Utilities::MPI::internal::Tags::
-      sparsity_tools_distribute_sparsity_pattern;
-
-    {
-      unsigned int idx = 0;
-      for (const auto &sparsity_line : send_data)
-        {
-          const int ierr = MPI_Isend(sparsity_line.second.data(),
-                                     sparsity_line.second.size(),
-                                     DEAL_II_DOF_INDEX_MPI_TYPE,
-                                     sparsity_line.first,
-                                     mpi_tag,
-                                     mpi_comm,
-                                     &requests[idx++]);
-          AssertThrowMPI(ierr);
-        }
-    }
-
-    {
-      // receive
-      std::vector<BlockDynamicSparsityPattern::size_type> recv_buf;
-      for (unsigned int index = 0; index < num_receive; ++index)
-        {
-          MPI_Status status;
-          int ierr = MPI_Probe(MPI_ANY_SOURCE, mpi_tag, mpi_comm, &status);
-          AssertThrowMPI(ierr);
-
-          int len;
-          ierr = MPI_Get_count(&status, DEAL_II_DOF_INDEX_MPI_TYPE, &len);
-          AssertThrowMPI(ierr);
-
-          recv_buf.resize(len);
-          ierr = MPI_Recv(recv_buf.data(),
-                          len,
-                          DEAL_II_DOF_INDEX_MPI_TYPE,
-                          status.MPI_SOURCE,
-                          status.MPI_TAG,
-                          mpi_comm,
-                          &status);
-          AssertThrowMPI(ierr);
-
-          std::vector<BlockDynamicSparsityPattern::size_type>::const_iterator
-            ptr = recv_buf.begin();
-          std::vector<BlockDynamicSparsityPattern::size_type>::const_iterator
-            end = recv_buf.end();
-          while (ptr != end)
-            {
-              BlockDynamicSparsityPattern::size_type num = *(ptr++);
-              Assert(ptr != end, ExcInternalError());
-              BlockDynamicSparsityPattern::size_type row = *(ptr++);
-              for (unsigned int c = 0; c < num; ++c)
-                {
-                  Assert(ptr != end, ExcInternalError());
-                  dsp.add(row, *ptr);
-                  ++ptr;
-                }
-            }
-          Assert(ptr == end, ExcInternalError());
-        }
-    }
-
-    // complete all sends, so that we can safely destroy the buffers.
-    if (requests.size() > 0)
-      {
-        const int ierr =
-          MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
-        AssertThrowMPI(ierr);
-      }
+    exchange_rows(dsp,
+                  requested_rows.get_index_vector(),
+                  index_owner,
+                  mpi_comm,
+                  [&dsp](const BlockDynamicSparsityPattern::size_type  row,
+                         const BlockDynamicSparsityPattern::size_type *begin,
+                         const BlockDynamicSparsityPattern::size_type *end) {
+                    dsp.add_entries(row, begin, end);
+                  });
   }
 #endif
 } // namespace SparsityTools
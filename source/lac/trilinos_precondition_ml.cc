@@ -58,6 +58,8 @@ namespace TrilinosWrappers
     , output_details(output_details)
     , smoother_type(smoother_type)
     , coarse_type(coarse_type)
+    , reuse_aggregates(false)
+    , rebuild_iteration_factor(1.5)
   {}
 
 
@@ -112,6 +114,9 @@ namespace TrilinosWrappers
     parameter_list.set("aggregation: threshold", aggregation_threshold);
     parameter_list.set("coarse: max size", 2000);
 
+    if (reuse_aggregates)
+      parameter_list.set("reuse: enable", true);
+
     if (output_details)
       parameter_list.set("ML output", 10);
     else
@@ -280,6 +285,9 @@ namespace TrilinosWrappers
   {
     preconditioner.reset(
       new ML_Epetra::MultiLevelPreconditioner(matrix, ml_parameters));
+
+    setup_matrix             = &matrix;
+    n_iterations_after_setup = 0;
   }
 
 
@@ -324,16 +332,48 @@ namespace TrilinosWrappers
   {
     ML_Epetra::MultiLevelPreconditioner *multilevel_operator =
       dynamic_cast<ML_Epetra::MultiLevelPreconditioner *>(preconditioner.get());
+    Assert(multilevel_operator != nullptr, ExcNotInitialized());
     multilevel_operator->ReComputePreconditioner();
   }
 
 
 
+  void
+  PreconditionAMG::update(const SparseMatrix   &matrix,
+                          const AdditionalData &additional_data,
+                          const unsigned int    n_iterations)
+  {
+    if (preconditioner.get() == nullptr ||
+        additional_data.reuse_aggregates == false ||
+        setup_matrix != &matrix.trilinos_matrix())
+      {
+        initialize(matrix, additional_data);
+        return;
+      }
+
+    // the first solve after a full setup gives the reference for the
+    // number of iterations that the reused aggregates are judged by
+    if (n_iterations_after_setup == 0)
+      n_iterations_after_setup = n_iterations;
+
+    if (additional_data.rebuild_iteration_factor > 0. &&
+        n_iterations_after_setup > 0 &&
+        n_iterations >
+          additional_data.rebuild_iteration_factor * n_iterations_after_setup)
+      initialize(matrix, additional_data);
+    else
+      reinit();
+  }
+
+
+
   void
   PreconditionAMG::clear()
   {
     PreconditionBase::clear();
     trilinos_matrix.reset();
+    setup_matrix             = nullptr;
+    n_iterations_after_setup = 0;
   }
 
 
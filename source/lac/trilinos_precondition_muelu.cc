@@ -48,6 +48,7 @@ namespace TrilinosWrappers
     , output_details(output_details)
     , smoother_type(smoother_type)
     , coarse_type(coarse_type)
+    , rebuild_iteration_factor(1.5)
   {}
 
 
@@ -198,6 +199,9 @@ namespace TrilinosWrappers
       Teuchos::rcp(const_cast<Epetra_CrsMatrix *>(&matrix), false);
     preconditioner = MueLu::CreateEpetraPreconditioner(teuchos_wrapped_matrix,
                                                        muelu_parameters);
+
+    setup_matrix             = &matrix;
+    n_iterations_after_setup = 0;
   }
 
 
@@ -237,11 +241,57 @@ namespace TrilinosWrappers
 
 
 
+  void
+  PreconditionAMGMueLu::reinit()
+  {
+    MueLu::EpetraOperator *multilevel_operator =
+      dynamic_cast<MueLu::EpetraOperator *>(preconditioner.get());
+    Assert(multilevel_operator != nullptr && setup_matrix != nullptr,
+           ExcNotInitialized());
+
+    const auto teuchos_wrapped_matrix =
+      Teuchos::rcp(const_cast<Epetra_CrsMatrix *>(setup_matrix), false);
+    MueLu::ReuseEpetraPreconditioner(teuchos_wrapped_matrix,
+                                     *multilevel_operator);
+  }
+
+
+
+  void
+  PreconditionAMGMueLu::update(const SparseMatrix   &matrix,
+                               const AdditionalData &additional_data,
+                               const unsigned int    n_iterations)
+  {
+    if (preconditioner.get() == nullptr ||
+        setup_matrix != &matrix.trilinos_matrix())
+      {
+        initialize(matrix, additional_data);
+        return;
+      }
+
+    // the first solve after a full setup gives the reference for the
+    // number of iterations that the reused hierarchy is judged by
+    if (n_iterations_after_setup == 0)
+      n_iterations_after_setup = n_iterations;
+
+    if (additional_data.rebuild_iteration_factor > 0. &&
+        n_iterations_after_setup > 0 &&
+        n_iterations >
+          additional_data.rebuild_iteration_factor * n_iterations_after_setup)
+      initialize(matrix, additional_data);
+    else
+      reinit();
+  }
+
+
+
   void
   PreconditionAMGMueLu::clear()
   {
     PreconditionBase::clear();
     trilinos_matrix.reset();
+    setup_matrix             = nullptr;
+    n_iterations_after_setup = 0;
   }
 
 
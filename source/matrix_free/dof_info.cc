@@ -24,6 +24,7 @@
 #include <deal.II/matrix_free/vector_data_exchange.h>
 
 #include <iostream>
+#include <limits>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -63,6 +64,9 @@ namespace internal
       row_starts_plain_indices.clear();
       plain_dof_indices.clear();
       dof_indices_interleaved.clear();
+      dof_indices_interleaved_compressed.clear();
+      dof_indices_interleaved_compressed_start.clear();
+      dof_indices_interleaved_compressed_base.clear();
       for (unsigned int i = 0; i < 3; ++i)
         {
           index_storage_variants[i].clear();
@@ -887,6 +891,77 @@ namespace internal
                   *interleaved_dof_indices = *my_dof_indices;
               }
           }
+
+      // Step 5: Compress the interleaved indices of cell batches where all
+      // indices of a cell are within the range of 16-bit offsets from the
+      // smallest index on that cell. If this succeeds for all batches, the
+      // uncompressed interleaved indices are not needed any more.
+      dof_indices_interleaved_compressed.clear();
+      dof_indices_interleaved_compressed_start.clear();
+      dof_indices_interleaved_compressed_base.clear();
+      bool                      all_interleaved_compressed = true;
+      std::vector<unsigned int> min_index(vectorization_length);
+      std::vector<unsigned int> max_index(vectorization_length);
+      for (unsigned int i = 0; i < irregular_cells.size(); ++i)
+        if (index_storage_variants[dof_access_cell][i] ==
+            IndexStorageVariants::interleaved)
+          {
+            const unsigned int n_indices =
+              dofs_per_cell[have_hp ? cell_active_fe_index[i] : 0] *
+              vectorization_length;
+            const unsigned int *interleaved_dof_indices =
+              this->dof_indices_interleaved.data() +
+              row_starts[i * vectorization_length * n_components].first;
+
+            std::fill(min_index.begin(),
+                      min_index.end(),
+                      numbers::invalid_unsigned_int);
+            std::fill(max_index.begin(), max_index.end(), 0U);
+            for (unsigned int k = 0; k < n_indices; ++k)
+              {
+                const unsigned int v = k % vectorization_length;
+                min_index[v] =
+                  std::min(min_index[v], interleaved_dof_indices[k]);
+                max_index[v] =
+                  std::max(max_index[v], interleaved_dof_indices[k]);
+              }
+
+            bool can_compress = n_indices > 0;
+            for (unsigned int v = 0; v < vectorization_length; ++v)
+              if (max_index[v] - min_index[v] >
+                  std::numeric_limits<unsigned short>::max())
+                can_compress = false;
+
+            if (can_compress == false)
+              {
+                all_interleaved_compressed = false;
+                continue;
+              }
+
+            if (dof_indices_interleaved_compressed_start.empty())
+              {
+                dof_indices_interleaved_compressed_start.resize(
+                  irregular_cells.size(), numbers::invalid_unsigned_int);
+                dof_indices_interleaved_compressed_base.resize(
+                  irregular_cells.size() * vectorization_length);
+              }
+            dof_indices_interleaved_compressed_start[i] =
+              dof_indices_interleaved_compressed.size();
+            for (unsigned int v = 0; v < vectorization_length; ++v)
+              dof_indices_interleaved_compressed_base[i * vectorization_length +
+                                                      v] = min_index[v];
+            for (unsigned int k = 0; k < n_indices; ++k)
+              dof_indices_interleaved_compressed.push_back(
+                static_cast<unsigned short>(
+                  interleaved_dof_indices[k] -
+                  min_index[k % vectorization_length]));
+          }
+
+      if (all_interleaved_compressed)
+        {
+          dof_indices_interleaved.clear();
+          dof_indices_interleaved.shrink_to_fit();
+        }
     }
 
 
@@ -1523,6 +1598,91 @@ namespace internal
 
 
 
+    bool
+    DoFInfo::has_identical_indices(const DoFInfo &other) const
+    {
+      if (vector_partitioner == nullptr || other.vector_partitioner == nullptr)
+        return false;
+      if (vector_partitioner != other.vector_partitioner &&
+          (vector_partitioner->locally_owned_range() !=
+             other.vector_partitioner->locally_owned_range() ||
+           vector_partitioner->ghost_indices() !=
+             other.vector_partitioner->ghost_indices()))
+        return false;
+
+      // compare the cheap fields first
+      return vectorization_length == other.vectorization_length &&
+             dofs_per_cell == other.dofs_per_cell &&
+             dofs_per_face == other.dofs_per_face &&
+             n_components == other.n_components &&
+             start_components == other.start_components &&
+             component_dof_indices_offset ==
+               other.component_dof_indices_offset &&
+             cell_active_fe_index == other.cell_active_fe_index &&
+             store_plain_indices == other.store_plain_indices &&
+             index_storage_variants == other.index_storage_variants &&
+             n_vectorization_lanes_filled ==
+               other.n_vectorization_lanes_filled &&
+             row_starts == other.row_starts &&
+             dof_indices == other.dof_indices &&
+             constraint_indicator == other.constraint_indicator &&
+             dof_indices_interleaved == other.dof_indices_interleaved &&
+             dof_indices_interleaved_compressed ==
+               other.dof_indices_interleaved_compressed &&
+             dof_indices_interleaved_compressed_start ==
+               other.dof_indices_interleaved_compressed_start &&
+             dof_indices_interleaved_compressed_base ==
+               other.dof_indices_interleaved_compressed_base &&
+             dof_indices_contiguous == other.dof_indices_contiguous &&
+             dof_indices_contiguous_sm == other.dof_indices_contiguous_sm &&
+             dof_indices_interleave_strides ==
+               other.dof_indices_interleave_strides &&
+             hanging_node_constraint_masks ==
+               other.hanging_node_constraint_masks &&
+             hanging_node_constraint_masks_comp ==
+               other.hanging_node_constraint_masks_comp &&
+             constrained_dofs == other.constrained_dofs &&
+             row_starts_plain_indices == other.row_starts_plain_indices &&
+             plain_dof_indices == other.plain_dof_indices &&
+             ghost_dofs == other.ghost_dofs;
+    }
+
+
+
+    void
+    DoFInfo::release_indices_identical_to(const DoFInfo &other)
+    {
+      Assert(has_identical_indices(other), ExcInternalError());
+
+      vector_partitioner             = other.vector_partitioner;
+      vector_exchanger               = other.vector_exchanger;
+      vector_exchanger_face_variants = other.vector_exchanger_face_variants;
+
+      // release the memory of the large arrays by swapping with empty ones
+      std::vector<std::pair<unsigned int, unsigned int>>().swap(row_starts);
+      std::vector<unsigned int>().swap(dof_indices);
+      std::vector<std::pair<unsigned short, unsigned short>>().swap(
+        constraint_indicator);
+      std::vector<unsigned int>().swap(dof_indices_interleaved);
+      std::vector<unsigned short>().swap(dof_indices_interleaved_compressed);
+      std::vector<unsigned int>().swap(
+        dof_indices_interleaved_compressed_start);
+      std::vector<unsigned int>().swap(dof_indices_interleaved_compressed_base);
+      for (unsigned int i = 0; i < 3; ++i)
+        {
+          std::vector<unsigned int>().swap(dof_indices_contiguous[i]);
+          std::vector<std::pair<unsigned int, unsigned int>>().swap(
+            dof_indices_contiguous_sm[i]);
+          std::vector<unsigned int>().swap(dof_indices_interleave_strides[i]);
+        }
+      std::vector<compressed_constraint_kind>().swap(
+        hanging_node_constraint_masks);
+      std::vector<unsigned int>().swap(row_starts_plain_indices);
+      std::vector<unsigned int>().swap(plain_dof_indices);
+    }
+
+
+
     std::size_t
     DoFInfo::memory_consumption() const
     {
@@ -1533,6 +1693,12 @@ namespace internal
         (row_starts.capacity() * sizeof(std::pair<unsigned int, unsigned int>));
       memory += MemoryConsumption::memory_consumption(dof_indices);
       memory += MemoryConsumption::memory_consumption(dof_indices_interleaved);
+      memory += MemoryConsumption::memory_consumption(
+        dof_indices_interleaved_compressed);
+      memory += MemoryConsumption::memory_consumption(
+        dof_indices_interleaved_compressed_start);
+      memory += MemoryConsumption::memory_consumption(
+        dof_indices_interleaved_compressed_base);
       memory += MemoryConsumption::memory_consumption(dof_indices_contiguous);
       memory +=
         MemoryConsumption::memory_consumption(dof_indices_contiguous_sm);
@@ -1566,6 +1732,7 @@ namespace internal
       memory +=
         MemoryConsumption::memory_consumption(cell_loop_post_list_index);
       memory += MemoryConsumption::memory_consumption(cell_loop_post_list);
+      memory += MemoryConsumption::memory_consumption(cell_loop_fused_stage);
       return memory;
     }
   } // namespace MatrixFreeFunctions
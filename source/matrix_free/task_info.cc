@@ -14,6 +14,7 @@
 
 
 #include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/instrumentation_region.h>
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/multithread_info.h>
@@ -35,6 +36,7 @@
 #  endif
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <set>
 
@@ -48,8 +50,10 @@
 // free infrastructure has seen less attention than the rest over the last
 // years and is (presumably) not used that often.
 //
-// In case of detected oneAPI backend we simply disable threading in the
-// matrix free backend for now.
+// In case of detected oneAPI backend, and with taskflow, we instead run the
+// partitions of the thread graph in a sequence of fork-join steps via
+// parallel::apply_to_subranges(), which uses the persistent thread pool of
+// the respective library.
 //
 // Matthias Maier, Martin Kronbichler, 2021
 //
@@ -342,13 +346,170 @@ namespace internal
       const bool         do_compress;
     };
 
-#endif // DEAL_II_WITH_TBB
+#endif
+
+#if defined(DEAL_II_WITH_TBB) || defined(DEAL_II_WITH_TASKFLOW)
+
+    // This defines the functions that run the partitions of the thread graph
+    // in fork-join steps, for the case that the tbb::task interface is not
+    // available and for the cell-centric loop. The odd partitions of a layer
+    // only depend on their even neighbors and are run first, concurrently
+    // with the exchange of ghost data, like in the task graph built with the
+    // tbb::task interface.
+
+    namespace fork_join
+    {
+      /**
+       * Call @p function for the indices first, first+2, first+4, ... of
+       * @p n_indices indices in parallel.
+       */
+      template <typename Function>
+      void
+      apply_to_every_second(const unsigned int first,
+                            const unsigned int n_indices,
+                            const Function    &function)
+      {
+        parallel::apply_to_subranges(
+          0U,
+          n_indices,
+          [first, &function](const unsigned int begin, const unsigned int end) {
+            for (unsigned int j = begin; j < end; ++j)
+              function(first + 2 * j);
+          },
+          1);
+      }
+
+
+
+      /**
+       * Run the cells, faces and boundaries of all sub-partitions of the
+       * given partition of the partition-partition scheme.
+       */
+      void
+      run_partition_partition(MFWorkerInterface &worker,
+                              const TaskInfo    &task_info,
+                              const unsigned int partition)
+      {
+        const auto run_subpartition = [&](const unsigned int subpartition) {
+          worker.cell(subpartition);
+
+          if (task_info.face_partition_data.empty() == false)
+            {
+              worker.face(subpartition);
+              worker.boundary(subpartition);
+            }
+        };
+
+        const unsigned int start = task_info.partition_row_index[partition];
+        apply_to_every_second(start + 1,
+                              task_info.partition_odds[partition],
+                              run_subpartition);
+        apply_to_every_second(start,
+                              task_info.partition_evens[partition],
+                              run_subpartition);
+      }
+
+
+
+      /**
+       * Run the colors of the given partition of the partition-color scheme
+       * one after the other, splitting the cells of each color into chunks
+       * of TaskInfo::block_size cell batches that are worked on in parallel.
+       */
+      void
+      run_partition_color(MFWorkerInterface &worker,
+                          const TaskInfo    &task_info,
+                          const unsigned int partition)
+      {
+        if (task_info.face_partition_data.empty() == false)
+          {
+            AssertThrow(false, ExcNotImplemented());
+          }
+
+        for (unsigned int color = task_info.partition_row_index[partition];
+             color < task_info.partition_row_index[partition + 1];
+             ++color)
+          {
+            const unsigned int begin = task_info.cell_partition_data[color];
+            const unsigned int end = task_info.cell_partition_data[color + 1];
+            const unsigned int n_chunks =
+              (end - begin + task_info.block_size - 1) / task_info.block_size;
+            parallel::apply_to_subranges(
+              0U,
+              n_chunks,
+              [&](const unsigned int chunk_begin,
+                  const unsigned int chunk_end) {
+                worker.cell(std::make_pair(
+                  begin + task_info.block_size * chunk_begin,
+                  std::min(begin + task_info.block_size * chunk_end, end)));
+              },
+              1);
+          }
+      }
+
+
+
+      /**
+       * Run the cells of the given partition for a cell-centric loop, where
+       * the cell work also includes the integrals over all faces of the
+       * cells and only writes into the entries of the cells themselves. As
+       * opposed to run_partition_partition() and run_partition_color(), no
+       * face ranges are scheduled, which lifts the restriction of the
+       * partition-color scheme to loops without face integrals.
+       */
+      void
+      run_partition_cell_centric(MFWorkerInterface &worker,
+                                 const TaskInfo    &task_info,
+                                 const unsigned int partition)
+      {
+        const unsigned int start = task_info.partition_row_index[partition];
+        if (task_info.scheme == TaskInfo::partition_partition)
+          {
+            const auto run_subpartition =
+              [&](const unsigned int subpartition) {
+                worker.cell(subpartition);
+              };
+            apply_to_every_second(start + 1,
+                                  task_info.partition_odds[partition],
+                                  run_subpartition);
+            apply_to_every_second(start,
+                                  task_info.partition_evens[partition],
+                                  run_subpartition);
+          }
+        else
+          for (unsigned int color = start;
+               color < task_info.partition_row_index[partition + 1];
+               ++color)
+            {
+              const unsigned int begin = task_info.cell_partition_data[color];
+              const unsigned int end =
+                task_info.cell_partition_data[color + 1];
+              const unsigned int n_chunks =
+                (end - begin + task_info.block_size - 1) /
+                task_info.block_size;
+              parallel::apply_to_subranges(
+                0U,
+                n_chunks,
+                [&](const unsigned int chunk_begin,
+                    const unsigned int chunk_end) {
+                  worker.cell(std::make_pair(
+                    begin + task_info.block_size * chunk_begin,
+                    std::min(begin + task_info.block_size * chunk_end, end)));
+                },
+                1);
+            }
+      }
+    } // namespace fork_join
+
+#endif // DEAL_II_WITH_TBB || DEAL_II_WITH_TASKFLOW
 
 
 
     void
     TaskInfo::loop(MFWorkerInterface &funct) const
     {
+      InstrumentationRegion instrumentation_region("MatrixFree::loop");
+
       // If we use thread parallelism, we do not currently support to schedule
       // pieces of updates within the loop, so this index will collect all
       // calls in that case and work like a single complete loop over all
@@ -601,6 +762,28 @@ namespace internal
             }
         }
       else
+#elif defined(DEAL_II_WITH_TBB) || defined(DEAL_II_WITH_TASKFLOW)
+
+      if (scheme != none)
+        {
+          funct.zero_dst_vector_range(numbers::invalid_unsigned_int);
+
+          const auto run_partition = [&](const unsigned int partition) {
+            if (scheme == partition_partition)
+              fork_join::run_partition_partition(funct, *this, partition);
+            else
+              fork_join::run_partition_color(funct, *this, partition);
+          };
+
+          // If there are no partitions, as for an empty partition list of
+          // the partition-partition scheme, we still need to call the vector
+          // communication routines to clean up and initiate things
+          fork_join::apply_to_every_second(1, odds, run_partition);
+          funct.vector_update_ghosts_finish();
+          fork_join::apply_to_every_second(0, evens, run_partition);
+          funct.vector_compress_start();
+        }
+      else
 #endif
         // serial loop, go through up to three times and do the MPI transfer at
         // the beginning/end of the second part
@@ -620,7 +803,24 @@ namespace internal
                   AssertIndexRange(i + 1, cell_partition_data.size());
                   if (cell_partition_data[i + 1] > cell_partition_data[i])
                     {
-                      funct.cell(i);
+                      // In the parts without pending data dependencies on the
+                      // ghost exchange, work on chunks of cells and poke the
+                      // MPI library in between, as many implementations only
+                      // progress non-blocking messages inside MPI calls.
+                      if (part != 1 && n_procs > 1 &&
+                          communication_progress_interval > 0)
+                        for (unsigned int begin = cell_partition_data[i];
+                             begin < cell_partition_data[i + 1];
+                             begin += communication_progress_interval)
+                          {
+                            funct.cell(std::make_pair(
+                              begin,
+                              std::min(begin + communication_progress_interval,
+                                       cell_partition_data[i + 1])));
+                            make_communication_progress();
+                          }
+                      else
+                        funct.cell(i);
                     }
 
                   if (face_partition_data.empty() == false)
@@ -649,6 +849,142 @@ namespace internal
 
 
 
+    void
+    TaskInfo::loop_cell_centric(MFWorkerInterface &funct) const
+    {
+      if (scheme == none)
+        {
+          // the serial loop only schedules the face ranges in addition to
+          // the cell ranges, which are empty for cell-centric loops
+          loop(funct);
+          return;
+        }
+
+#if defined(DEAL_II_WITH_TBB) || defined(DEAL_II_WITH_TASKFLOW)
+      InstrumentationRegion instrumentation_region(
+        "MatrixFree::loop_cell_centric");
+
+      funct.cell_loop_pre_range(numbers::invalid_unsigned_int);
+      funct.vector_update_ghosts_start();
+      funct.zero_dst_vector_range(numbers::invalid_unsigned_int);
+
+      // The cells with faces towards ghost cells are all placed into the
+      // first partition, so the odd partitions can be worked on while the
+      // import of ghost data is in flight. The even partitions, including
+      // the first one, are scheduled once the ghost data is available.
+      const auto run_partition = [&](const unsigned int partition) {
+        fork_join::run_partition_cell_centric(funct, *this, partition);
+      };
+      fork_join::apply_to_every_second(1, odds, run_partition);
+      funct.vector_update_ghosts_finish();
+      fork_join::apply_to_every_second(0, evens, run_partition);
+      funct.vector_compress_start();
+      funct.vector_compress_finish();
+
+      funct.cell_loop_post_range(numbers::invalid_unsigned_int);
+#else
+      Assert(false, ExcInternalError());
+#endif
+    }
+
+
+
+    void
+    TaskInfo::loop(MFWorkerInterface               &first_worker,
+                   MFWorkerInterface               &second_worker,
+                   const std::vector<unsigned int> &stage) const
+    {
+      // The ranges of the second loop are scheduled in between the ranges of
+      // the first loop only for the serial loop, as we do not model the
+      // dependencies between the two loops in the task graph
+      if (scheme != none)
+        {
+          loop(first_worker);
+          loop(second_worker);
+          return;
+        }
+
+      InstrumentationRegion instrumentation_region("MatrixFree::loop");
+
+      const unsigned int n_ranges =
+        partition_row_index[partition_row_index.size() - 2];
+      AssertDimension(stage.size(), n_ranges);
+
+      const auto run_range = [&](MFWorkerInterface &funct,
+                                 const unsigned int i,
+                                 const bool         poke_communication) {
+        funct.cell_loop_pre_range(i);
+        funct.zero_dst_vector_range(i);
+        AssertIndexRange(i + 1, cell_partition_data.size());
+        if (cell_partition_data[i + 1] > cell_partition_data[i])
+          {
+            if (poke_communication && n_procs > 1 &&
+                communication_progress_interval > 0)
+              for (unsigned int begin = cell_partition_data[i];
+                   begin < cell_partition_data[i + 1];
+                   begin += communication_progress_interval)
+                {
+                  funct.cell(
+                    std::make_pair(begin,
+                                   std::min(begin +
+                                              communication_progress_interval,
+                                            cell_partition_data[i + 1])));
+                  make_communication_progress();
+                }
+            else
+              funct.cell(i);
+          }
+
+        if (face_partition_data.empty() == false)
+          {
+            if (face_partition_data[i + 1] > face_partition_data[i])
+              funct.face(i);
+            if (boundary_partition_data[i + 1] > boundary_partition_data[i])
+              funct.boundary(i);
+          }
+        funct.cell_loop_post_range(i);
+      };
+
+      first_worker.cell_loop_pre_range(n_ranges);
+      second_worker.cell_loop_pre_range(n_ranges);
+      first_worker.vector_update_ghosts_start();
+
+      // index of the next range of the second loop, which is run in order
+      // once its input from the first loop is complete
+      unsigned int next = 0;
+      for (unsigned int part = 0; part < partition_row_index.size() - 2; ++part)
+        {
+          if (part == 1)
+            first_worker.vector_update_ghosts_finish();
+
+          for (unsigned int i = partition_row_index[part];
+               i < partition_row_index[part + 1];
+               ++i)
+            {
+              run_range(first_worker, i, part != 1);
+              for (; next < n_ranges && stage[next] <= i; ++next)
+                run_range(second_worker, next, false);
+            }
+
+          if (part == 1)
+            first_worker.vector_compress_start();
+        }
+      first_worker.vector_compress_finish();
+      first_worker.cell_loop_post_range(n_ranges);
+
+      // the remaining ranges of the second loop depend on the data exchange
+      // of the first loop, so run them as a usual loop
+      second_worker.vector_update_ghosts_start();
+      second_worker.vector_update_ghosts_finish();
+      for (; next < n_ranges; ++next)
+        run_range(second_worker, next, false);
+      second_worker.vector_compress_start();
+      second_worker.vector_compress_finish();
+      second_worker.cell_loop_post_range(n_ranges);
+    }
+
+
+
     TaskInfo::TaskInfo()
     {
       clear();
@@ -656,6 +992,19 @@ namespace internal
 
 
 
+    void
+    TaskInfo::make_communication_progress() const
+    {
+#ifdef DEAL_II_WITH_MPI
+      int       flag = 0;
+      const int ierr = MPI_Iprobe(
+        MPI_ANY_SOURCE, MPI_ANY_TAG, communicator, &flag, MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+#endif
+    }
+
+
+
     void
     TaskInfo::clear()
     {
@@ -678,9 +1027,10 @@ namespace internal
       partition_odds.clear();
       partition_n_blocked_workers.clear();
       partition_n_workers.clear();
-      communicator = MPI_COMM_SELF;
-      my_pid       = 0;
-      n_procs      = 1;
+      communicator                    = MPI_COMM_SELF;
+      communication_progress_interval = 0;
+      my_pid                          = 0;
+      n_procs                         = 1;
     }
 
 
@@ -216,7 +216,29 @@ namespace MeshWorker
     , neighbor_dof_indices(scratch.neighbor_dof_indices)
     , user_data_storage(scratch.user_data_storage)
     , internal_data_storage(scratch.internal_data_storage)
-  {}
+  {
+    // The FE*Values objects are usually created lazily. If the object we
+    // copy from already has some of them, copy those, which allows sharing
+    // the data the finite element has precomputed for them.
+    if (scratch.fe_values)
+      fe_values = std::make_unique<FEValues<dim, spacedim>>(*scratch.fe_values);
+    if (scratch.fe_face_values)
+      fe_face_values =
+        std::make_unique<FEFaceValues<dim, spacedim>>(*scratch.fe_face_values);
+    if (scratch.fe_subface_values)
+      fe_subface_values = std::make_unique<FESubfaceValues<dim, spacedim>>(
+        *scratch.fe_subface_values);
+    if (scratch.hp_fe_values)
+      hp_fe_values =
+        std::make_unique<hp::FEValues<dim, spacedim>>(*scratch.hp_fe_values);
+    if (scratch.hp_fe_face_values)
+      hp_fe_face_values = std::make_unique<hp::FEFaceValues<dim, spacedim>>(
+        *scratch.hp_fe_face_values);
+    if (scratch.hp_fe_subface_values)
+      hp_fe_subface_values =
+        std::make_unique<hp::FESubfaceValues<dim, spacedim>>(
+          *scratch.hp_fe_subface_values);
+  }
 
 
 
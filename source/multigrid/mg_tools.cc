@@ -1430,9 +1430,8 @@ namespace MGTools
     for (unsigned int level = 0; level < dof.get_triangulation().n_levels();
          ++level)
       {
-        std::sort(dofs_by_level[level].begin(), dofs_by_level[level].end());
-        boundary_indices[level].add_indices(dofs_by_level[level].begin(),
-                                            dofs_by_level[level].end());
+        boundary_indices[level].add_unsorted_indices(
+          std::move(dofs_by_level[level]));
       }
   }
 
@@ -1516,9 +1515,8 @@ namespace MGTools
          ++l)
       {
         interface_dofs[l].clear();
-        std::sort(tmp_interface_dofs[l].begin(), tmp_interface_dofs[l].end());
-        interface_dofs[l].add_indices(tmp_interface_dofs[l].begin(),
-                                      tmp_interface_dofs[l].end());
+        interface_dofs[l].add_unsorted_indices(
+          std::move(tmp_interface_dofs[l]));
         interface_dofs[l].compress();
       }
   }
@@ -1619,6 +1617,25 @@ namespace MGTools
       return static_cast<double>(n_cells_local) /
              (n_cells_local + n_cells_remote);
     }
+
+
+
+    /**
+     * Return the number of ancestors of @p cell that are reached through
+     * first children only, i.e., the number of multigrid level cells that
+     * are owned by the owner of @p cell in addition to the cell itself.
+     */
+    template <int dim, int spacedim>
+    unsigned int
+    n_first_child_ancestors(
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell)
+    {
+      unsigned int n_ancestors = 0;
+      for (auto c = cell; c->level() > 0 && c->parent()->child(0) == c;
+           c = c->parent())
+        ++n_ancestors;
+      return n_ancestors;
+    }
   } // namespace internal
 
 
@@ -1809,6 +1826,88 @@ namespace MGTools
       trias.back()->get_mpi_communicator());
   }
 
+
+
+  template <int dim, int spacedim>
+  std::vector<types::global_dof_index>
+  predicted_local_workload(const Triangulation<dim, spacedim> &tria)
+  {
+    std::vector<types::global_dof_index> n_cells_on_levels(
+      tria.n_global_levels());
+
+    for (const auto &cell : tria.active_cell_iterators())
+      if (cell->is_locally_owned())
+        {
+          typename Triangulation<dim, spacedim>::cell_iterator c = cell;
+          ++n_cells_on_levels[c->level()];
+
+          // the parent is owned by the owner of its first child
+          while (c->level() > 0 && c->parent()->child(0) == c)
+            {
+              c = c->parent();
+              ++n_cells_on_levels[c->level()];
+            }
+        }
+
+    return n_cells_on_levels;
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  predicted_workload_imbalance(const Triangulation<dim, spacedim> &tria)
+  {
+    return internal::workload_imbalance(predicted_local_workload(tria),
+                                        tria.get_mpi_communicator());
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  use_global_coarsening(const Triangulation<dim, spacedim> &tria,
+                        const double                        imbalance_threshold)
+  {
+    return predicted_workload_imbalance(tria) > imbalance_threshold;
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::function<
+    unsigned int(const typename Triangulation<dim, spacedim>::cell_iterator &,
+                 const CellStatus)>
+  level_workload_weighting(const unsigned int factor)
+  {
+    return [factor](
+             const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+             const CellStatus status) -> unsigned int {
+      switch (status)
+        {
+          case CellStatus::cell_will_persist:
+          case CellStatus::children_will_be_coarsened:
+            // the cell is active after the mesh change
+            return factor *
+                   (1 + internal::n_first_child_ancestors<dim, spacedim>(cell));
+
+          case CellStatus::cell_will_be_refined:
+            // the first child of the refined cell, which in addition owns
+            // the cell and its first-child ancestors
+            return factor *
+                   (2 + internal::n_first_child_ancestors<dim, spacedim>(cell));
+
+          case CellStatus::cell_invalid:
+            // the remaining children of the refined cell
+            return factor;
+
+          default:
+            DEAL_II_ASSERT_UNREACHABLE();
+            return 0;
+        }
+    };
+  }
+
 } // namespace MGTools
 
 
@@ -15,6 +15,7 @@
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/tensor.h>
+#include <deal.II/base/work_stream.h>
 
 #include <deal.II/distributed/shared_tria.h>
 #include <deal.II/distributed/tria.h>
@@ -165,6 +166,50 @@ namespace NonMatching
           gtl1[i] = j++;
       return {gtl0, gtl1};
     }
+
+
+
+    /**
+     * Scratch data for the threaded assembly of the coupling mass matrix in
+     * create_coupling_mass_matrix(): the values on the current cell of the
+     * immersed triangulation.
+     */
+    template <int dim1, int spacedim>
+    struct CouplingMassMatrixScratchData
+    {
+      CouplingMassMatrixScratchData(const Mapping<dim1, spacedim>      &mapping,
+                                    const FiniteElement<dim1, spacedim> &fe,
+                                    const Quadrature<dim1> &quadrature,
+                                    const UpdateFlags       update_flags)
+        : fe_values(mapping, fe, quadrature, update_flags)
+      {}
+
+      CouplingMassMatrixScratchData(
+        const CouplingMassMatrixScratchData &scratch_data)
+        : fe_values(scratch_data.fe_values.get_mapping(),
+                    scratch_data.fe_values.get_fe(),
+                    scratch_data.fe_values.get_quadrature(),
+                    scratch_data.fe_values.get_update_flags())
+      {}
+
+      FEValues<dim1, spacedim> fe_values;
+    };
+
+
+
+    /**
+     * Copy data for the threaded assembly of the coupling mass matrix in
+     * create_coupling_mass_matrix(): the local matrices between the current
+     * cell of the immersed triangulation and all locally owned cells of the
+     * embedding triangulation that contain some of its quadrature points.
+     */
+    template <typename Number>
+    struct CouplingMassMatrixCopyData
+    {
+      std::vector<types::global_dof_index>              immersed_dofs;
+      std::vector<std::vector<types::global_dof_index>> space_dofs;
+      std::vector<FullMatrix<Number>>                   cell_matrices;
+    };
   } // namespace internal
 
   template <int dim0, int dim1, int spacedim, typename number>
@@ -417,10 +462,6 @@ namespace NonMatching
     const auto &space_fe    = space_dh.get_fe();
     const auto &immersed_fe = immersed_dh.get_fe();
 
-    // Dof indices
-    std::vector<types::global_dof_index> dofs(immersed_fe.n_dofs_per_cell());
-    std::vector<types::global_dof_index> odofs(space_fe.n_dofs_per_cell());
-
     // Take care of components
     const ComponentMask space_c =
       (space_comps.size() == 0 ? ComponentMask(space_fe.n_components(), true) :
@@ -447,16 +488,6 @@ namespace NonMatching
       if (immersed_c[i])
         immersed_gtl[i] = j++;
 
-    FullMatrix<typename Matrix::value_type> cell_matrix(
-      space_dh.get_fe().n_dofs_per_cell(),
-      immersed_dh.get_fe().n_dofs_per_cell());
-
-    FEValues<dim1, spacedim> fe_v(immersed_mapping,
-                                  immersed_dh.get_fe(),
-                                  quad,
-                                  update_JxW_values | update_quadrature_points |
-                                    update_values);
-
     const unsigned int n_q_points = quad.size();
     const unsigned int n_active_c =
       immersed_dh.get_triangulation().n_active_cells();
@@ -543,20 +574,35 @@ namespace NonMatching
           }
       }
 
-    typename DoFHandler<dim1, spacedim>::active_cell_iterator
-      cell = immersed_dh.begin_active(),
-      endc = immersed_dh.end();
+    using Number = typename Matrix::value_type;
 
-    for (unsigned int j = 0; cell != endc; ++cell, ++j)
-      {
-        // Reinitialize the cell and the fe_values
-        fe_v.reinit(cell);
-        cell->get_dof_indices(dofs);
+    // Compute the local matrices of the cells of the immersed triangulation
+    // in parallel, and add them to the global matrix one after the other.
+    // Since the immersed triangulation is serial, the active cell index of
+    // a cell coincides with its position in the containers above.
+    const auto worker =
+      [&](const typename DoFHandler<dim1, spacedim>::active_cell_iterator
+                &cell,
+          internal::CouplingMassMatrixScratchData<dim1, spacedim> &scratch,
+          internal::CouplingMassMatrixCopyData<Number>            &copy_data) {
+        const unsigned int cell_index = cell->active_cell_index();
+
+        copy_data.space_dofs.clear();
+        copy_data.cell_matrices.clear();
 
         // Get a list of outer cells, qpoints and maps.
-        const auto &cells   = cell_container[j];
-        const auto &qpoints = qpoints_container[j];
-        const auto &maps    = maps_container[j];
+        const auto &cells   = cell_container[cell_index];
+        const auto &qpoints = qpoints_container[cell_index];
+        const auto &maps    = maps_container[cell_index];
+
+        if (cells.empty())
+          return;
+
+        // Reinitialize the cell and the fe_values
+        FEValues<dim1, spacedim> &fe_v = scratch.fe_values;
+        fe_v.reinit(cell);
+        copy_data.immersed_dofs.resize(immersed_fe.n_dofs_per_cell());
+        cell->get_dof_indices(copy_data.immersed_dofs);
 
         for (unsigned int c = 0; c < cells.size(); ++c)
           {
@@ -574,10 +620,14 @@ namespace NonMatching
                                                 qps,
                                                 update_values);
                 o_fe_v.reinit(ocell);
-                ocell->get_dof_indices(odofs);
+                copy_data.space_dofs.emplace_back(space_fe.n_dofs_per_cell());
+                ocell->get_dof_indices(copy_data.space_dofs.back());
 
                 // Reset the matrices.
-                cell_matrix = typename Matrix::value_type();
+                copy_data.cell_matrices.emplace_back(
+                  space_fe.n_dofs_per_cell(), immersed_fe.n_dofs_per_cell());
+                FullMatrix<Number> &cell_matrix =
+                  copy_data.cell_matrices.back();
 
                 for (unsigned int i = 0;
                      i < space_dh.get_fe().n_dofs_per_cell();
@@ -607,13 +657,32 @@ namespace NonMatching
                               }
                         }
                   }
-
-                // Now assemble the matrices
-                constraints.distribute_local_to_global(
-                  cell_matrix, odofs, immersed_constraints, dofs, matrix);
               }
           }
-      }
+      };
+
+    const auto copier =
+      [&](const internal::CouplingMassMatrixCopyData<Number> &copy_data) {
+        // Now assemble the matrices
+        for (unsigned int c = 0; c < copy_data.cell_matrices.size(); ++c)
+          constraints.distribute_local_to_global(copy_data.cell_matrices[c],
+                                                 copy_data.space_dofs[c],
+                                                 immersed_constraints,
+                                                 copy_data.immersed_dofs,
+                                                 matrix);
+      };
+
+    WorkStream::run(immersed_dh.begin_active(),
+                    immersed_dh.end(),
+                    worker,
+                    copier,
+                    internal::CouplingMassMatrixScratchData<dim1, spacedim>(
+                      immersed_mapping,
+                      immersed_fe,
+                      quad,
+                      update_JxW_values | update_quadrature_points |
+                        update_values),
+                    internal::CouplingMassMatrixCopyData<Number>());
   }
 
   template <int dim0, int dim1, int spacedim, typename Number>
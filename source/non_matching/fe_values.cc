@@ -13,7 +13,9 @@
 // ------------------------------------------------------------------------
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/numbers.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/lac/block_vector.h>
 #include <deal.II/lac/la_parallel_block_vector.h>
@@ -40,6 +42,165 @@ namespace NonMatching
 
 
 
+
+  template <int dim>
+  template <typename Number>
+  void
+  ImmersedQuadratureCache<dim>::reinit(
+    const hp::QCollection<1>  &q_collection_1D,
+    const MeshClassifier<dim> &mesh_classifier,
+    const DoFHandler<dim>     &dof_handler,
+    const ReadVector<Number>  &level_set,
+    const AdditionalData      &additional_data)
+  {
+    clear();
+
+    triangulation = &dof_handler.get_triangulation();
+    cell_to_slot.resize(triangulation->n_active_cells(),
+                        numbers::invalid_unsigned_int);
+
+    // collect the intersected cells, before generating their quadratures in
+    // parallel
+    std::vector<typename DoFHandler<dim>::active_cell_iterator> cut_cells;
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (!cell->is_artificial() &&
+          mesh_classifier.location_to_level_set(cell) ==
+            LocationToLevelSet::intersected)
+        {
+          cell_to_slot[cell->active_cell_index()] = cut_cells.size();
+          cut_cells.push_back(cell);
+          q_indices_1D.push_back(
+            q_collection_1D.size() > 1 ? cell->active_fe_index() : 0);
+        }
+
+    inside_quadratures.resize(cut_cells.size());
+    outside_quadratures.resize(cut_cells.size());
+    surface_quadratures.resize(cut_cells.size());
+
+    // the quadrature generator keeps internal state, so every task works
+    // with its own copy
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(cut_cells.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        DiscreteQuadratureGenerator<dim> quadrature_generator(q_collection_1D,
+                                                              dof_handler,
+                                                              level_set,
+                                                              additional_data);
+        for (unsigned int i = begin; i < end; ++i)
+          {
+            quadrature_generator.set_1D_quadrature(q_indices_1D[i]);
+            quadrature_generator.generate(cut_cells[i]);
+
+            inside_quadratures[i] =
+              quadrature_generator.get_inside_quadrature();
+            outside_quadratures[i] =
+              quadrature_generator.get_outside_quadrature();
+            surface_quadratures[i] =
+              quadrature_generator.get_surface_quadrature();
+          }
+      },
+      /* grainsize */ 16);
+  }
+
+
+
+  template <int dim>
+  void
+  ImmersedQuadratureCache<dim>::clear()
+  {
+    triangulation = nullptr;
+    cell_to_slot.clear();
+    q_indices_1D.clear();
+    inside_quadratures.clear();
+    outside_quadratures.clear();
+    surface_quadratures.clear();
+  }
+
+
+
+  template <int dim>
+  bool
+  ImmersedQuadratureCache<dim>::has_quadratures(
+    const typename Triangulation<dim>::cell_iterator &cell,
+    const unsigned int                                q_index_1D) const
+  {
+    if (triangulation == nullptr || &cell->get_triangulation() != triangulation)
+      return false;
+
+    AssertIndexRange(cell->active_cell_index(), cell_to_slot.size());
+    const unsigned int slot = cell_to_slot[cell->active_cell_index()];
+    return slot != numbers::invalid_unsigned_int &&
+           q_indices_1D[slot] == q_index_1D;
+  }
+
+
+
+  template <int dim>
+  const Quadrature<dim> &
+  ImmersedQuadratureCache<dim>::get_inside_quadrature(
+    const typename Triangulation<dim>::cell_iterator &cell) const
+  {
+    return inside_quadratures[get_slot(cell)];
+  }
+
+
+
+  template <int dim>
+  const Quadrature<dim> &
+  ImmersedQuadratureCache<dim>::get_outside_quadrature(
+    const typename Triangulation<dim>::cell_iterator &cell) const
+  {
+    return outside_quadratures[get_slot(cell)];
+  }
+
+
+
+  template <int dim>
+  const ImmersedSurfaceQuadrature<dim> &
+  ImmersedQuadratureCache<dim>::get_surface_quadrature(
+    const typename Triangulation<dim>::cell_iterator &cell) const
+  {
+    return surface_quadratures[get_slot(cell)];
+  }
+
+
+
+  template <int dim>
+  std::size_t
+  ImmersedQuadratureCache<dim>::memory_consumption() const
+  {
+    std::size_t memory = MemoryConsumption::memory_consumption(cell_to_slot) +
+                         MemoryConsumption::memory_consumption(q_indices_1D);
+    for (unsigned int i = 0; i < inside_quadratures.size(); ++i)
+      memory += inside_quadratures[i].memory_consumption() +
+                outside_quadratures[i].memory_consumption() +
+                surface_quadratures[i].memory_consumption();
+    return memory;
+  }
+
+
+
+  template <int dim>
+  unsigned int
+  ImmersedQuadratureCache<dim>::get_slot(
+    const typename Triangulation<dim>::cell_iterator &cell) const
+  {
+    Assert(triangulation != nullptr &&
+             &cell->get_triangulation() == triangulation,
+           ExcMessage("The quadrature cache has not been set up for the "
+                      "triangulation of the given cell."));
+    AssertIndexRange(cell->active_cell_index(), cell_to_slot.size());
+
+    const unsigned int slot = cell_to_slot[cell->active_cell_index()];
+    Assert(slot != numbers::invalid_unsigned_int,
+           ExcMessage("No quadratures are stored for the given cell, which "
+                      "was not classified as intersected."));
+    return slot;
+  }
+
+
+
   template <int dim>
   template <typename Number>
   FEValues<dim>::FEValues(const hp::FECollection<dim> &fe_collection,
@@ -247,15 +408,26 @@ namespace NonMatching
           }
         case LocationToLevelSet::intersected:
           {
-            quadrature_generator.set_1D_quadrature(q_index_1D);
-            quadrature_generator.generate(cell);
+            // take the quadratures from the cache if they are available
+            // there, and generate them otherwise
+            const bool use_cache =
+              quadrature_cache != nullptr &&
+              quadrature_cache->has_quadratures(cell, q_index_1D);
+            if (!use_cache)
+              {
+                quadrature_generator.set_1D_quadrature(q_index_1D);
+                quadrature_generator.generate(cell);
+              }
 
             const Quadrature<dim> &inside_quadrature =
-              quadrature_generator.get_inside_quadrature();
+              use_cache ? quadrature_cache->get_inside_quadrature(cell) :
+                          quadrature_generator.get_inside_quadrature();
             const Quadrature<dim> &outside_quadrature =
-              quadrature_generator.get_outside_quadrature();
+              use_cache ? quadrature_cache->get_outside_quadrature(cell) :
+                          quadrature_generator.get_outside_quadrature();
             const ImmersedSurfaceQuadrature<dim> &surface_quadrature =
-              quadrature_generator.get_surface_quadrature();
+              use_cache ? quadrature_cache->get_surface_quadrature(cell) :
+                          quadrature_generator.get_surface_quadrature();
 
             // Even if a cell is formally intersected the number of created
             // quadrature points can be 0. Avoid creating an FEValues object
@@ -334,6 +506,16 @@ namespace NonMatching
 
 
 
+  template <int dim>
+  void
+  FEValues<dim>::set_quadrature_cache(
+    const ImmersedQuadratureCache<dim> *quadrature_cache)
+  {
+    this->quadrature_cache = quadrature_cache;
+  }
+
+
+
   template <int dim>
   template <typename Number>
   FEInterfaceValues<dim>::FEInterfaceValues(
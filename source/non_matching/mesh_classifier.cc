@@ -469,6 +469,22 @@ namespace NonMatching
 
 
 
+  template <int dim>
+  std::vector<unsigned int>
+  MeshClassifier<dim>::get_cell_vectorization_categories() const
+  {
+    Assert(cell_locations.size() == triangulation->n_active_cells(),
+           internal::MeshClassifierImplementation::ExcReclassifyNotCalled());
+
+    std::vector<unsigned int> categories(cell_locations.size());
+    for (unsigned int i = 0; i < cell_locations.size(); ++i)
+      categories[i] = static_cast<unsigned int>(cell_locations[i]);
+
+    return categories;
+  }
+
+
+
   template <int dim>
   void
   MeshClassifier<dim>::initialize()
@@ -12,6 +12,7 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/work_stream.h>
 
 #include <deal.II/dofs/dof_accessor.h>
@@ -27,6 +28,8 @@
 
 #include <deal.II/hp/fe_values.h>
 
+#include <deal.II/lac/vector.h>
+
 #include <deal.II/numerics/data_out.h>
 
 #include <sstream>
@@ -1179,6 +1182,12 @@ DataOut<dim, spacedim>::build_patches(
   this->patches.clear();
   this->patches.resize(all_cells.size());
 
+  active_index_of_patch.resize(all_cells.size());
+  for (unsigned int i = 0; i < all_cells.size(); ++i)
+    active_index_of_patch[i] = (all_cells[i].first->is_active() ?
+                                  all_cells[i].second :
+                                  numbers::invalid_unsigned_int);
+
   // Now create a default object for the WorkStream object to work with. The
   // first step is to count how many output data sets there will be. This is,
   // in principle, just the number of components of each data set, but we
@@ -1333,6 +1342,73 @@ DataOut<dim, spacedim>::get_cell_selection() const
 
 
 
+template <int dim, int spacedim>
+void
+DataOut<dim, spacedim>::clip_patches(const BoundingBox<spacedim> &bounding_box)
+{
+  AssertDimension(active_index_of_patch.size(), this->patches.size());
+
+  const std::vector<unsigned int> kept_patches =
+    DataOutBase::clip_patches(this->patches, bounding_box);
+
+  std::vector<unsigned int> new_active_index_of_patch(kept_patches.size());
+  for (unsigned int i = 0; i < kept_patches.size(); ++i)
+    new_active_index_of_patch[i] = active_index_of_patch[kept_patches[i]];
+  active_index_of_patch.swap(new_active_index_of_patch);
+}
+
+
+
+template <int dim, int spacedim>
+void
+DataOut<dim, spacedim>::coarsen_patches(const Vector<float> &criterion,
+                                        const float          threshold,
+                                        const unsigned int   n_subdivisions)
+{
+  AssertDimension(active_index_of_patch.size(), this->patches.size());
+  AssertDimension(criterion.size(), this->triangulation->n_active_cells());
+
+  parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(this->patches.size()),
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int i = begin; i < end; ++i)
+        {
+          Assert(active_index_of_patch[i] != numbers::invalid_unsigned_int,
+                 ExcMessage("This function can only be used if the patches "
+                            "were built on active cells."));
+          if (criterion[active_index_of_patch[i]] < threshold)
+            DataOutBase::coarsen_patch(this->patches[i], n_subdivisions);
+        }
+    },
+    64);
+}
+
+
+
+template <int dim, int spacedim>
+void
+DataOut<dim, spacedim>::reduce_precision(const std::vector<std::string> &names,
+                                         const unsigned int n_mantissa_bits)
+{
+  const std::vector<std::string> dataset_names = this->get_dataset_names();
+  for (const std::string &name : names)
+    {
+      bool found = false;
+      for (unsigned int i = 0; i < dataset_names.size(); ++i)
+        if (dataset_names[i] == name)
+          {
+            DataOutBase::reduce_precision(this->patches, i, n_mantissa_bits);
+            found = true;
+          }
+      AssertThrow(found,
+                  ExcMessage("There is no data set with name <" + name +
+                             "> in this object."));
+    }
+}
+
+
+
 // explicit instantiations
 #include "data_out.inst"
 
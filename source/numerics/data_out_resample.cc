@@ -20,15 +20,174 @@
 #include <deal.II/lac/la_parallel_block_vector.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
 #include <deal.II/numerics/data_out_dof_data.templates.h>
 #include <deal.II/numerics/data_out_resample.h>
 #include <deal.II/numerics/vector_tools.h>
 
+#include <memory>
 #include <sstream>
+#include <tuple>
 
 DEAL_II_NAMESPACE_OPEN
 
 
+namespace
+{
+  /**
+   * A scalar component of a data vector to be resampled, given by the
+   * DoFHandler, the vector, and the index of the component.
+   */
+  template <int dim, int spacedim>
+  using ResampledComponent =
+    std::tuple<const DoFHandler<dim, spacedim> *,
+               const LinearAlgebra::distributed::BlockVector<double> *,
+               unsigned int>;
+
+
+
+  /**
+   * Evaluate the given components at the points of @p rpe with a single
+   * communication, returning the values with the components running
+   * fastest. The number of components needs to be known at compile time in
+   * RemotePointEvaluation::evaluate_and_process(), so it is a template
+   * argument here. Points with multiple results, i.e., on the boundary
+   * between cells, get the average.
+   */
+  template <unsigned int n_components, int dim, int spacedim>
+  std::vector<double>
+  evaluate_components(
+    const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &rpe,
+    const std::vector<ResampledComponent<dim, spacedim>>       &components)
+  {
+    AssertDimension(components.size(), n_components);
+
+    const auto evaluation_function =
+      [&](const ArrayView<double> &values,
+          const typename Utilities::MPI::RemotePointEvaluation<dim, spacedim>::
+            CellData &cell_data) {
+        std::vector<double> solution_values;
+
+        // one evaluator per component and active FE index
+        std::vector<
+          std::vector<std::unique_ptr<FEPointEvaluation<1, dim, spacedim>>>>
+          evaluators(n_components);
+
+        for (unsigned int i = 0; i < cell_data.cells.size(); ++i)
+          {
+            const ArrayView<const Point<dim>> unit_points =
+              cell_data.get_unit_points(i);
+
+            for (unsigned int c = 0; c < n_components; ++c)
+              {
+                const auto &[dof_handler, vector, component] = components[c];
+
+                const typename DoFHandler<dim, spacedim>::active_cell_iterator
+                  cell = {&rpe.get_triangulation(),
+                          cell_data.cells[i].first,
+                          cell_data.cells[i].second,
+                          dof_handler};
+
+                solution_values.resize(cell->get_fe().n_dofs_per_cell());
+                cell->get_dof_values(*vector,
+                                     solution_values.begin(),
+                                     solution_values.end());
+
+                if (evaluators[c].empty())
+                  evaluators[c].resize(dof_handler->get_fe_collection().size());
+                auto &evaluator = evaluators[c][cell->active_fe_index()];
+                if (evaluator == nullptr)
+                  evaluator =
+                    std::make_unique<FEPointEvaluation<1, dim, spacedim>>(
+                      rpe.get_mapping(),
+                      cell->get_fe(),
+                      update_values,
+                      component);
+
+                evaluator->reinit(cell, unit_points);
+                evaluator->evaluate(solution_values, EvaluationFlags::values);
+
+                for (unsigned int q = 0; q < unit_points.size(); ++q)
+                  values[(cell_data.reference_point_ptrs[i] + q) *
+                           n_components +
+                         c] = evaluator->get_value(q);
+              }
+          }
+      };
+
+    std::vector<double> results;
+    std::vector<double> buffer;
+    rpe.template evaluate_and_process<double, n_components>(
+      results, buffer, evaluation_function);
+
+    if (rpe.is_map_unique())
+      return results;
+
+    const auto         &ptr      = rpe.get_point_ptrs();
+    const unsigned int  n_points = ptr.size() - 1;
+    std::vector<double> unique_results(n_points * n_components);
+    for (unsigned int i = 0; i < n_points; ++i)
+      if (ptr[i + 1] > ptr[i])
+        for (unsigned int c = 0; c < n_components; ++c)
+          {
+            double sum = 0.;
+            for (unsigned int j = ptr[i]; j < ptr[i + 1]; ++j)
+              sum += results[j * n_components + c];
+            unique_results[i * n_components + c] = sum / (ptr[i + 1] - ptr[i]);
+          }
+
+    return unique_results;
+  }
+
+
+
+  /**
+   * Maximal number of components evaluated with one communication.
+   */
+  constexpr unsigned int max_components_per_evaluation = 8;
+
+
+
+  /**
+   * Dispatch the run-time number of components to evaluate_components().
+   */
+  template <int dim, int spacedim>
+  std::vector<double>
+  evaluate_component_batch(
+    const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &rpe,
+    const std::vector<ResampledComponent<dim, spacedim>>       &components)
+  {
+    static_assert(max_components_per_evaluation == 8,
+                  "The cases below need to match the maximal number of "
+                  "components per evaluation.");
+    switch (components.size())
+      {
+        case 1:
+          return evaluate_components<1>(rpe, components);
+        case 2:
+          return evaluate_components<2>(rpe, components);
+        case 3:
+          return evaluate_components<3>(rpe, components);
+        case 4:
+          return evaluate_components<4>(rpe, components);
+        case 5:
+          return evaluate_components<5>(rpe, components);
+        case 6:
+          return evaluate_components<6>(rpe, components);
+        case 7:
+          return evaluate_components<7>(rpe, components);
+        case 8:
+          return evaluate_components<8>(rpe, components);
+        default:
+          DEAL_II_NOT_IMPLEMENTED();
+          return {};
+      }
+  }
+} // namespace
+
+
+
 template <int dim, int patch_dim, int spacedim>
 DataOutResample<dim, patch_dim, spacedim>::DataOutResample(
   const Triangulation<patch_dim, spacedim> &patch_tria,
@@ -133,12 +292,9 @@ DataOutResample<dim, patch_dim, spacedim>::build_patches(
       update_mapping(*this->mapping, patch_dof_handler.get_fe().degree);
     }
 
-  std::vector<std::shared_ptr<LinearAlgebra::distributed::Vector<double>>>
-    vectors;
-
-  patch_data_out.attach_dof_handler(patch_dof_handler);
-
-  unsigned int counter = 0;
+  // collect all scalar components of all data vectors, which are evaluated
+  // in batches with one communication each
+  std::vector<ResampledComponent<dim, spacedim>> components;
 
   for (const auto &data : this->dof_data)
     {
@@ -161,17 +317,37 @@ DataOutResample<dim, patch_dim, spacedim>::build_patches(
 
       for (unsigned int comp = 0; comp < dh.get_fe_collection().n_components();
            ++comp)
-        {
-          const auto values = VectorTools::point_values<1>(
-            rpe, dh, data_ptr->vector, VectorTools::EvaluationFlags::avg, comp);
+        components.emplace_back(&dh, &data_ptr->vector, comp);
+    }
+
+  std::vector<std::shared_ptr<LinearAlgebra::distributed::Vector<double>>>
+    vectors;
+
+  patch_data_out.attach_dof_handler(patch_dof_handler);
 
+  for (unsigned int first = 0; first < components.size();
+       first += max_components_per_evaluation)
+    {
+      const std::vector<ResampledComponent<dim, spacedim>> batch(
+        components.begin() + first,
+        components.begin() +
+          std::min<std::size_t>(first + max_components_per_evaluation,
+                                components.size()));
+
+      const std::vector<double> values = evaluate_component_batch(rpe, batch);
+      AssertDimension(values.size(),
+                      point_to_local_vector_indices.size() * batch.size());
+
+      for (unsigned int c = 0; c < batch.size(); ++c)
+        {
           vectors.emplace_back(
             std::make_shared<LinearAlgebra::distributed::Vector<double>>(
               partitioner));
 
-          for (unsigned int j = 0; j < values.size(); ++j)
+          for (unsigned int j = 0; j < point_to_local_vector_indices.size();
+               ++j)
             vectors.back()->local_element(point_to_local_vector_indices[j]) =
-              values[j];
+              values[j * batch.size() + c];
 
           vectors.back()->set_ghost_state(true);
 
@@ -180,11 +356,9 @@ DataOutResample<dim, patch_dim, spacedim>::build_patches(
           // during the actual output to file
           patch_data_out.add_data_vector(
             *vectors.back(),
-            std::string("temp_" + std::to_string(counter)),
+            std::string("temp_" + std::to_string(vectors.size() - 1)),
             DataOut_DoFData<patch_dim, patch_dim, spacedim, spacedim>::
               DataVectorType::type_dof_data);
-
-          ++counter;
         }
     }
 
@@ -39,17 +39,170 @@ namespace DataPostprocessorInputs
         "or a related class."));
     return face_number;
   }
+
+
+
+  template <int spacedim>
+  void
+  Arrays<spacedim>::reinit(const Scalar<spacedim> &input_data,
+                           const unsigned int      n_points,
+                           const UpdateFlags       update_flags)
+  {
+    static_cast<CommonInputs<spacedim> &>(*this) = input_data;
+
+    n_evaluation_points = n_points;
+    n_components        = 1;
+
+    if (update_flags & update_values)
+      {
+        AssertDimension(input_data.solution_values.size(),
+                        n_evaluation_points);
+        solution_values = input_data.solution_values;
+      }
+
+    if (update_flags & update_gradients)
+      {
+        AssertDimension(input_data.solution_gradients.size(),
+                        n_evaluation_points);
+        solution_gradients.resize(spacedim * n_evaluation_points);
+        for (unsigned int d = 0; d < spacedim; ++d)
+          for (unsigned int q = 0; q < n_evaluation_points; ++q)
+            solution_gradients[d * n_evaluation_points + q] =
+              input_data.solution_gradients[q][d];
+      }
+
+    if (update_flags & update_hessians)
+      {
+        AssertDimension(input_data.solution_hessians.size(),
+                        n_evaluation_points);
+        solution_hessians.resize(spacedim * spacedim * n_evaluation_points);
+        for (unsigned int d1 = 0; d1 < spacedim; ++d1)
+          for (unsigned int d2 = 0; d2 < spacedim; ++d2)
+            for (unsigned int q = 0; q < n_evaluation_points; ++q)
+              solution_hessians[(d1 * spacedim + d2) * n_evaluation_points +
+                                q] = input_data.solution_hessians[q][d1][d2];
+      }
+  }
+
+
+
+  template <int spacedim>
+  void
+  Arrays<spacedim>::reinit(const Vector<spacedim> &input_data,
+                           const unsigned int      n_points,
+                           const UpdateFlags       update_flags)
+  {
+    static_cast<CommonInputs<spacedim> &>(*this) = input_data;
+
+    n_evaluation_points = n_points;
+    n_components        = 0;
+    if (n_evaluation_points > 0)
+      {
+        if (update_flags & update_values)
+          n_components = input_data.solution_values[0].size();
+        else if (update_flags & update_gradients)
+          n_components = input_data.solution_gradients[0].size();
+        else if (update_flags & update_hessians)
+          n_components = input_data.solution_hessians[0].size();
+      }
+
+    if (update_flags & update_values)
+      {
+        AssertDimension(input_data.solution_values.size(),
+                        n_evaluation_points);
+        solution_values.resize(n_components * n_evaluation_points);
+        for (unsigned int q = 0; q < n_evaluation_points; ++q)
+          {
+            AssertDimension(input_data.solution_values[q].size(),
+                            n_components);
+            for (unsigned int c = 0; c < n_components; ++c)
+              solution_values[c * n_evaluation_points + q] =
+                input_data.solution_values[q][c];
+          }
+      }
+
+    if (update_flags & update_gradients)
+      {
+        AssertDimension(input_data.solution_gradients.size(),
+                        n_evaluation_points);
+        solution_gradients.resize(n_components * spacedim *
+                                  n_evaluation_points);
+        for (unsigned int q = 0; q < n_evaluation_points; ++q)
+          {
+            AssertDimension(input_data.solution_gradients[q].size(),
+                            n_components);
+            for (unsigned int c = 0; c < n_components; ++c)
+              for (unsigned int d = 0; d < spacedim; ++d)
+                solution_gradients[(c * spacedim + d) * n_evaluation_points +
+                                   q] = input_data.solution_gradients[q][c][d];
+          }
+      }
+
+    if (update_flags & update_hessians)
+      {
+        AssertDimension(input_data.solution_hessians.size(),
+                        n_evaluation_points);
+        solution_hessians.resize(n_components * spacedim * spacedim *
+                                 n_evaluation_points);
+        for (unsigned int q = 0; q < n_evaluation_points; ++q)
+          {
+            AssertDimension(input_data.solution_hessians[q].size(),
+                            n_components);
+            for (unsigned int c = 0; c < n_components; ++c)
+              for (unsigned int d1 = 0; d1 < spacedim; ++d1)
+                for (unsigned int d2 = 0; d2 < spacedim; ++d2)
+                  solution_hessians[((c * spacedim + d1) * spacedim + d2) *
+                                      n_evaluation_points +
+                                    q] =
+                    input_data.solution_hessians[q][c][d1][d2];
+          }
+      }
+  }
 } // namespace DataPostprocessorInputs
 
+
+
+namespace
+{
+  /**
+   * Copy the quantities computed by
+   * DataPostprocessor::evaluate_field_on_arrays() into the format expected by
+   * DataPostprocessor::evaluate_scalar_field() and
+   * DataPostprocessor::evaluate_vector_field().
+   */
+  void
+  copy_computed_quantities(const Table<2, double>      &computed_arrays,
+                           std::vector<Vector<double>> &computed_quantities)
+  {
+    for (unsigned int q = 0; q < computed_quantities.size(); ++q)
+      {
+        AssertDimension(computed_quantities[q].size(),
+                        computed_arrays.size(0));
+        for (unsigned int c = 0; c < computed_arrays.size(0); ++c)
+          computed_quantities[q][c] = computed_arrays(c, q);
+      }
+  }
+} // namespace
+
 // -------------------------- DataPostprocessor ---------------------------
 
 template <int dim>
 void
 DataPostprocessor<dim>::evaluate_scalar_field(
-  const DataPostprocessorInputs::Scalar<dim> &,
-  std::vector<Vector<double>> &) const
+  const DataPostprocessorInputs::Scalar<dim> &input_data,
+  std::vector<Vector<double>>                &computed_quantities) const
 {
-  AssertThrow(false, ExcPureFunctionCalled());
+  auto &[arrays, computed_arrays] = array_scratch_data.get();
+  arrays.reinit(input_data,
+                computed_quantities.size(),
+                get_needed_update_flags());
+  computed_arrays.reinit(computed_quantities.empty() ?
+                           0 :
+                           computed_quantities[0].size(),
+                         computed_quantities.size());
+
+  evaluate_field_on_arrays(arrays, computed_arrays);
+  copy_computed_quantities(computed_arrays, computed_quantities);
 }
 
 
@@ -57,8 +210,29 @@ DataPostprocessor<dim>::evaluate_scalar_field(
 template <int dim>
 void
 DataPostprocessor<dim>::evaluate_vector_field(
-  const DataPostprocessorInputs::Vector<dim> &,
-  std::vector<Vector<double>> &) const
+  const DataPostprocessorInputs::Vector<dim> &input_data,
+  std::vector<Vector<double>>                &computed_quantities) const
+{
+  auto &[arrays, computed_arrays] = array_scratch_data.get();
+  arrays.reinit(input_data,
+                computed_quantities.size(),
+                get_needed_update_flags());
+  computed_arrays.reinit(computed_quantities.empty() ?
+                           0 :
+                           computed_quantities[0].size(),
+                         computed_quantities.size());
+
+  evaluate_field_on_arrays(arrays, computed_arrays);
+  copy_computed_quantities(computed_arrays, computed_quantities);
+}
+
+
+
+template <int dim>
+void
+DataPostprocessor<dim>::evaluate_field_on_arrays(
+  const DataPostprocessorInputs::Arrays<dim> &,
+  Table<2, double> &) const
 {
   AssertThrow(false, ExcPureFunctionCalled());
 }
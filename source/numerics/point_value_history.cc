@@ -25,6 +25,7 @@
 #include <deal.II/lac/vector_element_access.h>
 
 #include <deal.II/numerics/point_value_history.h>
+#include <deal.II/numerics/vector_tools_common.h>
 #include <deal.II/numerics/vector_tools_point_value.h>
 
 #include <algorithm>
@@ -153,6 +154,12 @@ PointValueHistory<dim>::operator=(const PointValueHistory &point_value_history)
   have_dof_handler      = point_value_history.have_dof_handler;
   n_indep               = point_value_history.n_indep;
 
+  // the cached point locations refer to the previous DoFHandler, so they
+  // are recomputed when needed
+  requested_location_data.clear();
+  remote_cells.clear();
+  remote_unit_points.clear();
+
   // What to do with tria_listener?
   // Presume subscribe new instance?
   if (have_dof_handler)
@@ -558,6 +565,10 @@ PointValueHistory<dim>::clear()
   cleared          = true;
   dof_handler      = nullptr;
   have_dof_handler = false;
+
+  requested_location_data.clear();
+  remote_cells.clear();
+  remote_unit_points.clear();
 }
 
 // Need to test that the internal data has a full and complete dataset for
@@ -705,21 +716,14 @@ PointValueHistory<dim>::evaluate_field(
   typename std::vector<
     internal::PointValueHistoryImplementation::PointGeometryData<dim>>::iterator
     point = point_geometry_data.begin();
-  Assert(!dof_handler->get_triangulation().is_mixed_mesh(),
-         ExcNotImplemented());
-  const auto reference_cell =
-    dof_handler->get_triangulation().get_reference_cells()[0];
+  update_requested_location_data();
   for (unsigned int data_store_index = 0; point != point_geometry_data.end();
        ++point, ++data_store_index)
     {
-      // we now have a point to query, need to know what cell it is in
+      // we now have a point to query, and look up the cell it is in
       const Point<dim> requested_location = point->requested_location;
       const typename DoFHandler<dim>::active_cell_iterator cell =
-        GridTools::find_active_cell_around_point(
-          reference_cell.template get_default_linear_mapping<dim, dim>(),
-          *dof_handler,
-          requested_location)
-          .first;
+        requested_location_data[data_store_index].cell;
 
 
       fe_values.reinit(cell);
@@ -926,20 +930,37 @@ PointValueHistory<dim>::evaluate_field_at_requested_location(
   unsigned int n_stored =
     mask->second.n_selected_components(dof_handler->get_fe(0).n_components());
 
-  typename std::vector<
-    internal::PointValueHistoryImplementation::PointGeometryData<dim>>::iterator
-                 point = point_geometry_data.begin();
-  Vector<number> value(dof_handler->get_fe(0).n_components());
-  for (unsigned int data_store_index = 0; point != point_geometry_data.end();
-       ++point, ++data_store_index)
+  // Locate the points and evaluate the shape functions in them once; after
+  // that, each evaluation only needs the degrees of freedom on one cell per
+  // point
+  update_requested_location_data();
+
+  const unsigned int n_components = dof_handler->get_fe(0).n_components();
+  std::vector<types::global_dof_index> dof_indices;
+  Vector<number>                       value(n_components);
+  for (unsigned int data_store_index = 0;
+       data_store_index < requested_location_data.size();
+       ++data_store_index)
     {
+      const RequestedLocationData &data =
+        requested_location_data[data_store_index];
+      AssertThrow(data.cell->is_locally_owned(),
+                  VectorTools::ExcPointNotAvailableHere());
+
       // Make a Vector <double> for the value
       // at the point. It will have as many
       // components as there are in the fe.
-      VectorTools::point_value(*dof_handler,
-                               solution,
-                               point->requested_location,
-                               value);
+      dof_indices.resize(data.fe->n_dofs_per_cell());
+      data.cell->get_dof_indices(dof_indices);
+      value = number();
+      for (unsigned int i = 0; i < dof_indices.size(); ++i)
+        {
+          const number solution_value =
+            internal::ElementAccess<VectorType>::get(solution, dof_indices[i]);
+          for (unsigned int c = 0; c < n_components; ++c)
+            value(c) +=
+              data.shape_values[i * n_components + c] * solution_value;
+        }
 
       // Look up the component_mask and add
       // in components according to that mask
@@ -958,6 +979,161 @@ PointValueHistory<dim>::evaluate_field_at_requested_location(
 }
 
 
+template <int dim>
+template <typename VectorType>
+void
+PointValueHistory<dim>::evaluate_field_at_requested_location(
+  const std::string                          &vector_name,
+  const VectorType                           &solution,
+  Utilities::MPI::RemotePointEvaluation<dim> &remote_point_evaluation)
+{
+  using number = typename VectorType::value_type;
+  // must be closed to add data to internal
+  // members.
+  Assert(closed, ExcInvalidState());
+  Assert(!cleared, ExcInvalidState());
+  AssertThrow(have_dof_handler, ExcDoFHandlerRequired());
+
+  if (n_indep != 0) // hopefully this will get optimized, can't test
+                    // independent_values[0] unless n_indep > 0
+    {
+      Assert(std::abs(static_cast<int>(dataset_key.size()) -
+                      static_cast<int>(independent_values[0].size())) < 2,
+             ExcDataLostSync());
+    }
+  typename std::map<std::string, std::vector<std::vector<double>>>::iterator
+    data_store_field = data_store.find(vector_name);
+  Assert(data_store_field != data_store.end(),
+         ExcMessage("vector_name not in class"));
+  typename std::map<std::string, ComponentMask>::iterator mask =
+    component_mask.find(vector_name);
+  Assert(mask != component_mask.end(), ExcMessage("vector_name not in class"));
+
+  const unsigned int n_components = dof_handler->get_fe(0).n_components();
+  const unsigned int n_stored =
+    mask->second.n_selected_components(n_components);
+
+  // set up the communication pattern unless the user has already done so
+  if (remote_point_evaluation.is_ready() == false)
+    {
+      std::vector<Point<dim>> locations;
+      locations.reserve(point_geometry_data.size());
+      for (const auto &point : point_geometry_data)
+        locations.push_back(point.requested_location);
+
+      Assert(!dof_handler->get_triangulation().is_mixed_mesh(),
+             ExcNotImplemented());
+      remote_point_evaluation.reinit(
+        locations,
+        dof_handler->get_triangulation(),
+        dof_handler->get_triangulation()
+          .get_reference_cells()[0]
+          .template get_default_linear_mapping<dim, dim>());
+    }
+  AssertThrow(remote_point_evaluation.all_points_found(),
+              ExcMessage("Not all requested locations could be found in the "
+                         "triangulation."));
+
+  const std::vector<unsigned int> &point_ptrs =
+    remote_point_evaluation.get_point_ptrs();
+  AssertDimension(point_ptrs.size(), point_geometry_data.size() + 1);
+
+  // compute the values of the shape functions in the points located on the
+  // current process, unless they are still available from a previous call
+  // with the same cells and reference points
+  const auto &cell_data = remote_point_evaluation.get_cell_data();
+  if (cell_data.cells != remote_cells ||
+      cell_data.reference_point_values != remote_unit_points)
+    {
+      remote_cells       = cell_data.cells;
+      remote_unit_points = cell_data.reference_point_values;
+      remote_shape_value_ptrs.assign(1, 0);
+      remote_shape_values.clear();
+
+      for (const unsigned int c : cell_data.cell_indices())
+        {
+          const auto cell =
+            cell_data.get_active_cell_iterator(c)->as_dof_handler_iterator(
+              *dof_handler);
+          const ArrayView<const Point<dim>> unit_points =
+            cell_data.get_unit_points(c);
+          const FiniteElement<dim> &fe = cell->get_fe();
+
+          FEValues<dim> fe_values(remote_point_evaluation.get_mapping(),
+                                  fe,
+                                  Quadrature<dim>(std::vector<Point<dim>>(
+                                    unit_points.begin(), unit_points.end())),
+                                  update_values);
+          fe_values.reinit(cell);
+          for (unsigned int q = 0; q < unit_points.size(); ++q)
+            {
+              for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+                for (unsigned int d = 0; d < n_components; ++d)
+                  remote_shape_values.push_back(
+                    fe_values.shape_value_component(i, q, d));
+              remote_shape_value_ptrs.push_back(remote_shape_values.size());
+            }
+        }
+    }
+
+  std::vector<types::global_dof_index> dof_indices;
+  const std::vector<std::vector<number>> values =
+    remote_point_evaluation.template evaluate_and_process<std::vector<number>>(
+      [&](const ArrayView<std::vector<number>> &values,
+          const typename Utilities::MPI::RemotePointEvaluation<dim>::CellData
+            &cell_data) {
+        for (const unsigned int c : cell_data.cell_indices())
+          {
+            const auto cell =
+              cell_data.get_active_cell_iterator(c)->as_dof_handler_iterator(
+                *dof_handler);
+            dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+            cell->get_dof_indices(dof_indices);
+
+            for (unsigned int q = cell_data.reference_point_ptrs[c];
+                 q < cell_data.reference_point_ptrs[c + 1];
+                 ++q)
+              {
+                const double *shape_values =
+                  remote_shape_values.data() + remote_shape_value_ptrs[q];
+                values[q].assign(n_components, number());
+                for (unsigned int i = 0; i < dof_indices.size(); ++i)
+                  {
+                    const number solution_value =
+                      internal::ElementAccess<VectorType>::get(solution,
+                                                               dof_indices[i]);
+                    for (unsigned int d = 0; d < n_components; ++d)
+                      values[q][d] +=
+                        shape_values[i * n_components + d] * solution_value;
+                  }
+              }
+          }
+      });
+
+  for (unsigned int data_store_index = 0;
+       data_store_index < point_geometry_data.size();
+       ++data_store_index)
+    {
+      // for points on the boundary between cells, several values are
+      // returned, which all coincide for continuous fields; take the first
+      const std::vector<number> &value = values[point_ptrs[data_store_index]];
+
+      for (unsigned int store_index = 0, comp = 0; comp < mask->second.size();
+           comp++)
+        {
+          if (mask->second[comp])
+            {
+              data_store_field
+                ->second[data_store_index * n_stored + store_index]
+                .push_back(value[comp]);
+              ++store_index;
+            }
+        }
+    }
+}
+
+
+
 template <int dim>
 void
 PointValueHistory<dim>::start_new_dataset(double key)
@@ -1498,6 +1674,59 @@ PointValueHistory<dim>::tria_change_listener()
   // this into account next time we
   // evaluate the solution
   triangulation_changed = true;
+
+  // the cells found for the requested locations are not valid any more
+  requested_location_data.clear();
+  remote_cells.clear();
+  remote_unit_points.clear();
+}
+
+
+
+template <int dim>
+void
+PointValueHistory<dim>::update_requested_location_data()
+{
+  Assert(!dof_handler->get_triangulation().is_mixed_mesh(),
+         ExcNotImplemented());
+  const Mapping<dim> &mapping =
+    dof_handler->get_triangulation()
+      .get_reference_cells()[0]
+      .template get_default_linear_mapping<dim, dim>();
+  const unsigned int n_components = dof_handler->get_fe(0).n_components();
+
+  if (requested_location_data.size() != point_geometry_data.size())
+    {
+      requested_location_data.clear();
+      requested_location_data.reserve(point_geometry_data.size());
+      for (const auto &point : point_geometry_data)
+        {
+          const auto cell_and_point = GridTools::find_active_cell_around_point(
+            mapping, *dof_handler, point.requested_location);
+          requested_location_data.push_back(
+            {cell_and_point.first, cell_and_point.second, nullptr, {}});
+        }
+    }
+
+  // (re-)compute the shape values on locally owned cells whose element is
+  // not the one the cached values were computed for, e.g. on first use or
+  // after a change of the active FE index
+  for (RequestedLocationData &data : requested_location_data)
+    if (data.cell->is_locally_owned() && data.fe != &data.cell->get_fe())
+      {
+        data.fe = &data.cell->get_fe();
+
+        FEValues<dim> fe_values(mapping,
+                                *data.fe,
+                                Quadrature<dim>(data.unit_point),
+                                update_values);
+        fe_values.reinit(data.cell);
+        data.shape_values.resize(data.fe->n_dofs_per_cell() * n_components);
+        for (unsigned int i = 0; i < data.fe->n_dofs_per_cell(); ++i)
+          for (unsigned int c = 0; c < n_components; ++c)
+            data.shape_values[i * n_components + c] =
+              fe_values.shape_value_component(i, 0, c);
+      }
 }
 
 
@@ -12,6 +12,7 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/signaling_nan.h>
 
@@ -24,6 +25,7 @@
 #include <deal.II/hp/q_collection.h>
 
 #include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/la_parallel_block_vector.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/petsc_block_vector.h>
@@ -39,6 +41,7 @@
 #include <cmath>
 #include <limits>
 #include <utility>
+#include <vector>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -60,6 +63,110 @@ namespace SmoothnessEstimator
         size[d] = N;
       coeff.reinit(size);
     }
+
+
+
+    /**
+     * Compute the expansion coefficients with @p fe_series on all locally
+     * owned cells, or only on those flagged for refinement or coarsening if
+     * @p only_flagged_cells is set, and store the value returned by
+     * @p compute_indicator for these coefficients as the smoothness indicator
+     * of the cell. All other cells receive a signaling NaN.
+     *
+     * The cells are grouped by their active FE index, such that the
+     * expansion coefficients of many cells are computed by a single
+     * matrix-matrix product. The evaluation of the indicators, which involves
+     * the regression on the coefficients, then runs in parallel. To this end,
+     * @p compute_indicator needs to be callable from several threads
+     * concurrently.
+     */
+    template <int dim,
+              int spacedim,
+              typename VectorType,
+              typename FESeriesType,
+              typename IndicatorFunction>
+    void
+    compute_smoothness_indicators(
+      FESeriesType                    &fe_series,
+      const DoFHandler<dim, spacedim> &dof_handler,
+      const VectorType                &solution,
+      Vector<float>                   &smoothness_indicators,
+      const bool                       only_flagged_cells,
+      const IndicatorFunction         &compute_indicator)
+    {
+      using number       = typename VectorType::value_type;
+      using number_coeff = typename FESeriesType::CoefficientType;
+      using cell_iterator =
+        typename DoFHandler<dim, spacedim>::active_cell_iterator;
+
+      smoothness_indicators.reinit(
+        dof_handler.get_triangulation().n_active_cells());
+
+      std::vector<std::vector<cell_iterator>> cells_per_fe_index(
+        dof_handler.get_fe_collection().size());
+      for (const auto &cell : dof_handler.active_cell_iterators() |
+                                IteratorFilters::LocallyOwnedCell())
+        if (!only_flagged_cells || cell->refine_flag_set() ||
+            cell->coarsen_flag_set())
+          cells_per_fe_index[cell->active_fe_index()].push_back(cell);
+        else
+          smoothness_indicators(cell->active_cell_index()) =
+            numbers::signaling_nan<float>();
+
+      // work on chunks of cells to limit the size of the temporary matrices
+      constexpr unsigned int chunk_size = 512;
+
+      Vector<number>           local_dof_values;
+      FullMatrix<number>       dof_values;
+      FullMatrix<number_coeff> coefficients;
+      for (unsigned int fe_index = 0; fe_index < cells_per_fe_index.size();
+           ++fe_index)
+        {
+          const std::vector<cell_iterator> &cells =
+            cells_per_fe_index[fe_index];
+          const unsigned int n_dofs =
+            dof_handler.get_fe(fe_index).n_dofs_per_cell();
+          const unsigned int n_modes =
+            fe_series.get_n_coefficients_per_direction(fe_index);
+
+          local_dof_values.reinit(n_dofs);
+          for (unsigned int begin = 0; begin < cells.size();
+               begin += chunk_size)
+            {
+              const unsigned int end =
+                std::min<unsigned int>(begin + chunk_size, cells.size());
+
+              // Collect the local degrees of freedom of all cells of the
+              // chunk, one cell per row. This is done serially, since not
+              // all vector classes allow concurrent read access.
+              dof_values.reinit(end - begin, n_dofs);
+              for (unsigned int c = begin; c < end; ++c)
+                {
+                  cells[c]->get_dof_values(solution, local_dof_values);
+                  for (unsigned int i = 0; i < n_dofs; ++i)
+                    dof_values(c - begin, i) = local_dof_values(i);
+                }
+
+              fe_series.calculate(dof_values, fe_index, coefficients);
+
+              parallel::apply_to_subranges(
+                begin,
+                end,
+                [&](const unsigned int range_begin,
+                    const unsigned int range_end) {
+                  Table<dim, number_coeff> expansion_coefficients;
+                  resize(expansion_coefficients, n_modes);
+                  for (unsigned int c = range_begin; c < range_end; ++c)
+                    {
+                      expansion_coefficients.fill(&coefficients(c - begin, 0));
+                      smoothness_indicators(cells[c]->active_cell_index()) =
+                        compute_indicator(cells[c], expansion_coefficients);
+                    }
+                },
+                32);
+            }
+        }
+    }
   } // namespace
 
 
@@ -106,72 +213,54 @@ namespace SmoothnessEstimator
                       const double smallest_abs_coefficient,
                       const bool   only_flagged_cells)
     {
-      using number = typename VectorType::value_type;
       using number_coeff =
         typename FESeries::Legendre<dim, spacedim>::CoefficientType;
 
-      smoothness_indicators.reinit(
-        dof_handler.get_triangulation().n_active_cells());
-
-      unsigned int             n_modes;
-      Table<dim, number_coeff> expansion_coefficients;
-
-      Vector<number>      local_dof_values;
-      std::vector<double> converted_indices;
-      std::pair<std::vector<unsigned int>, std::vector<double>> res;
-      for (const auto &cell : dof_handler.active_cell_iterators() |
-                                IteratorFilters::LocallyOwnedCell())
-        {
-          if (!only_flagged_cells || cell->refine_flag_set() ||
-              cell->coarsen_flag_set())
+      compute_smoothness_indicators(
+        fe_legendre,
+        dof_handler,
+        solution,
+        smoothness_indicators,
+        only_flagged_cells,
+        [&](const auto                     &cell,
+            const Table<dim, number_coeff> &expansion_coefficients) {
+          const unsigned int n_modes =
+            fe_legendre.get_n_coefficients_per_direction(
+              cell->active_fe_index());
+
+          // We fit our exponential decay of expansion coefficients to the
+          // provided regression_strategy on each possible value of |k|. To
+          // this end, we use FESeries::process_coefficients() to rework
+          // coefficients into the desired format.
+          std::pair<std::vector<unsigned int>, std::vector<double>> res =
+            FESeries::process_coefficients<dim>(
+              expansion_coefficients,
+              [n_modes](const TableIndices<dim> &indices) {
+                return index_sum_less_than_N(indices, n_modes);
+              },
+              regression_strategy,
+              smallest_abs_coefficient);
+
+          Assert(res.first.size() == res.second.size(), ExcInternalError());
+
+          // Last, do the linear regression.
+          float regularity = std::numeric_limits<float>::infinity();
+          if (res.first.size() > 1)
             {
-              n_modes = fe_legendre.get_n_coefficients_per_direction(
-                cell->active_fe_index());
-              resize(expansion_coefficients, n_modes);
-
-              local_dof_values.reinit(cell->get_fe().n_dofs_per_cell());
-              cell->get_dof_values(solution, local_dof_values);
-
-              fe_legendre.calculate(local_dof_values,
-                                    cell->active_fe_index(),
-                                    expansion_coefficients);
-
-              // We fit our exponential decay of expansion coefficients to the
-              // provided regression_strategy on each possible value of |k|.
-              // To this end, we use FESeries::process_coefficients() to
-              // rework coefficients into the desired format.
-              res = FESeries::process_coefficients<dim>(
-                expansion_coefficients,
-                [n_modes](const TableIndices<dim> &indices) {
-                  return index_sum_less_than_N(indices, n_modes);
-                },
-                regression_strategy,
-                smallest_abs_coefficient);
-
-              Assert(res.first.size() == res.second.size(), ExcInternalError());
-
-              // Last, do the linear regression.
-              float regularity = std::numeric_limits<float>::infinity();
-              if (res.first.size() > 1)
-                {
-                  // Prepare linear equation for the logarithmic least squares
-                  // fit.
-                  converted_indices.assign(res.first.begin(), res.first.end());
+              // Prepare linear equation for the logarithmic least squares fit.
+              const std::vector<double> converted_indices(res.first.begin(),
+                                                          res.first.end());
 
-                  for (auto &residual_element : res.second)
-                    residual_element = std::log(residual_element);
+              for (auto &residual_element : res.second)
+                residual_element = std::log(residual_element);
 
-                  const std::pair<double, double> fit =
-                    FESeries::linear_regression(converted_indices, res.second);
-                  regularity = static_cast<float>(-fit.first);
-                }
-
-              smoothness_indicators(cell->active_cell_index()) = regularity;
+              const std::pair<double, double> fit =
+                FESeries::linear_regression(converted_indices, res.second);
+              regularity = static_cast<float>(-fit.first);
             }
-          else
-            smoothness_indicators(cell->active_cell_index()) =
-              numbers::signaling_nan<float>();
-        }
+
+          return regularity;
+        });
     }
 
 
@@ -190,95 +279,72 @@ namespace SmoothnessEstimator
       Assert(smallest_abs_coefficient >= 0.,
              ExcMessage("smallest_abs_coefficient should be non-negative."));
 
-      using number = typename VectorType::value_type;
       using number_coeff =
         typename FESeries::Legendre<dim, spacedim>::CoefficientType;
 
-      smoothness_indicators.reinit(
-        dof_handler.get_triangulation().n_active_cells());
-
-      unsigned int             n_modes;
-      Table<dim, number_coeff> expansion_coefficients;
-      Vector<number>           local_dof_values;
-
-      // auxiliary vector to do linear regression
-      const unsigned int max_degree =
-        dof_handler.get_fe_collection().max_degree();
-
-      std::vector<double> x, y;
-      x.reserve(max_degree);
-      y.reserve(max_degree);
-
-      for (const auto &cell : dof_handler.active_cell_iterators() |
-                                IteratorFilters::LocallyOwnedCell())
-        {
-          if (!only_flagged_cells || cell->refine_flag_set() ||
-              cell->coarsen_flag_set())
+      compute_smoothness_indicators(
+        fe_legendre,
+        dof_handler,
+        solution,
+        smoothness_indicators,
+        only_flagged_cells,
+        [&](const auto                     &cell,
+            const Table<dim, number_coeff> &expansion_coefficients) {
+          const unsigned int pe = cell->get_fe().degree;
+          Assert(pe > 0, ExcInternalError());
+
+          // since we use coefficients with indices [1,pe] in each direction,
+          // the number of coefficients we need to calculate is at least
+          // N=pe+1
+          AssertIndexRange(pe,
+                           fe_legendre.get_n_coefficients_per_direction(
+                             cell->active_fe_index()));
+
+          // auxiliary vectors to do linear regression
+          std::vector<double> x, y;
+          x.reserve(pe + 1);
+          y.reserve(pe + 1);
+
+          // choose the smallest decay of coefficients in each direction,
+          // i.e. the maximum decay slope k_v as in exp(-k_v)
+          double k_v = std::numeric_limits<double>::infinity();
+          for (unsigned int d = 0; d < dim; ++d)
             {
-              n_modes = fe_legendre.get_n_coefficients_per_direction(
-                cell->active_fe_index());
-              resize(expansion_coefficients, n_modes);
-
-              const unsigned int pe = cell->get_fe().degree;
-              Assert(pe > 0, ExcInternalError());
-
-              // since we use coefficients with indices [1,pe] in each
-              // direction, the number of coefficients we need to calculate is
-              // at least N=pe+1
-              AssertIndexRange(pe, n_modes);
-
-              local_dof_values.reinit(cell->get_fe().n_dofs_per_cell());
-              cell->get_dof_values(solution, local_dof_values);
-
-              fe_legendre.calculate(local_dof_values,
-                                    cell->active_fe_index(),
-                                    expansion_coefficients);
-
-              // choose the smallest decay of coefficients in each direction,
-              // i.e. the maximum decay slope k_v as in exp(-k_v)
-              double k_v = std::numeric_limits<double>::infinity();
-              for (unsigned int d = 0; d < dim; ++d)
-                {
-                  x.resize(0);
-                  y.resize(0);
-
-                  // will use all non-zero coefficients allowed by the
-                  // predicate function
-                  for (unsigned int i = 0; i <= pe; ++i)
-                    if (coefficients_predicate[i])
+              x.resize(0);
+              y.resize(0);
+
+              // will use all non-zero coefficients allowed by the predicate
+              // function
+              for (unsigned int i = 0; i <= pe; ++i)
+                if (coefficients_predicate[i])
+                  {
+                    TableIndices<dim> ind;
+                    ind[d] = i;
+                    const double coeff_abs =
+                      std::abs(expansion_coefficients(ind));
+
+                    if (coeff_abs > smallest_abs_coefficient)
                       {
-                        TableIndices<dim> ind;
-                        ind[d] = i;
-                        const double coeff_abs =
-                          std::abs(expansion_coefficients(ind));
-
-                        if (coeff_abs > smallest_abs_coefficient)
-                          {
-                            x.push_back(i);
-                            y.push_back(std::log(coeff_abs));
-                          }
+                        x.push_back(i);
+                        y.push_back(std::log(coeff_abs));
                       }
+                  }
 
-                  // in case we don't have enough non-zero coefficient to fit,
-                  // skip this direction
-                  if (x.size() < 2)
-                    continue;
+              // in case we don't have enough non-zero coefficient to fit,
+              // skip this direction
+              if (x.size() < 2)
+                continue;
 
-                  const std::pair<double, double> fit =
-                    FESeries::linear_regression(x, y);
+              const std::pair<double, double> fit =
+                FESeries::linear_regression(x, y);
 
-                  // decay corresponds to negative slope
-                  // take the lesser negative slope along each direction
-                  k_v = std::min(k_v, -fit.first);
-                }
-
-              smoothness_indicators(cell->active_cell_index()) =
-                static_cast<float>(k_v);
+              // decay corresponds to negative slope
+              // take the lesser negative slope along each direction
+              k_v = std::min(k_v, -fit.first);
             }
-          else
-            smoothness_indicators(cell->active_cell_index()) =
-              numbers::signaling_nan<float>();
-        }
+
+          return static_cast<float>(k_v);
+        });
     }
 
 
@@ -373,90 +439,66 @@ namespace SmoothnessEstimator
                       const double smallest_abs_coefficient,
                       const bool   only_flagged_cells)
     {
-      using number = typename VectorType::value_type;
       using number_coeff =
         typename FESeries::Fourier<dim, spacedim>::CoefficientType;
 
-      smoothness_indicators.reinit(
-        dof_handler.get_triangulation().n_active_cells());
-
-      unsigned int             n_modes;
-      Table<dim, number_coeff> expansion_coefficients;
-
-      Vector<number>      local_dof_values;
-      std::vector<double> ln_k;
-      std::pair<std::vector<unsigned int>, std::vector<double>> res;
-      for (const auto &cell : dof_handler.active_cell_iterators() |
-                                IteratorFilters::LocallyOwnedCell())
-        {
-          if (!only_flagged_cells || cell->refine_flag_set() ||
-              cell->coarsen_flag_set())
+      compute_smoothness_indicators(
+        fe_fourier,
+        dof_handler,
+        solution,
+        smoothness_indicators,
+        only_flagged_cells,
+        [&](const auto                     &cell,
+            const Table<dim, number_coeff> &expansion_coefficients) {
+          const unsigned int n_modes =
+            fe_fourier.get_n_coefficients_per_direction(
+              cell->active_fe_index());
+
+          // We fit our exponential decay of expansion coefficients to the
+          // provided regression_strategy on each possible value of |k|. To
+          // this end, we use FESeries::process_coefficients() to rework
+          // coefficients into the desired format.
+          std::pair<std::vector<unsigned int>, std::vector<double>> res =
+            FESeries::process_coefficients<dim>(
+              expansion_coefficients,
+              [n_modes](const TableIndices<dim> &indices) {
+                return index_norm_greater_than_zero_and_less_than_N_squared(
+                  indices, n_modes);
+              },
+              regression_strategy,
+              smallest_abs_coefficient);
+
+          Assert(res.first.size() == res.second.size(), ExcInternalError());
+
+          // Last, do the linear regression.
+          float regularity = std::numeric_limits<float>::infinity();
+          if (res.first.size() > 1)
             {
-              n_modes = fe_fourier.get_n_coefficients_per_direction(
-                cell->active_fe_index());
-              resize(expansion_coefficients, n_modes);
-
-              // Inside the loop, we first need to get the values of the local
-              // degrees of freedom and then need to compute the series
-              // expansion by multiplying this vector with the matrix ${\cal
-              // F}$ corresponding to this finite element.
-              local_dof_values.reinit(cell->get_fe().n_dofs_per_cell());
-              cell->get_dof_values(solution, local_dof_values);
-
-              fe_fourier.calculate(local_dof_values,
-                                   cell->active_fe_index(),
-                                   expansion_coefficients);
-
-              // We fit our exponential decay of expansion coefficients to the
-              // provided regression_strategy on each possible value of |k|.
-              // To this end, we use FESeries::process_coefficients() to
-              // rework coefficients into the desired format.
-              res = FESeries::process_coefficients<dim>(
-                expansion_coefficients,
-                [n_modes](const TableIndices<dim> &indices) {
-                  return index_norm_greater_than_zero_and_less_than_N_squared(
-                    indices, n_modes);
-                },
-                regression_strategy,
-                smallest_abs_coefficient);
-
-              Assert(res.first.size() == res.second.size(), ExcInternalError());
-
-              // Last, do the linear regression.
-              float regularity = std::numeric_limits<float>::infinity();
-              if (res.first.size() > 1)
-                {
-                  // Prepare linear equation for the logarithmic least squares
-                  // fit.
-                  //
-                  // First, calculate ln(|k|).
-                  //
-                  // For Fourier expansion, this translates to
-                  // ln(2*pi*sqrt(predicate)) = ln(2*pi) + 0.5*ln(predicate).
-                  // Since we are just interested in the slope of a linear
-                  // regression later, we omit the ln(2*pi) factor.
-                  ln_k.resize(res.first.size());
-                  for (unsigned int f = 0; f < res.first.size(); ++f)
-                    ln_k[f] = 0.5 * std::log(static_cast<double>(res.first[f]));
-
-                  // Second, calculate ln(U_k).
-                  for (auto &residual_element : res.second)
-                    residual_element = std::log(residual_element);
-
-                  const std::pair<double, double> fit =
-                    FESeries::linear_regression(ln_k, res.second);
-                  // Compute regularity s = mu - dim/2
-                  regularity = static_cast<float>(-fit.first) -
-                               ((dim > 1) ? (.5 * dim) : 0);
-                }
-
-              // Store result in the vector of estimated values for each cell.
-              smoothness_indicators(cell->active_cell_index()) = regularity;
+              // Prepare linear equation for the logarithmic least squares fit.
+              //
+              // First, calculate ln(|k|).
+              //
+              // For Fourier expansion, this translates to
+              // ln(2*pi*sqrt(predicate)) = ln(2*pi) + 0.5*ln(predicate).
+              // Since we are just interested in the slope of a linear
+              // regression later, we omit the ln(2*pi) factor.
+              std::vector<double> ln_k(res.first.size());
+              for (unsigned int f = 0; f < res.first.size(); ++f)
+                ln_k[f] = 0.5 * std::log(static_cast<double>(res.first[f]));
+
+              // Second, calculate ln(U_k).
+              for (auto &residual_element : res.second)
+                residual_element = std::log(residual_element);
+
+              const std::pair<double, double> fit =
+                FESeries::linear_regression(ln_k, res.second);
+              // Compute regularity s = mu - dim/2
+              regularity = static_cast<float>(-fit.first) -
+                           ((dim > 1) ? (.5 * dim) : 0);
             }
-          else
-            smoothness_indicators(cell->active_cell_index()) =
-              numbers::signaling_nan<float>();
-        }
+
+          return regularity;
+        });
     }
 
 
@@ -475,97 +517,74 @@ namespace SmoothnessEstimator
       Assert(smallest_abs_coefficient >= 0.,
              ExcMessage("smallest_abs_coefficient should be non-negative."));
 
-      using number = typename VectorType::value_type;
       using number_coeff =
         typename FESeries::Fourier<dim, spacedim>::CoefficientType;
 
-      smoothness_indicators.reinit(
-        dof_handler.get_triangulation().n_active_cells());
-
-      unsigned int             n_modes;
-      Table<dim, number_coeff> expansion_coefficients;
-      Vector<number>           local_dof_values;
-
-      // auxiliary vector to do linear regression
-      const unsigned int max_degree =
-        dof_handler.get_fe_collection().max_degree();
-
-      std::vector<double> x, y;
-      x.reserve(max_degree);
-      y.reserve(max_degree);
-
-      for (const auto &cell : dof_handler.active_cell_iterators() |
-                                IteratorFilters::LocallyOwnedCell())
-        {
-          if (!only_flagged_cells || cell->refine_flag_set() ||
-              cell->coarsen_flag_set())
+      compute_smoothness_indicators(
+        fe_fourier,
+        dof_handler,
+        solution,
+        smoothness_indicators,
+        only_flagged_cells,
+        [&](const auto                     &cell,
+            const Table<dim, number_coeff> &expansion_coefficients) {
+          const unsigned int pe = cell->get_fe().degree;
+          Assert(pe > 0, ExcInternalError());
+
+          // since we use coefficients with indices [1,pe] in each direction,
+          // the number of coefficients we need to calculate is at least
+          // N=pe+1
+          AssertIndexRange(pe,
+                           fe_fourier.get_n_coefficients_per_direction(
+                             cell->active_fe_index()));
+
+          // auxiliary vectors to do linear regression
+          std::vector<double> x, y;
+          x.reserve(pe + 1);
+          y.reserve(pe + 1);
+
+          // choose the smallest decay of coefficients in each direction,
+          // i.e. the maximum decay slope k_v as in exp(-k_v)
+          double k_v = std::numeric_limits<double>::infinity();
+          for (unsigned int d = 0; d < dim; ++d)
             {
-              n_modes = fe_fourier.get_n_coefficients_per_direction(
-                cell->active_fe_index());
-              resize(expansion_coefficients, n_modes);
-
-              const unsigned int pe = cell->get_fe().degree;
-              Assert(pe > 0, ExcInternalError());
-
-              // since we use coefficients with indices [1,pe] in each
-              // direction, the number of coefficients we need to calculate is
-              // at least N=pe+1
-              AssertIndexRange(pe, n_modes);
-
-              local_dof_values.reinit(cell->get_fe().n_dofs_per_cell());
-              cell->get_dof_values(solution, local_dof_values);
-
-              fe_fourier.calculate(local_dof_values,
-                                   cell->active_fe_index(),
-                                   expansion_coefficients);
-
-              // choose the smallest decay of coefficients in each direction,
-              // i.e. the maximum decay slope k_v as in exp(-k_v)
-              double k_v = std::numeric_limits<double>::infinity();
-              for (unsigned int d = 0; d < dim; ++d)
-                {
-                  x.resize(0);
-                  y.resize(0);
-
-                  // will use all non-zero coefficients allowed by the
-                  // predicate function
-                  //
-                  // skip i=0 because of logarithm
-                  for (unsigned int i = 1; i <= pe; ++i)
-                    if (coefficients_predicate[i])
+              x.resize(0);
+              y.resize(0);
+
+              // will use all non-zero coefficients allowed by the predicate
+              // function
+              //
+              // skip i=0 because of logarithm
+              for (unsigned int i = 1; i <= pe; ++i)
+                if (coefficients_predicate[i])
+                  {
+                    TableIndices<dim> ind;
+                    ind[d] = i;
+                    const double coeff_abs =
+                      std::abs(expansion_coefficients(ind));
+
+                    if (coeff_abs > smallest_abs_coefficient)
                       {
-                        TableIndices<dim> ind;
-                        ind[d] = i;
-                        const double coeff_abs =
-                          std::abs(expansion_coefficients(ind));
-
-                        if (coeff_abs > smallest_abs_coefficient)
-                          {
-                            x.push_back(std::log(i));
-                            y.push_back(std::log(coeff_abs));
-                          }
+                        x.push_back(std::log(i));
+                        y.push_back(std::log(coeff_abs));
                       }
+                  }
 
-                  // in case we don't have enough non-zero coefficient to fit,
-                  // skip this direction
-                  if (x.size() < 2)
-                    continue;
-
-                  const std::pair<double, double> fit =
-                    FESeries::linear_regression(x, y);
+              // in case we don't have enough non-zero coefficient to fit,
+              // skip this direction
+              if (x.size() < 2)
+                continue;
 
-                  // decay corresponds to negative slope
-                  // take the lesser negative slope along each direction
-                  k_v = std::min(k_v, -fit.first);
-                }
+              const std::pair<double, double> fit =
+                FESeries::linear_regression(x, y);
 
-              smoothness_indicators(cell->active_cell_index()) =
-                static_cast<float>(k_v);
+              // decay corresponds to negative slope
+              // take the lesser negative slope along each direction
+              k_v = std::min(k_v, -fit.first);
             }
-          else
-            smoothness_indicators(cell->active_cell_index()) =
-              numbers::signaling_nan<float>();
-        }
+
+          return static_cast<float>(k_v);
+        });
     }
 
 
@@ -50,63 +50,21 @@ DEAL_II_NAMESPACE_OPEN
 namespace
 {
   /**
-   * Optimized pack function for values assigned on degrees of freedom.
+   * Return the number of bytes that the values of one vector on one cell
+   * occupy in the buffers used for transferring data between meshes.
    *
-   * Given that the elements of @p dof_values are stored in consecutive
-   * locations, we can just memcpy them. Since floating point values don't
-   * compress well, we also waive the compression that the default
-   * Utilities::pack() and Utilities::unpack() functions offer.
+   * Given that the elements of the local vectors are stored in consecutive
+   * locations, we can just memcpy them into and out of one contiguous buffer
+   * per cell that holds the values of all vectors one after the other. Since
+   * floating point values don't compress well, we also waive the compression
+   * that the default Utilities::pack() and Utilities::unpack() functions
+   * offer.
    */
   template <typename value_type>
-  std::vector<char>
-  pack_dof_values(std::vector<Vector<value_type>> &dof_values,
-                  const unsigned int               dofs_per_cell)
+  std::size_t
+  bytes_per_dof_values(const unsigned int dofs_per_cell)
   {
-    for (const auto &values : dof_values)
-      {
-        AssertDimension(values.size(), dofs_per_cell);
-        (void)values;
-      }
-
-    const std::size_t bytes_per_entry = sizeof(value_type) * dofs_per_cell;
-
-    std::vector<char> buffer(dof_values.size() * bytes_per_entry);
-    for (unsigned int i = 0; i < dof_values.size(); ++i)
-      std::memcpy(&buffer[i * bytes_per_entry],
-                  &dof_values[i](0),
-                  bytes_per_entry);
-
-    return buffer;
-  }
-
-
-
-  /**
-   * Optimized unpack function for values assigned on degrees of freedom.
-   */
-  template <typename value_type>
-  std::vector<Vector<value_type>>
-  unpack_dof_values(
-    const boost::iterator_range<std::vector<char>::const_iterator> &data_range,
-    const unsigned int dofs_per_cell)
-  {
-    const std::size_t  bytes_per_entry = sizeof(value_type) * dofs_per_cell;
-    const unsigned int n_elements      = data_range.size() / bytes_per_entry;
-
-    Assert((data_range.size() % bytes_per_entry == 0), ExcInternalError());
-
-    std::vector<Vector<value_type>> unpacked_data;
-    unpacked_data.reserve(n_elements);
-    for (unsigned int i = 0; i < n_elements; ++i)
-      {
-        Vector<value_type> dof_values(dofs_per_cell);
-        std::memcpy(&dof_values(0),
-                    &(*std::next(data_range.begin(), i * bytes_per_entry)),
-                    bytes_per_entry);
-        unpacked_data.emplace_back(std::move(dof_values));
-      }
-
-    return unpacked_data;
+    return sizeof(value_type) * dofs_per_cell;
   }
 } // namespace
 
@@ -344,9 +302,7 @@ SolutionTransfer<dim, VectorType, spacedim>::pack_callback(
 {
   typename DoFHandler<dim, spacedim>::cell_iterator cell(*cell_, dof_handler);
 
-  // create buffer for each individual object
-  std::vector<::dealii::Vector<typename VectorType::value_type>> dof_values(
-    input_vectors.size());
+  using Number = typename VectorType::value_type;
 
   unsigned int fe_index = 0;
   if (dof_handler->has_hp_capabilities())
@@ -389,16 +345,25 @@ SolutionTransfer<dim, VectorType, spacedim>::pack_callback(
   if (dofs_per_cell == 0)
     return std::vector<char>(); // nothing to do for FE_Nothing
 
-  auto it_input  = input_vectors.cbegin();
-  auto it_output = dof_values.begin();
-  for (; it_input != input_vectors.cend(); ++it_input, ++it_output)
+  // interpolate the values of all vectors into one scratch vector after
+  // the other and copy them into the buffer directly, without creating
+  // intermediate objects for every vector
+  const std::size_t bytes_per_entry =
+    bytes_per_dof_values<Number>(dofs_per_cell);
+
+  std::vector<char>        buffer(input_vectors.size() * bytes_per_entry);
+  ::dealii::Vector<Number> dof_values(dofs_per_cell);
+  for (unsigned int i = 0; i < input_vectors.size(); ++i)
     {
-      it_output->reinit(dofs_per_cell);
-      cell->get_interpolated_dof_values(*(*it_input), *it_output, fe_index);
+      cell->get_interpolated_dof_values(*input_vectors[i],
+                                        dof_values,
+                                        fe_index);
+      std::memcpy(&buffer[i * bytes_per_entry],
+                  dof_values.begin(),
+                  bytes_per_entry);
     }
 
-  return pack_dof_values<typename VectorType::value_type>(dof_values,
-                                                          dofs_per_cell);
+  return buffer;
 }
 
 
@@ -454,38 +419,38 @@ SolutionTransfer<dim, VectorType, spacedim>::unpack_callback(
   if (dofs_per_cell == 0)
     return; // nothing to do for FE_Nothing
 
-  const std::vector<::dealii::Vector<typename VectorType::value_type>>
-    dof_values =
-      unpack_dof_values<typename VectorType::value_type>(data_range,
-                                                         dofs_per_cell);
-
-  // check if sizes match
-  AssertDimension(dof_values.size(), all_out.size());
-
-  // check if we have enough dofs provided by the FE object
-  // to interpolate the transferred data correctly
-  for (auto it_dof_values = dof_values.begin();
-       it_dof_values != dof_values.end();
-       ++it_dof_values)
-    Assert(
-      dofs_per_cell == it_dof_values->size(),
-      ExcMessage(
-        "The transferred data was packed with a different number of dofs than the "
-        "currently registered FE object assigned to the DoFHandler has."));
-
-  // distribute data for each registered vector on mesh
-  auto it_input  = dof_values.cbegin();
-  auto it_output = all_out.begin();
-  for (; it_input != dof_values.cend(); ++it_input, ++it_output)
-    if (average_values)
-      cell->distribute_local_to_global_by_interpolation(*it_input,
-                                                        *(*it_output),
-                                                        fe_index);
-    else
-      cell->set_dof_values_by_interpolation(*it_input,
-                                            *(*it_output),
-                                            fe_index,
-                                            true);
+  using Number = typename VectorType::value_type;
+
+  const std::size_t bytes_per_entry =
+    bytes_per_dof_values<Number>(dofs_per_cell);
+
+  // check if we have enough dofs provided by the FE object to interpolate
+  // the transferred data correctly, and if the sizes match
+  Assert(
+    data_range.size() == all_out.size() * bytes_per_entry,
+    ExcMessage(
+      "The transferred data was packed with a different number of dofs than the "
+      "currently registered FE object assigned to the DoFHandler has."));
+
+  // distribute data for each registered vector on mesh, reusing one
+  // scratch vector for the values of all vectors
+  ::dealii::Vector<Number> dof_values(dofs_per_cell);
+  for (unsigned int i = 0; i < all_out.size(); ++i)
+    {
+      std::memcpy(dof_values.begin(),
+                  &(*std::next(data_range.begin(), i * bytes_per_entry)),
+                  bytes_per_entry);
+
+      if (average_values)
+        cell->distribute_local_to_global_by_interpolation(dof_values,
+                                                          *all_out[i],
+                                                          fe_index);
+      else
+        cell->set_dof_values_by_interpolation(dof_values,
+                                              *all_out[i],
+                                              fe_index,
+                                              true);
+    }
 
   if (average_values)
     {
@@ -15,6 +15,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/opencascade/manifold_lib.h>
 
 #ifdef DEAL_II_WITH_OPENCASCADE
@@ -99,6 +101,37 @@ namespace OpenCASCADE
       return GCPnts_AbscissaPoint::Length(adapt->GetCurve());
 #  endif
     }
+
+
+
+    // Compute the new points as weighted averages of the surrounding points
+    // and project them onto the manifold in parallel
+    template <int spacedim, typename ManifoldType>
+    void
+    project_new_points(
+      const ManifoldType                     &manifold,
+      const ArrayView<const Point<spacedim>> &surrounding_points,
+      const Table<2, double>                 &weights,
+      ArrayView<Point<spacedim>>              new_points)
+    {
+      AssertDimension(surrounding_points.size(), weights.size(1));
+      AssertDimension(new_points.size(), weights.size(0));
+
+      parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(weights.size(0)),
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int row = begin; row < end; ++row)
+            {
+              Point<spacedim> candidate;
+              for (unsigned int i = 0; i < surrounding_points.size(); ++i)
+                candidate += weights(row, i) * surrounding_points[i];
+              new_points[row] =
+                manifold.project_to_manifold(surrounding_points, candidate);
+            }
+        },
+        1);
+    }
   } // namespace
 
   /*======================= NormalProjectionManifold =========================*/
@@ -108,6 +141,7 @@ namespace OpenCASCADE
     const double        tolerance)
     : sh(sh)
     , tolerance(tolerance)
+    , projector(std::make_shared<ShapeProjector>(sh, tolerance))
   {
     Assert(spacedim == 3, ExcNotImplemented());
   }
@@ -133,12 +167,24 @@ namespace OpenCASCADE
     (void)surrounding_points;
 #  ifdef DEBUG
     for (unsigned int i = 0; i < surrounding_points.size(); ++i)
-      Assert(closest_point(sh, surrounding_points[i], tolerance)
+      Assert(projector->closest_point(surrounding_points[i])
                  .distance(surrounding_points[i]) <
                std::max(tolerance * surrounding_points[i].norm(), tolerance),
              ExcPointNotOnManifold<spacedim>(surrounding_points[i]));
 #  endif
-    return closest_point(sh, candidate, tolerance);
+    return projector->closest_point(candidate);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  NormalProjectionManifold<dim, spacedim>::get_new_points(
+    const ArrayView<const Point<spacedim>> &surrounding_points,
+    const Table<2, double>                 &weights,
+    ArrayView<Point<spacedim>>              new_points) const
+  {
+    project_new_points(*this, surrounding_points, weights, new_points);
   }
 
 
@@ -151,6 +197,7 @@ namespace OpenCASCADE
     : sh(sh)
     , direction(direction)
     , tolerance(tolerance)
+    , projector(std::make_shared<ShapeProjector>(sh, tolerance))
   {
     Assert(spacedim == 3, ExcNotImplemented());
   }
@@ -176,12 +223,24 @@ namespace OpenCASCADE
     (void)surrounding_points;
 #  ifdef DEBUG
     for (unsigned int i = 0; i < surrounding_points.size(); ++i)
-      Assert(closest_point(sh, surrounding_points[i], tolerance)
+      Assert(projector->closest_point(surrounding_points[i])
                  .distance(surrounding_points[i]) <
                std::max(tolerance * surrounding_points[i].norm(), tolerance),
              ExcPointNotOnManifold<spacedim>(surrounding_points[i]));
 #  endif
-    return line_intersection(sh, candidate, direction, tolerance);
+    return projector->line_intersection(candidate, direction);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  DirectionalProjectionManifold<dim, spacedim>::get_new_points(
+    const ArrayView<const Point<spacedim>> &surrounding_points,
+    const Table<2, double>                 &weights,
+    ArrayView<Point<spacedim>>              new_points) const
+  {
+    project_new_points(*this, surrounding_points, weights, new_points);
   }
 
 
@@ -193,6 +252,7 @@ namespace OpenCASCADE
     const double        tolerance)
     : sh(sh)
     , tolerance(tolerance)
+    , projector(std::make_shared<ShapeProjector>(sh, tolerance))
   {
     Assert(spacedim == 3, ExcNotImplemented());
     Assert(
@@ -215,6 +275,7 @@ namespace OpenCASCADE
     template <int spacedim>
     Point<spacedim>
     internal_project_to_manifold(const TopoDS_Shape &,
+                                 const ShapeProjector &,
                                  const double,
                                  const ArrayView<const Point<spacedim>> &,
                                  const Point<spacedim> &)
@@ -227,6 +288,7 @@ namespace OpenCASCADE
     Point<3>
     internal_project_to_manifold(
       const TopoDS_Shape              &sh,
+      const ShapeProjector            &projector,
       const double                     tolerance,
       const ArrayView<const Point<3>> &surrounding_points,
       const Point<3>                  &candidate)
@@ -237,7 +299,7 @@ namespace OpenCASCADE
 #  ifdef DEBUG
       for (const auto &point : surrounding_points)
         {
-          Assert(closest_point(sh, point, tolerance).distance(point) <
+          Assert(projector.closest_point(point).distance(point) <
                    std::max(tolerance * point.norm(), tolerance),
                  ExcPointNotOnManifold<spacedim>(point));
         }
@@ -384,7 +446,7 @@ namespace OpenCASCADE
             }
         }
 
-      return line_intersection(sh, candidate, average_normal, tolerance);
+      return projector.line_intersection(candidate, average_normal);
     }
   } // namespace
 
@@ -395,10 +457,20 @@ namespace OpenCASCADE
     const ArrayView<const Point<spacedim>> &surrounding_points,
     const Point<spacedim>                  &candidate) const
   {
-    return internal_project_to_manifold(sh,
-                                        tolerance,
-                                        surrounding_points,
-                                        candidate);
+    return internal_project_to_manifold(
+      sh, *projector, tolerance, surrounding_points, candidate);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  NormalToMeshProjectionManifold<dim, spacedim>::get_new_points(
+    const ArrayView<const Point<spacedim>> &surrounding_points,
+    const Table<2, double>                 &weights,
+    ArrayView<Point<spacedim>>              new_points) const
+  {
+    project_new_points(*this, surrounding_points, weights, new_points);
   }
 
 
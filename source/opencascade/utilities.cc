@@ -58,6 +58,7 @@
 #  include <BRepMesh_IncrementalMesh.hxx>
 #  include <BRepTools.hxx>
 #  include <BRep_Builder.hxx>
+#  include <Bnd_Box.hxx>
 #  include <GCPnts_AbscissaPoint.hxx>
 #  include <GeomAPI_Interpolate.hxx>
 #  include <GeomAPI_ProjectPointOnCurve.hxx>
@@ -80,6 +81,7 @@
 #  include <gp_Vec.hxx>
 
 #  include <algorithm>
+#  include <limits>
 #  include <vector>
 
 
@@ -915,6 +917,204 @@ namespace OpenCASCADE
     tria.create_triangulation(vertices, cells, t);
   }
 
+
+
+  ShapeProjector::ShapeProjector(const TopoDS_Shape &shape,
+                                 const double        tolerance)
+    : shape(shape)
+    , tolerance(tolerance)
+  {
+    const auto get_box = [](const TopoDS_Shape &sub_shape) {
+      Bnd_Box box;
+      BRepBndLib::Add(sub_shape, box);
+
+      // an empty box does not allow to skip the object
+      std::array<double, 6> coordinates;
+      if (box.IsVoid())
+        for (unsigned int d = 0; d < 3; ++d)
+          {
+            coordinates[d]     = -std::numeric_limits<double>::max();
+            coordinates[d + 3] = std::numeric_limits<double>::max();
+          }
+      else
+        box.Get(coordinates[0],
+                coordinates[1],
+                coordinates[2],
+                coordinates[3],
+                coordinates[4],
+                coordinates[5]);
+      return coordinates;
+    };
+
+    TopExp_Explorer exp;
+    for (exp.Init(shape, TopAbs_FACE); exp.More(); exp.Next())
+      {
+        const TopoDS_Face face = TopoDS::Face(exp.Current());
+        faces.push_back({face, BRep_Tool::Surface(face), get_box(face)});
+      }
+
+    if (faces.empty())
+      for (exp.Init(shape, TopAbs_EDGE); exp.More(); exp.Next())
+        {
+          const TopoDS_Edge edge = TopoDS::Edge(exp.Current());
+          if (!BRep_Tool::Degenerated(edge))
+            {
+              TopLoc_Location L;
+              Standard_Real   First;
+              Standard_Real   Last;
+              edges.push_back(
+                {edge, BRep_Tool::Curve(edge, L, First, Last), get_box(edge)});
+            }
+        }
+  }
+
+
+
+  template <typename ObjectType>
+  std::vector<std::pair<double, unsigned int>>
+  ShapeProjector::sort_by_box_distance(const std::vector<ObjectType> &objects,
+                                       const gp_Pnt                  &p)
+  {
+    const std::array<double, 3> coordinates = {{p.X(), p.Y(), p.Z()}};
+
+    std::vector<std::pair<double, unsigned int>> result(objects.size());
+    for (unsigned int i = 0; i < objects.size(); ++i)
+      {
+        const std::array<double, 6> &box      = objects[i].box;
+        double                       distance = 0.;
+        for (unsigned int d = 0; d < 3; ++d)
+          {
+            const double gap = std::max(0.,
+                                        std::max(box[d] - coordinates[d],
+                                                 coordinates[d] - box[d + 3]));
+            distance += gap * gap;
+          }
+        result[i] = {std::sqrt(distance), i};
+      }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+
+
+  template <int spacedim>
+  std::tuple<Point<spacedim>, TopoDS_Shape, double, double>
+  ShapeProjector::project_point_and_pull_back(
+    const Point<spacedim> &origin) const
+  {
+    const gp_Pnt P0    = point(origin);
+    gp_Pnt       Pproj = P0;
+
+    double minDistance = 1e7;
+    bool   found       = false;
+
+    TopoDS_Shape out_shape;
+    double       u = 0;
+    double       v = 0;
+
+    std::vector<Handle(ShapeAnalysis_Surface)> &projectors =
+      surface_projectors.get();
+    projectors.resize(faces.size());
+
+    for (const auto &[box_distance, i] : sort_by_box_distance(faces, P0))
+      {
+        // the boxes are sorted, so none of the remaining faces can contain
+        // a closer point
+        if (found && box_distance >= minDistance)
+          break;
+
+        if (projectors[i].IsNull())
+          projectors[i] = new ShapeAnalysis_Surface(faces[i].surface);
+
+        const gp_Pnt2d proj_params = projectors[i]->ValueOfUV(P0, tolerance);
+
+        gp_Pnt tmp_proj(0.0, 0.0, 0.0);
+        faces[i].surface->D0(proj_params.X(), proj_params.Y(), tmp_proj);
+
+        const double distance = point<spacedim>(tmp_proj).distance(origin);
+        if (distance < minDistance)
+          {
+            minDistance = distance;
+            Pproj       = tmp_proj;
+            out_shape   = faces[i].face;
+            u           = proj_params.X();
+            v           = proj_params.Y();
+            found       = true;
+          }
+      }
+
+    for (const auto &[box_distance, i] : sort_by_box_distance(edges, P0))
+      {
+        if (found && box_distance >= minDistance)
+          break;
+
+        GeomAPI_ProjectPointOnCurve Proj(P0, edges[i].curve);
+        if ((Proj.NbPoints() > 0) && (Proj.LowerDistance() < minDistance))
+          {
+            minDistance = Proj.LowerDistance();
+            Pproj       = Proj.NearestPoint();
+            out_shape   = edges[i].edge;
+            u           = Proj.LowerDistanceParameter();
+            found       = true;
+          }
+      }
+
+    Assert(found, ExcMessage("Could not find projection points."));
+    return std::tuple<Point<spacedim>, TopoDS_Shape, double, double>(
+      point<spacedim>(Pproj), out_shape, u, v);
+  }
+
+
+
+  template <int spacedim>
+  Point<spacedim>
+  ShapeProjector::closest_point(const Point<spacedim> &origin) const
+  {
+    return std::get<0>(project_point_and_pull_back(origin));
+  }
+
+
+
+  template <int spacedim>
+  Point<spacedim>
+  ShapeProjector::line_intersection(const Point<spacedim>     &origin,
+                                    const Tensor<1, spacedim> &direction) const
+  {
+    std::shared_ptr<IntCurvesFace_ShapeIntersector> &intersector =
+      intersectors.get();
+    if (intersector == nullptr)
+      {
+        intersector = std::make_shared<IntCurvesFace_ShapeIntersector>();
+        intersector->Load(shape, tolerance);
+      }
+
+    const gp_Pnt P0 = point(origin);
+    const gp_Ax1 gpaxis(P0,
+                        gp_Dir(direction[0],
+                               spacedim > 1 ? direction[1] : 0,
+                               spacedim > 2 ? direction[2] : 0));
+    const gp_Lin line(gpaxis);
+
+    // see the free function line_intersection() for why we do not use
+    // PerformNearest
+    intersector->Perform(line, -RealLast(), +RealLast());
+    Assert(intersector->IsDone(), ExcMessage("Could not project point."));
+
+    double          minDistance = 1e7;
+    Point<spacedim> result;
+    for (int i = 0; i < intersector->NbPnt(); ++i)
+      {
+        const double distance = P0.Distance(intersector->Pnt(i + 1));
+        if (distance < minDistance)
+          {
+            minDistance = distance;
+            result      = point<spacedim>(intersector->Pnt(i + 1));
+          }
+      }
+
+    return result;
+  }
+
 #  include "utilities.inst"
 
 } // namespace OpenCASCADE
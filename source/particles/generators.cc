@@ -14,6 +14,7 @@
 
 #include <deal.II/base/bounding_box.h>
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/signaling_nan.h>
 
@@ -26,6 +27,7 @@
 
 #include <deal.II/particles/generators.h>
 
+#include <algorithm>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -173,6 +175,84 @@ namespace Particles
 
         return {position, reference_position};
       }
+
+
+
+      // This function computes the locations in real space of the given
+      // reference locations in each of the given cells, with the points of
+      // cell c stored at positions [c*n_points, (c+1)*n_points) of the
+      // returned vector. The cells are processed in parallel. If all cells
+      // are hypercubes, the points of each cell are mapped together by an
+      // FEValues object, which lets the mapping use its evaluation for the
+      // whole set of points, e.g., the tensor-product evaluation
+      // of MappingQ, rather than a call to
+      // Mapping::transform_unit_to_real_cell() for each point.
+      template <int dim, int spacedim>
+      std::vector<Point<spacedim>>
+      compute_real_locations(
+        const std::vector<
+          typename Triangulation<dim, spacedim>::active_cell_iterator> &cells,
+        const std::vector<Point<dim>> &reference_locations,
+        const Mapping<dim, spacedim>  &mapping)
+      {
+        const std::size_t n_points = reference_locations.size();
+
+        std::vector<Point<spacedim>> real_locations(cells.size() * n_points);
+        if (real_locations.empty())
+          return real_locations;
+
+        const Triangulation<dim, spacedim> &triangulation =
+          cells.front()->get_triangulation();
+        const bool use_fe_values =
+          triangulation.all_reference_cells_are_hyper_cube();
+
+        parallel::apply_to_subranges(
+          std::size_t(0),
+          cells.size(),
+          [&](const std::size_t begin, const std::size_t end) {
+            if (use_fe_values)
+              {
+                FE_Nothing<dim, spacedim> alibi_finite_element;
+                FEValues<dim, spacedim>   fe_values(mapping,
+                                                  alibi_finite_element,
+                                                  Quadrature<dim>(
+                                                    reference_locations),
+                                                  update_quadrature_points);
+                for (std::size_t c = begin; c < end; ++c)
+                  {
+                    fe_values.reinit(cells[c]);
+                    std::copy(fe_values.get_quadrature_points().begin(),
+                              fe_values.get_quadrature_points().end(),
+                              real_locations.begin() + c * n_points);
+                  }
+              }
+            else
+              for (std::size_t c = begin; c < end; ++c)
+                for (std::size_t q = 0; q < n_points; ++q)
+                  real_locations[c * n_points + q] =
+                    mapping.transform_unit_to_real_cell(cells[c],
+                                                        reference_locations[q]);
+          },
+          std::max<std::size_t>(1, 512 / n_points));
+
+        return real_locations;
+      }
+
+
+
+      // Return the locally owned active cells of the given triangulation.
+      template <int dim, int spacedim>
+      std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      locally_owned_active_cells(
+        const Triangulation<dim, spacedim> &triangulation)
+      {
+        std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+          cells;
+        for (const auto &cell : triangulation.active_cell_iterators() |
+                                  IteratorFilters::LocallyOwnedCell())
+          cells.push_back(cell);
+        return cells;
+      }
     } // namespace
 
 
@@ -212,21 +292,22 @@ namespace Particles
       particle_handler.reserve(particle_handler.n_locally_owned_particles() +
                                n_particles_to_generate);
 
-      for (const auto &cell : triangulation.active_cell_iterators() |
-                                IteratorFilters::LocallyOwnedCell())
-        {
-          for (const auto &reference_location : particle_reference_locations)
-            {
-              const Point<spacedim> position_real =
-                mapping.transform_unit_to_real_cell(cell, reference_location);
-
-              particle_handler.insert_particle(position_real,
-                                               reference_location,
-                                               particle_index,
-                                               cell);
-              ++particle_index;
-            }
-        }
+      // Map the reference locations of all cells in parallel, then insert
+      // the particles with their known reference locations
+      const auto cells = locally_owned_active_cells(triangulation);
+      const std::vector<Point<spacedim>> real_locations =
+        compute_real_locations(cells, particle_reference_locations, mapping);
+
+      const std::size_t n_points = particle_reference_locations.size();
+      for (std::size_t c = 0; c < cells.size(); ++c)
+        for (std::size_t q = 0; q < n_points; ++q)
+          {
+            particle_handler.insert_particle(real_locations[c * n_points + q],
+                                             particle_reference_locations[q],
+                                             particle_index,
+                                             cells[c]);
+            ++particle_index;
+          }
 
       particle_handler.update_cached_numbers();
     }
@@ -480,23 +561,13 @@ namespace Particles
       const Mapping<dim, spacedim>           &mapping,
       const std::vector<std::vector<double>> &properties)
     {
-      const std::vector<Point<dim>> &particle_reference_locations =
-        quadrature.get_points();
-      std::vector<Point<spacedim>> points_to_generate;
-      points_to_generate.reserve(particle_reference_locations.size() *
-                                 triangulation.n_active_cells());
-
-      //       Loop through cells and gather gauss points
-      for (const auto &cell : triangulation.active_cell_iterators() |
-                                IteratorFilters::LocallyOwnedCell())
-        {
-          for (const auto &reference_location : particle_reference_locations)
-            {
-              const Point<spacedim> position_real =
-                mapping.transform_unit_to_real_cell(cell, reference_location);
-              points_to_generate.push_back(position_real);
-            }
-        }
+      // Gather the quadrature points of all locally owned cells, computed in
+      // parallel
+      const std::vector<Point<spacedim>> points_to_generate =
+        compute_real_locations(locally_owned_active_cells(triangulation),
+                               quadrature.get_points(),
+                               mapping);
+
       particle_handler.insert_global_particles(points_to_generate,
                                                global_bounding_boxes,
                                                properties);
@@ -0,0 +1,148 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/particles/load_balancer.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  template <int dim, int spacedim>
+  LoadBalancer<dim, spacedim>::LoadBalancer(
+    parallel::distributed::Triangulation<dim, spacedim> &triangulation,
+    ParticleHandler<dim, spacedim>                       &particle_handler,
+    const AdditionalData                                 &additional_data)
+    : triangulation(&triangulation)
+    , particle_handler(&particle_handler)
+    , additional_data(additional_data)
+    , repartition_counter(0)
+  {
+    weight_connection = triangulation.signals.weight.connect(
+      [this](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+             const CellStatus status) { return cell_weight(cell, status); });
+  }
+
+
+
+  template <int dim, int spacedim>
+  LoadBalancer<dim, spacedim>::~LoadBalancer()
+  {
+    weight_connection.disconnect();
+  }
+
+
+
+  template <int dim, int spacedim>
+  unsigned int
+  LoadBalancer<dim, spacedim>::cell_weight(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const CellStatus                                            status) const
+  {
+    types::particle_index n_particles = 0;
+    switch (status)
+      {
+        case CellStatus::cell_will_persist:
+        case CellStatus::cell_will_be_refined:
+          n_particles = particle_handler->n_particles_in_cell(cell);
+          break;
+
+        case CellStatus::cell_invalid:
+          break;
+
+        case CellStatus::children_will_be_coarsened:
+          for (const auto &child : cell->child_iterators())
+            n_particles += particle_handler->n_particles_in_cell(child);
+          break;
+
+        default:
+          DEAL_II_ASSERT_UNREACHABLE();
+      }
+
+    return additional_data.cell_weight +
+           additional_data.particle_weight * n_particles;
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  LoadBalancer<dim, spacedim>::compute_imbalance() const
+  {
+    // The sum of cell_weight() over the locally owned cells, which can be
+    // computed without a loop over the cells
+    const double local_work =
+      static_cast<double>(additional_data.cell_weight) *
+        triangulation->n_locally_owned_active_cells() +
+      static_cast<double>(additional_data.particle_weight) *
+        particle_handler->n_locally_owned_particles();
+
+    const Utilities::MPI::MinMaxAvg work =
+      Utilities::MPI::min_max_avg(local_work,
+                                  triangulation->get_mpi_communicator());
+
+    return work.avg > 0. ? work.max / work.avg : 1.;
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  LoadBalancer<dim, spacedim>::repartition_if_needed()
+  {
+    if (compute_imbalance() > additional_data.imbalance_threshold)
+      {
+        repartition();
+        return true;
+      }
+    else
+      return false;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  LoadBalancer<dim, spacedim>::repartition()
+  {
+#ifdef DEAL_II_WITH_P4EST
+    if constexpr (dim > 1)
+      {
+        particle_handler->prepare_for_coarsening_and_refinement();
+        triangulation->repartition();
+        particle_handler->unpack_after_coarsening_and_refinement();
+
+        ++repartition_counter;
+      }
+    else
+      DEAL_II_NOT_IMPLEMENTED();
+#else
+    DEAL_II_NOT_IMPLEMENTED();
+#endif
+  }
+
+
+
+  template <int dim, int spacedim>
+  unsigned int
+  LoadBalancer<dim, spacedim>::n_repartitions() const
+  {
+    return repartition_counter;
+  }
+} // namespace Particles
+
+#include "load_balancer.inst"
+
+DEAL_II_NAMESPACE_CLOSE
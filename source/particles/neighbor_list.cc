@@ -0,0 +1,328 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/particles/neighbor_list.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  namespace
+  {
+    /**
+     * The minimal number of particles per task in the threaded loops.
+     */
+    constexpr unsigned int grainsize = 256;
+  } // namespace
+
+
+
+  template <int dim, int spacedim>
+  NeighborList<dim, spacedim>::NeighborList()
+    : n_owned_particles(0)
+    , neighbor_pointers(1, 0)
+  {}
+
+
+
+  template <int dim, int spacedim>
+  void
+  NeighborList<dim, spacedim>::reinit(
+    const ParticleHandler<dim, spacedim> &particle_handler,
+    const AdditionalData                 &additional_data)
+  {
+    Assert(additional_data.cutoff_radius > 0.,
+           ExcMessage("The cutoff radius needs to be positive."));
+    Assert(additional_data.skin >= 0.,
+           ExcMessage("The skin distance must not be negative."));
+
+    this->particle_handler = &particle_handler;
+    this->additional_data  = additional_data;
+
+    build();
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  NeighborList<dim, spacedim>::needs_rebuild() const
+  {
+    Assert(particle_handler != nullptr, ExcNotInitialized());
+
+    if (particle_handler->n_locally_owned_particles() != n_owned_particles)
+      return true;
+
+    const double max_displacement_square =
+      0.25 * additional_data.skin * additional_data.skin;
+    const unsigned int n_moved_particles =
+      parallel::accumulate_from_subranges<unsigned int>(
+        [&](const unsigned int begin, const unsigned int end) {
+          unsigned int n_moved = 0;
+          for (unsigned int i = begin; i < end; ++i)
+            if (particles[i]->get_location().distance_square(
+                  build_locations[i]) > max_displacement_square)
+              ++n_moved;
+          return n_moved;
+        },
+        0U,
+        static_cast<unsigned int>(particles.size()),
+        grainsize);
+
+    return n_moved_particles > 0;
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  NeighborList<dim, spacedim>::update()
+  {
+    if (needs_rebuild() == false)
+      return false;
+
+    build();
+    return true;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  NeighborList<dim, spacedim>::build()
+  {
+    particles.clear();
+    particles.reserve(particle_handler->n_locally_owned_particles());
+    for (auto particle = particle_handler->begin();
+         particle != particle_handler->end();
+         ++particle)
+      particles.push_back(particle);
+    n_owned_particles = particles.size();
+
+    if (additional_data.include_ghost_particles)
+      for (auto particle = particle_handler->begin_ghost();
+           particle != particle_handler->end_ghost();
+           ++particle)
+        particles.push_back(particle);
+
+    const unsigned int n_all_particles = particles.size();
+
+    build_locations.resize(n_all_particles);
+    parallel::apply_to_subranges(
+      0U,
+      n_all_particles,
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
+          build_locations[i] = particles[i]->get_location();
+      },
+      grainsize);
+
+    neighbor_pointers.assign(n_owned_particles + 1, 0);
+    neighbor_indices.clear();
+    if (n_owned_particles == 0)
+      return;
+
+    // set up a Cartesian grid of bins around all particles. The bin size is
+    // at least the search radius, such that the neighbors of a particle are
+    // in the bins adjacent to its own. For sparse particle distributions,
+    // the bins are enlarged to keep the number of bins proportional to the
+    // number of particles.
+    const double search_radius =
+      additional_data.cutoff_radius + additional_data.skin;
+
+    Point<spacedim> lower = build_locations[0];
+    Point<spacedim> upper = build_locations[0];
+    for (const Point<spacedim> &location : build_locations)
+      for (unsigned int d = 0; d < spacedim; ++d)
+        {
+          lower[d] = std::min(lower[d], location[d]);
+          upper[d] = std::max(upper[d], location[d]);
+        }
+
+    const double max_n_bins = 4. * n_all_particles + 1.;
+
+    double                                bin_size = search_radius;
+    std::array<unsigned int, spacedim>    n_bins;
+    std::array<std::size_t, spacedim + 1> strides;
+    while (true)
+      {
+        double n_bins_total = 1.;
+        for (unsigned int d = 0; d < spacedim; ++d)
+          {
+            n_bins[d] = static_cast<unsigned int>(std::max(
+              1., std::min(std::floor((upper[d] - lower[d]) / bin_size),
+                           max_n_bins)));
+            n_bins_total *= n_bins[d];
+          }
+        if (n_bins_total <= max_n_bins)
+          break;
+        bin_size *= std::pow(n_bins_total / max_n_bins, 1. / spacedim);
+      }
+
+    strides[0] = 1;
+    for (unsigned int d = 0; d < spacedim; ++d)
+      strides[d + 1] = strides[d] * n_bins[d];
+
+    const auto bin_coordinates = [&](const Point<spacedim> &location) {
+      std::array<unsigned int, spacedim> coordinates;
+      for (unsigned int d = 0; d < spacedim; ++d)
+        coordinates[d] = std::min(
+          n_bins[d] - 1,
+          static_cast<unsigned int>((location[d] - lower[d]) / bin_size));
+      return coordinates;
+    };
+
+    // sort the particles into the bins by a counting sort, and store their
+    // locations in the order of the bins for a contiguous access during the
+    // search
+    std::vector<std::size_t> particle_bins(n_all_particles);
+    parallel::apply_to_subranges(
+      0U,
+      n_all_particles,
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
+          {
+            const auto  coordinates = bin_coordinates(build_locations[i]);
+            std::size_t bin         = 0;
+            for (unsigned int d = 0; d < spacedim; ++d)
+              bin += coordinates[d] * strides[d];
+            particle_bins[i] = bin;
+          }
+      },
+      grainsize);
+
+    std::vector<unsigned int> bin_pointers(strides[spacedim] + 1, 0);
+    for (const std::size_t bin : particle_bins)
+      ++bin_pointers[bin + 1];
+    for (std::size_t bin = 0; bin < strides[spacedim]; ++bin)
+      bin_pointers[bin + 1] += bin_pointers[bin];
+
+    std::vector<unsigned int>    binned_particles(n_all_particles);
+    std::vector<Point<spacedim>> binned_locations(n_all_particles);
+    {
+      std::vector<unsigned int> next_in_bin(bin_pointers.begin(),
+                                            bin_pointers.end() - 1);
+      for (unsigned int i = 0; i < n_all_particles; ++i)
+        {
+          const unsigned int position = next_in_bin[particle_bins[i]]++;
+          binned_particles[position]  = i;
+          binned_locations[position]  = build_locations[i];
+        }
+    }
+
+    // run through the bins adjacent to the one of each locally owned
+    // particle, calling the given function for each particle within the
+    // search radius. The search is done twice, once to count and once to
+    // fill the neighbors, which avoids temporary storage and keeps the
+    // result independent of the number of threads.
+    const double search_radius_square = search_radius * search_radius;
+
+    const auto for_each_neighbor = [&](const unsigned int i,
+                                       const auto        &function) {
+      const Point<spacedim> &location    = build_locations[i];
+      const auto             coordinates = bin_coordinates(location);
+
+      std::array<unsigned int, spacedim> begin, end;
+      for (unsigned int d = 0; d < spacedim; ++d)
+        {
+          begin[d] = coordinates[d] > 0 ? coordinates[d] - 1 : 0;
+          end[d]   = std::min(coordinates[d] + 2, n_bins[d]);
+        }
+
+      std::array<unsigned int, spacedim> current = begin;
+      while (true)
+        {
+          std::size_t bin = 0;
+          for (unsigned int d = 0; d < spacedim; ++d)
+            bin += current[d] * strides[d];
+
+          for (unsigned int k = bin_pointers[bin]; k < bin_pointers[bin + 1];
+               ++k)
+            if (binned_particles[k] != i &&
+                location.distance_square(binned_locations[k]) <=
+                  search_radius_square)
+              function(binned_particles[k]);
+
+          // go to the next bin in lexicographic order
+          unsigned int d = 0;
+          for (; d < spacedim; ++d)
+            {
+              ++current[d];
+              if (current[d] < end[d])
+                break;
+              current[d] = begin[d];
+            }
+          if (d == spacedim)
+            break;
+        }
+    };
+
+    parallel::apply_to_subranges(
+      0U,
+      n_owned_particles,
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
+          {
+            std::size_t n_neighbors = 0;
+            for_each_neighbor(i, [&](const unsigned int) { ++n_neighbors; });
+            neighbor_pointers[i + 1] = n_neighbors;
+          }
+      },
+      grainsize);
+
+    for (unsigned int i = 0; i < n_owned_particles; ++i)
+      neighbor_pointers[i + 1] += neighbor_pointers[i];
+    neighbor_indices.resize(neighbor_pointers.back());
+
+    parallel::apply_to_subranges(
+      0U,
+      n_owned_particles,
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
+          {
+            std::size_t position = neighbor_pointers[i];
+            for_each_neighbor(i, [&](const unsigned int j) {
+              neighbor_indices[position++] = j;
+            });
+            AssertDimension(position, neighbor_pointers[i + 1]);
+          }
+      },
+      grainsize);
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::size_t
+  NeighborList<dim, spacedim>::memory_consumption() const
+  {
+    return sizeof(*this) +
+           particles.capacity() * sizeof(particle_iterator) +
+           MemoryConsumption::memory_consumption(build_locations) +
+           MemoryConsumption::memory_consumption(neighbor_pointers) +
+           MemoryConsumption::memory_consumption(neighbor_indices);
+  }
+} // namespace Particles
+
+#include "neighbor_list.inst"
+
+DEAL_II_NAMESPACE_CLOSE
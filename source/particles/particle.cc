@@ -67,6 +67,9 @@ namespace Particles
                   their_properties.end(),
                   my_properties.begin());
       }
+
+    property_pool->copy_compact_properties(particle.property_pool_handle,
+                                           property_pool_handle);
   }
 
 
@@ -103,7 +106,7 @@ namespace Particles
           particle_properties[i] = *pdata++;
       }
 
-    data = static_cast<const void *>(pdata);
+    data = property_pool->read_compact_properties(property_pool_handle, pdata);
   }
 
 
@@ -149,6 +152,22 @@ namespace Particles
                       their_properties.end(),
                       my_properties.begin());
           }
+
+        if (property_pool == particle.property_pool)
+          property_pool->copy_compact_properties(particle.property_pool_handle,
+                                                 property_pool_handle);
+        else if (property_pool->serialized_compact_size_in_bytes() > 0)
+          {
+            Assert(property_pool->serialized_compact_size_in_bytes() ==
+                     particle.property_pool->serialized_compact_size_in_bytes(),
+                   ExcInternalError());
+            std::vector<char> buffer(
+              property_pool->serialized_compact_size_in_bytes());
+            particle.property_pool->write_compact_properties(
+              particle.property_pool_handle, buffer.data());
+            property_pool->read_compact_properties(property_pool_handle,
+                                                   buffer.data());
+          }
       }
 
     return *this;
@@ -241,7 +260,8 @@ namespace Particles
           *pdata = particle_properties[i];
       }
 
-    return static_cast<void *>(pdata);
+    return property_pool->write_compact_properties(property_pool_handle,
+                                                   pdata);
   }
 
 
@@ -276,7 +296,7 @@ namespace Particles
           particle_properties[i] = *pdata++;
       }
 
-    return static_cast<const void *>(pdata);
+    return property_pool->read_compact_properties(property_pool_handle, pdata);
   }
 
 
@@ -295,6 +315,7 @@ namespace Particles
           property_pool->get_properties(property_pool_handle);
         size += sizeof(double) * particle_properties.size();
       }
+    size += property_pool->serialized_compact_size_in_bytes();
     return size;
   }
 
@@ -12,6 +12,8 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/grid_tools_cache.h>
 
@@ -75,12 +77,15 @@ namespace Particles
 
   template <int dim, int spacedim>
   ParticleHandler<dim, spacedim>::ParticleHandler(
-    const Triangulation<dim, spacedim> &triangulation,
-    const Mapping<dim, spacedim>       &mapping,
-    const unsigned int                  n_properties)
+    const Triangulation<dim, spacedim>      &triangulation,
+    const Mapping<dim, spacedim>            &mapping,
+    const unsigned int                       n_properties,
+    const std::vector<CompactPropertyField> &compact_property_fields)
     : triangulation(&triangulation, typeid(*this).name())
     , mapping(&mapping, typeid(*this).name())
-    , property_pool(std::make_unique<PropertyPool<dim, spacedim>>(n_properties))
+    , property_pool(
+        std::make_unique<PropertyPool<dim, spacedim>>(n_properties,
+                                                      compact_property_fields))
     , cells_to_particle_cache(triangulation.n_active_cells(), particles.end())
     , global_number_of_particles(0)
     , number_of_locally_owned_particles(0)
@@ -115,9 +120,10 @@ namespace Particles
   template <int dim, int spacedim>
   void
   ParticleHandler<dim, spacedim>::initialize(
-    const Triangulation<dim, spacedim> &new_triangulation,
-    const Mapping<dim, spacedim>       &new_mapping,
-    const unsigned int                  n_properties)
+    const Triangulation<dim, spacedim>      &new_triangulation,
+    const Mapping<dim, spacedim>            &new_mapping,
+    const unsigned int                       n_properties,
+    const std::vector<CompactPropertyField> &compact_property_fields)
   {
     clear();
 
@@ -127,7 +133,9 @@ namespace Particles
     reset_particle_container(particles);
 
     // Create the memory pool that will store all particle properties
-    property_pool = std::make_unique<PropertyPool<dim, spacedim>>(n_properties);
+    property_pool =
+      std::make_unique<PropertyPool<dim, spacedim>>(n_properties,
+                                                    compact_property_fields);
 
     // Create the grid cache to cache the information about the triangulation
     // that is used to locate the particles into subdomains and cells
@@ -152,7 +160,8 @@ namespace Particles
       particle_handler.property_pool->n_properties_per_slot();
     initialize(*particle_handler.triangulation,
                *particle_handler.mapping,
-               n_properties);
+               n_properties,
+               particle_handler.property_pool->get_compact_property_fields());
 
     property_pool = std::make_unique<PropertyPool<dim, spacedim>>(
       *(particle_handler.property_pool));
@@ -485,6 +494,44 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  typename ParticleHandler<dim, spacedim>::ParticleDataInCell
+  ParticleHandler<dim, spacedim>::get_particle_data_in_cell(
+    const typename Triangulation<dim, spacedim>::active_cell_iterator &cell)
+  {
+    AssertThrow(cell->is_artificial() == false,
+                ExcMessage("You can't ask for the particles on an artificial "
+                           "cell since we don't know what exists on these "
+                           "kinds of cells."));
+
+    const unsigned int active_cell_index = cell->active_cell_index();
+    if (cells_to_particle_cache.empty() ||
+        cells_to_particle_cache[active_cell_index] == particles.end())
+      return {};
+
+    const std::vector<typename PropertyPool<dim, spacedim>::Handle> &handles =
+      cells_to_particle_cache[active_cell_index]->particles;
+    if (handles.empty())
+      return {};
+
+    const typename PropertyPool<dim, spacedim>::Handle first_handle =
+      handles[0];
+    const unsigned int n_particles = handles.size();
+#ifdef DEBUG
+    for (unsigned int i = 0; i < n_particles; ++i)
+      Assert(handles[i] == first_handle + i,
+             ExcMessage("The data of the particles in this cell is not stored "
+                        "contiguously. Call sort_particle_data() first."));
+#endif
+
+    return {property_pool->get_locations(first_handle, n_particles),
+            property_pool->get_reference_locations(first_handle, n_particles),
+            property_pool->get_ids(first_handle, n_particles),
+            property_pool->get_properties(first_handle, n_particles)};
+  }
+
+
+
   template <int dim, int spacedim>
   void
   ParticleHandler<dim, spacedim>::remove_particle(
@@ -1223,56 +1270,111 @@ namespace Particles
     // TODO: Extend this function to allow keeping particles on other
     // processes around (with an invalid cell).
 
-    std::vector<particle_iterator> particles_out_of_cell;
-
-    // Reserve some space for particles that need sorting to avoid frequent
-    // re-allocation. Guess 25% of particles need sorting. Balance memory
-    // overhead and performance.
-    particles_out_of_cell.reserve(n_locally_owned_particles() / 4);
-
-    // Now update the reference locations of the moved particles
-    std::vector<Point<spacedim>> real_locations;
-    std::vector<Point<dim>>      reference_locations;
-    real_locations.reserve(global_max_particles_per_cell);
-    reference_locations.reserve(global_max_particles_per_cell);
-
+    // Particles can be inserted into arbitrary cells, e.g. if their cell is
+    // not known. However, for artificial cells we can not evaluate the
+    // reference position of particles. Do not sort particles that are not
+    // locally owned, because they will be sorted by the process that owns
+    // them.
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      cells_with_particles;
     for (const auto &cell : triangulation->active_cell_iterators())
-      {
-        // Particles can be inserted into arbitrary cells, e.g. if their cell is
-        // not known. However, for artificial cells we can not evaluate
-        // the reference position of particles. Do not sort particles that are
-        // not locally owned, because they will be sorted by the process that
-        // owns them.
-        if (cell->is_locally_owned() == false)
+      if (cell->is_locally_owned() && n_particles_in_cell(cell) > 0)
+        cells_with_particles.push_back(cell);
+
+    // Update the reference locations of the particles of each cell with a
+    // single call to the mapping, which processes the points in batches for
+    // MappingQ, and record the particles that left their cell. The cells are
+    // independent of each other, so we can work on them in parallel.
+    std::vector<std::vector<unsigned int>> particles_out_of_cell_by_cell(
+      cells_with_particles.size());
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(cells_with_particles.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<Point<spacedim>> real_locations;
+        std::vector<Point<dim>>      reference_locations;
+        std::vector<unsigned int>    particles_to_transform;
+        real_locations.reserve(global_max_particles_per_cell);
+        reference_locations.reserve(global_max_particles_per_cell);
+        particles_to_transform.reserve(global_max_particles_per_cell);
+
+        for (unsigned int c = begin; c < end; ++c)
           {
-            continue;
-          }
-
-        const unsigned int n_pic = n_particles_in_cell(cell);
-        auto               pic   = particles_in_cell(cell);
+            const auto &cell = cells_with_particles[c];
+            const auto  pic  = particles_in_cell(cell);
+
+            // Particles outside the bounding box of the cell certainly left
+            // it, so do not ask the mapping for their reference location:
+            // Points far away from the cell make the Newton iteration for
+            // the batch of points take more steps or fail. For dim <
+            // spacedim, the bounding box has no extent in the normal
+            // direction, so we let the mapping decide.
+            const BoundingBox<spacedim> box = mapping->get_bounding_box(cell);
+
+            real_locations.clear();
+            particles_to_transform.clear();
+            unsigned int i = 0;
+            for (const auto &particle : pic)
+              {
+                if (dim < spacedim ||
+                    box.point_inside(particle.get_location(),
+                                     tolerance_inside_cell))
+                  {
+                    real_locations.push_back(particle.get_location());
+                    particles_to_transform.push_back(i);
+                  }
+                else
+                  particles_out_of_cell_by_cell[c].push_back(i);
+                ++i;
+              }
 
-        real_locations.clear();
-        for (const auto &particle : pic)
-          real_locations.push_back(particle.get_location());
+            reference_locations.resize(real_locations.size());
+            mapping->transform_points_real_to_unit_cell(cell,
+                                                        real_locations,
+                                                        reference_locations);
 
-        reference_locations.resize(n_pic);
-        mapping->transform_points_real_to_unit_cell(cell,
-                                                    real_locations,
-                                                    reference_locations);
+            auto particle = pic.begin();
+            i             = 0;
+            for (unsigned int q = 0; q < reference_locations.size(); ++q)
+              {
+                for (; i < particles_to_transform[q]; ++i)
+                  ++particle;
+
+                const Point<dim> &p_unit = reference_locations[q];
+                if (numbers::is_finite(p_unit[0]) &&
+                    GeometryInfo<dim>::is_inside_unit_cell(
+                      p_unit, tolerance_inside_cell))
+                  particle->set_reference_location(p_unit);
+                else
+                  particles_out_of_cell_by_cell[c].push_back(
+                    particles_to_transform[q]);
+              }
 
-        auto particle = pic.begin();
-        for (const auto &p_unit : reference_locations)
-          {
-            if (numbers::is_finite(p_unit[0]) &&
-                GeometryInfo<dim>::is_inside_unit_cell(p_unit,
-                                                       tolerance_inside_cell))
-              particle->set_reference_location(p_unit);
-            else
-              particles_out_of_cell.push_back(particle);
-
-            ++particle;
+            // keep the particles in the order of iteration
+            if (particles_out_of_cell_by_cell[c].size() > 1 &&
+                real_locations.size() < n_particles_in_cell(cell))
+              std::sort(particles_out_of_cell_by_cell[c].begin(),
+                        particles_out_of_cell_by_cell[c].end());
           }
-      }
+      },
+      32);
+
+    std::vector<particle_iterator> particles_out_of_cell;
+    {
+      std::size_t n_particles_out_of_cell = 0;
+      for (const auto &indices : particles_out_of_cell_by_cell)
+        n_particles_out_of_cell += indices.size();
+      particles_out_of_cell.reserve(n_particles_out_of_cell);
+    }
+    for (unsigned int c = 0; c < cells_with_particles.size(); ++c)
+      for (const unsigned int i : particles_out_of_cell_by_cell[c])
+        particles_out_of_cell.emplace_back(
+          cells_to_particle_cache[cells_with_particles[c]->active_cell_index()],
+          *property_pool,
+          i);
+
+    std::vector<Point<spacedim>> real_locations;
+    std::vector<Point<dim>>      reference_locations;
 
     // There are three reasons why a particle is not in its old cell:
     // It moved to another cell, to another subdomain or it left the mesh.
@@ -1514,6 +1616,15 @@ namespace Particles
     remove_particles(particles_out_of_cell);
 
     // now make sure particle data is sorted in order of iteration
+    sort_particle_data();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::sort_particle_data()
+  {
     std::vector<typename PropertyPool<dim, spacedim>::Handle> unsorted_handles;
     unsorted_handles.reserve(property_pool->n_registered_slots());
 
@@ -1526,8 +1637,7 @@ namespace Particles
         }
 
     property_pool->sort_memory_slots(unsorted_handles);
-
-  } // namespace Particles
+  }
 
 
 
@@ -1643,6 +1753,16 @@ namespace Particles
   template <int dim, int spacedim>
   void
   ParticleHandler<dim, spacedim>::update_ghost_particles()
+  {
+    update_ghost_particles_start();
+    update_ghost_particles_finish();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::update_ghost_particles_start()
   {
     // Nothing to do in serial computations
     const auto parallel_triangulation =
@@ -1657,21 +1777,45 @@ namespace Particles
 
 
 #ifdef DEAL_II_WITH_MPI
-    // First clear the current ghost_particle information
-    // ghost_particles.clear();
     Assert(ghost_particles_cache.valid,
            ExcMessage(
              "Ghost particles cannot be updated if they first have not been "
              "exchanged at least once with the cache enabled"));
+    Assert(ghost_particles_cache.requests.empty(),
+           ExcMessage("You started an update of the ghost particles with "
+                      "update_ghost_particles_start() but did not call "
+                      "update_ghost_particles_finish() yet."));
 
-
-    send_recv_particles_properties_and_location(
+    send_recv_particles_properties_and_location_start(
       ghost_particles_cache.ghost_particles_by_domain);
 #endif
   }
 
 
 
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::update_ghost_particles_finish()
+  {
+    // Nothing to do in serial computations
+    const auto parallel_triangulation =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &*triangulation);
+    if (parallel_triangulation == nullptr ||
+        dealii::Utilities::MPI::n_mpi_processes(
+          parallel_triangulation->get_mpi_communicator()) == 1)
+      {
+        return;
+      }
+
+
+#ifdef DEAL_II_WITH_MPI
+    send_recv_particles_properties_and_location_finish();
+#endif
+  }
+
+
+
 #ifdef DEAL_II_WITH_MPI
   template <int dim, int spacedim>
   void
@@ -1975,6 +2119,19 @@ namespace Particles
   ParticleHandler<dim, spacedim>::send_recv_particles_properties_and_location(
     const std::map<types::subdomain_id, std::vector<particle_iterator>>
       &particles_to_send)
+  {
+    send_recv_particles_properties_and_location_start(particles_to_send);
+    send_recv_particles_properties_and_location_finish();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::
+    send_recv_particles_properties_and_location_start(
+      const std::map<types::subdomain_id, std::vector<particle_iterator>>
+        &particles_to_send)
   {
     const auto parallel_triangulation =
       dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
@@ -2008,11 +2165,12 @@ namespace Particles
 
     std::vector<char> &recv_data = ghost_particles_cache.recv_data;
 
-    // Exchange the particle data between domains
+    // Start the exchange of the particle data between domains
     {
-      std::vector<MPI_Request> requests(2 * neighbors.size());
-      unsigned int             send_ops = 0;
-      unsigned int             recv_ops = 0;
+      std::vector<MPI_Request> &requests = ghost_particles_cache.requests;
+      requests.resize(2 * neighbors.size());
+      unsigned int send_ops = 0;
+      unsigned int recv_ops = 0;
 
       const int mpi_tag = Utilities::MPI::internal::Tags::
         particle_handler_send_recv_particles_send;
@@ -2046,10 +2204,24 @@ namespace Particles
             AssertThrowMPI(ierr);
             ++recv_ops;
           }
-      const int ierr =
-        MPI_Waitall(send_ops + recv_ops, requests.data(), MPI_STATUSES_IGNORE);
-      AssertThrowMPI(ierr);
+      requests.resize(send_ops + recv_ops);
     }
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::
+    send_recv_particles_properties_and_location_finish()
+  {
+    std::vector<MPI_Request> &requests = ghost_particles_cache.requests;
+    const int                 ierr =
+      MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    AssertThrowMPI(ierr);
+    requests.clear();
+
+    const std::vector<char> &recv_data = ghost_particles_cache.recv_data;
 
     // Put the received particles into the domain if they are in the
     // triangulation
@@ -17,6 +17,8 @@
 
 #include <deal.II/particles/property_pool.h>
 
+#include <algorithm>
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace Particles
@@ -29,8 +31,11 @@ namespace Particles
 
   template <int dim, int spacedim>
   PropertyPool<dim, spacedim>::PropertyPool(
-    const unsigned int n_properties_per_slot)
+    const unsigned int                       n_properties_per_slot,
+    const std::vector<CompactPropertyField> &compact_property_fields)
     : n_properties(n_properties_per_slot)
+    , compact_property_fields(compact_property_fields)
+    , compact_properties(compact_property_fields.size())
   {}
 
 
@@ -71,6 +76,12 @@ namespace Particles
     properties.clear();
     properties.shrink_to_fit();
 
+    for (std::vector<unsigned char> &field_properties : compact_properties)
+      {
+        field_properties.clear();
+        field_properties.shrink_to_fit();
+      }
+
     currently_available_handles.clear();
     currently_available_handles.shrink_to_fit();
   }
@@ -95,6 +106,9 @@ namespace Particles
         reference_locations.resize(reference_locations.size() + 1);
         ids.resize(ids.size() + 1);
         properties.resize(properties.size() + n_properties);
+        for (unsigned int f = 0; f < compact_property_fields.size(); ++f)
+          compact_properties[f].resize(compact_properties[f].size() +
+                                       compact_property_fields[f].n_bytes());
       }
 
     // Then initialize whatever slot we have taken with invalid locations,
@@ -104,6 +118,11 @@ namespace Particles
     set_id(handle, numbers::invalid_unsigned_int);
     for (double &x : get_properties(handle))
       x = 0;
+    for (unsigned int f = 0; f < compact_property_fields.size(); ++f)
+      {
+        const std::size_t size = compact_property_fields[f].n_bytes();
+        std::fill_n(compact_properties[f].begin() + handle * size, size, 0);
+      }
 
     return handle;
   }
@@ -136,6 +155,8 @@ namespace Particles
       {
         currently_available_handles.clear();
         properties.clear();
+        for (std::vector<unsigned char> &field_properties : compact_properties)
+          field_properties.clear();
         locations.clear();
         reference_locations.clear();
         ids.clear();
@@ -151,6 +172,9 @@ namespace Particles
     locations.reserve(size);
     reference_locations.reserve(size);
     properties.reserve(size * n_properties);
+    for (unsigned int f = 0; f < compact_property_fields.size(); ++f)
+      compact_properties[f].reserve(size *
+                                    compact_property_fields[f].n_bytes());
     ids.reserve(size);
   }
 
@@ -191,15 +215,19 @@ namespace Particles
   PropertyPool<dim, spacedim>::sort_memory_slots(
     const std::vector<Handle> &handles_to_sort)
   {
-    std::vector<Point<spacedim>>       sorted_locations;
-    std::vector<Point<dim>>            sorted_reference_locations;
-    std::vector<types::particle_index> sorted_ids;
-    std::vector<double>                sorted_properties;
+    std::vector<Point<spacedim>>            sorted_locations;
+    std::vector<Point<dim>>                 sorted_reference_locations;
+    std::vector<types::particle_index>      sorted_ids;
+    std::vector<double>                     sorted_properties;
+    std::vector<std::vector<unsigned char>> sorted_compact_properties(
+      compact_properties.size());
 
     sorted_locations.reserve(locations.size());
     sorted_reference_locations.reserve(reference_locations.size());
     sorted_ids.reserve(ids.size());
     sorted_properties.reserve(properties.size());
+    for (unsigned int f = 0; f < compact_properties.size(); ++f)
+      sorted_compact_properties[f].reserve(compact_properties[f].size());
 
     for (const auto &handle : handles_to_sort)
       {
@@ -213,6 +241,15 @@ namespace Particles
 
         for (unsigned int j = 0; j < n_properties; ++j)
           sorted_properties.push_back(properties[handle * n_properties + j]);
+
+        for (unsigned int f = 0; f < compact_properties.size(); ++f)
+          {
+            const std::size_t size = compact_property_fields[f].n_bytes();
+            const auto        begin =
+              compact_properties[f].begin() + std::size_t(handle) * size;
+            sorted_compact_properties[f].insert(
+              sorted_compact_properties[f].end(), begin, begin + size);
+          }
       }
 
     Assert(sorted_locations.size() ==
@@ -227,6 +264,7 @@ namespace Particles
     reference_locations = std::move(sorted_reference_locations);
     ids                 = std::move(sorted_ids);
     properties          = std::move(sorted_properties);
+    compact_properties  = std::move(sorted_compact_properties);
 
     currently_available_handles.clear();
   }
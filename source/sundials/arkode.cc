@@ -760,6 +760,8 @@ namespace SUNDIALS
 
   template class ARKode<LinearAlgebra::distributed::Vector<double>>;
   template class ARKode<LinearAlgebra::distributed::BlockVector<double>>;
+  template class ARKode<
+    LinearAlgebra::distributed::Vector<double, MemorySpace::Default>>;
 
 #  ifdef DEAL_II_WITH_MPI
 
@@ -588,6 +588,8 @@ namespace SUNDIALS
 
   template class KINSOL<LinearAlgebra::distributed::Vector<double>>;
   template class KINSOL<LinearAlgebra::distributed::BlockVector<double>>;
+  template class KINSOL<
+    LinearAlgebra::distributed::Vector<double, MemorySpace::Default>>;
 
 #  ifdef DEAL_II_WITH_MPI
 
@@ -470,6 +470,8 @@ namespace SUNDIALS
   template struct SundialsOperator<LinearAlgebra::distributed::Vector<double>>;
   template struct SundialsOperator<
     LinearAlgebra::distributed::BlockVector<double>>;
+  template struct SundialsOperator<
+    LinearAlgebra::distributed::Vector<double, MemorySpace::Default>>;
 
   template struct SundialsPreconditioner<Vector<double>>;
   template struct SundialsPreconditioner<BlockVector<double>>;
@@ -477,6 +479,8 @@ namespace SUNDIALS
     LinearAlgebra::distributed::Vector<double>>;
   template struct SundialsPreconditioner<
     LinearAlgebra::distributed::BlockVector<double>>;
+  template struct SundialsPreconditioner<
+    LinearAlgebra::distributed::Vector<double, MemorySpace::Default>>;
 
   template class internal::LinearSolverWrapper<Vector<double>>;
   template class internal::LinearSolverWrapper<BlockVector<double>>;
@@ -484,6 +488,8 @@ namespace SUNDIALS
     LinearAlgebra::distributed::Vector<double>>;
   template class internal::LinearSolverWrapper<
     LinearAlgebra::distributed::BlockVector<double>>;
+  template class internal::LinearSolverWrapper<
+    LinearAlgebra::distributed::Vector<double, MemorySpace::Default>>;
 
 #  ifdef DEAL_II_WITH_MPI
 #    ifdef DEAL_II_WITH_TRILINOS
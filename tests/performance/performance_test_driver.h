@@ -0,0 +1,235 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_tests_performance_test_driver_h
+#define dealii_tests_performance_test_driver_h
+
+// A common driver for the performance tests in this directory. Every test
+// implements the two functions describe_measurements() and
+// perform_single_measurement() declared below. The driver then runs the
+// requested number of measurements and writes a summary with minimum,
+// maximum, average, and standard deviation of every recorded quantity to
+// the output file in a fixed, tab-separated format that can be compared
+// between runs and between different versions of the library by
+// continuous integration tools.
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/revision.h>
+#include <deal.II/base/utilities.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace dealii;
+
+
+/**
+ * The testing environment a performance test runs in, as selected via the
+ * TESTING_ENVIRONMENT variable when configuring the test suite. Tests
+ * choose their problem sizes according to this value.
+ */
+enum class TestingEnvironment
+{
+  /**
+   * A mobile laptop with at least 2 physical cores and 8 GB of memory.
+   */
+  light,
+  /**
+   * A workstation with at least 8 physical cores and 32 GB of memory.
+   */
+  medium,
+  /**
+   * A compute node with at least 32 physical cores and 128 GB of memory.
+   */
+  heavy
+};
+
+
+/**
+ * The quantity recorded by a performance test.
+ */
+enum class Metric
+{
+  /**
+   * Wall clock time in seconds.
+   */
+  timing,
+  /**
+   * A count of operations or instructions, e.g., from hardware counters.
+   */
+  instruction_count
+};
+
+
+/**
+ * The values recorded in a single measurement, one entry per name returned
+ * by describe_measurements().
+ */
+using Measurement = std::vector<double>;
+
+
+/**
+ * Return the metric, the number of measurements, and the names of the
+ * individual quantities recorded in each measurement. To be implemented by
+ * every test.
+ */
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements();
+
+
+/**
+ * Perform a single measurement and return the recorded quantities in the
+ * order given by describe_measurements(). Timings should be the maximum
+ * over all MPI ranks, e.g., by using Utilities::MPI::max(). To be
+ * implemented by every test.
+ */
+Measurement
+perform_single_measurement();
+
+
+
+#define DEAL_II_PERFORMANCE_STRINGIFY_IMPL(x) #x
+#define DEAL_II_PERFORMANCE_STRINGIFY(x) DEAL_II_PERFORMANCE_STRINGIFY_IMPL(x)
+
+
+
+inline TestingEnvironment
+get_testing_environment()
+{
+#ifdef TESTING_ENVIRONMENT
+  const std::string environment =
+    DEAL_II_PERFORMANCE_STRINGIFY(TESTING_ENVIRONMENT);
+#else
+  const std::string environment = "light";
+#endif
+
+  if (environment == "medium")
+    return TestingEnvironment::medium;
+  else if (environment == "heavy")
+    return TestingEnvironment::heavy;
+  else
+    return TestingEnvironment::light;
+}
+
+
+
+inline std::string
+to_string(const TestingEnvironment environment)
+{
+  switch (environment)
+    {
+      case TestingEnvironment::light:
+        return "light";
+      case TestingEnvironment::medium:
+        return "medium";
+      case TestingEnvironment::heavy:
+        return "heavy";
+    }
+  return "";
+}
+
+
+
+inline unsigned int
+testing_max_num_threads()
+{
+  // the test suite sets this variable for tests with a .threads=N. tag
+  if (const char *penv = std::getenv("TEST_N_THREADS"))
+    {
+      const int n_threads = Utilities::string_to_int(std::string(penv));
+      if (n_threads > 0)
+        return n_threads;
+    }
+  return numbers::invalid_unsigned_int;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(
+    argc, argv, testing_max_num_threads());
+
+  const auto [metric, n_measurements, names] = describe_measurements();
+
+  // Without performance testing enabled, the tests are merely run once to
+  // make sure they still work.
+#ifdef ENABLE_PERFORMANCE_TESTS
+  const unsigned int n_runs = std::max(n_measurements, 1u);
+#else
+  const unsigned int n_runs = 1;
+  (void)n_measurements;
+#endif
+
+  std::vector<Measurement> measurements;
+  for (unsigned int i = 0; i < n_runs; ++i)
+    {
+      measurements.emplace_back(perform_single_measurement());
+      AssertThrow(measurements.back().size() == names.size(),
+                  ExcMessage("The number of recorded quantities does not "
+                             "match the names given by "
+                             "describe_measurements()."));
+    }
+
+  if (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+    {
+      std::ofstream out("output");
+      out << "# deal.II " << DEAL_II_PACKAGE_VERSION << " ("
+          << DEAL_II_GIT_SHORTREV << ")" << std::endl
+          << "# environment: " << to_string(get_testing_environment())
+          << std::endl
+          << "# mpi ranks: "
+          << Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD) << std::endl
+          << "# threads: " << MultithreadInfo::n_threads() << std::endl
+          << "# metric: "
+          << (metric == Metric::timing ? "timing" : "instruction_count")
+          << std::endl
+          << "# measurements: " << n_runs << std::endl
+          << "# name\tmin\tmax\tmean\tstddev" << std::endl;
+
+      out << std::scientific << std::setprecision(6);
+      for (unsigned int j = 0; j < names.size(); ++j)
+        {
+          double min = measurements[0][j], max = measurements[0][j], sum = 0.;
+          for (const Measurement &m : measurements)
+            {
+              min = std::min(min, m[j]);
+              max = std::max(max, m[j]);
+              sum += m[j];
+            }
+          const double mean     = sum / n_runs;
+          double       variance = 0.;
+          for (const Measurement &m : measurements)
+            variance += (m[j] - mean) * (m[j] - mean);
+          const double stddev =
+            n_runs > 1 ? std::sqrt(variance / (n_runs - 1)) : 0.;
+
+          out << names[j] << '\t' << min << '\t' << max << '\t' << mean << '\t'
+              << stddev << std::endl;
+        }
+    }
+
+  return 0;
+}
+
+#endif
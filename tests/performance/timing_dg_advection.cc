@@ -0,0 +1,267 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Benchmark of the matrix-free evaluation of a discontinuous Galerkin
+// discretization of the linear advection equation with an upwind flux, as
+// used in explicit time integration similar to step-67. Records the setup
+// of the matrix-free data structures with face integrals, the evaluation of
+// the advection operator with cell and face terms through
+// MatrixFree::loop(), and the application of the cell-wise inverse mass
+// matrix.
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+namespace
+{
+  constexpr int          dim    = 3;
+  constexpr unsigned int degree = 4;
+
+  using Number     = double;
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+
+
+  Tensor<1, dim, VectorizedArray<Number>>
+  advection_speed()
+  {
+    Tensor<1, dim, VectorizedArray<Number>> speed;
+    for (unsigned int d = 0; d < dim; ++d)
+      speed[d] = 1. / (d + 1);
+    return speed;
+  }
+
+
+
+  void
+  apply_advection(const MatrixFree<dim, Number> &matrix_free,
+                  VectorType                    &dst,
+                  const VectorType              &src)
+  {
+    const auto speed = advection_speed();
+
+    matrix_free.loop<VectorType, VectorType>(
+      [&](const MatrixFree<dim, Number>               &data,
+          VectorType                                  &dst,
+          const VectorType                            &src,
+          const std::pair<unsigned int, unsigned int> &cell_range) {
+        FEEvaluation<dim, degree, degree + 1, 1, Number> phi(data);
+        for (unsigned int cell = cell_range.first; cell < cell_range.second;
+             ++cell)
+          {
+            phi.reinit(cell);
+            phi.gather_evaluate(src, EvaluationFlags::values);
+            for (const unsigned int q : phi.quadrature_point_indices())
+              phi.submit_gradient(speed * phi.get_value(q), q);
+            phi.integrate_scatter(EvaluationFlags::gradients, dst);
+          }
+      },
+      [&](const MatrixFree<dim, Number>               &data,
+          VectorType                                  &dst,
+          const VectorType                            &src,
+          const std::pair<unsigned int, unsigned int> &face_range) {
+        FEFaceEvaluation<dim, degree, degree + 1, 1, Number> phi_m(data, true);
+        FEFaceEvaluation<dim, degree, degree + 1, 1, Number> phi_p(data,
+                                                                   false);
+        for (unsigned int face = face_range.first; face < face_range.second;
+             ++face)
+          {
+            phi_m.reinit(face);
+            phi_p.reinit(face);
+            phi_m.gather_evaluate(src, EvaluationFlags::values);
+            phi_p.gather_evaluate(src, EvaluationFlags::values);
+            for (const unsigned int q : phi_m.quadrature_point_indices())
+              {
+                const auto normal_speed = speed * phi_m.normal_vector(q);
+                const auto u_m          = phi_m.get_value(q);
+                const auto u_p          = phi_p.get_value(q);
+                const auto flux =
+                  0.5 * normal_speed * (u_m + u_p) +
+                  0.5 * std::abs(normal_speed) * (u_m - u_p);
+                phi_m.submit_value(-flux, q);
+                phi_p.submit_value(flux, q);
+              }
+            phi_m.integrate_scatter(EvaluationFlags::values, dst);
+            phi_p.integrate_scatter(EvaluationFlags::values, dst);
+          }
+      },
+      [&](const MatrixFree<dim, Number>               &data,
+          VectorType                                  &dst,
+          const VectorType                            &src,
+          const std::pair<unsigned int, unsigned int> &face_range) {
+        // zero inflow data and outflow from the interior value
+        FEFaceEvaluation<dim, degree, degree + 1, 1, Number> phi(data, true);
+        for (unsigned int face = face_range.first; face < face_range.second;
+             ++face)
+          {
+            phi.reinit(face);
+            phi.gather_evaluate(src, EvaluationFlags::values);
+            for (const unsigned int q : phi.quadrature_point_indices())
+              {
+                const auto normal_speed = speed * phi.normal_vector(q);
+                const auto flux =
+                  0.5 * (normal_speed + std::abs(normal_speed)) *
+                  phi.get_value(q);
+                phi.submit_value(-flux, q);
+              }
+            phi.integrate_scatter(EvaluationFlags::values, dst);
+          }
+      },
+      dst,
+      src,
+      true,
+      MatrixFree<dim, Number>::DataAccessOnFaces::values,
+      MatrixFree<dim, Number>::DataAccessOnFaces::values);
+  }
+
+
+
+  void
+  apply_inverse_mass(const MatrixFree<dim, Number> &matrix_free,
+                     VectorType                    &dst,
+                     const VectorType              &src)
+  {
+    matrix_free.cell_loop<VectorType, VectorType>(
+      [](const MatrixFree<dim, Number>               &data,
+         VectorType                                  &dst,
+         const VectorType                            &src,
+         const std::pair<unsigned int, unsigned int> &cell_range) {
+        FEEvaluation<dim, degree, degree + 1, 1, Number> phi(data);
+        MatrixFreeOperators::CellwiseInverseMassMatrix<dim, degree, 1, Number>
+          inverse(phi);
+        for (unsigned int cell = cell_range.first; cell < cell_range.second;
+             ++cell)
+          {
+            phi.reinit(cell);
+            phi.read_dof_values(src);
+            inverse.apply(phi.begin_dof_values(), phi.begin_dof_values());
+            phi.set_dof_values(dst);
+          }
+      },
+      dst,
+      src);
+  }
+} // namespace
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"setup_system", "advection_operator", "inverse_mass_matrix"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  unsigned int n_refinements = 3;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        n_refinements = 3;
+        break;
+      case TestingEnvironment::medium:
+        n_refinements = 4;
+        break;
+      case TestingEnvironment::heavy:
+        n_refinements = 5;
+        break;
+    }
+
+  const MPI_Comm comm = MPI_COMM_WORLD;
+  Timer          timer(comm);
+
+  parallel::distributed::Triangulation<dim> triangulation(comm);
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(n_refinements);
+
+  // use a deformed mesh to measure the general case of non-affine geometry
+  GridTools::transform(
+    [](const Point<dim> &p) {
+      Point<dim> q = p;
+      for (unsigned int d = 0; d < dim; ++d)
+        q[d] += 0.05 * std::sin(numbers::PI * p[(d + 1) % dim]);
+      return q;
+    },
+    triangulation);
+
+  const FE_DGQ<dim>   fe(degree);
+  const MappingQ<dim> mapping(3);
+  DoFHandler<dim>     dof_handler(triangulation);
+
+  timer.restart();
+  dof_handler.distribute_dofs(fe);
+
+  MatrixFree<dim, Number>                          matrix_free;
+  typename MatrixFree<dim, Number>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_gradients | update_JxW_values;
+  additional_data.mapping_update_flags_inner_faces =
+    update_values | update_normal_vectors | update_JxW_values;
+  additional_data.mapping_update_flags_boundary_faces =
+    update_values | update_normal_vectors | update_JxW_values;
+  matrix_free.reinit(mapping,
+                     dof_handler,
+                     AffineConstraints<double>(),
+                     QGauss<1>(degree + 1),
+                     additional_data);
+  const double time_setup = timer.wall_time();
+
+  VectorType src, dst;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    src.local_element(i) = (i % 11) * 0.1;
+
+  const unsigned int n_repetitions = 20;
+
+  timer.restart();
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    apply_advection(matrix_free, dst, src);
+  const double time_advection = timer.wall_time() / n_repetitions;
+
+  timer.restart();
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    apply_inverse_mass(matrix_free, src, dst);
+  const double time_inverse_mass = timer.wall_time() / n_repetitions;
+
+  return {Utilities::MPI::max(time_setup, comm),
+          Utilities::MPI::max(time_advection, comm),
+          Utilities::MPI::max(time_inverse_mass, comm)};
+}
@@ -0,0 +1,197 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Benchmark of a classical matrix-based finite element assembly for
+// linear elasticity with FEValues, similar to step-8, run in parallel on
+// the threads of the machine through MeshWorker::mesh_loop(). Records the
+// time to distribute the degrees of freedom and build the sparsity pattern,
+// the assembly of the system matrix and right hand side, and a matrix-vector
+// product with the assembled matrix.
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/fe_values_extractors.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/meshworker/copy_data.h>
+#include <deal.II/meshworker/mesh_loop.h>
+#include <deal.II/meshworker/scratch_data.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+namespace
+{
+  constexpr int          dim    = 3;
+  constexpr unsigned int degree = 2;
+} // namespace
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"setup_system", "assemble_system", "matrix_vector_product"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  unsigned int n_refinements = 3;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        n_refinements = 3;
+        break;
+      case TestingEnvironment::medium:
+        n_refinements = 4;
+        break;
+      case TestingEnvironment::heavy:
+        n_refinements = 5;
+        break;
+    }
+
+  Timer timer;
+
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation, -1., 1.);
+  triangulation.refine_global(n_refinements);
+
+  const FESystem<dim> fe(FE_Q<dim>(degree) ^ dim);
+  DoFHandler<dim>     dof_handler(triangulation);
+
+  timer.restart();
+  dof_handler.distribute_dofs(fe);
+  DoFRenumbering::Cuthill_McKee(dof_handler);
+
+  AffineConstraints<double> constraints;
+  VectorTools::interpolate_boundary_values(dof_handler,
+                                           0,
+                                           Functions::ZeroFunction<dim>(dim),
+                                           constraints);
+  constraints.close();
+
+  SparsityPattern sparsity_pattern;
+  {
+    DynamicSparsityPattern dsp(dof_handler.n_dofs());
+    DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints, false);
+    sparsity_pattern.copy_from(dsp);
+  }
+
+  SparseMatrix<double> system_matrix(sparsity_pattern);
+  Vector<double>       system_rhs(dof_handler.n_dofs());
+  const double         time_setup = timer.wall_time();
+
+  // assemble the isotropic elasticity operator with Lame parameters
+  // lambda=mu=1 and a constant body force
+  timer.restart();
+  const QGauss<dim>                quadrature(degree + 1);
+  const FEValuesExtractors::Vector displacements(0);
+  const double                     lambda = 1., mu = 1.;
+
+  MeshWorker::ScratchData<dim>  scratch(fe,
+                                       quadrature,
+                                       update_values | update_gradients |
+                                         update_JxW_values);
+  MeshWorker::CopyData<1, 1, 1> copy(fe.n_dofs_per_cell());
+
+  const auto cell_worker =
+    [&](const typename DoFHandler<dim>::active_cell_iterator &cell,
+        MeshWorker::ScratchData<dim>                         &scratch_data,
+        MeshWorker::CopyData<1, 1, 1>                        &copy_data) {
+      const FEValues<dim> &fe_values     = scratch_data.reinit(cell);
+      const unsigned int   dofs_per_cell = fe_values.dofs_per_cell;
+
+      copy_data.matrices[0] = 0.;
+      copy_data.vectors[0]  = 0.;
+      cell->get_dof_indices(copy_data.local_dof_indices[0]);
+
+      std::vector<SymmetricTensor<2, dim>> symgrad_phi(dofs_per_cell);
+      std::vector<double>                  div_phi(dofs_per_cell);
+      std::vector<Tensor<1, dim>>          phi(dofs_per_cell);
+      for (const unsigned int q : fe_values.quadrature_point_indices())
+        {
+          for (unsigned int i = 0; i < dofs_per_cell; ++i)
+            {
+              symgrad_phi[i] =
+                fe_values[displacements].symmetric_gradient(i, q);
+              div_phi[i] = fe_values[displacements].divergence(i, q);
+              phi[i]     = fe_values[displacements].value(i, q);
+            }
+
+          const double JxW = fe_values.JxW(q);
+          for (unsigned int i = 0; i < dofs_per_cell; ++i)
+            {
+              for (unsigned int j = 0; j < dofs_per_cell; ++j)
+                copy_data.matrices[0](i, j) +=
+                  (2. * mu * (symgrad_phi[i] * symgrad_phi[j]) +
+                   lambda * div_phi[i] * div_phi[j]) *
+                  JxW;
+              copy_data.vectors[0](i) += phi[i][0] * JxW;
+            }
+        }
+    };
+
+  const auto copier = [&](const MeshWorker::CopyData<1, 1, 1> &copy_data) {
+    constraints.distribute_local_to_global(copy_data.matrices[0],
+                                           copy_data.vectors[0],
+                                           copy_data.local_dof_indices[0],
+                                           system_matrix,
+                                           system_rhs);
+  };
+
+  MeshWorker::mesh_loop(dof_handler.begin_active(),
+                        dof_handler.end(),
+                        cell_worker,
+                        copier,
+                        scratch,
+                        copy,
+                        MeshWorker::assemble_own_cells);
+  const double time_assemble = timer.wall_time();
+
+  // matrix-vector product with the assembled matrix
+  Vector<double>     dst(dof_handler.n_dofs());
+  const unsigned int n_repetitions = 20;
+  timer.restart();
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    system_matrix.vmult(dst, system_rhs);
+  const double time_vmult = timer.wall_time() / n_repetitions;
+
+  return {time_setup, time_assemble, time_vmult};
+}
@@ -0,0 +1,448 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Microbenchmark of the evaluation kernels behind FEEvaluation::evaluate()
+// and FEEvaluation::integrate(), i.e., the sum-factorization kernels in
+// evaluation_kernels.h and the hanging-node interpolation in
+// evaluation_kernels_hanging_nodes.h. The benchmark sweeps over the
+// polynomial degree, the number of quadrature points, the evaluation flags,
+// and the width of the vectorized data type for FE_Q and FE_DGQ elements,
+// over the polynomial degree of FE_SimplexP elements, and runs a full cell
+// loop on a mesh with hanging nodes. The recorded quantity is the time per
+// degree of freedom of a single core. On the standard output, the
+// benchmark additionally prints the throughput in DoFs/s and, on x86, the
+// number of time-stamp counter cycles per DoF to compare architectures.
+//
+// The kernel benchmarks repeatedly work on the first cell batch, so the
+// data is in the L1 cache and the numbers represent the arithmetic
+// throughput of the kernels. The degrees of freedom are reset from a copy
+// before every evaluation to keep the values in the normal floating point
+// range, which adds a small but constant overhead.
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_simplex_p.h>
+#include <deal.II/fe/mapping_fe.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <functional>
+#include <iostream>
+
+#if defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#endif
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+namespace
+{
+  constexpr int          dim        = 3;
+  constexpr unsigned int max_degree = 6;
+
+  using VectorizedArrayScalar = VectorizedArray<double, 1>;
+  using VectorizedArrayWide   = VectorizedArray<double>;
+
+
+
+  /**
+   * A single benchmark, returning the time and the number of cycles per
+   * degree of freedom.
+   */
+  struct Benchmark
+  {
+    std::string                                name;
+    std::function<std::pair<double, double>()> run;
+  };
+
+
+
+  std::uint64_t
+  read_cycle_counter()
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+  }
+
+
+
+  // Run the given kernel often enough to process a fixed number of degrees
+  // of freedom, and return the time and cycles per degree of freedom
+  std::pair<double, double>
+  measure(const std::function<void()> &kernel, const double n_dofs_per_call)
+  {
+    const double target_n_dofs =
+      get_testing_environment() == TestingEnvironment::light ? 2e7 : 1e8;
+    const unsigned int n_calls =
+      std::max(1., std::round(target_n_dofs / n_dofs_per_call));
+
+    // warm up caches and the branch predictor
+    kernel();
+
+    Timer               timer;
+    const std::uint64_t cycles_start = read_cycle_counter();
+    for (unsigned int i = 0; i < n_calls; ++i)
+      kernel();
+    const std::uint64_t cycles_end = read_cycle_counter();
+    const double        time       = timer.wall_time();
+
+    const double n_dofs = n_dofs_per_call * n_calls;
+    return {time / n_dofs, static_cast<double>(cycles_end - cycles_start) /
+                             n_dofs};
+  }
+
+
+
+  std::string
+  flags_name(const EvaluationFlags::EvaluationFlags flags)
+  {
+    return (flags & EvaluationFlags::gradients) ? "values_gradients" :
+                                                  "values";
+  }
+
+
+
+  // Apply the kernels of FEEvaluation::evaluate() and
+  // FEEvaluation::integrate() to the degrees of freedom of the first cell
+  // batch, with the geometry operations at quadrature points in between
+  template <typename FEEvaluationType>
+  std::pair<double, double>
+  measure_cell_kernel(FEEvaluationType                      &phi,
+                      const EvaluationFlags::EvaluationFlags flags)
+  {
+    using VectorizedArrayType = typename FEEvaluationType::NumberType;
+
+    phi.reinit(0);
+    const unsigned int                 dofs_per_cell = phi.dofs_per_cell;
+    AlignedVector<VectorizedArrayType> dof_values(dofs_per_cell);
+    for (unsigned int i = 0; i < dofs_per_cell; ++i)
+      dof_values[i] = 1. + 0.1 * (i % 7);
+
+    const auto kernel = [&]() {
+      std::copy(dof_values.begin(), dof_values.end(), phi.begin_dof_values());
+      phi.evaluate(flags);
+      for (const unsigned int q : phi.quadrature_point_indices())
+        {
+          if (flags & EvaluationFlags::values)
+            phi.submit_value(phi.get_value(q), q);
+          if (flags & EvaluationFlags::gradients)
+            phi.submit_gradient(phi.get_gradient(q), q);
+        }
+      phi.integrate(flags);
+    };
+
+    return measure(kernel,
+                   static_cast<double>(dofs_per_cell) *
+                     VectorizedArrayType::size());
+  }
+
+
+
+  // A mesh of a slightly deformed cube, to measure the general case of
+  // geometry information at every quadrature point
+  void
+  create_mesh(Triangulation<dim> &triangulation, const bool with_simplices)
+  {
+    if (with_simplices)
+      GridGenerator::subdivided_hyper_cube_with_simplices(triangulation, 2);
+    else
+      {
+        GridGenerator::hyper_cube(triangulation);
+        triangulation.refine_global(1);
+      }
+    GridTools::transform(
+      [](const Point<dim> &p) {
+        Point<dim> q = p;
+        for (unsigned int d = 0; d < dim; ++d)
+          q[d] += 0.05 * std::sin(numbers::PI * p[(d + 1) % dim]);
+        return q;
+      },
+      triangulation);
+  }
+
+
+
+  template <int degree, int n_q_points_1d, typename VectorizedArrayType>
+  std::pair<double, double>
+  run_tensor_product_kernel(const bool                             is_dg,
+                            const EvaluationFlags::EvaluationFlags flags)
+  {
+    Triangulation<dim> triangulation;
+    create_mesh(triangulation, false);
+
+    std::unique_ptr<FiniteElement<dim>> fe;
+    if (is_dg)
+      fe = std::make_unique<FE_DGQ<dim>>(degree);
+    else
+      fe = std::make_unique<FE_Q<dim>>(degree);
+    DoFHandler<dim> dof_handler(triangulation);
+    dof_handler.distribute_dofs(*fe);
+
+    MatrixFree<dim, double, VectorizedArrayType> matrix_free;
+    typename MatrixFree<dim, double, VectorizedArrayType>::AdditionalData
+      additional_data;
+    additional_data.mapping_update_flags =
+      update_values | update_gradients | update_JxW_values;
+    matrix_free.reinit(MappingQ1<dim>(),
+                       dof_handler,
+                       AffineConstraints<double>(),
+                       QGauss<1>(n_q_points_1d),
+                       additional_data);
+
+    FEEvaluation<dim, degree, n_q_points_1d, 1, double, VectorizedArrayType>
+      phi(matrix_free);
+    return measure_cell_kernel(phi, flags);
+  }
+
+
+
+  template <typename VectorizedArrayType>
+  std::pair<double, double>
+  run_simplex_kernel(const unsigned int                     degree,
+                     const EvaluationFlags::EvaluationFlags flags)
+  {
+    Triangulation<dim> triangulation;
+    create_mesh(triangulation, true);
+
+    const FE_SimplexP<dim> fe(degree);
+    DoFHandler<dim>        dof_handler(triangulation);
+    dof_handler.distribute_dofs(fe);
+
+    MatrixFree<dim, double, VectorizedArrayType> matrix_free;
+    typename MatrixFree<dim, double, VectorizedArrayType>::AdditionalData
+      additional_data;
+    additional_data.mapping_update_flags =
+      update_values | update_gradients | update_JxW_values;
+    matrix_free.reinit(MappingFE<dim>(FE_SimplexP<dim>(1)),
+                       dof_handler,
+                       AffineConstraints<double>(),
+                       QGaussSimplex<dim>(degree + 1),
+                       additional_data);
+
+    FEEvaluation<dim, -1, 0, 1, double, VectorizedArrayType> phi(matrix_free);
+    return measure_cell_kernel(phi, flags);
+  }
+
+
+
+  // A full cell loop with reading and writing vector entries on a mesh
+  // where half of the cells have hanging nodes, which invokes the
+  // hanging-node interpolation within FEEvaluation::read_dof_values() and
+  // FEEvaluation::distribute_local_to_global()
+  template <int degree, typename VectorizedArrayType>
+  std::pair<double, double>
+  run_hanging_node_loop()
+  {
+    Triangulation<dim> triangulation;
+    GridGenerator::hyper_cube(triangulation);
+    triangulation.refine_global(2);
+    for (const auto &cell : triangulation.active_cell_iterators())
+      if (cell->center()[0] < 0.5)
+        cell->set_refine_flag();
+    triangulation.execute_coarsening_and_refinement();
+
+    const FE_Q<dim> fe(degree);
+    DoFHandler<dim> dof_handler(triangulation);
+    dof_handler.distribute_dofs(fe);
+
+    AffineConstraints<double> constraints;
+    DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+    constraints.close();
+
+    MatrixFree<dim, double, VectorizedArrayType> matrix_free;
+    typename MatrixFree<dim, double, VectorizedArrayType>::AdditionalData
+      additional_data;
+    additional_data.mapping_update_flags = update_gradients | update_JxW_values;
+    matrix_free.reinit(MappingQ1<dim>(),
+                       dof_handler,
+                       constraints,
+                       QGauss<1>(degree + 1),
+                       additional_data);
+
+    using VectorType = LinearAlgebra::distributed::Vector<double>;
+    VectorType src, dst;
+    matrix_free.initialize_dof_vector(src);
+    matrix_free.initialize_dof_vector(dst);
+    for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+      src.local_element(i) = 1. + 0.1 * (i % 7);
+
+    FEEvaluation<dim, degree, degree + 1, 1, double, VectorizedArrayType> phi(
+      matrix_free);
+    const auto kernel = [&]() {
+      dst = 0.;
+      for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values(src);
+          phi.evaluate(EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            phi.submit_gradient(phi.get_gradient(q), q);
+          phi.integrate(EvaluationFlags::gradients);
+          phi.distribute_local_to_global(dst);
+        }
+    };
+
+    return measure(kernel,
+                   static_cast<double>(matrix_free.n_cell_batches()) *
+                     VectorizedArrayType::size() * fe.n_dofs_per_cell());
+  }
+
+
+
+  template <typename VectorizedArrayType>
+  std::string
+  width_name()
+  {
+    return "w" + std::to_string(VectorizedArrayType::size());
+  }
+
+
+
+  template <int degree, typename VectorizedArrayType>
+  void
+  add_benchmarks_of_degree(std::vector<Benchmark> &benchmarks)
+  {
+    const std::string k = "_k" + std::to_string(degree);
+    const std::string w = "_" + width_name<VectorizedArrayType>();
+
+    for (const bool is_dg : {false, true})
+      for (const EvaluationFlags::EvaluationFlags flags :
+           {EvaluationFlags::values,
+            EvaluationFlags::values | EvaluationFlags::gradients})
+        {
+          const std::string prefix = (is_dg ? "FE_DGQ" : "FE_Q") + k;
+          benchmarks.push_back(
+            {prefix + "_q" + std::to_string(degree + 1) + "_" +
+               flags_name(flags) + w,
+             [=]() {
+               return run_tensor_product_kernel<degree,
+                                                degree + 1,
+                                                VectorizedArrayType>(is_dg,
+                                                                     flags);
+             }});
+          benchmarks.push_back(
+            {prefix + "_q" + std::to_string(degree + 2) + "_" +
+               flags_name(flags) + w,
+             [=]() {
+               return run_tensor_product_kernel<degree,
+                                                degree + 2,
+                                                VectorizedArrayType>(is_dg,
+                                                                     flags);
+             }});
+        }
+
+    benchmarks.push_back(
+      {"FE_Q_hanging" + k + "_q" + std::to_string(degree + 1) +
+         "_gradients" + w,
+       []() { return run_hanging_node_loop<degree, VectorizedArrayType>(); }});
+
+    if constexpr (degree < max_degree)
+      add_benchmarks_of_degree<degree + 1, VectorizedArrayType>(benchmarks);
+  }
+
+
+
+  template <typename VectorizedArrayType>
+  void
+  add_benchmarks_of_width(std::vector<Benchmark> &benchmarks)
+  {
+    add_benchmarks_of_degree<1, VectorizedArrayType>(benchmarks);
+
+    for (unsigned int degree = 1; degree <= 3; ++degree)
+      for (const EvaluationFlags::EvaluationFlags flags :
+           {EvaluationFlags::values,
+            EvaluationFlags::values | EvaluationFlags::gradients})
+        benchmarks.push_back(
+          {"FE_SimplexP_k" + std::to_string(degree) + "_q" +
+             std::to_string(degree + 1) + "_" + flags_name(flags) + "_" +
+             width_name<VectorizedArrayType>(),
+           [=]() {
+             return run_simplex_kernel<VectorizedArrayType>(degree, flags);
+           }});
+  }
+
+
+
+  const std::vector<Benchmark> &
+  get_benchmarks()
+  {
+    static const std::vector<Benchmark> benchmarks = []() {
+      std::vector<Benchmark> benchmarks;
+      add_benchmarks_of_width<VectorizedArrayScalar>(benchmarks);
+      if constexpr (VectorizedArrayWide::size() > 1)
+        add_benchmarks_of_width<VectorizedArrayWide>(benchmarks);
+      return benchmarks;
+    }();
+    return benchmarks;
+  }
+} // namespace
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  std::vector<std::string> names;
+  for (const Benchmark &benchmark : get_benchmarks())
+    names.push_back(benchmark.name);
+
+  return {Metric::timing, 3, names};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  const bool print = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0;
+  if (print)
+    std::cout << std::left << std::setw(44) << "kernel" << std::right
+              << std::setw(14) << "DoFs/s" << std::setw(14) << "cycles/DoF"
+              << std::endl;
+
+  Measurement measurement;
+  for (const Benchmark &benchmark : get_benchmarks())
+    {
+      const auto [time_per_dof, cycles_per_dof] = benchmark.run();
+      measurement.push_back(time_per_dof);
+      if (print)
+        std::cout << std::left << std::setw(44) << benchmark.name
+                  << std::right << std::setw(14) << std::setprecision(4)
+                  << 1. / time_per_dof << std::setw(14) << cycles_per_dof
+                  << std::endl;
+    }
+
+  return measurement;
+}
@@ -0,0 +1,142 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Benchmark of the parallel graphical output of a distributed finite
+// element field with DataOut. Records the time to build the patches of
+// higher-order output, the generation of a single VTU file with MPI I/O
+// through DataOutInterface::write_vtu_in_parallel(), and the output into
+// one file per process with a PVTU record through
+// DataOutInterface::write_vtu_with_pvtu_record().
+
+#include <deal.II/base/function_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/numerics/data_out.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <cstdio>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+namespace
+{
+  constexpr int          dim    = 3;
+  constexpr unsigned int degree = 2;
+} // namespace
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"build_patches",
+           "write_vtu_in_parallel",
+           "write_vtu_with_pvtu_record"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  unsigned int n_refinements = 4;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        n_refinements = 4;
+        break;
+      case TestingEnvironment::medium:
+        n_refinements = 5;
+        break;
+      case TestingEnvironment::heavy:
+        n_refinements = 6;
+        break;
+    }
+
+  const MPI_Comm comm = MPI_COMM_WORLD;
+  Timer          timer(comm);
+
+  parallel::distributed::Triangulation<dim> triangulation(comm);
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(n_refinements);
+
+  const FE_Q<dim>      fe(degree);
+  const MappingQ1<dim> mapping;
+  DoFHandler<dim>      dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  LinearAlgebra::distributed::Vector<double> solution(
+    dof_handler.locally_owned_dofs(),
+    DoFTools::extract_locally_relevant_dofs(dof_handler),
+    comm);
+  VectorTools::interpolate(mapping,
+                           dof_handler,
+                           Functions::CosineFunction<dim>(),
+                           solution);
+  solution.update_ghost_values();
+
+  timer.restart();
+  DataOut<dim> data_out;
+  data_out.attach_dof_handler(dof_handler);
+  data_out.add_data_vector(solution, "solution");
+  data_out.build_patches(mapping, degree);
+  const double time_build_patches = timer.wall_time();
+
+  timer.restart();
+  data_out.write_vtu_in_parallel("timing_parallel_io.vtu", comm);
+  const double time_write_single = timer.wall_time();
+
+  timer.restart();
+  const std::string pvtu_name =
+    data_out.write_vtu_with_pvtu_record("./", "timing_parallel_io", 0, comm);
+  const double time_write_record = timer.wall_time();
+
+  // remove the output again so that repeated measurements do not fill up
+  // the disk
+  MPI_Barrier(comm);
+  const unsigned int this_process = Utilities::MPI::this_mpi_process(comm);
+  std::remove(("timing_parallel_io_0." +
+               Utilities::int_to_string(
+                 this_process,
+                 Utilities::needed_digits(
+                   Utilities::MPI::n_mpi_processes(comm) - 1)) +
+               ".vtu")
+                .c_str());
+  if (this_process == 0)
+    {
+      std::remove("timing_parallel_io.vtu");
+      std::remove(pvtu_name.c_str());
+    }
+
+  return {Utilities::MPI::max(time_build_patches, comm),
+          Utilities::MPI::max(time_write_single, comm),
+          Utilities::MPI::max(time_write_record, comm)};
+}
@@ -0,0 +1,132 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Benchmark of the advection of particles through a distributed mesh with
+// a prescribed vortical velocity field, similar to step-68. Records the
+// generation of the particles, the update of the particle locations with
+// an explicit Euler step, and the search for the new cells and owners of
+// the particles in ParticleHandler::sort_particles_into_subdomains_and_cells().
+
+#include <deal.II/base/timer.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/particles/generators.h>
+#include <deal.II/particles/particle_handler.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+namespace
+{
+  constexpr int dim = 2;
+
+
+
+  // A rotating flow field that keeps the particles inside the unit square
+  Tensor<1, dim>
+  velocity(const Point<dim> &p)
+  {
+    Tensor<1, dim> u;
+    u[0] = -std::sin(numbers::PI * p[0]) * std::sin(numbers::PI * p[0]) *
+           std::sin(2. * numbers::PI * p[1]);
+    u[1] = std::sin(numbers::PI * p[1]) * std::sin(numbers::PI * p[1]) *
+           std::sin(2. * numbers::PI * p[0]);
+    return u;
+  }
+} // namespace
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"generate_particles", "advect_particles", "sort_particles"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  unsigned int n_refinements             = 6;
+  unsigned int n_particles_per_direction = 4;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        n_refinements = 6;
+        break;
+      case TestingEnvironment::medium:
+        n_refinements = 8;
+        break;
+      case TestingEnvironment::heavy:
+        n_refinements             = 9;
+        n_particles_per_direction = 6;
+        break;
+    }
+
+  const MPI_Comm comm = MPI_COMM_WORLD;
+  Timer          timer(comm);
+
+  parallel::distributed::Triangulation<dim> triangulation(comm);
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(n_refinements);
+
+  const MappingQ1<dim> mapping;
+
+  timer.restart();
+  Particles::ParticleHandler<dim> particle_handler(triangulation, mapping);
+  std::vector<Point<dim>>         reference_locations;
+  for (unsigned int j = 0; j < n_particles_per_direction; ++j)
+    for (unsigned int i = 0; i < n_particles_per_direction; ++i)
+      reference_locations.emplace_back((i + 0.5) / n_particles_per_direction,
+                                       (j + 0.5) / n_particles_per_direction);
+  Particles::Generators::regular_reference_locations(triangulation,
+                                                     reference_locations,
+                                                     particle_handler,
+                                                     mapping);
+  const double time_generate = timer.wall_time();
+
+  // advect the particles with a time step that moves them across a few
+  // cells in total, sorting them into the new cells after each step
+  const unsigned int n_steps     = 10;
+  const double       dt          = 0.2 / n_steps;
+  double             time_advect = 0., time_sort = 0.;
+  for (unsigned int step = 0; step < n_steps; ++step)
+    {
+      timer.restart();
+      for (auto &particle : particle_handler)
+        {
+          const Point<dim> location = particle.get_location();
+          particle.set_location(location + dt * velocity(location));
+        }
+      time_advect += timer.wall_time();
+
+      timer.restart();
+      particle_handler.sort_particles_into_subdomains_and_cells();
+      time_sort += timer.wall_time();
+    }
+
+  return {Utilities::MPI::max(time_generate, comm),
+          Utilities::MPI::max(time_advect / n_steps, comm),
+          Utilities::MPI::max(time_sort / n_steps, comm)};
+}
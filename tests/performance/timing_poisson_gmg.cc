@@ -0,0 +1,261 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Benchmark of a matrix-free Poisson solver with a geometric multigrid
+// preconditioner and Chebyshev smoothing on a uniformly refined cube, as
+// in step-37. Records the time to distribute the degrees of freedom and
+// set up the matrix-free data structures on all levels, the setup of the
+// multigrid preconditioner, the conjugate gradient solve, and a single
+// application of the fine-level operator.
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+
+#include <deal.II/multigrid/mg_coarse.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/mg_smoother.h>
+#include <deal.II/multigrid/mg_tools.h>
+#include <deal.II/multigrid/mg_transfer_matrix_free.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+namespace
+{
+  constexpr int          dim    = 3;
+  constexpr unsigned int degree = 4;
+
+  using SystemMatrixType = MatrixFreeOperators::LaplaceOperator<
+    dim,
+    degree,
+    degree + 1,
+    1,
+    LinearAlgebra::distributed::Vector<double>>;
+  using LevelMatrixType = MatrixFreeOperators::LaplaceOperator<
+    dim,
+    degree,
+    degree + 1,
+    1,
+    LinearAlgebra::distributed::Vector<float>>;
+} // namespace
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"setup_system",
+           "setup_multigrid",
+           "solve",
+           "matrix_vector_product"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  unsigned int n_refinements = 4;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        n_refinements = 4;
+        break;
+      case TestingEnvironment::medium:
+        n_refinements = 5;
+        break;
+      case TestingEnvironment::heavy:
+        n_refinements = 6;
+        break;
+    }
+
+  const MPI_Comm comm = MPI_COMM_WORLD;
+  Timer          timer(comm);
+
+  parallel::distributed::Triangulation<dim> triangulation(
+    comm,
+    Triangulation<dim>::limit_level_difference_at_vertices,
+    parallel::distributed::Triangulation<
+      dim>::construct_multigrid_hierarchy);
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(n_refinements);
+
+  const FE_Q<dim>      fe(degree);
+  const MappingQ1<dim> mapping;
+  DoFHandler<dim>      dof_handler(triangulation);
+
+  // distribute the degrees of freedom and set up the matrix-free data
+  // structures on the active cells and all levels
+  timer.restart();
+  dof_handler.distribute_dofs(fe);
+  dof_handler.distribute_mg_dofs();
+
+  AffineConstraints<double> constraints(
+    dof_handler.locally_owned_dofs(),
+    DoFTools::extract_locally_relevant_dofs(dof_handler));
+  VectorTools::interpolate_boundary_values(
+    mapping, dof_handler, 0, Functions::ZeroFunction<dim>(), constraints);
+  constraints.close();
+
+  SystemMatrixType system_matrix;
+  {
+    typename MatrixFree<dim, double>::AdditionalData additional_data;
+    additional_data.mapping_update_flags = update_gradients | update_JxW_values;
+    const auto matrix_free = std::make_shared<MatrixFree<dim, double>>();
+    matrix_free->reinit(mapping,
+                        dof_handler,
+                        constraints,
+                        QGauss<1>(degree + 1),
+                        additional_data);
+    system_matrix.initialize(matrix_free);
+  }
+
+  const unsigned int n_levels = triangulation.n_global_levels();
+
+  MGConstrainedDoFs mg_constrained_dofs;
+  mg_constrained_dofs.initialize(dof_handler);
+  mg_constrained_dofs.make_zero_boundary_constraints(dof_handler, {0});
+
+  MGLevelObject<LevelMatrixType> mg_matrices(0, n_levels - 1);
+  for (unsigned int level = 0; level < n_levels; ++level)
+    {
+      AffineConstraints<float> level_constraints(
+        dof_handler.locally_owned_mg_dofs(level),
+        DoFTools::extract_locally_relevant_level_dofs(dof_handler, level));
+      for (const types::global_dof_index dof_index :
+           mg_constrained_dofs.get_boundary_indices(level))
+        level_constraints.constrain_dof_to_zero(dof_index);
+      level_constraints.close();
+
+      typename MatrixFree<dim, float>::AdditionalData additional_data;
+      additional_data.mapping_update_flags =
+        update_gradients | update_JxW_values;
+      additional_data.mg_level = level;
+      const auto matrix_free = std::make_shared<MatrixFree<dim, float>>();
+      matrix_free->reinit(mapping,
+                          dof_handler,
+                          level_constraints,
+                          QGauss<1>(degree + 1),
+                          additional_data);
+      mg_matrices[level].initialize(matrix_free, mg_constrained_dofs, level);
+    }
+  const double time_setup_system = timer.wall_time();
+
+  // set up the multigrid preconditioner
+  timer.restart();
+  MGTransferMatrixFree<dim, float> mg_transfer(mg_constrained_dofs);
+  mg_transfer.build(dof_handler);
+
+  using SmootherType =
+    PreconditionChebyshev<LevelMatrixType,
+                          LinearAlgebra::distributed::Vector<float>>;
+  mg::SmootherRelaxation<SmootherType,
+                         LinearAlgebra::distributed::Vector<float>>
+                                                       mg_smoother;
+  MGLevelObject<typename SmootherType::AdditionalData> smoother_data(
+    0, n_levels - 1);
+  for (unsigned int level = 0; level < n_levels; ++level)
+    {
+      if (level > 0)
+        {
+          smoother_data[level].smoothing_range     = 15.;
+          smoother_data[level].degree              = 5;
+          smoother_data[level].eig_cg_n_iterations = 10;
+        }
+      else
+        {
+          smoother_data[0].smoothing_range     = 1e-3;
+          smoother_data[0].degree              = numbers::invalid_unsigned_int;
+          smoother_data[0].eig_cg_n_iterations = mg_matrices[0].m();
+        }
+      mg_matrices[level].compute_diagonal();
+      smoother_data[level].preconditioner =
+        mg_matrices[level].get_matrix_diagonal_inverse();
+    }
+  mg_smoother.initialize(mg_matrices, smoother_data);
+
+  MGCoarseGridApplySmoother<LinearAlgebra::distributed::Vector<float>>
+    mg_coarse;
+  mg_coarse.initialize(mg_smoother);
+
+  mg::Matrix<LinearAlgebra::distributed::Vector<float>> mg_matrix(
+    mg_matrices);
+
+  MGLevelObject<MatrixFreeOperators::MGInterfaceOperator<LevelMatrixType>>
+    mg_interface_matrices(0, n_levels - 1);
+  for (unsigned int level = 0; level < n_levels; ++level)
+    mg_interface_matrices[level].initialize(mg_matrices[level]);
+  mg::Matrix<LinearAlgebra::distributed::Vector<float>> mg_interface(
+    mg_interface_matrices);
+
+  Multigrid<LinearAlgebra::distributed::Vector<float>> mg(
+    mg_matrix, mg_coarse, mg_transfer, mg_smoother, mg_smoother);
+  mg.set_edge_matrices(mg_interface, mg_interface);
+
+  PreconditionMG<dim,
+                 LinearAlgebra::distributed::Vector<float>,
+                 MGTransferMatrixFree<dim, float>>
+    preconditioner(dof_handler, mg, mg_transfer);
+  const double time_setup_multigrid = timer.wall_time();
+
+  // solve with a constant right hand side
+  LinearAlgebra::distributed::Vector<double> solution, system_rhs;
+  system_matrix.initialize_dof_vector(solution);
+  system_matrix.initialize_dof_vector(system_rhs);
+  system_rhs = 1.;
+  constraints.set_zero(system_rhs);
+
+  timer.restart();
+  SolverControl solver_control(100, 1e-10 * system_rhs.l2_norm());
+  SolverCG<LinearAlgebra::distributed::Vector<double>> cg(solver_control);
+  cg.solve(system_matrix, solution, system_rhs, preconditioner);
+  const double time_solve = timer.wall_time();
+
+  // time the operator evaluation alone, averaged over several applications
+  const unsigned int n_repetitions = 20;
+  timer.restart();
+  for (unsigned int i = 0; i < n_repetitions; ++i)
+    system_matrix.vmult(system_rhs, solution);
+  const double time_vmult = timer.wall_time() / n_repetitions;
+
+  return {Utilities::MPI::max(time_setup_system, comm),
+          Utilities::MPI::max(time_setup_multigrid, comm),
+          Utilities::MPI::max(time_solve, comm),
+          Utilities::MPI::max(time_vmult, comm)};
+}
@@ -0,0 +1,218 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Benchmark of the setup phase of a parallel finite element computation,
+// for both a strong scaling setting where the global problem size is fixed
+// and a weak scaling setting where the number of cells per MPI process is
+// fixed. The stages timed are the creation and refinement of a distributed
+// triangulation with hanging nodes, the enumeration of the degrees of
+// freedom on the active cells and on the multigrid levels, the computation
+// of hanging-node constraints, the creation of a distributed sparsity
+// pattern, the initialization of MatrixFree, and the creation of the
+// multigrid transfer. The statistics of every stage over all MPI processes
+// are printed to the standard output with
+// TimerOutput::print_wall_time_statistics(), and the maximal time over all
+// processes is recorded in the output file.
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_tools.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/multigrid/mg_constrained_dofs.h>
+#include <deal.II/multigrid/mg_transfer_matrix_free.h>
+
+#include <iostream>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+namespace
+{
+  constexpr int          dim    = 3;
+  constexpr unsigned int degree = 2;
+
+  const std::vector<std::string> stage_names = {"refine_mesh",
+                                                "distribute_dofs",
+                                                "distribute_mg_dofs",
+                                                "hanging_node_constraints",
+                                                "sparsity_pattern",
+                                                "matrix_free_reinit",
+                                                "mg_transfer"};
+
+
+
+  std::vector<double>
+  run_setup(const bool weak_scaling)
+  {
+    const MPI_Comm     comm        = MPI_COMM_WORLD;
+    const unsigned int n_processes = Utilities::MPI::n_mpi_processes(comm);
+
+    unsigned int n_refinements = 3;
+    switch (get_testing_environment())
+      {
+        case TestingEnvironment::light:
+          n_refinements = 3;
+          break;
+        case TestingEnvironment::medium:
+          n_refinements = 4;
+          break;
+        case TestingEnvironment::heavy:
+          n_refinements = 5;
+          break;
+      }
+
+    ConditionalOStream pcout(std::cout,
+                             Utilities::MPI::this_mpi_process(comm) == 0);
+    TimerOutput        timer(comm,
+                             pcout,
+                             TimerOutput::never,
+                             TimerOutput::wall_times);
+
+    parallel::distributed::Triangulation<dim> triangulation(
+      comm,
+      Triangulation<dim>::limit_level_difference_at_vertices,
+      parallel::distributed::Triangulation<
+        dim>::construct_multigrid_hierarchy);
+    DoFHandler<dim> dof_handler(triangulation);
+
+    {
+      TimerOutput::Scope scope(timer, stage_names[0]);
+
+      // for weak scaling, the coarse mesh consists of one cell per
+      // process, otherwise of a single cell
+      const unsigned int        n_coarse_cells = weak_scaling ? n_processes : 1;
+      std::vector<unsigned int> repetitions(dim, 1);
+      repetitions[0] = n_coarse_cells;
+      Point<dim> upper_right;
+      for (unsigned int d = 0; d < dim; ++d)
+        upper_right[d] = 1.;
+      upper_right[0] = n_coarse_cells;
+      GridGenerator::subdivided_hyper_rectangle(triangulation,
+                                                repetitions,
+                                                Point<dim>(),
+                                                upper_right);
+      triangulation.refine_global(n_refinements);
+
+      // refine a layer of cells to create hanging nodes on all processes
+      for (const auto &cell : triangulation.active_cell_iterators())
+        if (cell->is_locally_owned() && cell->center()[1] < 0.25)
+          cell->set_refine_flag();
+      triangulation.execute_coarsening_and_refinement();
+    }
+
+    const FE_Q<dim> fe(degree);
+    {
+      TimerOutput::Scope scope(timer, stage_names[1]);
+      dof_handler.distribute_dofs(fe);
+    }
+    {
+      TimerOutput::Scope scope(timer, stage_names[2]);
+      dof_handler.distribute_mg_dofs();
+    }
+
+    const IndexSet locally_relevant_dofs =
+      DoFTools::extract_locally_relevant_dofs(dof_handler);
+    AffineConstraints<double> constraints(dof_handler.locally_owned_dofs(),
+                                          locally_relevant_dofs);
+    {
+      TimerOutput::Scope scope(timer, stage_names[3]);
+      DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+      constraints.close();
+    }
+
+    {
+      TimerOutput::Scope     scope(timer, stage_names[4]);
+      DynamicSparsityPattern dsp(locally_relevant_dofs);
+      DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints, false);
+      SparsityTools::distribute_sparsity_pattern(
+        dsp, dof_handler.locally_owned_dofs(), comm, locally_relevant_dofs);
+    }
+
+    {
+      TimerOutput::Scope      scope(timer, stage_names[5]);
+      MatrixFree<dim, double> matrix_free;
+      typename MatrixFree<dim, double>::AdditionalData additional_data;
+      additional_data.mapping_update_flags =
+        update_gradients | update_JxW_values;
+      matrix_free.reinit(MappingQ1<dim>(),
+                         dof_handler,
+                         constraints,
+                         QGauss<1>(degree + 1),
+                         additional_data);
+    }
+
+    {
+      TimerOutput::Scope scope(timer, stage_names[6]);
+      MGConstrainedDoFs  mg_constrained_dofs;
+      mg_constrained_dofs.initialize(dof_handler);
+      MGTransferMatrixFree<dim, float> mg_transfer(mg_constrained_dofs);
+      mg_transfer.build(dof_handler);
+    }
+
+    pcout << (weak_scaling ? "Weak" : "Strong") << " scaling setup with "
+          << n_processes << " MPI processes, "
+          << triangulation.n_global_active_cells() << " cells, "
+          << dof_handler.n_dofs() << " DoFs:" << std::endl;
+    timer.print_wall_time_statistics(comm);
+
+    const std::map<std::string, double> wall_times =
+      timer.get_summary_data(TimerOutput::total_wall_time);
+    std::vector<double> result;
+    for (const std::string &name : stage_names)
+      result.push_back(Utilities::MPI::max(wall_times.at(name), comm));
+    return result;
+  }
+} // namespace
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  std::vector<std::string> names;
+  for (const std::string prefix : {"strong_", "weak_"})
+    for (const std::string &name : stage_names)
+      names.push_back(prefix + name);
+
+  return {Metric::timing, 3, names};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  Measurement measurement = run_setup(false);
+  for (const double time : run_setup(true))
+    measurement.push_back(time);
+  return measurement;
+}